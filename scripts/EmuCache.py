@@ -22,15 +22,16 @@ formulaeGlobal = {
     #
     # Texture caching
     #
-    # At glBindTexture time we can optionally write out the texture data
-    # as a .png file, for debugging.
+    # At glTexImage2D time uploads are looked up by content hash,
+    # optionally written out or substituted from the disk cache.
 
-    'glBindTexture' : {
-        'entries' : [ 'glBindTexture' ],
+    'glTexImage2D' : {
+        'entries' : [ 'glTexImage2D' ],
         'pre' : [
           'if (REGAL_CACHE && REGAL_CACHE_TEXTURE)',
           '{',
-          '  Cache::bindTexture(_next->call(&_next->glBindTexture),_next->call(&_next->glGetTexLevelParameteriv),_next->call(&_next->glGetTexImage), target, texture);',
+          '  const bool unpackState = _context->info && (!_context->info->es2 || _context->info->gles_version_major>=3);',
+          '  Cache::texImage2D(_next->call(&_next->glTexImage2D),_next->call(&_next->glGetIntegerv),_next->call(&_next->glPixelStorei), unpackState, target, level, internalformat, width, height, border, format, type, pixels);',
           '  return;',
           '}'
         ]
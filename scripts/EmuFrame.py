@@ -46,8 +46,13 @@ if (!_context->info->gl_gremedy_frame_terminator) return;
     'wglSwapBuffers' : {
         'entries' : [ 'wglSwapBuffers' ],
         'impl' : '''
-#if REGAL_FRAME
 RegalContext *_context = REGAL_GET_CONTEXT();
+#if REGAL_EMULATION && REGAL_EMU_IFF
+// Draw any batched glBegin/glEnd blocks ahead of the swap.
+if (_context && _context->iff)
+    _context->iff->SwapBuffers(_context);
+#endif
+#if REGAL_FRAME
 // Notify Regal::Frame about the swap buffers event.
 if (_context && _context->frame)
     _context->frame->wglSwapBuffers(*_context);
@@ -68,6 +73,11 @@ if (_context)
     #endif
     _context->x11Drawable = drawable;
 }
+#if REGAL_EMULATION && REGAL_EMU_IFF
+// Draw any batched glBegin/glEnd blocks ahead of the swap.
+if (_context && _context->iff)
+    _context->iff->SwapBuffers(_context);
+#endif
 #if REGAL_FRAME
 // Notify Regal::Frame about the swap buffers event.
 if (_context && _context->frame)
@@ -96,8 +106,13 @@ if (_context)
     'eglSwapBuffers' : {
         'entries' : [ 'eglSwapBuffers' ],
         'impl' : '''
-#if REGAL_FRAME
 RegalContext *_context = REGAL_GET_CONTEXT();
+#if REGAL_EMULATION && REGAL_EMU_IFF
+// Draw any batched glBegin/glEnd blocks ahead of the swap.
+if (_context && _context->iff)
+    _context->iff->SwapBuffers(_context);
+#endif
+#if REGAL_FRAME
 // Notify Regal::Frame about the swap buffers event.
 if (_context && _context->frame)
     _context->frame->eglSwapBuffers(*_context);
@@ -109,8 +124,13 @@ if (_context && _context->frame)
     'CGLFlushDrawable' : {
         'entries' : [ 'CGLFlushDrawable' ],
         'impl' : '''
-#if REGAL_FRAME
 RegalContext *_context = REGAL_GET_CONTEXT();
+#if REGAL_EMULATION && REGAL_EMU_IFF
+// Draw any batched glBegin/glEnd blocks ahead of the swap.
+if (_context && _context->iff)
+    _context->iff->SwapBuffers(_context);
+#endif
+#if REGAL_FRAME
 // Notify Regal::Frame about the flush drawable event.
 if (_context && _context->frame)
     _context->frame->CGLFlushDrawable(*_context);
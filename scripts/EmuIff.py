@@ -3,27 +3,45 @@
 iffFormulae = {
     'VaPointer4EXTOverride' : {
         'entries' : [ 'gl(Vertex|Color|TexCoord)PointerEXT' ],
-        'impl' : [ '_context->iff->${m1}Pointer( _context, ${arg0}, ${arg1}, ${arg2}, ${arg4} );' ],
+        'impl' : [
+            '_context->iff->RestoreVao( _context );',
+            '_context->iff->${m1}Pointer( _context, ${arg0}, ${arg1}, ${arg2}, ${arg4} );',
+        ],
     },
     'EdgeFlagPointerEXT' : {
         'entries' : [ 'glEdgeFlagPointerEXT' ],
-        'impl' : [ '_context->iff->EdgeFlagPointer( _context, ${arg0}, ${arg2} );' ],
+        'impl' : [
+            '_context->iff->RestoreVao( _context );',
+            '_context->iff->EdgeFlagPointer( _context, ${arg0}, ${arg2} );',
+        ],
     },
     'NormalPointerEXT' : {
         'entries' : [ 'glNormalPointerEXT' ],
-        'impl' : [ '_context->iff->NormalPointer( _context, ${arg0}, ${arg1}, ${arg3} );' ],
+        'impl' : [
+            '_context->iff->RestoreVao( _context );',
+            '_context->iff->NormalPointer( _context, ${arg0}, ${arg1}, ${arg3} );',
+        ],
     },
     'PointerEXT' : {
         'entries' : [ 'gl(FogCoord|SecondaryColor)PointerEXT' ],
-        'impl' : [ '_context->iff->${m1}Pointer( _context, ${arg0plus} );' ],
+        'impl' : [
+            '_context->iff->RestoreVao( _context );',
+            '_context->iff->${m1}Pointer( _context, ${arg0plus} );',
+        ],
     },
     'VaPointerOverride' : {
         'entries' : [ 'gl(Vertex|Normal|Color|SecondaryColor|FogCoord|EdgeFlag|TexCoord)Pointer' ],
-        'impl' : [ '_context->iff->${m1}Pointer( _context, ${arg0plus} );' ],
+        'impl' : [
+            '_context->iff->RestoreVao( _context );',
+            '_context->iff->${m1}Pointer( _context, ${arg0plus} );',
+        ],
     },
     'VaClientStateOverride' : {
         'entries' : [ 'gl(Enable|Disable)ClientState' ],
-        'impl' : [ '_context->iff->${m1}ClientState( _context, ${arg0} );' ],
+        'impl' : [
+            '_context->iff->RestoreVao( _context );',
+            '_context->iff->${m1}ClientState( _context, ${arg0} );',
+        ],
     },
     'IsEnabled' : {
         'entries' : [ 'glIsEnabled' ],
@@ -38,7 +56,10 @@ iffFormulae = {
     },
     'ImmShadowVao' : {
         'entries' : [ 'glBindVertexArray.*', ],
-        'prefix' : [ '_context->iff->glBindVertexArray( _context, ${arg0} ); ', ],
+        'prefix' : [
+            '_context->iff->RestoreVao( _context );',
+            '_context->iff->glBindVertexArray( _context, ${arg0} ); ',
+        ],
     },
    'IsVertexArray' : {
         'entries' : [ 'glIsVertexArray(ARB|)' ],
@@ -46,7 +67,24 @@ iffFormulae = {
     },
    'DeleteStuff' : {
         'entries' : [ 'glDelete(Buffers|VertexArrays)(ARB|)' ],
-        'impl' : [ '_context->iff->glDelete${m1}( _context, ${arg0}, ${arg1} );' ],
+        'impl' : [
+            '_context->iff->RestoreVao( _context );',
+            '_context->iff->glDelete${m1}( _context, ${arg0}, ${arg1} );',
+        ],
+    },
+    'ImmShadowBindBuffer' : {
+        'entries' : [ 'glBindBuffer(ARB|)' ],
+        'prefix' : [
+            '_context->iff->RestoreVao( _context );',
+            '_context->iff->ShadowBindBuffer( ${arg0}, ${arg1} ); ',
+        ],
+    },
+    'ImmShadowBindBufferRange' : {
+        'entries' : [ 'glBindBuffer(Base|Range|Offset)(EXT|NV|)' ],
+        'prefix' : [
+            '_context->iff->RestoreVao( _context );',
+            '_context->iff->ShadowBindBuffer( ${arg0}, ${arg2} ); ',
+        ],
     },
     'ImmShadowClientActiveTexture' : {
         'entries' : [ 'glClientActiveTexture(ARB|)', ],
@@ -90,7 +128,6 @@ iffFormulae = {
     },
     'ImmRestore' : {
         'entries' : [
-            'glBindBuffer',
 #           'gl(Enable|Disable)ClientState',
             'glVertexAttribPointer(ARB|)',
 #           'gl(Vertex|Normal|Color|SecondaryColor|FogCoord|TexCoord)Pointer',
@@ -98,6 +135,64 @@ iffFormulae = {
             ],
         'prefix' : [ '_context->iff->RestoreVao( _context );' ],
     },
+    # Draw batched glBegin/glEnd blocks ahead of state changes,
+    # queries and readbacks not otherwise seen by Iff
+    'ImmFlushBatch' : {
+        'entries' : [
+            'glReadPixels',
+            'glFinish',
+            'glFlush',
+            'glClear',
+            'glClearBuffer(iv|uiv|fv|fi)',
+            'glClear(Color|Depth|Stencil|Accum|Index)(f|)',
+            'glBlend(Func|Equation)(Separate|)(i|)(ARB|EXT|)',
+            'glBlendColor(EXT|)',
+            'glDepth(Func|Mask)',
+            'glStencil(Func|Mask|Op)(Separate|)',
+            'gl(Color|Index)Mask',
+            'gl(Cull|Front)Face',
+            'glPolygon(Mode|Offset|Stipple)',
+            'glLine(Width|Stipple)',
+            'glPoint(Size|Parameter(i|f)(v|))',
+            'glScissor',
+            'glLogicOp',
+            'glSampleCoverage(ARB|)',
+            'glBind(Framebuffer|Renderbuffer)(EXT|)',
+            'glDrawBuffer(s|)(ARB|)',
+            'glReadBuffer',
+            'glBlitFramebuffer(EXT|)',
+            'glBindSampler',
+            'glTexParameter(i|f|Ii|Iui)(v|)',
+            'glTexSubImage(1|2|3)D',
+            'glCopyTexSubImage(1|2|3)D',
+            'glGenerateMipmap(EXT|)',
+            'glCopyTexImage1D(EXT|)',
+            'glCopyTexImage2DEXT',
+            'glCompressedTex(Sub|)Image(1|2|3)D(ARB|)',
+            'glTexStorage(1|2|3)D(Multisample|)(EXT|)',
+            'glDeleteTextures(EXT|)',
+            'glSamplerParameter(i|f|Ii|Iui)(v|)',
+            'glGetTexImage',
+            'glGetCompressedTexImage(ARB|)',
+            'glFramebufferTexture(1D|2D|3D|Layer|Face|)(ARB|EXT|)',
+            'glFramebufferRenderbuffer(EXT|)',
+            'glNamedFramebuffer(Texture(1D|2D|3D|Layer|Face|)|Renderbuffer)EXT',
+            'gl(Texture|MultiTex)(Parameter(i|f|Ii|Iui)(v|)|SubImage(1|2|3)D|Storage(1|2|3)D(Multisample|)|Buffer|Renderbuffer)EXT',
+            'gl(Copy|Compressed)(Texture|MultiTex)(Sub|)Image(1|2|3)DEXT',
+            'glGenerate(Texture|MultiTex)MipmapEXT',
+            'glGet(Texture|MultiTex|CompressedTexture|CompressedMultiTex)ImageEXT',
+            'glDrawPixels',
+            'glBitmap',
+            'glCopyPixels',
+            'glMemoryBarrier(EXT|)',
+            'gl(Begin|End)Query(ARB|)',
+            'glQueryCounter',
+            'glGetQueryObject(i|ui|i64|ui64)v(ARB|EXT|)',
+            'glFenceSync',
+            'gl(Client|)WaitSync',
+            ],
+        'prefix' : [ '_context->iff->FlushBatch( _context );' ],
+    },
 
 
 
@@ -108,6 +203,7 @@ iffFormulae = {
     'FfnShadeModel' : {
         'entries' : [ 'glShadeModel' ],
         'impl' : [
+          '_context->iff->FlushBatch( _context );',
           '_context->iff->ShadeModel( ${arg0plus} );',
           'if( !_context->isCore() && !_context->isES2() ) {',
           '  _context->dispatcher.emulation.glShadeModel(${arg0plus});',
@@ -117,6 +213,7 @@ iffFormulae = {
     'FfnShadow' : {
         'entries' : [ 'gl(MatrixMode|BindProgramPipeline|Enable|Disable)' ],
         'impl' : [
+            '_context->iff->FlushBatch( _context );',
             'if( ! _context->iff->Shadow${m1}( ${arg0plus} ) ) {',
             '    _context->dispatcher.emulation.gl${m1}( ${arg0plus} );',
             '}',
@@ -125,6 +222,7 @@ iffFormulae = {
     'FfnShadowProgram' : {
         'entries' : [ 'gl(UseProgram)(ObjectARB|)' ],
         'impl' : [
+            '_context->iff->FlushBatch( _context );',
             'if( ! _context->iff->Shadow${m1}( ${arg0plus} ) ) {',
             '    _context->dispatcher.emulation.gl${m1}( ${arg0plus} );',
             '}',
@@ -132,31 +230,52 @@ iffFormulae = {
     },
     'FfnShadowIndexed' : {
         'entries' : [ 'gl(Enable|Disable)(i|IndexedEXT)' ],
-        'impl' : [ '_context->iff->${m1}Indexed( ${arg0plus} );', ],
+        'impl' : [
+            '_context->iff->FlushBatch( _context );',
+            '_context->iff->${m1}Indexed( ${arg0plus} );',
+        ],
     },
     'FfnShadowTexBinding' : {
         'entries' : [ 'glBind(Multi|)Texture(EXT|)' ],
-        'prefix' : [ '_context->iff->Shadow${m1}TexBinding( ${arg0plus} );', ],
+        'prefix' : [
+            '_context->iff->FlushBatch( _context );',
+            '_context->iff->Shadow${m1}TexBinding( ${arg0plus} );',
+        ],
     },
     'FfnShadowDsaTexInfo' : {
         'entries' : [ 'gl(MultiTex|Texture)Image.*EXT' ],
-        'prefix' : [ '_context->iff->Shadow${m1}Info( ${arg0}, ${arg1}, ${arg3} );', ],
+        'prefix' : [
+            '_context->iff->FlushBatch( _context );',
+            '_context->iff->Shadow${m1}Info( ${arg0}, ${arg1}, ${arg3} );',
+        ],
     },
     'FfnShadowTexInfo' : {
         'entries' : [ 'glTexImage(1|2|3|4)D(Multisample)?(EXT|ARB|SGIS|)' ],
-        'prefix' : [ '_context->iff->ShadowTexInfo( ${arg0}, ${arg2} );', ],
+        'prefix' : [
+            '_context->iff->FlushBatch( _context );',
+            '_context->iff->ShadowTexInfo( ${arg0}, ${arg2} );',
+        ],
     },
     'FfnShadowTexInfo2' : {
         'entries' : [ 'glTexImage(1|2|3|4)DMultisampleCoverageNV' ],
-        'prefix' : [ '_context->iff->ShadowTexInfo( ${arg0}, ${arg3} );', ],
+        'prefix' : [
+            '_context->iff->FlushBatch( _context );',
+            '_context->iff->ShadowTexInfo( ${arg0}, ${arg3} );',
+        ],
     },
     'FfnShadowTexInfo3' : {
         'entries' : [ 'glCopyTexImage2D' ],
-        'prefix' : [ '_context->iff->ShadowTexInfo( ${arg0}, ${arg2} );', ],
+        'prefix' : [
+            '_context->iff->FlushBatch( _context );',
+            '_context->iff->ShadowTexInfo( ${arg0}, ${arg2} );',
+        ],
     },
     'FfnTexEnv' : {
         'entries' : [ 'gl(Multi|)TexEnv(i|f)(v|)(EXT|)' ],
-        'impl' : [ '_context->iff->TexEnv( ${arg0plus} );', ],
+        'impl' : [
+            '_context->iff->FlushBatch( _context );',
+            '_context->iff->TexEnv( ${arg0plus} );',
+        ],
     },
     'FfnGetTexEnv' : {
         'entries' : [ 'glGetTexEnv(i|f)(v|)(EXT|)' ],
@@ -169,15 +288,22 @@ iffFormulae = {
     },
     'FfnLightMatModel' : {
         'entries' : [ 'gl(Light|Material|GetMaterial|LightModel)(i|f)(v|)' ],
-        'impl' : [ '_context->iff->${m1}( ${arg0plus} );', ],
+        'impl' : [
+            '_context->iff->FlushBatch( _context );',
+            '_context->iff->${m1}( ${arg0plus} );',
+        ],
     },
     'FfnColorMaterial' : {
         'entries' : [ 'glColorMaterial' ],
-        'impl' : [ '_context->iff->ColorMaterial( ${arg0plus} );', ],
+        'impl' : [
+            '_context->iff->FlushBatch( _context );',
+            '_context->iff->ColorMaterial( ${arg0plus} );',
+        ],
     },
     'FfnTexGen' : {
         'entries' : [ 'glTexGen(i|f|d)(v|)' ],
         'impl' : [
+            '_context->iff->FlushBatch( _context );',
             'if ( ! _context->iff->TexGen( ${arg0plus} ) ) {',
             '    _context->dispatcher.emulation.glTexGen${m1}${m2}( ${arg0plus} );',
             '}',
@@ -185,15 +311,24 @@ iffFormulae = {
     },
     'FfnAlphaFunc' : {
         'entries' : [ 'glAlphaFunc' ],
-        'impl' : [ '_context->iff->AlphaFunc( ${arg0plus} );', ],
+        'impl' : [
+            '_context->iff->FlushBatch( _context );',
+            '_context->iff->AlphaFunc( ${arg0plus} );',
+        ],
     },
     'FfnClipPlane' : {
         'entries' : [ 'glClipPlane' ],
-        'impl' : [ '_context->iff->ClipPlane( ${arg0plus} );', ],
+        'impl' : [
+            '_context->iff->FlushBatch( _context );',
+            '_context->iff->ClipPlane( ${arg0plus} );',
+        ],
     },
     'FfnFog' : {
         'entries' : [ 'glFog(f|i)(v|)' ],
-        'impl' : [ '_context->iff->Fog( ${arg0plus} );', ],
+        'impl' : [
+            '_context->iff->FlushBatch( _context );',
+            '_context->iff->Fog( ${arg0plus} );',
+        ],
     },
     'FfnGetBoolean' : {
         'entries' : [ 'glGetBooleanv' ],
@@ -234,7 +369,10 @@ iffFormulae = {
     # TODO - GL_ARB_base_instance ?
     'FfnPreDraw' : {
         'entries' : [ 'gl(Multi|)Draw(Range|)(Arrays|Element|Elements)(Instanced|Indirect|BaseVertex|InstancedBaseVertex|Array|)(ARB|EXT|AMD|ATI|APPLE|)' ],
-        'prefix' : [ '_context->iff->PreDraw( _context );', ],
+        'prefix' : [
+            '_context->iff->RestoreVao( _context );',
+            '_context->iff->PreDraw( _context );',
+        ],
     },
     'FfnModifyMatrix' : {
         'entries' : [
@@ -249,19 +387,31 @@ iffFormulae = {
             'gl(Matrix)(Ortho|Frustum)()()EXT',
             'gl(Matrix)(Push|Pop)()()EXT',
         ],
-        'impl' : [ '_context->iff->${m1}${m2}${m3}( ${arg0plus} );' ],
+        'impl' : [
+            '_context->iff->FlushBatch( _context );',
+            '_context->iff->${m1}${m2}${m3}( ${arg0plus} );',
+        ],
     },
     'Viewport' : {
         'entries' : [ 'glViewport', ],
-        'prefix' : [ '_context->iff->Viewport( ${arg0plus} );', ],
+        'prefix' : [
+            '_context->iff->FlushBatch( _context );',
+            '_context->iff->Viewport( ${arg0plus} );',
+        ],
     },
     'DepthRange' : {
         'entries' : [ 'glDepthRange', ],
-        'prefix' : [ '_context->iff->DepthRange( GLfloat(${arg0}), GLfloat(${arg1}) );', ],
+        'prefix' : [
+            '_context->iff->FlushBatch( _context );',
+            '_context->iff->DepthRange( GLfloat(${arg0}), GLfloat(${arg1}) );',
+        ],
     },
     'RasterPosition' : {
         'entries' : [ 'gl(Raster|Window)Pos(2|3)(i|s|f|d)', ],
-        'impl' : [ '_context->iff->${m1}Position( _context, ${arg0plus} );', ],
+        'impl' : [
+            '_context->iff->FlushBatch( _context );',
+            '_context->iff->${m1}Position( _context, ${arg0plus} );',
+        ],
     },
     'EnableArray' : {
         'entries' : [ 'gl(Enable|Disable)VertexAttribArray(ARB|)' ],
@@ -273,11 +423,17 @@ iffFormulae = {
 
     'ShaderSource' : {
         'entries' : [ 'glShaderSource(ARB|)?', ],
-        'impl' : [ '_context->iff->ShaderSource( _context, ${arg0plus} );', ],
+        'impl' : [
+            '_context->iff->FlushBatch( _context );',
+            '_context->iff->ShaderSource( _context, ${arg0plus} );',
+        ],
     },
     'LinkProgram' : {
         'entries' : [ 'glLinkProgram(ARB|)?', ],
-        'impl' : [ '_context->iff->LinkProgram( _context, ${arg0} );', ],
+        'impl' : [
+            '_context->iff->FlushBatch( _context );',
+            '_context->iff->LinkProgram( _context, ${arg0} );',
+        ],
     },
     'CreateShader' : {
         'entries' : [ 'glCreateShader(ObjectARB)?', ],
@@ -286,6 +442,7 @@ iffFormulae = {
     'Uniform' : {
         'entries' : [ 'glUniform(1|2|3|4)(d|f|i|ui)(ARB|)', ],
         'impl' : [ 
+          '_context->iff->FlushBatch( _context );',
           'if( _context->iff->currinst ) {',
           '  _context->iff->Uniform( _context, ${m1}, ${arg0}, 1, ${arg1plus} );',
           '} else {',
@@ -296,6 +453,7 @@ iffFormulae = {
     'Uniformv' : {
         'entries' : [ 'glUniform(1|2|3|4)(d|f|i|ui)v(ARB|)', ],
         'impl' : [ 
+          '_context->iff->FlushBatch( _context );',
           'if( _context->iff->currinst ) {',
           '  _context->iff->Uniform( _context, ${m1}, ${arg0plus} );',
           '} else {',
@@ -306,6 +464,7 @@ iffFormulae = {
     'UniformMatrix' : {
         'entries' : [ 'glUniformMatrix(2|3|4)(d|f)v(ARB|)', ],
         'impl' : [ 
+          '_context->iff->FlushBatch( _context );',
           'if( _context->iff->currinst ) {',
           '  _context->iff->UniformMatrix( _context, ${m1}, ${m1}, ${arg0plus} );',
           '} else {',
@@ -316,6 +475,7 @@ iffFormulae = {
     'UniformMatrixNonSquare' : {
         'entries' : [ 'glUniformMatrix(2|3|4)x(2|3|4)(d|f)v(ARB|)', ],
         'impl' : [ 
+          '_context->iff->FlushBatch( _context );',
           'if( _context->iff->currinst ) {',
           '  _context->iff->UniformMatrix( _context, ${m1}, ${m2}, ${arg0plus} );',
           '} else {',
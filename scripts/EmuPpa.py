@@ -157,6 +157,10 @@ ppaFormulae = {
     'entries'    : [ 'glMapGrid(1|2)(f|d)' ],
     'prefix'     : [ '_context->ppa->glMapGrid${m1}( ${arg0plus} );', ],
   },
+  'TrackFog' : {
+    'entries'    : [ 'glFog(i|f)(v|)' ],
+    'prefix'     : [ '_context->ppa->glFog${m2}( ${arg0plus} );', ],
+  },
   'TrackPointSize' : {
     'entries'    : [ 'glPointSize' ],
     'prefix'     : [ '_context->ppa->glPointSize( ${arg0plus} );', ],
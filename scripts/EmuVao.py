@@ -90,4 +90,55 @@ vaoFormulae = {
         'entries' : [ 'glClientActiveTexture(ARB|)' ],
         'prefix' : [ '_context->vao->ClientActiveTexture(*_context, ${arg0} );' ],
     },
+    'BufferWrite' : {
+        'entries' : [
+            'gl(Named|)Buffer(Sub|)Data(ARB|EXT|)',
+            'gl(Named|)BufferStorage(EXT|)',
+            'glClear(Named|)Buffer(Sub|)Data(EXT|)',
+            'glCopy(Named|)BufferSubData',
+            'glNamedCopyBufferSubDataEXT',
+            'glMap(Named|)Buffer(ARB|EXT|)',
+            'glUnmap(Named|)Buffer(ARB|EXT|)',
+            'glFlushMapped(Named|)BufferRange(APPLE|EXT|)',
+            'glMemoryBarrier(EXT|)',
+            'glGetQueryBufferObject(i|ui|i64|ui64)v',
+            'glRead(n|)Pixels(ARB|EXT|KHR|)',
+            'glGet(n|)(Compressed|)TexImage(ARB|)',
+            'glGet(Compressed|)(Texture|MultiTex)Image(EXT|)',
+            'glGet(Compressed|)TextureSubImage',
+        ],
+        'prefix' : [ '_context->vao->BufferWrite();' ],
+    },
+    'QueryBufferWrite' : {
+        'entries' : [ 'glGetQueryObject(i|ui|i64|ui64)v(ARB|EXT|)' ],
+        'prefix' : [ '_context->vao->QueryBufferWrite();' ],
+    },
+    'BeginTransformFeedback' : {
+        'entries' : [ 'gl(Begin|Resume)TransformFeedback(EXT|NV|)' ],
+        'prefix' : [ '_context->vao->TransformFeedback( true );' ],
+    },
+    'EndTransformFeedback' : {
+        'entries' : [ 'gl(End|Pause)TransformFeedback(EXT|NV|)' ],
+        'prefix' : [ '_context->vao->TransformFeedback( false );' ],
+    },
+    'MapBufferRange' : {
+        'entries' : [ 'glMap(Named|)BufferRange(EXT|)' ],
+        'prefix' : [ '_context->vao->MapBufferRange( ${arg3} );' ],
+    },
+    'DrawArrays' : {
+        'entries' : [ 'glDrawArrays(EXT|)', 'glDrawArraysInstanced(ARB|EXT|)', 'glDrawArraysInstancedBaseInstance' ],
+        'prefix' : [ '_context->vao->DrawArrays(*_context, ${arg1}, ${arg2} );' ],
+    },
+    'MultiDrawArrays' : {
+        'entries' : [ 'glMultiDrawArrays(EXT|)' ],
+        'prefix' : [ '_context->vao->MultiDrawArrays(*_context, ${arg1}, ${arg2}, ${arg3} );' ],
+    },
+    'DrawElements' : {
+        'entries' : [ 'gl(DrawElements|DrawElementsInstanced|DrawElementsInstancedBaseInstance|DrawElementsBaseVertex|DrawElementsInstancedBaseVertex|DrawElementsInstancedBaseVertexBaseInstance|DrawRangeElements|DrawRangeElementsBaseVertex|MultiDrawElements|MultiDrawElementsBaseVertex)' ],
+        'impl' : [
+            'if ( !_context->vao->${m1}(*_context, ${arg0plus} ) ) {',
+            '   _context->dispatcher.emulation.${name}( ${arg0plus} );',
+            '}',
+        ]
+    },
 }
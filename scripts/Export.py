@@ -38,6 +38,7 @@ from RegalLookup             import *
 from RegalPlugin             import *
 from RegalToken              import *
 from RegalDispatch           import *
+from RegalDispatchBinaryLog  import *
 from RegalDispatchCode       import *
 from RegalDispatchDebug      import *
 from RegalDispatchError      import *
@@ -49,6 +50,7 @@ from RegalDispatchHttp       import *
 from RegalDispatchLoader     import *
 from RegalDispatchMissing    import *
 from RegalDispatchPpapi      import *
+from RegalDispatchRedundant  import *
 from RegalDispatchStatistics import *
 from RegalDispatchStaticEGL  import *
 from RegalDispatchStaticES2  import *
@@ -226,6 +228,8 @@ def generate(apis, args):
   generateSystemHeader(apis, args)
   generateEmuSource( apis, args )
   generateDispatchLog( apis, args )
+  generateDispatchBinaryLog( apis, args )
+  generateDispatchRedundant( apis, args )
   generateDispatchHttp( apis, args )
   generateDispatchCode( apis, args )
   generateErrorSource( apis, args )
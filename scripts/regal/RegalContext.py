@@ -121,6 +121,7 @@ REGAL_NAMESPACE_BEGIN
 struct EmuInfo;
 struct DebugInfo;
 struct Statistics;
+struct Redundant;
 
 ${EMU_FORWARD_DECLARE}
 
@@ -168,6 +169,10 @@ struct RegalContext
   scoped_ptr<Statistics>  statistics;
 #endif
 
+#if REGAL_REDUNDANT
+  scoped_ptr<Redundant>   redundant;
+#endif
+
   //
   // Emulation
   //
@@ -260,6 +265,7 @@ REGAL_GLOBAL_BEGIN
 #include "RegalDebugInfo.h"
 #include "RegalContextInfo.h"
 #include "RegalStatistics.h"
+#include "RegalRedundant.h"
 
 
 ${INCLUDES}#if REGAL_EMULATION
@@ -279,6 +285,9 @@ RegalContext::RegalContext()
 #if REGAL_STATISTICS
   statistics(new Statistics()),
 #endif
+#if REGAL_REDUNDANT
+  redundant(new Redundant()),
+#endif
 ${MEMBER_CONSTRUCT}#if REGAL_EMULATION
 ${EMU_MEMBER_CONSTRUCT}#endif
 #if REGAL_SYS_PPAPI
@@ -434,6 +443,11 @@ RegalContext::Cleanup()
 #if REGAL_EMULATION
 ${EMU_MEMBER_CLEANUP}#endif
 
+  #if REGAL_FRAME
+  if (frame)
+    frame->Cleanup(*this);
+  #endif /* REGAL_FRAME */
+
   initialized = false;
 }
 
@@ -570,6 +584,7 @@ def generateContextSource(apis, args):
     emuMemberConstruct += '  emuLevel(0),\n'
 
     emuMemberInit += '    // emu\n'
+    emuMemberInit += '    dispatcher.setLookup(dispatcher.emulation,dispatcher.emulation);\n'
     emuMemberInit += '    emuLevel = %d;\n' % ( len( emu ) - 1 )
     emuMemberCleanup  += '  // emu\n'
 
@@ -617,6 +632,11 @@ def generateContextSource(apis, args):
         emuMemberInit += indent(init,'    ')
 
     emuMemberInit += '    emuLevel = %d;\n' % ( len( emu ) - 1 )
+    emuMemberInit += '\n'
+    emuMemberInit += '    // Step past the emulation layer for calls no active layer acts on\n'
+    emuMemberInit += '\n'
+    emuMemberInit += '    InitDispatchTableEmuRoute(*this,dispatcher.emulationRoute);\n'
+    emuMemberInit += '    dispatcher.setLookup(dispatcher.emulation,dispatcher.emulationRoute);\n'
 
     # Output
 
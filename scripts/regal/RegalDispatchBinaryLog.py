@@ -0,0 +1,211 @@
+#!/usr/bin/python -B
+
+from string import Template, upper, replace
+
+from ApiCodeGen   import *
+from ApiUtil      import outputCode
+from ApiUtil      import typeIsVoid
+
+from RegalContextInfo import cond
+
+from RegalDispatchShared import apiDispatchFuncInitCode
+
+# CodeGen for binary logging dispatch.
+
+dispatchBinaryLogTemplate = Template('''${AUTOGENERATED}
+${LICENSE}
+
+#include "pch.h" /* For MS precompiled header support */
+
+#include "RegalUtil.h"
+
+#if REGAL_LOG_BINARY
+
+REGAL_GLOBAL_BEGIN
+
+#include "RegalLogBinary.h"
+#include "RegalContext.h"
+#include "RegalDispatch.h"
+#include "RegalDispatcherGL.h"
+
+using namespace ::REGAL_NAMESPACE_INTERNAL::BinaryLog;
+
+REGAL_GLOBAL_END
+
+REGAL_NAMESPACE_BEGIN
+
+namespace BinaryLog
+{
+  const Function functions[] =
+  {
+${API_FUNCTIONS}
+  };
+
+  const GLuint functionCount = ${API_FUNCTION_COUNT};
+}
+
+${API_FUNC_DEFINE}
+
+void InitDispatchTableBinaryLog(DispatchTableGL &tbl)
+{
+${API_GL_DISPATCH_INIT}
+}
+
+REGAL_NAMESPACE_END
+
+#endif
+''')
+
+signedTypes   = [ 'GLint', 'GLsizei', 'GLshort', 'GLbyte', 'GLint64', 'GLint64EXT', 'GLintptr', 'GLsizeiptr',
+                  'GLintptrARB', 'GLsizeiptrARB', 'GLfixed', 'GLclampx', 'GLvdpauSurfaceNV', 'int' ]
+unsignedTypes = [ 'GLuint', 'GLushort', 'GLubyte', 'GLuint64', 'GLuint64EXT', 'GLhalfNV', 'GLhalfARB', 'GLhandleARB', 'unsigned int' ]
+stringTypes   = [ 'const GLchar *', 'const char *', 'const GLcharARB *', 'GLchar *', 'char *', 'GLcharARB *', 'LPCSTR' ]
+
+# One signature character per type, see RegalLogBinary.h
+
+def binaryTypeCode(t, output = False):
+  t = t.strip()
+  if typeIsVoid(t):
+    return 'v'
+  if t in stringTypes:
+    return 'p' if output else 's'
+  if t.find('*')!=-1:
+    return 'p'
+  t = t.replace('const ', '')
+  if t=='GLenum':
+    return 'e'
+  if t=='GLboolean':
+    return 'b'
+  if t=='GLbitfield':
+    return 'x'
+  if t in [ 'GLfloat', 'GLclampf' ]:
+    return 'f'
+  if t in [ 'GLdouble', 'GLclampd' ]:
+    return 'd'
+  if t in signedTypes:
+    return 'i'
+  if t in unsignedTypes:
+    return 'u'
+  return 'p'
+
+# Strings passed with a length, such as glObjectLabel, are not
+# necessarily NUL-terminated.  The length is the integer parameter
+# just before the string, negative for a terminated string.  For the
+# EXT_debug_marker entry points zero also means terminated.
+
+zeroTerminatedLength = [ 'glInsertEventMarkerEXT', 'glPushGroupMarkerEXT' ]
+
+def binaryStringLength(function, i):
+  if i>0:
+    prev = function.parameters[i-1]
+    if prev.type.strip() in [ 'GLsizei', 'GLint' ] and prev.name.lower().endswith(('len', 'length')):
+      if function.name in zeroTerminatedLength:
+        return '%s ? GLint(%s) : -1' % (prev.name, prev.name)
+      return 'GLint(%s)' % prev.name
+  return '-1'
+
+def binaryFunctions(apis):
+  for api in apis:
+    for function in api.functions:
+      if getattr(function,'regalOnly',False)==True:
+        continue
+      if not function.needsContext:
+        continue
+      yield api, function
+
+def generateDispatchBinaryLog(apis, args):
+
+  # Entry point ids, independent of the platform
+
+  table = []
+  ids = {}
+  for api, function in binaryFunctions(apis):
+    signature = binaryTypeCode(typeCode(function.ret.type))
+    for i in function.parameters:
+      signature += binaryTypeCode(i.type, i.output)
+    ids[function.name] = len(table)
+    table.append('    { %-50s "%s" },' % ('"%s",' % function.name, signature))
+
+  # CodeGen for API functions.
+
+  code = ''
+  categoryPrev = None
+  apiPrev = None
+
+  for api, function in binaryFunctions(apis):
+
+    if api!=apiPrev:
+      if apiPrev and apiPrev.name in cond:
+        code += '#endif // %s\n' % cond[apiPrev.name]
+      code += '\n'
+      if api.name in cond:
+        code += '#if %s\n' % cond[api.name]
+      apiPrev = api
+
+    name   = function.name
+    params = paramsDefaultCode(function.parameters, True)
+    callParams = paramsNameCode(function.parameters)
+    rType  = typeCode(function.ret.type)
+    category  = getattr(function, 'category', None)
+    version   = getattr(function, 'version', None)
+
+    if category:
+      category = category.replace('_DEPRECATED', '')
+    elif version:
+      category = version.replace('.', '_')
+      category = 'GL_VERSION_' + category
+
+    # Close prev category block.
+    if categoryPrev and not (category == categoryPrev):
+      code += '\n'
+
+    # Begin new category block.
+    if category and not (category == categoryPrev):
+      code += '// %s\n\n' % category
+
+    categoryPrev = category
+
+    words   = [ 'word(%s)' % i.name for i in function.parameters ]
+    strings = [ 'reinterpret_cast<const char *>(%s)' % i.name for i in function.parameters if binaryTypeCode(i.type, i.output)=='s' ]
+    lengths = [ binaryStringLength(function, j) for j, i in enumerate(function.parameters) if binaryTypeCode(i.type, i.output)=='s' ]
+    if not typeIsVoid(rType):
+      words.append('word(ret)')
+
+    code += 'static %sREGAL_CALL %s%s(%s) \n{\n' % (rType, 'binary_', name, params)
+    code += '    RegalContext *_context = REGAL_GET_CONTEXT();\n'
+    code += '    RegalAssert(_context);\n'
+    code += '    DispatchTableGL *_next = _context->dispatcher.binaryLog.next();\n'
+    code += '    RegalAssert(_next);\n'
+    code += '    '
+    if not typeIsVoid(rType):
+      code += '%s ret = '%(rType)
+    code += '_next->call(&_next->%s)(%s);\n' % ( name, callParams )
+
+    if len(words):
+      code += '    const GLuint64 _args[%d] = { %s };\n' % (len(words), ', '.join(words))
+    if len(strings):
+      code += '    const char *_strings[%d] = { %s };\n' % (len(strings), ', '.join(strings))
+    sized = len([ j for j in lengths if j!='-1' ])
+    if sized:
+      code += '    const GLint _lengths[%d] = { %s };\n' % (len(lengths), ', '.join(lengths))
+    code += '    call(%d, %s, %d, %s, %s, %d);\n' % (ids[name], '_args' if len(words) else 'NULL', len(words), '_strings' if len(strings) else 'NULL', '_lengths' if sized else 'NULL', len(strings))
+
+    if not typeIsVoid(rType):
+      code += '    return ret;\n'
+    code += '}\n\n'
+
+  if apiPrev and apiPrev.name in cond:
+    code += '#endif // %s\n' % cond[apiPrev.name]
+
+  # Output
+
+  substitute = {}
+  substitute['LICENSE']            = args.license
+  substitute['AUTOGENERATED']      = args.generated
+  substitute['COPYRIGHT']          = args.copyright
+  substitute['API_FUNCTIONS']      = '\n'.join(table)
+  substitute['API_FUNCTION_COUNT'] = len(table)
+  substitute['API_FUNC_DEFINE']    = code
+  substitute['API_GL_DISPATCH_INIT'] = apiDispatchFuncInitCode( apis, args, 'binary' )
+
+  outputCode( '%s/RegalDispatchBinaryLog.cpp' % args.srcdir, dispatchBinaryLogTemplate.substitute(substitute))
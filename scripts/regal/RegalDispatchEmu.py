@@ -360,9 +360,108 @@ def apiEmuDispatchFuncInitCode(apis, args):
 
   return code
 
-emuLocalCode = '''
+# CodeGen for routing the emulation table.
+#
+# At context initialization, only the entries that some instantiated
+# emulation layer acts on are kept in the table read when stepping
+# down the dispatch stack.  Calls untouched by the active layers go
+# straight past the emulation layer.
+
+emuRouteAlways = [ 'glEnable', 'glDisable', 'glIsEnabled', 'glBindTexture', 'glTexImage2D', 'glTexSubImage2D' ]
+
+def emuRouteName(layer):
+  return 'EMU_ROUTE_%s' % upper(layer['member'])
+
+def apiEmuDispatchRouteCode(apis, args):
+  categoryPrev = None
+  code = ''
+
+  code += '// Entries of the emulation table acted on by the\n'
+  code += '// emulation layers instantiated for this context\n'
+  code += '\n'
+  code += 'void InitDispatchTableEmuRoute(RegalContext &ctx, DispatchTableGL &tbl)\n'
+  code += '{\n'
+  code += '  unsigned int layers = 0;\n'
+  for i in emu:
+    if i['member']:
+      code += '  #if %s\n' % i['ifdef']
+      code += '  if (ctx.%s) layers |= %s;\n' % (i['member'], emuRouteName(i))
+      code += '  #endif\n'
+  code += '  UNUSED_PARAMETER(ctx);\n'
+
+  for api in apis:
+
+    code += '\n'
+    if api.name in cond:
+      code += '#if %s\n' % cond[api.name]
+
+    for function in api.functions:
+      if not function.needsContext:
+        continue
+      if getattr(function,'regalOnly',False)==True:
+        continue
+
+      name   = function.name
+
+      emue = [ emuFindEntry( function, i['formulae'], i['member'] ) for i in emu ]
+
+      remap = getattr(function,'regalRemap',None)
+      if all(i is None for i in emue) and (remap==None or isinstance(remap, str) or isinstance(remap, unicode)):
+        continue
+
+      category  = getattr(function, 'category', None)
+      version   = getattr(function, 'version', None)
+
+      if category:
+        category = category.replace('_DEPRECATED', '')
+      elif version:
+        category = version.replace('.', '_')
+        category = 'GL_VERSION_' + category
+
+      # Close prev category block.
+      if categoryPrev and not (category == categoryPrev):
+        code += '\n'
+
+      # Begin new category block.
+      if category and not (category == categoryPrev):
+        code += '  // %s\n\n' % category
+
+      categoryPrev = category
 
+      # ES 2.0 constraints and remapping apply regardless of the layers
+
+      if name in emuRouteAlways or isinstance(remap, dict):
+        code += '  tbl.%s = emu_%s;\n' % ( name, name )
+        continue
+
+      mask = [ emuRouteName(emu[i]) for i in range( len( emu ) - 1 ) if emue[i]!=None and ('prefix' in emue[i] or 'impl' in emue[i]) ]
+      if len(mask):
+        code += '  tbl.%s = layers&(%s) ? emu_%s : NULL;\n' % ( name, '|'.join(mask), name )
+      else:
+        code += '  tbl.%s = NULL;\n' % ( name )
+
+    if api.name in cond:
+      code += '#endif // %s\n' % cond[api.name]
+    code += '\n'
+
+  code += '}\n'
+  return code
+
+def emuRouteEnumCode():
+  code = ''
+  code += '// Emulation layers, for routing the emulation table\n'
+  code += '\n'
+  code += 'enum EmuRoute\n'
+  code += '{\n'
+  layers = [ i for i in emu if i['member'] ]
+  for i in range(len(layers)):
+    code += '  %s = 0x%05x%s\n' % (emuRouteName(layers[i]).ljust(16), 1<<i, ',' if i+1<len(layers) else '')
+  code += '};\n'
+  return code
+
+emuLocalCode = '''
 
+${EMU_ROUTE_ENUM}
 '''
 
 
@@ -371,6 +470,7 @@ def generateEmuSource(apis, args):
 
   funcDefine = apiEmuFuncDefineCode( apis, args )
   funcInit   = apiEmuDispatchFuncInitCode( apis, args )
+  funcRoute  = apiEmuDispatchRouteCode( apis, args )
 
   emuLocalInclude = '''
 
@@ -401,11 +501,11 @@ def generateEmuSource(apis, args):
   substitute['AUTOGENERATED']   = args.generated
   substitute['COPYRIGHT']       = args.copyright
   substitute['DISPATCH_NAME']   = 'Emu'
-  substitute['LOCAL_CODE']      = emuLocalCode
+  substitute['LOCAL_CODE']      = Template(emuLocalCode).substitute(EMU_ROUTE_ENUM=emuRouteEnumCode())
   substitute['LOCAL_INCLUDE']   = emuLocalInclude
   substitute['API_DISPATCH_FUNC_DEFINE'] = funcDefine
   substitute['API_DISPATCH_FUNC_INIT'] = funcInit
-  substitute['API_DISPATCH_GLOBAL_FUNC_INIT'] = ''
+  substitute['API_DISPATCH_GLOBAL_FUNC_INIT'] = funcRoute
   substitute['IFDEF'] = '#if REGAL_EMULATION\n\n'
   substitute['ENDIF'] = '#endif\n'
 
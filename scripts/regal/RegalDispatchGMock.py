@@ -141,30 +141,71 @@ functionCategoriesToMock = [
 
 
 explicitFunctionsToMock = frozenset([
+    'glActiveTexture',
     'glBindBuffer',
+    'glBindBufferRange',
+    'glBindProgramARB',
+    'glBindRenderbuffer',
     'glBindVertexArray',
     'glBindVertexBuffer',
+    'glBlendColor',
+    'glBlendEquationSeparatei',
+    'glBlendFuncSeparatei',
+    'glBufferData',
+    'glBufferSubData',
+    'glClampColor',
     'glClientActiveTexture',
     'glClientAttribDefaultEXT',
+    'glClientWaitSync',
+    'glColorMaski',
     'glColorPointer',
+    'glColorTableParameterfv',
+    'glConvolutionParameterfv',
+    'glConvolutionParameteri',
+    'glDeleteBuffers',
+    'glDeleteQueries',
+    'glDeleteSync',
+    'glDepthRangeArrayv',
     'glDisableClientState',
     'glDisableClientStateiEXT',
     'glDisableVertexAttribArray',
+    'glDisablei',
     'glEdgeFlagPointer',
     'glEnableClientState',
     'glEnableVertexAttribArray',
+    'glEnablei',
+    'glFenceSync',
     'glFogCoordPointer',
+    'glGenBuffers',
+    'glGenQueries',
+    'glGetFloati_v',
+    'glGetInteger64v',
+    'glGetIntegeri_v',
+    'glGetQueryObjectui64v',
+    'glGetQueryObjectuiv',
     'glIndexPointer',
+    'glMapBufferRange',
+    'glMinSampleShading',
     'glMultiTexCoordPointerEXT',
+    'glMultiTexEnviEXT',
     'glNormalPointer',
+    'glPointParameterf',
+    'glPointParameterfv',
+    'glPointParameteri',
     'glPrimitiveRestartIndex',
+    'glProvokingVertex',
+    'glQueryCounter',
+    'glSampleCoverage',
+    'glScissorIndexedv',
     'glSecondaryColorPointer',
+    'glUnmapBuffer',
     'glVertexAttribBinding',
     'glVertexAttribFormat',
     'glVertexAttribIFormat',
     'glVertexAttribLFormat',
     'glVertexBindingDivisor',
-    'glVertexPointer'])
+    'glVertexPointer',
+    'glViewportIndexedfv'])
 
 
 def generateGMockFunctionApi(apis):
@@ -48,11 +48,11 @@ namespace Loader
 
 ${LOCAL_CODE}
 
-  static DispatchTableGL &_getDispatchGL()
+  static DispatcherGL &_getDispatcherGL()
   {
     RegalContext * _context = REGAL_GET_CONTEXT();
     RegalAssert(_context);
-    return _context->dispatcher.driver;
+    return _context->dispatcher;
   }
 
   static void _getProcAddress(void (**func)(), void (*funcRegal)(), const char *name)
@@ -63,6 +63,12 @@ ${LOCAL_CODE}
       *func = NULL;
   }
 
+  static void _getProcAddress(DispatcherGL &dispatcher, void (**func)(), void (*funcRegal)(), const char *name)
+  {
+    _getProcAddress(func, funcRegal, name);
+    dispatcher.update(dispatcher.driver, func);
+  }
+
 ${API_DISPATCH_FUNC_DEFINE}
 
   void Init(DispatchTableGL &tbl)
@@ -124,11 +130,13 @@ def apiLoaderFuncDefineCode(apis, args):
       # Get a reference to the appropriate dispatch table and attempt GetProcAddress
 
       if function.needsContext:
-        code += '    DispatchTableGL &_driver = _getDispatchGL();\n'
+        code += '    DispatcherGL &_dispatcher = _getDispatcherGL();\n'
+        code += '    DispatchTableGL &_driver = _dispatcher.driver;\n'
+        code += '    _getProcAddress(_dispatcher,reinterpret_cast<void (**)()>(&_driver.%s),reinterpret_cast<void (*)()>(%s),"%s");\n'%(name,name,name)
       else:
         code += '    DispatchTableGlobal &_driver = dispatcherGlobal.driver;\n'
+        code += '    _getProcAddress(reinterpret_cast<void (**)()>(&_driver.%s),reinterpret_cast<void (*)()>(%s),"%s");\n'%(name,name,name)
 
-      code += '    _getProcAddress(reinterpret_cast<void (**)()>(&_driver.%s),reinterpret_cast<void (*)()>(%s),"%s");\n'%(name,name,name)
       code += '    '
       if not typeIsVoid(rType):
         code += 'return '
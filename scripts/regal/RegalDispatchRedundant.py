@@ -0,0 +1,199 @@
+#!/usr/bin/python -B
+
+import re
+
+from string import Template, upper, replace
+
+from ApiCodeGen   import *
+from ApiUtil      import outputCode
+from ApiUtil      import typeIsVoid
+
+# CodeGen for the redundant state change filtering dispatch layer.
+#
+# Each formula applies to the entry points matching one of its
+# 'entries' regular expressions:
+#
+#   filter      Redundant method returning true when the call would not
+#               change the state last sent downstream.  The call is then
+#               dropped, and counted as redundant_<statistics>, by
+#               default the entry point itself.
+#   vao         The filter is bypassed while Vao emulation is active.
+#   invalidate  Redundant method called before passing the call on, for
+#               calls changing tracked state in ways not followed.
+
+redundantFormulae = [
+  { 'entries' : [ 'glEnable' ],                       'filter' : 'enable(cap,GL_TRUE)' },
+  { 'entries' : [ 'glDisable' ],                      'filter' : 'enable(cap,GL_FALSE)' },
+  { 'entries' : [ 'glActiveTexture(ARB|)' ],          'filter' : 'activeTexture(texture)',                           'statistics' : 'glActiveTexture' },
+  { 'entries' : [ 'glBindTexture(EXT|)' ],            'filter' : 'bindTexture(target,texture)',                      'statistics' : 'glBindTexture' },
+  { 'entries' : [ 'glUseProgram' ],                   'filter' : 'useProgram(program)' },
+  { 'entries' : [ 'glBindBuffer(ARB|)' ],             'filter' : 'bindBuffer(target,buffer)',                        'statistics' : 'glBindBuffer', 'vao' : True },
+  { 'entries' : [ 'glBindFramebuffer(EXT|)' ],        'filter' : 'bindFramebuffer(target,framebuffer)',              'statistics' : 'glBindFramebuffer' },
+  { 'entries' : [ 'glBindVertexArray' ],              'filter' : 'bindVertexArray(array)',                           'vao' : True },
+  { 'entries' : [ 'glDepthFunc' ],                    'filter' : 'depthFunc(func)' },
+  { 'entries' : [ 'glDepthMask' ],                    'filter' : 'depthMask(flag)' },
+  { 'entries' : [ 'glBlendFunc' ],                    'filter' : 'blendFunc(sfactor,dfactor,sfactor,dfactor)' },
+  { 'entries' : [ 'glBlendFuncSeparate(EXT|)' ],      'filter' : 'blendFunc(sfactorRGB,dfactorRGB,sfactorAlpha,dfactorAlpha)', 'statistics' : 'glBlendFuncSeparate' },
+  { 'entries' : [ 'glBlendEquation(EXT|)' ],          'filter' : 'blendEquation(mode,mode)',                         'statistics' : 'glBlendEquation' },
+  { 'entries' : [ 'glCullFace' ],                     'filter' : 'cullFace(mode)' },
+  { 'entries' : [ 'glFrontFace' ],                    'filter' : 'frontFace(mode)' },
+  { 'entries' : [ 'glColorMask' ],                    'filter' : 'colorMask(red,green,blue,alpha)' },
+  { 'entries' : [ 'glViewport' ],                     'filter' : 'viewport(x,y,width,height)' },
+  { 'entries' : [ 'glScissor' ],                      'filter' : 'scissor(x,y,width,height)' },
+  { 'entries' : [ 'glClearColor' ],                   'filter' : 'clearColor(red,green,blue,alpha)' },
+
+  # Display lists are compiled with the state as recorded, and
+  # executing one or popping attributes leaves it unknown
+
+  { 'entries' : [ 'glNewList' ],                      'invalidate' : 'newList()' },
+  { 'entries' : [ 'glEndList' ],                      'invalidate' : 'endList()' },
+  { 'entries' : [ 'glCallLists?', 'glPop(Client|)Attrib' ], 'invalidate' : 'reset()' },
+
+  # Indexed, multi-bind and deleting variants of tracked state
+
+  { 'entries' : [ 'gl(Enable|Disable)(i|IndexedEXT)' ],                                   'invalidate' : 'invalidateEnable(target)' },
+  { 'entries' : [ 'glDeleteTextures', 'glBindTextures', 'glBindTextureUnit', 'glBindMultiTextureEXT' ], 'invalidate' : 'invalidateTextures()' },
+  { 'entries' : [ 'glDeleteProgram', 'glUseProgramObjectARB', 'glDeleteObjectARB' ],     'invalidate' : 'invalidateProgram()' },
+  { 'entries' : [ 'glDeleteBuffers(ARB|)' ],                                              'invalidate' : 'invalidateBuffers()' },
+  { 'entries' : [ 'glBindBuffer(s|)(Base|Range)' ],                                       'invalidate' : 'invalidateBuffer(target)' },
+  { 'entries' : [ 'glBindTransformFeedback' ],                                            'invalidate' : 'invalidateBuffer(GL_TRANSFORM_FEEDBACK_BUFFER)' },
+  { 'entries' : [ 'glDeleteVertexArrays', 'glBindVertexArrayAPPLE', 'glDeleteVertexArraysAPPLE' ], 'invalidate' : 'invalidateVertexArray()' },
+  { 'entries' : [ 'glDeleteFramebuffers(EXT|)' ],                                         'invalidate' : 'invalidateFramebuffers()' },
+  { 'entries' : [ 'glBlendFunc(Separate|)i', 'glBlendEquationi', 'glBlendEquationSeparate(EXT|i|)' ], 'invalidate' : 'invalidateBlend()' },
+  { 'entries' : [ 'glColorMask(i|IndexedEXT)' ],                                          'invalidate' : 'invalidateColorMask()' },
+  { 'entries' : [ 'glViewport(Indexedf|Indexedfv|Arrayv)' ],                              'invalidate' : 'invalidateViewport()' },
+  { 'entries' : [ 'glScissor(Indexed|Indexedv|Arrayv)' ],                                 'invalidate' : 'invalidateScissor()' },
+]
+
+# Counters in Statistics, redundant_<name>
+
+def redundantStatistics():
+  names = set()
+  for i in redundantFormulae:
+    if 'filter' in i:
+      for j in i['entries']:
+        names.add(i.get('statistics', j))
+  return sorted(names)
+
+# Entry points and their formula, in formula order
+
+def redundantFunctions(apis):
+  functions = []
+  for formula in redundantFormulae:
+    entries = [ re.compile('^%s$' % i) for i in formula['entries'] ]
+    for api in apis:
+      if api.name!='gl':
+        continue
+      for function in api.functions:
+        if getattr(function,'regalOnly',False)==True or not function.needsContext:
+          continue
+        for i in entries:
+          if i.match(function.name):
+            functions.append((function, formula))
+            break
+  return functions
+
+dispatchRedundantTemplate = Template('''${AUTOGENERATED}
+${LICENSE}
+
+#include "pch.h" /* For MS precompiled header support */
+
+#include "RegalUtil.h"
+
+#if REGAL_REDUNDANT
+
+REGAL_GLOBAL_BEGIN
+
+#include "RegalConfig.h"
+#include "RegalThread.h"
+#include "RegalContext.h"
+#include "RegalDispatcher.h"
+#include "RegalRedundant.h"
+#include "RegalStatistics.h"
+
+REGAL_GLOBAL_END
+
+REGAL_NAMESPACE_BEGIN
+
+// Calls that would not change the state last sent downstream are
+// dropped, and counted per entry point in Statistics.
+
+${API_FUNC_DEFINE}
+void InitDispatchTableRedundant(DispatchTableGL &tbl)
+{
+${API_GL_DISPATCH_INIT}
+}
+
+REGAL_NAMESPACE_END
+
+#endif // REGAL_REDUNDANT
+''')
+
+def generateDispatchRedundant(apis, args):
+
+  code = ''
+  init = ''
+
+  functions = redundantFunctions(apis)
+  width = max([ len(function.name) for function, formula in functions ])
+
+  invalidating = False
+  for function, formula in functions:
+
+    if 'filter' not in formula and not invalidating:
+      code += '// Calls which change shadowed state in ways not followed\n'
+      code += '// by the filters above\n\n'
+      invalidating = True
+
+    name       = function.name
+    params     = paramsDefaultCode(function.parameters, True)
+    callParams = paramsNameCode(function.parameters)
+    rType      = typeCode(function.ret.type)
+
+    code += 'static %sREGAL_CALL redundant_%s(%s)\n{\n' % (rType, name, params)
+    code += '  RegalContext *_context = REGAL_GET_CONTEXT();\n'
+    code += '  RegalAssert(_context);\n'
+    code += '  DispatchTableGL *_next = _context->dispatcher.redundant.next();\n'
+    code += '  RegalAssert(_next);\n'
+    code += '  Redundant *_redundant = _context->redundant;\n'
+    code += '  RegalAssert(_redundant);\n'
+
+    if 'filter' in formula:
+      if formula.get('vao', False):
+        code += '  #if REGAL_EMULATION\n'
+        code += '  // Vao emulation binds buffers behind our back\n'
+        code += '  if (!_context->vao && _redundant->%s)\n' % formula['filter']
+        code += '  #else\n'
+        code += '  if (_redundant->%s)\n' % formula['filter']
+        code += '  #endif\n'
+      else:
+        code += '  if (_redundant->%s)\n' % formula['filter']
+      code += '  {\n'
+      code += '    #if REGAL_STATISTICS\n'
+      code += '    if (_context->statistics)\n'
+      code += '      _context->statistics->redundant_%s++;\n' % formula.get('statistics', name)
+      code += '    #endif\n'
+      code += '    return;\n'
+      code += '  }\n'
+
+    if 'invalidate' in formula:
+      code += '  _redundant->%s;\n' % formula['invalidate']
+
+    code += '  '
+    if not typeIsVoid(rType):
+      code += 'return '
+    code += '_next->call(&_next->%s)(%s);\n' % (name, callParams)
+    code += '}\n\n'
+
+    init += '  tbl.%s = redundant_%s;\n' % (name.ljust(width), name)
+
+  # Output
+
+  substitute = {}
+  substitute['LICENSE']              = args.license
+  substitute['AUTOGENERATED']        = args.generated
+  substitute['COPYRIGHT']            = args.copyright
+  substitute['API_FUNC_DEFINE']      = code
+  substitute['API_GL_DISPATCH_INIT'] = init.rstrip('\n')
+
+  outputCode( '%s/RegalDispatchRedundant.cpp' % args.srcdir, dispatchRedundantTemplate.substitute(substitute))
@@ -107,6 +107,7 @@ def apiStatisticsFuncDefineCode(apis, args):
       else:
         code += '  DispatchTableGlobal *_next = dispatcherGlobal.statistics.next();\n'
       code += '  RegalAssert(_next);\n'
+      code += '  CallTiming::DriverCall _timing(statistics.timing,offsetof(Dispatch::GL,%s)/sizeof(void *));\n'%(name)
 
       code += '  '
       if not typeIsVoid(rType):
@@ -126,10 +127,80 @@ def apiStatisticsFuncDefineCode(apis, args):
 
   return code
 
+# Per-call timing, from the front of the dispatch stack
+
+def apiTimingFuncDefineCode(apis, args):
+  categoryPrev = None
+  code = ''
+
+  for api in apis:
+
+    code += '\n'
+    if api.name in cond:
+      code += '#if %s\n' % cond[api.name]
+
+    for function in api.functions:
+
+      if getattr(function,'regalOnly',False)==True:
+        continue
+
+      if not function.needsContext:
+        continue
+
+      name   = function.name
+      params = paramsDefaultCode(function.parameters, True)
+      callParams = paramsNameCode(function.parameters)
+      rType  = typeCode(function.ret.type)
+      category  = getattr(function, 'category', None)
+      version   = getattr(function, 'version', None)
+
+      if category:
+        category = category.replace('_DEPRECATED', '')
+      elif version:
+        category = version.replace('.', '_')
+        category = 'GL_VERSION_' + category
+
+      # Close prev category block.
+      if categoryPrev and not (category == categoryPrev):
+        code += '\n'
+
+      # Begin new category block.
+      if category and not (category == categoryPrev):
+        code += '// %s\n\n' % category
+
+      categoryPrev = category
+
+      code += 'static %sREGAL_CALL %s%s(%s) \n{\n' % (rType, 'timing_', name, params)
+      code += '  RegalContext *_context = REGAL_GET_CONTEXT();\n'
+      code += '  RegalAssert(_context);\n'
+      code += '\n'
+      code += '  RegalAssert(_context->statistics);\n'
+      code += '  CallTiming::Call _timing(_context->statistics->timing,offsetof(Dispatch::GL,%s)/sizeof(void *));\n'%(name)
+      code += '\n'
+      code += '  DispatchTableGL *_next = _context->dispatcher.timing.next();\n'
+      code += '  RegalAssert(_next);\n'
+      code += '  '
+      if not typeIsVoid(rType):
+        code += 'return '
+      code += '_next->call(&_next->%s)(%s);\n' % ( name, callParams )
+      code += '}\n\n'
+
+    if api.name in cond:
+      code += '#endif // %s\n' % cond[api.name]
+    code += '\n'
+
+  # Close pending if block.
+  if categoryPrev:
+    code += '\n'
+
+  return code
+
 def generateDispatchStatistics(apis, args):
 
   funcDefine     = apiStatisticsFuncDefineCode( apis, args )
+  funcDefine    += apiTimingFuncDefineCode( apis, args )
   funcInit       = apiDispatchFuncInitCode( apis, args, 'statistics' )
+  timingInit     = apiDispatchFuncInitCode( apis, args, 'timing' )
 
   # Output
 
@@ -139,11 +210,11 @@ def generateDispatchStatistics(apis, args):
   substitute['AUTOGENERATED']   = args.generated
   substitute['COPYRIGHT']       = args.copyright
   substitute['DISPATCH_NAME']   = 'Statistics'
-  substitute['LOCAL_INCLUDE']   = '#include "RegalStatistics.h"'
+  substitute['LOCAL_INCLUDE']   = '#include "RegalStatistics.h"\n#include "RegalCallTiming.h"'
   substitute['LOCAL_CODE']      = ''
   substitute['API_DISPATCH_FUNC_DEFINE']      = funcDefine
   substitute['API_DISPATCH_FUNC_INIT']        = funcInit
-  substitute['API_DISPATCH_GLOBAL_FUNC_INIT'] = ''
+  substitute['API_DISPATCH_GLOBAL_FUNC_INIT'] = 'void InitDispatchTableTiming(DispatchTableGL &tbl)\n{\n  %s\n}\n' % timingInit
   substitute['IFDEF'] = '#if REGAL_STATISTICS\n\n'
   substitute['ENDIF'] = '#endif\n'
 
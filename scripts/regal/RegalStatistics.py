@@ -6,12 +6,15 @@
 # Per function and extension statistics gathering
 #
 
+import re
+
 from string import Template, upper, replace
 
 from ApiUtil    import outputCode
 from ApiCodeGen import *
 
 from RegalContextInfo import cond
+from RegalDispatchRedundant import redundantStatistics
 
 statisticsHeaderTemplate = Template( '''${AUTOGENERATED}
 ${LICENSE}
@@ -31,6 +34,10 @@ REGAL_GLOBAL_END
 
 REGAL_NAMESPACE_BEGIN
 
+namespace Json { struct Output; }
+
+struct CallTiming;
+
 struct Statistics
 {
   Statistics();
@@ -38,11 +45,22 @@ struct Statistics
 
   void reset();
   void log() const;
+  void writeJSON(Json::Output &jo) const;
 
   static inline void log(const char *name, const GLuint count);
 
+  CallTiming *timing;     // Per-call timing, if enabled
+
 ${DECLARATIONS}
 
+  // Emulation counters
+
+${EMU_DECLARATIONS}
+
+  // Redundant state changes filtered per entry point
+
+${REDUNDANT_DECLARATIONS}
+
   bool dummy;
 };
 
@@ -69,10 +87,13 @@ REGAL_GLOBAL_BEGIN
 
 #include <boost/print/interface.hpp>
 #include <boost/print/string_list.hpp>
+#include <boost/print/json.hpp>
 using namespace boost::print;
 
 #include "RegalToken.h"
+#include "RegalConfig.h"
 #include "RegalContext.h"
+#include "RegalCallTiming.h"
 
 REGAL_GLOBAL_END
 
@@ -81,27 +102,64 @@ REGAL_NAMESPACE_BEGIN
 using namespace ::REGAL_NAMESPACE_INTERNAL::Logging;
 using namespace ::REGAL_NAMESPACE_INTERNAL::Token;
 
+namespace Json { struct Output : public ::boost::print::json::output<std::string> {}; }
+
 Statistics::Statistics()
 {
    Internal("Statistics::Statistics","()");
+   timing = NULL;
    reset();
+   if (Config::dispatchTiming)
+     timing = new CallTiming();
 }
 
 Statistics::~Statistics()
 {
    Internal("Statistics::~Statistics","()");
+   delete timing;
 }
 
+// Timing is kept, it is reset per frame instead
+
 void
 Statistics::reset()
 {
+  CallTiming *tmp = timing;
   ::memset(this,0,sizeof(Statistics));
+  timing = tmp;
 }
 
 void
 Statistics::log() const
 {
 ${LOG}
+${EMU_LOG}
+${REDUNDANT_LOG}
+}
+
+#if !REGAL_NO_JSON
+static inline void
+jsonCount(Json::Output &jo, const char *name, const GLuint count)
+{
+  if (count)
+    jo.member(name,count);
+}
+#endif
+
+void
+Statistics::writeJSON(Json::Output &jo) const
+{
+#if !REGAL_NO_JSON
+  jo.object("statistics");
+${JSON}
+${EMU_JSON}
+${REDUNDANT_JSON}
+  if (timing)
+    timing->writeJSON(jo);
+  jo.end();
+#else
+  UNUSED_PARAMETER(jo);
+#endif
 }
 
 void
@@ -117,6 +175,49 @@ REGAL_NAMESPACE_END
 
 ''')
 
+# Counters maintained by the emulation layers, rather than
+# the per-function and per-extension counts
+
+emuCounters = [
+  ( 'iff_program_cache_hit',    'IFF_PROGRAM_CACHE_HIT'    ),
+  ( 'iff_program_cache_miss',   'IFF_PROGRAM_CACHE_MISS'   ),
+  ( 'iff_program_cache_evict',  'IFF_PROGRAM_CACHE_EVICT'  ),
+  ( 'iff_program_binary_hit',   'IFF_PROGRAM_BINARY_HIT'   ),
+  ( 'iff_program_binary_miss',  'IFF_PROGRAM_BINARY_MISS'  ),
+  ( 'iff_program_binary_write', 'IFF_PROGRAM_BINARY_WRITE' ),
+  ( 'iff_program_async_compile','IFF_PROGRAM_ASYNC_COMPILE'),
+  ( 'iff_program_uber_draw',    'IFF_PROGRAM_UBER_DRAW'    ),
+  ( 'iff_draw',                 'IFF_DRAW'                 ),
+  ( 'iff_uniform_call',         'IFF_UNIFORM_CALL'         ),
+  ( 'iff_uniform_block_upload', 'IFF_UNIFORM_BLOCK_UPLOAD' ),
+  ( 'iff_uniform_block_bind',   'IFF_UNIFORM_BLOCK_BIND'   ),
+  ( 'iff_immediate_flush',      'IFF_IMMEDIATE_FLUSH'      ),
+  ( 'iff_immediate_relayout',   'IFF_IMMEDIATE_RELAYOUT'   ),
+  ( 'iff_immediate_batch',      'IFF_IMMEDIATE_BATCH'      ),
+  ( 'vao_upload_cache_hit',     'VAO_UPLOAD_CACHE_HIT'     ),
+  ( 'vao_upload_cache_miss',    'VAO_UPLOAD_CACHE_MISS'    ),
+]
+
+# Entry points filtered by the redundant state change layer,
+# counted as redundant_<name>
+
+redundantFunctions = redundantStatistics()
+
+def redundantDeclareCode():
+  return ''.join([ '  GLuint redundant_%s;\n'%(i) for i in redundantFunctions ])
+
+def redundantLogCode():
+  return ''.join([ '  log("redundant_%s",redundant_%s);\n'%(i,i) for i in redundantFunctions ])
+
+def emuDeclareCode():
+  return ''.join([ '  GLuint %s;\n'%(i[0]) for i in emuCounters ])
+
+def emuLogCode():
+  return ''.join([ '  log("%s",%s);\n'%(i[1],i[0]) for i in emuCounters ])
+
+def logToJson(code):
+  return re.sub(r'^(\s*)log\(', r'\1jsonCount(jo,', code, flags=re.M)
+
 def versionDeclareCode(apis, args):
 
   code = ''
@@ -266,6 +367,8 @@ def generateStatisticsHeader(apis, args):
     substitute['COPYRIGHT']     = args.copyright
     substitute['HEADER_NAME']   = "REGAL_STATISTICS"
     substitute['DECLARATIONS']  = versionDeclareCode(apis,args)
+    substitute['EMU_DECLARATIONS'] = emuDeclareCode()
+    substitute['REDUNDANT_DECLARATIONS'] = redundantDeclareCode()
     outputCode( '%s/RegalStatistics.h' % args.srcdir, statisticsHeaderTemplate.substitute(substitute))
 
 def generateStatisticsSource(apis, args):
@@ -275,4 +378,9 @@ def generateStatisticsSource(apis, args):
     substitute['AUTOGENERATED']  = args.generated
     substitute['COPYRIGHT']      = args.copyright
     substitute['LOG']   = versionLogCode(apis,args)
+    substitute['JSON']  = logToJson(substitute['LOG'])
+    substitute['EMU_LOG']  = emuLogCode()
+    substitute['EMU_JSON'] = logToJson(substitute['EMU_LOG'])
+    substitute['REDUNDANT_LOG']  = redundantLogCode()
+    substitute['REDUNDANT_JSON'] = logToJson(substitute['REDUNDANT_LOG'])
     outputCode( '%s/RegalStatistics.cpp' % args.srcdir, statisticsSourceTemplate.substitute(substitute))
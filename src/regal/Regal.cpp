@@ -4238,6 +4238,12 @@ extern "C" {
     if (!_context) return;
     DispatchTableGL *_next = &_context->dispatcher.front();
     RegalAssert(_next);
+    if (REGAL_CACHE && REGAL_CACHE_TEXTURE)
+    {
+      const bool unpackState = _context->info && (!_context->info->es2 || _context->info->gles_version_major>=3);
+      Cache::texImage2D(_next->call(&_next->glTexImage2D),_next->call(&_next->glGetIntegerv),_next->call(&_next->glPixelStorei), unpackState, target, level, internalformat, width, height, border, format, type, pixels);
+      return;
+    }
     _next->call(&_next->glTexImage2D)(target, level, internalformat, width, height, border, format, type, pixels);
   }
 
@@ -4716,11 +4722,6 @@ extern "C" {
     if (!_context) return;
     DispatchTableGL *_next = &_context->dispatcher.front();
     RegalAssert(_next);
-    if (REGAL_CACHE && REGAL_CACHE_TEXTURE)
-    {
-      Cache::bindTexture(_next->call(&_next->glBindTexture),_next->call(&_next->glGetTexLevelParameteriv),_next->call(&_next->glGetTexImage), target, texture);
-      return;
-    }
     _next->call(&_next->glBindTexture)(target, texture);
   }
 
@@ -41899,8 +41900,13 @@ extern "C" {
     DispatchTableGlobal *_next = &dispatcherGlobal.front();
     RegalAssert(_next);
     BOOL ret = 0;
-    #if REGAL_FRAME
     RegalContext *_context = REGAL_GET_CONTEXT();
+    #if REGAL_EMULATION && REGAL_EMU_IFF
+    // Draw any batched glBegin/glEnd blocks ahead of the swap.
+    if (_context && _context->iff)
+        _context->iff->SwapBuffers(_context);
+    #endif
+    #if REGAL_FRAME
     // Notify Regal::Frame about the swap buffers event.
     if (_context && _context->frame)
         _context->frame->wglSwapBuffers(*_context);
@@ -44365,6 +44371,11 @@ extern "C" {
         #endif
         _context->x11Drawable = drawable;
     }
+    #if REGAL_EMULATION && REGAL_EMU_IFF
+    // Draw any batched glBegin/glEnd blocks ahead of the swap.
+    if (_context && _context->iff)
+        _context->iff->SwapBuffers(_context);
+    #endif
     #if REGAL_FRAME
     // Notify Regal::Frame about the swap buffers event.
     if (_context && _context->frame)
@@ -47232,8 +47243,13 @@ extern "C" {
     DispatchTableGlobal *_next = &dispatcherGlobal.front();
     RegalAssert(_next);
     CGLError ret = (CGLError) 0;
-    #if REGAL_FRAME
     RegalContext *_context = REGAL_GET_CONTEXT();
+    #if REGAL_EMULATION && REGAL_EMU_IFF
+    // Draw any batched glBegin/glEnd blocks ahead of the swap.
+    if (_context && _context->iff)
+        _context->iff->SwapBuffers(_context);
+    #endif
+    #if REGAL_FRAME
     // Notify Regal::Frame about the flush drawable event.
     if (_context && _context->frame)
         _context->frame->CGLFlushDrawable(*_context);
@@ -49265,8 +49281,13 @@ extern "C" {
     DispatchTableGlobal *_next = &dispatcherGlobal.front();
     RegalAssert(_next);
     EGLBoolean ret = 0;
-    #if REGAL_FRAME
     RegalContext *_context = REGAL_GET_CONTEXT();
+    #if REGAL_EMULATION && REGAL_EMU_IFF
+    // Draw any batched glBegin/glEnd blocks ahead of the swap.
+    if (_context && _context->iff)
+        _context->iff->SwapBuffers(_context);
+    #endif
+    #if REGAL_FRAME
     // Notify Regal::Frame about the swap buffers event.
     if (_context && _context->frame)
         _context->frame->eglSwapBuffers(*_context);
@@ -162,12 +162,23 @@ struct BaseVertex : public ClientState::VertexArray
       dt.call(&dt.glBindBuffer)(GL_ARRAY_BUFFER, ClientState::VertexArray::arrayBufferBinding);
   }
 
+  // Adjusted client-side indices are written to a scratch buffer that
+  // is kept between draws, grown as needed but never shrunk.
+
+  std::vector<GLuint> scratch;
+
   template<typename T>
   GLvoid* adjust_indices(GLsizei count, const GLvoid *indices, GLint basevertex)
   {
-      T* ptr = (T*)malloc(count * sizeof(T));
-      if(!ptr) return 0;
-      for(GLsizei i = 0; i < count; i++) ptr[i] = ((T*)indices)[i] + (T) basevertex;
+      if (count <= 0)
+          return 0;
+      const size_t words = (size_t(count) * sizeof(T) + sizeof(GLuint) - 1) / sizeof(GLuint);
+      if (scratch.size() < words)
+          scratch.resize(words);
+      T* ptr = reinterpret_cast<T*>(&scratch[0]);
+      const T* src = static_cast<const T*>(indices);
+      const T bv = static_cast<T>(basevertex);
+      for(GLsizei i = 0; i < count; i++) ptr[i] = src[i] + bv;
       return (GLvoid*) ptr;
   }
 
@@ -214,13 +225,8 @@ struct BaseVertex : public ClientState::VertexArray
     else
         dt.call(&dt.glDrawElements)(mode, count, type, indices);
 
-    if (basevertex)
-    {
-        if (ClientState::VertexArray::elementArrayBufferBinding)
-            adjust(ctx, dt, 0);
-        else
-            free(adjusted_indices);
-    }
+    if (basevertex && ClientState::VertexArray::elementArrayBufferBinding)
+        adjust(ctx, dt, 0);
     return true;
   }
 
@@ -251,13 +257,8 @@ struct BaseVertex : public ClientState::VertexArray
     else
         dt.call(&dt.glDrawRangeElements)(mode, start, end, count, type, indices);
 
-    if (basevertex)
-    {
-        if (ClientState::VertexArray::elementArrayBufferBinding)
-            adjust(ctx, dt, 0);
-        else
-            free(adjusted_indices);
-    }
+    if (basevertex && ClientState::VertexArray::elementArrayBufferBinding)
+        adjust(ctx, dt, 0);
     return true;
   }
 
@@ -288,13 +289,8 @@ struct BaseVertex : public ClientState::VertexArray
     else
         dt.call(&dt.glDrawElementsInstanced)(mode, count, type, indices, primcount);
 
-    if (basevertex)
-    {
-        if (ClientState::VertexArray::elementArrayBufferBinding)
-            adjust(ctx, dt, 0);
-        else
-            free(adjusted_indices);
-    }
+    if (basevertex && ClientState::VertexArray::elementArrayBufferBinding)
+        adjust(ctx, dt, 0);
     return true;
   }
 
@@ -325,13 +321,8 @@ struct BaseVertex : public ClientState::VertexArray
     else
         dt.call(&dt.glDrawElementsInstancedBaseInstance)(mode, count, type, indices, primcount, baseinstance);
 
-    if (basevertex)
-    {
-        if (ClientState::VertexArray::elementArrayBufferBinding)
-            adjust(ctx, dt, 0);
-        else
-            free(adjusted_indices);
-    }
+    if (basevertex && ClientState::VertexArray::elementArrayBufferBinding)
+        adjust(ctx, dt, 0);
     return true;
   }
 
@@ -364,13 +355,8 @@ struct BaseVertex : public ClientState::VertexArray
       else
           dt.call(&dt.glDrawElements)(mode, count[ii], type, indices[ii]);
 
-      if (basevertex[ii])
-      {
-          if (ClientState::VertexArray::elementArrayBufferBinding)
-              adjust(ctx, dt, 0);
-          else
-              free(adjusted_indices);
-      }
+      if (basevertex[ii] && ClientState::VertexArray::elementArrayBufferBinding)
+          adjust(ctx, dt, 0);
     }
     return true;
   }
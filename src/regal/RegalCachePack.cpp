@@ -0,0 +1,582 @@
+/*
+  Copyright (c) 2011-2013 NVIDIA Corporation
+  Copyright (c) 2011-2013 Cass Everitt
+  Copyright (c) 2012-2013 Scott Nations
+  Copyright (c) 2012-2013 Nigel Stewart
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+    Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+  IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+  OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+  OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+  Intended formatting conventions:
+  $ astyle --style=allman --indent=spaces=2 --indent-switches
+*/
+
+#include "pch.h" /* For MS precompiled header support */
+
+#include "RegalUtil.h"
+
+REGAL_GLOBAL_BEGIN
+
+#include <cerrno>
+#include <cstring>
+#include <algorithm>
+
+#include <lookup3.h>
+
+#if !REGAL_NO_SNAPPY
+#include <snappy.h>
+#endif
+
+#if REGAL_SYS_WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "RegalLog.h"
+#include "RegalCachePack.h"
+
+REGAL_GLOBAL_END
+
+REGAL_NAMESPACE_BEGIN
+
+using ::std::string;
+using ::std::vector;
+using ::std::map;
+
+namespace Cache {
+
+namespace
+{
+  const GLuint version     = 1;
+  const GLuint recordMagic = 0x52504b52;  // RKPR
+
+  inline bool lessHash(const Pack::Entry &entry, const GLuint64 hash) { return entry.hash<hash; }
+
+  // Records are kept 8-byte aligned
+
+  inline GLuint64 pad(const GLuint64 size) { return (size+7)&~GLuint64(7); }
+
+  bool writeBlock(FILE *f, const void *data, const std::size_t size)
+  {
+    return !size || fwrite(data,size,1,f)==1;
+  }
+
+  // The pack is shared by every process using the cache directory.
+  // Appends take an exclusive lock, find the end of the file and
+  // write the whole record at once, so the offset is where it lands.
+
+#if REGAL_SYS_WIN32
+  typedef HANDLE File;
+  const File noFile = INVALID_HANDLE_VALUE;
+
+  File openAppend(const string &filename)
+  {
+    return CreateFileA(filename.c_str(), GENERIC_READ|FILE_APPEND_DATA, FILE_SHARE_READ|FILE_SHARE_WRITE|FILE_SHARE_DELETE,
+                       NULL, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+  }
+
+  void closeFile(File file) { CloseHandle(file); }
+
+  bool lockFile(File file, const bool lock)
+  {
+    OVERLAPPED o;
+    memset(&o,0,sizeof(o));
+    return lock ? LockFileEx(file, LOCKFILE_EXCLUSIVE_LOCK, 0, MAXDWORD, MAXDWORD, &o)!=0
+                : UnlockFileEx(file, 0, MAXDWORD, MAXDWORD, &o)!=0;
+  }
+
+  bool fileSize(File file, GLuint64 &size)
+  {
+    LARGE_INTEGER tmp;
+    if (!GetFileSizeEx(file, &tmp))
+      return false;
+    size = GLuint64(tmp.QuadPart);
+    return true;
+  }
+
+  bool writeAppend(File file, const string &data)
+  {
+    DWORD written = 0;
+    return WriteFile(file, data.data(), DWORD(data.size()), &written, NULL) && written==data.size();
+  }
+
+  bool readAt(File file, const GLuint64 offset, void *data, const std::size_t size)
+  {
+    OVERLAPPED o;
+    memset(&o,0,sizeof(o));
+    o.Offset     = DWORD(offset);
+    o.OffsetHigh = DWORD(offset>>32);
+    DWORD read = 0;
+    return ReadFile(file, data, DWORD(size), &read, &o) && read==size;
+  }
+#else
+  typedef int File;
+  const File noFile = -1;
+
+  File openAppend(const string &filename)
+  {
+    return ::open(filename.c_str(), O_RDWR|O_CREAT|O_APPEND, 0644);
+  }
+
+  void closeFile(File file) { ::close(file); }
+
+  bool lockFile(File file, const bool lock)
+  {
+    int ret;
+    while ((ret = flock(file, lock ? LOCK_EX : LOCK_UN))<0 && errno==EINTR) {}
+    return !ret;
+  }
+
+  bool fileSize(File file, GLuint64 &size)
+  {
+    struct stat st;
+    if (fstat(file, &st))
+      return false;
+    size = GLuint64(st.st_size);
+    return true;
+  }
+
+  bool writeAppend(File file, const string &data)
+  {
+    ssize_t ret;
+    while ((ret = ::write(file, data.data(), data.size()))<0 && errno==EINTR) {}
+    return ret==ssize_t(data.size());
+  }
+
+  bool readAt(File file, const GLuint64 offset, void *data, const std::size_t size)
+  {
+    ssize_t ret;
+    while ((ret = pread(file, data, size, off_t(offset)))<0 && errno==EINTR) {}
+    return ret==ssize_t(size);
+  }
+#endif
+
+  // Blob as stored, snappy compressed only if that is smaller
+
+  GLuint encode(const void *data, const std::size_t size, const bool compress, string &stored)
+  {
+#if !REGAL_NO_SNAPPY
+    if (compress)
+    {
+      snappy::Compress(static_cast<const char *>(data),size,&stored);
+      if (stored.size()<size)
+        return Pack::PACK_SNAPPY;
+    }
+#else
+    UNUSED_PARAMETER(compress);
+#endif
+    stored.assign(static_cast<const char *>(data),size);
+    return 0;
+  }
+}
+
+Pack::Pack()
+: _valid(false),
+  _appendable(true),
+  _base(NULL),
+  _size(0),
+  _index(NULL),
+  _count(0),
+  _file(noFile)
+#if REGAL_SYS_WIN32
+  , _mapping(NULL)
+#endif
+{
+}
+
+Pack::~Pack()
+{
+  close();
+}
+
+bool
+Pack::open(const string &filename)
+{
+  Thread::ScopedLock lock(&_mutex);
+
+  RegalAssert(!_valid);
+  _filename = filename;
+
+  // Map the whole file once
+
+#if REGAL_SYS_WIN32
+  HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (file==INVALID_HANDLE_VALUE)
+  {
+    _valid = true;
+    return true;
+  }
+  LARGE_INTEGER size;
+  if (GetFileSizeEx(file, &size) && size.QuadPart)
+  {
+    _size    = GLuint64(size.QuadPart);
+    _mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (_mapping)
+      _base = static_cast<const char *>(MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0));
+  }
+  CloseHandle(file);
+#else
+  const int file = ::open(filename.c_str(), O_RDONLY);
+  if (file<0)
+  {
+    _valid = true;
+    return true;
+  }
+  struct stat st;
+  if (!fstat(file, &st) && st.st_size)
+  {
+    _size = GLuint64(st.st_size);
+    void *tmp = mmap(NULL, std::size_t(_size), PROT_READ, MAP_SHARED, file, 0);
+    _base = tmp==MAP_FAILED ? NULL : static_cast<const char *>(tmp);
+  }
+  ::close(file);
+#endif
+
+  if (!_size)
+  {
+    _valid = true;
+    return true;
+  }
+
+  const Header *h = reinterpret_cast<const Header *>(_base);
+  if (!_base || _size<sizeof(Header) || memcmp(h->magic,"REGALPAK",8) || h->version!=version ||
+      h->end>_size || sizeof(Header)+GLuint64(h->count)*sizeof(Entry)>h->end)
+  {
+    Warning("Pack ",filename," could not be read.");
+    unmap();
+    return false;
+  }
+
+  _index = reinterpret_cast<const Entry *>(h+1);
+  _count = h->count;
+
+  // Gather appended records.  Anything unreadable at the end would
+  // hide records appended after it, so the pack is then read-only
+  // until compacted.
+
+  GLuint64 pos = h->end;
+  while (pos<_size)
+  {
+    const Record *r = reinterpret_cast<const Record *>(_base+pos);
+    if (pos+sizeof(Record)>_size || r->magic!=recordMagic || pos+sizeof(Record)+r->size>_size)
+      break;
+
+    Entry &e = _appended[r->hash];
+    e.hash     = r->hash;
+    e.offset   = pos+sizeof(Record);
+    e.size     = r->size;
+    e.rawSize  = r->rawSize;
+    e.flags    = r->flags;
+    e.reserved = 0;
+
+    pos += pad(sizeof(Record)+r->size);
+  }
+
+  _appendable = pos>=_size;
+  if (!_appendable)
+  {
+    Warning("Pack ",filename," has ",_size-pos," unreadable bytes at offset ",pos,", not appending.");
+  }
+
+  Info("Pack ",filename," opened, ",_count," indexed and ",_appended.size()," appended.");
+
+  _valid = true;
+  return true;
+}
+
+void
+Pack::unmap()
+{
+#if REGAL_SYS_WIN32
+  if (_base)
+    UnmapViewOfFile(_base);
+  if (_mapping)
+    CloseHandle(_mapping);
+  _mapping = NULL;
+#else
+  if (_base)
+    munmap(const_cast<char *>(_base), std::size_t(_size));
+#endif
+  _base  = NULL;
+  _size  = 0;
+  _index = NULL;
+  _count = 0;
+}
+
+void
+Pack::close()
+{
+  Thread::ScopedLock lock(&_mutex);
+
+  if (_file!=noFile)
+  {
+    closeFile(_file);
+    _file = noFile;
+  }
+
+  unmap();
+  _appended.clear();
+  _valid      = false;
+  _appendable = true;
+}
+
+bool
+Pack::read(const Entry &entry, const bool appended, string &data)
+{
+  // Records appended since opening are beyond the mapping,
+  // read them back from the file
+
+  string tmp;
+  const char *blob = _base + entry.offset;
+  if (!_base || entry.offset+entry.size>_size)
+  {
+    if (_file==noFile || entry.offset<sizeof(Record))
+      return false;
+    tmp.resize(sizeof(Record)+entry.size);
+    if (!readAt(_file, entry.offset-sizeof(Record), &tmp[0], tmp.size()))
+      return false;
+    blob = tmp.data()+sizeof(Record);
+  }
+
+  // An appended record must still be the one expected, anything
+  // else at that offset is a miss
+
+  if (appended)
+  {
+    Record r;
+    memcpy(&r, blob-sizeof(Record), sizeof(Record));
+    if (r.magic!=recordMagic || r.hash!=entry.hash || r.size!=entry.size || r.rawSize!=entry.rawSize || r.flags!=entry.flags)
+    {
+      Warning("Pack ",_filename," record ",boost::print::hex(entry.hash)," does not match, ignored.");
+      return false;
+    }
+  }
+
+  if (entry.flags & PACK_SNAPPY)
+  {
+#if !REGAL_NO_SNAPPY
+    return snappy::Uncompress(blob, entry.size, &data) && data.size()==entry.rawSize;
+#else
+    return false;
+#endif
+  }
+
+  data.assign(blob, entry.size);
+  return true;
+}
+
+bool
+Pack::find(const GLuint64 hash, string &data)
+{
+  Thread::ScopedLock lock(&_mutex);
+
+  map<GLuint64, Entry>::const_iterator i = _appended.find(hash);
+  if (i!=_appended.end())
+    return read(i->second, true, data);
+
+  const Entry *j = std::lower_bound(_index, _index+_count, hash, lessHash);
+  if (j!=_index+_count && j->hash==hash)
+    return read(*j, false, data);
+
+  return false;
+}
+
+bool
+Pack::append(const GLuint64 hash, const void *data, const std::size_t size, const bool compress)
+{
+  Thread::ScopedLock lock(&_mutex);
+
+  if (!_valid || !_appendable)
+    return false;
+
+  if (_file==noFile)
+  {
+    _file = openAppend(_filename);
+    if (_file==noFile)
+    {
+      Warning("Could not write pack ",_filename,", permissions problem?");
+      _appendable = false;
+      return false;
+    }
+  }
+
+  string stored;
+  Record r;
+  r.magic   = recordMagic;
+  r.flags   = encode(data,size,compress,stored);
+  r.hash    = hash;
+  r.size    = GLuint(stored.size());
+  r.rawSize = GLuint(size);
+
+  string record(reinterpret_cast<const char *>(&r),sizeof(r));
+  record += stored;
+  record.resize(std::size_t(pad(record.size())),'\0');
+
+  // Under the lock, the end of the file is where the record goes.
+  // A new pack starts with an empty index.
+
+  if (!lockFile(_file,true))
+  {
+    Warning("Could not lock pack ",_filename,".");
+    return false;
+  }
+
+  GLuint64 offset = 0;
+  bool ok = fileSize(_file,offset);
+  if (ok && !offset)
+  {
+    Header h;
+    memset(&h,0,sizeof(h));
+    memcpy(h.magic,"REGALPAK",8);
+    h.version = version;
+    h.end     = sizeof(Header);
+    record.insert(0,reinterpret_cast<const char *>(&h),sizeof(h));
+    offset = sizeof(Header);
+  }
+  ok = ok && writeAppend(_file,record);
+  lockFile(_file,false);
+
+  if (!ok)
+  {
+    Warning("Could not write pack ",_filename,".");
+    return false;
+  }
+
+  Entry &e = _appended[hash];
+  e.hash     = hash;
+  e.offset   = offset+sizeof(Record);
+  e.size     = r.size;
+  e.rawSize  = r.rawSize;
+  e.flags    = r.flags;
+  e.reserved = 0;
+  return true;
+}
+
+void
+Pack::hashes(vector<GLuint64> &hashes)
+{
+  Thread::ScopedLock lock(&_mutex);
+
+  hashes.clear();
+  for (GLuint i=0; i<_count; ++i)
+    hashes.push_back(_index[i].hash);
+  for (map<GLuint64, Entry>::const_iterator i = _appended.begin(); i!=_appended.end(); ++i)
+    hashes.push_back(i->first);
+
+  std::sort(hashes.begin(),hashes.end());
+  hashes.erase(std::unique(hashes.begin(),hashes.end()),hashes.end());
+}
+
+bool
+Pack::compact(const string &input, const string &output, const bool compress)
+{
+  Pack in;
+  if (!in.open(input))
+    return false;
+
+  vector<GLuint64> all;
+  in.hashes(all);
+
+  // Index first, then the blobs in the same order
+
+  vector<Entry>  index;
+  vector<string> blobs;
+  GLuint64 offset = sizeof(Header) + all.size()*sizeof(Entry);
+
+  for (std::size_t i=0; i<all.size(); ++i)
+  {
+    string data;
+    if (!in.find(all[i],data))
+    {
+      Warning("Pack ",input," blob ",boost::print::hex(all[i])," could not be read, dropped.");
+      continue;
+    }
+
+    Entry e;
+    blobs.push_back(string());
+    e.hash     = all[i];
+    e.flags    = encode(data.data(),data.size(),compress,blobs.back());
+    e.offset   = offset;
+    e.size     = GLuint(blobs.back().size());
+    e.rawSize  = GLuint(data.size());
+    e.reserved = 0;
+    index.push_back(e);
+    offset += e.size;
+  }
+  in.close();
+
+  // Dropped blobs leave the index shorter than planned
+
+  const GLuint64 shrink = (all.size()-index.size())*sizeof(Entry);
+  for (std::size_t i=0; i<index.size(); ++i)
+    index[i].offset -= shrink;
+
+  Header h;
+  memset(&h,0,sizeof(h));
+  memcpy(h.magic,"REGALPAK",8);
+  h.version = version;
+  h.count   = GLuint(index.size());
+  h.end     = pad(offset - shrink);
+
+  // Written aside and renamed, so output may be the input
+
+  const string tmp = output + ".tmp";
+  FILE *f = fopen(tmp.c_str(),"wb");
+  if (!f)
+    return false;
+
+  bool ok = writeBlock(f,&h,sizeof(h)) && writeBlock(f,index.empty() ? NULL : &index[0],index.size()*sizeof(Entry));
+  for (std::size_t i=0; ok && i<blobs.size(); ++i)
+    ok = writeBlock(f,blobs[i].data(),blobs[i].size());
+  const char zero[8] = { 0 };
+  ok = ok && writeBlock(f,zero,std::size_t(h.end-(offset-shrink)));
+  ok = !fclose(f) && ok;
+
+  if (ok)
+  {
+    remove(output.c_str());
+    ok = !rename(tmp.c_str(),output.c_str());
+  }
+  if (!ok)
+    remove(tmp.c_str());
+  return ok;
+}
+
+GLuint64
+Pack::hash(const void *data, const std::size_t size, const GLuint64 seed)
+{
+  uint32_t pc = uint32_t(seed);
+  uint32_t pb = uint32_t(seed>>32);
+  Lookup3::hashlittle2(data, size, &pc, &pb);
+  return (GLuint64(pb)<<32) | pc;
+}
+
+};
+
+REGAL_NAMESPACE_END
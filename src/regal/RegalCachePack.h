@@ -0,0 +1,161 @@
+/*
+  Copyright (c) 2011-2012 NVIDIA Corporation
+  Copyright (c) 2011-2012 Cass Everitt
+  Copyright (c) 2012 Scott Nations
+  Copyright (c) 2012 Mathias Schott
+  Copyright (c) 2012 Nigel Stewart
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+    Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+  IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+  OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+  OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+
+ Single-file cache of blobs, looked up by 64-bit hash
+
+   Header     "REGALPAK", version, indexed count and end offset
+   Index      hash, offset and sizes of each blob, sorted by hash
+   Blobs      concatenated, each either raw or snappy compressed
+   Records    appended since the last compaction, each a
+              header followed by its blob
+
+ The file is mapped once for reading, the index is searched in
+ place and appended records are gathered into a map on opening.
+ New blobs are appended to the end of the file under a file
+ lock, each record in a single write, and read back from there
+ rather than kept in memory.  Appended records are checked
+ against their header when read.  Compaction folds
+ everything into the index, see src/regalpack.
+
+ */
+
+#ifndef __REGAL_CACHE_PACK_H__
+#define __REGAL_CACHE_PACK_H__
+
+#include "RegalUtil.h"
+
+REGAL_GLOBAL_BEGIN
+
+#include <cstdio>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <GL/Regal.h>
+
+#include "RegalMutex.h"
+
+REGAL_GLOBAL_END
+
+REGAL_NAMESPACE_BEGIN
+
+namespace Cache {
+
+struct Pack
+{
+  enum Flags
+  {
+    PACK_SNAPPY = 0x1
+  };
+
+  struct Header
+  {
+    char     magic[8];
+    GLuint   version;
+    GLuint   count;        // Indexed blobs
+    GLuint64 end;          // Appended records start here
+  };
+
+  struct Entry
+  {
+    GLuint64 hash;
+    GLuint64 offset;
+    GLuint   size;         // Stored size
+    GLuint   rawSize;
+    GLuint   flags;
+    GLuint   reserved;
+  };
+
+  struct Record
+  {
+    GLuint   magic;
+    GLuint   flags;
+    GLuint64 hash;
+    GLuint   size;
+    GLuint   rawSize;
+  };
+
+  Pack();
+  ~Pack();
+
+  // A missing file is an empty pack, created on the first append
+
+  bool open(const std::string &filename);
+  void close();
+
+  bool find  (const GLuint64 hash, std::string &data);
+  bool append(const GLuint64 hash, const void *data, const std::size_t size, const bool compress);
+
+  // Indexed and appended hashes, in no particular order
+
+  void hashes(std::vector<GLuint64> &hashes);
+
+  // Rewrite input as a fully indexed pack, output may be the input
+
+  static bool compact(const std::string &input, const std::string &output, const bool compress);
+
+  static GLuint64 hash(const void *data, const std::size_t size, const GLuint64 seed = 0);
+
+private:
+  bool read(const Entry &entry, const bool appended, std::string &data);
+  void unmap();
+
+  std::string   _filename;
+  bool          _valid;      // Readable, or new
+  bool          _appendable;
+  const char   *_base;
+  GLuint64      _size;
+  const Entry  *_index;
+  GLuint        _count;
+
+  std::map<GLuint64, Entry> _appended;   // On disk, after the index
+
+  Thread::Mutex  _mutex;
+
+  // Opened for appending on first use, and reading those records back
+
+#if REGAL_SYS_WIN32
+  void          *_file;
+  void          *_mapping;
+#else
+  int            _file;
+#endif
+
+  Pack(const Pack &);
+  Pack &operator=(const Pack &);
+};
+
+};
+
+REGAL_NAMESPACE_END
+
+#endif
@@ -0,0 +1,187 @@
+/*
+  Copyright (c) 2011-2012 NVIDIA Corporation
+  Copyright (c) 2011-2012 Cass Everitt
+  Copyright (c) 2012 Scott Nations
+  Copyright (c) 2012 Mathias Schott
+  Copyright (c) 2012 Nigel Stewart
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+    Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+  IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+  OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+  OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+
+ Disk-based program binary caching
+
+ */
+
+#include "pch.h" /* For MS precompiled header support */
+
+#include "RegalUtil.h"
+
+REGAL_GLOBAL_BEGIN
+
+#include "RegalLog.h"
+#include "RegalConfig.h"
+#include "RegalCacheProgram.h"
+
+#include <cstdio>
+#include <cstring>
+
+#include <string>
+#include <boost/print/print_string.hpp>
+
+using namespace ::std;
+using ::boost::print::print_string;
+
+REGAL_GLOBAL_END
+
+REGAL_NAMESPACE_BEGIN
+
+namespace Cache {
+
+namespace {
+
+  const char programBinaryMagic[4] = { 'R', 'P', 'B', '1' };
+
+  struct ProgramBinaryHeader
+  {
+    char     magic[4];
+    uint32_t format;
+    uint32_t keySize;
+    uint32_t binarySize;
+  };
+
+  inline string
+  programBinaryFilename(const uint64_t hash)
+  {
+    return makePath(Config::cacheDirectory,print_string(boost::print::hex(hash),".bin"));
+  }
+
+}
+
+bool
+readProgramBinary(const uint64_t hash, const void *key, const size_t keySize, GLenum &format, string &binary)
+{
+  if (!REGAL_CACHE || !REGAL_CACHE_PROGRAM || !REGAL_CACHE_PROGRAM_READ)
+    return false;
+
+  if (!Config::cache || !Config::cacheProgram || !Config::cacheProgramRead)
+    return false;
+
+  RegalAssert(key);
+
+  const string filename = programBinaryFilename(hash);
+
+  FILE *f = fopen(filename.c_str(),"rb");
+  if (!f)
+  {
+    Internal("Regal::Cache::readProgramBinary","hash=",boost::print::hex(hash)," filename=",filename," not found.");
+    return false;
+  }
+
+  bool ok = false;
+
+  ProgramBinaryHeader header;
+  if (fread(&header,sizeof(header),1,f)==1 && !memcmp(header.magic,programBinaryMagic,sizeof(programBinaryMagic)) && header.keySize==keySize && header.binarySize)
+  {
+    string tmp(keySize,'\0');
+    if (fread(&tmp[0],keySize,1,f)==1 && !memcmp(&tmp[0],key,keySize))
+    {
+      binary.resize(header.binarySize);
+      if (fread(&binary[0],header.binarySize,1,f)==1)
+      {
+        format = static_cast<GLenum>(header.format);
+        ok = true;
+      }
+    }
+    else
+      Warning("Cached program ",boost::print::hex(hash)," key mismatch: ",filename);
+  }
+
+  fclose(f);
+
+  if (ok)
+  {
+    Internal("Regal::Cache::readProgramBinary","hash=",boost::print::hex(hash)," filename=",filename," read.");
+    Info("Cached program ",boost::print::hex(hash)," read: ",filename);
+  }
+  else
+    binary.clear();
+
+  return ok;
+}
+
+bool
+writeProgramBinary(const uint64_t hash, const void *key, const size_t keySize, const GLenum format, const string &binary)
+{
+  if (!REGAL_CACHE || !REGAL_CACHE_PROGRAM || !REGAL_CACHE_PROGRAM_WRITE)
+    return false;
+
+  if (!Config::cache || !Config::cacheProgram || !Config::cacheProgramWrite)
+    return false;
+
+  RegalAssert(key);
+
+  if (!binary.size())
+    return false;
+
+  const string filename = programBinaryFilename(hash);
+
+  // Cache it to disk, iff it's not there yet
+
+  if (fileExists(filename.c_str()))
+    return false;
+
+  FILE *f = fopen(filename.c_str(),"wb");
+  if (!f)
+  {
+    Warning("Could not write program to file ",filename,", permissions problem?");
+    return false;
+  }
+
+  ProgramBinaryHeader header;
+  memcpy(header.magic,programBinaryMagic,sizeof(programBinaryMagic));
+  header.format     = static_cast<uint32_t>(format);
+  header.keySize    = static_cast<uint32_t>(keySize);
+  header.binarySize = static_cast<uint32_t>(binary.size());
+
+  const bool ok = fwrite(&header,sizeof(header),1,f)==1 &&
+                  fwrite(key,keySize,1,f)==1 &&
+                  fwrite(&binary[0],binary.size(),1,f)==1;
+  fclose(f);
+
+  if (!ok)
+  {
+    Warning("Could not write program to file ",filename,", disk full?");
+    remove(filename.c_str());
+    return false;
+  }
+
+  Internal("Regal::Cache::writeProgramBinary","hash=",boost::print::hex(hash)," filename=",filename," written.");
+  Info("Cached program ",boost::print::hex(hash)," written: ",filename);
+  return true;
+}
+
+};
+
+REGAL_NAMESPACE_END
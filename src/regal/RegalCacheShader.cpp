@@ -35,9 +35,9 @@
 REGAL_GLOBAL_BEGIN
 
 #include "RegalConfig.h"
+#include "RegalCachePack.h"
 #include "RegalCacheShader.h"
-
-#include <lookup3.h>
+#include "RegalMutex.h"
 
 #include <vector>
 #include <string>
@@ -52,80 +52,89 @@ REGAL_NAMESPACE_BEGIN
 
 namespace Cache {
 
+// All shaders are kept in a single pack file, mapped
+// once when the first shader is cached or looked up.
+
+namespace
+{
+  Thread::Mutex  packMutex;
+  Pack          *pack = NULL;
+
+  Pack *shaderPack()
+  {
+    Thread::ScopedLock lock(&packMutex);
+    if (!pack)
+    {
+      pack = new Pack();
+      pack->open(makePath(Config::cacheDirectory,"shader.pack"));
+    }
+    return pack;
+  }
+}
+
 void
 shaderSource(PFNGLSHADERSOURCEPROC proc, GLuint shader, GLsizei count, const GLchar * const * string, const GLint *length)
 {
   if (REGAL_CACHE && REGAL_CACHE_SHADER && Config::cache && Config::cacheShader)
   {
-    // Compute 32-bit hash of shader source
+    // Compute 64-bit hash of shader source
 
-    uint32_t hash = 0;
+    GLuint64 hash = 0;
     for (GLsizei i=0; i<count; ++i)
-      hash = Lookup3::hashlittle(string[i], length ? length[i] : strlen(string[i]), hash);
+      hash = Pack::hash(string[i], length ? length[i] : strlen(string[i]), hash);
 
-    ::std::string filename = makePath(Config::cacheDirectory,print_string(boost::print::hex(hash),".txt"));
+    Pack *p = shaderPack();
+    ::std::string buffer;
+    const bool found = p->find(hash,buffer);
 
-    // Cache it to disk, iff it's not there yet
+    // Cache it, iff it's not there yet
 
-    if (REGAL_CACHE_SHADER_WRITE && Config::cacheShaderWrite && !fileExists(filename.c_str()))
+    if (REGAL_CACHE_SHADER_WRITE && Config::cacheShaderWrite && !found)
     {
-      FILE *f = fopen(filename.c_str(),"wt");
-      if (!f)
-      {
-        Warning("Could not write shader to file ",filename,", permissions problem?");
-      }
-      else
+      for (GLsizei i=0; i<count; ++i)
+        buffer.append(string[i], length ? length[i] : strlen(string[i]));
+
+      if (p->append(hash,buffer.data(),buffer.size(),Config::cacheShaderCompress))
       {
-        Internal("Regal::ShaderCache::glShaderSource","shader=",shader," hash=",boost::print::hex(hash)," filename=",filename," written.");
-        Info("Cached shader ",boost::print::hex(hash)," written: ",filename);
-        for (GLsizei i=0; i<count; ++i)
-          fwrite(string[i], length ? length[i] : strlen(string[i]),1,f);
-        fclose(f);
+        Internal("Regal::ShaderCache::glShaderSource","shader=",shader," hash=",boost::print::hex(hash)," written.");
+        Info("Cached shader ",boost::print::hex(hash)," written.");
       }
     }
     else
     {
-      // Read from disk cache, if reading is enabled
+      // Read from cache, if reading is enabled
       // export REGAL_CACHE_SHADER_READ=1
 
       if (REGAL_CACHE_SHADER_READ && Config::cacheShaderRead)
       {
-        std::string buffer;
-
-        // Try opening the file
-
-        FILE *f = fopen(filename.c_str(),"rt");
-
-        if (!f)
+        if (!found)
         {
-          Internal("Regal::ShaderCache::glShaderSource","shader=",shader," hash=",boost::print::hex(hash)," filename=",filename," not found.");
-          Info("Cached shader ",boost::print::hex(hash)," not found: ",filename);
-          goto done;
+          Internal("Regal::ShaderCache::glShaderSource","shader=",shader," hash=",boost::print::hex(hash)," not found.");
+          Info("Cached shader ",boost::print::hex(hash)," not found.");
         }
+        else
+        {
+          Internal("Regal::ShaderCache::glShaderSource","shader=",shader," hash=",boost::print::hex(hash)," read.");
+          Info("Cached shader ",boost::print::hex(hash)," read.");
 
-        buffer = fileRead(f);
-
-        Internal("Regal::ShaderCache::glShaderSource","shader=",shader," hash=",boost::print::hex(hash)," filename=",filename," read.");
-        Info("Cached shader ",boost::print::hex(hash)," read: ",filename);
-
-        const GLchar *bufferPtr[2];
-        bufferPtr[0] = &buffer[0];
-        bufferPtr[1] = NULL;
+          const GLchar *bufferPtr[2];
+          bufferPtr[0] = buffer.c_str();
+          bufferPtr[1] = NULL;
 
-        proc(shader,1,bufferPtr,NULL);
-        return;
+          proc(shader,1,bufferPtr,NULL);
+          return;
+        }
       }
       else
       {
-        Internal("Regal::ShaderCache::glShaderSource","shader=",shader," hash=",boost::print::hex(hash)," filename=",filename," not read.");
-        Info("Cached shader ",boost::print::hex(hash)," not read: ",filename);
+        Internal("Regal::ShaderCache::glShaderSource","shader=",shader," hash=",boost::print::hex(hash)," not read.");
+        Info("Cached shader ",boost::print::hex(hash)," not read.");
       }
     }
   }
 
   // Call the driver
 
-done:
   proc(shader,count,string,length);
 }
 
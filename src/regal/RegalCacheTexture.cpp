@@ -30,7 +30,7 @@
 
 /*
 
- Disk-based .png texture caching
+ Disk-based texture caching
  Nigel Stewart
 
  */
@@ -43,17 +43,23 @@ REGAL_GLOBAL_BEGIN
 
 #include "RegalConfig.h"
 #include "RegalToken.h"
+#include "RegalHelper.h"
+#include "RegalMutex.h"
+#include "RegalWorkQueue.h"
+#include "RegalCachePack.h"
 #include "RegalCacheTexture.h"
-#include "RegalScopedPtr.h"
-
-#include <lookup3.h>           // 32-bit memory hashing function
 
+#include <set>
 #include <string>
+#include <cstdio>
 #include <boost/print/print_string.hpp>
 
+#if !REGAL_NO_SNAPPY
+#include <snappy.h>
+#endif
+
 #if !REGAL_NO_PNG
 #include <zlib.h>
-#include <png.h>
 #endif
 
 using namespace ::std;
@@ -65,136 +71,501 @@ REGAL_NAMESPACE_BEGIN
 
 namespace Cache {
 
-static void
-cacheTextureTarget(PFNGLGETTEXLEVELPARAMETERIVPROC getTexLevelProc, PFNGLGETTEXIMAGEPROC getTexImageProc, GLenum target)
+namespace
 {
-  RegalAssert(getTexLevelProc);
-  RegalAssert(getTexImageProc);
+  // .rtex container layout, native byte order:
+  //
+  //   TextureHeader
+  //   TextureLevel, followed by size bytes of level data
+  //   ...one per level
+  //
+  // Levels are relative to the level uploaded by the application.
+
+  const char   textureMagic[8] = { 'R','E','G','A','L','T','E','X' };
+  const GLuint textureVersion  = 1;
+
+  struct TextureHeader
+  {
+    char   magic[8];
+    GLuint version;
+    GLuint compression;
+    GLint  internalFormat;
+    GLenum format;
+    GLenum type;
+    GLint  alignment;     // GL_UNPACK_ALIGNMENT of level data, always 1
+    GLuint levels;
+    GLuint reserved;
+  };
+
+  struct TextureLevel
+  {
+    GLint   level;
+    GLsizei width;
+    GLsizei height;
+    GLint   border;
+    GLuint  size;         // Bytes stored
+    GLuint  rawSize;      // Bytes uncompressed
+  };
+
+  // Bytes per pixel for the formats and types cached,
+  // zero for anything else
+
+  size_t pixelSize(const GLenum format, const GLenum type)
+  {
+    switch (type)
+    {
+      case GL_UNSIGNED_BYTE_3_3_2:
+      case GL_UNSIGNED_BYTE_2_3_3_REV:
+      case GL_UNSIGNED_SHORT_5_6_5:
+      case GL_UNSIGNED_SHORT_5_6_5_REV:
+      case GL_UNSIGNED_SHORT_4_4_4_4:
+      case GL_UNSIGNED_SHORT_4_4_4_4_REV:
+      case GL_UNSIGNED_SHORT_5_5_5_1:
+      case GL_UNSIGNED_SHORT_1_5_5_5_REV:
+      case GL_UNSIGNED_INT_8_8_8_8:
+      case GL_UNSIGNED_INT_8_8_8_8_REV:
+      case GL_UNSIGNED_INT_10_10_10_2:
+      case GL_UNSIGNED_INT_2_10_10_10_REV: return helper::size::bytesPerComponent(type);
+      case GL_BITMAP:                      return 0;
+      default:                             break;
+    }
+
+    size_t components = 0;
+    switch (format)
+    {
+      case GL_RED:
+      case GL_GREEN:
+      case GL_BLUE:
+      case GL_ALPHA:
+      case GL_LUMINANCE:
+      case GL_INTENSITY:
+      case GL_DEPTH_COMPONENT:
+      case GL_STENCIL_INDEX:
+      case GL_RED_INTEGER:
+      case GL_GREEN_INTEGER:
+      case GL_BLUE_INTEGER:
+      case GL_ALPHA_INTEGER:      components = 1; break;
+      case GL_RG:
+      case GL_LUMINANCE_ALPHA:
+      case GL_RG_INTEGER:         components = 2; break;
+      case GL_RGB:
+      case GL_BGR:
+      case GL_RGB_INTEGER:
+      case GL_BGR_INTEGER:        components = 3; break;
+      case GL_RGBA:
+      case GL_BGRA:
+      case GL_RGBA_INTEGER:
+      case GL_BGRA_INTEGER:       components = 4; break;
+      default:                    break;
+    }
+
+    return components*helper::size::bytesPerComponent(type);
+  }
+
+  // Level data as stored, compressed only if that is smaller
+
+  GLuint compressLevel(const string &data, string &stored, const TextureCompression compression)
+  {
+    switch (compression)
+    {
+#if !REGAL_NO_SNAPPY
+      case TEXTURE_SNAPPY:
+        snappy::Compress(data.data(),data.size(),&stored);
+        if (stored.size()<data.size())
+          return TEXTURE_SNAPPY;
+        break;
+#endif
+#if !REGAL_NO_PNG
+      case TEXTURE_ZLIB:
+      {
+        uLongf size = compressBound(uLong(data.size()));
+        stored.resize(size);
+        if (compress2(reinterpret_cast<Bytef *>(&stored[0]),&size,reinterpret_cast<const Bytef *>(data.data()),uLong(data.size()),Z_BEST_SPEED)==Z_OK && size<data.size())
+        {
+          stored.resize(size);
+          return TEXTURE_ZLIB;
+        }
+        break;
+      }
+#endif
+      default:
+        break;
+    }
+
+    stored = data;
+    return TEXTURE_RAW;
+  }
+
+  bool uncompressLevel(const GLuint compression, const char *stored, const size_t size, string &data, const size_t rawSize)
+  {
+    if (size==rawSize)
+    {
+      data.assign(stored,size);
+      return true;
+    }
 
-  if (REGAL_CACHE && REGAL_CACHE_TEXTURE && Config::cache && Config::cacheTexture)
+    switch (compression)
+    {
+#if !REGAL_NO_SNAPPY
+      case TEXTURE_SNAPPY:
+        return snappy::Uncompress(stored,size,&data) && data.size()==rawSize;
+#endif
+#if !REGAL_NO_PNG
+      case TEXTURE_ZLIB:
+      {
+        data.resize(rawSize);
+        uLongf length = uLongf(rawSize);
+        return uncompress(reinterpret_cast<Bytef *>(&data[0]),&length,reinterpret_cast<const Bytef *>(stored),uLong(size))==Z_OK && length==rawSize;
+      }
+#endif
+      default:
+        return false;
+    }
+  }
+
+  // Background writing, one thread shared by all contexts
+
+  Thread::Mutex       textureMutex;
+  Thread::WorkQueue  *writer = NULL;
+  set<GLuint64>       written;         // Hashes written or queued this session
+
+  struct WriteJob : public Thread::Job
   {
-    // Query the texture dimensions
-    // TODO: Query the internal format and channels too?
+    WriteJob(const string &f, const GLuint64 h, const TextureCompression c) : filename(f), hash(h), compression(c) {}
+
+    void run()
+    {
+      if (writeTexture(filename,texture,compression))
+      {
+        Internal("Regal::CacheTexture::texImage2D"," hash=",boost::print::hex(hash)," filename=",filename," written.");
+        Info("Cached texture written: ",filename);
+      }
+      else
+      {
+        Warning("Could not write texture to file ",filename,", permissions problem?");
+      }
+    }
+
+    string             filename;
+    GLuint64           hash;
+    TextureCompression compression;
+    Texture            texture;
+  };
+
+  // Application unpack state, as it affects glTexImage2D
+
+  struct Unpack
+  {
+    GLint alignment;
+    GLint rowLength;
+    GLint skipRows;
+    GLint skipPixels;
+
+    void get(PFNGLGETINTEGERVPROC getIntegervProc, const bool unpackState)
+    {
+      alignment = 4;
+      rowLength = skipRows = skipPixels = 0;
+      getIntegervProc(GL_UNPACK_ALIGNMENT,&alignment);
+      if (unpackState)
+      {
+        getIntegervProc(GL_UNPACK_ROW_LENGTH, &rowLength);
+        getIntegervProc(GL_UNPACK_SKIP_ROWS,  &skipRows);
+        getIntegervProc(GL_UNPACK_SKIP_PIXELS,&skipPixels);
+      }
+      if (alignment<1)
+        alignment = 1;
+    }
+
+    void set(PFNGLPIXELSTOREIPROC pixelStoreProc, const bool unpackState) const
+    {
+      pixelStoreProc(GL_UNPACK_ALIGNMENT,alignment);
+      if (unpackState)
+      {
+        pixelStoreProc(GL_UNPACK_ROW_LENGTH, rowLength);
+        pixelStoreProc(GL_UNPACK_SKIP_ROWS,  skipRows);
+        pixelStoreProc(GL_UNPACK_SKIP_PIXELS,skipPixels);
+      }
+    }
+  };
+}
 
-    GLint width = 0;
-    GLint height = 0;
+TextureCompression
+textureCompression(const string &name)
+{
+  if (name=="snappy") return TEXTURE_SNAPPY;
+  if (name=="zlib")   return TEXTURE_ZLIB;
+  return TEXTURE_RAW;
+}
 
-    getTexLevelProc(target, 0, GL_TEXTURE_WIDTH,  &width);
-    getTexLevelProc(target, 0, GL_TEXTURE_HEIGHT, &height);
+GLuint64
+textureHash(const Texture &texture)
+{
+  RegalAssert(texture.levels.size());
+  const Texture::Level &l = texture.levels.front();
+  const GLint key[6] = { texture.internalFormat, l.width, l.height, l.border, GLint(texture.format), GLint(texture.type) };
+  return Pack::hash(l.data.data(),l.data.size(),Pack::hash(key,sizeof(key)));
+}
 
-    const GLint size = width*height;
-    const GLint bytes = size*4;
+string
+textureFilename(const GLuint64 hash)
+{
+  return makePath(Config::cacheDirectory,print_string(boost::print::hex(hash),".rtex"));
+}
 
-    Internal("Regal::CacheTexture::texture","width=",width," height=",height);
+bool
+writeTexture(const string &filename, const Texture &texture, const TextureCompression compression)
+{
+  // Written alongside, then renamed into place so that
+  // a partial container is never seen by a reader
+
+  const string tmp = filename + ".tmp";
+  FILE *file = fopen(tmp.c_str(),"wb");
+  if (!file)
+    return false;
+
+  TextureHeader header;
+  memset(&header,0,sizeof(header));
+  memcpy(header.magic,textureMagic,sizeof(textureMagic));
+  header.version        = textureVersion;
+  header.compression    = TEXTURE_RAW;
+  header.internalFormat = texture.internalFormat;
+  header.format         = texture.format;
+  header.type           = texture.type;
+  header.alignment      = 1;
+  header.levels         = GLuint(texture.levels.size());
+
+  // Compress up front, the header records the method actually used
+
+  vector<string> stored(texture.levels.size());
+  for (size_t i=0; i<texture.levels.size(); ++i)
+  {
+    const GLuint c = compressLevel(texture.levels[i].data,stored[i],compression);
+    if (c!=TEXTURE_RAW)
+      header.compression = c;
+  }
 
-    if (!width || !height)
-      return;
+  bool ok = fwrite(&header,sizeof(header),1,file)==1;
+  for (size_t i=0; ok && i<texture.levels.size(); ++i)
+  {
+    const Texture::Level &l = texture.levels[i];
+
+    TextureLevel level;
+    memset(&level,0,sizeof(level));
+    level.level   = l.level;
+    level.width   = l.width;
+    level.height  = l.height;
+    level.border  = l.border;
+    level.size    = GLuint(stored[i].size());
+    level.rawSize = GLuint(l.data.size());
+
+    ok = fwrite(&level,sizeof(level),1,file)==1 &&
+         (stored[i].empty() || fwrite(stored[i].data(),stored[i].size(),1,file)==1);
+  }
 
-    // Fetch the RGBA texture data
-    // TODO: Handle packing alignment...
+  ok = fclose(file)==0 && ok;
+  if (ok)
+  {
+    remove(filename.c_str());
+    ok = rename(tmp.c_str(),filename.c_str())==0;
+  }
+  if (!ok)
+    remove(tmp.c_str());
+  return ok;
+}
 
-    scoped_array<GLbyte> buffer(new GLbyte [bytes]);
+bool
+readTexture(const string &filename, Texture &texture)
+{
+  FILE *file = fopen(filename.c_str(),"rb");
+  if (!file)
+    return false;
 
-    getTexImageProc(target,0,GL_RGBA,GL_UNSIGNED_BYTE,buffer.get());
+  string buffer;
+  long size = -1;
+  if (!fseek(file,0,SEEK_END) && (size=ftell(file))>0 && !fseek(file,0,SEEK_SET))
+  {
+    buffer.resize(size_t(size));
+    if (fread(&buffer[0],buffer.size(),1,file)!=1)
+      buffer.clear();
+  }
+  fclose(file);
+
+  TextureHeader header;
+  if (buffer.size()<sizeof(header))
+    return false;
+  memcpy(&header,buffer.data(),sizeof(header));
+  if (memcmp(header.magic,textureMagic,sizeof(textureMagic)) || header.version!=textureVersion || header.alignment!=1 || !header.levels)
+    return false;
+
+  const size_t pixel = pixelSize(header.format,header.type);
+  if (!pixel)
+    return false;
+
+  texture.internalFormat = header.internalFormat;
+  texture.format         = header.format;
+  texture.type           = header.type;
+  texture.levels.clear();
+
+  size_t offset = sizeof(header);
+  for (GLuint i=0; i<header.levels; ++i)
+  {
+    TextureLevel level;
+    if (buffer.size()-offset<sizeof(level))
+      return false;
+    memcpy(&level,buffer.data()+offset,sizeof(level));
+    offset += sizeof(level);
+
+    // The driver reads exactly width*height pixels, anything
+    // short of that would have it reading past the data
+
+    if (level.width<=0 || level.height<=0 || level.size>buffer.size()-offset ||
+        level.rawSize!=size_t(level.width)*size_t(level.height)*pixel)
+      return false;
+
+    texture.levels.push_back(Texture::Level());
+    Texture::Level &l = texture.levels.back();
+    l.level  = level.level;
+    l.width  = level.width;
+    l.height = level.height;
+    l.border = level.border;
+    if (!uncompressLevel(header.compression,buffer.data()+offset,level.size,l.data,level.rawSize))
+      return false;
+    offset += level.size;
+  }
 
-    // Compute 32-bit hash
+  return true;
+}
 
-    uint32_t hash = 0;
-    hash = Lookup3::hashlittle(buffer.get(), bytes, hash);
+void
+texImage2D(PFNGLTEXIMAGE2DPROC texImageProc, PFNGLGETINTEGERVPROC getIntegervProc, PFNGLPIXELSTOREIPROC pixelStoreProc, const bool unpackState,
+           GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const GLvoid *pixels)
+{
+  RegalAssert(texImageProc);
+  RegalAssert(getIntegervProc);
+  RegalAssert(pixelStoreProc);
 
-    string filename = makePath(Config::cacheDirectory,print_string(boost::print::hex(hash),".png"));
+  // Only client memory uploads of known pixel sizes are cached,
+  // anything sourced from a pixel unpack buffer passes through
 
-    Info("glBindTexture(",Token::GLenumToString(target),") width=",width," height=",height," hash=",boost::print::hex(hash));
+  const size_t pixel = pixelSize(format,type);
 
-    // Cache it to disk, iff it's not there yet
-    // export REGAL_CACHE_TEXTURE_WRITE=1
+  if (REGAL_CACHE && REGAL_CACHE_TEXTURE && Config::cache && Config::cacheTexture && pixels && pixel && width>0 && height>0)
+  {
+    GLint unpackBuffer = 0;
+    if (unpackState)
+      getIntegervProc(GL_PIXEL_UNPACK_BUFFER_BINDING,&unpackBuffer);
 
-    if (REGAL_CACHE_TEXTURE_WRITE && Config::cacheTextureWrite && !fileExists(filename.c_str()))
+    if (!unpackBuffer)
     {
-#if !REGAL_NO_PNG
-      static png_color_8 pngSBIT = {8, 8, 8, 0, 8};
+      Unpack unpack;
+      unpack.get(getIntegervProc,unpackState);
+
+      // Gather the rows, tightly packed
+
+      const size_t rowBytes = size_t(width)*pixel;
+      const size_t rowPixels = unpack.rowLength>0 ? size_t(unpack.rowLength) : size_t(width);
+      const size_t stride = (rowPixels*pixel + unpack.alignment - 1)/unpack.alignment*unpack.alignment;
+      const char *src = static_cast<const char *>(pixels) + size_t(unpack.skipRows)*stride + size_t(unpack.skipPixels)*pixel;
 
-      FILE *fp = fopen(filename.c_str(), "wb");
-      if (fp)
+      Texture texture;
+      texture.internalFormat = internalformat;
+      texture.format         = format;
+      texture.type           = type;
+      texture.levels.resize(1);
+
+      Texture::Level &l = texture.levels.back();
+      l.level  = 0;
+      l.width  = width;
+      l.height = height;
+      l.border = border;
+      l.data.resize(rowBytes*size_t(height));
+      for (GLsizei y=0; y<height; ++y)
+        memcpy(&l.data[size_t(y)*rowBytes],src+size_t(y)*stride,rowBytes);
+
+      // Compute 64-bit hash of the upload
+
+      const GLuint64 hash = textureHash(texture);
+      const string filename = textureFilename(hash);
+
+      Internal("Regal::CacheTexture::texImage2D","(",Token::GLenumToString(target),",",level,") width=",width," height=",height," hash=",boost::print::hex(hash));
+
+      // Cache it to disk, iff it's not there yet
+      // export REGAL_CACHE_TEXTURE_WRITE=1
+
+      if (REGAL_CACHE_TEXTURE_WRITE && Config::cacheTextureWrite && !fileExists(filename.c_str()))
       {
-        png_structp pngPtr = png_create_write_struct(PNG_LIBPNG_VER_STRING,NULL,NULL,NULL);
-        if (pngPtr)
+        WriteJob *job = NULL;
         {
-          png_infop pngInfo = png_create_info_struct(pngPtr);
-          if (pngInfo)
+          Thread::ScopedLock lock(&textureMutex);
+          if (written.insert(hash).second)
           {
-            png_init_io(pngPtr, fp);
-
-            // Z_NO_COMPRESSION, Z_BEST_SPEED, Z_BEST_COMPRESSION,
-            // Z_DEFAULT_COMPRESSION
-
-            png_set_compression_level(pngPtr, Z_BEST_COMPRESSION);
-            png_set_IHDR(pngPtr, pngInfo, width, height,
-                         8, PNG_COLOR_TYPE_RGBA, PNG_INTERLACE_NONE,
-                         PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
-            png_set_pHYs(pngPtr, pngInfo, 72 * 40, 72 * 40, PNG_RESOLUTION_METER);
-            png_set_sBIT(pngPtr, pngInfo, &pngSBIT);
-            png_write_info(pngPtr, pngInfo);
-            for (int y = height; y--; )
-              png_write_row(pngPtr, reinterpret_cast<png_byte *>(buffer.get() + y * width * 4));
-            png_write_end(pngPtr, pngInfo);
+            job = new WriteJob(filename,hash,textureCompression(Config::cacheTextureCompress));
+            job->texture.internalFormat = internalformat;
+            job->texture.format         = format;
+            job->texture.type           = type;
+            job->texture.levels.swap(texture.levels);
+
+            if (REGAL_CACHE_TEXTURE_ASYNC && Config::cacheTextureAsync && !writer)
+              writer = new Thread::WorkQueue(1);
+            if (writer && writer->threads())
+            {
+              writer->push(job);
+              job = NULL;
+            }
           }
-          png_destroy_write_struct(&pngPtr, &pngInfo);
         }
-        fclose(fp);
 
-        Internal("Regal::CacheTexture::texture"," hash=",boost::print::hex(hash)," filename=",filename," written.");
-        Info("Cached texture written: ",filename);
+        // Written here, without the background writer
+
+        if (job)
+        {
+          job->run();
+          delete job;
+        }
       }
       else
       {
-        Warning("Could not write texture to file ",filename,", permissions problem?");
-      }
-#endif
-    }
-    else
-    {
-      // Read from disk cache, if reading is enabled
-      // export REGAL_CACHE_TEXTURE_READ=1
+        // Read from disk cache, if reading is enabled
+        // export REGAL_CACHE_TEXTURE_READ=1
 
-      if (REGAL_CACHE_TEXTURE_READ && Config::cacheTextureRead)
-      {
-#if !REGAL_NO_PNG
-        // TODO
-#endif
-        return;
+        if (REGAL_CACHE_TEXTURE_READ && Config::cacheTextureRead && readTexture(filename,texture))
+        {
+          Internal("Regal::CacheTexture::texImage2D"," hash=",boost::print::hex(hash)," filename=",filename," read.");
+          Info("Cached texture read: ",filename," levels=",texture.levels.size());
+
+          // Upload every level in the container, tightly packed
+
+          Unpack packed;
+          packed.alignment = 1;
+          packed.rowLength = packed.skipRows = packed.skipPixels = 0;
+          packed.set(pixelStoreProc,unpackState);
+
+          for (size_t i=0; i<texture.levels.size(); ++i)
+          {
+            const Texture::Level &t = texture.levels[i];
+            texImageProc(target,level+t.level,texture.internalFormat,t.width,t.height,t.border,texture.format,texture.type,t.data.data());
+          }
+
+          unpack.set(pixelStoreProc,unpackState);
+          return;
+        }
       }
     }
   }
+
+  // Call the driver
+
+  texImageProc(target,level,internalformat,width,height,border,format,type,pixels);
 }
 
 void
-bindTexture(PFNGLBINDTEXTUREPROC bindTextureProc, PFNGLGETTEXLEVELPARAMETERIVPROC getTexLevelProc, PFNGLGETTEXIMAGEPROC getTexImageProc, GLenum target, GLuint texture)
+flushTextures()
 {
-  RegalAssert(bindTextureProc);
-  RegalAssert(getTexLevelProc);
-  RegalAssert(getTexImageProc);
-
-  bindTextureProc(target,texture);
-
-  Internal("Cache::BindTexture(",Token::GLenumToString(target),",",texture,")");
-
-  switch (target)
+  Thread::ScopedLock lock(&textureMutex);
+  if (writer)
   {
-    case GL_TEXTURE_CUBE_MAP:
-      cacheTextureTarget(getTexLevelProc,getTexImageProc,GL_TEXTURE_CUBE_MAP_POSITIVE_X);
-      cacheTextureTarget(getTexLevelProc,getTexImageProc,GL_TEXTURE_CUBE_MAP_NEGATIVE_X);
-      cacheTextureTarget(getTexLevelProc,getTexImageProc,GL_TEXTURE_CUBE_MAP_POSITIVE_Y);
-      cacheTextureTarget(getTexLevelProc,getTexImageProc,GL_TEXTURE_CUBE_MAP_NEGATIVE_Y);
-      cacheTextureTarget(getTexLevelProc,getTexImageProc,GL_TEXTURE_CUBE_MAP_POSITIVE_Z);
-      cacheTextureTarget(getTexLevelProc,getTexImageProc,GL_TEXTURE_CUBE_MAP_NEGATIVE_Z);
-      break;
-
-    // TODO - arrays, etc
-
-    default:
-      cacheTextureTarget(getTexLevelProc,getTexImageProc,target);
-      break;
+    delete writer;       // Waits for queued jobs to complete
+    writer = NULL;
   }
 }
 
@@ -30,9 +30,15 @@
 
 /*
 
- Disk-based .png texture caching
+ Disk-based texture caching
  Nigel Stewart
 
+ Texture uploads are looked up by a hash of their content at
+ glTexImage2D time.  Each cached texture is a small binary container
+ (.rtex) holding one or more mip levels, raw or compressed, along with
+ the internal format, format and type they are to be uploaded with.
+ Replacing a container with a pre-baked one substitutes the texture.
+
  */
 
 #ifndef __REGAL_CACHE_TEXTURE_H__
@@ -42,6 +48,9 @@
 
 REGAL_GLOBAL_BEGIN
 
+#include <string>
+#include <vector>
+
 #include <GL/Regal.h>
 
 REGAL_GLOBAL_END
@@ -50,9 +59,56 @@ REGAL_NAMESPACE_BEGIN
 
 namespace Cache {
 
-  // glBindTexture handler
+  enum TextureCompression
+  {
+    TEXTURE_RAW    = 0,
+    TEXTURE_SNAPPY = 1,
+    TEXTURE_ZLIB   = 2       // zlib, level 1
+  };
+
+  // A cached texture, levels are tightly packed (GL_UNPACK_ALIGNMENT 1)
+
+  struct Texture
+  {
+    struct Level
+    {
+      GLint         level;
+      GLsizei       width;
+      GLsizei       height;
+      GLint         border;
+      ::std::string data;
+    };
+
+    GLint               internalFormat;
+    GLenum              format;
+    GLenum              type;
+    ::std::vector<Level> levels;
+  };
+
+  // .rtex container encoding, false if the file is missing or malformed
+
+  bool writeTexture(const ::std::string &filename, const Texture &texture, const TextureCompression compression);
+  bool readTexture (const ::std::string &filename, Texture &texture);
+
+  TextureCompression textureCompression(const ::std::string &name);
+
+  // Cache key of an upload, the first level of texture,
+  // and the container it is kept in
+
+  GLuint64      textureHash    (const Texture &texture);
+  ::std::string textureFilename(const GLuint64 hash);
+
+  // glTexImage2D handler
+  //
+  // unpackState is true for contexts with the complete unpack
+  // state and pixel unpack buffers: desktop GL and ES 3.0
+
+  void texImage2D(PFNGLTEXIMAGE2DPROC texImageProc, PFNGLGETINTEGERVPROC getIntegervProc, PFNGLPIXELSTOREIPROC pixelStoreProc, const bool unpackState,
+                  GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const GLvoid *pixels);
+
+  // Wait for any textures still being written in the background
 
-  void bindTexture(PFNGLBINDTEXTUREPROC bindTextureProc, PFNGLGETTEXLEVELPARAMETERIVPROC getTexLevelProc, PFNGLGETTEXIMAGEPROC getTexImageProc, GLenum target, GLuint texture);
+  void flushTextures();
 
 };
 
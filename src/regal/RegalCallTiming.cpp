@@ -0,0 +1,232 @@
+/*
+  Copyright (c) 2011-2013 NVIDIA Corporation
+  Copyright (c) 2011-2013 Cass Everitt
+  Copyright (c) 2012-2013 Scott Nations
+  Copyright (c) 2012-2013 Nigel Stewart
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+    Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+  IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+  OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+  OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+  Intended formatting conventions:
+  $ astyle --style=allman --indent=spaces=2 --indent-switches
+*/
+
+#include "pch.h" /* For MS precompiled header support */
+
+#include "RegalUtil.h"
+
+#if REGAL_STATISTICS
+
+REGAL_GLOBAL_BEGIN
+
+#include <cstring>
+
+#include <boost/print/json.hpp>
+
+#include "RegalCallTiming.h"
+#include "RegalDispatch.h"
+#include "RegalLookup.h"
+
+REGAL_GLOBAL_END
+
+REGAL_NAMESPACE_BEGIN
+
+namespace Json { struct Output : public ::boost::print::json::output<std::string> {}; }
+
+namespace
+{
+  const std::size_t entryPoints = sizeof(Dispatch::GL)/sizeof(void *);
+
+  // Entry point names by Dispatch::GL offset
+
+  const char *entryName(const std::size_t offset)
+  {
+    static std::vector<const char *> names;
+    if (names.empty())
+    {
+      names.resize(entryPoints,NULL);
+      for (std::size_t i=0; Lookup::gl_Name[i]; ++i)
+        if (Lookup::gl_Offset[i]<entryPoints)
+          names[Lookup::gl_Offset[i]] = Lookup::gl_Name[i];
+    }
+    return offset<entryPoints ? names[offset] : NULL;
+  }
+}
+
+//
+// Histogram
+//
+
+Histogram::Histogram()
+{
+  reset();
+}
+
+void
+Histogram::reset()
+{
+  ::memset(this,0,sizeof(Histogram));
+}
+
+GLuint64
+Histogram::lower(const std::size_t bucket)
+{
+  if (bucket<2*SUB)
+    return GLuint64(bucket);
+  const std::size_t shift = bucket/SUB - 1;
+  return GLuint64(bucket%SUB + SUB)<<shift;
+}
+
+GLuint64
+Histogram::upper(const std::size_t bucket)
+{
+  if (bucket<2*SUB)
+    return GLuint64(bucket);
+  const std::size_t shift = bucket/SUB - 1;
+  return lower(bucket) + (GLuint64(1)<<shift) - 1;
+}
+
+GLuint64
+Histogram::percentile(const double p) const
+{
+  if (!samples)
+    return 0;
+
+  // Rank of the sample wanted, counting from one
+
+  GLuint rank = GLuint(p*samples + 0.999999);
+  if (rank<1)
+    rank = 1;
+  if (rank>samples)
+    rank = samples;
+
+  GLuint n = 0;
+  for (std::size_t i=0; i<BUCKETS; ++i)
+  {
+    n += count[i];
+    if (n>=rank)
+      return upper(i)<maximum ? upper(i) : maximum;
+  }
+  return maximum;
+}
+
+void
+Histogram::writeJSON(Json::Output &jo, const char *name) const
+{
+#if !REGAL_NO_JSON
+  jo.object(name);
+    jo.member("calls", samples);
+    jo.member("total", total);
+    jo.member("p50",   percentile(0.50));
+    jo.member("p90",   percentile(0.90));
+    jo.member("p99",   percentile(0.99));
+    jo.member("max",   maximum);
+  jo.end();
+#else
+  UNUSED_PARAMETER(jo);
+  UNUSED_PARAMETER(name);
+#endif
+}
+
+//
+// CallTiming
+//
+
+CallTiming::Frame::Frame()
+: entries(entryPoints,NULL),
+  number(0)
+{
+}
+
+CallTiming::Frame::~Frame()
+{
+  for (std::size_t i=0; i<entries.size(); ++i)
+    delete entries[i];
+}
+
+CallTiming::CallTiming()
+: driverTime(0),
+  depth(0)
+{
+  entryName(0);     // Name table built up front, rather than while reporting
+}
+
+CallTiming::~CallTiming()
+{
+}
+
+void
+CallTiming::frame()
+{
+  Thread::ScopedLock lock(&_mutex);
+
+  _current.entries.swap(_last.entries);
+  _current.used.swap(_last.used);
+  _last.number = _current.number++;
+
+  // Entries of the frame before last are re-used, only
+  // those that were called need clearing
+
+  for (std::size_t i=0; i<_current.used.size(); ++i)
+  {
+    Entry *e = _current.entries[_current.used[i]];
+    e->regal.reset();
+    e->driver.reset();
+  }
+  _current.used.clear();
+}
+
+void
+CallTiming::writeJSON(Json::Output &jo) const
+{
+#if !REGAL_NO_JSON
+  Thread::ScopedLock lock(&_mutex);
+
+  jo.object("timing");
+    jo.member("frame", _last.number);
+    jo.member("units", "ns");
+    jo.object("calls");
+      for (std::size_t i=0; i<_last.used.size(); ++i)
+      {
+        const char  *name = entryName(_last.used[i]);
+        const Entry *e    = _last.entries[_last.used[i]];
+        if (!name || !e)
+          continue;
+        jo.object(name);
+          if (e->regal.samples)
+            e->regal.writeJSON(jo,"regal");
+          if (e->driver.samples)
+            e->driver.writeJSON(jo,"driver");
+        jo.end();
+      }
+    jo.end();
+  jo.end();
+#else
+  UNUSED_PARAMETER(jo);
+#endif
+}
+
+REGAL_NAMESPACE_END
+
+#endif // REGAL_STATISTICS
@@ -0,0 +1,241 @@
+/*
+  Copyright (c) 2011-2013 NVIDIA Corporation
+  Copyright (c) 2011-2013 Cass Everitt
+  Copyright (c) 2012-2013 Scott Nations
+  Copyright (c) 2012-2013 Nigel Stewart
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+    Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+  IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+  OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+  OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+
+ Per-call CPU timing
+
+ Call latency is gathered per entry point into log-linear histograms,
+ separately for time spent in the Regal layers and in the driver.
+ The histograms of the last complete frame are kept for reporting.
+
+ */
+
+#ifndef __REGAL_CALL_TIMING_H__
+#define __REGAL_CALL_TIMING_H__
+
+#include "RegalUtil.h"
+
+#if REGAL_STATISTICS
+
+REGAL_GLOBAL_BEGIN
+
+#include <cstddef>
+#include <vector>
+
+#include <GL/Regal.h>
+
+#include "RegalTimer.h"
+#include "RegalMutex.h"
+
+REGAL_GLOBAL_END
+
+REGAL_NAMESPACE_BEGIN
+
+namespace Json { struct Output; }
+
+// Durations in nanoseconds.  Values below 2^SUB_BITS are counted
+// exactly, each power of two above that is split into SUB buckets,
+// so percentiles are within 1/SUB of the recorded values.
+
+struct Histogram
+{
+  enum
+  {
+    SUB_BITS = 3,
+    SUB      = 1<<SUB_BITS,
+    MAX_BITS = 40,                              // Longer is counted in the last bucket
+    BUCKETS  = (MAX_BITS-SUB_BITS+1)*SUB
+  };
+
+  Histogram();
+
+  void reset();
+
+  inline void add(const GLuint64 value)
+  {
+    ++count[bucket(value)];
+    ++samples;
+    total += value;
+    if (value>maximum)
+      maximum = value;
+  }
+
+  // Upper bound of the bucket holding the p-th fraction of samples
+
+  GLuint64 percentile(const double p) const;
+
+  void writeJSON(Json::Output &jo, const char *name) const;
+
+  static inline std::size_t bucket(const GLuint64 value)
+  {
+    if (value<SUB)
+      return std::size_t(value);
+
+    std::size_t msb = 0;
+    GLuint64 v = value;
+    if (v>>32) { v >>= 32; msb += 32; }
+    if (v>>16) { v >>= 16; msb += 16; }
+    if (v>>8)  { v >>= 8;  msb += 8;  }
+    if (v>>4)  { v >>= 4;  msb += 4;  }
+    if (v>>2)  { v >>= 2;  msb += 2;  }
+    if (v>>1)  {           msb += 1;  }
+
+    if (msb>=MAX_BITS)
+      return BUCKETS-1;
+
+    const std::size_t shift = msb - SUB_BITS;
+    return shift*SUB + std::size_t(value>>shift);
+  }
+
+  static GLuint64 lower(const std::size_t bucket);
+  static GLuint64 upper(const std::size_t bucket);
+
+  GLuint   samples;
+  GLuint64 total;
+  GLuint64 maximum;
+  GLuint   count[BUCKETS];
+};
+
+struct CallTiming
+{
+  CallTiming();
+  ~CallTiming();
+
+  struct Entry
+  {
+    Histogram regal;      // Regal layers, less any driver calls made
+    Histogram driver;     // Driver calls, including those made by emulation
+  };
+
+  // Record a sample for the entry point at offset in Dispatch::GL
+
+  inline void regal(const std::size_t offset, const GLuint64 ns) { entry(offset).regal.add(ns); }
+  inline void driver(const std::size_t offset, const GLuint64 ns) { driverTime += ns; entry(offset).driver.add(ns); }
+
+  // Complete the current frame, it becomes the one reported
+
+  void frame();
+
+  void writeJSON(Json::Output &jo) const;
+
+  // Application call, timed from the front of the dispatch stack.
+  // Calls made from within another are not counted separately.
+
+  struct Call
+  {
+    inline Call(CallTiming *timing, const std::size_t offset)
+    : _timing(timing), _offset(offset), _outer(timing && !timing->depth++), _driver(0), _start(0)
+    {
+      if (_outer)
+      {
+        _driver = _timing->driverTime;
+        _start  = Timer::nanoseconds();
+      }
+    }
+
+    inline ~Call()
+    {
+      if (!_timing)
+        return;
+      if (_outer)
+      {
+        const GLuint64 elapsed = Timer::nanoseconds() - _start;
+        const GLuint64 driver  = _timing->driverTime - _driver;
+        _timing->regal(_offset, elapsed>driver ? elapsed-driver : 0);
+      }
+      --_timing->depth;
+    }
+
+    CallTiming        *_timing;
+    const std::size_t  _offset;
+    const bool         _outer;
+    GLuint64           _driver;
+    GLuint64           _start;
+  };
+
+  // Driver call, timed from the statistics layer
+
+  struct DriverCall
+  {
+    inline DriverCall(CallTiming *timing, const std::size_t offset)
+    : _timing(timing), _offset(offset), _start(timing ? Timer::nanoseconds() : 0)
+    {
+    }
+
+    inline ~DriverCall()
+    {
+      if (_timing)
+        _timing->driver(_offset, Timer::nanoseconds() - _start);
+    }
+
+    CallTiming        *_timing;
+    const std::size_t  _offset;
+    const GLuint64     _start;
+  };
+
+  GLuint64 driverTime;     // Running total, for excluding driver time from Regal time
+  GLuint   depth;          // Nesting of application calls
+
+private:
+
+  struct Frame
+  {
+    Frame();
+    ~Frame();
+
+    std::vector<Entry *>     entries;    // By Dispatch::GL offset, allocated on first use
+    std::vector<std::size_t> used;       // Offsets called in this frame, in order
+    GLuint64                 number;
+  };
+
+  inline Entry &entry(const std::size_t offset)
+  {
+    RegalAssert(offset<_current.entries.size());
+    Entry *&e = _current.entries[offset];
+    if (!e)
+      e = new Entry();
+    if (!e->regal.samples && !e->driver.samples)
+      _current.used.push_back(offset);
+    return *e;
+  }
+
+  Frame                 _current;
+  Frame                 _last;
+  mutable Thread::Mutex _mutex;          // Frame completion and reporting
+
+  CallTiming(const CallTiming &other);
+  CallTiming &operator=(const CallTiming &other);
+};
+
+REGAL_NAMESPACE_END
+
+#endif // REGAL_STATISTICS
+
+#endif // __REGAL_CALL_TIMING_H__
@@ -75,10 +75,14 @@ namespace Config {
   bool enableError         = false;
   bool enableCode          = false;
   bool enableStatistics    = false;
+  bool enableRedundant     = false;
   bool enableLog           = REGAL_LOG;
   bool enableDriver        = REGAL_DRIVER;
   bool enableMissing       = REGAL_MISSING;
 
+  bool dispatchCompiled    = false;
+  bool dispatchTiming      = false;
+
   bool enableEmuHint       = REGAL_EMU_HINT;
   bool enableEmuPpa        = REGAL_EMU_PPA;
   bool enableEmuPpca       = REGAL_EMU_PPCA;
@@ -115,6 +119,14 @@ namespace Config {
   bool forceEmuFilter      = REGAL_FORCE_EMU_FILTER;
   bool forceEmuTexC        = REGAL_FORCE_EMU_TEXC;
 
+  int  iffProgramCacheSize = 0;  // Unlimited
+  bool iffAsyncCompile     = false;
+  bool iffUniformBuffer    = false;
+  bool iffImmediateStream  = false;
+  bool iffImmediateBatch   = false;
+  bool vaoUploadCache      = false;
+  int  vaoUploadCacheSize  = 16*1024*1024;
+
   int  frameLimit          = 0;  // Unlimited
 
   bool frameMd5Color       = false;
@@ -131,6 +143,13 @@ namespace Config {
 
   bool frameCapture               = false;
 
+  bool frameAsync                 = false;
+  int  frameAsyncLatency          = 3;
+  int  frameAsyncThreads          = 2;
+  int  frameAsyncQueue            = 8;
+
+  bool frameGpuTiming             = false;
+
   ::std::string frameSaveColorPrefix  ("color_");
   ::std::string frameSaveStencilPrefix("stencil_");
   ::std::string frameSaveDepthPrefix  ("depth_");
@@ -139,9 +158,16 @@ namespace Config {
   bool          cacheShader       = false;
   bool          cacheShaderRead   = false;
   bool          cacheShaderWrite  = false;
+  bool          cacheShaderCompress = false;
+  bool          cacheGlsl         = false;
+  bool          cacheProgram      = false;
+  bool          cacheProgramRead  = false;
+  bool          cacheProgramWrite = false;
   bool          cacheTexture      = false;
   bool          cacheTextureRead  = false;
   bool          cacheTextureWrite = false;
+  ::std::string cacheTextureCompress(REGAL_NO_SNAPPY ? "none" : "snappy");
+  bool          cacheTextureAsync = false;
   ::std::string cacheDirectory("./");
 
 #if REGAL_CODE
@@ -236,10 +262,14 @@ namespace Config {
     getEnv( "REGAL_ERROR",      enableError,      REGAL_ERROR);
     getEnv( "REGAL_CODE",       enableCode,       REGAL_CODE);
     getEnv( "REGAL_STATISTICS", enableStatistics, REGAL_STATISTICS);
+    getEnv( "REGAL_REDUNDANT",  enableRedundant,  REGAL_REDUNDANT);
     getEnv( "REGAL_LOG",        enableLog,        REGAL_LOG);
     getEnv( "REGAL_DRIVER",     enableDriver,     REGAL_DRIVER);
     getEnv( "REGAL_MISSING",    enableMissing,    REGAL_MISSING);
 
+    getEnv( "REGAL_DISPATCH_COMPILED", dispatchCompiled);
+    getEnv( "REGAL_STATISTICS_TIMING", dispatchTiming, REGAL_STATISTICS);
+
     getEnv( "REGAL_EMU_HINT",       enableEmuHint,       REGAL_EMU_HINT);
     getEnv( "REGAL_EMU_PPA",        enableEmuPpa,        REGAL_EMU_PPA);
     getEnv( "REGAL_EMU_PPCA",       enableEmuPpca,       REGAL_EMU_PPCA);
@@ -278,6 +308,16 @@ namespace Config {
 
     //
 
+    getEnv( "REGAL_IFF_PROGRAM_CACHE_SIZE", iffProgramCacheSize);
+    getEnv( "REGAL_IFF_ASYNC_COMPILE",      iffAsyncCompile);
+    getEnv( "REGAL_IFF_UNIFORM_BUFFER",     iffUniformBuffer);
+    getEnv( "REGAL_IFF_IMMEDIATE_STREAM",   iffImmediateStream);
+    getEnv( "REGAL_IFF_IMMEDIATE_BATCH",    iffImmediateBatch);
+    getEnv( "REGAL_VAO_UPLOAD_CACHE",       vaoUploadCache);
+    getEnv( "REGAL_VAO_UPLOAD_CACHE_SIZE",  vaoUploadCacheSize);
+
+    //
+
     getEnv( "REGAL_FRAME_LIMIT",      frameLimit);
 
     //
@@ -297,6 +337,13 @@ namespace Config {
 
     getEnv( "REGAL_FRAME_CAPTURE", frameCapture);
 
+    getEnv( "REGAL_FRAME_ASYNC",         frameAsync);
+    getEnv( "REGAL_FRAME_ASYNC_LATENCY", frameAsyncLatency);
+    getEnv( "REGAL_FRAME_ASYNC_THREADS", frameAsyncThreads);
+    getEnv( "REGAL_FRAME_ASYNC_QUEUE",   frameAsyncQueue);
+
+    getEnv( "REGAL_FRAME_GPU_TIMING",    frameGpuTiming);
+
     // Caching
 
 #if REGAL_CACHE
@@ -307,12 +354,25 @@ namespace Config {
     getEnv( "REGAL_CACHE_SHADER",       cacheShader,      REGAL_CACHE_SHADER);
     getEnv( "REGAL_CACHE_SHADER_WRITE", cacheShaderWrite, REGAL_CACHE_SHADER_WRITE);
     getEnv( "REGAL_CACHE_SHADER_READ",  cacheShaderRead,  REGAL_CACHE_SHADER_READ);
+    getEnv( "REGAL_CACHE_SHADER_COMPRESS", cacheShaderCompress, !REGAL_NO_SNAPPY);
+
+    // GLSL optimizer output caching
+
+    getEnv( "REGAL_CACHE_GLSL",         cacheGlsl,        REGAL_CACHE_GLSL);
+
+    // Program binary caching
+
+    getEnv( "REGAL_CACHE_PROGRAM",       cacheProgram,      REGAL_CACHE_PROGRAM);
+    getEnv( "REGAL_CACHE_PROGRAM_WRITE", cacheProgramWrite, REGAL_CACHE_PROGRAM_WRITE);
+    getEnv( "REGAL_CACHE_PROGRAM_READ",  cacheProgramRead,  REGAL_CACHE_PROGRAM_READ);
 
     // Teture caching
 
     getEnv( "REGAL_CACHE_TEXTURE",       cacheTexture,      REGAL_CACHE_TEXTURE);
     getEnv( "REGAL_CACHE_TEXTURE_WRITE", cacheTextureWrite, REGAL_CACHE_TEXTURE_WRITE);
     getEnv( "REGAL_CACHE_TEXTURE_READ",  cacheTextureRead,  REGAL_CACHE_TEXTURE_READ);
+    getEnv( "REGAL_CACHE_TEXTURE_COMPRESS", cacheTextureCompress);
+    getEnv( "REGAL_CACHE_TEXTURE_ASYNC", cacheTextureAsync, REGAL_CACHE_TEXTURE_ASYNC);
 
     getEnv( "REGAL_CACHE_DIRECTORY", cacheDirectory );
 #endif
@@ -380,11 +440,16 @@ namespace Config {
 #endif
 #if REGAL_STATISTICS
     Info("REGAL_STATISTICS          ", enableStatistics    ? "enabled" : "disabled");
+#endif
+#if REGAL_REDUNDANT
+    Info("REGAL_REDUNDANT           ", enableRedundant     ? "enabled" : "disabled");
 #endif
     Info("REGAL_EMULATION           ", enableEmulation     ? "enabled" : "disabled");
     Info("REGAL_LOG                 ", enableLog           ? "enabled" : "disabled");
     Info("REGAL_DRIVER              ", enableDriver        ? "enabled" : "disabled");
     Info("REGAL_MISSING             ", enableMissing       ? "enabled" : "disabled");
+    Info("REGAL_DISPATCH_COMPILED   ", dispatchCompiled    ? "enabled" : "disabled");
+    Info("REGAL_STATISTICS_TIMING   ", dispatchTiming      ? "enabled" : "disabled");
 
     Info("REGAL_EMU_HINT            ", enableEmuHint       ? "enabled" : "disabled");
     Info("REGAL_EMU_PPA             ", enableEmuPpa        ? "enabled" : "disabled");
@@ -422,6 +487,14 @@ namespace Config {
     Info("REGAL_FORCE_EMU_FILTER    ", forceEmuFilter      ? "enabled" : "disabled");
     Info("REGAL_FORCE_EMU_TEXC      ", forceEmuTexC        ? "enabled" : "disabled");
 
+    Info("REGAL_IFF_PROGRAM_CACHE_SIZE ", iffProgramCacheSize                      );
+    Info("REGAL_IFF_ASYNC_COMPILE      ", iffAsyncCompile     ? "enabled" : "disabled");
+    Info("REGAL_IFF_UNIFORM_BUFFER     ", iffUniformBuffer    ? "enabled" : "disabled");
+    Info("REGAL_IFF_IMMEDIATE_STREAM   ", iffImmediateStream  ? "enabled" : "disabled");
+    Info("REGAL_IFF_IMMEDIATE_BATCH    ", iffImmediateBatch   ? "enabled" : "disabled");
+    Info("REGAL_VAO_UPLOAD_CACHE       ", vaoUploadCache      ? "enabled" : "disabled");
+    Info("REGAL_VAO_UPLOAD_CACHE_SIZE  ", vaoUploadCacheSize                       );
+
     Info("REGAL_FRAME_LIMIT         ", frameLimit                                  );
 
     Info("REGAL_MD5_COLOR           ", frameMd5Color       ? "enabled" : "disabled");
@@ -432,10 +505,23 @@ namespace Config {
     Info("REGAL_SAVE_STENCIL        ", frameSaveStencil    ? "enabled" : "disabled");
     Info("REGAL_SAVE_DEPTH          ", frameSaveDepth      ? "enabled" : "disabled");
 
+    Info("REGAL_FRAME_ASYNC         ", frameAsync          ? "enabled" : "disabled");
+    Info("REGAL_FRAME_ASYNC_LATENCY ", frameAsyncLatency                           );
+    Info("REGAL_FRAME_ASYNC_THREADS ", frameAsyncThreads                           );
+    Info("REGAL_FRAME_ASYNC_QUEUE   ", frameAsyncQueue                             );
+    Info("REGAL_FRAME_GPU_TIMING    ", frameGpuTiming      ? "enabled" : "disabled");
+
 #if REGAL_CACHE
     Info("REGAL_CACHE               ", cache               ? "enabled" : "disabled");
+    Info("REGAL_CACHE_GLSL          ", cacheGlsl           ? "enabled" : "disabled");
+    Info("REGAL_CACHE_PROGRAM       ", cacheProgram        ? "enabled" : "disabled");
+    Info("REGAL_CACHE_PROGRAM_WRITE ", cacheProgramWrite   ? "enabled" : "disabled");
+    Info("REGAL_CACHE_PROGRAM_READ  ", cacheProgramRead    ? "enabled" : "disabled");
     Info("REGAL_CACHE_TEXTURE       ", cacheTexture        ? "enabled" : "disabled");
     Info("REGAL_CACHE_TEXTURE_WRITE ", cacheTextureWrite   ? "enabled" : "disabled");
+    Info("REGAL_CACHE_TEXTURE_READ  ", cacheTextureRead    ? "enabled" : "disabled");
+    Info("REGAL_CACHE_TEXTURE_COMPRESS ", cacheTextureCompress                     );
+    Info("REGAL_CACHE_TEXTURE_ASYNC ", cacheTextureAsync   ? "enabled" : "disabled");
 #endif
 
 #if REGAL_CODE
@@ -487,6 +573,7 @@ namespace Config {
           jo.member("error",      enableError);
           jo.member("code",       enableCode);
           jo.member("statistics", enableStatistics);
+          jo.member("redundant",  enableRedundant);
           jo.member("emulation",  enableEmulation);
           jo.member("trace",      enableTrace);
           jo.member("http",       enableHttp);
@@ -499,6 +586,9 @@ namespace Config {
           jo.member("emulation", forceEmulation);
         jo.end();
 
+        jo.member("compiled", dispatchCompiled);
+        jo.member("timing",   dispatchTiming);
+
         jo.object("emulation");
 
           jo.object("enable");
@@ -541,6 +631,19 @@ namespace Config {
             jo.member("filter", forceEmuFilter);
           jo.end();
 
+          jo.object("iff");
+            jo.member("programCacheSize", iffProgramCacheSize);
+            jo.member("asyncCompile",     iffAsyncCompile);
+            jo.member("uniformBuffer",    iffUniformBuffer);
+            jo.member("immediateStream",  iffImmediateStream);
+            jo.member("immediateBatch",   iffImmediateBatch);
+          jo.end();
+
+          jo.object("vao");
+            jo.member("uploadCache",      vaoUploadCache);
+            jo.member("uploadCacheSize",  vaoUploadCacheSize);
+          jo.end();
+
         jo.end();
 
       jo.end();
@@ -569,6 +672,13 @@ namespace Config {
             jo.member("depth",   frameSaveDepthPrefix);
           jo.end();
         jo.end();
+        jo.object("async");
+          jo.member("enable",  frameAsync);
+          jo.member("latency", frameAsyncLatency);
+          jo.member("queue",   frameAsyncQueue);
+          jo.member("threads", frameAsyncThreads);
+        jo.end();
+        jo.member("gpuTiming", frameGpuTiming);
       jo.end();
 
       jo.object("cache");
@@ -576,9 +686,16 @@ namespace Config {
         jo.member("shader",       cacheShader);
         jo.member("shaderWrite",  cacheShaderWrite);
         jo.member("shaderRead",   cacheShaderRead);
-        jo.member("texture",      cacheShader);
-        jo.member("textureWrite", cacheShaderWrite);
-        jo.member("textureRead",  cacheShaderRead);
+        jo.member("shaderCompress", cacheShaderCompress);
+        jo.member("glsl",         cacheGlsl);
+        jo.member("program",      cacheProgram);
+        jo.member("programWrite", cacheProgramWrite);
+        jo.member("programRead",  cacheProgramRead);
+        jo.member("texture",      cacheTexture);
+        jo.member("textureWrite", cacheTextureWrite);
+        jo.member("textureRead",  cacheTextureRead);
+        jo.member("textureCompress", cacheTextureCompress);
+        jo.member("textureAsync", cacheTextureAsync);
         jo.member("directory",    cacheDirectory);
       jo.end();
 
@@ -87,10 +87,19 @@ namespace Config
   extern bool enableError;
   extern bool enableCode;
   extern bool enableStatistics;
+  extern bool enableRedundant;
   extern bool enableLog;
   extern bool enableDriver;
   extern bool enableMissing;
 
+  // Flatten the enabled layers into a single table per context
+
+  extern bool dispatchCompiled;
+
+  // Per entry point call timing, along with statistics
+
+  extern bool dispatchTiming;
+
   // Initial emulation layer enable/disable
 
   extern bool enableEmuHint;
@@ -131,6 +140,16 @@ namespace Config
   extern bool forceEmuFilter;
   extern bool forceEmuTexC;
 
+  // Emulation layer tuning
+
+  extern int  iffProgramCacheSize; // Maximum number of cached IFF programs, 0 for unlimited
+  extern bool iffAsyncCompile;     // Compile IFF programs in the background, if supported
+  extern bool iffUniformBuffer;    // Upload IFF uniforms via a uniform buffer, if supported
+  extern bool iffImmediateStream;  // Stream IFF immediate mode vertices via a mapped buffer, if supported
+  extern bool iffImmediateBatch;   // Merge consecutive IFF glBegin/glEnd blocks into one draw
+  extern bool vaoUploadCache;      // Re-use unchanged VAO client array uploads from a streaming buffer
+  extern int  vaoUploadCacheSize;  // Size in bytes of the VAO client array streaming buffer
+
   // Initial context configuration
 
   extern int  frameLimit;        // Maximum number of frames
@@ -153,15 +172,29 @@ namespace Config
 
   extern bool frameCapture;                   // Capture files and md5sums for other functions too
 
+  extern bool frameAsync;                     // Read back via pixel buffer objects, md5 and save in the background
+  extern int  frameAsyncLatency;              // Frames between readback and mapping
+  extern int  frameAsyncThreads;              // Worker threads for md5 and PNG encoding
+  extern int  frameAsyncQueue;                // Frames waiting for the workers before capture stalls
+
+  extern bool frameGpuTiming;                 // Timer queries around frames and group markers, to the JSON trace
+
   // Caching
 
   extern bool          cache;
   extern bool          cacheShader;
   extern bool          cacheShaderRead;
   extern bool          cacheShaderWrite;
+  extern bool          cacheShaderCompress;  // Snappy compression of the shader pack
+  extern bool          cacheGlsl;          // GLSL optimizer output, read and written
+  extern bool          cacheProgram;
+  extern bool          cacheProgramRead;
+  extern bool          cacheProgramWrite;
   extern bool          cacheTexture;
   extern bool          cacheTextureRead;
   extern bool          cacheTextureWrite;
+  extern ::std::string cacheTextureCompress; // none, snappy or zlib
+  extern bool          cacheTextureAsync;    // Write textures in the background
   extern ::std::string cacheDirectory;
 
   // Code dispatch
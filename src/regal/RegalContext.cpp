@@ -54,6 +54,7 @@ REGAL_GLOBAL_BEGIN
 #include "RegalDebugInfo.h"
 #include "RegalContextInfo.h"
 #include "RegalStatistics.h"
+#include "RegalRedundant.h"
 
 #include "RegalMarker.h"
 #include "RegalFrame.h"
@@ -89,6 +90,9 @@ RegalContext::RegalContext()
   info(NULL),
 #if REGAL_STATISTICS
   statistics(new Statistics()),
+#endif
+#if REGAL_REDUNDANT
+  redundant(new Redundant()),
 #endif
   marker(NULL),
 #if REGAL_FRAME
@@ -197,6 +201,7 @@ RegalContext::Init()
 #endif
   {
     // emu
+    dispatcher.setLookup(dispatcher.emulation,dispatcher.emulation);
     emuLevel = 16;
     {
       Emu::LayerInfo layer;
@@ -472,6 +477,11 @@ RegalContext::Init()
     }
     emuLevel = 16;
 
+    // Step past the emulation layer for calls no active layer acts on
+
+    InitDispatchTableEmuRoute(*this,dispatcher.emulationRoute);
+    dispatcher.setLookup(dispatcher.emulation,dispatcher.emulationRoute);
+
   }
 #endif
 
@@ -677,6 +687,11 @@ RegalContext::Cleanup()
   #endif /* REGAL_EMU_FILTER */
 #endif
 
+  #if REGAL_FRAME
+  if (frame)
+    frame->Cleanup(*this);
+  #endif /* REGAL_FRAME */
+
   initialized = false;
 }
 
@@ -68,6 +68,7 @@ REGAL_NAMESPACE_BEGIN
 struct EmuInfo;
 struct DebugInfo;
 struct Statistics;
+struct Redundant;
 
 struct Marker;
 struct Frame;
@@ -133,6 +134,10 @@ struct RegalContext
   scoped_ptr<Statistics>  statistics;
 #endif
 
+#if REGAL_REDUNDANT
+  scoped_ptr<Redundant>   redundant;
+#endif
+
   //
   // Emulation
   //
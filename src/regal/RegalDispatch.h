@@ -4491,7 +4491,8 @@ namespace Dispatch
       // Get the function pointer; extra cast through void* is to avoid -Wcast-align spew
       RegalAssert(i);
       RegalAssert(i->_enabled);
-      f = *reinterpret_cast<F *>(reinterpret_cast<void *>(reinterpret_cast<char *>(i)+offset));
+      T *lookup = i->_lookup ? static_cast<T *>(i->_lookup) : i;
+      f = *reinterpret_cast<F *>(reinterpret_cast<void *>(reinterpret_cast<char *>(lookup)+offset));
     }
 
     return f;
@@ -4504,6 +4505,7 @@ struct DispatchTable
   bool           _enabled;
   DispatchTable *_prev;
   DispatchTable *_next;
+  DispatchTable *_lookup;   // Entries read when stepping down the stack, NULL for this table
 };
 
 struct DispatchTableGL : public DispatchTable, Dispatch::GL
@@ -84,6 +84,28 @@ REGAL_NAMESPACE_BEGIN
 using namespace ::REGAL_NAMESPACE_INTERNAL::Logging;
 using namespace ::REGAL_NAMESPACE_INTERNAL::Token;
 
+// Emulation layers, for routing the emulation table
+
+enum EmuRoute
+{
+  EMU_ROUTE_OBJ    = 0x00001,
+  EMU_ROUTE_HINT   = 0x00002,
+  EMU_ROUTE_PPA    = 0x00004,
+  EMU_ROUTE_PPCA   = 0x00008,
+  EMU_ROUTE_BIN    = 0x00010,
+  EMU_ROUTE_XFER   = 0x00020,
+  EMU_ROUTE_TEXSTO = 0x00040,
+  EMU_ROUTE_BV     = 0x00080,
+  EMU_ROUTE_RECT   = 0x00100,
+  EMU_ROUTE_IFF    = 0x00200,
+  EMU_ROUTE_QUADS  = 0x00400,
+  EMU_ROUTE_SO     = 0x00800,
+  EMU_ROUTE_DSA    = 0x01000,
+  EMU_ROUTE_VAO    = 0x02000,
+  EMU_ROUTE_TEXC   = 0x04000,
+  EMU_ROUTE_FILT   = 0x08000
+};
+
 // GL_VERSION_1_0
 
 static void REGAL_CALL emu_glAccum(GLenum op, GLfloat value)
@@ -217,6 +239,7 @@ static void REGAL_CALL emu_glAlphaFunc(GLenum func, GLclampf ref)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->AlphaFunc( func, ref );
         return;
       }
@@ -326,6 +349,14 @@ static void REGAL_CALL emu_glBitmap(GLsizei width, GLsizei height, GLfloat xorig
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -405,6 +436,21 @@ static void REGAL_CALL emu_glBlendFunc(GLenum sfactor, GLenum dfactor)
         _context->ppa->glBlendFunc( sfactor, dfactor );
       }
       #endif
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -493,6 +539,43 @@ static void REGAL_CALL emu_glCallList(GLuint list)
 
 }
 
+static void REGAL_CALL emu_glClear(GLbitfield mask)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glClear)(mask);
+}
+
 static void REGAL_CALL emu_glClearAccum(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
@@ -520,6 +603,14 @@ static void REGAL_CALL emu_glClearAccum(GLfloat red, GLfloat green, GLfloat blue
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -599,6 +690,21 @@ static void REGAL_CALL emu_glClearColor(GLclampf red, GLclampf green, GLclampf b
         _context->ppa->glClearColor( red, green, blue, alpha );
       }
       #endif
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -629,6 +735,21 @@ static void REGAL_CALL emu_glClearDepth(GLclampd depth)
         _context->ppa->glClearDepth( depth );
       }
       #endif
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -662,6 +783,21 @@ static void REGAL_CALL emu_glClearIndex(GLfloat c)
         _context->ppa->glClearIndex( c );
       }
       #endif
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -692,6 +828,21 @@ static void REGAL_CALL emu_glClearStencil(GLint s)
         _context->ppa->glClearStencil( s );
       }
       #endif
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -755,6 +906,7 @@ static void REGAL_CALL emu_glClipPlane(GLenum plane, const GLdouble *equation)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->ClipPlane( plane, equation );
         return;
       }
@@ -2776,6 +2928,21 @@ static void REGAL_CALL emu_glColorMask(GLboolean red, GLboolean green, GLboolean
         _context->ppa->glColorMask( red, green, blue, alpha );
       }
       #endif
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -2839,6 +3006,7 @@ static void REGAL_CALL emu_glColorMaterial(GLenum face, GLenum mode)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->ColorMaterial( face, mode );
         return;
       }
@@ -2875,6 +3043,14 @@ static void REGAL_CALL emu_glCopyPixels(GLint x, GLint y, GLsizei width, GLsizei
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -2961,6 +3137,14 @@ static void REGAL_CALL emu_glCullFace(GLenum mode)
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
       #if REGAL_EMU_QUADS
       if (_context->quads)
@@ -3078,6 +3262,21 @@ static void REGAL_CALL emu_glDepthFunc(GLenum func)
         _context->ppa->glDepthFunc( func );
       }
       #endif
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -3108,6 +3307,21 @@ static void REGAL_CALL emu_glDepthMask(GLboolean flag)
         _context->ppa->glDepthMask( flag );
       }
       #endif
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -3150,6 +3364,7 @@ static void REGAL_CALL emu_glDepthRange(GLclampd near, GLclampd far)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->DepthRange( GLfloat(near), GLfloat(far) );
       }
       #endif
@@ -3260,6 +3475,7 @@ static void REGAL_CALL emu_glDisable(GLenum cap)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( ! _context->iff->ShadowDisable( cap ) ) {
             _context->dispatcher.emulation.glDisable( cap );
         }
@@ -3320,6 +3536,14 @@ static void REGAL_CALL emu_glDrawBuffer(GLenum buf)
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -3409,84 +3633,92 @@ static void REGAL_CALL emu_glDrawPixels(GLsizei width, GLsizei height, GLenum fo
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-    case 3 :
-    case 2 :
-    case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt) break;
-      #endif
-    default:
-      break;
-  }
-
-  // impl
-  switch( _context->emuLevel )
-  {
-    case 16 :
-    case 15 :
-    case 14 :
-    case 13 :
-    case 12 :
-    case 11 :
-    case 10 :
-    case 9 :
-    case 8 :
-    case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-    case 3 :
-    case 2 :
-    case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt)
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 0;
-        if (_context->isES2() || _context->isCore())
-        {
-           Warning("Regal does not support glDrawPixels for core or ES2 profiles - skipping.");
-           #if REGAL_BREAK
-           Break::Filter();
-           #endif
-           return ;
-        }
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
       }
       #endif
-    default:
-    {
-      DispatchTableGL *_next = _dispatch.next();
-      RegalAssert(_next);
-      _next->call(&_next->glDrawPixels)(width, height, format, type, pixels);
-      break;
-    }
-
-  }
-
-}
-
-static void REGAL_CALL emu_glEdgeFlag(GLboolean flag)
-{
-  RegalContext *_context = REGAL_GET_CONTEXT();
-  RegalAssert(_context);
-  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
-
-  // prefix
-  switch( _context->emuLevel )
-  {
-    case 16 :
-    case 15 :
-    case 14 :
-    case 13 :
-    case 12 :
-    case 11 :
-    case 10 :
-    case 9 :
-    case 8 :
-    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+    case 2 :
+    case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt) break;
+      #endif
+    default:
+      break;
+  }
+
+  // impl
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+    case 2 :
+    case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 0;
+        if (_context->isES2() || _context->isCore())
+        {
+           Warning("Regal does not support glDrawPixels for core or ES2 profiles - skipping.");
+           #if REGAL_BREAK
+           Break::Filter();
+           #endif
+           return ;
+        }
+      }
+      #endif
+    default:
+    {
+      DispatchTableGL *_next = _dispatch.next();
+      RegalAssert(_next);
+      _next->call(&_next->glDrawPixels)(width, height, format, type, pixels);
+      break;
+    }
+
+  }
+
+}
+
+static void REGAL_CALL emu_glEdgeFlag(GLboolean flag)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
     case 6 :
     case 5 :
     case 4 :
@@ -3640,6 +3872,7 @@ static void REGAL_CALL emu_glEnable(GLenum cap)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( ! _context->iff->ShadowEnable( cap ) ) {
             _context->dispatcher.emulation.glEnable( cap );
         }
@@ -4754,6 +4987,80 @@ static void REGAL_CALL emu_glEvalPoint2(GLint i, GLint j)
 
 }
 
+static void REGAL_CALL emu_glFinish(void)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glFinish)();
+}
+
+static void REGAL_CALL emu_glFlush(void)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glFlush)();
+}
+
 static void REGAL_CALL emu_glFogf(GLenum pname, GLfloat param)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
@@ -4766,6 +5073,14 @@ static void REGAL_CALL emu_glFogf(GLenum pname, GLfloat param)
     case 16 :
     case 15 :
     case 14 :
+      #if REGAL_EMU_PPA
+      if (_context->ppa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 13;
+        _context->ppa->glFog( pname, param );
+      }
+      #endif
     case 13 :
     case 12 :
     case 11 :
@@ -4799,6 +5114,7 @@ static void REGAL_CALL emu_glFogf(GLenum pname, GLfloat param)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->Fog( pname, param );
         return;
       }
@@ -4828,6 +5144,14 @@ static void REGAL_CALL emu_glFogfv(GLenum pname, const GLfloat *params)
     case 16 :
     case 15 :
     case 14 :
+      #if REGAL_EMU_PPA
+      if (_context->ppa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 13;
+        _context->ppa->glFogv( pname, params );
+      }
+      #endif
     case 13 :
     case 12 :
     case 11 :
@@ -4861,6 +5185,7 @@ static void REGAL_CALL emu_glFogfv(GLenum pname, const GLfloat *params)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->Fog( pname, params );
         return;
       }
@@ -4890,6 +5215,14 @@ static void REGAL_CALL emu_glFogi(GLenum pname, GLint param)
     case 16 :
     case 15 :
     case 14 :
+      #if REGAL_EMU_PPA
+      if (_context->ppa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 13;
+        _context->ppa->glFog( pname, param );
+      }
+      #endif
     case 13 :
     case 12 :
     case 11 :
@@ -4923,6 +5256,7 @@ static void REGAL_CALL emu_glFogi(GLenum pname, GLint param)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->Fog( pname, param );
         return;
       }
@@ -4952,6 +5286,14 @@ static void REGAL_CALL emu_glFogiv(GLenum pname, const GLint *params)
     case 16 :
     case 15 :
     case 14 :
+      #if REGAL_EMU_PPA
+      if (_context->ppa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 13;
+        _context->ppa->glFogv( pname, params );
+      }
+      #endif
     case 13 :
     case 12 :
     case 11 :
@@ -4985,6 +5327,7 @@ static void REGAL_CALL emu_glFogiv(GLenum pname, const GLint *params)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->Fog( pname, params );
         return;
       }
@@ -5029,6 +5372,14 @@ static void REGAL_CALL emu_glFrontFace(GLenum mode)
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
       #if REGAL_EMU_QUADS
       if (_context->quads)
@@ -5093,6 +5444,7 @@ static void REGAL_CALL emu_glFrustum(GLdouble left, GLdouble right, GLdouble bot
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->Frustum( left, right, bottom, top, zNear, zFar );
         return;
       }
@@ -6012,6 +6364,7 @@ static void REGAL_CALL emu_glGetMaterialfv(GLenum face, GLenum pname, GLfloat *p
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->GetMaterial( face, pname, params );
         return;
       }
@@ -6088,6 +6441,7 @@ static void REGAL_CALL emu_glGetMaterialiv(GLenum face, GLenum pname, GLint *par
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->GetMaterial( face, pname, params );
         return;
       }
@@ -6551,10 +6905,26 @@ static void REGAL_CALL emu_glGetTexImage(GLenum target, GLint level, GLenum form
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
     case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
+      }
+      #endif
     case 2 :
     case 1 :
       #if REGAL_EMU_FILTER
@@ -7109,6 +7479,21 @@ static void REGAL_CALL emu_glIndexMask(GLuint mask)
         _context->ppa->glIndexMask( mask );
       }
       #endif
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -7283,6 +7668,7 @@ static void REGAL_CALL emu_glLightModelf(GLenum pname, GLfloat param)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->LightModel( pname, param );
         return;
       }
@@ -7353,6 +7739,7 @@ static void REGAL_CALL emu_glLightModelfv(GLenum pname, const GLfloat *params)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->LightModel( pname, params );
         return;
       }
@@ -7423,6 +7810,7 @@ static void REGAL_CALL emu_glLightModeli(GLenum pname, GLint param)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->LightModel( pname, param );
         return;
       }
@@ -7493,6 +7881,7 @@ static void REGAL_CALL emu_glLightModeliv(GLenum pname, const GLint *params)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->LightModel( pname, params );
         return;
       }
@@ -7563,6 +7952,7 @@ static void REGAL_CALL emu_glLightf(GLenum light, GLenum pname, GLfloat param)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->Light( light, pname, param );
         return;
       }
@@ -7633,6 +8023,7 @@ static void REGAL_CALL emu_glLightfv(GLenum light, GLenum pname, const GLfloat *
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->Light( light, pname, params );
         return;
       }
@@ -7703,6 +8094,7 @@ static void REGAL_CALL emu_glLighti(GLenum light, GLenum pname, GLint param)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->Light( light, pname, param );
         return;
       }
@@ -7773,6 +8165,7 @@ static void REGAL_CALL emu_glLightiv(GLenum light, GLenum pname, const GLint *pa
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->Light( light, pname, params );
         return;
       }
@@ -7817,6 +8210,14 @@ static void REGAL_CALL emu_glLineStipple(GLint factor, GLushort pattern)
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -7903,6 +8304,14 @@ static void REGAL_CALL emu_glLineWidth(GLfloat width)
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -8048,6 +8457,7 @@ static void REGAL_CALL emu_glLoadIdentity(void)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->LoadIdentity(  );
         return;
       }
@@ -8121,6 +8531,7 @@ static void REGAL_CALL emu_glLoadMatrixd(const GLdouble *m)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->LoadMatrix( m );
         return;
       }
@@ -8194,6 +8605,7 @@ static void REGAL_CALL emu_glLoadMatrixf(const GLfloat *m)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->LoadMatrix( m );
         return;
       }
@@ -8231,6 +8643,21 @@ static void REGAL_CALL emu_glLogicOp(GLenum opcode)
         _context->ppa->glLogicOp( opcode );
       }
       #endif
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -8950,6 +9377,7 @@ static void REGAL_CALL emu_glMaterialf(GLenum face, GLenum pname, GLfloat param)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->Material( face, pname, param );
         return;
       }
@@ -9020,6 +9448,7 @@ static void REGAL_CALL emu_glMaterialfv(GLenum face, GLenum pname, const GLfloat
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->Material( face, pname, params );
         return;
       }
@@ -9090,6 +9519,7 @@ static void REGAL_CALL emu_glMateriali(GLenum face, GLenum pname, GLint param)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->Material( face, pname, param );
         return;
       }
@@ -9160,6 +9590,7 @@ static void REGAL_CALL emu_glMaterialiv(GLenum face, GLenum pname, const GLint *
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->Material( face, pname, params );
         return;
       }
@@ -9236,6 +9667,7 @@ static void REGAL_CALL emu_glMatrixMode(GLenum mode)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( ! _context->iff->ShadowMatrixMode( mode ) ) {
             _context->dispatcher.emulation.glMatrixMode( mode );
         }
@@ -9325,6 +9757,7 @@ static void REGAL_CALL emu_glMultMatrixd(const GLdouble *m)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->MultMatrix( m );
         return;
       }
@@ -9398,6 +9831,7 @@ static void REGAL_CALL emu_glMultMatrixf(const GLfloat *m)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->MultMatrix( m );
         return;
       }
@@ -10158,6 +10592,7 @@ static void REGAL_CALL emu_glOrtho(GLdouble left, GLdouble right, GLdouble botto
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->Ortho( left, right, bottom, top, zNear, zFar );
         return;
       }
@@ -10648,6 +11083,21 @@ static void REGAL_CALL emu_glPointSize(GLfloat size)
         _context->ppa->glPointSize( size );
       }
       #endif
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -10685,6 +11135,14 @@ static void REGAL_CALL emu_glPolygonMode(GLenum face, GLenum mode)
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
       #if REGAL_EMU_QUADS
       if (_context->quads)
@@ -10771,6 +11229,21 @@ static void REGAL_CALL emu_glPolygonStipple(const GLubyte *mask)
         _context->ppa->glPolygonStipple( mask );
       }
       #endif
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -10885,6 +11358,7 @@ static void REGAL_CALL emu_glPopMatrix(void)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->PopMatrix(  );
         return;
       }
@@ -11006,6 +11480,7 @@ static void REGAL_CALL emu_glPushMatrix(void)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->PushMatrix(  );
         return;
       }
@@ -11076,6 +11551,7 @@ static void REGAL_CALL emu_glRasterPos2d(GLdouble x, GLdouble y)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->RasterPosition( _context, x, y );
         return;
       }
@@ -11244,6 +11720,7 @@ static void REGAL_CALL emu_glRasterPos2f(GLfloat x, GLfloat y)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->RasterPosition( _context, x, y );
         return;
       }
@@ -11412,6 +11889,7 @@ static void REGAL_CALL emu_glRasterPos2i(GLint x, GLint y)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->RasterPosition( _context, x, y );
         return;
       }
@@ -11580,6 +12058,7 @@ static void REGAL_CALL emu_glRasterPos2s(GLshort x, GLshort y)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->RasterPosition( _context, x, y );
         return;
       }
@@ -11748,6 +12227,7 @@ static void REGAL_CALL emu_glRasterPos3d(GLdouble x, GLdouble y, GLdouble z)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->RasterPosition( _context, x, y, z );
         return;
       }
@@ -11916,6 +12396,7 @@ static void REGAL_CALL emu_glRasterPos3f(GLfloat x, GLfloat y, GLfloat z)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->RasterPosition( _context, x, y, z );
         return;
       }
@@ -12084,6 +12565,7 @@ static void REGAL_CALL emu_glRasterPos3i(GLint x, GLint y, GLint z)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->RasterPosition( _context, x, y, z );
         return;
       }
@@ -12252,6 +12734,7 @@ static void REGAL_CALL emu_glRasterPos3s(GLshort x, GLshort y, GLshort z)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->RasterPosition( _context, x, y, z );
         return;
       }
@@ -13018,6 +13501,14 @@ static void REGAL_CALL emu_glReadBuffer(GLenum mode)
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -13083,6 +13574,55 @@ static void REGAL_CALL emu_glReadBuffer(GLenum mode)
 
 }
 
+static void REGAL_CALL emu_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLvoid *pixels)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glReadPixels)(x, y, width, height, format, type, pixels);
+}
+
 static void REGAL_CALL emu_glRectd(GLdouble x1, GLdouble y1, GLdouble x2, GLdouble y2)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
@@ -13815,6 +14355,7 @@ static void REGAL_CALL emu_glRotated(GLdouble angle, GLdouble x, GLdouble y, GLd
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->Rotate( angle, x, y, z );
         return;
       }
@@ -13888,6 +14429,7 @@ static void REGAL_CALL emu_glRotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloa
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->Rotate( angle, x, y, z );
         return;
       }
@@ -13961,6 +14503,7 @@ static void REGAL_CALL emu_glScaled(GLdouble x, GLdouble y, GLdouble z)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->Scale( x, y, z );
         return;
       }
@@ -14034,6 +14577,7 @@ static void REGAL_CALL emu_glScalef(GLfloat x, GLfloat y, GLfloat z)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->Scale( x, y, z );
         return;
       }
@@ -14071,6 +14615,21 @@ static void REGAL_CALL emu_glScissor(GLint x, GLint y, GLsizei width, GLsizei he
         _context->ppa->glScissor( x, y, width, height );
       }
       #endif
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -14150,6 +14709,7 @@ static void REGAL_CALL emu_glShadeModel(GLenum mode)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->ShadeModel( mode );
         if( !_context->isCore() && !_context->isES2() ) {
           _context->dispatcher.emulation.glShadeModel(mode);
@@ -14210,6 +14770,21 @@ static void REGAL_CALL emu_glStencilFunc(GLenum func, GLint ref, GLuint mask)
         _context->ppa->glStencilFunc( func, ref, mask );
       }
       #endif
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -14240,6 +14815,21 @@ static void REGAL_CALL emu_glStencilMask(GLuint mask)
         _context->ppa->glStencilMask( mask );
       }
       #endif
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -14270,6 +14860,21 @@ static void REGAL_CALL emu_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass)
         _context->ppa->glStencilOp( fail, zfail, zpass );
       }
       #endif
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -16329,6 +16934,7 @@ static void REGAL_CALL emu_glTexEnvf(GLenum target, GLenum pname, GLfloat param)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->TexEnv( target, pname, param );
         return;
       }
@@ -16411,6 +17017,7 @@ static void REGAL_CALL emu_glTexEnvfv(GLenum target, GLenum pname, const GLfloat
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->TexEnv( target, pname, params );
         return;
       }
@@ -16493,6 +17100,7 @@ static void REGAL_CALL emu_glTexEnvi(GLenum target, GLenum pname, GLint param)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->TexEnv( target, pname, param );
         return;
       }
@@ -16575,6 +17183,7 @@ static void REGAL_CALL emu_glTexEnviv(GLenum target, GLenum pname, const GLint *
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->TexEnv( target, pname, params );
         return;
       }
@@ -16637,6 +17246,7 @@ static void REGAL_CALL emu_glTexGend(GLenum coord, GLenum pname, GLdouble param)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if ( ! _context->iff->TexGen( coord, pname, param ) ) {
             _context->dispatcher.emulation.glTexGend( coord, pname, param );
         }
@@ -16701,6 +17311,7 @@ static void REGAL_CALL emu_glTexGendv(GLenum coord, GLenum pname, const GLdouble
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if ( ! _context->iff->TexGen( coord, pname, params ) ) {
             _context->dispatcher.emulation.glTexGendv( coord, pname, params );
         }
@@ -16776,6 +17387,7 @@ static void REGAL_CALL emu_glTexGenf(GLenum coord, GLenum pname, GLfloat param)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if ( ! _context->iff->TexGen( coord, pname, param ) ) {
             _context->dispatcher.emulation.glTexGenf( coord, pname, param );
         }
@@ -16851,6 +17463,7 @@ static void REGAL_CALL emu_glTexGenfv(GLenum coord, GLenum pname, const GLfloat
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if ( ! _context->iff->TexGen( coord, pname, params ) ) {
             _context->dispatcher.emulation.glTexGenfv( coord, pname, params );
         }
@@ -16926,6 +17539,7 @@ static void REGAL_CALL emu_glTexGeni(GLenum coord, GLenum pname, GLint param)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if ( ! _context->iff->TexGen( coord, pname, param ) ) {
             _context->dispatcher.emulation.glTexGeni( coord, pname, param );
         }
@@ -17001,6 +17615,7 @@ static void REGAL_CALL emu_glTexGeniv(GLenum coord, GLenum pname, const GLint *p
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if ( ! _context->iff->TexGen( coord, pname, params ) ) {
             _context->dispatcher.emulation.glTexGeniv( coord, pname, params );
         }
@@ -17044,6 +17659,7 @@ static void REGAL_CALL emu_glTexImage1D(GLenum target, GLint level, GLint intern
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->ShadowTexInfo( target, internalformat );
       }
       #endif
@@ -17133,6 +17749,7 @@ static void REGAL_CALL emu_glTexImage2D(GLenum target, GLint level, GLint intern
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->ShadowTexInfo( target, internalformat );
       }
       #endif
@@ -17230,6 +17847,14 @@ static void REGAL_CALL emu_glTexParameterf(GLenum target, GLenum pname, GLfloat
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
       #if REGAL_EMU_SO
@@ -17335,6 +17960,14 @@ static void REGAL_CALL emu_glTexParameterfv(GLenum target, GLenum pname, const G
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
       #if REGAL_EMU_SO
@@ -17440,6 +18073,14 @@ static void REGAL_CALL emu_glTexParameteri(GLenum target, GLenum pname, GLint pa
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
       #if REGAL_EMU_SO
@@ -17545,6 +18186,14 @@ static void REGAL_CALL emu_glTexParameteriv(GLenum target, GLenum pname, const G
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
       #if REGAL_EMU_SO
@@ -17687,6 +18336,7 @@ static void REGAL_CALL emu_glTranslated(GLdouble x, GLdouble y, GLdouble z)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->Translate( x, y, z );
         return;
       }
@@ -17760,6 +18410,7 @@ static void REGAL_CALL emu_glTranslatef(GLfloat x, GLfloat y, GLfloat z)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->Translate( x, y, z );
         return;
       }
@@ -19297,6 +19948,7 @@ static void REGAL_CALL emu_glViewport(GLint x, GLint y, GLsizei width, GLsizei h
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->Viewport( x, y, width, height );
       }
       #endif
@@ -19401,6 +20053,7 @@ static void REGAL_CALL emu_glBindTexture(GLenum target, GLuint texture)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->ShadowTexBinding( target, texture );
       }
       #endif
@@ -19594,6 +20247,7 @@ static void REGAL_CALL emu_glColorPointer(GLint size, GLenum type, GLsizei strid
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
         _context->iff->ColorPointer( _context, size, type, stride, pointer );
         return;
       }
@@ -19624,6 +20278,43 @@ static void REGAL_CALL emu_glColorPointer(GLint size, GLenum type, GLsizei strid
 
 }
 
+static void REGAL_CALL emu_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glCopyTexImage1D)(target, level, internalformat, x, y, width, border);
+}
+
 static void REGAL_CALL emu_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
@@ -19648,6 +20339,7 @@ static void REGAL_CALL emu_glCopyTexImage2D(GLenum target, GLint level, GLenum i
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->ShadowTexInfo( target, internalformat );
       }
       #endif
@@ -19661,6 +20353,80 @@ static void REGAL_CALL emu_glCopyTexImage2D(GLenum target, GLint level, GLenum i
   _next->call(& _next->glCopyTexImage2D)(target, level, internalformat, x, y, width, height, border);
 }
 
+static void REGAL_CALL emu_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glCopyTexSubImage1D)(target, level, xoffset, x, y, width);
+}
+
+static void REGAL_CALL emu_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glCopyTexSubImage2D)(target, level, xoffset, yoffset, x, y, width, height);
+}
+
 static void REGAL_CALL emu_glDeleteTextures(GLsizei n, const GLuint *textures)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
@@ -19692,6 +20458,14 @@ static void REGAL_CALL emu_glDeleteTextures(GLsizei n, const GLuint *textures)
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
       #if REGAL_EMU_SO
@@ -19830,6 +20604,7 @@ static void REGAL_CALL emu_glDisableClientState(GLenum array)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
         _context->iff->DisableClientState( _context, array );
         return;
       }
@@ -19884,6 +20659,7 @@ static void REGAL_CALL emu_glDrawArrays(GLenum mode, GLint first, GLsizei count)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
         _context->iff->PreDraw( _context );
       }
       #endif
@@ -19910,6 +20686,15 @@ static void REGAL_CALL emu_glDrawArrays(GLenum mode, GLint first, GLsizei count)
         _context->dsa->Restore( _context );
       }
       #endif
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->DrawArrays(*_context, first, count );
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -19979,6 +20764,7 @@ static void REGAL_CALL emu_glDrawElements(GLenum mode, GLsizei count, GLenum typ
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
         _context->iff->PreDraw( _context );
       }
       #endif
@@ -20002,14 +20788,54 @@ static void REGAL_CALL emu_glDrawElements(GLenum mode, GLsizei count, GLenum typ
         _context->dsa->Restore( _context );
       }
       #endif
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao) break;
+      #endif
     case 1 :
     default:
       break;
   }
 
-  DispatchTableGL *_next = _dispatch.next();
-  RegalAssert(_next);
-  _next->call(& _next->glDrawElements)(mode, count, type, indices);
+  // impl
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        if ( !_context->vao->DrawElements(*_context, mode, count, type, indices ) ) {
+           _context->dispatcher.emulation.glDrawElements( mode, count, type, indices );
+        }
+        return;
+      }
+      #endif
+    case 1 :
+    default:
+    {
+      DispatchTableGL *_next = _dispatch.next();
+      RegalAssert(_next);
+      _next->call(&_next->glDrawElements)(mode, count, type, indices);
+      break;
+    }
+
+  }
+
 }
 
 static void REGAL_CALL emu_glEdgeFlagPointer(GLsizei stride, const GLvoid *pointer)
@@ -20073,6 +20899,7 @@ static void REGAL_CALL emu_glEdgeFlagPointer(GLsizei stride, const GLvoid *point
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
         _context->iff->EdgeFlagPointer( _context, stride, pointer );
         return;
       }
@@ -20167,6 +20994,7 @@ static void REGAL_CALL emu_glEnableClientState(GLenum array)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
         _context->iff->EnableClientState( _context, array );
         return;
       }
@@ -20543,6 +21371,7 @@ static void REGAL_CALL emu_glNormalPointer(GLenum type, GLsizei stride, const GL
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
         _context->iff->NormalPointer( _context, type, stride, pointer );
         return;
       }
@@ -20593,6 +21422,21 @@ static void REGAL_CALL emu_glPolygonOffset(GLfloat factor, GLfloat units)
         _context->ppa->glPolygonOffset( factor, units );
       }
       #endif
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -20780,6 +21624,7 @@ static void REGAL_CALL emu_glTexCoordPointer(GLint size, GLenum type, GLsizei st
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
         _context->iff->TexCoordPointer( _context, size, type, stride, pointer );
         return;
       }
@@ -20810,6 +21655,43 @@ static void REGAL_CALL emu_glTexCoordPointer(GLint size, GLenum type, GLsizei st
 
 }
 
+static void REGAL_CALL emu_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const GLvoid *pixels)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glTexSubImage1D)(target, level, xoffset, width, format, type, pixels);
+}
+
 static void REGAL_CALL emu_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid *pixels)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
@@ -20832,6 +21714,14 @@ static void REGAL_CALL emu_glTexSubImage2D(GLenum target, GLint level, GLint xof
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -21001,6 +21891,7 @@ static void REGAL_CALL emu_glVertexPointer(GLint size, GLenum type, GLsizei stri
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
         _context->iff->VertexPointer( _context, size, type, stride, pointer );
         return;
       }
@@ -21033,6 +21924,43 @@ static void REGAL_CALL emu_glVertexPointer(GLint size, GLenum type, GLsizei stri
 
 // GL_VERSION_1_2
 
+static void REGAL_CALL emu_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glCopyTexSubImage3D)(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+
 static void REGAL_CALL emu_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const GLvoid *indices)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
@@ -21057,6 +21985,7 @@ static void REGAL_CALL emu_glDrawRangeElements(GLenum mode, GLuint start, GLuint
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
         _context->iff->PreDraw( _context );
       }
       #endif
@@ -21073,6 +22002,9 @@ static void REGAL_CALL emu_glDrawRangeElements(GLenum mode, GLuint start, GLuint
       #endif
     case 4 :
     case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao) break;
+      #endif
     case 2 :
     case 1 :
       #if REGAL_EMU_FILTER
@@ -21099,6 +22031,17 @@ static void REGAL_CALL emu_glDrawRangeElements(GLenum mode, GLuint start, GLuint
     case 5 :
     case 4 :
     case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        if ( !_context->vao->DrawRangeElements(*_context, mode, start, end, count, type, indices ) ) {
+           _context->dispatcher.emulation.glDrawRangeElements( mode, start, end, count, type, indices );
+        }
+        return;
+      }
+      #endif
     case 2 :
     case 1 :
       #if REGAL_EMU_FILTER
@@ -21150,6 +22093,7 @@ static void REGAL_CALL emu_glTexImage3D(GLenum target, GLint level, GLint intern
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->ShadowTexInfo( target, internalformat );
       }
       #endif
@@ -21212,6 +22156,43 @@ static void REGAL_CALL emu_glTexImage3D(GLenum target, GLint level, GLint intern
 
 }
 
+static void REGAL_CALL emu_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const GLvoid *pixels)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glTexSubImage3D)(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+
 // GL_VERSION_1_3
 
 static void REGAL_CALL emu_glActiveTexture(GLenum texture)
@@ -21457,6 +22438,43 @@ static void REGAL_CALL emu_glClientActiveTexture(GLenum texture)
 
 }
 
+static void REGAL_CALL emu_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const GLvoid *data)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glCompressedTexImage1D)(target, level, internalformat, width, border, imageSize, data);
+}
+
 static void REGAL_CALL emu_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const GLvoid *data)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
@@ -21475,6 +22493,18 @@ static void REGAL_CALL emu_glCompressedTexImage2D(GLenum target, GLint level, GL
       #if REGAL_EMU_XFER
       if (_context->xfer) break;
       #endif
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -21511,6 +22541,80 @@ static void REGAL_CALL emu_glCompressedTexImage2D(GLenum target, GLint level, GL
 
 }
 
+static void REGAL_CALL emu_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const GLvoid *data)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glCompressedTexImage3D)(target, level, internalformat, width, height, depth, border, imageSize, data);
+}
+
+static void REGAL_CALL emu_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const GLvoid *data)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glCompressedTexSubImage1D)(target, level, xoffset, width, format, imageSize, data);
+}
+
 static void REGAL_CALL emu_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const GLvoid *data)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
@@ -21529,6 +22633,18 @@ static void REGAL_CALL emu_glCompressedTexSubImage2D(GLenum target, GLint level,
       #if REGAL_EMU_XFER
       if (_context->xfer) break;
       #endif
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -21565,7 +22681,7 @@ static void REGAL_CALL emu_glCompressedTexSubImage2D(GLenum target, GLint level,
 
 }
 
-static void REGAL_CALL emu_glLoadTransposeMatrixd(const GLdouble *m)
+static void REGAL_CALL emu_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const GLvoid *data)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -21573,38 +22689,6 @@ static void REGAL_CALL emu_glLoadTransposeMatrixd(const GLdouble *m)
 
   // prefix
   switch( _context->emuLevel )
-  {
-    case 16 :
-    case 15 :
-    case 14 :
-    case 13 :
-    case 12 :
-    case 11 :
-    case 10 :
-    case 9 :
-    case 8 :
-    case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff) break;
-      #endif
-    case 6 :
-    case 5 :
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        _context->dsa->RestoreMatrixMode( _context );
-      }
-      #endif
-    case 1 :
-    default:
-      break;
-  }
-
-  // impl
-  switch( _context->emuLevel )
   {
     case 16 :
     case 15 :
@@ -21621,24 +22705,20 @@ static void REGAL_CALL emu_glLoadTransposeMatrixd(const GLdouble *m)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->LoadTransposeMatrix( m );
-        return;
+        _context->iff->FlushBatch( _context );
       }
       #endif
     case 1 :
     default:
-    {
-      DispatchTableGL *_next = _dispatch.next();
-      RegalAssert(_next);
-      _next->call(&_next->glLoadTransposeMatrixd)(m);
       break;
-    }
-
   }
 
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glCompressedTexSubImage3D)(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
 }
 
-static void REGAL_CALL emu_glLoadTransposeMatrixf(const GLfloat *m)
+static void REGAL_CALL emu_glGetCompressedTexImage(GLenum target, GLint level, GLvoid *img)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -21658,60 +22738,36 @@ static void REGAL_CALL emu_glLoadTransposeMatrixf(const GLfloat *m)
     case 8 :
     case 7 :
       #if REGAL_EMU_IFF
-      if (_context->iff) break;
-      #endif
-    case 6 :
-    case 5 :
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        _context->dsa->RestoreMatrixMode( _context );
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
       }
       #endif
-    case 1 :
-    default:
-      break;
-  }
-
-  // impl
-  switch( _context->emuLevel )
-  {
-    case 16 :
-    case 15 :
-    case 14 :
-    case 13 :
-    case 12 :
-    case 11 :
-    case 10 :
-    case 9 :
-    case 8 :
-    case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff)
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 6;
-        _context->iff->LoadTransposeMatrix( m );
-        return;
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
       }
       #endif
     case 1 :
     default:
-    {
-      DispatchTableGL *_next = _dispatch.next();
-      RegalAssert(_next);
-      _next->call(&_next->glLoadTransposeMatrixf)(m);
       break;
-    }
-
   }
 
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glGetCompressedTexImage)(target, level, img);
 }
 
-static void REGAL_CALL emu_glMultTransposeMatrixd(const GLdouble *m)
+static void REGAL_CALL emu_glLoadTransposeMatrixd(const GLdouble *m)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -21767,7 +22823,8 @@ static void REGAL_CALL emu_glMultTransposeMatrixd(const GLdouble *m)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->MultTransposeMatrix( m );
+        _context->iff->FlushBatch( _context );
+        _context->iff->LoadTransposeMatrix( m );
         return;
       }
       #endif
@@ -21776,7 +22833,7 @@ static void REGAL_CALL emu_glMultTransposeMatrixd(const GLdouble *m)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultTransposeMatrixd)(m);
+      _next->call(&_next->glLoadTransposeMatrixd)(m);
       break;
     }
 
@@ -21784,7 +22841,7 @@ static void REGAL_CALL emu_glMultTransposeMatrixd(const GLdouble *m)
 
 }
 
-static void REGAL_CALL emu_glMultTransposeMatrixf(const GLfloat *m)
+static void REGAL_CALL emu_glLoadTransposeMatrixf(const GLfloat *m)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -21840,7 +22897,8 @@ static void REGAL_CALL emu_glMultTransposeMatrixf(const GLfloat *m)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->MultTransposeMatrix( m );
+        _context->iff->FlushBatch( _context );
+        _context->iff->LoadTransposeMatrix( m );
         return;
       }
       #endif
@@ -21849,7 +22907,7 @@ static void REGAL_CALL emu_glMultTransposeMatrixf(const GLfloat *m)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultTransposeMatrixf)(m);
+      _next->call(&_next->glLoadTransposeMatrixf)(m);
       break;
     }
 
@@ -21857,7 +22915,7 @@ static void REGAL_CALL emu_glMultTransposeMatrixf(const GLfloat *m)
 
 }
 
-static void REGAL_CALL emu_glMultiTexCoord1d(GLenum target, GLdouble s)
+static void REGAL_CALL emu_glMultTransposeMatrixd(const GLdouble *m)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -21879,69 +22937,18 @@ static void REGAL_CALL emu_glMultiTexCoord1d(GLenum target, GLdouble s)
       #if REGAL_EMU_IFF
       if (_context->iff) break;
       #endif
-    case 1 :
-    default:
-      break;
-  }
-
-  // impl
-  switch( _context->emuLevel )
-  {
-    case 16 :
-    case 15 :
-    case 14 :
-    case 13 :
-    case 12 :
-    case 11 :
-    case 10 :
-    case 9 :
-    case 8 :
-    case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff)
+    case 6 :
+    case 5 :
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 6;
-        _context->iff->Attr<1>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), s );
-        return;
+        _context->emuLevel = 3;
+        _context->dsa->RestoreMatrixMode( _context );
       }
       #endif
     case 1 :
-    default:
-    {
-      DispatchTableGL *_next = _dispatch.next();
-      RegalAssert(_next);
-      _next->call(&_next->glMultiTexCoord1d)(target, s);
-      break;
-    }
-
-  }
-
-}
-
-static void REGAL_CALL emu_glMultiTexCoord1dv(GLenum target, const GLdouble *v)
-{
-  RegalContext *_context = REGAL_GET_CONTEXT();
-  RegalAssert(_context);
-  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
-
-  // prefix
-  switch( _context->emuLevel )
-  {
-    case 16 :
-    case 15 :
-    case 14 :
-    case 13 :
-    case 12 :
-    case 11 :
-    case 10 :
-    case 9 :
-    case 8 :
-    case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff) break;
-      #endif
-    case 1 :
     default:
       break;
   }
@@ -21964,7 +22971,8 @@ static void REGAL_CALL emu_glMultiTexCoord1dv(GLenum target, const GLdouble *v)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->Attr<1>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), v );
+        _context->iff->FlushBatch( _context );
+        _context->iff->MultTransposeMatrix( m );
         return;
       }
       #endif
@@ -21973,7 +22981,7 @@ static void REGAL_CALL emu_glMultiTexCoord1dv(GLenum target, const GLdouble *v)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexCoord1dv)(target, v);
+      _next->call(&_next->glMultTransposeMatrixd)(m);
       break;
     }
 
@@ -21981,7 +22989,7 @@ static void REGAL_CALL emu_glMultiTexCoord1dv(GLenum target, const GLdouble *v)
 
 }
 
-static void REGAL_CALL emu_glMultiTexCoord1f(GLenum target, GLfloat s)
+static void REGAL_CALL emu_glMultTransposeMatrixf(const GLfloat *m)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -22003,69 +23011,18 @@ static void REGAL_CALL emu_glMultiTexCoord1f(GLenum target, GLfloat s)
       #if REGAL_EMU_IFF
       if (_context->iff) break;
       #endif
-    case 1 :
-    default:
-      break;
-  }
-
-  // impl
-  switch( _context->emuLevel )
-  {
-    case 16 :
-    case 15 :
-    case 14 :
-    case 13 :
-    case 12 :
-    case 11 :
-    case 10 :
-    case 9 :
-    case 8 :
-    case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff)
+    case 6 :
+    case 5 :
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 6;
-        _context->iff->Attr<1>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), s );
-        return;
+        _context->emuLevel = 3;
+        _context->dsa->RestoreMatrixMode( _context );
       }
       #endif
     case 1 :
-    default:
-    {
-      DispatchTableGL *_next = _dispatch.next();
-      RegalAssert(_next);
-      _next->call(&_next->glMultiTexCoord1f)(target, s);
-      break;
-    }
-
-  }
-
-}
-
-static void REGAL_CALL emu_glMultiTexCoord1fv(GLenum target, const GLfloat *v)
-{
-  RegalContext *_context = REGAL_GET_CONTEXT();
-  RegalAssert(_context);
-  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
-
-  // prefix
-  switch( _context->emuLevel )
-  {
-    case 16 :
-    case 15 :
-    case 14 :
-    case 13 :
-    case 12 :
-    case 11 :
-    case 10 :
-    case 9 :
-    case 8 :
-    case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff) break;
-      #endif
-    case 1 :
     default:
       break;
   }
@@ -22088,7 +23045,8 @@ static void REGAL_CALL emu_glMultiTexCoord1fv(GLenum target, const GLfloat *v)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->Attr<1>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), v );
+        _context->iff->FlushBatch( _context );
+        _context->iff->MultTransposeMatrix( m );
         return;
       }
       #endif
@@ -22097,7 +23055,7 @@ static void REGAL_CALL emu_glMultiTexCoord1fv(GLenum target, const GLfloat *v)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexCoord1fv)(target, v);
+      _next->call(&_next->glMultTransposeMatrixf)(m);
       break;
     }
 
@@ -22105,7 +23063,7 @@ static void REGAL_CALL emu_glMultiTexCoord1fv(GLenum target, const GLfloat *v)
 
 }
 
-static void REGAL_CALL emu_glMultiTexCoord1i(GLenum target, GLint s)
+static void REGAL_CALL emu_glMultiTexCoord1d(GLenum target, GLdouble s)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -22159,7 +23117,7 @@ static void REGAL_CALL emu_glMultiTexCoord1i(GLenum target, GLint s)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexCoord1i)(target, s);
+      _next->call(&_next->glMultiTexCoord1d)(target, s);
       break;
     }
 
@@ -22167,7 +23125,7 @@ static void REGAL_CALL emu_glMultiTexCoord1i(GLenum target, GLint s)
 
 }
 
-static void REGAL_CALL emu_glMultiTexCoord1iv(GLenum target, const GLint *v)
+static void REGAL_CALL emu_glMultiTexCoord1dv(GLenum target, const GLdouble *v)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -22221,7 +23179,7 @@ static void REGAL_CALL emu_glMultiTexCoord1iv(GLenum target, const GLint *v)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexCoord1iv)(target, v);
+      _next->call(&_next->glMultiTexCoord1dv)(target, v);
       break;
     }
 
@@ -22229,7 +23187,255 @@ static void REGAL_CALL emu_glMultiTexCoord1iv(GLenum target, const GLint *v)
 
 }
 
-static void REGAL_CALL emu_glMultiTexCoord1s(GLenum target, GLshort s)
+static void REGAL_CALL emu_glMultiTexCoord1f(GLenum target, GLfloat s)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff) break;
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  // impl
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->Attr<1>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), s );
+        return;
+      }
+      #endif
+    case 1 :
+    default:
+    {
+      DispatchTableGL *_next = _dispatch.next();
+      RegalAssert(_next);
+      _next->call(&_next->glMultiTexCoord1f)(target, s);
+      break;
+    }
+
+  }
+
+}
+
+static void REGAL_CALL emu_glMultiTexCoord1fv(GLenum target, const GLfloat *v)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff) break;
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  // impl
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->Attr<1>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), v );
+        return;
+      }
+      #endif
+    case 1 :
+    default:
+    {
+      DispatchTableGL *_next = _dispatch.next();
+      RegalAssert(_next);
+      _next->call(&_next->glMultiTexCoord1fv)(target, v);
+      break;
+    }
+
+  }
+
+}
+
+static void REGAL_CALL emu_glMultiTexCoord1i(GLenum target, GLint s)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff) break;
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  // impl
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->Attr<1>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), s );
+        return;
+      }
+      #endif
+    case 1 :
+    default:
+    {
+      DispatchTableGL *_next = _dispatch.next();
+      RegalAssert(_next);
+      _next->call(&_next->glMultiTexCoord1i)(target, s);
+      break;
+    }
+
+  }
+
+}
+
+static void REGAL_CALL emu_glMultiTexCoord1iv(GLenum target, const GLint *v)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff) break;
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  // impl
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->Attr<1>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), v );
+        return;
+      }
+      #endif
+    case 1 :
+    default:
+    {
+      DispatchTableGL *_next = _dispatch.next();
+      RegalAssert(_next);
+      _next->call(&_next->glMultiTexCoord1iv)(target, v);
+      break;
+    }
+
+  }
+
+}
+
+static void REGAL_CALL emu_glMultiTexCoord1s(GLenum target, GLshort s)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -23861,6 +25067,21 @@ static void REGAL_CALL emu_glSampleCoverage(GLclampf value, GLboolean invert)
         _context->ppa->glSampleCoverage( value, invert );
       }
       #endif
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -23893,6 +25114,21 @@ static void REGAL_CALL emu_glBlendColor(GLclampf red, GLclampf green, GLclampf b
         _context->ppa->glBlendColor( red, green, blue, alpha );
       }
       #endif
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -23923,6 +25159,21 @@ static void REGAL_CALL emu_glBlendEquation(GLenum mode)
         _context->ppa->glBlendEquation( mode );
       }
       #endif
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -23953,6 +25204,21 @@ static void REGAL_CALL emu_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactor
         _context->ppa->glBlendFuncSeparate( sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha );
       }
       #endif
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -24031,6 +25297,7 @@ static void REGAL_CALL emu_glFogCoordPointer(GLenum type, GLsizei stride, const
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
         _context->iff->FogCoordPointer( _context, type, stride, pointer );
         return;
       }
@@ -24085,6 +25352,7 @@ static void REGAL_CALL emu_glMultiDrawArrays(GLenum mode, const GLint *first, co
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
         _context->iff->PreDraw( _context );
       }
       #endif
@@ -24108,6 +25376,15 @@ static void REGAL_CALL emu_glMultiDrawArrays(GLenum mode, const GLint *first, co
         _context->dsa->Restore( _context );
       }
       #endif
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->MultiDrawArrays(*_context, first, count, drawcount );
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -24142,6 +25419,7 @@ static void REGAL_CALL emu_glMultiDrawElements(GLenum mode, const GLsizei *count
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
         _context->iff->PreDraw( _context );
       }
       #endif
@@ -24165,47 +25443,57 @@ static void REGAL_CALL emu_glMultiDrawElements(GLenum mode, const GLsizei *count
         _context->dsa->Restore( _context );
       }
       #endif
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao) break;
+      #endif
     case 1 :
     default:
       break;
   }
 
-  DispatchTableGL *_next = _dispatch.next();
-  RegalAssert(_next);
-  _next->call(& _next->glMultiDrawElements)(mode, count, type, indices, drawcount);
-}
-
-static void REGAL_CALL emu_glPointParameterf(GLenum pname, GLfloat param)
-{
-  RegalContext *_context = REGAL_GET_CONTEXT();
-  RegalAssert(_context);
-  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
-
-  // prefix
+  // impl
   switch( _context->emuLevel )
   {
     case 16 :
     case 15 :
     case 14 :
-      #if REGAL_EMU_PPA
-      if (_context->ppa)
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 13;
-        _context->ppa->glPointParameter( pname, param );
+        _context->emuLevel = 2;
+        if ( !_context->vao->MultiDrawElements(*_context, mode, count, type, indices, drawcount ) ) {
+           _context->dispatcher.emulation.glMultiDrawElements( mode, count, type, indices, drawcount );
+        }
+        return;
       }
       #endif
     case 1 :
     default:
+    {
+      DispatchTableGL *_next = _dispatch.next();
+      RegalAssert(_next);
+      _next->call(&_next->glMultiDrawElements)(mode, count, type, indices, drawcount);
       break;
+    }
+
   }
 
-  DispatchTableGL *_next = _dispatch.next();
-  RegalAssert(_next);
-  _next->call(& _next->glPointParameterf)(pname, param);
 }
 
-static void REGAL_CALL emu_glPointParameterfv(GLenum pname, const GLfloat *params)
+static void REGAL_CALL emu_glPointParameterf(GLenum pname, GLfloat param)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -24222,7 +25510,22 @@ static void REGAL_CALL emu_glPointParameterfv(GLenum pname, const GLfloat *param
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 13;
-        _context->ppa->glPointParameterv( pname, params );
+        _context->ppa->glPointParameter( pname, param );
+      }
+      #endif
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
       }
       #endif
     case 1 :
@@ -24232,10 +25535,10 @@ static void REGAL_CALL emu_glPointParameterfv(GLenum pname, const GLfloat *param
 
   DispatchTableGL *_next = _dispatch.next();
   RegalAssert(_next);
-  _next->call(& _next->glPointParameterfv)(pname, params);
+  _next->call(& _next->glPointParameterf)(pname, param);
 }
 
-static void REGAL_CALL emu_glPointParameteri(GLenum pname, GLint param)
+static void REGAL_CALL emu_glPointParameterfv(GLenum pname, const GLfloat *params)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -24252,7 +25555,22 @@ static void REGAL_CALL emu_glPointParameteri(GLenum pname, GLint param)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 13;
-        _context->ppa->glPointParameter( pname, param );
+        _context->ppa->glPointParameterv( pname, params );
+      }
+      #endif
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
       }
       #endif
     case 1 :
@@ -24262,10 +25580,10 @@ static void REGAL_CALL emu_glPointParameteri(GLenum pname, GLint param)
 
   DispatchTableGL *_next = _dispatch.next();
   RegalAssert(_next);
-  _next->call(& _next->glPointParameteri)(pname, param);
+  _next->call(& _next->glPointParameterfv)(pname, params);
 }
 
-static void REGAL_CALL emu_glPointParameteriv(GLenum pname, const GLint *params)
+static void REGAL_CALL emu_glPointParameteri(GLenum pname, GLint param)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -24282,52 +25600,9 @@ static void REGAL_CALL emu_glPointParameteriv(GLenum pname, const GLint *params)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 13;
-        _context->ppa->glPointParameterv( pname, params );
+        _context->ppa->glPointParameter( pname, param );
       }
       #endif
-    case 1 :
-    default:
-      break;
-  }
-
-  DispatchTableGL *_next = _dispatch.next();
-  RegalAssert(_next);
-  _next->call(& _next->glPointParameteriv)(pname, params);
-}
-
-static void REGAL_CALL emu_glSecondaryColor3b(GLbyte red, GLbyte green, GLbyte blue)
-{
-  RegalContext *_context = REGAL_GET_CONTEXT();
-  RegalAssert(_context);
-  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
-
-  // prefix
-  switch( _context->emuLevel )
-  {
-    case 16 :
-    case 15 :
-    case 14 :
-    case 13 :
-    case 12 :
-    case 11 :
-    case 10 :
-    case 9 :
-    case 8 :
-    case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff) break;
-      #endif
-    case 1 :
-    default:
-      break;
-  }
-
-  // impl
-  switch( _context->emuLevel )
-  {
-    case 16 :
-    case 15 :
-    case 14 :
     case 13 :
     case 12 :
     case 11 :
@@ -24340,24 +25615,20 @@ static void REGAL_CALL emu_glSecondaryColor3b(GLbyte red, GLbyte green, GLbyte b
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->AttrN<3>( _context, _context->iff->AttrIndex( RFF2A_SecondaryColor ), red, green, blue );
-        return;
+        _context->iff->FlushBatch( _context );
       }
       #endif
     case 1 :
     default:
-    {
-      DispatchTableGL *_next = _dispatch.next();
-      RegalAssert(_next);
-      _next->call(&_next->glSecondaryColor3b)(red, green, blue);
       break;
-    }
-
   }
 
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glPointParameteri)(pname, param);
 }
 
-static void REGAL_CALL emu_glSecondaryColor3bv(const GLbyte *v)
+static void REGAL_CALL emu_glPointParameteriv(GLenum pname, const GLint *params)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -24369,27 +25640,14 @@ static void REGAL_CALL emu_glSecondaryColor3bv(const GLbyte *v)
     case 16 :
     case 15 :
     case 14 :
-    case 13 :
-    case 12 :
-    case 11 :
-    case 10 :
-    case 9 :
-    case 8 :
-    case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff) break;
+      #if REGAL_EMU_PPA
+      if (_context->ppa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 13;
+        _context->ppa->glPointParameterv( pname, params );
+      }
       #endif
-    case 1 :
-    default:
-      break;
-  }
-
-  // impl
-  switch( _context->emuLevel )
-  {
-    case 16 :
-    case 15 :
-    case 14 :
     case 13 :
     case 12 :
     case 11 :
@@ -24402,24 +25660,20 @@ static void REGAL_CALL emu_glSecondaryColor3bv(const GLbyte *v)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->AttrN<3>( _context, _context->iff->AttrIndex( RFF2A_SecondaryColor ), v );
-        return;
+        _context->iff->FlushBatch( _context );
       }
       #endif
     case 1 :
     default:
-    {
-      DispatchTableGL *_next = _dispatch.next();
-      RegalAssert(_next);
-      _next->call(&_next->glSecondaryColor3bv)(v);
       break;
-    }
-
   }
 
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glPointParameteriv)(pname, params);
 }
 
-static void REGAL_CALL emu_glSecondaryColor3d(GLdouble red, GLdouble green, GLdouble blue)
+static void REGAL_CALL emu_glSecondaryColor3b(GLbyte red, GLbyte green, GLbyte blue)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -24464,7 +25718,7 @@ static void REGAL_CALL emu_glSecondaryColor3d(GLdouble red, GLdouble green, GLdo
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->Attr<3>( _context, _context->iff->AttrIndex( RFF2A_SecondaryColor ), red, green, blue );
+        _context->iff->AttrN<3>( _context, _context->iff->AttrIndex( RFF2A_SecondaryColor ), red, green, blue );
         return;
       }
       #endif
@@ -24473,7 +25727,7 @@ static void REGAL_CALL emu_glSecondaryColor3d(GLdouble red, GLdouble green, GLdo
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glSecondaryColor3d)(red, green, blue);
+      _next->call(&_next->glSecondaryColor3b)(red, green, blue);
       break;
     }
 
@@ -24481,7 +25735,7 @@ static void REGAL_CALL emu_glSecondaryColor3d(GLdouble red, GLdouble green, GLdo
 
 }
 
-static void REGAL_CALL emu_glSecondaryColor3dv(const GLdouble *v)
+static void REGAL_CALL emu_glSecondaryColor3bv(const GLbyte *v)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -24526,7 +25780,7 @@ static void REGAL_CALL emu_glSecondaryColor3dv(const GLdouble *v)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->Attr<3>( _context, _context->iff->AttrIndex( RFF2A_SecondaryColor ), v );
+        _context->iff->AttrN<3>( _context, _context->iff->AttrIndex( RFF2A_SecondaryColor ), v );
         return;
       }
       #endif
@@ -24535,7 +25789,7 @@ static void REGAL_CALL emu_glSecondaryColor3dv(const GLdouble *v)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glSecondaryColor3dv)(v);
+      _next->call(&_next->glSecondaryColor3bv)(v);
       break;
     }
 
@@ -24543,7 +25797,7 @@ static void REGAL_CALL emu_glSecondaryColor3dv(const GLdouble *v)
 
 }
 
-static void REGAL_CALL emu_glSecondaryColor3f(GLfloat red, GLfloat green, GLfloat blue)
+static void REGAL_CALL emu_glSecondaryColor3d(GLdouble red, GLdouble green, GLdouble blue)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -24597,7 +25851,7 @@ static void REGAL_CALL emu_glSecondaryColor3f(GLfloat red, GLfloat green, GLfloa
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glSecondaryColor3f)(red, green, blue);
+      _next->call(&_next->glSecondaryColor3d)(red, green, blue);
       break;
     }
 
@@ -24605,7 +25859,7 @@ static void REGAL_CALL emu_glSecondaryColor3f(GLfloat red, GLfloat green, GLfloa
 
 }
 
-static void REGAL_CALL emu_glSecondaryColor3fv(const GLfloat *v)
+static void REGAL_CALL emu_glSecondaryColor3dv(const GLdouble *v)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -24659,7 +25913,7 @@ static void REGAL_CALL emu_glSecondaryColor3fv(const GLfloat *v)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glSecondaryColor3fv)(v);
+      _next->call(&_next->glSecondaryColor3dv)(v);
       break;
     }
 
@@ -24667,7 +25921,7 @@ static void REGAL_CALL emu_glSecondaryColor3fv(const GLfloat *v)
 
 }
 
-static void REGAL_CALL emu_glSecondaryColor3i(GLint red, GLint green, GLint blue)
+static void REGAL_CALL emu_glSecondaryColor3f(GLfloat red, GLfloat green, GLfloat blue)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -24712,7 +25966,7 @@ static void REGAL_CALL emu_glSecondaryColor3i(GLint red, GLint green, GLint blue
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->AttrN<3>( _context, _context->iff->AttrIndex( RFF2A_SecondaryColor ), red, green, blue );
+        _context->iff->Attr<3>( _context, _context->iff->AttrIndex( RFF2A_SecondaryColor ), red, green, blue );
         return;
       }
       #endif
@@ -24721,7 +25975,7 @@ static void REGAL_CALL emu_glSecondaryColor3i(GLint red, GLint green, GLint blue
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glSecondaryColor3i)(red, green, blue);
+      _next->call(&_next->glSecondaryColor3f)(red, green, blue);
       break;
     }
 
@@ -24729,7 +25983,7 @@ static void REGAL_CALL emu_glSecondaryColor3i(GLint red, GLint green, GLint blue
 
 }
 
-static void REGAL_CALL emu_glSecondaryColor3iv(const GLint *v)
+static void REGAL_CALL emu_glSecondaryColor3fv(const GLfloat *v)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -24774,7 +26028,7 @@ static void REGAL_CALL emu_glSecondaryColor3iv(const GLint *v)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->AttrN<3>( _context, _context->iff->AttrIndex( RFF2A_SecondaryColor ), v );
+        _context->iff->Attr<3>( _context, _context->iff->AttrIndex( RFF2A_SecondaryColor ), v );
         return;
       }
       #endif
@@ -24783,7 +26037,7 @@ static void REGAL_CALL emu_glSecondaryColor3iv(const GLint *v)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glSecondaryColor3iv)(v);
+      _next->call(&_next->glSecondaryColor3fv)(v);
       break;
     }
 
@@ -24791,7 +26045,7 @@ static void REGAL_CALL emu_glSecondaryColor3iv(const GLint *v)
 
 }
 
-static void REGAL_CALL emu_glSecondaryColor3s(GLshort red, GLshort green, GLshort blue)
+static void REGAL_CALL emu_glSecondaryColor3i(GLint red, GLint green, GLint blue)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -24845,7 +26099,7 @@ static void REGAL_CALL emu_glSecondaryColor3s(GLshort red, GLshort green, GLshor
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glSecondaryColor3s)(red, green, blue);
+      _next->call(&_next->glSecondaryColor3i)(red, green, blue);
       break;
     }
 
@@ -24853,7 +26107,7 @@ static void REGAL_CALL emu_glSecondaryColor3s(GLshort red, GLshort green, GLshor
 
 }
 
-static void REGAL_CALL emu_glSecondaryColor3sv(const GLshort *v)
+static void REGAL_CALL emu_glSecondaryColor3iv(const GLint *v)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -24907,7 +26161,7 @@ static void REGAL_CALL emu_glSecondaryColor3sv(const GLshort *v)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glSecondaryColor3sv)(v);
+      _next->call(&_next->glSecondaryColor3iv)(v);
       break;
     }
 
@@ -24915,7 +26169,7 @@ static void REGAL_CALL emu_glSecondaryColor3sv(const GLshort *v)
 
 }
 
-static void REGAL_CALL emu_glSecondaryColor3ub(GLubyte red, GLubyte green, GLubyte blue)
+static void REGAL_CALL emu_glSecondaryColor3s(GLshort red, GLshort green, GLshort blue)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -24969,7 +26223,7 @@ static void REGAL_CALL emu_glSecondaryColor3ub(GLubyte red, GLubyte green, GLuby
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glSecondaryColor3ub)(red, green, blue);
+      _next->call(&_next->glSecondaryColor3s)(red, green, blue);
       break;
     }
 
@@ -24977,7 +26231,7 @@ static void REGAL_CALL emu_glSecondaryColor3ub(GLubyte red, GLubyte green, GLuby
 
 }
 
-static void REGAL_CALL emu_glSecondaryColor3ubv(const GLubyte *v)
+static void REGAL_CALL emu_glSecondaryColor3sv(const GLshort *v)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -25031,7 +26285,7 @@ static void REGAL_CALL emu_glSecondaryColor3ubv(const GLubyte *v)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glSecondaryColor3ubv)(v);
+      _next->call(&_next->glSecondaryColor3sv)(v);
       break;
     }
 
@@ -25039,7 +26293,7 @@ static void REGAL_CALL emu_glSecondaryColor3ubv(const GLubyte *v)
 
 }
 
-static void REGAL_CALL emu_glSecondaryColor3ui(GLuint red, GLuint green, GLuint blue)
+static void REGAL_CALL emu_glSecondaryColor3ub(GLubyte red, GLubyte green, GLubyte blue)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -25093,7 +26347,7 @@ static void REGAL_CALL emu_glSecondaryColor3ui(GLuint red, GLuint green, GLuint
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glSecondaryColor3ui)(red, green, blue);
+      _next->call(&_next->glSecondaryColor3ub)(red, green, blue);
       break;
     }
 
@@ -25101,7 +26355,7 @@ static void REGAL_CALL emu_glSecondaryColor3ui(GLuint red, GLuint green, GLuint
 
 }
 
-static void REGAL_CALL emu_glSecondaryColor3uiv(const GLuint *v)
+static void REGAL_CALL emu_glSecondaryColor3ubv(const GLubyte *v)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -25155,7 +26409,7 @@ static void REGAL_CALL emu_glSecondaryColor3uiv(const GLuint *v)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glSecondaryColor3uiv)(v);
+      _next->call(&_next->glSecondaryColor3ubv)(v);
       break;
     }
 
@@ -25163,7 +26417,7 @@ static void REGAL_CALL emu_glSecondaryColor3uiv(const GLuint *v)
 
 }
 
-static void REGAL_CALL emu_glSecondaryColor3us(GLushort red, GLushort green, GLushort blue)
+static void REGAL_CALL emu_glSecondaryColor3ui(GLuint red, GLuint green, GLuint blue)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -25217,7 +26471,7 @@ static void REGAL_CALL emu_glSecondaryColor3us(GLushort red, GLushort green, GLu
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glSecondaryColor3us)(red, green, blue);
+      _next->call(&_next->glSecondaryColor3ui)(red, green, blue);
       break;
     }
 
@@ -25225,7 +26479,7 @@ static void REGAL_CALL emu_glSecondaryColor3us(GLushort red, GLushort green, GLu
 
 }
 
-static void REGAL_CALL emu_glSecondaryColor3usv(const GLushort *v)
+static void REGAL_CALL emu_glSecondaryColor3uiv(const GLuint *v)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -25279,7 +26533,7 @@ static void REGAL_CALL emu_glSecondaryColor3usv(const GLushort *v)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glSecondaryColor3usv)(v);
+      _next->call(&_next->glSecondaryColor3uiv)(v);
       break;
     }
 
@@ -25287,7 +26541,7 @@ static void REGAL_CALL emu_glSecondaryColor3usv(const GLushort *v)
 
 }
 
-static void REGAL_CALL emu_glSecondaryColorPointer(GLint size, GLenum type, GLsizei stride, const GLvoid *pointer)
+static void REGAL_CALL emu_glSecondaryColor3us(GLushort red, GLushort green, GLushort blue)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -25300,46 +26554,15 @@ static void REGAL_CALL emu_glSecondaryColorPointer(GLint size, GLenum type, GLsi
     case 15 :
     case 14 :
     case 13 :
-      #if REGAL_EMU_PPCA
-      if (_context->ppca)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 12;
-        _context->ppca->glSecondaryColorPointer( size, type, stride, pointer );
-      }
-      #endif
     case 12 :
     case 11 :
     case 10 :
     case 9 :
-      #if REGAL_EMU_BASEVERTEX
-      if (_context->bv)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 8;
-        _context->bv->glSecondaryColorPointer( size, type, stride, pointer );
-      }
-      #endif
     case 8 :
     case 7 :
       #if REGAL_EMU_IFF
       if (_context->iff) break;
       #endif
-    case 6 :
-    case 5 :
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        _context->dsa->RestoreBuffer( _context );
-      }
-      #endif
-    case 3 :
-      #if REGAL_EMU_VAO
-      if (_context->vao) break;
-      #endif
     case 1 :
     default:
       break;
@@ -25363,20 +26586,7 @@ static void REGAL_CALL emu_glSecondaryColorPointer(GLint size, GLenum type, GLsi
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->SecondaryColorPointer( _context, size, type, stride, pointer );
-        return;
-      }
-      #endif
-    case 6 :
-    case 5 :
-    case 4 :
-    case 3 :
-      #if REGAL_EMU_VAO
-      if (_context->vao)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 2;
-        _context->vao->SecondaryColorPointer(*_context, size, type, stride, pointer );
+        _context->iff->AttrN<3>( _context, _context->iff->AttrIndex( RFF2A_SecondaryColor ), red, green, blue );
         return;
       }
       #endif
@@ -25385,7 +26595,7 @@ static void REGAL_CALL emu_glSecondaryColorPointer(GLint size, GLenum type, GLsi
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glSecondaryColorPointer)(size, type, stride, pointer);
+      _next->call(&_next->glSecondaryColor3us)(red, green, blue);
       break;
     }
 
@@ -25393,7 +26603,7 @@ static void REGAL_CALL emu_glSecondaryColorPointer(GLint size, GLenum type, GLsi
 
 }
 
-static void REGAL_CALL emu_glWindowPos2d(GLdouble x, GLdouble y)
+static void REGAL_CALL emu_glSecondaryColor3usv(const GLushort *v)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -25415,15 +26625,7 @@ static void REGAL_CALL emu_glWindowPos2d(GLdouble x, GLdouble y)
       #if REGAL_EMU_IFF
       if (_context->iff) break;
       #endif
-    case 6 :
-    case 5 :
-    case 4 :
-    case 3 :
-    case 2 :
     case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt) break;
-      #endif
     default:
       break;
   }
@@ -25446,36 +26648,16 @@ static void REGAL_CALL emu_glWindowPos2d(GLdouble x, GLdouble y)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->WindowPosition( _context, x, y );
+        _context->iff->AttrN<3>( _context, _context->iff->AttrIndex( RFF2A_SecondaryColor ), v );
         return;
       }
       #endif
-    case 6 :
-    case 5 :
-    case 4 :
-    case 3 :
-    case 2 :
     case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 0;
-        if (_context->isES2() || _context->isCore())
-        {
-           Warning("Regal does not support glWindowPos2d for core or ES2 profiles - skipping.");
-           #if REGAL_BREAK
-           Break::Filter();
-           #endif
-           return ;
-        }
-      }
-      #endif
     default:
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glWindowPos2d)(x, y);
+      _next->call(&_next->glSecondaryColor3usv)(v);
       break;
     }
 
@@ -25483,7 +26665,7 @@ static void REGAL_CALL emu_glWindowPos2d(GLdouble x, GLdouble y)
 
 }
 
-static void REGAL_CALL emu_glWindowPos2dv(const GLdouble *p)
+static void REGAL_CALL emu_glSecondaryColorPointer(GLint size, GLenum type, GLsizei stride, const GLvoid *pointer)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -25496,21 +26678,47 @@ static void REGAL_CALL emu_glWindowPos2dv(const GLdouble *p)
     case 15 :
     case 14 :
     case 13 :
+      #if REGAL_EMU_PPCA
+      if (_context->ppca)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 12;
+        _context->ppca->glSecondaryColorPointer( size, type, stride, pointer );
+      }
+      #endif
     case 12 :
     case 11 :
     case 10 :
     case 9 :
+      #if REGAL_EMU_BASEVERTEX
+      if (_context->bv)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 8;
+        _context->bv->glSecondaryColorPointer( size, type, stride, pointer );
+      }
+      #endif
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff) break;
+      #endif
     case 6 :
     case 5 :
     case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 3;
+        _context->dsa->RestoreBuffer( _context );
+      }
+      #endif
     case 3 :
-    case 2 :
-    case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt) break;
+      #if REGAL_EMU_VAO
+      if (_context->vao) break;
       #endif
+    case 1 :
     default:
       break;
   }
@@ -25528,32 +26736,35 @@ static void REGAL_CALL emu_glWindowPos2dv(const GLdouble *p)
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
+        _context->iff->SecondaryColorPointer( _context, size, type, stride, pointer );
+        return;
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
     case 3 :
-    case 2 :
-    case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt)
+      #if REGAL_EMU_VAO
+      if (_context->vao)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 0;
-        if (_context->isES2() || _context->isCore())
-        {
-           Warning("Regal does not support glWindowPos2dv for core or ES2 profiles - skipping.");
-           #if REGAL_BREAK
-           Break::Filter();
-           #endif
-           return ;
-        }
+        _context->emuLevel = 2;
+        _context->vao->SecondaryColorPointer(*_context, size, type, stride, pointer );
+        return;
       }
       #endif
+    case 1 :
     default:
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glWindowPos2dv)(p);
+      _next->call(&_next->glSecondaryColorPointer)(size, type, stride, pointer);
       break;
     }
 
@@ -25561,7 +26772,7 @@ static void REGAL_CALL emu_glWindowPos2dv(const GLdouble *p)
 
 }
 
-static void REGAL_CALL emu_glWindowPos2f(GLfloat x, GLfloat y)
+static void REGAL_CALL emu_glWindowPos2d(GLdouble x, GLdouble y)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -25614,6 +26825,7 @@ static void REGAL_CALL emu_glWindowPos2f(GLfloat x, GLfloat y)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->WindowPosition( _context, x, y );
         return;
       }
@@ -25631,7 +26843,7 @@ static void REGAL_CALL emu_glWindowPos2f(GLfloat x, GLfloat y)
         _context->emuLevel = 0;
         if (_context->isES2() || _context->isCore())
         {
-           Warning("Regal does not support glWindowPos2f for core or ES2 profiles - skipping.");
+           Warning("Regal does not support glWindowPos2d for core or ES2 profiles - skipping.");
            #if REGAL_BREAK
            Break::Filter();
            #endif
@@ -25643,7 +26855,7 @@ static void REGAL_CALL emu_glWindowPos2f(GLfloat x, GLfloat y)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glWindowPos2f)(x, y);
+      _next->call(&_next->glWindowPos2d)(x, y);
       break;
     }
 
@@ -25651,7 +26863,7 @@ static void REGAL_CALL emu_glWindowPos2f(GLfloat x, GLfloat y)
 
 }
 
-static void REGAL_CALL emu_glWindowPos2fv(const GLfloat *p)
+static void REGAL_CALL emu_glWindowPos2dv(const GLdouble *p)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -25709,7 +26921,7 @@ static void REGAL_CALL emu_glWindowPos2fv(const GLfloat *p)
         _context->emuLevel = 0;
         if (_context->isES2() || _context->isCore())
         {
-           Warning("Regal does not support glWindowPos2fv for core or ES2 profiles - skipping.");
+           Warning("Regal does not support glWindowPos2dv for core or ES2 profiles - skipping.");
            #if REGAL_BREAK
            Break::Filter();
            #endif
@@ -25721,7 +26933,7 @@ static void REGAL_CALL emu_glWindowPos2fv(const GLfloat *p)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glWindowPos2fv)(p);
+      _next->call(&_next->glWindowPos2dv)(p);
       break;
     }
 
@@ -25729,7 +26941,7 @@ static void REGAL_CALL emu_glWindowPos2fv(const GLfloat *p)
 
 }
 
-static void REGAL_CALL emu_glWindowPos2i(GLint x, GLint y)
+static void REGAL_CALL emu_glWindowPos2f(GLfloat x, GLfloat y)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -25782,6 +26994,7 @@ static void REGAL_CALL emu_glWindowPos2i(GLint x, GLint y)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->WindowPosition( _context, x, y );
         return;
       }
@@ -25799,7 +27012,7 @@ static void REGAL_CALL emu_glWindowPos2i(GLint x, GLint y)
         _context->emuLevel = 0;
         if (_context->isES2() || _context->isCore())
         {
-           Warning("Regal does not support glWindowPos2i for core or ES2 profiles - skipping.");
+           Warning("Regal does not support glWindowPos2f for core or ES2 profiles - skipping.");
            #if REGAL_BREAK
            Break::Filter();
            #endif
@@ -25811,7 +27024,7 @@ static void REGAL_CALL emu_glWindowPos2i(GLint x, GLint y)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glWindowPos2i)(x, y);
+      _next->call(&_next->glWindowPos2f)(x, y);
       break;
     }
 
@@ -25819,7 +27032,7 @@ static void REGAL_CALL emu_glWindowPos2i(GLint x, GLint y)
 
 }
 
-static void REGAL_CALL emu_glWindowPos2iv(const GLint *p)
+static void REGAL_CALL emu_glWindowPos2fv(const GLfloat *p)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -25877,7 +27090,7 @@ static void REGAL_CALL emu_glWindowPos2iv(const GLint *p)
         _context->emuLevel = 0;
         if (_context->isES2() || _context->isCore())
         {
-           Warning("Regal does not support glWindowPos2iv for core or ES2 profiles - skipping.");
+           Warning("Regal does not support glWindowPos2fv for core or ES2 profiles - skipping.");
            #if REGAL_BREAK
            Break::Filter();
            #endif
@@ -25889,7 +27102,7 @@ static void REGAL_CALL emu_glWindowPos2iv(const GLint *p)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glWindowPos2iv)(p);
+      _next->call(&_next->glWindowPos2fv)(p);
       break;
     }
 
@@ -25897,7 +27110,7 @@ static void REGAL_CALL emu_glWindowPos2iv(const GLint *p)
 
 }
 
-static void REGAL_CALL emu_glWindowPos2s(GLshort x, GLshort y)
+static void REGAL_CALL emu_glWindowPos2i(GLint x, GLint y)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -25950,6 +27163,7 @@ static void REGAL_CALL emu_glWindowPos2s(GLshort x, GLshort y)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->WindowPosition( _context, x, y );
         return;
       }
@@ -25967,7 +27181,7 @@ static void REGAL_CALL emu_glWindowPos2s(GLshort x, GLshort y)
         _context->emuLevel = 0;
         if (_context->isES2() || _context->isCore())
         {
-           Warning("Regal does not support glWindowPos2s for core or ES2 profiles - skipping.");
+           Warning("Regal does not support glWindowPos2i for core or ES2 profiles - skipping.");
            #if REGAL_BREAK
            Break::Filter();
            #endif
@@ -25979,7 +27193,7 @@ static void REGAL_CALL emu_glWindowPos2s(GLshort x, GLshort y)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glWindowPos2s)(x, y);
+      _next->call(&_next->glWindowPos2i)(x, y);
       break;
     }
 
@@ -25987,7 +27201,7 @@ static void REGAL_CALL emu_glWindowPos2s(GLshort x, GLshort y)
 
 }
 
-static void REGAL_CALL emu_glWindowPos2sv(const GLshort *p)
+static void REGAL_CALL emu_glWindowPos2iv(const GLint *p)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -26045,7 +27259,7 @@ static void REGAL_CALL emu_glWindowPos2sv(const GLshort *p)
         _context->emuLevel = 0;
         if (_context->isES2() || _context->isCore())
         {
-           Warning("Regal does not support glWindowPos2sv for core or ES2 profiles - skipping.");
+           Warning("Regal does not support glWindowPos2iv for core or ES2 profiles - skipping.");
            #if REGAL_BREAK
            Break::Filter();
            #endif
@@ -26057,7 +27271,7 @@ static void REGAL_CALL emu_glWindowPos2sv(const GLshort *p)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glWindowPos2sv)(p);
+      _next->call(&_next->glWindowPos2iv)(p);
       break;
     }
 
@@ -26065,7 +27279,7 @@ static void REGAL_CALL emu_glWindowPos2sv(const GLshort *p)
 
 }
 
-static void REGAL_CALL emu_glWindowPos3d(GLdouble x, GLdouble y, GLdouble z)
+static void REGAL_CALL emu_glWindowPos2s(GLshort x, GLshort y)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -26118,7 +27332,8 @@ static void REGAL_CALL emu_glWindowPos3d(GLdouble x, GLdouble y, GLdouble z)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->WindowPosition( _context, x, y, z );
+        _context->iff->FlushBatch( _context );
+        _context->iff->WindowPosition( _context, x, y );
         return;
       }
       #endif
@@ -26135,7 +27350,7 @@ static void REGAL_CALL emu_glWindowPos3d(GLdouble x, GLdouble y, GLdouble z)
         _context->emuLevel = 0;
         if (_context->isES2() || _context->isCore())
         {
-           Warning("Regal does not support glWindowPos3d for core or ES2 profiles - skipping.");
+           Warning("Regal does not support glWindowPos2s for core or ES2 profiles - skipping.");
            #if REGAL_BREAK
            Break::Filter();
            #endif
@@ -26147,7 +27362,7 @@ static void REGAL_CALL emu_glWindowPos3d(GLdouble x, GLdouble y, GLdouble z)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glWindowPos3d)(x, y, z);
+      _next->call(&_next->glWindowPos2s)(x, y);
       break;
     }
 
@@ -26155,7 +27370,7 @@ static void REGAL_CALL emu_glWindowPos3d(GLdouble x, GLdouble y, GLdouble z)
 
 }
 
-static void REGAL_CALL emu_glWindowPos3dv(const GLdouble *p)
+static void REGAL_CALL emu_glWindowPos2sv(const GLshort *p)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -26213,7 +27428,7 @@ static void REGAL_CALL emu_glWindowPos3dv(const GLdouble *p)
         _context->emuLevel = 0;
         if (_context->isES2() || _context->isCore())
         {
-           Warning("Regal does not support glWindowPos3dv for core or ES2 profiles - skipping.");
+           Warning("Regal does not support glWindowPos2sv for core or ES2 profiles - skipping.");
            #if REGAL_BREAK
            Break::Filter();
            #endif
@@ -26225,7 +27440,7 @@ static void REGAL_CALL emu_glWindowPos3dv(const GLdouble *p)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glWindowPos3dv)(p);
+      _next->call(&_next->glWindowPos2sv)(p);
       break;
     }
 
@@ -26233,7 +27448,7 @@ static void REGAL_CALL emu_glWindowPos3dv(const GLdouble *p)
 
 }
 
-static void REGAL_CALL emu_glWindowPos3f(GLfloat x, GLfloat y, GLfloat z)
+static void REGAL_CALL emu_glWindowPos3d(GLdouble x, GLdouble y, GLdouble z)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -26286,6 +27501,7 @@ static void REGAL_CALL emu_glWindowPos3f(GLfloat x, GLfloat y, GLfloat z)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->WindowPosition( _context, x, y, z );
         return;
       }
@@ -26303,7 +27519,7 @@ static void REGAL_CALL emu_glWindowPos3f(GLfloat x, GLfloat y, GLfloat z)
         _context->emuLevel = 0;
         if (_context->isES2() || _context->isCore())
         {
-           Warning("Regal does not support glWindowPos3f for core or ES2 profiles - skipping.");
+           Warning("Regal does not support glWindowPos3d for core or ES2 profiles - skipping.");
            #if REGAL_BREAK
            Break::Filter();
            #endif
@@ -26315,7 +27531,7 @@ static void REGAL_CALL emu_glWindowPos3f(GLfloat x, GLfloat y, GLfloat z)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glWindowPos3f)(x, y, z);
+      _next->call(&_next->glWindowPos3d)(x, y, z);
       break;
     }
 
@@ -26323,7 +27539,7 @@ static void REGAL_CALL emu_glWindowPos3f(GLfloat x, GLfloat y, GLfloat z)
 
 }
 
-static void REGAL_CALL emu_glWindowPos3fv(const GLfloat *p)
+static void REGAL_CALL emu_glWindowPos3dv(const GLdouble *p)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -26381,7 +27597,7 @@ static void REGAL_CALL emu_glWindowPos3fv(const GLfloat *p)
         _context->emuLevel = 0;
         if (_context->isES2() || _context->isCore())
         {
-           Warning("Regal does not support glWindowPos3fv for core or ES2 profiles - skipping.");
+           Warning("Regal does not support glWindowPos3dv for core or ES2 profiles - skipping.");
            #if REGAL_BREAK
            Break::Filter();
            #endif
@@ -26393,7 +27609,7 @@ static void REGAL_CALL emu_glWindowPos3fv(const GLfloat *p)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glWindowPos3fv)(p);
+      _next->call(&_next->glWindowPos3dv)(p);
       break;
     }
 
@@ -26401,7 +27617,7 @@ static void REGAL_CALL emu_glWindowPos3fv(const GLfloat *p)
 
 }
 
-static void REGAL_CALL emu_glWindowPos3i(GLint x, GLint y, GLint z)
+static void REGAL_CALL emu_glWindowPos3f(GLfloat x, GLfloat y, GLfloat z)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -26454,6 +27670,7 @@ static void REGAL_CALL emu_glWindowPos3i(GLint x, GLint y, GLint z)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->WindowPosition( _context, x, y, z );
         return;
       }
@@ -26471,7 +27688,7 @@ static void REGAL_CALL emu_glWindowPos3i(GLint x, GLint y, GLint z)
         _context->emuLevel = 0;
         if (_context->isES2() || _context->isCore())
         {
-           Warning("Regal does not support glWindowPos3i for core or ES2 profiles - skipping.");
+           Warning("Regal does not support glWindowPos3f for core or ES2 profiles - skipping.");
            #if REGAL_BREAK
            Break::Filter();
            #endif
@@ -26483,7 +27700,7 @@ static void REGAL_CALL emu_glWindowPos3i(GLint x, GLint y, GLint z)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glWindowPos3i)(x, y, z);
+      _next->call(&_next->glWindowPos3f)(x, y, z);
       break;
     }
 
@@ -26491,7 +27708,7 @@ static void REGAL_CALL emu_glWindowPos3i(GLint x, GLint y, GLint z)
 
 }
 
-static void REGAL_CALL emu_glWindowPos3iv(const GLint *p)
+static void REGAL_CALL emu_glWindowPos3fv(const GLfloat *p)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -26549,7 +27766,7 @@ static void REGAL_CALL emu_glWindowPos3iv(const GLint *p)
         _context->emuLevel = 0;
         if (_context->isES2() || _context->isCore())
         {
-           Warning("Regal does not support glWindowPos3iv for core or ES2 profiles - skipping.");
+           Warning("Regal does not support glWindowPos3fv for core or ES2 profiles - skipping.");
            #if REGAL_BREAK
            Break::Filter();
            #endif
@@ -26561,7 +27778,7 @@ static void REGAL_CALL emu_glWindowPos3iv(const GLint *p)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glWindowPos3iv)(p);
+      _next->call(&_next->glWindowPos3fv)(p);
       break;
     }
 
@@ -26569,7 +27786,7 @@ static void REGAL_CALL emu_glWindowPos3iv(const GLint *p)
 
 }
 
-static void REGAL_CALL emu_glWindowPos3s(GLshort x, GLshort y, GLshort z)
+static void REGAL_CALL emu_glWindowPos3i(GLint x, GLint y, GLint z)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -26622,6 +27839,7 @@ static void REGAL_CALL emu_glWindowPos3s(GLshort x, GLshort y, GLshort z)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->WindowPosition( _context, x, y, z );
         return;
       }
@@ -26639,7 +27857,7 @@ static void REGAL_CALL emu_glWindowPos3s(GLshort x, GLshort y, GLshort z)
         _context->emuLevel = 0;
         if (_context->isES2() || _context->isCore())
         {
-           Warning("Regal does not support glWindowPos3s for core or ES2 profiles - skipping.");
+           Warning("Regal does not support glWindowPos3i for core or ES2 profiles - skipping.");
            #if REGAL_BREAK
            Break::Filter();
            #endif
@@ -26651,7 +27869,7 @@ static void REGAL_CALL emu_glWindowPos3s(GLshort x, GLshort y, GLshort z)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glWindowPos3s)(x, y, z);
+      _next->call(&_next->glWindowPos3i)(x, y, z);
       break;
     }
 
@@ -26659,7 +27877,7 @@ static void REGAL_CALL emu_glWindowPos3s(GLshort x, GLshort y, GLshort z)
 
 }
 
-static void REGAL_CALL emu_glWindowPos3sv(const GLshort *p)
+static void REGAL_CALL emu_glWindowPos3iv(const GLint *p)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -26717,7 +27935,7 @@ static void REGAL_CALL emu_glWindowPos3sv(const GLshort *p)
         _context->emuLevel = 0;
         if (_context->isES2() || _context->isCore())
         {
-           Warning("Regal does not support glWindowPos3sv for core or ES2 profiles - skipping.");
+           Warning("Regal does not support glWindowPos3iv for core or ES2 profiles - skipping.");
            #if REGAL_BREAK
            Break::Filter();
            #endif
@@ -26729,7 +27947,7 @@ static void REGAL_CALL emu_glWindowPos3sv(const GLshort *p)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glWindowPos3sv)(p);
+      _next->call(&_next->glWindowPos3iv)(p);
       break;
     }
 
@@ -26737,9 +27955,7 @@ static void REGAL_CALL emu_glWindowPos3sv(const GLshort *p)
 
 }
 
-// GL_VERSION_1_5
-
-static void REGAL_CALL emu_glBindBuffer(GLenum target, GLuint buffer)
+static void REGAL_CALL emu_glWindowPos3s(GLshort x, GLshort y, GLshort z)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -26749,66 +27965,27 @@ static void REGAL_CALL emu_glBindBuffer(GLenum target, GLuint buffer)
   switch( _context->emuLevel )
   {
     case 16 :
-      #if REGAL_EMU_OBJ
-      if (_context->obj) break;
-      #endif
     case 15 :
     case 14 :
     case 13 :
-      #if REGAL_EMU_PPCA
-      if (_context->ppca)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 12;
-        _context->ppca->glBindBuffer( target, buffer );
-      }
-      #endif
     case 12 :
     case 11 :
     case 10 :
     case 9 :
-      #if REGAL_EMU_BASEVERTEX
-      if (_context->bv)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 8;
-        _context->bv->glBindBuffer( target, buffer );
-      }
-      #endif
     case 8 :
     case 7 :
       #if REGAL_EMU_IFF
-      if (_context->iff)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 6;
-        _context->iff->RestoreVao( _context );
-      }
+      if (_context->iff) break;
       #endif
     case 6 :
-      #if REGAL_EMU_QUADS
-      if (_context->quads)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 5;
-        _context->quads->glBindBuffer( target, buffer );
-      }
-      #endif
     case 5 :
     case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa) break;
-      #endif
     case 3 :
-      #if REGAL_EMU_VAO
-      if (_context->vao)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 2;
-        _context->vao->ShadowBufferBinding( target, buffer );
-      }
-      #endif
+    case 2 :
     case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt) break;
+      #endif
     default:
       break;
   }
@@ -26817,15 +27994,6 @@ static void REGAL_CALL emu_glBindBuffer(GLenum target, GLuint buffer)
   switch( _context->emuLevel )
   {
     case 16 :
-      #if REGAL_EMU_OBJ
-      if (_context->obj)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 15;
-        _context->obj->BindBuffer(*_context, target, buffer);
-        return;
-      }
-      #endif
     case 15 :
     case 14 :
     case 13 :
@@ -26835,26 +28003,42 @@ static void REGAL_CALL emu_glBindBuffer(GLenum target, GLuint buffer)
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+        _context->iff->WindowPosition( _context, x, y, z );
+        return;
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
+    case 3 :
+    case 2 :
+    case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        if (!_context->dsa->ShadowBuffer( target, buffer ) ) {
-            _dispatch.call(&_dispatch.glBindBuffer)(target, buffer);
+        _context->emuLevel = 0;
+        if (_context->isES2() || _context->isCore())
+        {
+           Warning("Regal does not support glWindowPos3s for core or ES2 profiles - skipping.");
+           #if REGAL_BREAK
+           Break::Filter();
+           #endif
+           return ;
         }
-        return;
       }
       #endif
-    case 1 :
     default:
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glBindBuffer)(target, buffer);
+      _next->call(&_next->glWindowPos3s)(x, y, z);
       break;
     }
 
@@ -26862,7 +28046,7 @@ static void REGAL_CALL emu_glBindBuffer(GLenum target, GLuint buffer)
 
 }
 
-static void REGAL_CALL emu_glBufferData(GLenum target, GLsizeiptr size, const GLvoid *data, GLenum usage)
+static void REGAL_CALL emu_glWindowPos3sv(const GLshort *p)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -26884,25 +28068,65 @@ static void REGAL_CALL emu_glBufferData(GLenum target, GLsizeiptr size, const GL
     case 6 :
     case 5 :
     case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
+    case 3 :
+    case 2 :
+    case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt) break;
+      #endif
+    default:
+      break;
+  }
+
+  // impl
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+    case 2 :
+    case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        _context->dsa->RestoreBuffer( _context );
+        _context->emuLevel = 0;
+        if (_context->isES2() || _context->isCore())
+        {
+           Warning("Regal does not support glWindowPos3sv for core or ES2 profiles - skipping.");
+           #if REGAL_BREAK
+           Break::Filter();
+           #endif
+           return ;
+        }
       }
       #endif
-    case 1 :
     default:
+    {
+      DispatchTableGL *_next = _dispatch.next();
+      RegalAssert(_next);
+      _next->call(&_next->glWindowPos3sv)(p);
       break;
+    }
+
   }
 
-  DispatchTableGL *_next = _dispatch.next();
-  RegalAssert(_next);
-  _next->call(& _next->glBufferData)(target, size, data, usage);
 }
 
-static void REGAL_CALL emu_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const GLvoid *data)
+// GL_VERSION_1_5
+
+static void REGAL_CALL emu_glBeginQuery(GLenum target, GLuint id)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -26921,15 +28145,12 @@ static void REGAL_CALL emu_glBufferSubData(GLenum target, GLintptr offset, GLsiz
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        _context->dsa->RestoreBuffer( _context );
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
       }
       #endif
     case 1 :
@@ -26939,10 +28160,10 @@ static void REGAL_CALL emu_glBufferSubData(GLenum target, GLintptr offset, GLsiz
 
   DispatchTableGL *_next = _dispatch.next();
   RegalAssert(_next);
-  _next->call(& _next->glBufferSubData)(target, offset, size, data);
+  _next->call(& _next->glBeginQuery)(target, id);
 }
 
-static void REGAL_CALL emu_glDeleteBuffers(GLsizei n, const GLuint *buffers)
+static void REGAL_CALL emu_glBindBuffer(GLenum target, GLuint buffer)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -26963,27 +28184,53 @@ static void REGAL_CALL emu_glDeleteBuffers(GLsizei n, const GLuint *buffers)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 12;
-        _context->ppca->glDeleteBuffers( n, buffers );
+        _context->ppca->glBindBuffer( target, buffer );
       }
       #endif
     case 12 :
     case 11 :
     case 10 :
     case 9 :
+      #if REGAL_EMU_BASEVERTEX
+      if (_context->bv)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 8;
+        _context->bv->glBindBuffer( target, buffer );
+      }
+      #endif
     case 8 :
     case 7 :
       #if REGAL_EMU_IFF
-      if (_context->iff) break;
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
+        _context->iff->ShadowBindBuffer( target, buffer );
+      }
       #endif
     case 6 :
+      #if REGAL_EMU_QUADS
+      if (_context->quads)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 5;
+        _context->quads->glBindBuffer( target, buffer );
+      }
+      #endif
     case 5 :
     case 4 :
       #if REGAL_EMU_DSA
-      if (_context->dsa)
+      if (_context->dsa) break;
+      #endif
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        _context->dsa->DeleteBuffers( _context, n, buffers );
+        _context->emuLevel = 2;
+        _context->vao->ShadowBufferBinding( target, buffer );
       }
       #endif
     case 1 :
@@ -27000,7 +28247,7 @@ static void REGAL_CALL emu_glDeleteBuffers(GLsizei n, const GLuint *buffers)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 15;
-        _context->obj->DeleteBuffers(*_context, n, buffers);
+        _context->obj->BindBuffer(*_context, target, buffer);
         return;
       }
       #endif
@@ -27013,12 +28260,17 @@ static void REGAL_CALL emu_glDeleteBuffers(GLsizei n, const GLuint *buffers)
     case 9 :
     case 8 :
     case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff)
+    case 6 :
+    case 5 :
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 6;
-        _context->iff->glDeleteBuffers( _context, n, buffers );
+        _context->emuLevel = 3;
+        if (!_context->dsa->ShadowBuffer( target, buffer ) ) {
+            _dispatch.call(&_dispatch.glBindBuffer)(target, buffer);
+        }
         return;
       }
       #endif
@@ -27027,7 +28279,7 @@ static void REGAL_CALL emu_glDeleteBuffers(GLsizei n, const GLuint *buffers)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glDeleteBuffers)(n, buffers);
+      _next->call(&_next->glBindBuffer)(target, buffer);
       break;
     }
 
@@ -27035,7 +28287,7 @@ static void REGAL_CALL emu_glDeleteBuffers(GLsizei n, const GLuint *buffers)
 
 }
 
-static void REGAL_CALL emu_glGenBuffers(GLsizei n, GLuint *buffers)
+static void REGAL_CALL emu_glBufferData(GLenum target, GLsizeiptr size, const GLvoid *data, GLenum usage)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -27045,41 +28297,270 @@ static void REGAL_CALL emu_glGenBuffers(GLsizei n, GLuint *buffers)
   switch( _context->emuLevel )
   {
     case 16 :
-      #if REGAL_EMU_OBJ
-      if (_context->obj) break;
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 3;
+        _context->dsa->RestoreBuffer( _context );
+      }
       #endif
-    case 1 :
-    default:
-      break;
-  }
-
-  // impl
-  switch( _context->emuLevel )
-  {
-    case 16 :
-      #if REGAL_EMU_OBJ
-      if (_context->obj)
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 15;
-        _context->obj->GenBuffers(*_context, n, buffers);
-        return;
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
       }
       #endif
     case 1 :
     default:
-    {
-      DispatchTableGL *_next = _dispatch.next();
-      RegalAssert(_next);
-      _next->call(&_next->glGenBuffers)(n, buffers);
       break;
-    }
-
   }
 
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glBufferData)(target, size, data, usage);
 }
 
-static void REGAL_CALL emu_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params)
+static void REGAL_CALL emu_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const GLvoid *data)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 3;
+        _context->dsa->RestoreBuffer( _context );
+      }
+      #endif
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glBufferSubData)(target, offset, size, data);
+}
+
+static void REGAL_CALL emu_glDeleteBuffers(GLsizei n, const GLuint *buffers)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+      #if REGAL_EMU_OBJ
+      if (_context->obj) break;
+      #endif
+    case 15 :
+    case 14 :
+    case 13 :
+      #if REGAL_EMU_PPCA
+      if (_context->ppca)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 12;
+        _context->ppca->glDeleteBuffers( n, buffers );
+      }
+      #endif
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff) break;
+      #endif
+    case 6 :
+    case 5 :
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 3;
+        _context->dsa->DeleteBuffers( _context, n, buffers );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  // impl
+  switch( _context->emuLevel )
+  {
+    case 16 :
+      #if REGAL_EMU_OBJ
+      if (_context->obj)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 15;
+        _context->obj->DeleteBuffers(*_context, n, buffers);
+        return;
+      }
+      #endif
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
+        _context->iff->glDeleteBuffers( _context, n, buffers );
+        return;
+      }
+      #endif
+    case 1 :
+    default:
+    {
+      DispatchTableGL *_next = _dispatch.next();
+      RegalAssert(_next);
+      _next->call(&_next->glDeleteBuffers)(n, buffers);
+      break;
+    }
+
+  }
+
+}
+
+static void REGAL_CALL emu_glEndQuery(GLenum target)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glEndQuery)(target);
+}
+
+static void REGAL_CALL emu_glGenBuffers(GLsizei n, GLuint *buffers)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+      #if REGAL_EMU_OBJ
+      if (_context->obj) break;
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  // impl
+  switch( _context->emuLevel )
+  {
+    case 16 :
+      #if REGAL_EMU_OBJ
+      if (_context->obj)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 15;
+        _context->obj->GenBuffers(*_context, n, buffers);
+        return;
+      }
+      #endif
+    case 1 :
+    default:
+    {
+      DispatchTableGL *_next = _dispatch.next();
+      RegalAssert(_next);
+      _next->call(&_next->glGenBuffers)(n, buffers);
+      break;
+    }
+
+  }
+
+}
+
+static void REGAL_CALL emu_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -27199,6 +28680,104 @@ static void REGAL_CALL emu_glGetBufferSubData(GLenum target, GLintptr offset, GL
   _next->call(& _next->glGetBufferSubData)(target, offset, size, data);
 }
 
+static void REGAL_CALL emu_glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->QueryBufferWrite();
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glGetQueryObjectiv)(id, pname, params);
+}
+
+static void REGAL_CALL emu_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->QueryBufferWrite();
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glGetQueryObjectuiv)(id, pname, params);
+}
+
 static GLboolean REGAL_CALL emu_glIsBuffer(GLuint buffer)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
@@ -27272,6 +28851,14 @@ static void *REGAL_CALL emu_glMapBuffer(GLenum target, GLenum access)
       }
       #endif
     case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
+      }
+      #endif
     case 2 :
     case 1 :
       #if REGAL_EMU_FILTER
@@ -27355,6 +28942,14 @@ static GLboolean REGAL_CALL emu_glUnmapBuffer(GLenum target)
       }
       #endif
     case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
+      }
+      #endif
     case 2 :
     case 1 :
       #if REGAL_EMU_FILTER
@@ -27429,6 +29024,21 @@ static void REGAL_CALL emu_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAl
         _context->ppa->glBlendEquationSeparate( modeRGB, modeAlpha );
       }
       #endif
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -27655,6 +29265,14 @@ static void REGAL_CALL emu_glDrawBuffers(GLsizei n, const GLenum *bufs)
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -28186,6 +29804,7 @@ static void REGAL_CALL emu_glLinkProgram(GLuint program)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->LinkProgram( _context, program );
         return;
       }
@@ -28248,6 +29867,7 @@ static void REGAL_CALL emu_glShaderSource(GLuint shader, GLsizei count, const GL
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->ShaderSource( _context, shader, count, string, length );
         return;
       }
@@ -28285,6 +29905,21 @@ static void REGAL_CALL emu_glStencilFuncSeparate(GLenum face, GLenum func, GLint
         _context->ppa->glStencilFuncSeparate( face, func, ref, mask );
       }
       #endif
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -28315,6 +29950,21 @@ static void REGAL_CALL emu_glStencilMaskSeparate(GLenum face, GLuint mask)
         _context->ppa->glStencilMaskSeparate( face, mask );
       }
       #endif
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -28345,6 +29995,21 @@ static void REGAL_CALL emu_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum
         _context->ppa->glStencilOpSeparate( face, sfail, dpfail, dppass );
       }
       #endif
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -28411,6 +30076,7 @@ static void REGAL_CALL emu_glUniform1f(GLint location, GLfloat v0)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( _context->iff->currinst ) {
           _context->iff->Uniform( _context, 1, location, 1, v0 );
         } else {
@@ -28488,6 +30154,7 @@ static void REGAL_CALL emu_glUniform1fv(GLint location, GLsizei count, const GLf
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( _context->iff->currinst ) {
           _context->iff->Uniform( _context, 1, location, count, value );
         } else {
@@ -28565,6 +30232,7 @@ static void REGAL_CALL emu_glUniform1i(GLint location, GLint v0)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( _context->iff->currinst ) {
           _context->iff->Uniform( _context, 1, location, 1, v0 );
         } else {
@@ -28642,6 +30310,7 @@ static void REGAL_CALL emu_glUniform1iv(GLint location, GLsizei count, const GLi
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( _context->iff->currinst ) {
           _context->iff->Uniform( _context, 1, location, count, value );
         } else {
@@ -28719,6 +30388,7 @@ static void REGAL_CALL emu_glUniform2f(GLint location, GLfloat v0, GLfloat v1)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( _context->iff->currinst ) {
           _context->iff->Uniform( _context, 2, location, 1, v0, v1 );
         } else {
@@ -28796,6 +30466,7 @@ static void REGAL_CALL emu_glUniform2fv(GLint location, GLsizei count, const GLf
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( _context->iff->currinst ) {
           _context->iff->Uniform( _context, 2, location, count, value );
         } else {
@@ -28873,6 +30544,7 @@ static void REGAL_CALL emu_glUniform2i(GLint location, GLint v0, GLint v1)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( _context->iff->currinst ) {
           _context->iff->Uniform( _context, 2, location, 1, v0, v1 );
         } else {
@@ -28950,6 +30622,7 @@ static void REGAL_CALL emu_glUniform2iv(GLint location, GLsizei count, const GLi
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( _context->iff->currinst ) {
           _context->iff->Uniform( _context, 2, location, count, value );
         } else {
@@ -29027,6 +30700,7 @@ static void REGAL_CALL emu_glUniform3f(GLint location, GLfloat v0, GLfloat v1, G
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( _context->iff->currinst ) {
           _context->iff->Uniform( _context, 3, location, 1, v0, v1, v2 );
         } else {
@@ -29104,6 +30778,7 @@ static void REGAL_CALL emu_glUniform3fv(GLint location, GLsizei count, const GLf
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( _context->iff->currinst ) {
           _context->iff->Uniform( _context, 3, location, count, value );
         } else {
@@ -29181,6 +30856,7 @@ static void REGAL_CALL emu_glUniform3i(GLint location, GLint v0, GLint v1, GLint
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( _context->iff->currinst ) {
           _context->iff->Uniform( _context, 3, location, 1, v0, v1, v2 );
         } else {
@@ -29258,6 +30934,7 @@ static void REGAL_CALL emu_glUniform3iv(GLint location, GLsizei count, const GLi
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( _context->iff->currinst ) {
           _context->iff->Uniform( _context, 3, location, count, value );
         } else {
@@ -29335,6 +31012,7 @@ static void REGAL_CALL emu_glUniform4f(GLint location, GLfloat v0, GLfloat v1, G
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( _context->iff->currinst ) {
           _context->iff->Uniform( _context, 4, location, 1, v0, v1, v2, v3 );
         } else {
@@ -29412,6 +31090,7 @@ static void REGAL_CALL emu_glUniform4fv(GLint location, GLsizei count, const GLf
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( _context->iff->currinst ) {
           _context->iff->Uniform( _context, 4, location, count, value );
         } else {
@@ -29489,6 +31168,7 @@ static void REGAL_CALL emu_glUniform4i(GLint location, GLint v0, GLint v1, GLint
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( _context->iff->currinst ) {
           _context->iff->Uniform( _context, 4, location, 1, v0, v1, v2, v3 );
         } else {
@@ -29566,6 +31246,7 @@ static void REGAL_CALL emu_glUniform4iv(GLint location, GLsizei count, const GLi
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( _context->iff->currinst ) {
           _context->iff->Uniform( _context, 4, location, count, value );
         } else {
@@ -29643,6 +31324,7 @@ static void REGAL_CALL emu_glUniformMatrix2fv(GLint location, GLsizei count, GLb
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( _context->iff->currinst ) {
           _context->iff->UniformMatrix( _context, 2, 2, location, count, transpose, value );
         } else {
@@ -29720,6 +31402,7 @@ static void REGAL_CALL emu_glUniformMatrix3fv(GLint location, GLsizei count, GLb
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( _context->iff->currinst ) {
           _context->iff->UniformMatrix( _context, 3, 3, location, count, transpose, value );
         } else {
@@ -29797,6 +31480,7 @@ static void REGAL_CALL emu_glUniformMatrix4fv(GLint location, GLsizei count, GLb
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( _context->iff->currinst ) {
           _context->iff->UniformMatrix( _context, 4, 4, location, count, transpose, value );
         } else {
@@ -29869,6 +31553,7 @@ static void REGAL_CALL emu_glUseProgram(GLuint program)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( ! _context->iff->ShadowUseProgram( program ) ) {
             _context->dispatcher.emulation.glUseProgram( program );
         }
@@ -31311,6 +32996,7 @@ static void REGAL_CALL emu_glUniformMatrix2x3fv(GLint location, GLsizei count, G
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( _context->iff->currinst ) {
           _context->iff->UniformMatrix( _context, 2, 3, location, count, transpose, value );
         } else {
@@ -31388,6 +33074,7 @@ static void REGAL_CALL emu_glUniformMatrix2x4fv(GLint location, GLsizei count, G
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( _context->iff->currinst ) {
           _context->iff->UniformMatrix( _context, 2, 4, location, count, transpose, value );
         } else {
@@ -31465,6 +33152,7 @@ static void REGAL_CALL emu_glUniformMatrix3x2fv(GLint location, GLsizei count, G
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( _context->iff->currinst ) {
           _context->iff->UniformMatrix( _context, 3, 2, location, count, transpose, value );
         } else {
@@ -31542,6 +33230,7 @@ static void REGAL_CALL emu_glUniformMatrix3x4fv(GLint location, GLsizei count, G
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( _context->iff->currinst ) {
           _context->iff->UniformMatrix( _context, 3, 4, location, count, transpose, value );
         } else {
@@ -31619,6 +33308,7 @@ static void REGAL_CALL emu_glUniformMatrix4x2fv(GLint location, GLsizei count, G
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( _context->iff->currinst ) {
           _context->iff->UniformMatrix( _context, 4, 2, location, count, transpose, value );
         } else {
@@ -31696,6 +33386,7 @@ static void REGAL_CALL emu_glUniformMatrix4x3fv(GLint location, GLsizei count, G
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( _context->iff->currinst ) {
           _context->iff->UniformMatrix( _context, 4, 3, location, count, transpose, value );
         } else {
@@ -31719,6 +33410,47 @@ static void REGAL_CALL emu_glUniformMatrix4x3fv(GLint location, GLsizei count, G
 
 // GL_VERSION_3_0
 
+static void REGAL_CALL emu_glBeginTransformFeedback(GLenum primitiveMode)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->TransformFeedback( true );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glBeginTransformFeedback)(primitiveMode);
+}
+
 static void REGAL_CALL emu_glClampColor(GLenum target, GLenum clamp)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
@@ -31749,6 +33481,154 @@ static void REGAL_CALL emu_glClampColor(GLenum target, GLenum clamp)
   _next->call(& _next->glClampColor)(target, clamp);
 }
 
+static void REGAL_CALL emu_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glClearBufferfi)(buffer, drawbuffer, depth, stencil);
+}
+
+static void REGAL_CALL emu_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glClearBufferfv)(buffer, drawbuffer, value);
+}
+
+static void REGAL_CALL emu_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glClearBufferiv)(buffer, drawbuffer, value);
+}
+
+static void REGAL_CALL emu_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glClearBufferuiv)(buffer, drawbuffer, value);
+}
+
 static void REGAL_CALL emu_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
@@ -31854,6 +33734,7 @@ static void REGAL_CALL emu_glDisablei(GLenum target, GLuint index)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->DisableIndexed( target, index );
         return;
       }
@@ -31946,6 +33827,7 @@ static void REGAL_CALL emu_glEnablei(GLenum target, GLuint index)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->EnableIndexed( target, index );
         return;
       }
@@ -31963,6 +33845,47 @@ static void REGAL_CALL emu_glEnablei(GLenum target, GLuint index)
 
 }
 
+static void REGAL_CALL emu_glEndTransformFeedback(void)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->TransformFeedback( false );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glEndTransformFeedback)();
+}
+
 static void REGAL_CALL emu_glGetBooleani_v(GLenum target, GLuint index, GLboolean *data)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
@@ -32251,6 +34174,14 @@ static void REGAL_CALL emu_glTexParameterIiv(GLenum target, GLenum pname, const
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
       #if REGAL_EMU_SO
@@ -32320,6 +34251,14 @@ static void REGAL_CALL emu_glTexParameterIuiv(GLenum target, GLenum pname, const
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
       #if REGAL_EMU_SO
@@ -32426,6 +34365,7 @@ static void REGAL_CALL emu_glUniform1ui(GLint location, GLuint v0)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( _context->iff->currinst ) {
           _context->iff->Uniform( _context, 1, location, 1, v0 );
         } else {
@@ -32503,6 +34443,7 @@ static void REGAL_CALL emu_glUniform1uiv(GLint location, GLsizei count, const GL
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( _context->iff->currinst ) {
           _context->iff->Uniform( _context, 1, location, count, value );
         } else {
@@ -32580,6 +34521,7 @@ static void REGAL_CALL emu_glUniform2ui(GLint location, GLuint v0, GLuint v1)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( _context->iff->currinst ) {
           _context->iff->Uniform( _context, 2, location, 1, v0, v1 );
         } else {
@@ -32657,6 +34599,7 @@ static void REGAL_CALL emu_glUniform2uiv(GLint location, GLsizei count, const GL
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( _context->iff->currinst ) {
           _context->iff->Uniform( _context, 2, location, count, value );
         } else {
@@ -32734,6 +34677,7 @@ static void REGAL_CALL emu_glUniform3ui(GLint location, GLuint v0, GLuint v1, GL
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( _context->iff->currinst ) {
           _context->iff->Uniform( _context, 3, location, 1, v0, v1, v2 );
         } else {
@@ -32811,6 +34755,7 @@ static void REGAL_CALL emu_glUniform3uiv(GLint location, GLsizei count, const GL
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( _context->iff->currinst ) {
           _context->iff->Uniform( _context, 3, location, count, value );
         } else {
@@ -32888,6 +34833,7 @@ static void REGAL_CALL emu_glUniform4ui(GLint location, GLuint v0, GLuint v1, GL
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( _context->iff->currinst ) {
           _context->iff->Uniform( _context, 4, location, 1, v0, v1, v2, v3 );
         } else {
@@ -32965,6 +34911,7 @@ static void REGAL_CALL emu_glUniform4uiv(GLint location, GLsizei count, const GL
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( _context->iff->currinst ) {
           _context->iff->Uniform( _context, 4, location, count, value );
         } else {
@@ -33097,6 +35044,7 @@ static void REGAL_CALL emu_glDrawArraysInstanced(GLenum mode, GLint first, GLsiz
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
         _context->iff->PreDraw( _context );
       }
       #endif
@@ -33120,6 +35068,15 @@ static void REGAL_CALL emu_glDrawArraysInstanced(GLenum mode, GLint first, GLsiz
         _context->dsa->Restore( _context );
       }
       #endif
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->DrawArrays(*_context, first, count );
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -33154,6 +35111,7 @@ static void REGAL_CALL emu_glDrawElementsInstanced(GLenum mode, GLsizei count, G
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
         _context->iff->PreDraw( _context );
       }
       #endif
@@ -33177,14 +35135,54 @@ static void REGAL_CALL emu_glDrawElementsInstanced(GLenum mode, GLsizei count, G
         _context->dsa->Restore( _context );
       }
       #endif
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao) break;
+      #endif
     case 1 :
     default:
       break;
   }
 
-  DispatchTableGL *_next = _dispatch.next();
-  RegalAssert(_next);
-  _next->call(& _next->glDrawElementsInstanced)(mode, count, type, indices, instancecount);
+  // impl
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        if ( !_context->vao->DrawElementsInstanced(*_context, mode, count, type, indices, instancecount ) ) {
+           _context->dispatcher.emulation.glDrawElementsInstanced( mode, count, type, indices, instancecount );
+        }
+        return;
+      }
+      #endif
+    case 1 :
+    default:
+    {
+      DispatchTableGL *_next = _dispatch.next();
+      RegalAssert(_next);
+      _next->call(&_next->glDrawElementsInstanced)(mode, count, type, indices, instancecount);
+      break;
+    }
+
+  }
+
 }
 
 static void REGAL_CALL emu_glPrimitiveRestartIndex(GLuint index)
@@ -33292,6 +35290,14 @@ static void REGAL_CALL emu_glFramebufferTexture(GLenum target, GLenum attachment
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -33380,64 +35386,19 @@ static void REGAL_CALL emu_glBlendEquationSeparatei(GLuint buf, GLenum modeRGB,
         _context->ppa->glBlendEquationSeparatei( buf, modeRGB, modeAlpha );
       }
       #endif
-    case 1 :
-    default:
-      break;
-  }
-
-  DispatchTableGL *_next = _dispatch.next();
-  RegalAssert(_next);
-  _next->call(& _next->glBlendEquationSeparatei)(buf, modeRGB, modeAlpha);
-}
-
-static void REGAL_CALL emu_glBlendEquationi(GLuint buf, GLenum mode)
-{
-  RegalContext *_context = REGAL_GET_CONTEXT();
-  RegalAssert(_context);
-  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
-
-  // prefix
-  switch( _context->emuLevel )
-  {
-    case 16 :
-    case 15 :
-    case 14 :
-      #if REGAL_EMU_PPA
-      if (_context->ppa)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 13;
-        _context->ppa->glBlendEquationi( buf, mode );
-      }
-      #endif
-    case 1 :
-    default:
-      break;
-  }
-
-  DispatchTableGL *_next = _dispatch.next();
-  RegalAssert(_next);
-  _next->call(& _next->glBlendEquationi)(buf, mode);
-}
-
-static void REGAL_CALL emu_glBlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
-{
-  RegalContext *_context = REGAL_GET_CONTEXT();
-  RegalAssert(_context);
-  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
-
-  // prefix
-  switch( _context->emuLevel )
-  {
-    case 16 :
-    case 15 :
-    case 14 :
-      #if REGAL_EMU_PPA
-      if (_context->ppa)
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 13;
-        _context->ppa->glBlendFuncSeparatei( buf, srcRGB, dstRGB, srcAlpha, dstAlpha );
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
       }
       #endif
     case 1 :
@@ -33447,10 +35408,10 @@ static void REGAL_CALL emu_glBlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenu
 
   DispatchTableGL *_next = _dispatch.next();
   RegalAssert(_next);
-  _next->call(& _next->glBlendFuncSeparatei)(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+  _next->call(& _next->glBlendEquationSeparatei)(buf, modeRGB, modeAlpha);
 }
 
-static void REGAL_CALL emu_glBlendFunci(GLuint buf, GLenum src, GLenum dst)
+static void REGAL_CALL emu_glBlendEquationi(GLuint buf, GLenum mode)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -33467,31 +35428,9 @@ static void REGAL_CALL emu_glBlendFunci(GLuint buf, GLenum src, GLenum dst)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 13;
-        _context->ppa->glBlendFunci( buf, src, dst );
+        _context->ppa->glBlendEquationi( buf, mode );
       }
       #endif
-    case 1 :
-    default:
-      break;
-  }
-
-  DispatchTableGL *_next = _dispatch.next();
-  RegalAssert(_next);
-  _next->call(& _next->glBlendFunci)(buf, src, dst);
-}
-
-static void REGAL_CALL emu_glDrawArraysIndirect(GLenum mode, const GLvoid *indirect)
-{
-  RegalContext *_context = REGAL_GET_CONTEXT();
-  RegalAssert(_context);
-  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
-
-  // prefix
-  switch( _context->emuLevel )
-  {
-    case 16 :
-    case 15 :
-    case 14 :
     case 13 :
     case 12 :
     case 11 :
@@ -33504,27 +35443,7 @@ static void REGAL_CALL emu_glDrawArraysIndirect(GLenum mode, const GLvoid *indir
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->PreDraw( _context );
-      }
-      #endif
-    case 6 :
-    case 5 :
-      #if REGAL_EMU_SO
-      if (_context->so)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 4;
-        RegalAssert(_context);
-        _context->so->PreDraw( *_context );
-      }
-      #endif
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        _context->dsa->Restore( _context );
+        _context->iff->FlushBatch( _context );
       }
       #endif
     case 1 :
@@ -33534,10 +35453,10 @@ static void REGAL_CALL emu_glDrawArraysIndirect(GLenum mode, const GLvoid *indir
 
   DispatchTableGL *_next = _dispatch.next();
   RegalAssert(_next);
-  _next->call(& _next->glDrawArraysIndirect)(mode, indirect);
+  _next->call(& _next->glBlendEquationi)(buf, mode);
 }
 
-static void REGAL_CALL emu_glDrawElementsIndirect(GLenum mode, GLenum type, const GLvoid *indirect)
+static void REGAL_CALL emu_glBlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -33549,6 +35468,14 @@ static void REGAL_CALL emu_glDrawElementsIndirect(GLenum mode, GLenum type, cons
     case 16 :
     case 15 :
     case 14 :
+      #if REGAL_EMU_PPA
+      if (_context->ppa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 13;
+        _context->ppa->glBlendFuncSeparatei( buf, srcRGB, dstRGB, srcAlpha, dstAlpha );
+      }
+      #endif
     case 13 :
     case 12 :
     case 11 :
@@ -33561,27 +35488,7 @@ static void REGAL_CALL emu_glDrawElementsIndirect(GLenum mode, GLenum type, cons
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->PreDraw( _context );
-      }
-      #endif
-    case 6 :
-    case 5 :
-      #if REGAL_EMU_SO
-      if (_context->so)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 4;
-        RegalAssert(_context);
-        _context->so->PreDraw( *_context );
-      }
-      #endif
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        _context->dsa->Restore( _context );
+        _context->iff->FlushBatch( _context );
       }
       #endif
     case 1 :
@@ -33591,10 +35498,10 @@ static void REGAL_CALL emu_glDrawElementsIndirect(GLenum mode, GLenum type, cons
 
   DispatchTableGL *_next = _dispatch.next();
   RegalAssert(_next);
-  _next->call(& _next->glDrawElementsIndirect)(mode, type, indirect);
+  _next->call(& _next->glBlendFuncSeparatei)(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
 }
 
-static void REGAL_CALL emu_glMinSampleShading(GLclampf value)
+static void REGAL_CALL emu_glBlendFunci(GLuint buf, GLenum src, GLenum dst)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -33611,41 +35518,9 @@ static void REGAL_CALL emu_glMinSampleShading(GLclampf value)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 13;
-        _context->ppa->glMinSampleShading( value );
+        _context->ppa->glBlendFunci( buf, src, dst );
       }
       #endif
-    case 1 :
-    default:
-      break;
-  }
-
-  DispatchTableGL *_next = _dispatch.next();
-  RegalAssert(_next);
-  _next->call(& _next->glMinSampleShading)(value);
-}
-
-// GL_3DFX_tbuffer
-
-// GL_AMD_debug_output
-
-// GL_AMD_draw_buffers_blend
-
-// GL_AMD_interleaved_elements
-
-// GL_AMD_multi_draw_indirect
-
-static void REGAL_CALL emu_glMultiDrawArraysIndirectAMD(GLenum mode, const GLvoid *indirect, GLsizei primcount, GLsizei stride)
-{
-  RegalContext *_context = REGAL_GET_CONTEXT();
-  RegalAssert(_context);
-  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
-
-  // prefix
-  switch( _context->emuLevel )
-  {
-    case 16 :
-    case 15 :
-    case 14 :
     case 13 :
     case 12 :
     case 11 :
@@ -33658,27 +35533,7 @@ static void REGAL_CALL emu_glMultiDrawArraysIndirectAMD(GLenum mode, const GLvoi
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->PreDraw( _context );
-      }
-      #endif
-    case 6 :
-    case 5 :
-      #if REGAL_EMU_SO
-      if (_context->so)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 4;
-        RegalAssert(_context);
-        _context->so->PreDraw( *_context );
-      }
-      #endif
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        _context->dsa->Restore( _context );
+        _context->iff->FlushBatch( _context );
       }
       #endif
     case 1 :
@@ -33688,10 +35543,10 @@ static void REGAL_CALL emu_glMultiDrawArraysIndirectAMD(GLenum mode, const GLvoi
 
   DispatchTableGL *_next = _dispatch.next();
   RegalAssert(_next);
-  _next->call(& _next->glMultiDrawArraysIndirectAMD)(mode, indirect, primcount, stride);
+  _next->call(& _next->glBlendFunci)(buf, src, dst);
 }
 
-static void REGAL_CALL emu_glMultiDrawElementsIndirectAMD(GLenum mode, GLenum type, const GLvoid *indirect, GLsizei primcount, GLsizei stride)
+static void REGAL_CALL emu_glDrawArraysIndirect(GLenum mode, const GLvoid *indirect)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -33715,6 +35570,221 @@ static void REGAL_CALL emu_glMultiDrawElementsIndirectAMD(GLenum mode, GLenum ty
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
+        _context->iff->PreDraw( _context );
+      }
+      #endif
+    case 6 :
+    case 5 :
+      #if REGAL_EMU_SO
+      if (_context->so)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 4;
+        RegalAssert(_context);
+        _context->so->PreDraw( *_context );
+      }
+      #endif
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 3;
+        _context->dsa->Restore( _context );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glDrawArraysIndirect)(mode, indirect);
+}
+
+static void REGAL_CALL emu_glDrawElementsIndirect(GLenum mode, GLenum type, const GLvoid *indirect)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
+        _context->iff->PreDraw( _context );
+      }
+      #endif
+    case 6 :
+    case 5 :
+      #if REGAL_EMU_SO
+      if (_context->so)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 4;
+        RegalAssert(_context);
+        _context->so->PreDraw( *_context );
+      }
+      #endif
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 3;
+        _context->dsa->Restore( _context );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glDrawElementsIndirect)(mode, type, indirect);
+}
+
+static void REGAL_CALL emu_glMinSampleShading(GLclampf value)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+      #if REGAL_EMU_PPA
+      if (_context->ppa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 13;
+        _context->ppa->glMinSampleShading( value );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glMinSampleShading)(value);
+}
+
+// GL_3DFX_tbuffer
+
+// GL_AMD_debug_output
+
+// GL_AMD_draw_buffers_blend
+
+// GL_AMD_interleaved_elements
+
+// GL_AMD_multi_draw_indirect
+
+static void REGAL_CALL emu_glMultiDrawArraysIndirectAMD(GLenum mode, const GLvoid *indirect, GLsizei primcount, GLsizei stride)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
+        _context->iff->PreDraw( _context );
+      }
+      #endif
+    case 6 :
+    case 5 :
+      #if REGAL_EMU_SO
+      if (_context->so)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 4;
+        RegalAssert(_context);
+        _context->so->PreDraw( *_context );
+      }
+      #endif
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 3;
+        _context->dsa->Restore( _context );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glMultiDrawArraysIndirectAMD)(mode, indirect, primcount, stride);
+}
+
+static void REGAL_CALL emu_glMultiDrawElementsIndirectAMD(GLenum mode, GLenum type, const GLvoid *indirect, GLsizei primcount, GLsizei stride)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
         _context->iff->PreDraw( _context );
       }
       #endif
@@ -33876,6 +35946,7 @@ static void REGAL_CALL emu_glDrawElementArrayAPPLE(GLenum mode, GLint first, GLs
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
         _context->iff->PreDraw( _context );
       }
       #endif
@@ -33933,6 +36004,7 @@ static void REGAL_CALL emu_glDrawRangeElementArrayAPPLE(GLenum mode, GLuint star
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
         _context->iff->PreDraw( _context );
       }
       #endif
@@ -33981,6 +36053,7 @@ static void REGAL_CALL emu_glMultiDrawElementArrayAPPLE(GLenum mode, const GLint
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
         _context->iff->PreDraw( _context );
       }
       #endif
@@ -34038,6 +36111,7 @@ static void REGAL_CALL emu_glMultiDrawRangeElementArrayAPPLE(GLenum mode, GLuint
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
         _context->iff->PreDraw( _context );
       }
       #endif
@@ -34066,6 +36140,47 @@ static void REGAL_CALL emu_glMultiDrawRangeElementArrayAPPLE(GLenum mode, GLuint
 
 // GL_APPLE_flush_buffer_range
 
+static void REGAL_CALL emu_glFlushMappedBufferRangeAPPLE(GLenum target, GLintptr offset, GLsizeiptr size)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glFlushMappedBufferRangeAPPLE)(target, offset, size);
+}
+
 // GL_APPLE_flush_render
 
 // GL_APPLE_framebuffer_multisample
@@ -34102,6 +36217,7 @@ static void REGAL_CALL emu_glBindVertexArrayAPPLE(GLuint array)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
         _context->iff->glBindVertexArray( _context, array );
       }
       #endif
@@ -34181,6 +36297,21 @@ static void REGAL_CALL emu_glClearDepthf(GLclampf d)
         _context->ppa->glClearDepth( d );
       }
       #endif
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -34277,6 +36408,119 @@ static void REGAL_CALL emu_glShaderBinary(GLsizei count, const GLuint *shaders,
 
 // GL_ARB_base_instance
 
+static void REGAL_CALL emu_glDrawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count, GLsizei primcount, GLuint baseinstance)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->DrawArrays(*_context, first, count );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glDrawArraysInstancedBaseInstance)(mode, first, count, primcount, baseinstance);
+}
+
+static void REGAL_CALL emu_glDrawElementsInstancedBaseInstance(GLenum mode, GLsizei count, GLenum type, const GLvoid *indices, GLsizei primcount, GLuint baseinstance)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao) break;
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  // impl
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        if ( !_context->vao->DrawElementsInstancedBaseInstance(*_context, mode, count, type, indices, primcount, baseinstance ) ) {
+           _context->dispatcher.emulation.glDrawElementsInstancedBaseInstance( mode, count, type, indices, primcount, baseinstance );
+        }
+        return;
+      }
+      #endif
+    case 1 :
+    default:
+    {
+      DispatchTableGL *_next = _dispatch.next();
+      RegalAssert(_next);
+      _next->call(&_next->glDrawElementsInstancedBaseInstance)(mode, count, type, indices, primcount, baseinstance);
+      break;
+    }
+
+  }
+
+}
+
 static void REGAL_CALL emu_glDrawElementsInstancedBaseVertexBaseInstance(GLenum mode, GLsizei count, GLenum type, const GLvoid *indices, GLsizei primcount, GLint basevertex, GLuint baseinstance)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
@@ -34297,6 +36541,15 @@ static void REGAL_CALL emu_glDrawElementsInstancedBaseVertexBaseInstance(GLenum
       #if REGAL_EMU_BASEVERTEX
       if (_context->bv) break;
       #endif
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao) break;
+      #endif
     case 1 :
     default:
       break;
@@ -34324,6 +36577,23 @@ static void REGAL_CALL emu_glDrawElementsInstancedBaseVertexBaseInstance(GLenum
         return;
       }
       #endif
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        if ( !_context->vao->DrawElementsInstancedBaseVertexBaseInstance(*_context, mode, count, type, indices, primcount, basevertex, baseinstance ) ) {
+           _context->dispatcher.emulation.glDrawElementsInstancedBaseVertexBaseInstance( mode, count, type, indices, primcount, basevertex, baseinstance );
+        }
+        return;
+      }
+      #endif
     case 1 :
     default:
     {
@@ -34343,10 +36613,256 @@ static void REGAL_CALL emu_glDrawElementsInstancedBaseVertexBaseInstance(GLenum
 
 // GL_ARB_buffer_storage
 
+static void REGAL_CALL emu_glBufferStorage(GLenum target, GLsizeiptr size, const GLvoid *data, GLbitfield flags)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glBufferStorage)(target, size, data, flags);
+}
+
+static void REGAL_CALL emu_glNamedBufferStorageEXT(GLuint buffer, GLsizeiptr size, const GLvoid *data, GLbitfield flags)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glNamedBufferStorageEXT)(buffer, size, data, flags);
+}
+
 // GL_ARB_cl_event
 
 // GL_ARB_clear_buffer_object
 
+static void REGAL_CALL emu_glClearBufferData(GLenum target, GLenum internalformat, GLenum format, GLenum type, const GLvoid *data)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glClearBufferData)(target, internalformat, format, type, data);
+}
+
+static void REGAL_CALL emu_glClearBufferSubData(GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const GLvoid *data)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glClearBufferSubData)(target, internalformat, offset, size, format, type, data);
+}
+
+static void REGAL_CALL emu_glClearNamedBufferDataEXT(GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const GLvoid *data)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glClearNamedBufferDataEXT)(buffer, internalformat, format, type, data);
+}
+
+static void REGAL_CALL emu_glClearNamedBufferSubDataEXT(GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const GLvoid *data)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glClearNamedBufferSubDataEXT)(buffer, internalformat, offset, size, format, type, data);
+}
+
 // GL_ARB_clear_texture
 
 // GL_ARB_clip_control
@@ -34389,6 +36905,15 @@ static void REGAL_CALL emu_glCopyBufferSubData(GLenum readtarget, GLenum writeta
         _context->dsa->RestoreBuffer( _context );
       }
       #endif
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -34403,11 +36928,2244 @@ static void REGAL_CALL emu_glCopyBufferSubData(GLenum readtarget, GLenum writeta
 
 // GL_ARB_debug_output
 
-// GL_ARB_direct_state_access
+// GL_ARB_direct_state_access
+
+static void REGAL_CALL emu_glClearNamedBufferData(GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const GLvoid *data)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glClearNamedBufferData)(buffer, internalformat, format, type, data);
+}
+
+static void REGAL_CALL emu_glClearNamedBufferSubData(GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const GLvoid *data)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glClearNamedBufferSubData)(buffer, internalformat, offset, size, format, type, data);
+}
+
+static void REGAL_CALL emu_glCopyNamedBufferSubData(GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glCopyNamedBufferSubData)(readBuffer, writeBuffer, readOffset, writeOffset, size);
+}
+
+static void REGAL_CALL emu_glFlushMappedNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glFlushMappedNamedBufferRange)(buffer, offset, length);
+}
+
+static void REGAL_CALL emu_glGetCompressedTextureImage(GLuint texture, GLint level, GLsizei bufSize, GLvoid *pixels)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glGetCompressedTextureImage)(texture, level, bufSize, pixels);
+}
+
+static void REGAL_CALL emu_glGetTextureImage(GLuint texture, GLint level, GLenum format, GLenum type, GLsizei bufSize, GLvoid *pixels)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glGetTextureImage)(texture, level, format, type, bufSize, pixels);
+}
+
+static GLvoid *REGAL_CALL emu_glMapNamedBuffer(GLuint buffer, GLenum access)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  return _next->call(& _next->glMapNamedBuffer)(buffer, access);
+}
+
+static GLvoid *REGAL_CALL emu_glMapNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->MapBufferRange( access );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  return _next->call(& _next->glMapNamedBufferRange)(buffer, offset, length, access);
+}
+
+static void REGAL_CALL emu_glNamedBufferData(GLuint buffer, GLsizeiptr size, const GLvoid *data, GLenum usage)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glNamedBufferData)(buffer, size, data, usage);
+}
+
+static void REGAL_CALL emu_glNamedBufferStorage(GLuint buffer, GLsizeiptr size, const GLvoid *data, GLbitfield flags)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glNamedBufferStorage)(buffer, size, data, flags);
+}
+
+static void REGAL_CALL emu_glNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, const GLvoid *data)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glNamedBufferSubData)(buffer, offset, size, data);
+}
+
+static GLboolean REGAL_CALL emu_glUnmapNamedBuffer(GLuint buffer)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  return _next->call(& _next->glUnmapNamedBuffer)(buffer);
+}
+
+// GL_ARB_draw_buffers
+
+static void REGAL_CALL emu_glDrawBuffersARB(GLsizei n, const GLenum *bufs)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+      #if REGAL_EMU_PPA
+      if (_context->ppa) break;
+      #endif
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+    case 2 :
+    case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt) break;
+      #endif
+    default:
+      break;
+  }
+
+  // impl
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+      #if REGAL_EMU_PPA
+      if (_context->ppa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 13;
+        if( !_context->isES2() ) {
+          _context->ppa->glDrawBuffers( n, bufs );
+          _context->dispatcher.emulation.glDrawBuffers( n, bufs );
+        }
+        return;
+      }
+      #endif
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+    case 2 :
+    case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 0;
+        if (!_context->info->gl_arb_draw_buffers)
+        {
+          DispatchTableGL &_table = _context->dispatcher.emulation;
+          _context->emuLevel++;
+          _table.call(&_table.glDrawBuffers)(n, bufs);
+          return;
+        }
+      }
+      #endif
+    default:
+    {
+      DispatchTableGL *_next = _dispatch.next();
+      RegalAssert(_next);
+      _next->call(&_next->glDrawBuffersARB)(n, bufs);
+      break;
+    }
+
+  }
+
+}
+
+// GL_ARB_draw_buffers_blend
+
+static void REGAL_CALL emu_glBlendEquationSeparateiARB(GLuint buf, GLenum modeRGB, GLenum modeAlpha)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glBlendEquationSeparateiARB)(buf, modeRGB, modeAlpha);
+}
+
+static void REGAL_CALL emu_glBlendEquationiARB(GLuint buf, GLenum mode)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glBlendEquationiARB)(buf, mode);
+}
+
+static void REGAL_CALL emu_glBlendFuncSeparateiARB(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glBlendFuncSeparateiARB)(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+}
+
+static void REGAL_CALL emu_glBlendFunciARB(GLuint buf, GLenum src, GLenum dst)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glBlendFunciARB)(buf, src, dst);
+}
+
+// GL_ARB_draw_elements_base_vertex
+
+static void REGAL_CALL emu_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const GLvoid *indices, GLint basevertex)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+      #if REGAL_EMU_BASEVERTEX
+      if (_context->bv) break;
+      #endif
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
+        _context->iff->PreDraw( _context );
+      }
+      #endif
+    case 6 :
+    case 5 :
+      #if REGAL_EMU_SO
+      if (_context->so)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 4;
+        RegalAssert(_context);
+        _context->so->PreDraw( *_context );
+      }
+      #endif
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 3;
+        _context->dsa->Restore( _context );
+      }
+      #endif
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao) break;
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  // impl
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+      #if REGAL_EMU_BASEVERTEX
+      if (_context->bv)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 8;
+        if( ! _context->bv->glDrawElementsBaseVertex( *_context, mode, count, type, indices, basevertex ) ) {
+          _context->dispatcher.emulation.glDrawElementsBaseVertex( mode, count, type, indices, basevertex );
+        }
+        return;
+      }
+      #endif
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        if ( !_context->vao->DrawElementsBaseVertex(*_context, mode, count, type, indices, basevertex ) ) {
+           _context->dispatcher.emulation.glDrawElementsBaseVertex( mode, count, type, indices, basevertex );
+        }
+        return;
+      }
+      #endif
+    case 1 :
+    default:
+    {
+      DispatchTableGL *_next = _dispatch.next();
+      RegalAssert(_next);
+      _next->call(&_next->glDrawElementsBaseVertex)(mode, count, type, indices, basevertex);
+      break;
+    }
+
+  }
+
+}
+
+static void REGAL_CALL emu_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const GLvoid *indices, GLsizei primcount, GLint basevertex)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+      #if REGAL_EMU_BASEVERTEX
+      if (_context->bv) break;
+      #endif
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
+        _context->iff->PreDraw( _context );
+      }
+      #endif
+    case 6 :
+    case 5 :
+      #if REGAL_EMU_SO
+      if (_context->so)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 4;
+        RegalAssert(_context);
+        _context->so->PreDraw( *_context );
+      }
+      #endif
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 3;
+        _context->dsa->Restore( _context );
+      }
+      #endif
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao) break;
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  // impl
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+      #if REGAL_EMU_BASEVERTEX
+      if (_context->bv)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 8;
+        if( ! _context->bv->glDrawElementsInstancedBaseVertex( *_context, mode, count, type, indices, primcount, basevertex ) ) {
+          _context->dispatcher.emulation.glDrawElementsInstancedBaseVertex( mode, count, type, indices, primcount, basevertex );
+        }
+        return;
+      }
+      #endif
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        if ( !_context->vao->DrawElementsInstancedBaseVertex(*_context, mode, count, type, indices, primcount, basevertex ) ) {
+           _context->dispatcher.emulation.glDrawElementsInstancedBaseVertex( mode, count, type, indices, primcount, basevertex );
+        }
+        return;
+      }
+      #endif
+    case 1 :
+    default:
+    {
+      DispatchTableGL *_next = _dispatch.next();
+      RegalAssert(_next);
+      _next->call(&_next->glDrawElementsInstancedBaseVertex)(mode, count, type, indices, primcount, basevertex);
+      break;
+    }
+
+  }
+
+}
+
+static void REGAL_CALL emu_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const GLvoid *indices, GLint basevertex)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+      #if REGAL_EMU_BASEVERTEX
+      if (_context->bv) break;
+      #endif
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
+        _context->iff->PreDraw( _context );
+      }
+      #endif
+    case 6 :
+    case 5 :
+      #if REGAL_EMU_SO
+      if (_context->so)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 4;
+        RegalAssert(_context);
+        _context->so->PreDraw( *_context );
+      }
+      #endif
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao) break;
+      #endif
+    case 2 :
+    case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt) break;
+      #endif
+    default:
+      break;
+  }
+
+  // impl
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+      #if REGAL_EMU_BASEVERTEX
+      if (_context->bv)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 8;
+        if( ! _context->bv->glDrawRangeElementsBaseVertex( *_context, mode, start, end, count, type, indices, basevertex ) ) {
+          _context->dispatcher.emulation.glDrawRangeElementsBaseVertex( mode, start, end, count, type, indices, basevertex );
+        }
+        return;
+      }
+      #endif
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        if ( !_context->vao->DrawRangeElementsBaseVertex(*_context, mode, start, end, count, type, indices, basevertex ) ) {
+           _context->dispatcher.emulation.glDrawRangeElementsBaseVertex( mode, start, end, count, type, indices, basevertex );
+        }
+        return;
+      }
+      #endif
+    case 2 :
+    case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 0;
+        // WAR: Our Tegra driver GL 4 core profile supports DrawRangeElementsBaseVertex but does not
+        // advertise ARB_draw_elements_base_vertex in the extension list so here we check whether the
+        // driver has glDrawRangeElementsBaseVertex instead of looking for the extension flag.
+        //   (leaving original line here, just commented out)
+        //   if (REGAL_FORCE_ES2_PROFILE || !_context->info->gl_arb_draw_elements_base_vertex)
+        if (REGAL_FORCE_ES2_PROFILE || !_context->dispatcher.driver.glDrawRangeElementsBaseVertex)
+        {
+          if (basevertex==0)
+          {
+            DispatchTableGL *_next = _context->dispatcher.emulation.next();
+            RegalAssert(_next);
+            return _next->call(&_next->glDrawElements)(mode, count, type, indices);
+          }
+          else
+          {
+            Warning("Regal does not support glDrawRangeElementsBaseVertex (GL_ARB_draw_elements_base_vertex extension not available) for basevertex!=0 - skipping.");
+            return;
+          }
+        }
+      }
+      #endif
+    default:
+    {
+      DispatchTableGL *_next = _dispatch.next();
+      RegalAssert(_next);
+      _next->call(&_next->glDrawRangeElementsBaseVertex)(mode, start, end, count, type, indices, basevertex);
+      break;
+    }
+
+  }
+
+}
+
+static void REGAL_CALL emu_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const GLvoid * const *indices, GLsizei primcount, const GLint *basevertex)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+      #if REGAL_EMU_BASEVERTEX
+      if (_context->bv) break;
+      #endif
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
+        _context->iff->PreDraw( _context );
+      }
+      #endif
+    case 6 :
+    case 5 :
+      #if REGAL_EMU_SO
+      if (_context->so)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 4;
+        RegalAssert(_context);
+        _context->so->PreDraw( *_context );
+      }
+      #endif
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 3;
+        _context->dsa->Restore( _context );
+      }
+      #endif
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao) break;
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  // impl
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+      #if REGAL_EMU_BASEVERTEX
+      if (_context->bv)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 8;
+        if( ! _context->bv->glMultiDrawElementsBaseVertex( *_context, mode, count, type, indices, primcount, basevertex ) ) {
+          _context->dispatcher.emulation.glMultiDrawElementsBaseVertex( mode, count, type, indices, primcount, basevertex );
+        }
+        return;
+      }
+      #endif
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        if ( !_context->vao->MultiDrawElementsBaseVertex(*_context, mode, count, type, indices, primcount, basevertex ) ) {
+           _context->dispatcher.emulation.glMultiDrawElementsBaseVertex( mode, count, type, indices, primcount, basevertex );
+        }
+        return;
+      }
+      #endif
+    case 1 :
+    default:
+    {
+      DispatchTableGL *_next = _dispatch.next();
+      RegalAssert(_next);
+      _next->call(&_next->glMultiDrawElementsBaseVertex)(mode, count, type, indices, primcount, basevertex);
+      break;
+    }
+
+  }
+
+}
+
+// GL_ARB_draw_instanced
+
+static void REGAL_CALL emu_glDrawArraysInstancedARB(GLenum mode, GLint first, GLsizei count, GLsizei primcount)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
+        _context->iff->PreDraw( _context );
+      }
+      #endif
+    case 6 :
+    case 5 :
+      #if REGAL_EMU_SO
+      if (_context->so)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 4;
+        RegalAssert(_context);
+        _context->so->PreDraw( *_context );
+      }
+      #endif
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 3;
+        _context->dsa->Restore( _context );
+      }
+      #endif
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->DrawArrays(*_context, first, count );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glDrawArraysInstancedARB)(mode, first, count, primcount);
+}
+
+static void REGAL_CALL emu_glDrawElementsInstancedARB(GLenum mode, GLsizei count, GLenum type, const GLvoid *indices, GLsizei primcount)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
+        _context->iff->PreDraw( _context );
+      }
+      #endif
+    case 6 :
+    case 5 :
+      #if REGAL_EMU_SO
+      if (_context->so)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 4;
+        RegalAssert(_context);
+        _context->so->PreDraw( *_context );
+      }
+      #endif
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 3;
+        _context->dsa->Restore( _context );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glDrawElementsInstancedARB)(mode, count, type, indices, primcount);
+}
+
+// GL_ARB_framebuffer_no_attachments
+
+// GL_ARB_framebuffer_object
+
+static void REGAL_CALL emu_glBindFramebuffer(GLenum target, GLuint framebuffer)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 6 :
+    case 5 :
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa) break;
+      #endif
+    case 3 :
+    case 2 :
+    case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt) break;
+      #endif
+    default:
+      break;
+  }
+
+  // impl
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 3;
+        if (!_context->dsa->ShadowFramebuffer( target, framebuffer ) ) {
+            _dispatch.call(&_dispatch.glBindFramebuffer)( target, framebuffer );
+        }
+        return;
+      }
+      #endif
+    case 3 :
+    case 2 :
+    case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 0;
+        if (_context->isES2())
+        {
+          const bool hasFBBlit = _context->info->gl_ext_framebuffer_blit || _context->info->gl_nv_framebuffer_blit || _context->info->gl_version_major >= 3;
+          if (!hasFBBlit && (target==GL_DRAW_FRAMEBUFFER || target==GL_READ_FRAMEBUFFER)) target = GL_FRAMEBUFFER;
+        }
+        if (_context->filt->BindFramebuffer(*_context, target, framebuffer))
+        {
+          #if REGAL_BREAK
+          Break::Filter();
+          #endif
+          return ;
+        }
+      }
+      #endif
+    default:
+    {
+      DispatchTableGL *_next = _dispatch.next();
+      RegalAssert(_next);
+      _next->call(&_next->glBindFramebuffer)(target, framebuffer);
+      break;
+    }
+
+  }
+
+}
+
+static void REGAL_CALL emu_glBindRenderbuffer(GLenum target, GLuint renderbuffer)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 6 :
+    case 5 :
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa) break;
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  // impl
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 3;
+        if (!_context->dsa->ShadowRenderbuffer( target, renderbuffer ) ) {
+            _dispatch.call(&_dispatch.glBindRenderbuffer)( target, renderbuffer );
+        }
+        return;
+      }
+      #endif
+    case 1 :
+    default:
+    {
+      DispatchTableGL *_next = _dispatch.next();
+      RegalAssert(_next);
+      _next->call(&_next->glBindRenderbuffer)(target, renderbuffer);
+      break;
+    }
+
+  }
+
+}
+
+static void REGAL_CALL emu_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+    case 2 :
+    case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt) break;
+      #endif
+    default:
+      break;
+  }
+
+  // impl
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+    case 2 :
+    case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 0;
+        if (_context->isES2())
+        {
+          DispatchTableGL *_next = _context->dispatcher.emulation.next();
+          RegalAssert(_next);
+          if (_context->info->gl_nv_framebuffer_blit)  return _next->call(&_next->glBlitFramebufferNV)(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+          if (_context->info->gl_ext_framebuffer_blit) return _next->call(&_next->glBlitFramebufferEXT)(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+        }
+      }
+      #endif
+    default:
+    {
+      DispatchTableGL *_next = _dispatch.next();
+      RegalAssert(_next);
+      _next->call(&_next->glBlitFramebuffer)(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+      break;
+    }
+
+  }
+
+}
+
+static void REGAL_CALL emu_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 3;
+        _context->dsa->DeleteFramebuffers( _context, n, framebuffers );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glDeleteFramebuffers)(n, framebuffers);
+}
+
+static void REGAL_CALL emu_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 3;
+        _context->dsa->DeleteRenderbuffers( _context, n, renderbuffers );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glDeleteRenderbuffers)(n, renderbuffers);
+}
+
+static void REGAL_CALL emu_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 6 :
+    case 5 :
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 3;
+        _context->dsa->RestoreFramebuffer( _context );
+      }
+      #endif
+    case 3 :
+    case 2 :
+    case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt) break;
+      #endif
+    default:
+      break;
+  }
+
+  // impl
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+    case 2 :
+    case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 0;
+        DispatchTableGL *_next = _context->dispatcher.emulation.next();
+        RegalAssert(_next);
+        if (_context->filt->FramebufferAttachmentSupported(*_context, attachment))
+          _next->call(&_next->glFramebufferRenderbuffer)(target, attachment, renderbuffertarget, renderbuffer);
+        return;
+      }
+      #endif
+    default:
+    {
+      DispatchTableGL *_next = _dispatch.next();
+      RegalAssert(_next);
+      _next->call(&_next->glFramebufferRenderbuffer)(target, attachment, renderbuffertarget, renderbuffer);
+      break;
+    }
+
+  }
+
+}
+
+static void REGAL_CALL emu_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+      #if REGAL_EMU_OBJ
+      if (_context->obj) break;
+      #endif
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 6 :
+    case 5 :
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 3;
+        _context->dsa->RestoreFramebuffer( _context );
+      }
+      #endif
+    case 3 :
+    case 2 :
+    case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt) break;
+      #endif
+    default:
+      break;
+  }
+
+  // impl
+  switch( _context->emuLevel )
+  {
+    case 16 :
+      #if REGAL_EMU_OBJ
+      if (_context->obj)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 15;
+        _dispatch.call(&_dispatch.glFramebufferTexture1D)(target, attachment, textarget, _context->obj->textureNames.ToDriverName(texture), level);
+        return;
+      }
+      #endif
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+    case 2 :
+    case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 0;
+        DispatchTableGL *_next = _context->dispatcher.emulation.next();
+        RegalAssert(_next);
+        if (_context->filt->FramebufferAttachmentSupported(*_context, attachment))
+          _next->call(&_next->glFramebufferTexture1D)(target, attachment, textarget, texture, level);
+        return;
+      }
+      #endif
+    default:
+    {
+      DispatchTableGL *_next = _dispatch.next();
+      RegalAssert(_next);
+      _next->call(&_next->glFramebufferTexture1D)(target, attachment, textarget, texture, level);
+      break;
+    }
+
+  }
+
+}
+
+static void REGAL_CALL emu_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+      #if REGAL_EMU_OBJ
+      if (_context->obj) break;
+      #endif
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 6 :
+    case 5 :
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 3;
+        _context->dsa->RestoreFramebuffer( _context );
+      }
+      #endif
+    case 3 :
+    case 2 :
+    case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt) break;
+      #endif
+    default:
+      break;
+  }
+
+  // impl
+  switch( _context->emuLevel )
+  {
+    case 16 :
+      #if REGAL_EMU_OBJ
+      if (_context->obj)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 15;
+        _dispatch.call(&_dispatch.glFramebufferTexture2D)(target, attachment, textarget, _context->obj->textureNames.ToDriverName(texture), level);
+        return;
+      }
+      #endif
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+    case 2 :
+    case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 0;
+        if (_context->filt->FramebufferTexture2D(*_context, target, attachment, textarget, texture, level))
+        {
+          #if REGAL_BREAK
+          Break::Filter();
+          #endif
+          return ;
+        }
+      }
+      #endif
+    default:
+    {
+      DispatchTableGL *_next = _dispatch.next();
+      RegalAssert(_next);
+      _next->call(&_next->glFramebufferTexture2D)(target, attachment, textarget, texture, level);
+      break;
+    }
+
+  }
+
+}
+
+static void REGAL_CALL emu_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint layer)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 6 :
+    case 5 :
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 3;
+        _context->dsa->RestoreFramebuffer( _context );
+      }
+      #endif
+    case 3 :
+    case 2 :
+    case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt) break;
+      #endif
+    default:
+      break;
+  }
+
+  // impl
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+    case 2 :
+    case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 0;
+        DispatchTableGL *_next = _context->dispatcher.emulation.next();
+        RegalAssert(_next);
+        if (_context->filt->FramebufferAttachmentSupported(*_context, attachment))
+          _next->call(&_next->glFramebufferTexture3D)(target, attachment, textarget, texture, level, layer);
+        return;
+      }
+      #endif
+    default:
+    {
+      DispatchTableGL *_next = _dispatch.next();
+      RegalAssert(_next);
+      _next->call(&_next->glFramebufferTexture3D)(target, attachment, textarget, texture, level, layer);
+      break;
+    }
+
+  }
+
+}
+
+static void REGAL_CALL emu_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 6 :
+    case 5 :
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 3;
+        _context->dsa->RestoreFramebuffer( _context );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glFramebufferTextureLayer)(target, attachment, texture, level, layer);
+}
+
+static void REGAL_CALL emu_glGenerateMipmap(GLenum target)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 6 :
+    case 5 :
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 3;
+        _context->dsa->RestoreTexture( _context );
+        _context->dsa->RestoreActiveTexture( _context );
+      }
+      #endif
+    case 3 :
+    case 2 :
+      #if REGAL_EMU_TEXC
+      if (_context->texc)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 1;
+        _context->texc->ShadowGenerateMipmap( target );
+      }
+      #endif
+    case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt) break;
+      #endif
+    default:
+      break;
+  }
+
+  // impl
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+    case 2 :
+    case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 0;
+        if (_context->filt->GenerateMipmap(*_context, target))
+        {
+          #if REGAL_BREAK
+          Break::Filter();
+          #endif
+          return ;
+        }
+      }
+      #endif
+    default:
+    {
+      DispatchTableGL *_next = _dispatch.next();
+      RegalAssert(_next);
+      _next->call(&_next->glGenerateMipmap)(target);
+      break;
+    }
+
+  }
 
-// GL_ARB_draw_buffers
+}
 
-static void REGAL_CALL emu_glDrawBuffersARB(GLsizei n, const GLenum *bufs)
+static void REGAL_CALL emu_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -34417,11 +39175,11 @@ static void REGAL_CALL emu_glDrawBuffersARB(GLsizei n, const GLenum *bufs)
   switch( _context->emuLevel )
   {
     case 16 :
+      #if REGAL_EMU_OBJ
+      if (_context->obj) break;
+      #endif
     case 15 :
     case 14 :
-      #if REGAL_EMU_PPA
-      if (_context->ppa) break;
-      #endif
     case 13 :
     case 12 :
     case 11 :
@@ -34446,20 +39204,24 @@ static void REGAL_CALL emu_glDrawBuffersARB(GLsizei n, const GLenum *bufs)
   switch( _context->emuLevel )
   {
     case 16 :
-    case 15 :
-    case 14 :
-      #if REGAL_EMU_PPA
-      if (_context->ppa)
+      #if REGAL_EMU_OBJ
+      if (_context->obj)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 13;
-        if( !_context->isES2() ) {
-          _context->ppa->glDrawBuffers( n, bufs );
-          _context->dispatcher.emulation.glDrawBuffers( n, bufs );
+        _context->emuLevel = 15;
+        _dispatch.call(&_dispatch.glGetFramebufferAttachmentParameteriv)(target, attachment, pname, params);
+        if (pname == GL_FRAMEBUFFER_ATTACHMENT_OBJECT_NAME)
+        {
+          GLint attachType = GL_RENDERBUFFER;
+          _dispatch.call(&_dispatch.glGetFramebufferAttachmentParameteriv)(target, attachment, GL_FRAMEBUFFER_ATTACHMENT_OBJECT_TYPE, &attachType);
+          if (attachType == GL_TEXTURE)
+            *params = _context->obj->textureNames.ToAppName(*params);
         }
         return;
       }
       #endif
+    case 15 :
+    case 14 :
     case 13 :
     case 12 :
     case 11 :
@@ -34478,20 +39240,20 @@ static void REGAL_CALL emu_glDrawBuffersARB(GLsizei n, const GLenum *bufs)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 0;
-        if (!_context->info->gl_arb_draw_buffers)
-        {
-          DispatchTableGL &_table = _context->dispatcher.emulation;
-          _context->emuLevel++;
-          _table.call(&_table.glDrawBuffers)(n, bufs);
-          return;
-        }
+        DispatchTableGL *_next = _context->dispatcher.emulation.next();
+        RegalAssert(_next);
+        if (!_context->filt->FramebufferAttachmentSupported(*_context, attachment))
+          *params = 0;
+        else
+          _next->call(&_next->glGetFramebufferAttachmentParameteriv)(target, attachment, pname, params);
+        return;
       }
       #endif
     default:
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glDrawBuffersARB)(n, bufs);
+      _next->call(&_next->glGetFramebufferAttachmentParameteriv)(target, attachment, pname, params);
       break;
     }
 
@@ -34499,11 +39261,7 @@ static void REGAL_CALL emu_glDrawBuffersARB(GLsizei n, const GLenum *bufs)
 
 }
 
-// GL_ARB_draw_buffers_blend
-
-// GL_ARB_draw_elements_base_vertex
-
-static void REGAL_CALL emu_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const GLvoid *indices, GLint basevertex)
+static void REGAL_CALL emu_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -34520,80 +39278,30 @@ static void REGAL_CALL emu_glDrawElementsBaseVertex(GLenum mode, GLsizei count,
     case 11 :
     case 10 :
     case 9 :
-      #if REGAL_EMU_BASEVERTEX
-      if (_context->bv) break;
-      #endif
     case 8 :
     case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 6;
-        _context->iff->PreDraw( _context );
-      }
-      #endif
     case 6 :
     case 5 :
-      #if REGAL_EMU_SO
-      if (_context->so)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 4;
-        RegalAssert(_context);
-        _context->so->PreDraw( *_context );
-      }
-      #endif
     case 4 :
       #if REGAL_EMU_DSA
       if (_context->dsa)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
-        _context->dsa->Restore( _context );
-      }
-      #endif
-    case 1 :
-    default:
-      break;
-  }
-
-  // impl
-  switch( _context->emuLevel )
-  {
-    case 16 :
-    case 15 :
-    case 14 :
-    case 13 :
-    case 12 :
-    case 11 :
-    case 10 :
-    case 9 :
-      #if REGAL_EMU_BASEVERTEX
-      if (_context->bv)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 8;
-        if( ! _context->bv->glDrawElementsBaseVertex( *_context, mode, count, type, indices, basevertex ) ) {
-          _context->dispatcher.emulation.glDrawElementsBaseVertex( mode, count, type, indices, basevertex );
-        }
-        return;
+        _context->dsa->RestoreRenderbuffer( _context );
       }
       #endif
     case 1 :
     default:
-    {
-      DispatchTableGL *_next = _dispatch.next();
-      RegalAssert(_next);
-      _next->call(&_next->glDrawElementsBaseVertex)(mode, count, type, indices, basevertex);
       break;
-    }
-
   }
 
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glGetRenderbufferParameteriv)(target, pname, params);
 }
 
-static void REGAL_CALL emu_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const GLvoid *indices, GLsizei primcount, GLint basevertex)
+static void REGAL_CALL emu_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -34610,37 +39318,17 @@ static void REGAL_CALL emu_glDrawElementsInstancedBaseVertex(GLenum mode, GLsize
     case 11 :
     case 10 :
     case 9 :
-      #if REGAL_EMU_BASEVERTEX
-      if (_context->bv) break;
-      #endif
     case 8 :
     case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 6;
-        _context->iff->PreDraw( _context );
-      }
-      #endif
     case 6 :
     case 5 :
-      #if REGAL_EMU_SO
-      if (_context->so)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 4;
-        RegalAssert(_context);
-        _context->so->PreDraw( *_context );
-      }
-      #endif
     case 4 :
       #if REGAL_EMU_DSA
       if (_context->dsa)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
-        _context->dsa->Restore( _context );
+        _context->dsa->RestoreRenderbuffer( _context );
       }
       #endif
     case 1 :
@@ -34648,7 +39336,18 @@ static void REGAL_CALL emu_glDrawElementsInstancedBaseVertex(GLenum mode, GLsize
       break;
   }
 
-  // impl
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glRenderbufferStorage)(target, internalformat, width, height);
+}
+
+static void REGAL_CALL emu_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
   switch( _context->emuLevel )
   {
     case 16 :
@@ -34659,31 +39358,32 @@ static void REGAL_CALL emu_glDrawElementsInstancedBaseVertex(GLenum mode, GLsize
     case 11 :
     case 10 :
     case 9 :
-      #if REGAL_EMU_BASEVERTEX
-      if (_context->bv)
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 8;
-        if( ! _context->bv->glDrawElementsInstancedBaseVertex( *_context, mode, count, type, indices, primcount, basevertex ) ) {
-          _context->dispatcher.emulation.glDrawElementsInstancedBaseVertex( mode, count, type, indices, primcount, basevertex );
-        }
-        return;
+        _context->emuLevel = 3;
+        _context->dsa->RestoreRenderbuffer( _context );
       }
       #endif
     case 1 :
     default:
-    {
-      DispatchTableGL *_next = _dispatch.next();
-      RegalAssert(_next);
-      _next->call(&_next->glDrawElementsInstancedBaseVertex)(mode, count, type, indices, primcount, basevertex);
       break;
-    }
-
   }
 
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glRenderbufferStorageMultisample)(target, samples, internalformat, width, height);
 }
 
-static void REGAL_CALL emu_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const GLvoid *indices, GLint basevertex)
+// GL_ARB_geometry_shader4
+
+static void REGAL_CALL emu_glFramebufferTextureARB(GLenum target, GLenum attachment, GLuint texture, GLint level)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -34700,9 +39400,6 @@ static void REGAL_CALL emu_glDrawRangeElementsBaseVertex(GLenum mode, GLuint sta
     case 11 :
     case 10 :
     case 9 :
-      #if REGAL_EMU_BASEVERTEX
-      if (_context->bv) break;
-      #endif
     case 8 :
     case 7 :
       #if REGAL_EMU_IFF
@@ -34710,32 +39407,37 @@ static void REGAL_CALL emu_glDrawRangeElementsBaseVertex(GLenum mode, GLuint sta
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->PreDraw( _context );
+        _context->iff->FlushBatch( _context );
       }
       #endif
     case 6 :
     case 5 :
-      #if REGAL_EMU_SO
-      if (_context->so)
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 4;
-        RegalAssert(_context);
-        _context->so->PreDraw( *_context );
+        _context->emuLevel = 3;
+        _context->dsa->RestoreFramebuffer( _context );
       }
       #endif
-    case 4 :
-    case 3 :
-    case 2 :
     case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt) break;
-      #endif
     default:
       break;
   }
 
-  // impl
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glFramebufferTextureARB)(target, attachment, texture, level);
+}
+
+static void REGAL_CALL emu_glFramebufferTextureFaceARB(GLenum target, GLenum attachment, GLuint texture, GLint level, GLenum face)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
   switch( _context->emuLevel )
   {
     case 16 :
@@ -34746,64 +39448,38 @@ static void REGAL_CALL emu_glDrawRangeElementsBaseVertex(GLenum mode, GLuint sta
     case 11 :
     case 10 :
     case 9 :
-      #if REGAL_EMU_BASEVERTEX
-      if (_context->bv)
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 8;
-        if( ! _context->bv->glDrawRangeElementsBaseVertex( *_context, mode, start, end, count, type, indices, basevertex ) ) {
-          _context->dispatcher.emulation.glDrawRangeElementsBaseVertex( mode, start, end, count, type, indices, basevertex );
-        }
-        return;
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
       }
       #endif
-    case 8 :
-    case 7 :
     case 6 :
     case 5 :
     case 4 :
-    case 3 :
-    case 2 :
-    case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt)
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 0;
-        // WAR: Our Tegra driver GL 4 core profile supports DrawRangeElementsBaseVertex but does not
-        // advertise ARB_draw_elements_base_vertex in the extension list so here we check whether the
-        // driver has glDrawRangeElementsBaseVertex instead of looking for the extension flag.
-        //   (leaving original line here, just commented out)
-        //   if (REGAL_FORCE_ES2_PROFILE || !_context->info->gl_arb_draw_elements_base_vertex)
-        if (REGAL_FORCE_ES2_PROFILE || !_context->dispatcher.driver.glDrawRangeElementsBaseVertex)
-        {
-          if (basevertex==0)
-          {
-            DispatchTableGL *_next = _context->dispatcher.emulation.next();
-            RegalAssert(_next);
-            return _next->call(&_next->glDrawElements)(mode, count, type, indices);
-          }
-          else
-          {
-            Warning("Regal does not support glDrawRangeElementsBaseVertex (GL_ARB_draw_elements_base_vertex extension not available) for basevertex!=0 - skipping.");
-            return;
-          }
-        }
+        _context->emuLevel = 3;
+        _context->dsa->RestoreFramebuffer( _context );
       }
       #endif
+    case 1 :
     default:
-    {
-      DispatchTableGL *_next = _dispatch.next();
-      RegalAssert(_next);
-      _next->call(&_next->glDrawRangeElementsBaseVertex)(mode, start, end, count, type, indices, basevertex);
       break;
-    }
-
   }
 
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glFramebufferTextureFaceARB)(target, attachment, texture, level, face);
 }
 
-static void REGAL_CALL emu_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const GLvoid * const *indices, GLsizei primcount, const GLint *basevertex)
+static void REGAL_CALL emu_glFramebufferTextureLayerARB(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -34820,9 +39496,6 @@ static void REGAL_CALL emu_glMultiDrawElementsBaseVertex(GLenum mode, const GLsi
     case 11 :
     case 10 :
     case 9 :
-      #if REGAL_EMU_BASEVERTEX
-      if (_context->bv) break;
-      #endif
     case 8 :
     case 7 :
       #if REGAL_EMU_IFF
@@ -34830,72 +39503,35 @@ static void REGAL_CALL emu_glMultiDrawElementsBaseVertex(GLenum mode, const GLsi
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->PreDraw( _context );
+        _context->iff->FlushBatch( _context );
       }
       #endif
     case 6 :
     case 5 :
-      #if REGAL_EMU_SO
-      if (_context->so)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 4;
-        RegalAssert(_context);
-        _context->so->PreDraw( *_context );
-      }
-      #endif
     case 4 :
       #if REGAL_EMU_DSA
       if (_context->dsa)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
-        _context->dsa->Restore( _context );
-      }
-      #endif
-    case 1 :
-    default:
-      break;
-  }
-
-  // impl
-  switch( _context->emuLevel )
-  {
-    case 16 :
-    case 15 :
-    case 14 :
-    case 13 :
-    case 12 :
-    case 11 :
-    case 10 :
-    case 9 :
-      #if REGAL_EMU_BASEVERTEX
-      if (_context->bv)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 8;
-        if( ! _context->bv->glMultiDrawElementsBaseVertex( *_context, mode, count, type, indices, primcount, basevertex ) ) {
-          _context->dispatcher.emulation.glMultiDrawElementsBaseVertex( mode, count, type, indices, primcount, basevertex );
-        }
-        return;
+        _context->dsa->RestoreFramebuffer( _context );
       }
       #endif
     case 1 :
     default:
-    {
-      DispatchTableGL *_next = _dispatch.next();
-      RegalAssert(_next);
-      _next->call(&_next->glMultiDrawElementsBaseVertex)(mode, count, type, indices, primcount, basevertex);
       break;
-    }
-
   }
 
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glFramebufferTextureLayerARB)(target, attachment, texture, level, layer);
 }
 
-// GL_ARB_draw_instanced
+// GL_ARB_get_program_binary
 
-static void REGAL_CALL emu_glDrawArraysInstancedARB(GLenum mode, GLint first, GLsizei count, GLsizei primcount)
+// GL_ARB_get_texture_sub_image
+
+static void REGAL_CALL emu_glGetCompressedTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei bufSize, GLvoid *pixels)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -34914,32 +39550,16 @@ static void REGAL_CALL emu_glDrawArraysInstancedARB(GLenum mode, GLint first, GL
     case 9 :
     case 8 :
     case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 6;
-        _context->iff->PreDraw( _context );
-      }
-      #endif
     case 6 :
     case 5 :
-      #if REGAL_EMU_SO
-      if (_context->so)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 4;
-        RegalAssert(_context);
-        _context->so->PreDraw( *_context );
-      }
-      #endif
     case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        _context->dsa->Restore( _context );
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
       }
       #endif
     case 1 :
@@ -34949,10 +39569,10 @@ static void REGAL_CALL emu_glDrawArraysInstancedARB(GLenum mode, GLint first, GL
 
   DispatchTableGL *_next = _dispatch.next();
   RegalAssert(_next);
-  _next->call(& _next->glDrawArraysInstancedARB)(mode, first, count, primcount);
+  _next->call(& _next->glGetCompressedTextureSubImage)(texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels);
 }
 
-static void REGAL_CALL emu_glDrawElementsInstancedARB(GLenum mode, GLsizei count, GLenum type, const GLvoid *indices, GLsizei primcount)
+static void REGAL_CALL emu_glGetTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, GLsizei bufSize, GLvoid *pixels)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -34971,32 +39591,16 @@ static void REGAL_CALL emu_glDrawElementsInstancedARB(GLenum mode, GLsizei count
     case 9 :
     case 8 :
     case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 6;
-        _context->iff->PreDraw( _context );
-      }
-      #endif
     case 6 :
     case 5 :
-      #if REGAL_EMU_SO
-      if (_context->so)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 4;
-        RegalAssert(_context);
-        _context->so->PreDraw( *_context );
-      }
-      #endif
     case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        _context->dsa->Restore( _context );
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
       }
       #endif
     case 1 :
@@ -35006,14 +39610,12 @@ static void REGAL_CALL emu_glDrawElementsInstancedARB(GLenum mode, GLsizei count
 
   DispatchTableGL *_next = _dispatch.next();
   RegalAssert(_next);
-  _next->call(& _next->glDrawElementsInstancedARB)(mode, count, type, indices, primcount);
+  _next->call(& _next->glGetTextureSubImage)(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels);
 }
 
-// GL_ARB_framebuffer_no_attachments
-
-// GL_ARB_framebuffer_object
+// GL_ARB_gpu_shader_fp64
 
-static void REGAL_CALL emu_glBindFramebuffer(GLenum target, GLuint framebuffer)
+static void REGAL_CALL emu_glUniform1d(GLint location, GLdouble x)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -35032,18 +39634,21 @@ static void REGAL_CALL emu_glBindFramebuffer(GLenum target, GLuint framebuffer)
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff) break;
+      #endif
     case 6 :
     case 5 :
     case 4 :
       #if REGAL_EMU_DSA
-      if (_context->dsa) break;
+      if (_context->dsa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 3;
+        _context->dsa->RestoreGlslProgram( _context );
+      }
       #endif
-    case 3 :
-    case 2 :
     case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt) break;
-      #endif
     default:
       break;
   }
@@ -35061,47 +39666,26 @@ static void REGAL_CALL emu_glBindFramebuffer(GLenum target, GLuint framebuffer)
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        if (!_context->dsa->ShadowFramebuffer( target, framebuffer ) ) {
-            _dispatch.call(&_dispatch.glBindFramebuffer)( target, framebuffer );
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+        if( _context->iff->currinst ) {
+          _context->iff->Uniform( _context, 1, location, 1, x );
+        } else {
+          _context->dispatcher.emulation.glUniform1d( location, x );
         }
         return;
       }
       #endif
-    case 3 :
-    case 2 :
     case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 0;
-        if (_context->isES2())
-        {
-          const bool hasFBBlit = _context->info->gl_ext_framebuffer_blit || _context->info->gl_nv_framebuffer_blit || _context->info->gl_version_major >= 3;
-          if (!hasFBBlit && (target==GL_DRAW_FRAMEBUFFER || target==GL_READ_FRAMEBUFFER)) target = GL_FRAMEBUFFER;
-        }
-        if (_context->filt->BindFramebuffer(*_context, target, framebuffer))
-        {
-          #if REGAL_BREAK
-          Break::Filter();
-          #endif
-          return ;
-        }
-      }
-      #endif
     default:
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glBindFramebuffer)(target, framebuffer);
+      _next->call(&_next->glUniform1d)(location, x);
       break;
     }
 
@@ -35109,7 +39693,7 @@ static void REGAL_CALL emu_glBindFramebuffer(GLenum target, GLuint framebuffer)
 
 }
 
-static void REGAL_CALL emu_glBindRenderbuffer(GLenum target, GLuint renderbuffer)
+static void REGAL_CALL emu_glUniform1dv(GLint location, GLsizei count, const GLdouble *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -35128,11 +39712,19 @@ static void REGAL_CALL emu_glBindRenderbuffer(GLenum target, GLuint renderbuffer
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff) break;
+      #endif
     case 6 :
     case 5 :
     case 4 :
       #if REGAL_EMU_DSA
-      if (_context->dsa) break;
+      if (_context->dsa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 3;
+        _context->dsa->RestoreGlslProgram( _context );
+      }
       #endif
     case 1 :
     default:
@@ -35152,16 +39744,16 @@ static void REGAL_CALL emu_glBindRenderbuffer(GLenum target, GLuint renderbuffer
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        if (!_context->dsa->ShadowRenderbuffer( target, renderbuffer ) ) {
-            _dispatch.call(&_dispatch.glBindRenderbuffer)( target, renderbuffer );
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+        if( _context->iff->currinst ) {
+          _context->iff->Uniform( _context, 1, location, count, value );
+        } else {
+          _context->dispatcher.emulation.glUniform1dv( location, count, value );
         }
         return;
       }
@@ -35171,7 +39763,7 @@ static void REGAL_CALL emu_glBindRenderbuffer(GLenum target, GLuint renderbuffer
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glBindRenderbuffer)(target, renderbuffer);
+      _next->call(&_next->glUniform1dv)(location, count, value);
       break;
     }
 
@@ -35179,7 +39771,7 @@ static void REGAL_CALL emu_glBindRenderbuffer(GLenum target, GLuint renderbuffer
 
 }
 
-static void REGAL_CALL emu_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)
+static void REGAL_CALL emu_glUniform2d(GLint location, GLdouble x, GLdouble y)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -35198,15 +39790,21 @@ static void REGAL_CALL emu_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint src
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff) break;
+      #endif
     case 6 :
     case 5 :
     case 4 :
-    case 3 :
-    case 2 :
-    case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt) break;
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 3;
+        _context->dsa->RestoreGlslProgram( _context );
+      }
       #endif
+    case 1 :
     default:
       break;
   }
@@ -35224,31 +39822,26 @@ static void REGAL_CALL emu_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint src
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-    case 3 :
-    case 2 :
-    case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt)
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 0;
-        if (_context->isES2())
-        {
-          DispatchTableGL *_next = _context->dispatcher.emulation.next();
-          RegalAssert(_next);
-          if (_context->info->gl_nv_framebuffer_blit)  return _next->call(&_next->glBlitFramebufferNV)(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
-          if (_context->info->gl_ext_framebuffer_blit) return _next->call(&_next->glBlitFramebufferEXT)(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+        if( _context->iff->currinst ) {
+          _context->iff->Uniform( _context, 2, location, 1, x, y );
+        } else {
+          _context->dispatcher.emulation.glUniform2d( location, x, y );
         }
+        return;
       }
       #endif
+    case 1 :
     default:
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glBlitFramebuffer)(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+      _next->call(&_next->glUniform2d)(location, x, y);
       break;
     }
 
@@ -35256,7 +39849,7 @@ static void REGAL_CALL emu_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint src
 
 }
 
-static void REGAL_CALL emu_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers)
+static void REGAL_CALL emu_glUniform2dv(GLint location, GLsizei count, const GLdouble *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -35275,6 +39868,9 @@ static void REGAL_CALL emu_glDeleteFramebuffers(GLsizei n, const GLuint *framebu
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff) break;
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -35283,7 +39879,7 @@ static void REGAL_CALL emu_glDeleteFramebuffers(GLsizei n, const GLuint *framebu
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
-        _context->dsa->DeleteFramebuffers( _context, n, framebuffers );
+        _context->dsa->RestoreGlslProgram( _context );
       }
       #endif
     case 1 :
@@ -35291,18 +39887,7 @@ static void REGAL_CALL emu_glDeleteFramebuffers(GLsizei n, const GLuint *framebu
       break;
   }
 
-  DispatchTableGL *_next = _dispatch.next();
-  RegalAssert(_next);
-  _next->call(& _next->glDeleteFramebuffers)(n, framebuffers);
-}
-
-static void REGAL_CALL emu_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers)
-{
-  RegalContext *_context = REGAL_GET_CONTEXT();
-  RegalAssert(_context);
-  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
-
-  // prefix
+  // impl
   switch( _context->emuLevel )
   {
     case 16 :
@@ -35315,28 +39900,34 @@ static void REGAL_CALL emu_glDeleteRenderbuffers(GLsizei n, const GLuint *render
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        _context->dsa->DeleteRenderbuffers( _context, n, renderbuffers );
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+        if( _context->iff->currinst ) {
+          _context->iff->Uniform( _context, 2, location, count, value );
+        } else {
+          _context->dispatcher.emulation.glUniform2dv( location, count, value );
+        }
+        return;
       }
       #endif
     case 1 :
     default:
+    {
+      DispatchTableGL *_next = _dispatch.next();
+      RegalAssert(_next);
+      _next->call(&_next->glUniform2dv)(location, count, value);
       break;
+    }
+
   }
 
-  DispatchTableGL *_next = _dispatch.next();
-  RegalAssert(_next);
-  _next->call(& _next->glDeleteRenderbuffers)(n, renderbuffers);
 }
 
-static void REGAL_CALL emu_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
+static void REGAL_CALL emu_glUniform3d(GLint location, GLdouble x, GLdouble y, GLdouble z)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -35355,6 +39946,9 @@ static void REGAL_CALL emu_glFramebufferRenderbuffer(GLenum target, GLenum attac
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff) break;
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -35363,15 +39957,10 @@ static void REGAL_CALL emu_glFramebufferRenderbuffer(GLenum target, GLenum attac
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
-        _context->dsa->RestoreFramebuffer( _context );
+        _context->dsa->RestoreGlslProgram( _context );
       }
       #endif
-    case 3 :
-    case 2 :
     case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt) break;
-      #endif
     default:
       break;
   }
@@ -35389,29 +39978,26 @@ static void REGAL_CALL emu_glFramebufferRenderbuffer(GLenum target, GLenum attac
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-    case 3 :
-    case 2 :
-    case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt)
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 0;
-        DispatchTableGL *_next = _context->dispatcher.emulation.next();
-        RegalAssert(_next);
-        if (_context->filt->FramebufferAttachmentSupported(*_context, attachment))
-          _next->call(&_next->glFramebufferRenderbuffer)(target, attachment, renderbuffertarget, renderbuffer);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+        if( _context->iff->currinst ) {
+          _context->iff->Uniform( _context, 3, location, 1, x, y, z );
+        } else {
+          _context->dispatcher.emulation.glUniform3d( location, x, y, z );
+        }
         return;
       }
       #endif
+    case 1 :
     default:
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glFramebufferRenderbuffer)(target, attachment, renderbuffertarget, renderbuffer);
+      _next->call(&_next->glUniform3d)(location, x, y, z);
       break;
     }
 
@@ -35419,7 +40005,7 @@ static void REGAL_CALL emu_glFramebufferRenderbuffer(GLenum target, GLenum attac
 
 }
 
-static void REGAL_CALL emu_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+static void REGAL_CALL emu_glUniform3dv(GLint location, GLsizei count, const GLdouble *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -35429,9 +40015,6 @@ static void REGAL_CALL emu_glFramebufferTexture1D(GLenum target, GLenum attachme
   switch( _context->emuLevel )
   {
     case 16 :
-      #if REGAL_EMU_OBJ
-      if (_context->obj) break;
-      #endif
     case 15 :
     case 14 :
     case 13 :
@@ -35441,6 +40024,9 @@ static void REGAL_CALL emu_glFramebufferTexture1D(GLenum target, GLenum attachme
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff) break;
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -35449,15 +40035,10 @@ static void REGAL_CALL emu_glFramebufferTexture1D(GLenum target, GLenum attachme
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
-        _context->dsa->RestoreFramebuffer( _context );
+        _context->dsa->RestoreGlslProgram( _context );
       }
       #endif
-    case 3 :
-    case 2 :
     case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt) break;
-      #endif
     default:
       break;
   }
@@ -35466,15 +40047,6 @@ static void REGAL_CALL emu_glFramebufferTexture1D(GLenum target, GLenum attachme
   switch( _context->emuLevel )
   {
     case 16 :
-      #if REGAL_EMU_OBJ
-      if (_context->obj)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 15;
-        _dispatch.call(&_dispatch.glFramebufferTexture1D)(target, attachment, textarget, _context->obj->textureNames.ToDriverName(texture), level);
-        return;
-      }
-      #endif
     case 15 :
     case 14 :
     case 13 :
@@ -35484,29 +40056,26 @@ static void REGAL_CALL emu_glFramebufferTexture1D(GLenum target, GLenum attachme
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-    case 3 :
-    case 2 :
-    case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt)
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 0;
-        DispatchTableGL *_next = _context->dispatcher.emulation.next();
-        RegalAssert(_next);
-        if (_context->filt->FramebufferAttachmentSupported(*_context, attachment))
-          _next->call(&_next->glFramebufferTexture1D)(target, attachment, textarget, texture, level);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+        if( _context->iff->currinst ) {
+          _context->iff->Uniform( _context, 3, location, count, value );
+        } else {
+          _context->dispatcher.emulation.glUniform3dv( location, count, value );
+        }
         return;
       }
       #endif
+    case 1 :
     default:
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glFramebufferTexture1D)(target, attachment, textarget, texture, level);
+      _next->call(&_next->glUniform3dv)(location, count, value);
       break;
     }
 
@@ -35514,7 +40083,7 @@ static void REGAL_CALL emu_glFramebufferTexture1D(GLenum target, GLenum attachme
 
 }
 
-static void REGAL_CALL emu_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+static void REGAL_CALL emu_glUniform4d(GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -35524,9 +40093,6 @@ static void REGAL_CALL emu_glFramebufferTexture2D(GLenum target, GLenum attachme
   switch( _context->emuLevel )
   {
     case 16 :
-      #if REGAL_EMU_OBJ
-      if (_context->obj) break;
-      #endif
     case 15 :
     case 14 :
     case 13 :
@@ -35536,6 +40102,9 @@ static void REGAL_CALL emu_glFramebufferTexture2D(GLenum target, GLenum attachme
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff) break;
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -35544,15 +40113,10 @@ static void REGAL_CALL emu_glFramebufferTexture2D(GLenum target, GLenum attachme
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
-        _context->dsa->RestoreFramebuffer( _context );
+        _context->dsa->RestoreGlslProgram( _context );
       }
       #endif
-    case 3 :
-    case 2 :
     case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt) break;
-      #endif
     default:
       break;
   }
@@ -35561,15 +40125,6 @@ static void REGAL_CALL emu_glFramebufferTexture2D(GLenum target, GLenum attachme
   switch( _context->emuLevel )
   {
     case 16 :
-      #if REGAL_EMU_OBJ
-      if (_context->obj)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 15;
-        _dispatch.call(&_dispatch.glFramebufferTexture2D)(target, attachment, textarget, _context->obj->textureNames.ToDriverName(texture), level);
-        return;
-      }
-      #endif
     case 15 :
     case 14 :
     case 13 :
@@ -35579,31 +40134,26 @@ static void REGAL_CALL emu_glFramebufferTexture2D(GLenum target, GLenum attachme
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-    case 3 :
-    case 2 :
-    case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt)
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 0;
-        if (_context->filt->FramebufferTexture2D(*_context, target, attachment, textarget, texture, level))
-        {
-          #if REGAL_BREAK
-          Break::Filter();
-          #endif
-          return ;
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+        if( _context->iff->currinst ) {
+          _context->iff->Uniform( _context, 4, location, 1, x, y, z, w );
+        } else {
+          _context->dispatcher.emulation.glUniform4d( location, x, y, z, w );
         }
+        return;
       }
       #endif
+    case 1 :
     default:
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glFramebufferTexture2D)(target, attachment, textarget, texture, level);
+      _next->call(&_next->glUniform4d)(location, x, y, z, w);
       break;
     }
 
@@ -35611,7 +40161,7 @@ static void REGAL_CALL emu_glFramebufferTexture2D(GLenum target, GLenum attachme
 
 }
 
-static void REGAL_CALL emu_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint layer)
+static void REGAL_CALL emu_glUniform4dv(GLint location, GLsizei count, const GLdouble *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -35630,6 +40180,9 @@ static void REGAL_CALL emu_glFramebufferTexture3D(GLenum target, GLenum attachme
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff) break;
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -35638,15 +40191,10 @@ static void REGAL_CALL emu_glFramebufferTexture3D(GLenum target, GLenum attachme
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
-        _context->dsa->RestoreFramebuffer( _context );
+        _context->dsa->RestoreGlslProgram( _context );
       }
       #endif
-    case 3 :
-    case 2 :
     case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt) break;
-      #endif
     default:
       break;
   }
@@ -35664,29 +40212,26 @@ static void REGAL_CALL emu_glFramebufferTexture3D(GLenum target, GLenum attachme
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-    case 3 :
-    case 2 :
-    case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt)
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 0;
-        DispatchTableGL *_next = _context->dispatcher.emulation.next();
-        RegalAssert(_next);
-        if (_context->filt->FramebufferAttachmentSupported(*_context, attachment))
-          _next->call(&_next->glFramebufferTexture3D)(target, attachment, textarget, texture, level, layer);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+        if( _context->iff->currinst ) {
+          _context->iff->Uniform( _context, 4, location, count, value );
+        } else {
+          _context->dispatcher.emulation.glUniform4dv( location, count, value );
+        }
         return;
       }
       #endif
+    case 1 :
     default:
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glFramebufferTexture3D)(target, attachment, textarget, texture, level, layer);
+      _next->call(&_next->glUniform4dv)(location, count, value);
       break;
     }
 
@@ -35694,7 +40239,7 @@ static void REGAL_CALL emu_glFramebufferTexture3D(GLenum target, GLenum attachme
 
 }
 
-static void REGAL_CALL emu_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer)
+static void REGAL_CALL emu_glUniformMatrix2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -35713,6 +40258,9 @@ static void REGAL_CALL emu_glFramebufferTextureLayer(GLenum target, GLenum attac
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff) break;
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -35721,7 +40269,7 @@ static void REGAL_CALL emu_glFramebufferTextureLayer(GLenum target, GLenum attac
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
-        _context->dsa->RestoreFramebuffer( _context );
+        _context->dsa->RestoreGlslProgram( _context );
       }
       #endif
     case 1 :
@@ -35729,12 +40277,47 @@ static void REGAL_CALL emu_glFramebufferTextureLayer(GLenum target, GLenum attac
       break;
   }
 
-  DispatchTableGL *_next = _dispatch.next();
-  RegalAssert(_next);
-  _next->call(& _next->glFramebufferTextureLayer)(target, attachment, texture, level, layer);
+  // impl
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+        if( _context->iff->currinst ) {
+          _context->iff->UniformMatrix( _context, 2, 2, location, count, transpose, value );
+        } else {
+          _context->dispatcher.emulation.glUniformMatrix2dv( location, count, transpose, value );
+        }
+        return;
+      }
+      #endif
+    case 1 :
+    default:
+    {
+      DispatchTableGL *_next = _dispatch.next();
+      RegalAssert(_next);
+      _next->call(&_next->glUniformMatrix2dv)(location, count, transpose, value);
+      break;
+    }
+
+  }
+
 }
 
-static void REGAL_CALL emu_glGenerateMipmap(GLenum target)
+static void REGAL_CALL emu_glUniformMatrix2x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -35753,6 +40336,9 @@ static void REGAL_CALL emu_glGenerateMipmap(GLenum target)
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff) break;
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -35761,24 +40347,10 @@ static void REGAL_CALL emu_glGenerateMipmap(GLenum target)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
-        _context->dsa->RestoreTexture( _context );
-        _context->dsa->RestoreActiveTexture( _context );
-      }
-      #endif
-    case 3 :
-    case 2 :
-      #if REGAL_EMU_TEXC
-      if (_context->texc)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 1;
-        _context->texc->ShadowGenerateMipmap( target );
+        _context->dsa->RestoreGlslProgram( _context );
       }
       #endif
     case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt) break;
-      #endif
     default:
       break;
   }
@@ -35796,31 +40368,26 @@ static void REGAL_CALL emu_glGenerateMipmap(GLenum target)
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-    case 3 :
-    case 2 :
-    case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt)
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 0;
-        if (_context->filt->GenerateMipmap(*_context, target))
-        {
-          #if REGAL_BREAK
-          Break::Filter();
-          #endif
-          return ;
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+        if( _context->iff->currinst ) {
+          _context->iff->UniformMatrix( _context, 2, 3, location, count, transpose, value );
+        } else {
+          _context->dispatcher.emulation.glUniformMatrix2x3dv( location, count, transpose, value );
         }
+        return;
       }
       #endif
+    case 1 :
     default:
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glGenerateMipmap)(target);
+      _next->call(&_next->glUniformMatrix2x3dv)(location, count, transpose, value);
       break;
     }
 
@@ -35828,7 +40395,7 @@ static void REGAL_CALL emu_glGenerateMipmap(GLenum target)
 
 }
 
-static void REGAL_CALL emu_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params)
+static void REGAL_CALL emu_glUniformMatrix2x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -35838,9 +40405,6 @@ static void REGAL_CALL emu_glGetFramebufferAttachmentParameteriv(GLenum target,
   switch( _context->emuLevel )
   {
     case 16 :
-      #if REGAL_EMU_OBJ
-      if (_context->obj) break;
-      #endif
     case 15 :
     case 14 :
     case 13 :
@@ -35850,15 +40414,21 @@ static void REGAL_CALL emu_glGetFramebufferAttachmentParameteriv(GLenum target,
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff) break;
+      #endif
     case 6 :
     case 5 :
     case 4 :
-    case 3 :
-    case 2 :
-    case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt) break;
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 3;
+        _context->dsa->RestoreGlslProgram( _context );
+      }
       #endif
+    case 1 :
     default:
       break;
   }
@@ -35867,22 +40437,6 @@ static void REGAL_CALL emu_glGetFramebufferAttachmentParameteriv(GLenum target,
   switch( _context->emuLevel )
   {
     case 16 :
-      #if REGAL_EMU_OBJ
-      if (_context->obj)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 15;
-        _dispatch.call(&_dispatch.glGetFramebufferAttachmentParameteriv)(target, attachment, pname, params);
-        if (pname == GL_FRAMEBUFFER_ATTACHMENT_OBJECT_NAME)
-        {
-          GLint attachType = GL_RENDERBUFFER;
-          _dispatch.call(&_dispatch.glGetFramebufferAttachmentParameteriv)(target, attachment, GL_FRAMEBUFFER_ATTACHMENT_OBJECT_TYPE, &attachType);
-          if (attachType == GL_TEXTURE)
-            *params = _context->obj->textureNames.ToAppName(*params);
-        }
-        return;
-      }
-      #endif
     case 15 :
     case 14 :
     case 13 :
@@ -35892,31 +40446,26 @@ static void REGAL_CALL emu_glGetFramebufferAttachmentParameteriv(GLenum target,
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-    case 3 :
-    case 2 :
-    case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt)
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 0;
-        DispatchTableGL *_next = _context->dispatcher.emulation.next();
-        RegalAssert(_next);
-        if (!_context->filt->FramebufferAttachmentSupported(*_context, attachment))
-          *params = 0;
-        else
-          _next->call(&_next->glGetFramebufferAttachmentParameteriv)(target, attachment, pname, params);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+        if( _context->iff->currinst ) {
+          _context->iff->UniformMatrix( _context, 2, 4, location, count, transpose, value );
+        } else {
+          _context->dispatcher.emulation.glUniformMatrix2x4dv( location, count, transpose, value );
+        }
         return;
       }
       #endif
+    case 1 :
     default:
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glGetFramebufferAttachmentParameteriv)(target, attachment, pname, params);
+      _next->call(&_next->glUniformMatrix2x4dv)(location, count, transpose, value);
       break;
     }
 
@@ -35924,7 +40473,7 @@ static void REGAL_CALL emu_glGetFramebufferAttachmentParameteriv(GLenum target,
 
 }
 
-static void REGAL_CALL emu_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params)
+static void REGAL_CALL emu_glUniformMatrix3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -35943,6 +40492,9 @@ static void REGAL_CALL emu_glGetRenderbufferParameteriv(GLenum target, GLenum pn
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff) break;
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -35951,7 +40503,7 @@ static void REGAL_CALL emu_glGetRenderbufferParameteriv(GLenum target, GLenum pn
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
-        _context->dsa->RestoreRenderbuffer( _context );
+        _context->dsa->RestoreGlslProgram( _context );
       }
       #endif
     case 1 :
@@ -35959,18 +40511,7 @@ static void REGAL_CALL emu_glGetRenderbufferParameteriv(GLenum target, GLenum pn
       break;
   }
 
-  DispatchTableGL *_next = _dispatch.next();
-  RegalAssert(_next);
-  _next->call(& _next->glGetRenderbufferParameteriv)(target, pname, params);
-}
-
-static void REGAL_CALL emu_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height)
-{
-  RegalContext *_context = REGAL_GET_CONTEXT();
-  RegalAssert(_context);
-  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
-
-  // prefix
+  // impl
   switch( _context->emuLevel )
   {
     case 16 :
@@ -35983,28 +40524,34 @@ static void REGAL_CALL emu_glRenderbufferStorage(GLenum target, GLenum internalf
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        _context->dsa->RestoreRenderbuffer( _context );
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+        if( _context->iff->currinst ) {
+          _context->iff->UniformMatrix( _context, 3, 3, location, count, transpose, value );
+        } else {
+          _context->dispatcher.emulation.glUniformMatrix3dv( location, count, transpose, value );
+        }
+        return;
       }
       #endif
     case 1 :
     default:
+    {
+      DispatchTableGL *_next = _dispatch.next();
+      RegalAssert(_next);
+      _next->call(&_next->glUniformMatrix3dv)(location, count, transpose, value);
       break;
+    }
+
   }
 
-  DispatchTableGL *_next = _dispatch.next();
-  RegalAssert(_next);
-  _next->call(& _next->glRenderbufferStorage)(target, internalformat, width, height);
 }
 
-static void REGAL_CALL emu_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)
+static void REGAL_CALL emu_glUniformMatrix3x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -36023,6 +40570,9 @@ static void REGAL_CALL emu_glRenderbufferStorageMultisample(GLenum target, GLsiz
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff) break;
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -36031,7 +40581,7 @@ static void REGAL_CALL emu_glRenderbufferStorageMultisample(GLenum target, GLsiz
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
-        _context->dsa->RestoreRenderbuffer( _context );
+        _context->dsa->RestoreGlslProgram( _context );
       }
       #endif
     case 1 :
@@ -36039,20 +40589,7 @@ static void REGAL_CALL emu_glRenderbufferStorageMultisample(GLenum target, GLsiz
       break;
   }
 
-  DispatchTableGL *_next = _dispatch.next();
-  RegalAssert(_next);
-  _next->call(& _next->glRenderbufferStorageMultisample)(target, samples, internalformat, width, height);
-}
-
-// GL_ARB_geometry_shader4
-
-static void REGAL_CALL emu_glFramebufferTextureARB(GLenum target, GLenum attachment, GLuint texture, GLint level)
-{
-  RegalContext *_context = REGAL_GET_CONTEXT();
-  RegalAssert(_context);
-  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
-
-  // prefix
+  // impl
   switch( _context->emuLevel )
   {
     case 16 :
@@ -36065,28 +40602,34 @@ static void REGAL_CALL emu_glFramebufferTextureARB(GLenum target, GLenum attachm
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        _context->dsa->RestoreFramebuffer( _context );
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+        if( _context->iff->currinst ) {
+          _context->iff->UniformMatrix( _context, 3, 2, location, count, transpose, value );
+        } else {
+          _context->dispatcher.emulation.glUniformMatrix3x2dv( location, count, transpose, value );
+        }
+        return;
       }
       #endif
     case 1 :
     default:
+    {
+      DispatchTableGL *_next = _dispatch.next();
+      RegalAssert(_next);
+      _next->call(&_next->glUniformMatrix3x2dv)(location, count, transpose, value);
       break;
+    }
+
   }
 
-  DispatchTableGL *_next = _dispatch.next();
-  RegalAssert(_next);
-  _next->call(& _next->glFramebufferTextureARB)(target, attachment, texture, level);
 }
 
-static void REGAL_CALL emu_glFramebufferTextureFaceARB(GLenum target, GLenum attachment, GLuint texture, GLint level, GLenum face)
+static void REGAL_CALL emu_glUniformMatrix3x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -36105,6 +40648,9 @@ static void REGAL_CALL emu_glFramebufferTextureFaceARB(GLenum target, GLenum att
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff) break;
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -36113,7 +40659,7 @@ static void REGAL_CALL emu_glFramebufferTextureFaceARB(GLenum target, GLenum att
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
-        _context->dsa->RestoreFramebuffer( _context );
+        _context->dsa->RestoreGlslProgram( _context );
       }
       #endif
     case 1 :
@@ -36121,18 +40667,7 @@ static void REGAL_CALL emu_glFramebufferTextureFaceARB(GLenum target, GLenum att
       break;
   }
 
-  DispatchTableGL *_next = _dispatch.next();
-  RegalAssert(_next);
-  _next->call(& _next->glFramebufferTextureFaceARB)(target, attachment, texture, level, face);
-}
-
-static void REGAL_CALL emu_glFramebufferTextureLayerARB(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer)
-{
-  RegalContext *_context = REGAL_GET_CONTEXT();
-  RegalAssert(_context);
-  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
-
-  // prefix
+  // impl
   switch( _context->emuLevel )
   {
     case 16 :
@@ -36145,34 +40680,34 @@ static void REGAL_CALL emu_glFramebufferTextureLayerARB(GLenum target, GLenum at
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        _context->dsa->RestoreFramebuffer( _context );
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+        if( _context->iff->currinst ) {
+          _context->iff->UniformMatrix( _context, 3, 4, location, count, transpose, value );
+        } else {
+          _context->dispatcher.emulation.glUniformMatrix3x4dv( location, count, transpose, value );
+        }
+        return;
       }
       #endif
     case 1 :
     default:
+    {
+      DispatchTableGL *_next = _dispatch.next();
+      RegalAssert(_next);
+      _next->call(&_next->glUniformMatrix3x4dv)(location, count, transpose, value);
       break;
-  }
-
-  DispatchTableGL *_next = _dispatch.next();
-  RegalAssert(_next);
-  _next->call(& _next->glFramebufferTextureLayerARB)(target, attachment, texture, level, layer);
-}
-
-// GL_ARB_get_program_binary
+    }
 
-// GL_ARB_get_texture_sub_image
+  }
 
-// GL_ARB_gpu_shader_fp64
+}
 
-static void REGAL_CALL emu_glUniform1d(GLint location, GLdouble x)
+static void REGAL_CALL emu_glUniformMatrix4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -36228,10 +40763,11 @@ static void REGAL_CALL emu_glUniform1d(GLint location, GLdouble x)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( _context->iff->currinst ) {
-          _context->iff->Uniform( _context, 1, location, 1, x );
+          _context->iff->UniformMatrix( _context, 4, 4, location, count, transpose, value );
         } else {
-          _context->dispatcher.emulation.glUniform1d( location, x );
+          _context->dispatcher.emulation.glUniformMatrix4dv( location, count, transpose, value );
         }
         return;
       }
@@ -36241,7 +40777,7 @@ static void REGAL_CALL emu_glUniform1d(GLint location, GLdouble x)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glUniform1d)(location, x);
+      _next->call(&_next->glUniformMatrix4dv)(location, count, transpose, value);
       break;
     }
 
@@ -36249,7 +40785,7 @@ static void REGAL_CALL emu_glUniform1d(GLint location, GLdouble x)
 
 }
 
-static void REGAL_CALL emu_glUniform1dv(GLint location, GLsizei count, const GLdouble *value)
+static void REGAL_CALL emu_glUniformMatrix4x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -36305,10 +40841,11 @@ static void REGAL_CALL emu_glUniform1dv(GLint location, GLsizei count, const GLd
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( _context->iff->currinst ) {
-          _context->iff->Uniform( _context, 1, location, count, value );
+          _context->iff->UniformMatrix( _context, 4, 2, location, count, transpose, value );
         } else {
-          _context->dispatcher.emulation.glUniform1dv( location, count, value );
+          _context->dispatcher.emulation.glUniformMatrix4x2dv( location, count, transpose, value );
         }
         return;
       }
@@ -36318,7 +40855,7 @@ static void REGAL_CALL emu_glUniform1dv(GLint location, GLsizei count, const GLd
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glUniform1dv)(location, count, value);
+      _next->call(&_next->glUniformMatrix4x2dv)(location, count, transpose, value);
       break;
     }
 
@@ -36326,7 +40863,7 @@ static void REGAL_CALL emu_glUniform1dv(GLint location, GLsizei count, const GLd
 
 }
 
-static void REGAL_CALL emu_glUniform2d(GLint location, GLdouble x, GLdouble y)
+static void REGAL_CALL emu_glUniformMatrix4x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -36382,10 +40919,11 @@ static void REGAL_CALL emu_glUniform2d(GLint location, GLdouble x, GLdouble y)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( _context->iff->currinst ) {
-          _context->iff->Uniform( _context, 2, location, 1, x, y );
+          _context->iff->UniformMatrix( _context, 4, 3, location, count, transpose, value );
         } else {
-          _context->dispatcher.emulation.glUniform2d( location, x, y );
+          _context->dispatcher.emulation.glUniformMatrix4x3dv( location, count, transpose, value );
         }
         return;
       }
@@ -36395,7 +40933,7 @@ static void REGAL_CALL emu_glUniform2d(GLint location, GLdouble x, GLdouble y)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glUniform2d)(location, x, y);
+      _next->call(&_next->glUniformMatrix4x3dv)(location, count, transpose, value);
       break;
     }
 
@@ -36403,7 +40941,9 @@ static void REGAL_CALL emu_glUniform2d(GLint location, GLdouble x, GLdouble y)
 
 }
 
-static void REGAL_CALL emu_glUniform2dv(GLint location, GLsizei count, const GLdouble *value)
+// GL_ARB_imaging
+
+static void REGAL_CALL emu_glColorTableParameterfv(GLenum target, GLenum pname, const GLfloat *params)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -36415,25 +40955,42 @@ static void REGAL_CALL emu_glUniform2dv(GLint location, GLsizei count, const GLd
     case 16 :
     case 15 :
     case 14 :
-    case 13 :
-    case 12 :
-    case 11 :
-    case 10 :
-    case 9 :
-    case 8 :
-    case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff) break;
+      #if REGAL_EMU_PPA
+      if (_context->ppa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 13;
+        _context->ppa->glColorTableParameterv( target, pname, params );
+      }
       #endif
-    case 6 :
-    case 5 :
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glColorTableParameterfv)(target, pname, params);
+}
+
+static void REGAL_CALL emu_glColorTableParameteriv(GLenum target, GLenum pname, const GLint *params)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+      #if REGAL_EMU_PPA
+      if (_context->ppa)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        _context->dsa->RestoreGlslProgram( _context );
+        _context->emuLevel = 13;
+        _context->ppa->glColorTableParameterv( target, pname, params );
       }
       #endif
     case 1 :
@@ -36441,46 +40998,72 @@ static void REGAL_CALL emu_glUniform2dv(GLint location, GLsizei count, const GLd
       break;
   }
 
-  // impl
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glColorTableParameteriv)(target, pname, params);
+}
+
+static void REGAL_CALL emu_glConvolutionParameterf(GLenum target, GLenum pname, GLfloat params)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
   switch( _context->emuLevel )
   {
     case 16 :
     case 15 :
     case 14 :
-    case 13 :
-    case 12 :
-    case 11 :
-    case 10 :
-    case 9 :
-    case 8 :
-    case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff)
+      #if REGAL_EMU_PPA
+      if (_context->ppa)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 6;
-        if( _context->iff->currinst ) {
-          _context->iff->Uniform( _context, 2, location, count, value );
-        } else {
-          _context->dispatcher.emulation.glUniform2dv( location, count, value );
-        }
-        return;
+        _context->emuLevel = 13;
+        _context->ppa->glConvolutionParameter( target, pname, params );
       }
       #endif
     case 1 :
     default:
-    {
-      DispatchTableGL *_next = _dispatch.next();
-      RegalAssert(_next);
-      _next->call(&_next->glUniform2dv)(location, count, value);
       break;
-    }
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glConvolutionParameterf)(target, pname, params);
+}
+
+static void REGAL_CALL emu_glConvolutionParameterfv(GLenum target, GLenum pname, const GLfloat *params)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
 
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+      #if REGAL_EMU_PPA
+      if (_context->ppa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 13;
+        _context->ppa->glConvolutionParameterv( target, pname, params );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
   }
 
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glConvolutionParameterfv)(target, pname, params);
 }
 
-static void REGAL_CALL emu_glUniform3d(GLint location, GLdouble x, GLdouble y, GLdouble z)
+static void REGAL_CALL emu_glConvolutionParameteri(GLenum target, GLenum pname, GLint params)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -36492,25 +41075,42 @@ static void REGAL_CALL emu_glUniform3d(GLint location, GLdouble x, GLdouble y, G
     case 16 :
     case 15 :
     case 14 :
-    case 13 :
-    case 12 :
-    case 11 :
-    case 10 :
-    case 9 :
-    case 8 :
-    case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff) break;
+      #if REGAL_EMU_PPA
+      if (_context->ppa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 13;
+        _context->ppa->glConvolutionParameter( target, pname, params );
+      }
       #endif
-    case 6 :
-    case 5 :
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glConvolutionParameteri)(target, pname, params);
+}
+
+static void REGAL_CALL emu_glConvolutionParameteriv(GLenum target, GLenum pname, const GLint *params)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+      #if REGAL_EMU_PPA
+      if (_context->ppa)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        _context->dsa->RestoreGlslProgram( _context );
+        _context->emuLevel = 13;
+        _context->ppa->glConvolutionParameterv( target, pname, params );
       }
       #endif
     case 1 :
@@ -36518,28 +41118,44 @@ static void REGAL_CALL emu_glUniform3d(GLint location, GLdouble x, GLdouble y, G
       break;
   }
 
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glConvolutionParameteriv)(target, pname, params);
+}
+
+static void REGAL_CALL emu_glGetColorTableParameterfv(GLenum target, GLenum pname, GLfloat *params)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+      #if REGAL_EMU_PPA
+      if (_context->ppa) break;
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
   // impl
   switch( _context->emuLevel )
   {
     case 16 :
     case 15 :
     case 14 :
-    case 13 :
-    case 12 :
-    case 11 :
-    case 10 :
-    case 9 :
-    case 8 :
-    case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff)
+      #if REGAL_EMU_PPA
+      if (_context->ppa)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 6;
-        if( _context->iff->currinst ) {
-          _context->iff->Uniform( _context, 3, location, 1, x, y, z );
-        } else {
-          _context->dispatcher.emulation.glUniform3d( location, x, y, z );
+        _context->emuLevel = 13;
+        if( ! _context->ppa->glGetColorTableParameterv( _context, target, pname, params ) ) {
+          _context->dispatcher.emulation.glGetColorTableParameterfv( target, pname, params );
         }
         return;
       }
@@ -36549,7 +41165,7 @@ static void REGAL_CALL emu_glUniform3d(GLint location, GLdouble x, GLdouble y, G
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glUniform3d)(location, x, y, z);
+      _next->call(&_next->glGetColorTableParameterfv)(target, pname, params);
       break;
     }
 
@@ -36557,7 +41173,7 @@ static void REGAL_CALL emu_glUniform3d(GLint location, GLdouble x, GLdouble y, G
 
 }
 
-static void REGAL_CALL emu_glUniform3dv(GLint location, GLsizei count, const GLdouble *value)
+static void REGAL_CALL emu_glGetColorTableParameteriv(GLenum target, GLenum pname, GLint *params)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -36569,26 +41185,8 @@ static void REGAL_CALL emu_glUniform3dv(GLint location, GLsizei count, const GLd
     case 16 :
     case 15 :
     case 14 :
-    case 13 :
-    case 12 :
-    case 11 :
-    case 10 :
-    case 9 :
-    case 8 :
-    case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff) break;
-      #endif
-    case 6 :
-    case 5 :
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        _context->dsa->RestoreGlslProgram( _context );
-      }
+      #if REGAL_EMU_PPA
+      if (_context->ppa) break;
       #endif
     case 1 :
     default:
@@ -36601,22 +41199,13 @@ static void REGAL_CALL emu_glUniform3dv(GLint location, GLsizei count, const GLd
     case 16 :
     case 15 :
     case 14 :
-    case 13 :
-    case 12 :
-    case 11 :
-    case 10 :
-    case 9 :
-    case 8 :
-    case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff)
+      #if REGAL_EMU_PPA
+      if (_context->ppa)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 6;
-        if( _context->iff->currinst ) {
-          _context->iff->Uniform( _context, 3, location, count, value );
-        } else {
-          _context->dispatcher.emulation.glUniform3dv( location, count, value );
+        _context->emuLevel = 13;
+        if( ! _context->ppa->glGetColorTableParameterv( _context, target, pname, params ) ) {
+          _context->dispatcher.emulation.glGetColorTableParameteriv( target, pname, params );
         }
         return;
       }
@@ -36626,7 +41215,7 @@ static void REGAL_CALL emu_glUniform3dv(GLint location, GLsizei count, const GLd
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glUniform3dv)(location, count, value);
+      _next->call(&_next->glGetColorTableParameteriv)(target, pname, params);
       break;
     }
 
@@ -36634,7 +41223,7 @@ static void REGAL_CALL emu_glUniform3dv(GLint location, GLsizei count, const GLd
 
 }
 
-static void REGAL_CALL emu_glUniform4d(GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+static void REGAL_CALL emu_glGetConvolutionParameterfv(GLenum target, GLenum pname, GLfloat *params)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -36646,28 +41235,60 @@ static void REGAL_CALL emu_glUniform4d(GLint location, GLdouble x, GLdouble y, G
     case 16 :
     case 15 :
     case 14 :
-    case 13 :
-    case 12 :
-    case 11 :
-    case 10 :
-    case 9 :
-    case 8 :
-    case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff) break;
+      #if REGAL_EMU_PPA
+      if (_context->ppa) break;
       #endif
-    case 6 :
-    case 5 :
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
+    case 1 :
+    default:
+      break;
+  }
+
+  // impl
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+      #if REGAL_EMU_PPA
+      if (_context->ppa)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        _context->dsa->RestoreGlslProgram( _context );
+        _context->emuLevel = 13;
+        if( ! _context->ppa->glGetConvolutionParameterv( _context, target, pname, params ) ) {
+          _context->dispatcher.emulation.glGetConvolutionParameterfv( target, pname, params );
+        }
+        return;
       }
       #endif
     case 1 :
+    default:
+    {
+      DispatchTableGL *_next = _dispatch.next();
+      RegalAssert(_next);
+      _next->call(&_next->glGetConvolutionParameterfv)(target, pname, params);
+      break;
+    }
+
+  }
+
+}
+
+static void REGAL_CALL emu_glGetConvolutionParameteriv(GLenum target, GLenum pname, GLint *params)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+      #if REGAL_EMU_PPA
+      if (_context->ppa) break;
+      #endif
+    case 1 :
     default:
       break;
   }
@@ -36678,22 +41299,13 @@ static void REGAL_CALL emu_glUniform4d(GLint location, GLdouble x, GLdouble y, G
     case 16 :
     case 15 :
     case 14 :
-    case 13 :
-    case 12 :
-    case 11 :
-    case 10 :
-    case 9 :
-    case 8 :
-    case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff)
+      #if REGAL_EMU_PPA
+      if (_context->ppa)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 6;
-        if( _context->iff->currinst ) {
-          _context->iff->Uniform( _context, 4, location, 1, x, y, z, w );
-        } else {
-          _context->dispatcher.emulation.glUniform4d( location, x, y, z, w );
+        _context->emuLevel = 13;
+        if( ! _context->ppa->glGetConvolutionParameterv( _context, target, pname, params ) ) {
+          _context->dispatcher.emulation.glGetConvolutionParameteriv( target, pname, params );
         }
         return;
       }
@@ -36703,7 +41315,7 @@ static void REGAL_CALL emu_glUniform4d(GLint location, GLdouble x, GLdouble y, G
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glUniform4d)(location, x, y, z, w);
+      _next->call(&_next->glGetConvolutionParameteriv)(target, pname, params);
       break;
     }
 
@@ -36711,7 +41323,19 @@ static void REGAL_CALL emu_glUniform4d(GLint location, GLdouble x, GLdouble y, G
 
 }
 
-static void REGAL_CALL emu_glUniform4dv(GLint location, GLsizei count, const GLdouble *value)
+// GL_ARB_indirect_parameters
+
+// GL_ARB_instanced_arrays
+
+// GL_ARB_internalformat_query
+
+// GL_ARB_internalformat_query2
+
+// GL_ARB_invalidate_subdata
+
+// GL_ARB_map_buffer_range
+
+static void REGAL_CALL emu_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -36730,9 +41354,6 @@ static void REGAL_CALL emu_glUniform4dv(GLint location, GLsizei count, const GLd
     case 9 :
     case 8 :
     case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff) break;
-      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -36741,7 +41362,16 @@ static void REGAL_CALL emu_glUniform4dv(GLint location, GLsizei count, const GLd
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
-        _context->dsa->RestoreGlslProgram( _context );
+        _context->dsa->RestoreBuffer( _context );
+      }
+      #endif
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
       }
       #endif
     case 1 :
@@ -36749,7 +41379,18 @@ static void REGAL_CALL emu_glUniform4dv(GLint location, GLsizei count, const GLd
       break;
   }
 
-  // impl
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glFlushMappedBufferRange)(target, offset, length);
+}
+
+static GLvoid *REGAL_CALL emu_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
   switch( _context->emuLevel )
   {
     case 16 :
@@ -36762,33 +41403,41 @@ static void REGAL_CALL emu_glUniform4dv(GLint location, GLsizei count, const GLd
     case 9 :
     case 8 :
     case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff)
+    case 6 :
+    case 5 :
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 6;
-        if( _context->iff->currinst ) {
-          _context->iff->Uniform( _context, 4, location, count, value );
-        } else {
-          _context->dispatcher.emulation.glUniform4dv( location, count, value );
-        }
-        return;
+        _context->emuLevel = 3;
+        _context->dsa->RestoreBuffer( _context );
+      }
+      #endif
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->MapBufferRange( access );
       }
       #endif
     case 1 :
     default:
-    {
-      DispatchTableGL *_next = _dispatch.next();
-      RegalAssert(_next);
-      _next->call(&_next->glUniform4dv)(location, count, value);
       break;
-    }
-
   }
 
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  return _next->call(& _next->glMapBufferRange)(target, offset, length, access);
 }
 
-static void REGAL_CALL emu_glUniformMatrix2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+// GL_ARB_matrix_palette
+
+// GL_ARB_multi_bind
+
+static void REGAL_CALL emu_glBindVertexBuffers(GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -36801,24 +41450,12 @@ static void REGAL_CALL emu_glUniformMatrix2dv(GLint location, GLsizei count, GLb
     case 15 :
     case 14 :
     case 13 :
-    case 12 :
-    case 11 :
-    case 10 :
-    case 9 :
-    case 8 :
-    case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff) break;
-      #endif
-    case 6 :
-    case 5 :
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
+      #if REGAL_EMU_PPCA
+      if (_context->ppca)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        _context->dsa->RestoreGlslProgram( _context );
+        _context->emuLevel = 12;
+        _context->ppca->glBindVertexBuffers( first, count, buffers, offsets, strides );
       }
       #endif
     case 1 :
@@ -36826,7 +41463,20 @@ static void REGAL_CALL emu_glUniformMatrix2dv(GLint location, GLsizei count, GLb
       break;
   }
 
-  // impl
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glBindVertexBuffers)(first, count, buffers, offsets, strides);
+}
+
+// GL_ARB_multi_draw_indirect
+
+static void REGAL_CALL emu_glMultiDrawArraysIndirect(GLenum mode, const GLvoid *indirect, GLsizei primcount, GLsizei stride)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
   switch( _context->emuLevel )
   {
     case 16 :
@@ -36844,28 +41494,41 @@ static void REGAL_CALL emu_glUniformMatrix2dv(GLint location, GLsizei count, GLb
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        if( _context->iff->currinst ) {
-          _context->iff->UniformMatrix( _context, 2, 2, location, count, transpose, value );
-        } else {
-          _context->dispatcher.emulation.glUniformMatrix2dv( location, count, transpose, value );
-        }
-        return;
+        _context->iff->RestoreVao( _context );
+        _context->iff->PreDraw( _context );
+      }
+      #endif
+    case 6 :
+    case 5 :
+      #if REGAL_EMU_SO
+      if (_context->so)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 4;
+        RegalAssert(_context);
+        _context->so->PreDraw( *_context );
+      }
+      #endif
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 3;
+        _context->dsa->Restore( _context );
       }
       #endif
     case 1 :
     default:
-    {
-      DispatchTableGL *_next = _dispatch.next();
-      RegalAssert(_next);
-      _next->call(&_next->glUniformMatrix2dv)(location, count, transpose, value);
       break;
-    }
-
   }
 
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glMultiDrawArraysIndirect)(mode, indirect, primcount, stride);
 }
 
-static void REGAL_CALL emu_glUniformMatrix2x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+static void REGAL_CALL emu_glMultiDrawElementsIndirect(GLenum mode, GLenum type, const GLvoid *indirect, GLsizei primcount, GLsizei stride)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -36885,17 +41548,32 @@ static void REGAL_CALL emu_glUniformMatrix2x3dv(GLint location, GLsizei count, G
     case 8 :
     case 7 :
       #if REGAL_EMU_IFF
-      if (_context->iff) break;
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
+        _context->iff->PreDraw( _context );
+      }
       #endif
     case 6 :
     case 5 :
+      #if REGAL_EMU_SO
+      if (_context->so)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 4;
+        RegalAssert(_context);
+        _context->so->PreDraw( *_context );
+      }
+      #endif
     case 4 :
       #if REGAL_EMU_DSA
       if (_context->dsa)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
-        _context->dsa->RestoreGlslProgram( _context );
+        _context->dsa->Restore( _context );
       }
       #endif
     case 1 :
@@ -36903,7 +41581,20 @@ static void REGAL_CALL emu_glUniformMatrix2x3dv(GLint location, GLsizei count, G
       break;
   }
 
-  // impl
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glMultiDrawElementsIndirect)(mode, type, indirect, primcount, stride);
+}
+
+// GL_ARB_multisample
+
+static void REGAL_CALL emu_glSampleCoverageARB(GLclampf value, GLboolean invert)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
   switch( _context->emuLevel )
   {
     case 16 :
@@ -36921,28 +41612,22 @@ static void REGAL_CALL emu_glUniformMatrix2x3dv(GLint location, GLsizei count, G
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        if( _context->iff->currinst ) {
-          _context->iff->UniformMatrix( _context, 2, 3, location, count, transpose, value );
-        } else {
-          _context->dispatcher.emulation.glUniformMatrix2x3dv( location, count, transpose, value );
-        }
-        return;
+        _context->iff->FlushBatch( _context );
       }
       #endif
     case 1 :
     default:
-    {
-      DispatchTableGL *_next = _dispatch.next();
-      RegalAssert(_next);
-      _next->call(&_next->glUniformMatrix2x3dv)(location, count, transpose, value);
       break;
-    }
-
   }
 
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glSampleCoverageARB)(value, invert);
 }
 
-static void REGAL_CALL emu_glUniformMatrix2x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+// GL_ARB_multitexture
+
+static void REGAL_CALL emu_glActiveTextureARB(GLenum texture)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -36954,28 +41639,60 @@ static void REGAL_CALL emu_glUniformMatrix2x4dv(GLint location, GLsizei count, G
     case 16 :
     case 15 :
     case 14 :
+      #if REGAL_EMU_PPA
+      if (_context->ppa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 13;
+        _context->ppa->glActiveTexture( texture );
+      }
+      #endif
     case 13 :
     case 12 :
     case 11 :
+      #if REGAL_EMU_XFER
+      if (_context->xfer)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 10;
+        _context->xfer->ShadowActiveTexture( texture );
+      }
+      #endif
     case 10 :
     case 9 :
     case 8 :
     case 7 :
       #if REGAL_EMU_IFF
-      if (_context->iff) break;
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->ShadowActiveTexture( texture );
+      }
       #endif
     case 6 :
     case 5 :
+      #if REGAL_EMU_SO
+      if (_context->so) break;
+      #endif
     case 4 :
       #if REGAL_EMU_DSA
-      if (_context->dsa)
+      if (_context->dsa) break;
+      #endif
+    case 3 :
+    case 2 :
+      #if REGAL_EMU_TEXC
+      if (_context->texc)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        _context->dsa->RestoreGlslProgram( _context );
+        _context->emuLevel = 1;
+        _context->texc->ShadowActiveTexture( texture );
       }
       #endif
     case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt) break;
+      #endif
     default:
       break;
   }
@@ -36993,25 +41710,54 @@ static void REGAL_CALL emu_glUniformMatrix2x4dv(GLint location, GLsizei count, G
     case 9 :
     case 8 :
     case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff)
+    case 6 :
+    case 5 :
+      #if REGAL_EMU_SO
+      if (_context->so)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 6;
-        if( _context->iff->currinst ) {
-          _context->iff->UniformMatrix( _context, 2, 4, location, count, transpose, value );
-        } else {
-          _context->dispatcher.emulation.glUniformMatrix2x4dv( location, count, transpose, value );
+        _context->emuLevel = 4;
+        RegalAssert(_context);
+        if ( !_context->so->ActiveTexture( *_context, texture ) ) {
+           _context->dispatcher.emulation.glActiveTexture( texture );
+        }
+        return;
+      }
+      #endif
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 3;
+        if( false == _context->dsa->ShadowActiveTexture( texture ) ) {
+            _dispatch.call(&_dispatch.glActiveTexture)( texture );
         }
         return;
       }
       #endif
+    case 3 :
+    case 2 :
     case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 0;
+        if (!_context->info->gl_arb_multitexture)
+        {
+          DispatchTableGL *_next = _context->dispatcher.emulation.next();
+          RegalAssert(_next);
+          _next->call(&_next->glActiveTexture)(texture);
+          return;
+        }
+      }
+      #endif
     default:
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glUniformMatrix2x4dv)(location, count, transpose, value);
+      _next->call(&_next->glActiveTextureARB)(texture);
       break;
     }
 
@@ -37019,7 +41765,7 @@ static void REGAL_CALL emu_glUniformMatrix2x4dv(GLint location, GLsizei count, G
 
 }
 
-static void REGAL_CALL emu_glUniformMatrix3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+static void REGAL_CALL emu_glClientActiveTextureARB(GLenum texture)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -37032,27 +41778,56 @@ static void REGAL_CALL emu_glUniformMatrix3dv(GLint location, GLsizei count, GLb
     case 15 :
     case 14 :
     case 13 :
+      #if REGAL_EMU_PPCA
+      if (_context->ppca)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 12;
+        _context->ppca->glClientActiveTexture( texture );
+      }
+      #endif
     case 12 :
     case 11 :
     case 10 :
     case 9 :
+      #if REGAL_EMU_BASEVERTEX
+      if (_context->bv)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 8;
+        _context->bv->glClientActiveTexture( texture );
+      }
+      #endif
     case 8 :
     case 7 :
       #if REGAL_EMU_IFF
-      if (_context->iff) break;
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->ShadowClientActiveTexture( texture );
+      }
       #endif
     case 6 :
     case 5 :
     case 4 :
       #if REGAL_EMU_DSA
-      if (_context->dsa)
+      if (_context->dsa) break;
+      #endif
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        _context->dsa->RestoreGlslProgram( _context );
+        _context->emuLevel = 2;
+        _context->vao->ClientActiveTexture(*_context, texture );
       }
       #endif
+    case 2 :
     case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt) break;
+      #endif
     default:
       break;
   }
@@ -37070,25 +41845,42 @@ static void REGAL_CALL emu_glUniformMatrix3dv(GLint location, GLsizei count, GLb
     case 9 :
     case 8 :
     case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff)
+    case 6 :
+    case 5 :
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 6;
-        if( _context->iff->currinst ) {
-          _context->iff->UniformMatrix( _context, 3, 3, location, count, transpose, value );
-        } else {
-          _context->dispatcher.emulation.glUniformMatrix3dv( location, count, transpose, value );
+        _context->emuLevel = 3;
+        if (!_context->dsa->ShadowClientActiveTexture( texture )) {
+          _dispatch.call(&_dispatch.glClientActiveTexture)( texture );
         }
         return;
       }
       #endif
+    case 3 :
+    case 2 :
     case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 0;
+        if (!_context->info->gl_arb_multitexture)
+        {
+          DispatchTableGL &_table = _context->dispatcher.emulation;
+          _context->emuLevel++;
+          _table.call(&_table.glClientActiveTexture)(texture);
+          return;
+        }
+      }
+      #endif
     default:
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glUniformMatrix3dv)(location, count, transpose, value);
+      _next->call(&_next->glClientActiveTextureARB)(texture);
       break;
     }
 
@@ -37096,7 +41888,7 @@ static void REGAL_CALL emu_glUniformMatrix3dv(GLint location, GLsizei count, GLb
 
 }
 
-static void REGAL_CALL emu_glUniformMatrix3x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+static void REGAL_CALL emu_glMultiTexCoord1dARB(GLenum target, GLdouble s)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -37118,17 +41910,6 @@ static void REGAL_CALL emu_glUniformMatrix3x2dv(GLint location, GLsizei count, G
       #if REGAL_EMU_IFF
       if (_context->iff) break;
       #endif
-    case 6 :
-    case 5 :
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        _context->dsa->RestoreGlslProgram( _context );
-      }
-      #endif
     case 1 :
     default:
       break;
@@ -37152,11 +41933,7 @@ static void REGAL_CALL emu_glUniformMatrix3x2dv(GLint location, GLsizei count, G
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        if( _context->iff->currinst ) {
-          _context->iff->UniformMatrix( _context, 3, 2, location, count, transpose, value );
-        } else {
-          _context->dispatcher.emulation.glUniformMatrix3x2dv( location, count, transpose, value );
-        }
+        _context->iff->Attr<1>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), s );
         return;
       }
       #endif
@@ -37165,7 +41942,7 @@ static void REGAL_CALL emu_glUniformMatrix3x2dv(GLint location, GLsizei count, G
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glUniformMatrix3x2dv)(location, count, transpose, value);
+      _next->call(&_next->glMultiTexCoord1dARB)(target, s);
       break;
     }
 
@@ -37173,7 +41950,7 @@ static void REGAL_CALL emu_glUniformMatrix3x2dv(GLint location, GLsizei count, G
 
 }
 
-static void REGAL_CALL emu_glUniformMatrix3x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+static void REGAL_CALL emu_glMultiTexCoord1dvARB(GLenum target, const GLdouble *v)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -37195,17 +41972,6 @@ static void REGAL_CALL emu_glUniformMatrix3x4dv(GLint location, GLsizei count, G
       #if REGAL_EMU_IFF
       if (_context->iff) break;
       #endif
-    case 6 :
-    case 5 :
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        _context->dsa->RestoreGlslProgram( _context );
-      }
-      #endif
     case 1 :
     default:
       break;
@@ -37229,11 +41995,7 @@ static void REGAL_CALL emu_glUniformMatrix3x4dv(GLint location, GLsizei count, G
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        if( _context->iff->currinst ) {
-          _context->iff->UniformMatrix( _context, 3, 4, location, count, transpose, value );
-        } else {
-          _context->dispatcher.emulation.glUniformMatrix3x4dv( location, count, transpose, value );
-        }
+        _context->iff->Attr<1>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), v );
         return;
       }
       #endif
@@ -37242,7 +42004,7 @@ static void REGAL_CALL emu_glUniformMatrix3x4dv(GLint location, GLsizei count, G
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glUniformMatrix3x4dv)(location, count, transpose, value);
+      _next->call(&_next->glMultiTexCoord1dvARB)(target, v);
       break;
     }
 
@@ -37250,7 +42012,7 @@ static void REGAL_CALL emu_glUniformMatrix3x4dv(GLint location, GLsizei count, G
 
 }
 
-static void REGAL_CALL emu_glUniformMatrix4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+static void REGAL_CALL emu_glMultiTexCoord1fARB(GLenum target, GLfloat s)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -37272,17 +42034,6 @@ static void REGAL_CALL emu_glUniformMatrix4dv(GLint location, GLsizei count, GLb
       #if REGAL_EMU_IFF
       if (_context->iff) break;
       #endif
-    case 6 :
-    case 5 :
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        _context->dsa->RestoreGlslProgram( _context );
-      }
-      #endif
     case 1 :
     default:
       break;
@@ -37306,11 +42057,7 @@ static void REGAL_CALL emu_glUniformMatrix4dv(GLint location, GLsizei count, GLb
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        if( _context->iff->currinst ) {
-          _context->iff->UniformMatrix( _context, 4, 4, location, count, transpose, value );
-        } else {
-          _context->dispatcher.emulation.glUniformMatrix4dv( location, count, transpose, value );
-        }
+        _context->iff->Attr<1>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), s );
         return;
       }
       #endif
@@ -37319,7 +42066,7 @@ static void REGAL_CALL emu_glUniformMatrix4dv(GLint location, GLsizei count, GLb
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glUniformMatrix4dv)(location, count, transpose, value);
+      _next->call(&_next->glMultiTexCoord1fARB)(target, s);
       break;
     }
 
@@ -37327,7 +42074,7 @@ static void REGAL_CALL emu_glUniformMatrix4dv(GLint location, GLsizei count, GLb
 
 }
 
-static void REGAL_CALL emu_glUniformMatrix4x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+static void REGAL_CALL emu_glMultiTexCoord1fvARB(GLenum target, const GLfloat *v)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -37349,17 +42096,6 @@ static void REGAL_CALL emu_glUniformMatrix4x2dv(GLint location, GLsizei count, G
       #if REGAL_EMU_IFF
       if (_context->iff) break;
       #endif
-    case 6 :
-    case 5 :
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        _context->dsa->RestoreGlslProgram( _context );
-      }
-      #endif
     case 1 :
     default:
       break;
@@ -37383,11 +42119,7 @@ static void REGAL_CALL emu_glUniformMatrix4x2dv(GLint location, GLsizei count, G
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        if( _context->iff->currinst ) {
-          _context->iff->UniformMatrix( _context, 4, 2, location, count, transpose, value );
-        } else {
-          _context->dispatcher.emulation.glUniformMatrix4x2dv( location, count, transpose, value );
-        }
+        _context->iff->Attr<1>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), v );
         return;
       }
       #endif
@@ -37396,7 +42128,7 @@ static void REGAL_CALL emu_glUniformMatrix4x2dv(GLint location, GLsizei count, G
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glUniformMatrix4x2dv)(location, count, transpose, value);
+      _next->call(&_next->glMultiTexCoord1fvARB)(target, v);
       break;
     }
 
@@ -37404,7 +42136,7 @@ static void REGAL_CALL emu_glUniformMatrix4x2dv(GLint location, GLsizei count, G
 
 }
 
-static void REGAL_CALL emu_glUniformMatrix4x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+static void REGAL_CALL emu_glMultiTexCoord1iARB(GLenum target, GLint s)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -37426,17 +42158,6 @@ static void REGAL_CALL emu_glUniformMatrix4x3dv(GLint location, GLsizei count, G
       #if REGAL_EMU_IFF
       if (_context->iff) break;
       #endif
-    case 6 :
-    case 5 :
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        _context->dsa->RestoreGlslProgram( _context );
-      }
-      #endif
     case 1 :
     default:
       break;
@@ -37460,11 +42181,7 @@ static void REGAL_CALL emu_glUniformMatrix4x3dv(GLint location, GLsizei count, G
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        if( _context->iff->currinst ) {
-          _context->iff->UniformMatrix( _context, 4, 3, location, count, transpose, value );
-        } else {
-          _context->dispatcher.emulation.glUniformMatrix4x3dv( location, count, transpose, value );
-        }
+        _context->iff->Attr<1>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), s );
         return;
       }
       #endif
@@ -37473,197 +42190,15 @@ static void REGAL_CALL emu_glUniformMatrix4x3dv(GLint location, GLsizei count, G
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glUniformMatrix4x3dv)(location, count, transpose, value);
-      break;
-    }
-
-  }
-
-}
-
-// GL_ARB_imaging
-
-static void REGAL_CALL emu_glColorTableParameterfv(GLenum target, GLenum pname, const GLfloat *params)
-{
-  RegalContext *_context = REGAL_GET_CONTEXT();
-  RegalAssert(_context);
-  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
-
-  // prefix
-  switch( _context->emuLevel )
-  {
-    case 16 :
-    case 15 :
-    case 14 :
-      #if REGAL_EMU_PPA
-      if (_context->ppa)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 13;
-        _context->ppa->glColorTableParameterv( target, pname, params );
-      }
-      #endif
-    case 1 :
-    default:
-      break;
-  }
-
-  DispatchTableGL *_next = _dispatch.next();
-  RegalAssert(_next);
-  _next->call(& _next->glColorTableParameterfv)(target, pname, params);
-}
-
-static void REGAL_CALL emu_glColorTableParameteriv(GLenum target, GLenum pname, const GLint *params)
-{
-  RegalContext *_context = REGAL_GET_CONTEXT();
-  RegalAssert(_context);
-  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
-
-  // prefix
-  switch( _context->emuLevel )
-  {
-    case 16 :
-    case 15 :
-    case 14 :
-      #if REGAL_EMU_PPA
-      if (_context->ppa)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 13;
-        _context->ppa->glColorTableParameterv( target, pname, params );
-      }
-      #endif
-    case 1 :
-    default:
-      break;
-  }
-
-  DispatchTableGL *_next = _dispatch.next();
-  RegalAssert(_next);
-  _next->call(& _next->glColorTableParameteriv)(target, pname, params);
-}
-
-static void REGAL_CALL emu_glConvolutionParameterf(GLenum target, GLenum pname, GLfloat params)
-{
-  RegalContext *_context = REGAL_GET_CONTEXT();
-  RegalAssert(_context);
-  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
-
-  // prefix
-  switch( _context->emuLevel )
-  {
-    case 16 :
-    case 15 :
-    case 14 :
-      #if REGAL_EMU_PPA
-      if (_context->ppa)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 13;
-        _context->ppa->glConvolutionParameter( target, pname, params );
-      }
-      #endif
-    case 1 :
-    default:
-      break;
-  }
-
-  DispatchTableGL *_next = _dispatch.next();
-  RegalAssert(_next);
-  _next->call(& _next->glConvolutionParameterf)(target, pname, params);
-}
-
-static void REGAL_CALL emu_glConvolutionParameterfv(GLenum target, GLenum pname, const GLfloat *params)
-{
-  RegalContext *_context = REGAL_GET_CONTEXT();
-  RegalAssert(_context);
-  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
-
-  // prefix
-  switch( _context->emuLevel )
-  {
-    case 16 :
-    case 15 :
-    case 14 :
-      #if REGAL_EMU_PPA
-      if (_context->ppa)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 13;
-        _context->ppa->glConvolutionParameterv( target, pname, params );
-      }
-      #endif
-    case 1 :
-    default:
-      break;
-  }
-
-  DispatchTableGL *_next = _dispatch.next();
-  RegalAssert(_next);
-  _next->call(& _next->glConvolutionParameterfv)(target, pname, params);
-}
-
-static void REGAL_CALL emu_glConvolutionParameteri(GLenum target, GLenum pname, GLint params)
-{
-  RegalContext *_context = REGAL_GET_CONTEXT();
-  RegalAssert(_context);
-  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
-
-  // prefix
-  switch( _context->emuLevel )
-  {
-    case 16 :
-    case 15 :
-    case 14 :
-      #if REGAL_EMU_PPA
-      if (_context->ppa)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 13;
-        _context->ppa->glConvolutionParameter( target, pname, params );
-      }
-      #endif
-    case 1 :
-    default:
-      break;
-  }
-
-  DispatchTableGL *_next = _dispatch.next();
-  RegalAssert(_next);
-  _next->call(& _next->glConvolutionParameteri)(target, pname, params);
-}
-
-static void REGAL_CALL emu_glConvolutionParameteriv(GLenum target, GLenum pname, const GLint *params)
-{
-  RegalContext *_context = REGAL_GET_CONTEXT();
-  RegalAssert(_context);
-  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
-
-  // prefix
-  switch( _context->emuLevel )
-  {
-    case 16 :
-    case 15 :
-    case 14 :
-      #if REGAL_EMU_PPA
-      if (_context->ppa)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 13;
-        _context->ppa->glConvolutionParameterv( target, pname, params );
-      }
-      #endif
-    case 1 :
-    default:
+      _next->call(&_next->glMultiTexCoord1iARB)(target, s);
       break;
+    }
+
   }
 
-  DispatchTableGL *_next = _dispatch.next();
-  RegalAssert(_next);
-  _next->call(& _next->glConvolutionParameteriv)(target, pname, params);
 }
 
-static void REGAL_CALL emu_glGetColorTableParameterfv(GLenum target, GLenum pname, GLfloat *params)
+static void REGAL_CALL emu_glMultiTexCoord1ivARB(GLenum target, const GLint *v)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -37675,8 +42210,15 @@ static void REGAL_CALL emu_glGetColorTableParameterfv(GLenum target, GLenum pnam
     case 16 :
     case 15 :
     case 14 :
-      #if REGAL_EMU_PPA
-      if (_context->ppa) break;
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff) break;
       #endif
     case 1 :
     default:
@@ -37689,14 +42231,19 @@ static void REGAL_CALL emu_glGetColorTableParameterfv(GLenum target, GLenum pnam
     case 16 :
     case 15 :
     case 14 :
-      #if REGAL_EMU_PPA
-      if (_context->ppa)
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 13;
-        if( ! _context->ppa->glGetColorTableParameterv( _context, target, pname, params ) ) {
-          _context->dispatcher.emulation.glGetColorTableParameterfv( target, pname, params );
-        }
+        _context->emuLevel = 6;
+        _context->iff->Attr<1>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), v );
         return;
       }
       #endif
@@ -37705,7 +42252,7 @@ static void REGAL_CALL emu_glGetColorTableParameterfv(GLenum target, GLenum pnam
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glGetColorTableParameterfv)(target, pname, params);
+      _next->call(&_next->glMultiTexCoord1ivARB)(target, v);
       break;
     }
 
@@ -37713,7 +42260,7 @@ static void REGAL_CALL emu_glGetColorTableParameterfv(GLenum target, GLenum pnam
 
 }
 
-static void REGAL_CALL emu_glGetColorTableParameteriv(GLenum target, GLenum pname, GLint *params)
+static void REGAL_CALL emu_glMultiTexCoord1sARB(GLenum target, GLshort s)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -37725,8 +42272,15 @@ static void REGAL_CALL emu_glGetColorTableParameteriv(GLenum target, GLenum pnam
     case 16 :
     case 15 :
     case 14 :
-      #if REGAL_EMU_PPA
-      if (_context->ppa) break;
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff) break;
       #endif
     case 1 :
     default:
@@ -37739,14 +42293,19 @@ static void REGAL_CALL emu_glGetColorTableParameteriv(GLenum target, GLenum pnam
     case 16 :
     case 15 :
     case 14 :
-      #if REGAL_EMU_PPA
-      if (_context->ppa)
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 13;
-        if( ! _context->ppa->glGetColorTableParameterv( _context, target, pname, params ) ) {
-          _context->dispatcher.emulation.glGetColorTableParameteriv( target, pname, params );
-        }
+        _context->emuLevel = 6;
+        _context->iff->Attr<1>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), s );
         return;
       }
       #endif
@@ -37755,7 +42314,7 @@ static void REGAL_CALL emu_glGetColorTableParameteriv(GLenum target, GLenum pnam
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glGetColorTableParameteriv)(target, pname, params);
+      _next->call(&_next->glMultiTexCoord1sARB)(target, s);
       break;
     }
 
@@ -37763,7 +42322,7 @@ static void REGAL_CALL emu_glGetColorTableParameteriv(GLenum target, GLenum pnam
 
 }
 
-static void REGAL_CALL emu_glGetConvolutionParameterfv(GLenum target, GLenum pname, GLfloat *params)
+static void REGAL_CALL emu_glMultiTexCoord1svARB(GLenum target, const GLshort *v)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -37775,8 +42334,15 @@ static void REGAL_CALL emu_glGetConvolutionParameterfv(GLenum target, GLenum pna
     case 16 :
     case 15 :
     case 14 :
-      #if REGAL_EMU_PPA
-      if (_context->ppa) break;
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff) break;
       #endif
     case 1 :
     default:
@@ -37789,14 +42355,19 @@ static void REGAL_CALL emu_glGetConvolutionParameterfv(GLenum target, GLenum pna
     case 16 :
     case 15 :
     case 14 :
-      #if REGAL_EMU_PPA
-      if (_context->ppa)
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 13;
-        if( ! _context->ppa->glGetConvolutionParameterv( _context, target, pname, params ) ) {
-          _context->dispatcher.emulation.glGetConvolutionParameterfv( target, pname, params );
-        }
+        _context->emuLevel = 6;
+        _context->iff->Attr<1>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), v );
         return;
       }
       #endif
@@ -37805,7 +42376,7 @@ static void REGAL_CALL emu_glGetConvolutionParameterfv(GLenum target, GLenum pna
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glGetConvolutionParameterfv)(target, pname, params);
+      _next->call(&_next->glMultiTexCoord1svARB)(target, v);
       break;
     }
 
@@ -37813,7 +42384,7 @@ static void REGAL_CALL emu_glGetConvolutionParameterfv(GLenum target, GLenum pna
 
 }
 
-static void REGAL_CALL emu_glGetConvolutionParameteriv(GLenum target, GLenum pname, GLint *params)
+static void REGAL_CALL emu_glMultiTexCoord2dARB(GLenum target, GLdouble s, GLdouble t)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -37825,8 +42396,15 @@ static void REGAL_CALL emu_glGetConvolutionParameteriv(GLenum target, GLenum pna
     case 16 :
     case 15 :
     case 14 :
-      #if REGAL_EMU_PPA
-      if (_context->ppa) break;
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff) break;
       #endif
     case 1 :
     default:
@@ -37839,14 +42417,19 @@ static void REGAL_CALL emu_glGetConvolutionParameteriv(GLenum target, GLenum pna
     case 16 :
     case 15 :
     case 14 :
-      #if REGAL_EMU_PPA
-      if (_context->ppa)
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 13;
-        if( ! _context->ppa->glGetConvolutionParameterv( _context, target, pname, params ) ) {
-          _context->dispatcher.emulation.glGetConvolutionParameteriv( target, pname, params );
-        }
+        _context->emuLevel = 6;
+        _context->iff->Attr<2>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), s, t );
         return;
       }
       #endif
@@ -37855,7 +42438,7 @@ static void REGAL_CALL emu_glGetConvolutionParameteriv(GLenum target, GLenum pna
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glGetConvolutionParameteriv)(target, pname, params);
+      _next->call(&_next->glMultiTexCoord2dARB)(target, s, t);
       break;
     }
 
@@ -37863,19 +42446,7 @@ static void REGAL_CALL emu_glGetConvolutionParameteriv(GLenum target, GLenum pna
 
 }
 
-// GL_ARB_indirect_parameters
-
-// GL_ARB_instanced_arrays
-
-// GL_ARB_internalformat_query
-
-// GL_ARB_internalformat_query2
-
-// GL_ARB_invalidate_subdata
-
-// GL_ARB_map_buffer_range
-
-static void REGAL_CALL emu_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length)
+static void REGAL_CALL emu_glMultiTexCoord2dvARB(GLenum target, const GLdouble *v)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -37894,34 +42465,15 @@ static void REGAL_CALL emu_glFlushMappedBufferRange(GLenum target, GLintptr offs
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        _context->dsa->RestoreBuffer( _context );
-      }
+      #if REGAL_EMU_IFF
+      if (_context->iff) break;
       #endif
     case 1 :
     default:
       break;
   }
 
-  DispatchTableGL *_next = _dispatch.next();
-  RegalAssert(_next);
-  _next->call(& _next->glFlushMappedBufferRange)(target, offset, length);
-}
-
-static GLvoid *REGAL_CALL emu_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
-{
-  RegalContext *_context = REGAL_GET_CONTEXT();
-  RegalAssert(_context);
-  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
-
-  // prefix
+  // impl
   switch( _context->emuLevel )
   {
     case 16 :
@@ -37934,32 +42486,29 @@ static GLvoid *REGAL_CALL emu_glMapBufferRange(GLenum target, GLintptr offset, G
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        _context->dsa->RestoreBuffer( _context );
+        _context->emuLevel = 6;
+        _context->iff->Attr<2>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), v );
+        return;
       }
       #endif
     case 1 :
     default:
+    {
+      DispatchTableGL *_next = _dispatch.next();
+      RegalAssert(_next);
+      _next->call(&_next->glMultiTexCoord2dvARB)(target, v);
       break;
+    }
+
   }
 
-  DispatchTableGL *_next = _dispatch.next();
-  RegalAssert(_next);
-  return _next->call(& _next->glMapBufferRange)(target, offset, length, access);
 }
 
-// GL_ARB_matrix_palette
-
-// GL_ARB_multi_bind
-
-static void REGAL_CALL emu_glBindVertexBuffers(GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides)
+static void REGAL_CALL emu_glMultiTexCoord2fARB(GLenum target, GLfloat s, GLfloat t)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -37972,33 +42521,21 @@ static void REGAL_CALL emu_glBindVertexBuffers(GLuint first, GLsizei count, cons
     case 15 :
     case 14 :
     case 13 :
-      #if REGAL_EMU_PPCA
-      if (_context->ppca)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 12;
-        _context->ppca->glBindVertexBuffers( first, count, buffers, offsets, strides );
-      }
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff) break;
       #endif
     case 1 :
     default:
       break;
   }
 
-  DispatchTableGL *_next = _dispatch.next();
-  RegalAssert(_next);
-  _next->call(& _next->glBindVertexBuffers)(first, count, buffers, offsets, strides);
-}
-
-// GL_ARB_multi_draw_indirect
-
-static void REGAL_CALL emu_glMultiDrawArraysIndirect(GLenum mode, const GLvoid *indirect, GLsizei primcount, GLsizei stride)
-{
-  RegalContext *_context = REGAL_GET_CONTEXT();
-  RegalAssert(_context);
-  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
-
-  // prefix
+  // impl
   switch( _context->emuLevel )
   {
     case 16 :
@@ -38016,40 +42553,24 @@ static void REGAL_CALL emu_glMultiDrawArraysIndirect(GLenum mode, const GLvoid *
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->PreDraw( _context );
-      }
-      #endif
-    case 6 :
-    case 5 :
-      #if REGAL_EMU_SO
-      if (_context->so)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 4;
-        RegalAssert(_context);
-        _context->so->PreDraw( *_context );
-      }
-      #endif
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        _context->dsa->Restore( _context );
+        _context->iff->Attr<2>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), s, t );
+        return;
       }
       #endif
     case 1 :
     default:
+    {
+      DispatchTableGL *_next = _dispatch.next();
+      RegalAssert(_next);
+      _next->call(&_next->glMultiTexCoord2fARB)(target, s, t);
       break;
+    }
+
   }
 
-  DispatchTableGL *_next = _dispatch.next();
-  RegalAssert(_next);
-  _next->call(& _next->glMultiDrawArraysIndirect)(mode, indirect, primcount, stride);
 }
 
-static void REGAL_CALL emu_glMultiDrawElementsIndirect(GLenum mode, GLenum type, const GLvoid *indirect, GLsizei primcount, GLsizei stride)
+static void REGAL_CALL emu_glMultiTexCoord2fvARB(GLenum target, const GLfloat *v)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -38057,6 +42578,27 @@ static void REGAL_CALL emu_glMultiDrawElementsIndirect(GLenum mode, GLenum type,
 
   // prefix
   switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff) break;
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  // impl
+  switch( _context->emuLevel )
   {
     case 16 :
     case 15 :
@@ -38073,44 +42615,24 @@ static void REGAL_CALL emu_glMultiDrawElementsIndirect(GLenum mode, GLenum type,
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->PreDraw( _context );
-      }
-      #endif
-    case 6 :
-    case 5 :
-      #if REGAL_EMU_SO
-      if (_context->so)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 4;
-        RegalAssert(_context);
-        _context->so->PreDraw( *_context );
-      }
-      #endif
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        _context->dsa->Restore( _context );
+        _context->iff->Attr<2>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), v );
+        return;
       }
       #endif
     case 1 :
     default:
+    {
+      DispatchTableGL *_next = _dispatch.next();
+      RegalAssert(_next);
+      _next->call(&_next->glMultiTexCoord2fvARB)(target, v);
       break;
+    }
+
   }
 
-  DispatchTableGL *_next = _dispatch.next();
-  RegalAssert(_next);
-  _next->call(& _next->glMultiDrawElementsIndirect)(mode, type, indirect, primcount, stride);
 }
 
-// GL_ARB_multisample
-
-// GL_ARB_multitexture
-
-static void REGAL_CALL emu_glActiveTextureARB(GLenum texture)
+static void REGAL_CALL emu_glMultiTexCoord2iARB(GLenum target, GLint s, GLint t)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -38122,60 +42644,17 @@ static void REGAL_CALL emu_glActiveTextureARB(GLenum texture)
     case 16 :
     case 15 :
     case 14 :
-      #if REGAL_EMU_PPA
-      if (_context->ppa)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 13;
-        _context->ppa->glActiveTexture( texture );
-      }
-      #endif
     case 13 :
     case 12 :
     case 11 :
-      #if REGAL_EMU_XFER
-      if (_context->xfer)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 10;
-        _context->xfer->ShadowActiveTexture( texture );
-      }
-      #endif
     case 10 :
     case 9 :
     case 8 :
     case 7 :
       #if REGAL_EMU_IFF
-      if (_context->iff)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 6;
-        _context->iff->ShadowActiveTexture( texture );
-      }
-      #endif
-    case 6 :
-    case 5 :
-      #if REGAL_EMU_SO
-      if (_context->so) break;
-      #endif
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa) break;
-      #endif
-    case 3 :
-    case 2 :
-      #if REGAL_EMU_TEXC
-      if (_context->texc)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 1;
-        _context->texc->ShadowActiveTexture( texture );
-      }
+      if (_context->iff) break;
       #endif
     case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt) break;
-      #endif
     default:
       break;
   }
@@ -38193,54 +42672,21 @@ static void REGAL_CALL emu_glActiveTextureARB(GLenum texture)
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-      #if REGAL_EMU_SO
-      if (_context->so)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 4;
-        RegalAssert(_context);
-        if ( !_context->so->ActiveTexture( *_context, texture ) ) {
-           _context->dispatcher.emulation.glActiveTexture( texture );
-        }
-        return;
-      }
-      #endif
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        if( false == _context->dsa->ShadowActiveTexture( texture ) ) {
-            _dispatch.call(&_dispatch.glActiveTexture)( texture );
-        }
+        _context->emuLevel = 6;
+        _context->iff->Attr<2>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), s, t );
         return;
       }
       #endif
-    case 3 :
-    case 2 :
     case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 0;
-        if (!_context->info->gl_arb_multitexture)
-        {
-          DispatchTableGL *_next = _context->dispatcher.emulation.next();
-          RegalAssert(_next);
-          _next->call(&_next->glActiveTexture)(texture);
-          return;
-        }
-      }
-      #endif
     default:
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glActiveTextureARB)(texture);
+      _next->call(&_next->glMultiTexCoord2iARB)(target, s, t);
       break;
     }
 
@@ -38248,7 +42694,7 @@ static void REGAL_CALL emu_glActiveTextureARB(GLenum texture)
 
 }
 
-static void REGAL_CALL emu_glClientActiveTextureARB(GLenum texture)
+static void REGAL_CALL emu_glMultiTexCoord2ivARB(GLenum target, const GLint *v)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -38261,56 +42707,16 @@ static void REGAL_CALL emu_glClientActiveTextureARB(GLenum texture)
     case 15 :
     case 14 :
     case 13 :
-      #if REGAL_EMU_PPCA
-      if (_context->ppca)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 12;
-        _context->ppca->glClientActiveTexture( texture );
-      }
-      #endif
     case 12 :
     case 11 :
     case 10 :
     case 9 :
-      #if REGAL_EMU_BASEVERTEX
-      if (_context->bv)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 8;
-        _context->bv->glClientActiveTexture( texture );
-      }
-      #endif
     case 8 :
     case 7 :
       #if REGAL_EMU_IFF
-      if (_context->iff)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 6;
-        _context->iff->ShadowClientActiveTexture( texture );
-      }
-      #endif
-    case 6 :
-    case 5 :
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa) break;
-      #endif
-    case 3 :
-      #if REGAL_EMU_VAO
-      if (_context->vao)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 2;
-        _context->vao->ClientActiveTexture(*_context, texture );
-      }
+      if (_context->iff) break;
       #endif
-    case 2 :
     case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt) break;
-      #endif
     default:
       break;
   }
@@ -38328,42 +42734,21 @@ static void REGAL_CALL emu_glClientActiveTextureARB(GLenum texture)
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        if (!_context->dsa->ShadowClientActiveTexture( texture )) {
-          _dispatch.call(&_dispatch.glClientActiveTexture)( texture );
-        }
+        _context->emuLevel = 6;
+        _context->iff->Attr<2>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), v );
         return;
       }
       #endif
-    case 3 :
-    case 2 :
     case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 0;
-        if (!_context->info->gl_arb_multitexture)
-        {
-          DispatchTableGL &_table = _context->dispatcher.emulation;
-          _context->emuLevel++;
-          _table.call(&_table.glClientActiveTexture)(texture);
-          return;
-        }
-      }
-      #endif
     default:
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glClientActiveTextureARB)(texture);
+      _next->call(&_next->glMultiTexCoord2ivARB)(target, v);
       break;
     }
 
@@ -38371,7 +42756,7 @@ static void REGAL_CALL emu_glClientActiveTextureARB(GLenum texture)
 
 }
 
-static void REGAL_CALL emu_glMultiTexCoord1dARB(GLenum target, GLdouble s)
+static void REGAL_CALL emu_glMultiTexCoord2sARB(GLenum target, GLshort s, GLshort t)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -38416,7 +42801,7 @@ static void REGAL_CALL emu_glMultiTexCoord1dARB(GLenum target, GLdouble s)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->Attr<1>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), s );
+        _context->iff->Attr<2>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), s, t );
         return;
       }
       #endif
@@ -38425,7 +42810,7 @@ static void REGAL_CALL emu_glMultiTexCoord1dARB(GLenum target, GLdouble s)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexCoord1dARB)(target, s);
+      _next->call(&_next->glMultiTexCoord2sARB)(target, s, t);
       break;
     }
 
@@ -38433,7 +42818,7 @@ static void REGAL_CALL emu_glMultiTexCoord1dARB(GLenum target, GLdouble s)
 
 }
 
-static void REGAL_CALL emu_glMultiTexCoord1dvARB(GLenum target, const GLdouble *v)
+static void REGAL_CALL emu_glMultiTexCoord2svARB(GLenum target, const GLshort *v)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -38478,7 +42863,7 @@ static void REGAL_CALL emu_glMultiTexCoord1dvARB(GLenum target, const GLdouble *
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->Attr<1>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), v );
+        _context->iff->Attr<2>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), v );
         return;
       }
       #endif
@@ -38487,7 +42872,7 @@ static void REGAL_CALL emu_glMultiTexCoord1dvARB(GLenum target, const GLdouble *
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexCoord1dvARB)(target, v);
+      _next->call(&_next->glMultiTexCoord2svARB)(target, v);
       break;
     }
 
@@ -38495,7 +42880,7 @@ static void REGAL_CALL emu_glMultiTexCoord1dvARB(GLenum target, const GLdouble *
 
 }
 
-static void REGAL_CALL emu_glMultiTexCoord1fARB(GLenum target, GLfloat s)
+static void REGAL_CALL emu_glMultiTexCoord3dARB(GLenum target, GLdouble s, GLdouble t, GLdouble r)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -38540,7 +42925,7 @@ static void REGAL_CALL emu_glMultiTexCoord1fARB(GLenum target, GLfloat s)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->Attr<1>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), s );
+        _context->iff->Attr<3>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), s, t, r );
         return;
       }
       #endif
@@ -38549,7 +42934,7 @@ static void REGAL_CALL emu_glMultiTexCoord1fARB(GLenum target, GLfloat s)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexCoord1fARB)(target, s);
+      _next->call(&_next->glMultiTexCoord3dARB)(target, s, t, r);
       break;
     }
 
@@ -38557,7 +42942,7 @@ static void REGAL_CALL emu_glMultiTexCoord1fARB(GLenum target, GLfloat s)
 
 }
 
-static void REGAL_CALL emu_glMultiTexCoord1fvARB(GLenum target, const GLfloat *v)
+static void REGAL_CALL emu_glMultiTexCoord3dvARB(GLenum target, const GLdouble *v)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -38602,7 +42987,7 @@ static void REGAL_CALL emu_glMultiTexCoord1fvARB(GLenum target, const GLfloat *v
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->Attr<1>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), v );
+        _context->iff->Attr<3>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), v );
         return;
       }
       #endif
@@ -38611,7 +42996,7 @@ static void REGAL_CALL emu_glMultiTexCoord1fvARB(GLenum target, const GLfloat *v
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexCoord1fvARB)(target, v);
+      _next->call(&_next->glMultiTexCoord3dvARB)(target, v);
       break;
     }
 
@@ -38619,7 +43004,7 @@ static void REGAL_CALL emu_glMultiTexCoord1fvARB(GLenum target, const GLfloat *v
 
 }
 
-static void REGAL_CALL emu_glMultiTexCoord1iARB(GLenum target, GLint s)
+static void REGAL_CALL emu_glMultiTexCoord3fARB(GLenum target, GLfloat s, GLfloat t, GLfloat r)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -38664,7 +43049,7 @@ static void REGAL_CALL emu_glMultiTexCoord1iARB(GLenum target, GLint s)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->Attr<1>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), s );
+        _context->iff->Attr<3>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), s, t, r );
         return;
       }
       #endif
@@ -38673,7 +43058,7 @@ static void REGAL_CALL emu_glMultiTexCoord1iARB(GLenum target, GLint s)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexCoord1iARB)(target, s);
+      _next->call(&_next->glMultiTexCoord3fARB)(target, s, t, r);
       break;
     }
 
@@ -38681,7 +43066,7 @@ static void REGAL_CALL emu_glMultiTexCoord1iARB(GLenum target, GLint s)
 
 }
 
-static void REGAL_CALL emu_glMultiTexCoord1ivARB(GLenum target, const GLint *v)
+static void REGAL_CALL emu_glMultiTexCoord3fvARB(GLenum target, const GLfloat *v)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -38726,7 +43111,7 @@ static void REGAL_CALL emu_glMultiTexCoord1ivARB(GLenum target, const GLint *v)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->Attr<1>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), v );
+        _context->iff->Attr<3>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), v );
         return;
       }
       #endif
@@ -38735,7 +43120,7 @@ static void REGAL_CALL emu_glMultiTexCoord1ivARB(GLenum target, const GLint *v)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexCoord1ivARB)(target, v);
+      _next->call(&_next->glMultiTexCoord3fvARB)(target, v);
       break;
     }
 
@@ -38743,7 +43128,7 @@ static void REGAL_CALL emu_glMultiTexCoord1ivARB(GLenum target, const GLint *v)
 
 }
 
-static void REGAL_CALL emu_glMultiTexCoord1sARB(GLenum target, GLshort s)
+static void REGAL_CALL emu_glMultiTexCoord3iARB(GLenum target, GLint s, GLint t, GLint r)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -38788,7 +43173,7 @@ static void REGAL_CALL emu_glMultiTexCoord1sARB(GLenum target, GLshort s)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->Attr<1>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), s );
+        _context->iff->Attr<3>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), s, t, r );
         return;
       }
       #endif
@@ -38797,7 +43182,7 @@ static void REGAL_CALL emu_glMultiTexCoord1sARB(GLenum target, GLshort s)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexCoord1sARB)(target, s);
+      _next->call(&_next->glMultiTexCoord3iARB)(target, s, t, r);
       break;
     }
 
@@ -38805,7 +43190,7 @@ static void REGAL_CALL emu_glMultiTexCoord1sARB(GLenum target, GLshort s)
 
 }
 
-static void REGAL_CALL emu_glMultiTexCoord1svARB(GLenum target, const GLshort *v)
+static void REGAL_CALL emu_glMultiTexCoord3ivARB(GLenum target, const GLint *v)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -38850,7 +43235,7 @@ static void REGAL_CALL emu_glMultiTexCoord1svARB(GLenum target, const GLshort *v
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->Attr<1>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), v );
+        _context->iff->Attr<3>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), v );
         return;
       }
       #endif
@@ -38859,7 +43244,7 @@ static void REGAL_CALL emu_glMultiTexCoord1svARB(GLenum target, const GLshort *v
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexCoord1svARB)(target, v);
+      _next->call(&_next->glMultiTexCoord3ivARB)(target, v);
       break;
     }
 
@@ -38867,7 +43252,7 @@ static void REGAL_CALL emu_glMultiTexCoord1svARB(GLenum target, const GLshort *v
 
 }
 
-static void REGAL_CALL emu_glMultiTexCoord2dARB(GLenum target, GLdouble s, GLdouble t)
+static void REGAL_CALL emu_glMultiTexCoord3sARB(GLenum target, GLshort s, GLshort t, GLshort r)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -38912,7 +43297,7 @@ static void REGAL_CALL emu_glMultiTexCoord2dARB(GLenum target, GLdouble s, GLdou
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->Attr<2>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), s, t );
+        _context->iff->Attr<3>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), s, t, r );
         return;
       }
       #endif
@@ -38921,7 +43306,7 @@ static void REGAL_CALL emu_glMultiTexCoord2dARB(GLenum target, GLdouble s, GLdou
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexCoord2dARB)(target, s, t);
+      _next->call(&_next->glMultiTexCoord3sARB)(target, s, t, r);
       break;
     }
 
@@ -38929,7 +43314,7 @@ static void REGAL_CALL emu_glMultiTexCoord2dARB(GLenum target, GLdouble s, GLdou
 
 }
 
-static void REGAL_CALL emu_glMultiTexCoord2dvARB(GLenum target, const GLdouble *v)
+static void REGAL_CALL emu_glMultiTexCoord3svARB(GLenum target, const GLshort *v)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -38974,7 +43359,7 @@ static void REGAL_CALL emu_glMultiTexCoord2dvARB(GLenum target, const GLdouble *
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->Attr<2>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), v );
+        _context->iff->Attr<3>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), v );
         return;
       }
       #endif
@@ -38983,7 +43368,7 @@ static void REGAL_CALL emu_glMultiTexCoord2dvARB(GLenum target, const GLdouble *
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexCoord2dvARB)(target, v);
+      _next->call(&_next->glMultiTexCoord3svARB)(target, v);
       break;
     }
 
@@ -38991,7 +43376,7 @@ static void REGAL_CALL emu_glMultiTexCoord2dvARB(GLenum target, const GLdouble *
 
 }
 
-static void REGAL_CALL emu_glMultiTexCoord2fARB(GLenum target, GLfloat s, GLfloat t)
+static void REGAL_CALL emu_glMultiTexCoord4dARB(GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -39036,7 +43421,7 @@ static void REGAL_CALL emu_glMultiTexCoord2fARB(GLenum target, GLfloat s, GLfloa
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->Attr<2>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), s, t );
+        _context->iff->Attr<4>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), s, t, r, q );
         return;
       }
       #endif
@@ -39045,7 +43430,7 @@ static void REGAL_CALL emu_glMultiTexCoord2fARB(GLenum target, GLfloat s, GLfloa
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexCoord2fARB)(target, s, t);
+      _next->call(&_next->glMultiTexCoord4dARB)(target, s, t, r, q);
       break;
     }
 
@@ -39053,7 +43438,7 @@ static void REGAL_CALL emu_glMultiTexCoord2fARB(GLenum target, GLfloat s, GLfloa
 
 }
 
-static void REGAL_CALL emu_glMultiTexCoord2fvARB(GLenum target, const GLfloat *v)
+static void REGAL_CALL emu_glMultiTexCoord4dvARB(GLenum target, const GLdouble *v)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -39098,7 +43483,7 @@ static void REGAL_CALL emu_glMultiTexCoord2fvARB(GLenum target, const GLfloat *v
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->Attr<2>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), v );
+        _context->iff->Attr<4>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), v );
         return;
       }
       #endif
@@ -39107,7 +43492,7 @@ static void REGAL_CALL emu_glMultiTexCoord2fvARB(GLenum target, const GLfloat *v
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexCoord2fvARB)(target, v);
+      _next->call(&_next->glMultiTexCoord4dvARB)(target, v);
       break;
     }
 
@@ -39115,7 +43500,7 @@ static void REGAL_CALL emu_glMultiTexCoord2fvARB(GLenum target, const GLfloat *v
 
 }
 
-static void REGAL_CALL emu_glMultiTexCoord2iARB(GLenum target, GLint s, GLint t)
+static void REGAL_CALL emu_glMultiTexCoord4fARB(GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -39160,7 +43545,7 @@ static void REGAL_CALL emu_glMultiTexCoord2iARB(GLenum target, GLint s, GLint t)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->Attr<2>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), s, t );
+        _context->iff->Attr<4>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), s, t, r, q );
         return;
       }
       #endif
@@ -39169,7 +43554,7 @@ static void REGAL_CALL emu_glMultiTexCoord2iARB(GLenum target, GLint s, GLint t)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexCoord2iARB)(target, s, t);
+      _next->call(&_next->glMultiTexCoord4fARB)(target, s, t, r, q);
       break;
     }
 
@@ -39177,7 +43562,7 @@ static void REGAL_CALL emu_glMultiTexCoord2iARB(GLenum target, GLint s, GLint t)
 
 }
 
-static void REGAL_CALL emu_glMultiTexCoord2ivARB(GLenum target, const GLint *v)
+static void REGAL_CALL emu_glMultiTexCoord4fvARB(GLenum target, const GLfloat *v)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -39222,7 +43607,7 @@ static void REGAL_CALL emu_glMultiTexCoord2ivARB(GLenum target, const GLint *v)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->Attr<2>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), v );
+        _context->iff->Attr<4>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), v );
         return;
       }
       #endif
@@ -39231,7 +43616,7 @@ static void REGAL_CALL emu_glMultiTexCoord2ivARB(GLenum target, const GLint *v)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexCoord2ivARB)(target, v);
+      _next->call(&_next->glMultiTexCoord4fvARB)(target, v);
       break;
     }
 
@@ -39239,7 +43624,7 @@ static void REGAL_CALL emu_glMultiTexCoord2ivARB(GLenum target, const GLint *v)
 
 }
 
-static void REGAL_CALL emu_glMultiTexCoord2sARB(GLenum target, GLshort s, GLshort t)
+static void REGAL_CALL emu_glMultiTexCoord4iARB(GLenum target, GLint s, GLint t, GLint r, GLint q)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -39284,7 +43669,7 @@ static void REGAL_CALL emu_glMultiTexCoord2sARB(GLenum target, GLshort s, GLshor
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->Attr<2>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), s, t );
+        _context->iff->Attr<4>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), s, t, r, q );
         return;
       }
       #endif
@@ -39293,7 +43678,7 @@ static void REGAL_CALL emu_glMultiTexCoord2sARB(GLenum target, GLshort s, GLshor
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexCoord2sARB)(target, s, t);
+      _next->call(&_next->glMultiTexCoord4iARB)(target, s, t, r, q);
       break;
     }
 
@@ -39301,7 +43686,7 @@ static void REGAL_CALL emu_glMultiTexCoord2sARB(GLenum target, GLshort s, GLshor
 
 }
 
-static void REGAL_CALL emu_glMultiTexCoord2svARB(GLenum target, const GLshort *v)
+static void REGAL_CALL emu_glMultiTexCoord4ivARB(GLenum target, const GLint *v)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -39346,7 +43731,7 @@ static void REGAL_CALL emu_glMultiTexCoord2svARB(GLenum target, const GLshort *v
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->Attr<2>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), v );
+        _context->iff->Attr<4>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), v );
         return;
       }
       #endif
@@ -39355,7 +43740,7 @@ static void REGAL_CALL emu_glMultiTexCoord2svARB(GLenum target, const GLshort *v
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexCoord2svARB)(target, v);
+      _next->call(&_next->glMultiTexCoord4ivARB)(target, v);
       break;
     }
 
@@ -39363,7 +43748,7 @@ static void REGAL_CALL emu_glMultiTexCoord2svARB(GLenum target, const GLshort *v
 
 }
 
-static void REGAL_CALL emu_glMultiTexCoord3dARB(GLenum target, GLdouble s, GLdouble t, GLdouble r)
+static void REGAL_CALL emu_glMultiTexCoord4sARB(GLenum target, GLshort s, GLshort t, GLshort r, GLshort q)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -39408,7 +43793,7 @@ static void REGAL_CALL emu_glMultiTexCoord3dARB(GLenum target, GLdouble s, GLdou
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->Attr<3>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), s, t, r );
+        _context->iff->Attr<4>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), s, t, r, q );
         return;
       }
       #endif
@@ -39417,7 +43802,7 @@ static void REGAL_CALL emu_glMultiTexCoord3dARB(GLenum target, GLdouble s, GLdou
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexCoord3dARB)(target, s, t, r);
+      _next->call(&_next->glMultiTexCoord4sARB)(target, s, t, r, q);
       break;
     }
 
@@ -39425,7 +43810,7 @@ static void REGAL_CALL emu_glMultiTexCoord3dARB(GLenum target, GLdouble s, GLdou
 
 }
 
-static void REGAL_CALL emu_glMultiTexCoord3dvARB(GLenum target, const GLdouble *v)
+static void REGAL_CALL emu_glMultiTexCoord4svARB(GLenum target, const GLshort *v)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -39470,7 +43855,7 @@ static void REGAL_CALL emu_glMultiTexCoord3dvARB(GLenum target, const GLdouble *
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->Attr<3>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), v );
+        _context->iff->Attr<4>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), v );
         return;
       }
       #endif
@@ -39479,7 +43864,7 @@ static void REGAL_CALL emu_glMultiTexCoord3dvARB(GLenum target, const GLdouble *
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexCoord3dvARB)(target, v);
+      _next->call(&_next->glMultiTexCoord4svARB)(target, v);
       break;
     }
 
@@ -39487,7 +43872,9 @@ static void REGAL_CALL emu_glMultiTexCoord3dvARB(GLenum target, const GLdouble *
 
 }
 
-static void REGAL_CALL emu_glMultiTexCoord3fARB(GLenum target, GLfloat s, GLfloat t, GLfloat r)
+// GL_ARB_occlusion_query
+
+static void REGAL_CALL emu_glBeginQueryARB(GLenum target, GLuint id)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -39495,27 +43882,6 @@ static void REGAL_CALL emu_glMultiTexCoord3fARB(GLenum target, GLfloat s, GLfloa
 
   // prefix
   switch( _context->emuLevel )
-  {
-    case 16 :
-    case 15 :
-    case 14 :
-    case 13 :
-    case 12 :
-    case 11 :
-    case 10 :
-    case 9 :
-    case 8 :
-    case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff) break;
-      #endif
-    case 1 :
-    default:
-      break;
-  }
-
-  // impl
-  switch( _context->emuLevel )
   {
     case 16 :
     case 15 :
@@ -39532,24 +43898,20 @@ static void REGAL_CALL emu_glMultiTexCoord3fARB(GLenum target, GLfloat s, GLfloa
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->Attr<3>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), s, t, r );
-        return;
+        _context->iff->FlushBatch( _context );
       }
       #endif
     case 1 :
     default:
-    {
-      DispatchTableGL *_next = _dispatch.next();
-      RegalAssert(_next);
-      _next->call(&_next->glMultiTexCoord3fARB)(target, s, t, r);
       break;
-    }
-
   }
 
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glBeginQueryARB)(target, id);
 }
 
-static void REGAL_CALL emu_glMultiTexCoord3fvARB(GLenum target, const GLfloat *v)
+static void REGAL_CALL emu_glEndQueryARB(GLenum target)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -39557,27 +43919,6 @@ static void REGAL_CALL emu_glMultiTexCoord3fvARB(GLenum target, const GLfloat *v
 
   // prefix
   switch( _context->emuLevel )
-  {
-    case 16 :
-    case 15 :
-    case 14 :
-    case 13 :
-    case 12 :
-    case 11 :
-    case 10 :
-    case 9 :
-    case 8 :
-    case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff) break;
-      #endif
-    case 1 :
-    default:
-      break;
-  }
-
-  // impl
-  switch( _context->emuLevel )
   {
     case 16 :
     case 15 :
@@ -39594,24 +43935,20 @@ static void REGAL_CALL emu_glMultiTexCoord3fvARB(GLenum target, const GLfloat *v
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->Attr<3>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), v );
-        return;
+        _context->iff->FlushBatch( _context );
       }
       #endif
     case 1 :
     default:
-    {
-      DispatchTableGL *_next = _dispatch.next();
-      RegalAssert(_next);
-      _next->call(&_next->glMultiTexCoord3fvARB)(target, v);
       break;
-    }
-
   }
 
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glEndQueryARB)(target);
 }
 
-static void REGAL_CALL emu_glMultiTexCoord3iARB(GLenum target, GLint s, GLint t, GLint r)
+static void REGAL_CALL emu_glGetQueryObjectivARB(GLuint id, GLenum pname, GLint *params)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -39631,14 +43968,42 @@ static void REGAL_CALL emu_glMultiTexCoord3iARB(GLenum target, GLint s, GLint t,
     case 8 :
     case 7 :
       #if REGAL_EMU_IFF
-      if (_context->iff) break;
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->QueryBufferWrite();
+      }
       #endif
     case 1 :
     default:
       break;
   }
 
-  // impl
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glGetQueryObjectivARB)(id, pname, params);
+}
+
+static void REGAL_CALL emu_glGetQueryObjectuivARB(GLuint id, GLenum pname, GLuint *params)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
   switch( _context->emuLevel )
   {
     case 16 :
@@ -39656,24 +44021,38 @@ static void REGAL_CALL emu_glMultiTexCoord3iARB(GLenum target, GLint s, GLint t,
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->Attr<3>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), s, t, r );
-        return;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->QueryBufferWrite();
       }
       #endif
     case 1 :
     default:
-    {
-      DispatchTableGL *_next = _dispatch.next();
-      RegalAssert(_next);
-      _next->call(&_next->glMultiTexCoord3iARB)(target, s, t, r);
       break;
-    }
-
   }
 
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glGetQueryObjectuivARB)(id, pname, params);
 }
 
-static void REGAL_CALL emu_glMultiTexCoord3ivARB(GLenum target, const GLint *v)
+// GL_ARB_point_parameters
+
+// GL_ARB_program_interface_query
+
+// GL_ARB_provoking_vertex
+
+static void REGAL_CALL emu_glProvokingVertex(GLenum mode)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -39685,6 +44064,14 @@ static void REGAL_CALL emu_glMultiTexCoord3ivARB(GLenum target, const GLint *v)
     case 16 :
     case 15 :
     case 14 :
+      #if REGAL_EMU_PPA
+      if (_context->ppa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 13;
+        _context->ppa->glProvokingVertex( mode );
+      }
+      #endif
     case 13 :
     case 12 :
     case 11 :
@@ -39692,15 +44079,34 @@ static void REGAL_CALL emu_glMultiTexCoord3ivARB(GLenum target, const GLint *v)
     case 9 :
     case 8 :
     case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff) break;
+    case 6 :
+      #if REGAL_EMU_QUADS
+      if (_context->quads)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 5;
+        _context->quads->glProvokingVertex( mode );
+      }
       #endif
     case 1 :
     default:
       break;
   }
 
-  // impl
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glProvokingVertex)(mode);
+}
+
+// GL_ARB_robustness
+
+static void REGAL_CALL emu_glGetnCompressedTexImageARB(GLenum target, GLint lod, GLsizei bufSize, GLvoid *img)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
   switch( _context->emuLevel )
   {
     case 16 :
@@ -39713,29 +44119,29 @@ static void REGAL_CALL emu_glMultiTexCoord3ivARB(GLenum target, const GLint *v)
     case 9 :
     case 8 :
     case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff)
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 6;
-        _context->iff->Attr<3>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), v );
-        return;
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
       }
       #endif
     case 1 :
     default:
-    {
-      DispatchTableGL *_next = _dispatch.next();
-      RegalAssert(_next);
-      _next->call(&_next->glMultiTexCoord3ivARB)(target, v);
       break;
-    }
-
   }
 
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glGetnCompressedTexImageARB)(target, lod, bufSize, img);
 }
 
-static void REGAL_CALL emu_glMultiTexCoord3sARB(GLenum target, GLshort s, GLshort t, GLshort r)
+static void REGAL_CALL emu_glGetnTexImageARB(GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, GLvoid *img)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -39754,15 +44160,35 @@ static void REGAL_CALL emu_glMultiTexCoord3sARB(GLenum target, GLshort s, GLshor
     case 9 :
     case 8 :
     case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff) break;
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
+      }
       #endif
     case 1 :
     default:
       break;
   }
 
-  // impl
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glGetnTexImageARB)(target, level, format, type, bufSize, img);
+}
+
+static void REGAL_CALL emu_glReadnPixelsARB(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, GLvoid *data)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
   switch( _context->emuLevel )
   {
     case 16 :
@@ -39775,29 +44201,33 @@ static void REGAL_CALL emu_glMultiTexCoord3sARB(GLenum target, GLshort s, GLshor
     case 9 :
     case 8 :
     case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff)
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 6;
-        _context->iff->Attr<3>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), s, t, r );
-        return;
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
       }
       #endif
     case 1 :
     default:
-    {
-      DispatchTableGL *_next = _dispatch.next();
-      RegalAssert(_next);
-      _next->call(&_next->glMultiTexCoord3sARB)(target, s, t, r);
       break;
-    }
-
   }
 
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glReadnPixelsARB)(x, y, width, height, format, type, bufSize, data);
 }
 
-static void REGAL_CALL emu_glMultiTexCoord3svARB(GLenum target, const GLshort *v)
+// GL_ARB_sample_shading
+
+// GL_ARB_sampler_objects
+
+static void REGAL_CALL emu_glBindSampler(GLuint unit, GLuint sampler)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -39817,7 +44247,17 @@ static void REGAL_CALL emu_glMultiTexCoord3svARB(GLenum target, const GLshort *v
     case 8 :
     case 7 :
       #if REGAL_EMU_IFF
-      if (_context->iff) break;
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 6 :
+    case 5 :
+      #if REGAL_EMU_SO
+      if (_context->so) break;
       #endif
     case 1 :
     default:
@@ -39837,12 +44277,14 @@ static void REGAL_CALL emu_glMultiTexCoord3svARB(GLenum target, const GLshort *v
     case 9 :
     case 8 :
     case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff)
+    case 6 :
+    case 5 :
+      #if REGAL_EMU_SO
+      if (_context->so)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 6;
-        _context->iff->Attr<3>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), v );
+        _context->emuLevel = 4;
+        _context->so->BindSampler( unit, sampler );
         return;
       }
       #endif
@@ -39851,7 +44293,7 @@ static void REGAL_CALL emu_glMultiTexCoord3svARB(GLenum target, const GLshort *v
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexCoord3svARB)(target, v);
+      _next->call(&_next->glBindSampler)(unit, sampler);
       break;
     }
 
@@ -39859,7 +44301,7 @@ static void REGAL_CALL emu_glMultiTexCoord3svARB(GLenum target, const GLshort *v
 
 }
 
-static void REGAL_CALL emu_glMultiTexCoord4dARB(GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q)
+static void REGAL_CALL emu_glDeleteSamplers(GLsizei count, const GLuint *samplers)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -39878,8 +44320,10 @@ static void REGAL_CALL emu_glMultiTexCoord4dARB(GLenum target, GLdouble s, GLdou
     case 9 :
     case 8 :
     case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff) break;
+    case 6 :
+    case 5 :
+      #if REGAL_EMU_SO
+      if (_context->so) break;
       #endif
     case 1 :
     default:
@@ -39899,12 +44343,14 @@ static void REGAL_CALL emu_glMultiTexCoord4dARB(GLenum target, GLdouble s, GLdou
     case 9 :
     case 8 :
     case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff)
+    case 6 :
+    case 5 :
+      #if REGAL_EMU_SO
+      if (_context->so)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 6;
-        _context->iff->Attr<4>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), s, t, r, q );
+        _context->emuLevel = 4;
+        _context->so->DeleteSamplers( count, samplers );
         return;
       }
       #endif
@@ -39913,7 +44359,7 @@ static void REGAL_CALL emu_glMultiTexCoord4dARB(GLenum target, GLdouble s, GLdou
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexCoord4dARB)(target, s, t, r, q);
+      _next->call(&_next->glDeleteSamplers)(count, samplers);
       break;
     }
 
@@ -39921,7 +44367,7 @@ static void REGAL_CALL emu_glMultiTexCoord4dARB(GLenum target, GLdouble s, GLdou
 
 }
 
-static void REGAL_CALL emu_glMultiTexCoord4dvARB(GLenum target, const GLdouble *v)
+static void REGAL_CALL emu_glGenSamplers(GLsizei count, GLuint *samplers)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -39940,10 +44386,18 @@ static void REGAL_CALL emu_glMultiTexCoord4dvARB(GLenum target, const GLdouble *
     case 9 :
     case 8 :
     case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff) break;
+    case 6 :
+    case 5 :
+      #if REGAL_EMU_SO
+      if (_context->so) break;
       #endif
+    case 4 :
+    case 3 :
+    case 2 :
     case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt) break;
+      #endif
     default:
       break;
   }
@@ -39961,21 +44415,41 @@ static void REGAL_CALL emu_glMultiTexCoord4dvARB(GLenum target, const GLdouble *
     case 9 :
     case 8 :
     case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff)
+    case 6 :
+    case 5 :
+      #if REGAL_EMU_SO
+      if (_context->so)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 6;
-        _context->iff->Attr<4>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), v );
+        _context->emuLevel = 4;
+        _context->so->GenSamplers( count, samplers );
         return;
       }
       #endif
+    case 4 :
+    case 3 :
+    case 2 :
     case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 0;
+        if (_context->isES2())
+        {
+          Warning("Regal does not support glGenSamplers for ES 2.0 - skipping.");
+          #if REGAL_BREAK
+          Break::Filter();
+          #endif
+          return ;
+        }
+      }
+      #endif
     default:
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexCoord4dvARB)(target, v);
+      _next->call(&_next->glGenSamplers)(count, samplers);
       break;
     }
 
@@ -39983,7 +44457,7 @@ static void REGAL_CALL emu_glMultiTexCoord4dvARB(GLenum target, const GLdouble *
 
 }
 
-static void REGAL_CALL emu_glMultiTexCoord4fARB(GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q)
+static void REGAL_CALL emu_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -40002,8 +44476,10 @@ static void REGAL_CALL emu_glMultiTexCoord4fARB(GLenum target, GLfloat s, GLfloa
     case 9 :
     case 8 :
     case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff) break;
+    case 6 :
+    case 5 :
+      #if REGAL_EMU_SO
+      if (_context->so) break;
       #endif
     case 1 :
     default:
@@ -40023,12 +44499,17 @@ static void REGAL_CALL emu_glMultiTexCoord4fARB(GLenum target, GLfloat s, GLfloa
     case 9 :
     case 8 :
     case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff)
+    case 6 :
+    case 5 :
+      #if REGAL_EMU_SO
+      if (_context->so)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 6;
-        _context->iff->Attr<4>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), s, t, r, q );
+        _context->emuLevel = 4;
+        RegalAssert(_context);
+        if ( !_context->so->GetSamplerParameterv( *_context, sampler, pname, params )) {
+           _context->dispatcher.emulation.glGetSamplerParameterIiv( sampler, pname, params );
+        }
         return;
       }
       #endif
@@ -40037,7 +44518,7 @@ static void REGAL_CALL emu_glMultiTexCoord4fARB(GLenum target, GLfloat s, GLfloa
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexCoord4fARB)(target, s, t, r, q);
+      _next->call(&_next->glGetSamplerParameterIiv)(sampler, pname, params);
       break;
     }
 
@@ -40045,7 +44526,7 @@ static void REGAL_CALL emu_glMultiTexCoord4fARB(GLenum target, GLfloat s, GLfloa
 
 }
 
-static void REGAL_CALL emu_glMultiTexCoord4fvARB(GLenum target, const GLfloat *v)
+static void REGAL_CALL emu_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -40064,8 +44545,10 @@ static void REGAL_CALL emu_glMultiTexCoord4fvARB(GLenum target, const GLfloat *v
     case 9 :
     case 8 :
     case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff) break;
+    case 6 :
+    case 5 :
+      #if REGAL_EMU_SO
+      if (_context->so) break;
       #endif
     case 1 :
     default:
@@ -40085,12 +44568,17 @@ static void REGAL_CALL emu_glMultiTexCoord4fvARB(GLenum target, const GLfloat *v
     case 9 :
     case 8 :
     case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff)
+    case 6 :
+    case 5 :
+      #if REGAL_EMU_SO
+      if (_context->so)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 6;
-        _context->iff->Attr<4>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), v );
+        _context->emuLevel = 4;
+        RegalAssert(_context);
+        if ( !_context->so->GetSamplerParameterv( *_context, sampler, pname, params )) {
+           _context->dispatcher.emulation.glGetSamplerParameterIuiv( sampler, pname, params );
+        }
         return;
       }
       #endif
@@ -40099,7 +44587,7 @@ static void REGAL_CALL emu_glMultiTexCoord4fvARB(GLenum target, const GLfloat *v
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexCoord4fvARB)(target, v);
+      _next->call(&_next->glGetSamplerParameterIuiv)(sampler, pname, params);
       break;
     }
 
@@ -40107,7 +44595,7 @@ static void REGAL_CALL emu_glMultiTexCoord4fvARB(GLenum target, const GLfloat *v
 
 }
 
-static void REGAL_CALL emu_glMultiTexCoord4iARB(GLenum target, GLint s, GLint t, GLint r, GLint q)
+static void REGAL_CALL emu_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -40126,8 +44614,10 @@ static void REGAL_CALL emu_glMultiTexCoord4iARB(GLenum target, GLint s, GLint t,
     case 9 :
     case 8 :
     case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff) break;
+    case 6 :
+    case 5 :
+      #if REGAL_EMU_SO
+      if (_context->so) break;
       #endif
     case 1 :
     default:
@@ -40147,12 +44637,17 @@ static void REGAL_CALL emu_glMultiTexCoord4iARB(GLenum target, GLint s, GLint t,
     case 9 :
     case 8 :
     case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff)
+    case 6 :
+    case 5 :
+      #if REGAL_EMU_SO
+      if (_context->so)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 6;
-        _context->iff->Attr<4>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), s, t, r, q );
+        _context->emuLevel = 4;
+        RegalAssert(_context);
+        if ( !_context->so->GetSamplerParameterv( *_context, sampler, pname, params )) {
+           _context->dispatcher.emulation.glGetSamplerParameterfv( sampler, pname, params );
+        }
         return;
       }
       #endif
@@ -40161,7 +44656,7 @@ static void REGAL_CALL emu_glMultiTexCoord4iARB(GLenum target, GLint s, GLint t,
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexCoord4iARB)(target, s, t, r, q);
+      _next->call(&_next->glGetSamplerParameterfv)(sampler, pname, params);
       break;
     }
 
@@ -40169,7 +44664,7 @@ static void REGAL_CALL emu_glMultiTexCoord4iARB(GLenum target, GLint s, GLint t,
 
 }
 
-static void REGAL_CALL emu_glMultiTexCoord4ivARB(GLenum target, const GLint *v)
+static void REGAL_CALL emu_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -40188,8 +44683,10 @@ static void REGAL_CALL emu_glMultiTexCoord4ivARB(GLenum target, const GLint *v)
     case 9 :
     case 8 :
     case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff) break;
+    case 6 :
+    case 5 :
+      #if REGAL_EMU_SO
+      if (_context->so) break;
       #endif
     case 1 :
     default:
@@ -40209,12 +44706,17 @@ static void REGAL_CALL emu_glMultiTexCoord4ivARB(GLenum target, const GLint *v)
     case 9 :
     case 8 :
     case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff)
+    case 6 :
+    case 5 :
+      #if REGAL_EMU_SO
+      if (_context->so)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 6;
-        _context->iff->Attr<4>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), v );
+        _context->emuLevel = 4;
+        RegalAssert(_context);
+        if ( !_context->so->GetSamplerParameterv( *_context, sampler, pname, params )) {
+           _context->dispatcher.emulation.glGetSamplerParameteriv( sampler, pname, params );
+        }
         return;
       }
       #endif
@@ -40223,7 +44725,7 @@ static void REGAL_CALL emu_glMultiTexCoord4ivARB(GLenum target, const GLint *v)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexCoord4ivARB)(target, v);
+      _next->call(&_next->glGetSamplerParameteriv)(sampler, pname, params);
       break;
     }
 
@@ -40231,7 +44733,7 @@ static void REGAL_CALL emu_glMultiTexCoord4ivARB(GLenum target, const GLint *v)
 
 }
 
-static void REGAL_CALL emu_glMultiTexCoord4sARB(GLenum target, GLshort s, GLshort t, GLshort r, GLshort q)
+static GLboolean REGAL_CALL emu_glIsSampler(GLuint sampler)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -40250,8 +44752,10 @@ static void REGAL_CALL emu_glMultiTexCoord4sARB(GLenum target, GLshort s, GLshor
     case 9 :
     case 8 :
     case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff) break;
+    case 6 :
+    case 5 :
+      #if REGAL_EMU_SO
+      if (_context->so) break;
       #endif
     case 1 :
     default:
@@ -40271,13 +44775,14 @@ static void REGAL_CALL emu_glMultiTexCoord4sARB(GLenum target, GLshort s, GLshor
     case 9 :
     case 8 :
     case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff)
+    case 6 :
+    case 5 :
+      #if REGAL_EMU_SO
+      if (_context->so)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 6;
-        _context->iff->Attr<4>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), s, t, r, q );
-        return;
+        _context->emuLevel = 4;
+        return _context->so->IsSampler( sampler );
       }
       #endif
     case 1 :
@@ -40285,15 +44790,14 @@ static void REGAL_CALL emu_glMultiTexCoord4sARB(GLenum target, GLshort s, GLshor
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexCoord4sARB)(target, s, t, r, q);
-      break;
+      return _next->call(&_next->glIsSampler)(sampler);
     }
 
   }
 
 }
 
-static void REGAL_CALL emu_glMultiTexCoord4svARB(GLenum target, const GLshort *v)
+static void REGAL_CALL emu_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *params)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -40313,7 +44817,17 @@ static void REGAL_CALL emu_glMultiTexCoord4svARB(GLenum target, const GLshort *v
     case 8 :
     case 7 :
       #if REGAL_EMU_IFF
-      if (_context->iff) break;
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 6 :
+    case 5 :
+      #if REGAL_EMU_SO
+      if (_context->so) break;
       #endif
     case 1 :
     default:
@@ -40333,12 +44847,17 @@ static void REGAL_CALL emu_glMultiTexCoord4svARB(GLenum target, const GLshort *v
     case 9 :
     case 8 :
     case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff)
+    case 6 :
+    case 5 :
+      #if REGAL_EMU_SO
+      if (_context->so)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 6;
-        _context->iff->Attr<4>( _context, _context->iff->AttrIndex( RFF2A_TexCoord, target - GL_TEXTURE0 ), v );
+        _context->emuLevel = 4;
+        RegalAssert(_context);
+        if ( !_context->so->SamplerParameterv( *_context, sampler, pname, params )) {
+           _context->dispatcher.emulation.glSamplerParameterIiv( sampler, pname, params );
+        }
         return;
       }
       #endif
@@ -40347,7 +44866,7 @@ static void REGAL_CALL emu_glMultiTexCoord4svARB(GLenum target, const GLshort *v
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexCoord4svARB)(target, v);
+      _next->call(&_next->glSamplerParameterIiv)(sampler, pname, params);
       break;
     }
 
@@ -40355,15 +44874,7 @@ static void REGAL_CALL emu_glMultiTexCoord4svARB(GLenum target, const GLshort *v
 
 }
 
-// GL_ARB_occlusion_query
-
-// GL_ARB_point_parameters
-
-// GL_ARB_program_interface_query
-
-// GL_ARB_provoking_vertex
-
-static void REGAL_CALL emu_glProvokingVertex(GLenum mode)
+static void REGAL_CALL emu_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *params)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -40375,14 +44886,6 @@ static void REGAL_CALL emu_glProvokingVertex(GLenum mode)
     case 16 :
     case 15 :
     case 14 :
-      #if REGAL_EMU_PPA
-      if (_context->ppa)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 13;
-        _context->ppa->glProvokingVertex( mode );
-      }
-      #endif
     case 13 :
     case 12 :
     case 11 :
@@ -40390,50 +44893,14 @@ static void REGAL_CALL emu_glProvokingVertex(GLenum mode)
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-      #if REGAL_EMU_QUADS
-      if (_context->quads)
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 5;
-        _context->quads->glProvokingVertex( mode );
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
       }
       #endif
-    case 1 :
-    default:
-      break;
-  }
-
-  DispatchTableGL *_next = _dispatch.next();
-  RegalAssert(_next);
-  _next->call(& _next->glProvokingVertex)(mode);
-}
-
-// GL_ARB_robustness
-
-// GL_ARB_sample_shading
-
-// GL_ARB_sampler_objects
-
-static void REGAL_CALL emu_glBindSampler(GLuint unit, GLuint sampler)
-{
-  RegalContext *_context = REGAL_GET_CONTEXT();
-  RegalAssert(_context);
-  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
-
-  // prefix
-  switch( _context->emuLevel )
-  {
-    case 16 :
-    case 15 :
-    case 14 :
-    case 13 :
-    case 12 :
-    case 11 :
-    case 10 :
-    case 9 :
-    case 8 :
-    case 7 :
     case 6 :
     case 5 :
       #if REGAL_EMU_SO
@@ -40464,7 +44931,10 @@ static void REGAL_CALL emu_glBindSampler(GLuint unit, GLuint sampler)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 4;
-        _context->so->BindSampler( unit, sampler );
+        RegalAssert(_context);
+        if ( !_context->so->SamplerParameterv( *_context, sampler, pname, params )) {
+           _context->dispatcher.emulation.glSamplerParameterIuiv( sampler, pname, params );
+        }
         return;
       }
       #endif
@@ -40473,7 +44943,7 @@ static void REGAL_CALL emu_glBindSampler(GLuint unit, GLuint sampler)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glBindSampler)(unit, sampler);
+      _next->call(&_next->glSamplerParameterIuiv)(sampler, pname, params);
       break;
     }
 
@@ -40481,7 +44951,7 @@ static void REGAL_CALL emu_glBindSampler(GLuint unit, GLuint sampler)
 
 }
 
-static void REGAL_CALL emu_glDeleteSamplers(GLsizei count, const GLuint *samplers)
+static void REGAL_CALL emu_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -40500,6 +44970,14 @@ static void REGAL_CALL emu_glDeleteSamplers(GLsizei count, const GLuint *sampler
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
       #if REGAL_EMU_SO
@@ -40530,7 +45008,10 @@ static void REGAL_CALL emu_glDeleteSamplers(GLsizei count, const GLuint *sampler
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 4;
-        _context->so->DeleteSamplers( count, samplers );
+        RegalAssert(_context);
+        if ( !_context->so->SamplerParameter( *_context, sampler, pname, param )) {
+           _context->dispatcher.emulation.glSamplerParameterf( sampler, pname, param );
+        }
         return;
       }
       #endif
@@ -40539,7 +45020,7 @@ static void REGAL_CALL emu_glDeleteSamplers(GLsizei count, const GLuint *sampler
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glDeleteSamplers)(count, samplers);
+      _next->call(&_next->glSamplerParameterf)(sampler, pname, param);
       break;
     }
 
@@ -40547,7 +45028,7 @@ static void REGAL_CALL emu_glDeleteSamplers(GLsizei count, const GLuint *sampler
 
 }
 
-static void REGAL_CALL emu_glGenSamplers(GLsizei count, GLuint *samplers)
+static void REGAL_CALL emu_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *params)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -40566,18 +45047,20 @@ static void REGAL_CALL emu_glGenSamplers(GLsizei count, GLuint *samplers)
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
       #if REGAL_EMU_SO
       if (_context->so) break;
       #endif
-    case 4 :
-    case 3 :
-    case 2 :
     case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt) break;
-      #endif
     default:
       break;
   }
@@ -40602,34 +45085,19 @@ static void REGAL_CALL emu_glGenSamplers(GLsizei count, GLuint *samplers)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 4;
-        _context->so->GenSamplers( count, samplers );
+        RegalAssert(_context);
+        if ( !_context->so->SamplerParameterv( *_context, sampler, pname, params )) {
+           _context->dispatcher.emulation.glSamplerParameterfv( sampler, pname, params );
+        }
         return;
       }
       #endif
-    case 4 :
-    case 3 :
-    case 2 :
     case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 0;
-        if (_context->isES2())
-        {
-          Warning("Regal does not support glGenSamplers for ES 2.0 - skipping.");
-          #if REGAL_BREAK
-          Break::Filter();
-          #endif
-          return ;
-        }
-      }
-      #endif
     default:
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glGenSamplers)(count, samplers);
+      _next->call(&_next->glSamplerParameterfv)(sampler, pname, params);
       break;
     }
 
@@ -40637,7 +45105,7 @@ static void REGAL_CALL emu_glGenSamplers(GLsizei count, GLuint *samplers)
 
 }
 
-static void REGAL_CALL emu_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params)
+static void REGAL_CALL emu_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -40656,6 +45124,14 @@ static void REGAL_CALL emu_glGetSamplerParameterIiv(GLuint sampler, GLenum pname
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
       #if REGAL_EMU_SO
@@ -40687,8 +45163,8 @@ static void REGAL_CALL emu_glGetSamplerParameterIiv(GLuint sampler, GLenum pname
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 4;
         RegalAssert(_context);
-        if ( !_context->so->GetSamplerParameterv( *_context, sampler, pname, params )) {
-           _context->dispatcher.emulation.glGetSamplerParameterIiv( sampler, pname, params );
+        if ( !_context->so->SamplerParameter( *_context, sampler, pname, param )) {
+           _context->dispatcher.emulation.glSamplerParameteri( sampler, pname, param );
         }
         return;
       }
@@ -40698,7 +45174,7 @@ static void REGAL_CALL emu_glGetSamplerParameterIiv(GLuint sampler, GLenum pname
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glGetSamplerParameterIiv)(sampler, pname, params);
+      _next->call(&_next->glSamplerParameteri)(sampler, pname, param);
       break;
     }
 
@@ -40706,7 +45182,7 @@ static void REGAL_CALL emu_glGetSamplerParameterIiv(GLuint sampler, GLenum pname
 
 }
 
-static void REGAL_CALL emu_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params)
+static void REGAL_CALL emu_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *params)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -40725,6 +45201,14 @@ static void REGAL_CALL emu_glGetSamplerParameterIuiv(GLuint sampler, GLenum pnam
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
       #if REGAL_EMU_SO
@@ -40756,8 +45240,8 @@ static void REGAL_CALL emu_glGetSamplerParameterIuiv(GLuint sampler, GLenum pnam
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 4;
         RegalAssert(_context);
-        if ( !_context->so->GetSamplerParameterv( *_context, sampler, pname, params )) {
-           _context->dispatcher.emulation.glGetSamplerParameterIuiv( sampler, pname, params );
+        if ( !_context->so->SamplerParameterv( *_context, sampler, pname, params )) {
+           _context->dispatcher.emulation.glSamplerParameteriv( sampler, pname, params );
         }
         return;
       }
@@ -40767,7 +45251,7 @@ static void REGAL_CALL emu_glGetSamplerParameterIuiv(GLuint sampler, GLenum pnam
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glGetSamplerParameterIuiv)(sampler, pname, params);
+      _next->call(&_next->glSamplerParameteriv)(sampler, pname, params);
       break;
     }
 
@@ -40775,7 +45259,9 @@ static void REGAL_CALL emu_glGetSamplerParameterIuiv(GLuint sampler, GLenum pnam
 
 }
 
-static void REGAL_CALL emu_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params)
+// GL_ARB_separate_shader_objects
+
+static void REGAL_CALL emu_glBindProgramPipeline(GLuint pipeline)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -40794,10 +45280,8 @@ static void REGAL_CALL emu_glGetSamplerParameterfv(GLuint sampler, GLenum pname,
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-      #if REGAL_EMU_SO
-      if (_context->so) break;
+      #if REGAL_EMU_IFF
+      if (_context->iff) break;
       #endif
     case 1 :
     default:
@@ -40817,16 +45301,14 @@ static void REGAL_CALL emu_glGetSamplerParameterfv(GLuint sampler, GLenum pname,
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-      #if REGAL_EMU_SO
-      if (_context->so)
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 4;
-        RegalAssert(_context);
-        if ( !_context->so->GetSamplerParameterv( *_context, sampler, pname, params )) {
-           _context->dispatcher.emulation.glGetSamplerParameterfv( sampler, pname, params );
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+        if( ! _context->iff->ShadowBindProgramPipeline( pipeline ) ) {
+            _context->dispatcher.emulation.glBindProgramPipeline( pipeline );
         }
         return;
       }
@@ -40836,7 +45318,7 @@ static void REGAL_CALL emu_glGetSamplerParameterfv(GLuint sampler, GLenum pname,
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glGetSamplerParameterfv)(sampler, pname, params);
+      _next->call(&_next->glBindProgramPipeline)(pipeline);
       break;
     }
 
@@ -40844,7 +45326,62 @@ static void REGAL_CALL emu_glGetSamplerParameterfv(GLuint sampler, GLenum pname,
 
 }
 
-static void REGAL_CALL emu_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params)
+// GL_ARB_shader_atomic_counters
+
+// GL_ARB_shader_image_load_store
+
+static void REGAL_CALL emu_glMemoryBarrier(GLbitfield barriers)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glMemoryBarrier)(barriers);
+}
+
+// GL_ARB_shader_objects
+
+static void REGAL_CALL emu_glAttachObjectARB(GLhandleARB containerObj, GLhandleARB obj)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -40865,10 +45402,13 @@ static void REGAL_CALL emu_glGetSamplerParameteriv(GLuint sampler, GLenum pname,
     case 7 :
     case 6 :
     case 5 :
-      #if REGAL_EMU_SO
-      if (_context->so) break;
-      #endif
+    case 4 :
+    case 3 :
+    case 2 :
     case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt) break;
+      #endif
     default:
       break;
   }
@@ -40888,24 +45428,29 @@ static void REGAL_CALL emu_glGetSamplerParameteriv(GLuint sampler, GLenum pname,
     case 7 :
     case 6 :
     case 5 :
-      #if REGAL_EMU_SO
-      if (_context->so)
+    case 4 :
+    case 3 :
+    case 2 :
+    case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 4;
-        RegalAssert(_context);
-        if ( !_context->so->GetSamplerParameterv( *_context, sampler, pname, params )) {
-           _context->dispatcher.emulation.glGetSamplerParameteriv( sampler, pname, params );
+        _context->emuLevel = 0;
+        if (_context->isES2() || !_context->info->gl_arb_shader_objects)
+        {
+          DispatchTableGL *_next = _context->dispatcher.emulation.next();
+          RegalAssert(_next);
+          _next->call(&_next->glAttachShader)(containerObj, obj);
+          return;
         }
-        return;
       }
       #endif
-    case 1 :
     default:
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glGetSamplerParameteriv)(sampler, pname, params);
+      _next->call(&_next->glAttachObjectARB)(containerObj, obj);
       break;
     }
 
@@ -40913,7 +45458,7 @@ static void REGAL_CALL emu_glGetSamplerParameteriv(GLuint sampler, GLenum pname,
 
 }
 
-static GLboolean REGAL_CALL emu_glIsSampler(GLuint sampler)
+static void REGAL_CALL emu_glCompileShaderARB(GLhandleARB shaderObj)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -40934,10 +45479,13 @@ static GLboolean REGAL_CALL emu_glIsSampler(GLuint sampler)
     case 7 :
     case 6 :
     case 5 :
-      #if REGAL_EMU_SO
-      if (_context->so) break;
-      #endif
+    case 4 :
+    case 3 :
+    case 2 :
     case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt) break;
+      #endif
     default:
       break;
   }
@@ -40957,27 +45505,37 @@ static GLboolean REGAL_CALL emu_glIsSampler(GLuint sampler)
     case 7 :
     case 6 :
     case 5 :
-      #if REGAL_EMU_SO
-      if (_context->so)
+    case 4 :
+    case 3 :
+    case 2 :
+    case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 4;
-        return _context->so->IsSampler( sampler );
+        _context->emuLevel = 0;
+        if (_context->isES2() || !_context->info->gl_arb_shader_objects)
+        {
+          DispatchTableGL *_next = _context->dispatcher.emulation.next();
+          RegalAssert(_next);
+          _next->call(&_next->glCompileShader)(shaderObj);
+          return;
+        }
       }
       #endif
-    case 1 :
     default:
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      return _next->call(&_next->glIsSampler)(sampler);
+      _next->call(&_next->glCompileShaderARB)(shaderObj);
+      break;
     }
 
   }
 
 }
 
-static void REGAL_CALL emu_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *params)
+static GLhandleARB REGAL_CALL emu_glCreateProgramObjectARB(void)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -40998,10 +45556,13 @@ static void REGAL_CALL emu_glSamplerParameterIiv(GLuint sampler, GLenum pname, c
     case 7 :
     case 6 :
     case 5 :
-      #if REGAL_EMU_SO
-      if (_context->so) break;
-      #endif
+    case 4 :
+    case 3 :
+    case 2 :
     case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt) break;
+      #endif
     default:
       break;
   }
@@ -41021,32 +45582,35 @@ static void REGAL_CALL emu_glSamplerParameterIiv(GLuint sampler, GLenum pname, c
     case 7 :
     case 6 :
     case 5 :
-      #if REGAL_EMU_SO
-      if (_context->so)
+    case 4 :
+    case 3 :
+    case 2 :
+    case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 4;
-        RegalAssert(_context);
-        if ( !_context->so->SamplerParameterv( *_context, sampler, pname, params )) {
-           _context->dispatcher.emulation.glSamplerParameterIiv( sampler, pname, params );
+        _context->emuLevel = 0;
+        if (_context->isES2() || !_context->info->gl_arb_shader_objects)
+        {
+          DispatchTableGL *_next = _context->dispatcher.emulation.next();
+          RegalAssert(_next);
+          return _next->call(&_next->glCreateProgram)();
         }
-        return;
       }
       #endif
-    case 1 :
     default:
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glSamplerParameterIiv)(sampler, pname, params);
-      break;
+      return _next->call(&_next->glCreateProgramObjectARB)();
     }
 
   }
 
 }
 
-static void REGAL_CALL emu_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *params)
+static GLhandleARB REGAL_CALL emu_glCreateShaderObjectARB(GLenum shaderType)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -41065,10 +45629,8 @@ static void REGAL_CALL emu_glSamplerParameterIuiv(GLuint sampler, GLenum pname,
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-      #if REGAL_EMU_SO
-      if (_context->so) break;
+      #if REGAL_EMU_IFF
+      if (_context->iff) break;
       #endif
     case 1 :
     default:
@@ -41088,18 +45650,12 @@ static void REGAL_CALL emu_glSamplerParameterIuiv(GLuint sampler, GLenum pname,
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-      #if REGAL_EMU_SO
-      if (_context->so)
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 4;
-        RegalAssert(_context);
-        if ( !_context->so->SamplerParameterv( *_context, sampler, pname, params )) {
-           _context->dispatcher.emulation.glSamplerParameterIuiv( sampler, pname, params );
-        }
-        return;
+        _context->emuLevel = 6;
+        return _context->iff->CreateShader( _context, shaderType );
       }
       #endif
     case 1 :
@@ -41107,15 +45663,14 @@ static void REGAL_CALL emu_glSamplerParameterIuiv(GLuint sampler, GLenum pname,
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glSamplerParameterIuiv)(sampler, pname, params);
-      break;
+      return _next->call(&_next->glCreateShaderObjectARB)(shaderType);
     }
 
   }
 
 }
 
-static void REGAL_CALL emu_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param)
+static void REGAL_CALL emu_glGetInfoLogARB(GLhandleARB obj, GLsizei maxLength, GLsizei *length, GLcharARB *infoLog)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -41136,10 +45691,13 @@ static void REGAL_CALL emu_glSamplerParameterf(GLuint sampler, GLenum pname, GLf
     case 7 :
     case 6 :
     case 5 :
-      #if REGAL_EMU_SO
-      if (_context->so) break;
-      #endif
+    case 4 :
+    case 3 :
+    case 2 :
     case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt) break;
+      #endif
     default:
       break;
   }
@@ -41159,24 +45717,32 @@ static void REGAL_CALL emu_glSamplerParameterf(GLuint sampler, GLenum pname, GLf
     case 7 :
     case 6 :
     case 5 :
-      #if REGAL_EMU_SO
-      if (_context->so)
+    case 4 :
+    case 3 :
+    case 2 :
+    case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 4;
-        RegalAssert(_context);
-        if ( !_context->so->SamplerParameter( *_context, sampler, pname, param )) {
-           _context->dispatcher.emulation.glSamplerParameterf( sampler, pname, param );
+        _context->emuLevel = 0;
+        if (_context->isES2() || !_context->info->gl_arb_shader_objects)
+        {
+          DispatchTableGL *_next = _context->dispatcher.emulation.next();
+          RegalAssert(_next);
+          if (_next->call(&_next->glIsProgram)(obj))
+            _next->call(&_next->glGetProgramInfoLog)(obj, maxLength, length, infoLog);
+          else
+            _next->call(&_next->glGetShaderInfoLog)(obj, maxLength, length, infoLog);
+          return;
         }
-        return;
       }
       #endif
-    case 1 :
     default:
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glSamplerParameterf)(sampler, pname, param);
+      _next->call(&_next->glGetInfoLogARB)(obj, maxLength, length, infoLog);
       break;
     }
 
@@ -41184,7 +45750,7 @@ static void REGAL_CALL emu_glSamplerParameterf(GLuint sampler, GLenum pname, GLf
 
 }
 
-static void REGAL_CALL emu_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *params)
+static void REGAL_CALL emu_glGetObjectParameterivARB(GLhandleARB obj, GLenum pname, GLint *params)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -41205,10 +45771,13 @@ static void REGAL_CALL emu_glSamplerParameterfv(GLuint sampler, GLenum pname, co
     case 7 :
     case 6 :
     case 5 :
-      #if REGAL_EMU_SO
-      if (_context->so) break;
-      #endif
+    case 4 :
+    case 3 :
+    case 2 :
     case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt) break;
+      #endif
     default:
       break;
   }
@@ -41228,24 +45797,32 @@ static void REGAL_CALL emu_glSamplerParameterfv(GLuint sampler, GLenum pname, co
     case 7 :
     case 6 :
     case 5 :
-      #if REGAL_EMU_SO
-      if (_context->so)
+    case 4 :
+    case 3 :
+    case 2 :
+    case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 4;
-        RegalAssert(_context);
-        if ( !_context->so->SamplerParameterv( *_context, sampler, pname, params )) {
-           _context->dispatcher.emulation.glSamplerParameterfv( sampler, pname, params );
+        _context->emuLevel = 0;
+        if (_context->isES2() || !_context->info->gl_arb_shader_objects)
+        {
+          DispatchTableGL *_next = _context->dispatcher.emulation.next();
+          RegalAssert(_next);
+          if (_next->call(&_next->glIsProgram)(obj))
+            _next->call(&_next->glGetProgramiv)(obj, pname, params);
+          else
+            _next->call(&_next->glGetShaderiv)(obj, pname, params);
+          return;
         }
-        return;
       }
       #endif
-    case 1 :
     default:
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glSamplerParameterfv)(sampler, pname, params);
+      _next->call(&_next->glGetObjectParameterivARB)(obj, pname, params);
       break;
     }
 
@@ -41253,7 +45830,7 @@ static void REGAL_CALL emu_glSamplerParameterfv(GLuint sampler, GLenum pname, co
 
 }
 
-static void REGAL_CALL emu_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param)
+static GLint REGAL_CALL emu_glGetUniformLocationARB(GLhandleARB programObj, const GLcharARB *name)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -41274,10 +45851,13 @@ static void REGAL_CALL emu_glSamplerParameteri(GLuint sampler, GLenum pname, GLi
     case 7 :
     case 6 :
     case 5 :
-      #if REGAL_EMU_SO
-      if (_context->so) break;
-      #endif
+    case 4 :
+    case 3 :
+    case 2 :
     case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt) break;
+      #endif
     default:
       break;
   }
@@ -41297,32 +45877,35 @@ static void REGAL_CALL emu_glSamplerParameteri(GLuint sampler, GLenum pname, GLi
     case 7 :
     case 6 :
     case 5 :
-      #if REGAL_EMU_SO
-      if (_context->so)
+    case 4 :
+    case 3 :
+    case 2 :
+    case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 4;
-        RegalAssert(_context);
-        if ( !_context->so->SamplerParameter( *_context, sampler, pname, param )) {
-           _context->dispatcher.emulation.glSamplerParameteri( sampler, pname, param );
+        _context->emuLevel = 0;
+        if (_context->isES2() || !_context->info->gl_arb_shader_objects)
+        {
+          DispatchTableGL *_next = _context->dispatcher.emulation.next();
+          RegalAssert(_next);
+          return _next->call(&_next->glGetUniformLocation)(programObj, name);
         }
-        return;
       }
       #endif
-    case 1 :
     default:
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glSamplerParameteri)(sampler, pname, param);
-      break;
+      return _next->call(&_next->glGetUniformLocationARB)(programObj, name);
     }
 
   }
 
 }
 
-static void REGAL_CALL emu_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *params)
+static void REGAL_CALL emu_glLinkProgramARB(GLhandleARB programObj)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -41341,10 +45924,8 @@ static void REGAL_CALL emu_glSamplerParameteriv(GLuint sampler, GLenum pname, co
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-      #if REGAL_EMU_SO
-      if (_context->so) break;
+      #if REGAL_EMU_IFF
+      if (_context->iff) break;
       #endif
     case 1 :
     default:
@@ -41364,17 +45945,13 @@ static void REGAL_CALL emu_glSamplerParameteriv(GLuint sampler, GLenum pname, co
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-      #if REGAL_EMU_SO
-      if (_context->so)
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 4;
-        RegalAssert(_context);
-        if ( !_context->so->SamplerParameterv( *_context, sampler, pname, params )) {
-           _context->dispatcher.emulation.glSamplerParameteriv( sampler, pname, params );
-        }
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+        _context->iff->LinkProgram( _context, programObj );
         return;
       }
       #endif
@@ -41383,7 +45960,7 @@ static void REGAL_CALL emu_glSamplerParameteriv(GLuint sampler, GLenum pname, co
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glSamplerParameteriv)(sampler, pname, params);
+      _next->call(&_next->glLinkProgramARB)(programObj);
       break;
     }
 
@@ -41391,9 +45968,7 @@ static void REGAL_CALL emu_glSamplerParameteriv(GLuint sampler, GLenum pname, co
 
 }
 
-// GL_ARB_separate_shader_objects
-
-static void REGAL_CALL emu_glBindProgramPipeline(GLuint pipeline)
+static void REGAL_CALL emu_glShaderSourceARB(GLhandleARB shaderObj, GLsizei count, const GLcharARB ** const string, const GLint *length)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -41438,9 +46013,8 @@ static void REGAL_CALL emu_glBindProgramPipeline(GLuint pipeline)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        if( ! _context->iff->ShadowBindProgramPipeline( pipeline ) ) {
-            _context->dispatcher.emulation.glBindProgramPipeline( pipeline );
-        }
+        _context->iff->FlushBatch( _context );
+        _context->iff->ShaderSource( _context, shaderObj, count, string, length );
         return;
       }
       #endif
@@ -41449,7 +46023,7 @@ static void REGAL_CALL emu_glBindProgramPipeline(GLuint pipeline)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glBindProgramPipeline)(pipeline);
+      _next->call(&_next->glShaderSourceARB)(shaderObj, count, string, length);
       break;
     }
 
@@ -41457,13 +46031,7 @@ static void REGAL_CALL emu_glBindProgramPipeline(GLuint pipeline)
 
 }
 
-// GL_ARB_shader_atomic_counters
-
-// GL_ARB_shader_image_load_store
-
-// GL_ARB_shader_objects
-
-static void REGAL_CALL emu_glAttachObjectARB(GLhandleARB containerObj, GLhandleARB obj)
+static void REGAL_CALL emu_glUniform1fARB(GLint location, GLfloat v0)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -41482,15 +46050,10 @@ static void REGAL_CALL emu_glAttachObjectARB(GLhandleARB containerObj, GLhandleA
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-    case 3 :
-    case 2 :
-    case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt) break;
+      #if REGAL_EMU_IFF
+      if (_context->iff) break;
       #endif
+    case 1 :
     default:
       break;
   }
@@ -41508,31 +46071,26 @@ static void REGAL_CALL emu_glAttachObjectARB(GLhandleARB containerObj, GLhandleA
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-    case 3 :
-    case 2 :
-    case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt)
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 0;
-        if (_context->isES2() || !_context->info->gl_arb_shader_objects)
-        {
-          DispatchTableGL *_next = _context->dispatcher.emulation.next();
-          RegalAssert(_next);
-          _next->call(&_next->glAttachShader)(containerObj, obj);
-          return;
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+        if( _context->iff->currinst ) {
+          _context->iff->Uniform( _context, 1, location, 1, v0 );
+        } else {
+          _context->dispatcher.emulation.glUniform1fARB( location, v0 );
         }
+        return;
       }
       #endif
+    case 1 :
     default:
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glAttachObjectARB)(containerObj, obj);
+      _next->call(&_next->glUniform1fARB)(location, v0);
       break;
     }
 
@@ -41540,7 +46098,7 @@ static void REGAL_CALL emu_glAttachObjectARB(GLhandleARB containerObj, GLhandleA
 
 }
 
-static void REGAL_CALL emu_glCompileShaderARB(GLhandleARB shaderObj)
+static void REGAL_CALL emu_glUniform1fvARB(GLint location, GLsizei count, const GLfloat *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -41559,15 +46117,10 @@ static void REGAL_CALL emu_glCompileShaderARB(GLhandleARB shaderObj)
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-    case 3 :
-    case 2 :
-    case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt) break;
+      #if REGAL_EMU_IFF
+      if (_context->iff) break;
       #endif
+    case 1 :
     default:
       break;
   }
@@ -41585,31 +46138,26 @@ static void REGAL_CALL emu_glCompileShaderARB(GLhandleARB shaderObj)
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-    case 3 :
-    case 2 :
-    case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt)
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 0;
-        if (_context->isES2() || !_context->info->gl_arb_shader_objects)
-        {
-          DispatchTableGL *_next = _context->dispatcher.emulation.next();
-          RegalAssert(_next);
-          _next->call(&_next->glCompileShader)(shaderObj);
-          return;
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+        if( _context->iff->currinst ) {
+          _context->iff->Uniform( _context, 1, location, count, value );
+        } else {
+          _context->dispatcher.emulation.glUniform1fvARB( location, count, value );
         }
+        return;
       }
       #endif
+    case 1 :
     default:
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glCompileShaderARB)(shaderObj);
+      _next->call(&_next->glUniform1fvARB)(location, count, value);
       break;
     }
 
@@ -41617,7 +46165,7 @@ static void REGAL_CALL emu_glCompileShaderARB(GLhandleARB shaderObj)
 
 }
 
-static GLhandleARB REGAL_CALL emu_glCreateProgramObjectARB(void)
+static void REGAL_CALL emu_glUniform1iARB(GLint location, GLint v0)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -41636,6 +46184,9 @@ static GLhandleARB REGAL_CALL emu_glCreateProgramObjectARB(void)
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff) break;
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -41662,6 +46213,20 @@ static GLhandleARB REGAL_CALL emu_glCreateProgramObjectARB(void)
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+        if( _context->iff->currinst ) {
+          _context->iff->Uniform( _context, 1, location, 1, v0 );
+        } else {
+          _context->dispatcher.emulation.glUniform1iARB( location, v0 );
+        }
+        return;
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -41677,7 +46242,8 @@ static GLhandleARB REGAL_CALL emu_glCreateProgramObjectARB(void)
         {
           DispatchTableGL *_next = _context->dispatcher.emulation.next();
           RegalAssert(_next);
-          return _next->call(&_next->glCreateProgram)();
+          _next->call(&_next->glUniform1i)(location, v0);
+          return;
         }
       }
       #endif
@@ -41685,14 +46251,15 @@ static GLhandleARB REGAL_CALL emu_glCreateProgramObjectARB(void)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      return _next->call(&_next->glCreateProgramObjectARB)();
+      _next->call(&_next->glUniform1iARB)(location, v0);
+      break;
     }
 
   }
 
 }
 
-static GLhandleARB REGAL_CALL emu_glCreateShaderObjectARB(GLenum shaderType)
+static void REGAL_CALL emu_glUniform1ivARB(GLint location, GLsizei count, const GLint *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -41737,7 +46304,13 @@ static GLhandleARB REGAL_CALL emu_glCreateShaderObjectARB(GLenum shaderType)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        return _context->iff->CreateShader( _context, shaderType );
+        _context->iff->FlushBatch( _context );
+        if( _context->iff->currinst ) {
+          _context->iff->Uniform( _context, 1, location, count, value );
+        } else {
+          _context->dispatcher.emulation.glUniform1ivARB( location, count, value );
+        }
+        return;
       }
       #endif
     case 1 :
@@ -41745,14 +46318,15 @@ static GLhandleARB REGAL_CALL emu_glCreateShaderObjectARB(GLenum shaderType)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      return _next->call(&_next->glCreateShaderObjectARB)(shaderType);
+      _next->call(&_next->glUniform1ivARB)(location, count, value);
+      break;
     }
 
   }
 
 }
 
-static void REGAL_CALL emu_glGetInfoLogARB(GLhandleARB obj, GLsizei maxLength, GLsizei *length, GLcharARB *infoLog)
+static void REGAL_CALL emu_glUniform2fARB(GLint location, GLfloat v0, GLfloat v1)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -41771,15 +46345,10 @@ static void REGAL_CALL emu_glGetInfoLogARB(GLhandleARB obj, GLsizei maxLength, G
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-    case 3 :
-    case 2 :
-    case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt) break;
+      #if REGAL_EMU_IFF
+      if (_context->iff) break;
       #endif
+    case 1 :
     default:
       break;
   }
@@ -41797,34 +46366,26 @@ static void REGAL_CALL emu_glGetInfoLogARB(GLhandleARB obj, GLsizei maxLength, G
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-    case 3 :
-    case 2 :
-    case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt)
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 0;
-        if (_context->isES2() || !_context->info->gl_arb_shader_objects)
-        {
-          DispatchTableGL *_next = _context->dispatcher.emulation.next();
-          RegalAssert(_next);
-          if (_next->call(&_next->glIsProgram)(obj))
-            _next->call(&_next->glGetProgramInfoLog)(obj, maxLength, length, infoLog);
-          else
-            _next->call(&_next->glGetShaderInfoLog)(obj, maxLength, length, infoLog);
-          return;
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+        if( _context->iff->currinst ) {
+          _context->iff->Uniform( _context, 2, location, 1, v0, v1 );
+        } else {
+          _context->dispatcher.emulation.glUniform2fARB( location, v0, v1 );
         }
+        return;
       }
       #endif
+    case 1 :
     default:
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glGetInfoLogARB)(obj, maxLength, length, infoLog);
+      _next->call(&_next->glUniform2fARB)(location, v0, v1);
       break;
     }
 
@@ -41832,7 +46393,7 @@ static void REGAL_CALL emu_glGetInfoLogARB(GLhandleARB obj, GLsizei maxLength, G
 
 }
 
-static void REGAL_CALL emu_glGetObjectParameterivARB(GLhandleARB obj, GLenum pname, GLint *params)
+static void REGAL_CALL emu_glUniform2fvARB(GLint location, GLsizei count, const GLfloat *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -41851,15 +46412,10 @@ static void REGAL_CALL emu_glGetObjectParameterivARB(GLhandleARB obj, GLenum pna
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-    case 3 :
-    case 2 :
-    case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt) break;
+      #if REGAL_EMU_IFF
+      if (_context->iff) break;
       #endif
+    case 1 :
     default:
       break;
   }
@@ -41877,34 +46433,26 @@ static void REGAL_CALL emu_glGetObjectParameterivARB(GLhandleARB obj, GLenum pna
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-    case 3 :
-    case 2 :
-    case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt)
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 0;
-        if (_context->isES2() || !_context->info->gl_arb_shader_objects)
-        {
-          DispatchTableGL *_next = _context->dispatcher.emulation.next();
-          RegalAssert(_next);
-          if (_next->call(&_next->glIsProgram)(obj))
-            _next->call(&_next->glGetProgramiv)(obj, pname, params);
-          else
-            _next->call(&_next->glGetShaderiv)(obj, pname, params);
-          return;
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+        if( _context->iff->currinst ) {
+          _context->iff->Uniform( _context, 2, location, count, value );
+        } else {
+          _context->dispatcher.emulation.glUniform2fvARB( location, count, value );
         }
+        return;
       }
       #endif
+    case 1 :
     default:
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glGetObjectParameterivARB)(obj, pname, params);
+      _next->call(&_next->glUniform2fvARB)(location, count, value);
       break;
     }
 
@@ -41912,7 +46460,7 @@ static void REGAL_CALL emu_glGetObjectParameterivARB(GLhandleARB obj, GLenum pna
 
 }
 
-static GLint REGAL_CALL emu_glGetUniformLocationARB(GLhandleARB programObj, const GLcharARB *name)
+static void REGAL_CALL emu_glUniform2iARB(GLint location, GLint v0, GLint v1)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -41931,15 +46479,10 @@ static GLint REGAL_CALL emu_glGetUniformLocationARB(GLhandleARB programObj, cons
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-    case 3 :
-    case 2 :
-    case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt) break;
+      #if REGAL_EMU_IFF
+      if (_context->iff) break;
       #endif
+    case 1 :
     default:
       break;
   }
@@ -41957,37 +46500,34 @@ static GLint REGAL_CALL emu_glGetUniformLocationARB(GLhandleARB programObj, cons
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-    case 3 :
-    case 2 :
-    case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt)
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 0;
-        if (_context->isES2() || !_context->info->gl_arb_shader_objects)
-        {
-          DispatchTableGL *_next = _context->dispatcher.emulation.next();
-          RegalAssert(_next);
-          return _next->call(&_next->glGetUniformLocation)(programObj, name);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+        if( _context->iff->currinst ) {
+          _context->iff->Uniform( _context, 2, location, 1, v0, v1 );
+        } else {
+          _context->dispatcher.emulation.glUniform2iARB( location, v0, v1 );
         }
+        return;
       }
       #endif
+    case 1 :
     default:
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      return _next->call(&_next->glGetUniformLocationARB)(programObj, name);
+      _next->call(&_next->glUniform2iARB)(location, v0, v1);
+      break;
     }
 
   }
 
 }
 
-static void REGAL_CALL emu_glLinkProgramARB(GLhandleARB programObj)
+static void REGAL_CALL emu_glUniform2ivARB(GLint location, GLsizei count, const GLint *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -42032,7 +46572,12 @@ static void REGAL_CALL emu_glLinkProgramARB(GLhandleARB programObj)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->LinkProgram( _context, programObj );
+        _context->iff->FlushBatch( _context );
+        if( _context->iff->currinst ) {
+          _context->iff->Uniform( _context, 2, location, count, value );
+        } else {
+          _context->dispatcher.emulation.glUniform2ivARB( location, count, value );
+        }
         return;
       }
       #endif
@@ -42041,7 +46586,7 @@ static void REGAL_CALL emu_glLinkProgramARB(GLhandleARB programObj)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glLinkProgramARB)(programObj);
+      _next->call(&_next->glUniform2ivARB)(location, count, value);
       break;
     }
 
@@ -42049,7 +46594,7 @@ static void REGAL_CALL emu_glLinkProgramARB(GLhandleARB programObj)
 
 }
 
-static void REGAL_CALL emu_glShaderSourceARB(GLhandleARB shaderObj, GLsizei count, const GLcharARB ** const string, const GLint *length)
+static void REGAL_CALL emu_glUniform3fARB(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -42094,7 +46639,12 @@ static void REGAL_CALL emu_glShaderSourceARB(GLhandleARB shaderObj, GLsizei coun
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->ShaderSource( _context, shaderObj, count, string, length );
+        _context->iff->FlushBatch( _context );
+        if( _context->iff->currinst ) {
+          _context->iff->Uniform( _context, 3, location, 1, v0, v1, v2 );
+        } else {
+          _context->dispatcher.emulation.glUniform3fARB( location, v0, v1, v2 );
+        }
         return;
       }
       #endif
@@ -42103,7 +46653,7 @@ static void REGAL_CALL emu_glShaderSourceARB(GLhandleARB shaderObj, GLsizei coun
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glShaderSourceARB)(shaderObj, count, string, length);
+      _next->call(&_next->glUniform3fARB)(location, v0, v1, v2);
       break;
     }
 
@@ -42111,7 +46661,7 @@ static void REGAL_CALL emu_glShaderSourceARB(GLhandleARB shaderObj, GLsizei coun
 
 }
 
-static void REGAL_CALL emu_glUniform1fARB(GLint location, GLfloat v0)
+static void REGAL_CALL emu_glUniform3fvARB(GLint location, GLsizei count, const GLfloat *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -42156,10 +46706,11 @@ static void REGAL_CALL emu_glUniform1fARB(GLint location, GLfloat v0)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( _context->iff->currinst ) {
-          _context->iff->Uniform( _context, 1, location, 1, v0 );
+          _context->iff->Uniform( _context, 3, location, count, value );
         } else {
-          _context->dispatcher.emulation.glUniform1fARB( location, v0 );
+          _context->dispatcher.emulation.glUniform3fvARB( location, count, value );
         }
         return;
       }
@@ -42169,7 +46720,7 @@ static void REGAL_CALL emu_glUniform1fARB(GLint location, GLfloat v0)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glUniform1fARB)(location, v0);
+      _next->call(&_next->glUniform3fvARB)(location, count, value);
       break;
     }
 
@@ -42177,7 +46728,7 @@ static void REGAL_CALL emu_glUniform1fARB(GLint location, GLfloat v0)
 
 }
 
-static void REGAL_CALL emu_glUniform1fvARB(GLint location, GLsizei count, const GLfloat *value)
+static void REGAL_CALL emu_glUniform3iARB(GLint location, GLint v0, GLint v1, GLint v2)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -42222,10 +46773,11 @@ static void REGAL_CALL emu_glUniform1fvARB(GLint location, GLsizei count, const
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( _context->iff->currinst ) {
-          _context->iff->Uniform( _context, 1, location, count, value );
+          _context->iff->Uniform( _context, 3, location, 1, v0, v1, v2 );
         } else {
-          _context->dispatcher.emulation.glUniform1fvARB( location, count, value );
+          _context->dispatcher.emulation.glUniform3iARB( location, v0, v1, v2 );
         }
         return;
       }
@@ -42235,7 +46787,7 @@ static void REGAL_CALL emu_glUniform1fvARB(GLint location, GLsizei count, const
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glUniform1fvARB)(location, count, value);
+      _next->call(&_next->glUniform3iARB)(location, v0, v1, v2);
       break;
     }
 
@@ -42243,7 +46795,7 @@ static void REGAL_CALL emu_glUniform1fvARB(GLint location, GLsizei count, const
 
 }
 
-static void REGAL_CALL emu_glUniform1iARB(GLint location, GLint v0)
+static void REGAL_CALL emu_glUniform3ivARB(GLint location, GLsizei count, const GLint *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -42265,15 +46817,7 @@ static void REGAL_CALL emu_glUniform1iARB(GLint location, GLint v0)
       #if REGAL_EMU_IFF
       if (_context->iff) break;
       #endif
-    case 6 :
-    case 5 :
-    case 4 :
-    case 3 :
-    case 2 :
     case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt) break;
-      #endif
     default:
       break;
   }
@@ -42296,39 +46840,88 @@ static void REGAL_CALL emu_glUniform1iARB(GLint location, GLint v0)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( _context->iff->currinst ) {
-          _context->iff->Uniform( _context, 1, location, 1, v0 );
+          _context->iff->Uniform( _context, 3, location, count, value );
         } else {
-          _context->dispatcher.emulation.glUniform1iARB( location, v0 );
+          _context->dispatcher.emulation.glUniform3ivARB( location, count, value );
         }
         return;
       }
       #endif
-    case 6 :
-    case 5 :
-    case 4 :
-    case 3 :
-    case 2 :
     case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt)
+    default:
+    {
+      DispatchTableGL *_next = _dispatch.next();
+      RegalAssert(_next);
+      _next->call(&_next->glUniform3ivARB)(location, count, value);
+      break;
+    }
+
+  }
+
+}
+
+static void REGAL_CALL emu_glUniform4fARB(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff) break;
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  // impl
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 0;
-        if (_context->isES2() || !_context->info->gl_arb_shader_objects)
-        {
-          DispatchTableGL *_next = _context->dispatcher.emulation.next();
-          RegalAssert(_next);
-          _next->call(&_next->glUniform1i)(location, v0);
-          return;
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+        if( _context->iff->currinst ) {
+          _context->iff->Uniform( _context, 4, location, 1, v0, v1, v2, v3 );
+        } else {
+          _context->dispatcher.emulation.glUniform4fARB( location, v0, v1, v2, v3 );
         }
+        return;
       }
       #endif
+    case 1 :
     default:
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glUniform1iARB)(location, v0);
+      _next->call(&_next->glUniform4fARB)(location, v0, v1, v2, v3);
       break;
     }
 
@@ -42336,7 +46929,7 @@ static void REGAL_CALL emu_glUniform1iARB(GLint location, GLint v0)
 
 }
 
-static void REGAL_CALL emu_glUniform1ivARB(GLint location, GLsizei count, const GLint *value)
+static void REGAL_CALL emu_glUniform4fvARB(GLint location, GLsizei count, const GLfloat *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -42381,10 +46974,11 @@ static void REGAL_CALL emu_glUniform1ivARB(GLint location, GLsizei count, const
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( _context->iff->currinst ) {
-          _context->iff->Uniform( _context, 1, location, count, value );
+          _context->iff->Uniform( _context, 4, location, count, value );
         } else {
-          _context->dispatcher.emulation.glUniform1ivARB( location, count, value );
+          _context->dispatcher.emulation.glUniform4fvARB( location, count, value );
         }
         return;
       }
@@ -42394,7 +46988,7 @@ static void REGAL_CALL emu_glUniform1ivARB(GLint location, GLsizei count, const
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glUniform1ivARB)(location, count, value);
+      _next->call(&_next->glUniform4fvARB)(location, count, value);
       break;
     }
 
@@ -42402,7 +46996,7 @@ static void REGAL_CALL emu_glUniform1ivARB(GLint location, GLsizei count, const
 
 }
 
-static void REGAL_CALL emu_glUniform2fARB(GLint location, GLfloat v0, GLfloat v1)
+static void REGAL_CALL emu_glUniform4iARB(GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -42447,10 +47041,11 @@ static void REGAL_CALL emu_glUniform2fARB(GLint location, GLfloat v0, GLfloat v1
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( _context->iff->currinst ) {
-          _context->iff->Uniform( _context, 2, location, 1, v0, v1 );
+          _context->iff->Uniform( _context, 4, location, 1, v0, v1, v2, v3 );
         } else {
-          _context->dispatcher.emulation.glUniform2fARB( location, v0, v1 );
+          _context->dispatcher.emulation.glUniform4iARB( location, v0, v1, v2, v3 );
         }
         return;
       }
@@ -42460,7 +47055,7 @@ static void REGAL_CALL emu_glUniform2fARB(GLint location, GLfloat v0, GLfloat v1
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glUniform2fARB)(location, v0, v1);
+      _next->call(&_next->glUniform4iARB)(location, v0, v1, v2, v3);
       break;
     }
 
@@ -42468,7 +47063,7 @@ static void REGAL_CALL emu_glUniform2fARB(GLint location, GLfloat v0, GLfloat v1
 
 }
 
-static void REGAL_CALL emu_glUniform2fvARB(GLint location, GLsizei count, const GLfloat *value)
+static void REGAL_CALL emu_glUniform4ivARB(GLint location, GLsizei count, const GLint *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -42513,10 +47108,11 @@ static void REGAL_CALL emu_glUniform2fvARB(GLint location, GLsizei count, const
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( _context->iff->currinst ) {
-          _context->iff->Uniform( _context, 2, location, count, value );
+          _context->iff->Uniform( _context, 4, location, count, value );
         } else {
-          _context->dispatcher.emulation.glUniform2fvARB( location, count, value );
+          _context->dispatcher.emulation.glUniform4ivARB( location, count, value );
         }
         return;
       }
@@ -42526,7 +47122,7 @@ static void REGAL_CALL emu_glUniform2fvARB(GLint location, GLsizei count, const
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glUniform2fvARB)(location, count, value);
+      _next->call(&_next->glUniform4ivARB)(location, count, value);
       break;
     }
 
@@ -42534,7 +47130,7 @@ static void REGAL_CALL emu_glUniform2fvARB(GLint location, GLsizei count, const
 
 }
 
-static void REGAL_CALL emu_glUniform2iARB(GLint location, GLint v0, GLint v1)
+static void REGAL_CALL emu_glUniformMatrix2fvARB(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -42579,10 +47175,11 @@ static void REGAL_CALL emu_glUniform2iARB(GLint location, GLint v0, GLint v1)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( _context->iff->currinst ) {
-          _context->iff->Uniform( _context, 2, location, 1, v0, v1 );
+          _context->iff->UniformMatrix( _context, 2, 2, location, count, transpose, value );
         } else {
-          _context->dispatcher.emulation.glUniform2iARB( location, v0, v1 );
+          _context->dispatcher.emulation.glUniformMatrix2fvARB( location, count, transpose, value );
         }
         return;
       }
@@ -42592,7 +47189,7 @@ static void REGAL_CALL emu_glUniform2iARB(GLint location, GLint v0, GLint v1)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glUniform2iARB)(location, v0, v1);
+      _next->call(&_next->glUniformMatrix2fvARB)(location, count, transpose, value);
       break;
     }
 
@@ -42600,7 +47197,7 @@ static void REGAL_CALL emu_glUniform2iARB(GLint location, GLint v0, GLint v1)
 
 }
 
-static void REGAL_CALL emu_glUniform2ivARB(GLint location, GLsizei count, const GLint *value)
+static void REGAL_CALL emu_glUniformMatrix3fvARB(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -42645,10 +47242,11 @@ static void REGAL_CALL emu_glUniform2ivARB(GLint location, GLsizei count, const
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( _context->iff->currinst ) {
-          _context->iff->Uniform( _context, 2, location, count, value );
+          _context->iff->UniformMatrix( _context, 3, 3, location, count, transpose, value );
         } else {
-          _context->dispatcher.emulation.glUniform2ivARB( location, count, value );
+          _context->dispatcher.emulation.glUniformMatrix3fvARB( location, count, transpose, value );
         }
         return;
       }
@@ -42658,7 +47256,7 @@ static void REGAL_CALL emu_glUniform2ivARB(GLint location, GLsizei count, const
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glUniform2ivARB)(location, count, value);
+      _next->call(&_next->glUniformMatrix3fvARB)(location, count, transpose, value);
       break;
     }
 
@@ -42666,7 +47264,7 @@ static void REGAL_CALL emu_glUniform2ivARB(GLint location, GLsizei count, const
 
 }
 
-static void REGAL_CALL emu_glUniform3fARB(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+static void REGAL_CALL emu_glUniformMatrix4fvARB(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -42711,10 +47309,11 @@ static void REGAL_CALL emu_glUniform3fARB(GLint location, GLfloat v0, GLfloat v1
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         if( _context->iff->currinst ) {
-          _context->iff->Uniform( _context, 3, location, 1, v0, v1, v2 );
+          _context->iff->UniformMatrix( _context, 4, 4, location, count, transpose, value );
         } else {
-          _context->dispatcher.emulation.glUniform3fARB( location, v0, v1, v2 );
+          _context->dispatcher.emulation.glUniformMatrix4fvARB( location, count, transpose, value );
         }
         return;
       }
@@ -42724,7 +47323,7 @@ static void REGAL_CALL emu_glUniform3fARB(GLint location, GLfloat v0, GLfloat v1
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glUniform3fARB)(location, v0, v1, v2);
+      _next->call(&_next->glUniformMatrix4fvARB)(location, count, transpose, value);
       break;
     }
 
@@ -42732,7 +47331,7 @@ static void REGAL_CALL emu_glUniform3fARB(GLint location, GLfloat v0, GLfloat v1
 
 }
 
-static void REGAL_CALL emu_glUniform3fvARB(GLint location, GLsizei count, const GLfloat *value)
+static void REGAL_CALL emu_glUseProgramObjectARB(GLhandleARB programObj)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -42777,10 +47376,9 @@ static void REGAL_CALL emu_glUniform3fvARB(GLint location, GLsizei count, const
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        if( _context->iff->currinst ) {
-          _context->iff->Uniform( _context, 3, location, count, value );
-        } else {
-          _context->dispatcher.emulation.glUniform3fvARB( location, count, value );
+        _context->iff->FlushBatch( _context );
+        if( ! _context->iff->ShadowUseProgram( programObj ) ) {
+            _context->dispatcher.emulation.glUseProgram( programObj );
         }
         return;
       }
@@ -42790,7 +47388,7 @@ static void REGAL_CALL emu_glUniform3fvARB(GLint location, GLsizei count, const
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glUniform3fvARB)(location, count, value);
+      _next->call(&_next->glUseProgramObjectARB)(programObj);
       break;
     }
 
@@ -42798,7 +47396,19 @@ static void REGAL_CALL emu_glUniform3fvARB(GLint location, GLsizei count, const
 
 }
 
-static void REGAL_CALL emu_glUniform3iARB(GLint location, GLint v0, GLint v1, GLint v2)
+// GL_ARB_shader_storage_buffer_object
+
+// GL_ARB_shader_subroutine
+
+// GL_ARB_shading_language_include
+
+// GL_ARB_sparse_buffer
+
+// GL_ARB_sparse_texture
+
+// GL_ARB_sync
+
+static GLenum REGAL_CALL emu_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -42818,9 +47428,94 @@ static void REGAL_CALL emu_glUniform3iARB(GLint location, GLint v0, GLint v1, GL
     case 8 :
     case 7 :
       #if REGAL_EMU_IFF
-      if (_context->iff) break;
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  return _next->call(& _next->glClientWaitSync)(sync, flags, timeout);
+}
+
+static GLsync REGAL_CALL emu_glFenceSync(GLenum condition, GLbitfield flags)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  return _next->call(& _next->glFenceSync)(condition, flags);
+}
+
+static void REGAL_CALL emu_glGetInteger64v(GLenum pname, GLint64 *params)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+      #if REGAL_EMU_SO
+      if (_context->so) break;
+      #endif
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao) break;
       #endif
+    case 2 :
     case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt) break;
+      #endif
     default:
       break;
   }
@@ -42838,25 +47533,53 @@ static void REGAL_CALL emu_glUniform3iARB(GLint location, GLint v0, GLint v1, GL
     case 9 :
     case 8 :
     case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff)
+    case 6 :
+    case 5 :
+      #if REGAL_EMU_SO
+      if (_context->so)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 6;
-        if( _context->iff->currinst ) {
-          _context->iff->Uniform( _context, 3, location, 1, v0, v1, v2 );
-        } else {
-          _context->dispatcher.emulation.glUniform3iARB( location, v0, v1, v2 );
+        _context->emuLevel = 4;
+        if ( !_context->so->Get( pname, params ) ) {
+           _context->dispatcher.emulation.glGetInteger64v( pname, params );
+        }
+        return;
+      }
+      #endif
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        if( !_context->vao->Get( pname, params ) ) {
+           _context->dispatcher.emulation.glGetInteger64v( pname, params );
         }
         return;
       }
       #endif
+    case 2 :
     case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 0;
+        if (_context->filt->Get(*_context, pname, params))
+        {
+          #if REGAL_BREAK
+          Break::Filter();
+          #endif
+          return ;
+        }
+      }
+      #endif
     default:
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glUniform3iARB)(location, v0, v1, v2);
+      _next->call(&_next->glGetInteger64v)(pname, params);
       break;
     }
 
@@ -42864,7 +47587,7 @@ static void REGAL_CALL emu_glUniform3iARB(GLint location, GLint v0, GLint v1, GL
 
 }
 
-static void REGAL_CALL emu_glUniform3ivARB(GLint location, GLsizei count, const GLint *value)
+static void REGAL_CALL emu_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -42884,14 +47607,40 @@ static void REGAL_CALL emu_glUniform3ivARB(GLint location, GLsizei count, const
     case 8 :
     case 7 :
       #if REGAL_EMU_IFF
-      if (_context->iff) break;
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
       #endif
     case 1 :
     default:
       break;
   }
 
-  // impl
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glWaitSync)(sync, flags, timeout);
+}
+
+// GL_ARB_tessellation_shader
+
+// GL_ARB_texture_barrier
+
+// GL_ARB_texture_buffer_object
+
+// GL_ARB_texture_buffer_range
+
+// GL_ARB_texture_compression
+
+static void REGAL_CALL emu_glCompressedTexImage1DARB(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const GLvoid *data)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
   switch( _context->emuLevel )
   {
     case 16 :
@@ -42909,28 +47658,20 @@ static void REGAL_CALL emu_glUniform3ivARB(GLint location, GLsizei count, const
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        if( _context->iff->currinst ) {
-          _context->iff->Uniform( _context, 3, location, count, value );
-        } else {
-          _context->dispatcher.emulation.glUniform3ivARB( location, count, value );
-        }
-        return;
+        _context->iff->FlushBatch( _context );
       }
       #endif
     case 1 :
     default:
-    {
-      DispatchTableGL *_next = _dispatch.next();
-      RegalAssert(_next);
-      _next->call(&_next->glUniform3ivARB)(location, count, value);
       break;
-    }
-
   }
 
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glCompressedTexImage1DARB)(target, level, internalformat, width, border, imageSize, data);
 }
 
-static void REGAL_CALL emu_glUniform4fARB(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+static void REGAL_CALL emu_glCompressedTexImage2DARB(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const GLvoid *data)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -42945,12 +47686,20 @@ static void REGAL_CALL emu_glUniform4fARB(GLint location, GLfloat v0, GLfloat v1
     case 13 :
     case 12 :
     case 11 :
+      #if REGAL_EMU_XFER
+      if (_context->xfer) break;
+      #endif
     case 10 :
     case 9 :
     case 8 :
     case 7 :
       #if REGAL_EMU_IFF
-      if (_context->iff) break;
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
       #endif
     case 1 :
     default:
@@ -42966,20 +47715,12 @@ static void REGAL_CALL emu_glUniform4fARB(GLint location, GLfloat v0, GLfloat v1
     case 13 :
     case 12 :
     case 11 :
-    case 10 :
-    case 9 :
-    case 8 :
-    case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff)
+      #if REGAL_EMU_XFER
+      if (_context->xfer)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 6;
-        if( _context->iff->currinst ) {
-          _context->iff->Uniform( _context, 4, location, 1, v0, v1, v2, v3 );
-        } else {
-          _context->dispatcher.emulation.glUniform4fARB( location, v0, v1, v2, v3 );
-        }
+        _context->emuLevel = 10;
+        _context->xfer->CompressedTexImage2D( _context, target, level, internalformat, width, height, border, imageSize, data );
         return;
       }
       #endif
@@ -42988,7 +47729,7 @@ static void REGAL_CALL emu_glUniform4fARB(GLint location, GLfloat v0, GLfloat v1
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glUniform4fARB)(location, v0, v1, v2, v3);
+      _next->call(&_next->glCompressedTexImage2DARB)(target, level, internalformat, width, height, border, imageSize, data);
       break;
     }
 
@@ -42996,7 +47737,7 @@ static void REGAL_CALL emu_glUniform4fARB(GLint location, GLfloat v0, GLfloat v1
 
 }
 
-static void REGAL_CALL emu_glUniform4fvARB(GLint location, GLsizei count, const GLfloat *value)
+static void REGAL_CALL emu_glCompressedTexImage3DARB(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const GLvoid *data)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -43016,14 +47757,30 @@ static void REGAL_CALL emu_glUniform4fvARB(GLint location, GLsizei count, const
     case 8 :
     case 7 :
       #if REGAL_EMU_IFF
-      if (_context->iff) break;
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
       #endif
     case 1 :
     default:
       break;
   }
 
-  // impl
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glCompressedTexImage3DARB)(target, level, internalformat, width, height, depth, border, imageSize, data);
+}
+
+static void REGAL_CALL emu_glCompressedTexSubImage1DARB(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const GLvoid *data)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
   switch( _context->emuLevel )
   {
     case 16 :
@@ -43041,28 +47798,20 @@ static void REGAL_CALL emu_glUniform4fvARB(GLint location, GLsizei count, const
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        if( _context->iff->currinst ) {
-          _context->iff->Uniform( _context, 4, location, count, value );
-        } else {
-          _context->dispatcher.emulation.glUniform4fvARB( location, count, value );
-        }
-        return;
+        _context->iff->FlushBatch( _context );
       }
       #endif
     case 1 :
     default:
-    {
-      DispatchTableGL *_next = _dispatch.next();
-      RegalAssert(_next);
-      _next->call(&_next->glUniform4fvARB)(location, count, value);
       break;
-    }
-
   }
 
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glCompressedTexSubImage1DARB)(target, level, xoffset, width, format, imageSize, data);
 }
 
-static void REGAL_CALL emu_glUniform4iARB(GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+static void REGAL_CALL emu_glCompressedTexSubImage2DARB(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const GLvoid *data)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -43077,12 +47826,20 @@ static void REGAL_CALL emu_glUniform4iARB(GLint location, GLint v0, GLint v1, GL
     case 13 :
     case 12 :
     case 11 :
+      #if REGAL_EMU_XFER
+      if (_context->xfer) break;
+      #endif
     case 10 :
     case 9 :
     case 8 :
     case 7 :
       #if REGAL_EMU_IFF
-      if (_context->iff) break;
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
       #endif
     case 1 :
     default:
@@ -43098,20 +47855,12 @@ static void REGAL_CALL emu_glUniform4iARB(GLint location, GLint v0, GLint v1, GL
     case 13 :
     case 12 :
     case 11 :
-    case 10 :
-    case 9 :
-    case 8 :
-    case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff)
+      #if REGAL_EMU_XFER
+      if (_context->xfer)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 6;
-        if( _context->iff->currinst ) {
-          _context->iff->Uniform( _context, 4, location, 1, v0, v1, v2, v3 );
-        } else {
-          _context->dispatcher.emulation.glUniform4iARB( location, v0, v1, v2, v3 );
-        }
+        _context->emuLevel = 10;
+        _context->xfer->CompressedTexSubImage2D( _context, target, level, xoffset, yoffset, width, height, format, imageSize, data );
         return;
       }
       #endif
@@ -43120,7 +47869,7 @@ static void REGAL_CALL emu_glUniform4iARB(GLint location, GLint v0, GLint v1, GL
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glUniform4iARB)(location, v0, v1, v2, v3);
+      _next->call(&_next->glCompressedTexSubImage2DARB)(target, level, xoffset, yoffset, width, height, format, imageSize, data);
       break;
     }
 
@@ -43128,7 +47877,7 @@ static void REGAL_CALL emu_glUniform4iARB(GLint location, GLint v0, GLint v1, GL
 
 }
 
-static void REGAL_CALL emu_glUniform4ivARB(GLint location, GLsizei count, const GLint *value)
+static void REGAL_CALL emu_glCompressedTexSubImage3DARB(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const GLvoid *data)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -43148,14 +47897,30 @@ static void REGAL_CALL emu_glUniform4ivARB(GLint location, GLsizei count, const
     case 8 :
     case 7 :
       #if REGAL_EMU_IFF
-      if (_context->iff) break;
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
       #endif
     case 1 :
     default:
       break;
   }
 
-  // impl
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glCompressedTexSubImage3DARB)(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+
+static void REGAL_CALL emu_glGetCompressedTexImageARB(GLenum target, GLint level, GLvoid *img)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
   switch( _context->emuLevel )
   {
     case 16 :
@@ -43173,28 +47938,34 @@ static void REGAL_CALL emu_glUniform4ivARB(GLint location, GLsizei count, const
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        if( _context->iff->currinst ) {
-          _context->iff->Uniform( _context, 4, location, count, value );
-        } else {
-          _context->dispatcher.emulation.glUniform4ivARB( location, count, value );
-        }
-        return;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
       }
       #endif
     case 1 :
     default:
-    {
-      DispatchTableGL *_next = _dispatch.next();
-      RegalAssert(_next);
-      _next->call(&_next->glUniform4ivARB)(location, count, value);
       break;
-    }
-
   }
 
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glGetCompressedTexImageARB)(target, level, img);
 }
 
-static void REGAL_CALL emu_glUniformMatrix2fvARB(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+// GL_ARB_texture_multisample
+
+static void REGAL_CALL emu_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -43214,14 +47985,31 @@ static void REGAL_CALL emu_glUniformMatrix2fvARB(GLint location, GLsizei count,
     case 8 :
     case 7 :
       #if REGAL_EMU_IFF
-      if (_context->iff) break;
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+        _context->iff->ShadowTexInfo( target, internalformat );
+      }
       #endif
     case 1 :
     default:
       break;
   }
 
-  // impl
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glTexImage2DMultisample)(target, samples, internalformat, width, height, fixedsamplelocations);
+}
+
+static void REGAL_CALL emu_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
   switch( _context->emuLevel )
   {
     case 16 :
@@ -43239,28 +48027,23 @@ static void REGAL_CALL emu_glUniformMatrix2fvARB(GLint location, GLsizei count,
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        if( _context->iff->currinst ) {
-          _context->iff->UniformMatrix( _context, 2, 2, location, count, transpose, value );
-        } else {
-          _context->dispatcher.emulation.glUniformMatrix2fvARB( location, count, transpose, value );
-        }
-        return;
+        _context->iff->FlushBatch( _context );
+        _context->iff->ShadowTexInfo( target, internalformat );
       }
       #endif
     case 1 :
     default:
-    {
-      DispatchTableGL *_next = _dispatch.next();
-      RegalAssert(_next);
-      _next->call(&_next->glUniformMatrix2fvARB)(location, count, transpose, value);
       break;
-    }
-
   }
 
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glTexImage3DMultisample)(target, samples, internalformat, width, height, depth, fixedsamplelocations);
 }
 
-static void REGAL_CALL emu_glUniformMatrix3fvARB(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+// GL_ARB_texture_storage
+
+static void REGAL_CALL emu_glTexStorage1D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -43276,11 +48059,19 @@ static void REGAL_CALL emu_glUniformMatrix3fvARB(GLint location, GLsizei count,
     case 12 :
     case 11 :
     case 10 :
+      #if REGAL_EMU_TEXSTO
+      if (_context->texsto) break;
+      #endif
     case 9 :
     case 8 :
     case 7 :
       #if REGAL_EMU_IFF
-      if (_context->iff) break;
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
       #endif
     case 1 :
     default:
@@ -43297,19 +48088,12 @@ static void REGAL_CALL emu_glUniformMatrix3fvARB(GLint location, GLsizei count,
     case 12 :
     case 11 :
     case 10 :
-    case 9 :
-    case 8 :
-    case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff)
+      #if REGAL_EMU_TEXSTO
+      if (_context->texsto)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 6;
-        if( _context->iff->currinst ) {
-          _context->iff->UniformMatrix( _context, 3, 3, location, count, transpose, value );
-        } else {
-          _context->dispatcher.emulation.glUniformMatrix3fvARB( location, count, transpose, value );
-        }
+        _context->emuLevel = 9;
+        _context->texsto->TextureStorage( _context, target, levels, internalformat, width );
         return;
       }
       #endif
@@ -43318,7 +48102,7 @@ static void REGAL_CALL emu_glUniformMatrix3fvARB(GLint location, GLsizei count,
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glUniformMatrix3fvARB)(location, count, transpose, value);
+      _next->call(&_next->glTexStorage1D)(target, levels, internalformat, width);
       break;
     }
 
@@ -43326,7 +48110,7 @@ static void REGAL_CALL emu_glUniformMatrix3fvARB(GLint location, GLsizei count,
 
 }
 
-static void REGAL_CALL emu_glUniformMatrix4fvARB(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+static void REGAL_CALL emu_glTexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -43342,11 +48126,19 @@ static void REGAL_CALL emu_glUniformMatrix4fvARB(GLint location, GLsizei count,
     case 12 :
     case 11 :
     case 10 :
+      #if REGAL_EMU_TEXSTO
+      if (_context->texsto) break;
+      #endif
     case 9 :
     case 8 :
     case 7 :
       #if REGAL_EMU_IFF
-      if (_context->iff) break;
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
       #endif
     case 1 :
     default:
@@ -43363,19 +48155,12 @@ static void REGAL_CALL emu_glUniformMatrix4fvARB(GLint location, GLsizei count,
     case 12 :
     case 11 :
     case 10 :
-    case 9 :
-    case 8 :
-    case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff)
+      #if REGAL_EMU_TEXSTO
+      if (_context->texsto)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 6;
-        if( _context->iff->currinst ) {
-          _context->iff->UniformMatrix( _context, 4, 4, location, count, transpose, value );
-        } else {
-          _context->dispatcher.emulation.glUniformMatrix4fvARB( location, count, transpose, value );
-        }
+        _context->emuLevel = 9;
+        _context->texsto->TextureStorage( _context, target, levels, internalformat, width, height );
         return;
       }
       #endif
@@ -43384,7 +48169,7 @@ static void REGAL_CALL emu_glUniformMatrix4fvARB(GLint location, GLsizei count,
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glUniformMatrix4fvARB)(location, count, transpose, value);
+      _next->call(&_next->glTexStorage2D)(target, levels, internalformat, width, height);
       break;
     }
 
@@ -43392,7 +48177,7 @@ static void REGAL_CALL emu_glUniformMatrix4fvARB(GLint location, GLsizei count,
 
 }
 
-static void REGAL_CALL emu_glUseProgramObjectARB(GLhandleARB programObj)
+static void REGAL_CALL emu_glTexStorage3D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -43408,11 +48193,19 @@ static void REGAL_CALL emu_glUseProgramObjectARB(GLhandleARB programObj)
     case 12 :
     case 11 :
     case 10 :
+      #if REGAL_EMU_TEXSTO
+      if (_context->texsto) break;
+      #endif
     case 9 :
     case 8 :
     case 7 :
       #if REGAL_EMU_IFF
-      if (_context->iff) break;
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
       #endif
     case 1 :
     default:
@@ -43429,17 +48222,12 @@ static void REGAL_CALL emu_glUseProgramObjectARB(GLhandleARB programObj)
     case 12 :
     case 11 :
     case 10 :
-    case 9 :
-    case 8 :
-    case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff)
+      #if REGAL_EMU_TEXSTO
+      if (_context->texsto)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 6;
-        if( ! _context->iff->ShadowUseProgram( programObj ) ) {
-            _context->dispatcher.emulation.glUseProgram( programObj );
-        }
+        _context->emuLevel = 9;
+        _context->texsto->TextureStorage( _context, target, levels, internalformat, width, height, depth );
         return;
       }
       #endif
@@ -43448,7 +48236,7 @@ static void REGAL_CALL emu_glUseProgramObjectARB(GLhandleARB programObj)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glUseProgramObjectARB)(programObj);
+      _next->call(&_next->glTexStorage3D)(target, levels, internalformat, width, height, depth);
       break;
     }
 
@@ -43456,19 +48244,7 @@ static void REGAL_CALL emu_glUseProgramObjectARB(GLhandleARB programObj)
 
 }
 
-// GL_ARB_shader_storage_buffer_object
-
-// GL_ARB_shader_subroutine
-
-// GL_ARB_shading_language_include
-
-// GL_ARB_sparse_buffer
-
-// GL_ARB_sparse_texture
-
-// GL_ARB_sync
-
-static void REGAL_CALL emu_glGetInteger64v(GLenum pname, GLint64 *params)
+static void REGAL_CALL emu_glTextureStorage1DEXT(GLuint texture, GLenum target, GLsizei levels, GLenum internalformat, GLsizei width)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -43487,21 +48263,21 @@ static void REGAL_CALL emu_glGetInteger64v(GLenum pname, GLint64 *params)
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
-      #if REGAL_EMU_SO
-      if (_context->so) break;
-      #endif
     case 4 :
-    case 3 :
-      #if REGAL_EMU_VAO
-      if (_context->vao) break;
+      #if REGAL_EMU_DSA
+      if (_context->dsa) break;
       #endif
-    case 2 :
     case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt) break;
-      #endif
     default:
       break;
   }
@@ -43521,51 +48297,23 @@ static void REGAL_CALL emu_glGetInteger64v(GLenum pname, GLint64 *params)
     case 7 :
     case 6 :
     case 5 :
-      #if REGAL_EMU_SO
-      if (_context->so)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 4;
-        if ( !_context->so->Get( pname, params ) ) {
-           _context->dispatcher.emulation.glGetInteger64v( pname, params );
-        }
-        return;
-      }
-      #endif
     case 4 :
-    case 3 :
-      #if REGAL_EMU_VAO
-      if (_context->vao)
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 2;
-        if( !_context->vao->Get( pname, params ) ) {
-           _context->dispatcher.emulation.glGetInteger64v( pname, params );
-        }
+        _context->emuLevel = 3;
+        _context->dsa->DsaTexture( _context, target, texture );
+        _dispatch.call(&_dispatch.glTexStorage1D)( target, levels, internalformat, width );
         return;
       }
       #endif
-    case 2 :
     case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 0;
-        if (_context->filt->Get(*_context, pname, params))
-        {
-          #if REGAL_BREAK
-          Break::Filter();
-          #endif
-          return ;
-        }
-      }
-      #endif
     default:
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glGetInteger64v)(pname, params);
+      _next->call(&_next->glTextureStorage1DEXT)(texture, target, levels, internalformat, width);
       break;
     }
 
@@ -43573,17 +48321,7 @@ static void REGAL_CALL emu_glGetInteger64v(GLenum pname, GLint64 *params)
 
 }
 
-// GL_ARB_tessellation_shader
-
-// GL_ARB_texture_barrier
-
-// GL_ARB_texture_buffer_object
-
-// GL_ARB_texture_buffer_range
-
-// GL_ARB_texture_compression
-
-static void REGAL_CALL emu_glCompressedTexImage2DARB(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const GLvoid *data)
+static void REGAL_CALL emu_glTextureStorage2DEXT(GLuint texture, GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -43598,8 +48336,23 @@ static void REGAL_CALL emu_glCompressedTexImage2DARB(GLenum target, GLint level,
     case 13 :
     case 12 :
     case 11 :
-      #if REGAL_EMU_XFER
-      if (_context->xfer) break;
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 6 :
+    case 5 :
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa) break;
       #endif
     case 1 :
     default:
@@ -43615,12 +48368,20 @@ static void REGAL_CALL emu_glCompressedTexImage2DARB(GLenum target, GLint level,
     case 13 :
     case 12 :
     case 11 :
-      #if REGAL_EMU_XFER
-      if (_context->xfer)
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 10;
-        _context->xfer->CompressedTexImage2D( _context, target, level, internalformat, width, height, border, imageSize, data );
+        _context->emuLevel = 3;
+        _context->dsa->DsaTexture( _context, target, texture );
+        _dispatch.call(&_dispatch.glTexStorage2D)( target, levels, internalformat, width, height );
         return;
       }
       #endif
@@ -43629,7 +48390,7 @@ static void REGAL_CALL emu_glCompressedTexImage2DARB(GLenum target, GLint level,
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glCompressedTexImage2DARB)(target, level, internalformat, width, height, border, imageSize, data);
+      _next->call(&_next->glTextureStorage2DEXT)(texture, target, levels, internalformat, width, height);
       break;
     }
 
@@ -43637,7 +48398,7 @@ static void REGAL_CALL emu_glCompressedTexImage2DARB(GLenum target, GLint level,
 
 }
 
-static void REGAL_CALL emu_glCompressedTexSubImage2DARB(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const GLvoid *data)
+static void REGAL_CALL emu_glTextureStorage3DEXT(GLuint texture, GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -43652,8 +48413,23 @@ static void REGAL_CALL emu_glCompressedTexSubImage2DARB(GLenum target, GLint lev
     case 13 :
     case 12 :
     case 11 :
-      #if REGAL_EMU_XFER
-      if (_context->xfer) break;
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 6 :
+    case 5 :
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa) break;
       #endif
     case 1 :
     default:
@@ -43669,12 +48445,20 @@ static void REGAL_CALL emu_glCompressedTexSubImage2DARB(GLenum target, GLint lev
     case 13 :
     case 12 :
     case 11 :
-      #if REGAL_EMU_XFER
-      if (_context->xfer)
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 10;
-        _context->xfer->CompressedTexSubImage2D( _context, target, level, xoffset, yoffset, width, height, format, imageSize, data );
+        _context->emuLevel = 3;
+        _context->dsa->DsaTexture( _context, target, texture );
+        _dispatch.call(&_dispatch.glTexStorage3D)( target, levels, internalformat, width, height, depth );
         return;
       }
       #endif
@@ -43683,7 +48467,7 @@ static void REGAL_CALL emu_glCompressedTexSubImage2DARB(GLenum target, GLint lev
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glCompressedTexSubImage2DARB)(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+      _next->call(&_next->glTextureStorage3DEXT)(texture, target, levels, internalformat, width, height, depth);
       break;
     }
 
@@ -43691,9 +48475,9 @@ static void REGAL_CALL emu_glCompressedTexSubImage2DARB(GLenum target, GLint lev
 
 }
 
-// GL_ARB_texture_multisample
+// GL_ARB_texture_storage_multisample
 
-static void REGAL_CALL emu_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
+static void REGAL_CALL emu_glTexStorage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -43717,7 +48501,7 @@ static void REGAL_CALL emu_glTexImage2DMultisample(GLenum target, GLsizei sample
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->ShadowTexInfo( target, internalformat );
+        _context->iff->FlushBatch( _context );
       }
       #endif
     case 1 :
@@ -43727,10 +48511,10 @@ static void REGAL_CALL emu_glTexImage2DMultisample(GLenum target, GLsizei sample
 
   DispatchTableGL *_next = _dispatch.next();
   RegalAssert(_next);
-  _next->call(& _next->glTexImage2DMultisample)(target, samples, internalformat, width, height, fixedsamplelocations);
+  _next->call(& _next->glTexStorage2DMultisample)(target, samples, internalformat, width, height, fixedsamplelocations);
 }
 
-static void REGAL_CALL emu_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
+static void REGAL_CALL emu_glTexStorage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -43754,7 +48538,7 @@ static void REGAL_CALL emu_glTexImage3DMultisample(GLenum target, GLsizei sample
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->ShadowTexInfo( target, internalformat );
+        _context->iff->FlushBatch( _context );
       }
       #endif
     case 1 :
@@ -43764,12 +48548,10 @@ static void REGAL_CALL emu_glTexImage3DMultisample(GLenum target, GLsizei sample
 
   DispatchTableGL *_next = _dispatch.next();
   RegalAssert(_next);
-  _next->call(& _next->glTexImage3DMultisample)(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+  _next->call(& _next->glTexStorage3DMultisample)(target, samples, internalformat, width, height, depth, fixedsamplelocations);
 }
 
-// GL_ARB_texture_storage
-
-static void REGAL_CALL emu_glTexStorage1D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width)
+static void REGAL_CALL emu_glTextureStorage2DMultisampleEXT(GLuint texture, GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -43785,47 +48567,28 @@ static void REGAL_CALL emu_glTexStorage1D(GLenum target, GLsizei levels, GLenum
     case 12 :
     case 11 :
     case 10 :
-      #if REGAL_EMU_TEXSTO
-      if (_context->texsto) break;
-      #endif
-    case 1 :
-    default:
-      break;
-  }
-
-  // impl
-  switch( _context->emuLevel )
-  {
-    case 16 :
-    case 15 :
-    case 14 :
-    case 13 :
-    case 12 :
-    case 11 :
-    case 10 :
-      #if REGAL_EMU_TEXSTO
-      if (_context->texsto)
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 9;
-        _context->texsto->TextureStorage( _context, target, levels, internalformat, width );
-        return;
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
       }
       #endif
     case 1 :
     default:
-    {
-      DispatchTableGL *_next = _dispatch.next();
-      RegalAssert(_next);
-      _next->call(&_next->glTexStorage1D)(target, levels, internalformat, width);
       break;
-    }
-
   }
 
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glTextureStorage2DMultisampleEXT)(texture, target, samples, internalformat, width, height, fixedsamplelocations);
 }
 
-static void REGAL_CALL emu_glTexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height)
+static void REGAL_CALL emu_glTextureStorage3DMultisampleEXT(GLuint texture, GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -43841,47 +48604,32 @@ static void REGAL_CALL emu_glTexStorage2D(GLenum target, GLsizei levels, GLenum
     case 12 :
     case 11 :
     case 10 :
-      #if REGAL_EMU_TEXSTO
-      if (_context->texsto) break;
-      #endif
-    case 1 :
-    default:
-      break;
-  }
-
-  // impl
-  switch( _context->emuLevel )
-  {
-    case 16 :
-    case 15 :
-    case 14 :
-    case 13 :
-    case 12 :
-    case 11 :
-    case 10 :
-      #if REGAL_EMU_TEXSTO
-      if (_context->texsto)
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 9;
-        _context->texsto->TextureStorage( _context, target, levels, internalformat, width, height );
-        return;
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
       }
       #endif
     case 1 :
     default:
-    {
-      DispatchTableGL *_next = _dispatch.next();
-      RegalAssert(_next);
-      _next->call(&_next->glTexStorage2D)(target, levels, internalformat, width, height);
       break;
-    }
-
   }
 
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glTextureStorage3DMultisampleEXT)(texture, target, samples, internalformat, width, height, depth, fixedsamplelocations);
 }
 
-static void REGAL_CALL emu_glTexStorage3D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth)
+// GL_ARB_texture_view
+
+// GL_ARB_timer_query
+
+static void REGAL_CALL emu_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -43897,47 +48645,40 @@ static void REGAL_CALL emu_glTexStorage3D(GLenum target, GLsizei levels, GLenum
     case 12 :
     case 11 :
     case 10 :
-      #if REGAL_EMU_TEXSTO
-      if (_context->texsto) break;
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
       #endif
-    case 1 :
-    default:
-      break;
-  }
-
-  // impl
-  switch( _context->emuLevel )
-  {
-    case 16 :
-    case 15 :
-    case 14 :
-    case 13 :
-    case 12 :
-    case 11 :
-    case 10 :
-      #if REGAL_EMU_TEXSTO
-      if (_context->texsto)
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 9;
-        _context->texsto->TextureStorage( _context, target, levels, internalformat, width, height, depth );
-        return;
+        _context->emuLevel = 2;
+        _context->vao->QueryBufferWrite();
       }
       #endif
     case 1 :
     default:
-    {
-      DispatchTableGL *_next = _dispatch.next();
-      RegalAssert(_next);
-      _next->call(&_next->glTexStorage3D)(target, levels, internalformat, width, height, depth);
       break;
-    }
-
   }
 
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glGetQueryObjecti64v)(id, pname, params);
 }
 
-static void REGAL_CALL emu_glTextureStorage1DEXT(GLuint texture, GLenum target, GLsizei levels, GLenum internalformat, GLsizei width)
+static void REGAL_CALL emu_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -43956,18 +48697,43 @@ static void REGAL_CALL emu_glTextureStorage1DEXT(GLuint texture, GLenum target,
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa) break;
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->QueryBufferWrite();
+      }
       #endif
     case 1 :
     default:
       break;
   }
 
-  // impl
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glGetQueryObjectui64v)(id, pname, params);
+}
+
+static void REGAL_CALL emu_glQueryCounter(GLuint id, GLenum target)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
   switch( _context->emuLevel )
   {
     case 16 :
@@ -43980,33 +48746,27 @@ static void REGAL_CALL emu_glTextureStorage1DEXT(GLuint texture, GLenum target,
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        _context->dsa->DsaTexture( _context, target, texture );
-        _dispatch.call(&_dispatch.glTexStorage1D)( target, levels, internalformat, width );
-        return;
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
       }
       #endif
     case 1 :
     default:
-    {
-      DispatchTableGL *_next = _dispatch.next();
-      RegalAssert(_next);
-      _next->call(&_next->glTextureStorage1DEXT)(texture, target, levels, internalformat, width);
       break;
-    }
-
   }
 
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glQueryCounter)(id, target);
 }
 
-static void REGAL_CALL emu_glTextureStorage2DEXT(GLuint texture, GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height)
+// GL_ARB_transform_feedback2
+
+static void REGAL_CALL emu_glPauseTransformFeedback(void)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -44028,15 +48788,32 @@ static void REGAL_CALL emu_glTextureStorage2DEXT(GLuint texture, GLenum target,
     case 6 :
     case 5 :
     case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa) break;
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->TransformFeedback( false );
+      }
       #endif
     case 1 :
     default:
       break;
   }
 
-  // impl
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glPauseTransformFeedback)();
+}
+
+static void REGAL_CALL emu_glResumeTransformFeedback(void)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
   switch( _context->emuLevel )
   {
     case 16 :
@@ -44052,30 +48829,32 @@ static void REGAL_CALL emu_glTextureStorage2DEXT(GLuint texture, GLenum target,
     case 6 :
     case 5 :
     case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        _context->dsa->DsaTexture( _context, target, texture );
-        _dispatch.call(&_dispatch.glTexStorage2D)( target, levels, internalformat, width, height );
-        return;
+        _context->emuLevel = 2;
+        _context->vao->TransformFeedback( true );
       }
       #endif
     case 1 :
     default:
-    {
-      DispatchTableGL *_next = _dispatch.next();
-      RegalAssert(_next);
-      _next->call(&_next->glTextureStorage2DEXT)(texture, target, levels, internalformat, width, height);
       break;
-    }
-
   }
 
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glResumeTransformFeedback)();
 }
 
-static void REGAL_CALL emu_glTextureStorage3DEXT(GLuint texture, GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth)
+// GL_ARB_transform_feedback3
+
+// GL_ARB_transform_feedback_instanced
+
+// GL_ARB_transpose_matrix
+
+static void REGAL_CALL emu_glLoadTransposeMatrixdARB(const GLdouble *m)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -44094,11 +48873,8 @@ static void REGAL_CALL emu_glTextureStorage3DEXT(GLuint texture, GLenum target,
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa) break;
+      #if REGAL_EMU_IFF
+      if (_context->iff) break;
       #endif
     case 1 :
     default:
@@ -44118,16 +48894,13 @@ static void REGAL_CALL emu_glTextureStorage3DEXT(GLuint texture, GLenum target,
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        _context->dsa->DsaTexture( _context, target, texture );
-        _dispatch.call(&_dispatch.glTexStorage3D)( target, levels, internalformat, width, height, depth );
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+        _context->iff->LoadTransposeMatrix( m );
         return;
       }
       #endif
@@ -44136,7 +48909,7 @@ static void REGAL_CALL emu_glTextureStorage3DEXT(GLuint texture, GLenum target,
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glTextureStorage3DEXT)(texture, target, levels, internalformat, width, height, depth);
+      _next->call(&_next->glLoadTransposeMatrixdARB)(m);
       break;
     }
 
@@ -44144,21 +48917,7 @@ static void REGAL_CALL emu_glTextureStorage3DEXT(GLuint texture, GLenum target,
 
 }
 
-// GL_ARB_texture_storage_multisample
-
-// GL_ARB_texture_view
-
-// GL_ARB_timer_query
-
-// GL_ARB_transform_feedback2
-
-// GL_ARB_transform_feedback3
-
-// GL_ARB_transform_feedback_instanced
-
-// GL_ARB_transpose_matrix
-
-static void REGAL_CALL emu_glLoadTransposeMatrixdARB(const GLdouble *m)
+static void REGAL_CALL emu_glLoadTransposeMatrixfARB(const GLfloat *m)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -44203,6 +48962,7 @@ static void REGAL_CALL emu_glLoadTransposeMatrixdARB(const GLdouble *m)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->LoadTransposeMatrix( m );
         return;
       }
@@ -44212,7 +48972,7 @@ static void REGAL_CALL emu_glLoadTransposeMatrixdARB(const GLdouble *m)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glLoadTransposeMatrixdARB)(m);
+      _next->call(&_next->glLoadTransposeMatrixfARB)(m);
       break;
     }
 
@@ -44220,7 +48980,7 @@ static void REGAL_CALL emu_glLoadTransposeMatrixdARB(const GLdouble *m)
 
 }
 
-static void REGAL_CALL emu_glLoadTransposeMatrixfARB(const GLfloat *m)
+static void REGAL_CALL emu_glMultTransposeMatrixdARB(const GLdouble *m)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -44265,7 +49025,8 @@ static void REGAL_CALL emu_glLoadTransposeMatrixfARB(const GLfloat *m)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->LoadTransposeMatrix( m );
+        _context->iff->FlushBatch( _context );
+        _context->iff->MultTransposeMatrix( m );
         return;
       }
       #endif
@@ -44274,7 +49035,7 @@ static void REGAL_CALL emu_glLoadTransposeMatrixfARB(const GLfloat *m)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glLoadTransposeMatrixfARB)(m);
+      _next->call(&_next->glMultTransposeMatrixdARB)(m);
       break;
     }
 
@@ -44282,7 +49043,7 @@ static void REGAL_CALL emu_glLoadTransposeMatrixfARB(const GLfloat *m)
 
 }
 
-static void REGAL_CALL emu_glMultTransposeMatrixdARB(const GLdouble *m)
+static void REGAL_CALL emu_glMultTransposeMatrixfARB(const GLfloat *m)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -44327,6 +49088,7 @@ static void REGAL_CALL emu_glMultTransposeMatrixdARB(const GLdouble *m)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->MultTransposeMatrix( m );
         return;
       }
@@ -44336,7 +49098,7 @@ static void REGAL_CALL emu_glMultTransposeMatrixdARB(const GLdouble *m)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultTransposeMatrixdARB)(m);
+      _next->call(&_next->glMultTransposeMatrixfARB)(m);
       break;
     }
 
@@ -44344,7 +49106,9 @@ static void REGAL_CALL emu_glMultTransposeMatrixdARB(const GLdouble *m)
 
 }
 
-static void REGAL_CALL emu_glMultTransposeMatrixfARB(const GLfloat *m)
+// GL_ARB_uniform_buffer_object
+
+static void REGAL_CALL emu_glBindBufferBase(GLenum target, GLuint index, GLuint buffer)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -44364,14 +49128,31 @@ static void REGAL_CALL emu_glMultTransposeMatrixfARB(const GLfloat *m)
     case 8 :
     case 7 :
       #if REGAL_EMU_IFF
-      if (_context->iff) break;
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
+        _context->iff->ShadowBindBuffer( target, buffer );
+      }
       #endif
     case 1 :
     default:
       break;
   }
 
-  // impl
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glBindBufferBase)(target, index, buffer);
+}
+
+static void REGAL_CALL emu_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
   switch( _context->emuLevel )
   {
     case 16 :
@@ -44389,25 +49170,20 @@ static void REGAL_CALL emu_glMultTransposeMatrixfARB(const GLfloat *m)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->MultTransposeMatrix( m );
-        return;
+        _context->iff->RestoreVao( _context );
+        _context->iff->ShadowBindBuffer( target, buffer );
       }
       #endif
     case 1 :
     default:
-    {
-      DispatchTableGL *_next = _dispatch.next();
-      RegalAssert(_next);
-      _next->call(&_next->glMultTransposeMatrixfARB)(m);
       break;
-    }
-
   }
 
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glBindBufferRange)(target, index, buffer, offset, size);
 }
 
-// GL_ARB_uniform_buffer_object
-
 static void REGAL_CALL emu_glGetIntegeri_v(GLenum target, GLuint index, GLint *data)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
@@ -44503,6 +49279,7 @@ static void REGAL_CALL emu_glBindVertexArray(GLuint array)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
         _context->iff->glBindVertexArray( _context, array );
       }
       #endif
@@ -44658,6 +49435,7 @@ static void REGAL_CALL emu_glDeleteVertexArrays(GLsizei n, const GLuint *arrays)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
         _context->iff->glDeleteVertexArrays( _context, n, arrays );
         return;
       }
@@ -45191,6 +49969,15 @@ static void REGAL_CALL emu_glBindBufferARB(GLenum target, GLuint buffer)
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
+        _context->iff->ShadowBindBuffer( target, buffer );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -45283,6 +50070,14 @@ static void REGAL_CALL emu_glBufferDataARB(GLenum target, GLsizeiptrARB size, co
     case 5 :
     case 4 :
     case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
+      }
+      #endif
     case 2 :
     case 1 :
       #if REGAL_EMU_FILTER
@@ -45337,6 +50132,47 @@ static void REGAL_CALL emu_glBufferDataARB(GLenum target, GLsizeiptrARB size, co
 
 }
 
+static void REGAL_CALL emu_glBufferSubDataARB(GLenum target, GLintptrARB offset, GLsizeiptrARB size, const GLvoid *data)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glBufferSubDataARB)(target, offset, size, data);
+}
+
 static void REGAL_CALL emu_glDeleteBuffersARB(GLsizei n, const GLuint *buffers)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
@@ -45405,6 +50241,7 @@ static void REGAL_CALL emu_glDeleteBuffersARB(GLsizei n, const GLuint *buffers)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
         _context->iff->glDeleteBuffers( _context, n, buffers );
         return;
       }
@@ -45539,6 +50376,14 @@ static void *REGAL_CALL emu_glMapBufferARB(GLenum target, GLenum access)
       }
       #endif
     case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
+      }
+      #endif
     case 2 :
     case 1 :
       #if REGAL_EMU_FILTER
@@ -45622,6 +50467,14 @@ static GLboolean REGAL_CALL emu_glUnmapBufferARB(GLenum target)
       }
       #endif
     case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
+      }
+      #endif
     case 2 :
     case 1 :
       #if REGAL_EMU_FILTER
@@ -48914,6 +53767,7 @@ static void REGAL_CALL emu_glDrawElementArrayATI(GLenum mode, GLsizei count)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
         _context->iff->PreDraw( _context );
       }
       #endif
@@ -48971,78 +53825,430 @@ static void REGAL_CALL emu_glDrawRangeElementArrayATI(GLenum mode, GLuint start,
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->PreDraw( _context );
+        _context->iff->RestoreVao( _context );
+        _context->iff->PreDraw( _context );
+      }
+      #endif
+    case 6 :
+    case 5 :
+      #if REGAL_EMU_SO
+      if (_context->so)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 4;
+        RegalAssert(_context);
+        _context->so->PreDraw( *_context );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glDrawRangeElementArrayATI)(mode, start, end, count);
+}
+
+// GL_ATI_envmap_bumpmap
+
+// GL_ATI_fragment_shader
+
+// GL_ATI_map_object_buffer
+
+// GL_ATI_pn_triangles
+
+// GL_ATI_separate_stencil
+
+// GL_ATI_vertex_array_object
+
+// GL_ATI_vertex_attrib_array_object
+
+// GL_ATI_vertex_streams
+
+// GL_EXT_bindable_uniform
+
+// GL_EXT_blend_color
+
+static void REGAL_CALL emu_glBlendColorEXT(GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+    case 2 :
+    case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt) break;
+      #endif
+    default:
+      break;
+  }
+
+  // impl
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+    case 2 :
+    case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 0;
+        if (_context->isES2())
+        {
+          DispatchTableGL *_next = _context->dispatcher.emulation.next();
+          RegalAssert(_next);
+          _next->call(&_next->glBlendColor)(red, green, blue, alpha);
+          return;
+        }
+      }
+      #endif
+    default:
+    {
+      DispatchTableGL *_next = _dispatch.next();
+      RegalAssert(_next);
+      _next->call(&_next->glBlendColorEXT)(red, green, blue, alpha);
+      break;
+    }
+
+  }
+
+}
+
+// GL_EXT_blend_equation_separate
+
+static void REGAL_CALL emu_glBlendEquationSeparateEXT(GLenum modeRGB, GLenum modeAlpha)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glBlendEquationSeparateEXT)(modeRGB, modeAlpha);
+}
+
+// GL_EXT_blend_func_separate
+
+static void REGAL_CALL emu_glBlendFuncSeparateEXT(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glBlendFuncSeparateEXT)(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+
+// GL_EXT_blend_minmax
+
+static void REGAL_CALL emu_glBlendEquationEXT(GLenum mode)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+    case 2 :
+    case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt) break;
+      #endif
+    default:
+      break;
+  }
+
+  // impl
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+    case 2 :
+    case 1 :
+      #if REGAL_EMU_FILTER
+      if (_context->filt)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 0;
+        if (_context->isES2())
+        {
+          DispatchTableGL *_next = _context->dispatcher.emulation.next();
+          RegalAssert(_next);
+          _next->call(&_next->glBlendEquation)(mode);
+          return;
+        }
+      }
+      #endif
+    default:
+    {
+      DispatchTableGL *_next = _dispatch.next();
+      RegalAssert(_next);
+      _next->call(&_next->glBlendEquationEXT)(mode);
+      break;
+    }
+
+  }
+
+}
+
+// GL_EXT_color_subtable
+
+// GL_EXT_compiled_vertex_array
+
+// GL_EXT_convolution
+
+// GL_EXT_coordinate_frame
+
+// GL_EXT_copy_texture
+
+static void REGAL_CALL emu_glCopyTexImage1DEXT(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glCopyTexImage1DEXT)(target, level, internalformat, x, y, width, border);
+}
+
+static void REGAL_CALL emu_glCopyTexImage2DEXT(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glCopyTexImage2DEXT)(target, level, internalformat, x, y, width, height, border);
+}
+
+// GL_EXT_cull_vertex
+
+// GL_EXT_debug_label
+
+// GL_EXT_debug_marker
+
+// GL_EXT_depth_bounds_test
+
+// GL_EXT_direct_state_access
+
+static void REGAL_CALL emu_glBindMultiTextureEXT(GLenum texunit, GLenum target, GLuint texture)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+        _context->iff->ShadowMultiTexBinding( texunit, target, texture );
       }
       #endif
     case 6 :
-    case 5 :
-      #if REGAL_EMU_SO
-      if (_context->so)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 4;
-        RegalAssert(_context);
-        _context->so->PreDraw( *_context );
-      }
-      #endif
-    case 1 :
-    default:
-      break;
-  }
-
-  DispatchTableGL *_next = _dispatch.next();
-  RegalAssert(_next);
-  _next->call(& _next->glDrawRangeElementArrayATI)(mode, start, end, count);
-}
-
-// GL_ATI_envmap_bumpmap
-
-// GL_ATI_fragment_shader
-
-// GL_ATI_map_object_buffer
-
-// GL_ATI_pn_triangles
-
-// GL_ATI_separate_stencil
-
-// GL_ATI_vertex_array_object
-
-// GL_ATI_vertex_attrib_array_object
-
-// GL_ATI_vertex_streams
-
-// GL_EXT_bindable_uniform
-
-// GL_EXT_blend_color
-
-static void REGAL_CALL emu_glBlendColorEXT(GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha)
-{
-  RegalContext *_context = REGAL_GET_CONTEXT();
-  RegalAssert(_context);
-  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
-
-  // prefix
-  switch( _context->emuLevel )
-  {
-    case 16 :
-    case 15 :
-    case 14 :
-    case 13 :
-    case 12 :
-    case 11 :
-    case 10 :
-    case 9 :
-    case 8 :
-    case 7 :
-    case 6 :
     case 5 :
     case 4 :
-    case 3 :
-    case 2 :
-    case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt) break;
+      #if REGAL_EMU_DSA
+      if (_context->dsa) break;
       #endif
+    case 1 :
     default:
       break;
   }
@@ -49063,28 +54269,23 @@ static void REGAL_CALL emu_glBlendColorEXT(GLclampf red, GLclampf green, GLclamp
     case 6 :
     case 5 :
     case 4 :
-    case 3 :
-    case 2 :
-    case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt)
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 0;
-        if (_context->isES2())
-        {
-          DispatchTableGL *_next = _context->dispatcher.emulation.next();
-          RegalAssert(_next);
-          _next->call(&_next->glBlendColor)(red, green, blue, alpha);
-          return;
-        }
+        _context->emuLevel = 3;
+        _context->dsa->DsaActiveTexture( _context, texunit );
+        _context->dsa->ShadowDsaTexture( target, texture );
+        _dispatch.call(&_dispatch.glBindTexture)( target, texture );
+        return;
       }
       #endif
+    case 1 :
     default:
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glBlendColorEXT)(red, green, blue, alpha);
+      _next->call(&_next->glBindMultiTextureEXT)(texunit, target, texture);
       break;
     }
 
@@ -49092,13 +54293,7 @@ static void REGAL_CALL emu_glBlendColorEXT(GLclampf red, GLclampf green, GLclamp
 
 }
 
-// GL_EXT_blend_equation_separate
-
-// GL_EXT_blend_func_separate
-
-// GL_EXT_blend_minmax
-
-static void REGAL_CALL emu_glBlendEquationEXT(GLenum mode)
+static GLenum REGAL_CALL emu_glCheckNamedFramebufferStatusEXT(GLuint framebuffer, GLenum target)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -49120,12 +54315,10 @@ static void REGAL_CALL emu_glBlendEquationEXT(GLenum mode)
     case 6 :
     case 5 :
     case 4 :
-    case 3 :
-    case 2 :
-    case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt) break;
+      #if REGAL_EMU_DSA
+      if (_context->dsa) break;
       #endif
+    case 1 :
     default:
       break;
   }
@@ -49146,56 +54339,28 @@ static void REGAL_CALL emu_glBlendEquationEXT(GLenum mode)
     case 6 :
     case 5 :
     case 4 :
-    case 3 :
-    case 2 :
-    case 1 :
-      #if REGAL_EMU_FILTER
-      if (_context->filt)
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 0;
-        if (_context->isES2())
-        {
-          DispatchTableGL *_next = _context->dispatcher.emulation.next();
-          RegalAssert(_next);
-          _next->call(&_next->glBlendEquation)(mode);
-          return;
-        }
+        _context->emuLevel = 3;
+        _context->dsa->DsaFramebuffer( _context, GL_FRAMEBUFFER, framebuffer);
+        return _dispatch.call(&_dispatch.glCheckFramebufferStatus)( target );
       }
       #endif
+    case 1 :
     default:
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glBlendEquationEXT)(mode);
-      break;
+      return _next->call(&_next->glCheckNamedFramebufferStatusEXT)(framebuffer, target);
     }
 
   }
 
 }
 
-// GL_EXT_color_subtable
-
-// GL_EXT_compiled_vertex_array
-
-// GL_EXT_convolution
-
-// GL_EXT_coordinate_frame
-
-// GL_EXT_copy_texture
-
-// GL_EXT_cull_vertex
-
-// GL_EXT_debug_label
-
-// GL_EXT_debug_marker
-
-// GL_EXT_depth_bounds_test
-
-// GL_EXT_direct_state_access
-
-static void REGAL_CALL emu_glBindMultiTextureEXT(GLenum texunit, GLenum target, GLuint texture)
+static void REGAL_CALL emu_glClientAttribDefaultEXT(GLbitfield mask)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -49208,20 +54373,15 @@ static void REGAL_CALL emu_glBindMultiTextureEXT(GLenum texunit, GLenum target,
     case 15 :
     case 14 :
     case 13 :
+      #if REGAL_EMU_PPCA
+      if (_context->ppca) break;
+      #endif
     case 12 :
     case 11 :
     case 10 :
     case 9 :
     case 8 :
     case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 6;
-        _context->iff->ShadowMultiTexBinding( texunit, target, texture );
-      }
-      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -49240,6 +54400,15 @@ static void REGAL_CALL emu_glBindMultiTextureEXT(GLenum texunit, GLenum target,
     case 15 :
     case 14 :
     case 13 :
+      #if REGAL_EMU_PPCA
+      if (_context->ppca)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 12;
+        _context->ppca->glClientAttribDefaultEXT( *_context, mask );
+        return;
+      }
+      #endif
     case 12 :
     case 11 :
     case 10 :
@@ -49254,9 +54423,7 @@ static void REGAL_CALL emu_glBindMultiTextureEXT(GLenum texunit, GLenum target,
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
-        _context->dsa->DsaActiveTexture( _context, texunit );
-        _context->dsa->ShadowDsaTexture( target, texture );
-        _dispatch.call(&_dispatch.glBindTexture)( target, texture );
+        _context->dsa->ClientAttribDefault( _context, mask );
         return;
       }
       #endif
@@ -49265,7 +54432,7 @@ static void REGAL_CALL emu_glBindMultiTextureEXT(GLenum texunit, GLenum target,
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glBindMultiTextureEXT)(texunit, target, texture);
+      _next->call(&_next->glClientAttribDefaultEXT)(mask);
       break;
     }
 
@@ -49273,7 +54440,7 @@ static void REGAL_CALL emu_glBindMultiTextureEXT(GLenum texunit, GLenum target,
 
 }
 
-static GLenum REGAL_CALL emu_glCheckNamedFramebufferStatusEXT(GLuint framebuffer, GLenum target)
+static void REGAL_CALL emu_glCompressedMultiTexImage1DEXT(GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const GLvoid *data)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -49292,6 +54459,14 @@ static GLenum REGAL_CALL emu_glCheckNamedFramebufferStatusEXT(GLuint framebuffer
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -49324,8 +54499,9 @@ static GLenum REGAL_CALL emu_glCheckNamedFramebufferStatusEXT(GLuint framebuffer
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
-        _context->dsa->DsaFramebuffer( _context, GL_FRAMEBUFFER, framebuffer);
-        return _dispatch.call(&_dispatch.glCheckFramebufferStatus)( target );
+        _context->dsa->DsaActiveTexture( _context, texunit );
+        _dispatch.call(&_dispatch.glCompressedTexImage1D)( target, level, internalformat, width, border, imageSize, data );
+        return;
       }
       #endif
     case 1 :
@@ -49333,14 +54509,15 @@ static GLenum REGAL_CALL emu_glCheckNamedFramebufferStatusEXT(GLuint framebuffer
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      return _next->call(&_next->glCheckNamedFramebufferStatusEXT)(framebuffer, target);
+      _next->call(&_next->glCompressedMultiTexImage1DEXT)(texunit, target, level, internalformat, width, border, imageSize, data);
+      break;
     }
 
   }
 
 }
 
-static void REGAL_CALL emu_glClientAttribDefaultEXT(GLbitfield mask)
+static void REGAL_CALL emu_glCompressedMultiTexImage2DEXT(GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const GLvoid *bits)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -49353,15 +54530,20 @@ static void REGAL_CALL emu_glClientAttribDefaultEXT(GLbitfield mask)
     case 15 :
     case 14 :
     case 13 :
-      #if REGAL_EMU_PPCA
-      if (_context->ppca) break;
-      #endif
     case 12 :
     case 11 :
     case 10 :
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -49380,15 +54562,6 @@ static void REGAL_CALL emu_glClientAttribDefaultEXT(GLbitfield mask)
     case 15 :
     case 14 :
     case 13 :
-      #if REGAL_EMU_PPCA
-      if (_context->ppca)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 12;
-        _context->ppca->glClientAttribDefaultEXT( *_context, mask );
-        return;
-      }
-      #endif
     case 12 :
     case 11 :
     case 10 :
@@ -49403,7 +54576,8 @@ static void REGAL_CALL emu_glClientAttribDefaultEXT(GLbitfield mask)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
-        _context->dsa->ClientAttribDefault( _context, mask );
+        _context->dsa->DsaActiveTexture( _context, texunit );
+        _dispatch.call(&_dispatch.glCompressedTexImage2D)( target, level, internalformat, width, height, border, imageSize, bits );
         return;
       }
       #endif
@@ -49412,7 +54586,7 @@ static void REGAL_CALL emu_glClientAttribDefaultEXT(GLbitfield mask)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glClientAttribDefaultEXT)(mask);
+      _next->call(&_next->glCompressedMultiTexImage2DEXT)(texunit, target, level, internalformat, width, height, border, imageSize, bits);
       break;
     }
 
@@ -49420,7 +54594,7 @@ static void REGAL_CALL emu_glClientAttribDefaultEXT(GLbitfield mask)
 
 }
 
-static void REGAL_CALL emu_glCompressedMultiTexImage1DEXT(GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const GLvoid *data)
+static void REGAL_CALL emu_glCompressedMultiTexImage3DEXT(GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const GLvoid *bits)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -49439,6 +54613,14 @@ static void REGAL_CALL emu_glCompressedMultiTexImage1DEXT(GLenum texunit, GLenum
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -49472,7 +54654,7 @@ static void REGAL_CALL emu_glCompressedMultiTexImage1DEXT(GLenum texunit, GLenum
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaActiveTexture( _context, texunit );
-        _dispatch.call(&_dispatch.glCompressedTexImage1D)( target, level, internalformat, width, border, imageSize, data );
+        _dispatch.call(&_dispatch.glCompressedTexImage3D)( target, level, internalformat, width, height, depth, border, imageSize, bits );
         return;
       }
       #endif
@@ -49481,7 +54663,7 @@ static void REGAL_CALL emu_glCompressedMultiTexImage1DEXT(GLenum texunit, GLenum
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glCompressedMultiTexImage1DEXT)(texunit, target, level, internalformat, width, border, imageSize, data);
+      _next->call(&_next->glCompressedMultiTexImage3DEXT)(texunit, target, level, internalformat, width, height, depth, border, imageSize, bits);
       break;
     }
 
@@ -49489,7 +54671,7 @@ static void REGAL_CALL emu_glCompressedMultiTexImage1DEXT(GLenum texunit, GLenum
 
 }
 
-static void REGAL_CALL emu_glCompressedMultiTexImage2DEXT(GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const GLvoid *bits)
+static void REGAL_CALL emu_glCompressedMultiTexSubImage1DEXT(GLenum texunit, GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const GLvoid *data)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -49508,6 +54690,14 @@ static void REGAL_CALL emu_glCompressedMultiTexImage2DEXT(GLenum texunit, GLenum
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -49541,7 +54731,7 @@ static void REGAL_CALL emu_glCompressedMultiTexImage2DEXT(GLenum texunit, GLenum
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaActiveTexture( _context, texunit );
-        _dispatch.call(&_dispatch.glCompressedTexImage2D)( target, level, internalformat, width, height, border, imageSize, bits );
+        _dispatch.call(&_dispatch.glCompressedTexSubImage1D)( target, level, xoffset, width, format, imageSize, data );
         return;
       }
       #endif
@@ -49550,7 +54740,7 @@ static void REGAL_CALL emu_glCompressedMultiTexImage2DEXT(GLenum texunit, GLenum
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glCompressedMultiTexImage2DEXT)(texunit, target, level, internalformat, width, height, border, imageSize, bits);
+      _next->call(&_next->glCompressedMultiTexSubImage1DEXT)(texunit, target, level, xoffset, width, format, imageSize, data);
       break;
     }
 
@@ -49558,7 +54748,7 @@ static void REGAL_CALL emu_glCompressedMultiTexImage2DEXT(GLenum texunit, GLenum
 
 }
 
-static void REGAL_CALL emu_glCompressedMultiTexImage3DEXT(GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const GLvoid *bits)
+static void REGAL_CALL emu_glCompressedMultiTexSubImage2DEXT(GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const GLvoid *data)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -49577,6 +54767,14 @@ static void REGAL_CALL emu_glCompressedMultiTexImage3DEXT(GLenum texunit, GLenum
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -49610,7 +54808,7 @@ static void REGAL_CALL emu_glCompressedMultiTexImage3DEXT(GLenum texunit, GLenum
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaActiveTexture( _context, texunit );
-        _dispatch.call(&_dispatch.glCompressedTexImage3D)( target, level, internalformat, width, height, depth, border, imageSize, bits );
+        _dispatch.call(&_dispatch.glCompressedTexSubImage2D)( target, level, xoffset, yoffset, width, height, format, imageSize, data );
         return;
       }
       #endif
@@ -49619,7 +54817,7 @@ static void REGAL_CALL emu_glCompressedMultiTexImage3DEXT(GLenum texunit, GLenum
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glCompressedMultiTexImage3DEXT)(texunit, target, level, internalformat, width, height, depth, border, imageSize, bits);
+      _next->call(&_next->glCompressedMultiTexSubImage2DEXT)(texunit, target, level, xoffset, yoffset, width, height, format, imageSize, data);
       break;
     }
 
@@ -49627,7 +54825,7 @@ static void REGAL_CALL emu_glCompressedMultiTexImage3DEXT(GLenum texunit, GLenum
 
 }
 
-static void REGAL_CALL emu_glCompressedMultiTexSubImage1DEXT(GLenum texunit, GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const GLvoid *data)
+static void REGAL_CALL emu_glCompressedMultiTexSubImage3DEXT(GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const GLvoid *data)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -49646,75 +54844,14 @@ static void REGAL_CALL emu_glCompressedMultiTexSubImage1DEXT(GLenum texunit, GLe
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa) break;
-      #endif
-    case 1 :
-    default:
-      break;
-  }
-
-  // impl
-  switch( _context->emuLevel )
-  {
-    case 16 :
-    case 15 :
-    case 14 :
-    case 13 :
-    case 12 :
-    case 11 :
-    case 10 :
-    case 9 :
-    case 8 :
-    case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        _context->dsa->DsaActiveTexture( _context, texunit );
-        _dispatch.call(&_dispatch.glCompressedTexSubImage1D)( target, level, xoffset, width, format, imageSize, data );
-        return;
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
       }
       #endif
-    case 1 :
-    default:
-    {
-      DispatchTableGL *_next = _dispatch.next();
-      RegalAssert(_next);
-      _next->call(&_next->glCompressedMultiTexSubImage1DEXT)(texunit, target, level, xoffset, width, format, imageSize, data);
-      break;
-    }
-
-  }
-
-}
-
-static void REGAL_CALL emu_glCompressedMultiTexSubImage2DEXT(GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const GLvoid *data)
-{
-  RegalContext *_context = REGAL_GET_CONTEXT();
-  RegalAssert(_context);
-  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
-
-  // prefix
-  switch( _context->emuLevel )
-  {
-    case 16 :
-    case 15 :
-    case 14 :
-    case 13 :
-    case 12 :
-    case 11 :
-    case 10 :
-    case 9 :
-    case 8 :
-    case 7 :
     case 6 :
     case 5 :
     case 4 :
@@ -49748,7 +54885,7 @@ static void REGAL_CALL emu_glCompressedMultiTexSubImage2DEXT(GLenum texunit, GLe
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaActiveTexture( _context, texunit );
-        _dispatch.call(&_dispatch.glCompressedTexSubImage2D)( target, level, xoffset, yoffset, width, height, format, imageSize, data );
+        _dispatch.call(&_dispatch.glCompressedTexSubImage3D)( target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data );
         return;
       }
       #endif
@@ -49757,7 +54894,7 @@ static void REGAL_CALL emu_glCompressedMultiTexSubImage2DEXT(GLenum texunit, GLe
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glCompressedMultiTexSubImage2DEXT)(texunit, target, level, xoffset, yoffset, width, height, format, imageSize, data);
+      _next->call(&_next->glCompressedMultiTexSubImage3DEXT)(texunit, target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
       break;
     }
 
@@ -49765,7 +54902,7 @@ static void REGAL_CALL emu_glCompressedMultiTexSubImage2DEXT(GLenum texunit, GLe
 
 }
 
-static void REGAL_CALL emu_glCompressedMultiTexSubImage3DEXT(GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const GLvoid *data)
+static void REGAL_CALL emu_glCompressedTextureImage1DEXT(GLuint texture, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const GLvoid *bits)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -49784,75 +54921,14 @@ static void REGAL_CALL emu_glCompressedMultiTexSubImage3DEXT(GLenum texunit, GLe
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa) break;
-      #endif
-    case 1 :
-    default:
-      break;
-  }
-
-  // impl
-  switch( _context->emuLevel )
-  {
-    case 16 :
-    case 15 :
-    case 14 :
-    case 13 :
-    case 12 :
-    case 11 :
-    case 10 :
-    case 9 :
-    case 8 :
-    case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        _context->dsa->DsaActiveTexture( _context, texunit );
-        _dispatch.call(&_dispatch.glCompressedTexSubImage3D)( target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data );
-        return;
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
       }
       #endif
-    case 1 :
-    default:
-    {
-      DispatchTableGL *_next = _dispatch.next();
-      RegalAssert(_next);
-      _next->call(&_next->glCompressedMultiTexSubImage3DEXT)(texunit, target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
-      break;
-    }
-
-  }
-
-}
-
-static void REGAL_CALL emu_glCompressedTextureImage1DEXT(GLuint texture, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const GLvoid *bits)
-{
-  RegalContext *_context = REGAL_GET_CONTEXT();
-  RegalAssert(_context);
-  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
-
-  // prefix
-  switch( _context->emuLevel )
-  {
-    case 16 :
-    case 15 :
-    case 14 :
-    case 13 :
-    case 12 :
-    case 11 :
-    case 10 :
-    case 9 :
-    case 8 :
-    case 7 :
     case 6 :
     case 5 :
     case 4 :
@@ -49922,6 +54998,14 @@ static void REGAL_CALL emu_glCompressedTextureImage2DEXT(GLuint texture, GLenum
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -49991,6 +55075,14 @@ static void REGAL_CALL emu_glCompressedTextureImage3DEXT(GLuint texture, GLenum
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -50060,6 +55152,14 @@ static void REGAL_CALL emu_glCompressedTextureSubImage1DEXT(GLuint texture, GLen
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -50129,6 +55229,14 @@ static void REGAL_CALL emu_glCompressedTextureSubImage2DEXT(GLuint texture, GLen
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -50198,6 +55306,14 @@ static void REGAL_CALL emu_glCompressedTextureSubImage3DEXT(GLuint texture, GLen
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -50267,6 +55383,14 @@ static void REGAL_CALL emu_glCopyMultiTexImage1DEXT(GLenum texunit, GLenum targe
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -50336,6 +55460,14 @@ static void REGAL_CALL emu_glCopyMultiTexImage2DEXT(GLenum texunit, GLenum targe
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -50405,6 +55537,14 @@ static void REGAL_CALL emu_glCopyMultiTexSubImage1DEXT(GLenum texunit, GLenum ta
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -50474,6 +55614,14 @@ static void REGAL_CALL emu_glCopyMultiTexSubImage2DEXT(GLenum texunit, GLenum ta
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -50543,6 +55691,14 @@ static void REGAL_CALL emu_glCopyMultiTexSubImage3DEXT(GLenum texunit, GLenum ta
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -50612,6 +55768,14 @@ static void REGAL_CALL emu_glCopyTextureImage1DEXT(GLuint texture, GLenum target
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -50681,6 +55845,14 @@ static void REGAL_CALL emu_glCopyTextureImage2DEXT(GLuint texture, GLenum target
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -50750,6 +55922,14 @@ static void REGAL_CALL emu_glCopyTextureSubImage1DEXT(GLuint texture, GLenum tar
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -50819,6 +55999,14 @@ static void REGAL_CALL emu_glCopyTextureSubImage2DEXT(GLuint texture, GLenum tar
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -50888,6 +56076,14 @@ static void REGAL_CALL emu_glCopyTextureSubImage3DEXT(GLuint texture, GLenum tar
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -51653,6 +56849,15 @@ static void REGAL_CALL emu_glFlushMappedNamedBufferRangeEXT(GLuint buffer, GLint
       #if REGAL_EMU_DSA
       if (_context->dsa) break;
       #endif
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -51923,6 +57128,14 @@ static void REGAL_CALL emu_glGenerateMultiTexMipmapEXT(GLenum texunit, GLenum ta
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -51992,6 +57205,14 @@ static void REGAL_CALL emu_glGenerateTextureMipmapEXT(GLuint texture, GLenum tar
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -52061,12 +57282,29 @@ static void REGAL_CALL emu_glGetCompressedMultiTexImageEXT(GLenum texunit, GLenu
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
       #if REGAL_EMU_DSA
       if (_context->dsa) break;
       #endif
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -52130,12 +57368,29 @@ static void REGAL_CALL emu_glGetCompressedTextureImageEXT(GLuint texture, GLenum
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
       #if REGAL_EMU_DSA
       if (_context->dsa) break;
       #endif
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -52994,12 +58249,29 @@ static void REGAL_CALL emu_glGetMultiTexImageEXT(GLenum texunit, GLenum target,
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
       #if REGAL_EMU_DSA
       if (_context->dsa) break;
       #endif
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -54306,12 +59578,29 @@ static void REGAL_CALL emu_glGetTextureImageEXT(GLuint texture, GLenum target, G
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
       #if REGAL_EMU_DSA
       if (_context->dsa) break;
       #endif
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -54851,6 +60140,15 @@ static void *REGAL_CALL emu_glMapNamedBufferEXT(GLuint buffer, GLenum access)
       #if REGAL_EMU_DSA
       if (_context->dsa) break;
       #endif
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -54918,6 +60216,15 @@ static void *REGAL_CALL emu_glMapNamedBufferRangeEXT(GLuint buffer, GLintptr off
       #if REGAL_EMU_DSA
       if (_context->dsa) break;
       #endif
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->MapBufferRange( access );
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -55011,6 +60318,7 @@ static void REGAL_CALL emu_glMatrixFrustumEXT(GLenum mode, GLdouble left, GLdoub
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->MatrixFrustum( mode, left, right, bottom, top, zNear, zFar );
         return;
       }
@@ -55092,6 +60400,7 @@ static void REGAL_CALL emu_glMatrixLoadIdentityEXT(GLenum mode)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->MatrixLoadIdentity( mode );
         return;
       }
@@ -55173,6 +60482,7 @@ static void REGAL_CALL emu_glMatrixLoadTransposedEXT(GLenum mode, const GLdouble
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->MatrixLoadTranspose( mode, m );
         return;
       }
@@ -55254,6 +60564,7 @@ static void REGAL_CALL emu_glMatrixLoadTransposefEXT(GLenum mode, const GLfloat
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->MatrixLoadTranspose( mode, m );
         return;
       }
@@ -55335,6 +60646,7 @@ static void REGAL_CALL emu_glMatrixLoaddEXT(GLenum mode, const GLdouble *m)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->MatrixLoad( mode, m );
         return;
       }
@@ -55416,6 +60728,7 @@ static void REGAL_CALL emu_glMatrixLoadfEXT(GLenum mode, const GLfloat *m)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->MatrixLoad( mode, m );
         return;
       }
@@ -55497,6 +60810,7 @@ static void REGAL_CALL emu_glMatrixMultTransposedEXT(GLenum mode, const GLdouble
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->MatrixMultTranspose( mode, m );
         return;
       }
@@ -55578,6 +60892,7 @@ static void REGAL_CALL emu_glMatrixMultTransposefEXT(GLenum mode, const GLfloat
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->MatrixMultTranspose( mode, m );
         return;
       }
@@ -55659,6 +60974,7 @@ static void REGAL_CALL emu_glMatrixMultdEXT(GLenum mode, const GLdouble *m)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->MatrixMult( mode, m );
         return;
       }
@@ -55740,6 +61056,7 @@ static void REGAL_CALL emu_glMatrixMultfEXT(GLenum mode, const GLfloat *m)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->MatrixMult( mode, m );
         return;
       }
@@ -55821,6 +61138,7 @@ static void REGAL_CALL emu_glMatrixOrthoEXT(GLenum mode, GLdouble left, GLdouble
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->MatrixOrtho( mode, left, right, bottom, top, zNear, zFar );
         return;
       }
@@ -55902,6 +61220,7 @@ static void REGAL_CALL emu_glMatrixPopEXT(GLenum mode)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->MatrixPop( mode );
         return;
       }
@@ -55983,6 +61302,7 @@ static void REGAL_CALL emu_glMatrixPushEXT(GLenum mode)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->MatrixPush( mode );
         return;
       }
@@ -56064,6 +61384,7 @@ static void REGAL_CALL emu_glMatrixRotatedEXT(GLenum mode, GLdouble angle, GLdou
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->MatrixRotate( mode, angle, x, y, z );
         return;
       }
@@ -56145,6 +61466,7 @@ static void REGAL_CALL emu_glMatrixRotatefEXT(GLenum mode, GLfloat angle, GLfloa
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->MatrixRotate( mode, angle, x, y, z );
         return;
       }
@@ -56226,6 +61548,7 @@ static void REGAL_CALL emu_glMatrixScaledEXT(GLenum mode, GLdouble x, GLdouble y
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->MatrixScale( mode, x, y, z );
         return;
       }
@@ -56307,6 +61630,7 @@ static void REGAL_CALL emu_glMatrixScalefEXT(GLenum mode, GLfloat x, GLfloat y,
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->MatrixScale( mode, x, y, z );
         return;
       }
@@ -56388,6 +61712,7 @@ static void REGAL_CALL emu_glMatrixTranslatedEXT(GLenum mode, GLdouble x, GLdoub
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->MatrixTranslate( mode, x, y, z );
         return;
       }
@@ -56469,6 +61794,7 @@ static void REGAL_CALL emu_glMatrixTranslatefEXT(GLenum mode, GLfloat x, GLfloat
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->MatrixTranslate( mode, x, y, z );
         return;
       }
@@ -56518,6 +61844,14 @@ static void REGAL_CALL emu_glMultiTexBufferEXT(GLenum texunit, GLenum target, GL
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -56712,6 +62046,7 @@ static void REGAL_CALL emu_glMultiTexEnvfEXT(GLenum texunit, GLenum target, GLen
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->TexEnv( texunit, target, pname, param );
         return;
       }
@@ -56801,6 +62136,7 @@ static void REGAL_CALL emu_glMultiTexEnvfvEXT(GLenum texunit, GLenum target, GLe
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->TexEnv( texunit, target, pname, params );
         return;
       }
@@ -56885,15 +62221,175 @@ static void REGAL_CALL emu_glMultiTexEnviEXT(GLenum texunit, GLenum target, GLen
     case 9 :
     case 8 :
     case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 6;
-        _context->iff->TexEnv( texunit, target, pname, param );
-        return;
-      }
-      #endif
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+        _context->iff->TexEnv( texunit, target, pname, param );
+        return;
+      }
+      #endif
+    case 6 :
+    case 5 :
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 3;
+        _context->dsa->DsaActiveTexture( _context, texunit );
+        _dispatch.call(&_dispatch.glTexEnvi)( target, pname, param );
+        return;
+      }
+      #endif
+    case 1 :
+    default:
+    {
+      DispatchTableGL *_next = _dispatch.next();
+      RegalAssert(_next);
+      _next->call(&_next->glMultiTexEnviEXT)(texunit, target, pname, param);
+      break;
+    }
+
+  }
+
+}
+
+static void REGAL_CALL emu_glMultiTexEnvivEXT(GLenum texunit, GLenum target, GLenum pname, const GLint *params)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+      #if REGAL_EMU_PPA
+      if (_context->ppa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 13;
+        _context->ppa->glMultiTexEnvv( texunit, target, pname, params );
+      }
+      #endif
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff) break;
+      #endif
+    case 6 :
+    case 5 :
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa) break;
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  // impl
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+        _context->iff->TexEnv( texunit, target, pname, params );
+        return;
+      }
+      #endif
+    case 6 :
+    case 5 :
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 3;
+        _context->dsa->DsaActiveTexture( _context, texunit );
+        _dispatch.call(&_dispatch.glTexEnviv)( target, pname, params );
+        return;
+      }
+      #endif
+    case 1 :
+    default:
+    {
+      DispatchTableGL *_next = _dispatch.next();
+      RegalAssert(_next);
+      _next->call(&_next->glMultiTexEnvivEXT)(texunit, target, pname, params);
+      break;
+    }
+
+  }
+
+}
+
+static void REGAL_CALL emu_glMultiTexGendEXT(GLenum texunit, GLenum coord, GLenum pname, GLdouble param)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa) break;
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  // impl
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
     case 6 :
     case 5 :
     case 4 :
@@ -56903,7 +62399,7 @@ static void REGAL_CALL emu_glMultiTexEnviEXT(GLenum texunit, GLenum target, GLen
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaActiveTexture( _context, texunit );
-        _dispatch.call(&_dispatch.glTexEnvi)( target, pname, param );
+        _dispatch.call(&_dispatch.glTexGend)( coord, pname, param );
         return;
       }
       #endif
@@ -56912,7 +62408,7 @@ static void REGAL_CALL emu_glMultiTexEnviEXT(GLenum texunit, GLenum target, GLen
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexEnviEXT)(texunit, target, pname, param);
+      _next->call(&_next->glMultiTexGendEXT)(texunit, coord, pname, param);
       break;
     }
 
@@ -56920,7 +62416,7 @@ static void REGAL_CALL emu_glMultiTexEnviEXT(GLenum texunit, GLenum target, GLen
 
 }
 
-static void REGAL_CALL emu_glMultiTexEnvivEXT(GLenum texunit, GLenum target, GLenum pname, const GLint *params)
+static void REGAL_CALL emu_glMultiTexGendvEXT(GLenum texunit, GLenum coord, GLenum pname, const GLdouble *params)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -56932,14 +62428,6 @@ static void REGAL_CALL emu_glMultiTexEnvivEXT(GLenum texunit, GLenum target, GLe
     case 16 :
     case 15 :
     case 14 :
-      #if REGAL_EMU_PPA
-      if (_context->ppa)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 13;
-        _context->ppa->glMultiTexEnvv( texunit, target, pname, params );
-      }
-      #endif
     case 13 :
     case 12 :
     case 11 :
@@ -56947,9 +62435,6 @@ static void REGAL_CALL emu_glMultiTexEnvivEXT(GLenum texunit, GLenum target, GLe
     case 9 :
     case 8 :
     case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff) break;
-      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -56974,15 +62459,6 @@ static void REGAL_CALL emu_glMultiTexEnvivEXT(GLenum texunit, GLenum target, GLe
     case 9 :
     case 8 :
     case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 6;
-        _context->iff->TexEnv( texunit, target, pname, params );
-        return;
-      }
-      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -56992,7 +62468,7 @@ static void REGAL_CALL emu_glMultiTexEnvivEXT(GLenum texunit, GLenum target, GLe
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaActiveTexture( _context, texunit );
-        _dispatch.call(&_dispatch.glTexEnviv)( target, pname, params );
+        _dispatch.call(&_dispatch.glTexGendv)( coord, pname, params );
         return;
       }
       #endif
@@ -57001,7 +62477,7 @@ static void REGAL_CALL emu_glMultiTexEnvivEXT(GLenum texunit, GLenum target, GLe
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexEnvivEXT)(texunit, target, pname, params);
+      _next->call(&_next->glMultiTexGendvEXT)(texunit, coord, pname, params);
       break;
     }
 
@@ -57009,7 +62485,7 @@ static void REGAL_CALL emu_glMultiTexEnvivEXT(GLenum texunit, GLenum target, GLe
 
 }
 
-static void REGAL_CALL emu_glMultiTexGendEXT(GLenum texunit, GLenum coord, GLenum pname, GLdouble param)
+static void REGAL_CALL emu_glMultiTexGenfEXT(GLenum texunit, GLenum coord, GLenum pname, GLfloat param)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -57061,7 +62537,7 @@ static void REGAL_CALL emu_glMultiTexGendEXT(GLenum texunit, GLenum coord, GLenu
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaActiveTexture( _context, texunit );
-        _dispatch.call(&_dispatch.glTexGend)( coord, pname, param );
+        _dispatch.call(&_dispatch.glTexGenf)( coord, pname, param );
         return;
       }
       #endif
@@ -57070,7 +62546,7 @@ static void REGAL_CALL emu_glMultiTexGendEXT(GLenum texunit, GLenum coord, GLenu
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexGendEXT)(texunit, coord, pname, param);
+      _next->call(&_next->glMultiTexGenfEXT)(texunit, coord, pname, param);
       break;
     }
 
@@ -57078,7 +62554,7 @@ static void REGAL_CALL emu_glMultiTexGendEXT(GLenum texunit, GLenum coord, GLenu
 
 }
 
-static void REGAL_CALL emu_glMultiTexGendvEXT(GLenum texunit, GLenum coord, GLenum pname, const GLdouble *params)
+static void REGAL_CALL emu_glMultiTexGenfvEXT(GLenum texunit, GLenum coord, GLenum pname, const GLfloat *params)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -57130,7 +62606,7 @@ static void REGAL_CALL emu_glMultiTexGendvEXT(GLenum texunit, GLenum coord, GLen
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaActiveTexture( _context, texunit );
-        _dispatch.call(&_dispatch.glTexGendv)( coord, pname, params );
+        _dispatch.call(&_dispatch.glTexGenfv)( coord, pname, params );
         return;
       }
       #endif
@@ -57139,7 +62615,7 @@ static void REGAL_CALL emu_glMultiTexGendvEXT(GLenum texunit, GLenum coord, GLen
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexGendvEXT)(texunit, coord, pname, params);
+      _next->call(&_next->glMultiTexGenfvEXT)(texunit, coord, pname, params);
       break;
     }
 
@@ -57147,7 +62623,7 @@ static void REGAL_CALL emu_glMultiTexGendvEXT(GLenum texunit, GLenum coord, GLen
 
 }
 
-static void REGAL_CALL emu_glMultiTexGenfEXT(GLenum texunit, GLenum coord, GLenum pname, GLfloat param)
+static void REGAL_CALL emu_glMultiTexGeniEXT(GLenum texunit, GLenum coord, GLenum pname, GLint param)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -57199,7 +62675,7 @@ static void REGAL_CALL emu_glMultiTexGenfEXT(GLenum texunit, GLenum coord, GLenu
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaActiveTexture( _context, texunit );
-        _dispatch.call(&_dispatch.glTexGenf)( coord, pname, param );
+        _dispatch.call(&_dispatch.glTexGeni)( coord, pname, param );
         return;
       }
       #endif
@@ -57208,7 +62684,7 @@ static void REGAL_CALL emu_glMultiTexGenfEXT(GLenum texunit, GLenum coord, GLenu
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexGenfEXT)(texunit, coord, pname, param);
+      _next->call(&_next->glMultiTexGeniEXT)(texunit, coord, pname, param);
       break;
     }
 
@@ -57216,7 +62692,7 @@ static void REGAL_CALL emu_glMultiTexGenfEXT(GLenum texunit, GLenum coord, GLenu
 
 }
 
-static void REGAL_CALL emu_glMultiTexGenfvEXT(GLenum texunit, GLenum coord, GLenum pname, const GLfloat *params)
+static void REGAL_CALL emu_glMultiTexGenivEXT(GLenum texunit, GLenum coord, GLenum pname, const GLint *params)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -57268,7 +62744,7 @@ static void REGAL_CALL emu_glMultiTexGenfvEXT(GLenum texunit, GLenum coord, GLen
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaActiveTexture( _context, texunit );
-        _dispatch.call(&_dispatch.glTexGenfv)( coord, pname, params );
+        _dispatch.call(&_dispatch.glTexGeniv)( coord, pname, params );
         return;
       }
       #endif
@@ -57277,7 +62753,7 @@ static void REGAL_CALL emu_glMultiTexGenfvEXT(GLenum texunit, GLenum coord, GLen
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexGenfvEXT)(texunit, coord, pname, params);
+      _next->call(&_next->glMultiTexGenivEXT)(texunit, coord, pname, params);
       break;
     }
 
@@ -57285,7 +62761,7 @@ static void REGAL_CALL emu_glMultiTexGenfvEXT(GLenum texunit, GLenum coord, GLen
 
 }
 
-static void REGAL_CALL emu_glMultiTexGeniEXT(GLenum texunit, GLenum coord, GLenum pname, GLint param)
+static void REGAL_CALL emu_glMultiTexImage1DEXT(GLenum texunit, GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const GLvoid *pixels)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -57304,75 +62780,15 @@ static void REGAL_CALL emu_glMultiTexGeniEXT(GLenum texunit, GLenum coord, GLenu
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa) break;
-      #endif
-    case 1 :
-    default:
-      break;
-  }
-
-  // impl
-  switch( _context->emuLevel )
-  {
-    case 16 :
-    case 15 :
-    case 14 :
-    case 13 :
-    case 12 :
-    case 11 :
-    case 10 :
-    case 9 :
-    case 8 :
-    case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        _context->dsa->DsaActiveTexture( _context, texunit );
-        _dispatch.call(&_dispatch.glTexGeni)( coord, pname, param );
-        return;
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+        _context->iff->ShadowMultiTexInfo( texunit, target, internalformat );
       }
       #endif
-    case 1 :
-    default:
-    {
-      DispatchTableGL *_next = _dispatch.next();
-      RegalAssert(_next);
-      _next->call(&_next->glMultiTexGeniEXT)(texunit, coord, pname, param);
-      break;
-    }
-
-  }
-
-}
-
-static void REGAL_CALL emu_glMultiTexGenivEXT(GLenum texunit, GLenum coord, GLenum pname, const GLint *params)
-{
-  RegalContext *_context = REGAL_GET_CONTEXT();
-  RegalAssert(_context);
-  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
-
-  // prefix
-  switch( _context->emuLevel )
-  {
-    case 16 :
-    case 15 :
-    case 14 :
-    case 13 :
-    case 12 :
-    case 11 :
-    case 10 :
-    case 9 :
-    case 8 :
-    case 7 :
     case 6 :
     case 5 :
     case 4 :
@@ -57406,7 +62822,7 @@ static void REGAL_CALL emu_glMultiTexGenivEXT(GLenum texunit, GLenum coord, GLen
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaActiveTexture( _context, texunit );
-        _dispatch.call(&_dispatch.glTexGeniv)( coord, pname, params );
+        _dispatch.call(&_dispatch.glTexImage1D)( target, level, internalformat, width, border, format, type, pixels );
         return;
       }
       #endif
@@ -57415,7 +62831,7 @@ static void REGAL_CALL emu_glMultiTexGenivEXT(GLenum texunit, GLenum coord, GLen
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexGenivEXT)(texunit, coord, pname, params);
+      _next->call(&_next->glMultiTexImage1DEXT)(texunit, target, level, internalformat, width, border, format, type, pixels);
       break;
     }
 
@@ -57423,7 +62839,7 @@ static void REGAL_CALL emu_glMultiTexGenivEXT(GLenum texunit, GLenum coord, GLen
 
 }
 
-static void REGAL_CALL emu_glMultiTexImage1DEXT(GLenum texunit, GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const GLvoid *pixels)
+static void REGAL_CALL emu_glMultiTexImage2DEXT(GLenum texunit, GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const GLvoid *pixels)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -57447,6 +62863,7 @@ static void REGAL_CALL emu_glMultiTexImage1DEXT(GLenum texunit, GLenum target, G
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->ShadowMultiTexInfo( texunit, target, internalformat );
       }
       #endif
@@ -57483,7 +62900,7 @@ static void REGAL_CALL emu_glMultiTexImage1DEXT(GLenum texunit, GLenum target, G
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaActiveTexture( _context, texunit );
-        _dispatch.call(&_dispatch.glTexImage1D)( target, level, internalformat, width, border, format, type, pixels );
+        _dispatch.call(&_dispatch.glTexImage2D)( target, level, internalformat, width, height, border, format, type, pixels );
         return;
       }
       #endif
@@ -57492,7 +62909,7 @@ static void REGAL_CALL emu_glMultiTexImage1DEXT(GLenum texunit, GLenum target, G
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexImage1DEXT)(texunit, target, level, internalformat, width, border, format, type, pixels);
+      _next->call(&_next->glMultiTexImage2DEXT)(texunit, target, level, internalformat, width, height, border, format, type, pixels);
       break;
     }
 
@@ -57500,7 +62917,7 @@ static void REGAL_CALL emu_glMultiTexImage1DEXT(GLenum texunit, GLenum target, G
 
 }
 
-static void REGAL_CALL emu_glMultiTexImage2DEXT(GLenum texunit, GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const GLvoid *pixels)
+static void REGAL_CALL emu_glMultiTexImage3DEXT(GLenum texunit, GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const GLvoid *pixels)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -57524,6 +62941,7 @@ static void REGAL_CALL emu_glMultiTexImage2DEXT(GLenum texunit, GLenum target, G
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->ShadowMultiTexInfo( texunit, target, internalformat );
       }
       #endif
@@ -57560,7 +62978,7 @@ static void REGAL_CALL emu_glMultiTexImage2DEXT(GLenum texunit, GLenum target, G
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaActiveTexture( _context, texunit );
-        _dispatch.call(&_dispatch.glTexImage2D)( target, level, internalformat, width, height, border, format, type, pixels );
+        _dispatch.call(&_dispatch.glTexImage3D)( target, level, internalformat, width, height, depth, border, format, type, pixels );
         return;
       }
       #endif
@@ -57569,7 +62987,7 @@ static void REGAL_CALL emu_glMultiTexImage2DEXT(GLenum texunit, GLenum target, G
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexImage2DEXT)(texunit, target, level, internalformat, width, height, border, format, type, pixels);
+      _next->call(&_next->glMultiTexImage3DEXT)(texunit, target, level, internalformat, width, height, depth, border, format, type, pixels);
       break;
     }
 
@@ -57577,7 +62995,7 @@ static void REGAL_CALL emu_glMultiTexImage2DEXT(GLenum texunit, GLenum target, G
 
 }
 
-static void REGAL_CALL emu_glMultiTexImage3DEXT(GLenum texunit, GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const GLvoid *pixels)
+static void REGAL_CALL emu_glMultiTexParameterIivEXT(GLenum texunit, GLenum target, GLenum pname, const GLint *params)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -57601,7 +63019,7 @@ static void REGAL_CALL emu_glMultiTexImage3DEXT(GLenum texunit, GLenum target, G
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->ShadowMultiTexInfo( texunit, target, internalformat );
+        _context->iff->FlushBatch( _context );
       }
       #endif
     case 6 :
@@ -57637,7 +63055,7 @@ static void REGAL_CALL emu_glMultiTexImage3DEXT(GLenum texunit, GLenum target, G
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaActiveTexture( _context, texunit );
-        _dispatch.call(&_dispatch.glTexImage3D)( target, level, internalformat, width, height, depth, border, format, type, pixels );
+        _dispatch.call(&_dispatch.glTexParameterIiv)( target, pname, params );
         return;
       }
       #endif
@@ -57646,7 +63064,7 @@ static void REGAL_CALL emu_glMultiTexImage3DEXT(GLenum texunit, GLenum target, G
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexImage3DEXT)(texunit, target, level, internalformat, width, height, depth, border, format, type, pixels);
+      _next->call(&_next->glMultiTexParameterIivEXT)(texunit, target, pname, params);
       break;
     }
 
@@ -57654,7 +63072,7 @@ static void REGAL_CALL emu_glMultiTexImage3DEXT(GLenum texunit, GLenum target, G
 
 }
 
-static void REGAL_CALL emu_glMultiTexParameterIivEXT(GLenum texunit, GLenum target, GLenum pname, const GLint *params)
+static void REGAL_CALL emu_glMultiTexParameterIuivEXT(GLenum texunit, GLenum target, GLenum pname, const GLuint *params)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -57673,6 +63091,14 @@ static void REGAL_CALL emu_glMultiTexParameterIivEXT(GLenum texunit, GLenum targ
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -57706,7 +63132,7 @@ static void REGAL_CALL emu_glMultiTexParameterIivEXT(GLenum texunit, GLenum targ
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaActiveTexture( _context, texunit );
-        _dispatch.call(&_dispatch.glTexParameterIiv)( target, pname, params );
+        _dispatch.call(&_dispatch.glTexParameterIuiv)( target, pname, params );
         return;
       }
       #endif
@@ -57715,7 +63141,7 @@ static void REGAL_CALL emu_glMultiTexParameterIivEXT(GLenum texunit, GLenum targ
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexParameterIivEXT)(texunit, target, pname, params);
+      _next->call(&_next->glMultiTexParameterIuivEXT)(texunit, target, pname, params);
       break;
     }
 
@@ -57723,7 +63149,7 @@ static void REGAL_CALL emu_glMultiTexParameterIivEXT(GLenum texunit, GLenum targ
 
 }
 
-static void REGAL_CALL emu_glMultiTexParameterIuivEXT(GLenum texunit, GLenum target, GLenum pname, const GLuint *params)
+static void REGAL_CALL emu_glMultiTexParameterfEXT(GLenum texunit, GLenum target, GLenum pname, GLfloat param)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -57742,6 +63168,14 @@ static void REGAL_CALL emu_glMultiTexParameterIuivEXT(GLenum texunit, GLenum tar
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -57775,7 +63209,7 @@ static void REGAL_CALL emu_glMultiTexParameterIuivEXT(GLenum texunit, GLenum tar
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaActiveTexture( _context, texunit );
-        _dispatch.call(&_dispatch.glTexParameterIuiv)( target, pname, params );
+        _dispatch.call(&_dispatch.glTexParameterf)( target, pname, param );
         return;
       }
       #endif
@@ -57784,7 +63218,7 @@ static void REGAL_CALL emu_glMultiTexParameterIuivEXT(GLenum texunit, GLenum tar
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexParameterIuivEXT)(texunit, target, pname, params);
+      _next->call(&_next->glMultiTexParameterfEXT)(texunit, target, pname, param);
       break;
     }
 
@@ -57792,7 +63226,7 @@ static void REGAL_CALL emu_glMultiTexParameterIuivEXT(GLenum texunit, GLenum tar
 
 }
 
-static void REGAL_CALL emu_glMultiTexParameterfEXT(GLenum texunit, GLenum target, GLenum pname, GLfloat param)
+static void REGAL_CALL emu_glMultiTexParameterfvEXT(GLenum texunit, GLenum target, GLenum pname, const GLfloat *params)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -57811,6 +63245,14 @@ static void REGAL_CALL emu_glMultiTexParameterfEXT(GLenum texunit, GLenum target
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -57844,7 +63286,7 @@ static void REGAL_CALL emu_glMultiTexParameterfEXT(GLenum texunit, GLenum target
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaActiveTexture( _context, texunit );
-        _dispatch.call(&_dispatch.glTexParameterf)( target, pname, param );
+        _dispatch.call(&_dispatch.glTexParameterfv)( target, pname, params );
         return;
       }
       #endif
@@ -57853,7 +63295,7 @@ static void REGAL_CALL emu_glMultiTexParameterfEXT(GLenum texunit, GLenum target
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexParameterfEXT)(texunit, target, pname, param);
+      _next->call(&_next->glMultiTexParameterfvEXT)(texunit, target, pname, params);
       break;
     }
 
@@ -57861,7 +63303,7 @@ static void REGAL_CALL emu_glMultiTexParameterfEXT(GLenum texunit, GLenum target
 
 }
 
-static void REGAL_CALL emu_glMultiTexParameterfvEXT(GLenum texunit, GLenum target, GLenum pname, const GLfloat *params)
+static void REGAL_CALL emu_glMultiTexParameteriEXT(GLenum texunit, GLenum target, GLenum pname, GLint param)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -57880,6 +63322,14 @@ static void REGAL_CALL emu_glMultiTexParameterfvEXT(GLenum texunit, GLenum targe
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -57913,7 +63363,7 @@ static void REGAL_CALL emu_glMultiTexParameterfvEXT(GLenum texunit, GLenum targe
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaActiveTexture( _context, texunit );
-        _dispatch.call(&_dispatch.glTexParameterfv)( target, pname, params );
+        _dispatch.call(&_dispatch.glTexParameteri)( target, pname, param );
         return;
       }
       #endif
@@ -57922,7 +63372,7 @@ static void REGAL_CALL emu_glMultiTexParameterfvEXT(GLenum texunit, GLenum targe
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexParameterfvEXT)(texunit, target, pname, params);
+      _next->call(&_next->glMultiTexParameteriEXT)(texunit, target, pname, param);
       break;
     }
 
@@ -57930,7 +63380,7 @@ static void REGAL_CALL emu_glMultiTexParameterfvEXT(GLenum texunit, GLenum targe
 
 }
 
-static void REGAL_CALL emu_glMultiTexParameteriEXT(GLenum texunit, GLenum target, GLenum pname, GLint param)
+static void REGAL_CALL emu_glMultiTexParameterivEXT(GLenum texunit, GLenum target, GLenum pname, const GLint *params)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -57949,6 +63399,14 @@ static void REGAL_CALL emu_glMultiTexParameteriEXT(GLenum texunit, GLenum target
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -57982,7 +63440,7 @@ static void REGAL_CALL emu_glMultiTexParameteriEXT(GLenum texunit, GLenum target
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaActiveTexture( _context, texunit );
-        _dispatch.call(&_dispatch.glTexParameteri)( target, pname, param );
+        _dispatch.call(&_dispatch.glTexParameteriv)( target, pname, params );
         return;
       }
       #endif
@@ -57991,7 +63449,7 @@ static void REGAL_CALL emu_glMultiTexParameteriEXT(GLenum texunit, GLenum target
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexParameteriEXT)(texunit, target, pname, param);
+      _next->call(&_next->glMultiTexParameterivEXT)(texunit, target, pname, params);
       break;
     }
 
@@ -57999,7 +63457,7 @@ static void REGAL_CALL emu_glMultiTexParameteriEXT(GLenum texunit, GLenum target
 
 }
 
-static void REGAL_CALL emu_glMultiTexParameterivEXT(GLenum texunit, GLenum target, GLenum pname, const GLint *params)
+static void REGAL_CALL emu_glMultiTexRenderbufferEXT(GLenum texunit, GLenum target, GLuint renderbuffer)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -58018,6 +63476,14 @@ static void REGAL_CALL emu_glMultiTexParameterivEXT(GLenum texunit, GLenum targe
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -58051,7 +63517,7 @@ static void REGAL_CALL emu_glMultiTexParameterivEXT(GLenum texunit, GLenum targe
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaActiveTexture( _context, texunit );
-        _dispatch.call(&_dispatch.glTexParameteriv)( target, pname, params );
+        _dispatch.call(&_dispatch.glTexRenderbufferNV)( target, renderbuffer );
         return;
       }
       #endif
@@ -58060,7 +63526,7 @@ static void REGAL_CALL emu_glMultiTexParameterivEXT(GLenum texunit, GLenum targe
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexParameterivEXT)(texunit, target, pname, params);
+      _next->call(&_next->glMultiTexRenderbufferEXT)(texunit, target, renderbuffer);
       break;
     }
 
@@ -58068,7 +63534,7 @@ static void REGAL_CALL emu_glMultiTexParameterivEXT(GLenum texunit, GLenum targe
 
 }
 
-static void REGAL_CALL emu_glMultiTexRenderbufferEXT(GLenum texunit, GLenum target, GLuint renderbuffer)
+static void REGAL_CALL emu_glMultiTexSubImage1DEXT(GLenum texunit, GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const GLvoid *pixels)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -58087,6 +63553,14 @@ static void REGAL_CALL emu_glMultiTexRenderbufferEXT(GLenum texunit, GLenum targ
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -58120,7 +63594,7 @@ static void REGAL_CALL emu_glMultiTexRenderbufferEXT(GLenum texunit, GLenum targ
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaActiveTexture( _context, texunit );
-        _dispatch.call(&_dispatch.glTexRenderbufferNV)( target, renderbuffer );
+        _dispatch.call(&_dispatch.glTexSubImage1D)( target, level, xoffset, width, format, type, pixels );
         return;
       }
       #endif
@@ -58129,7 +63603,7 @@ static void REGAL_CALL emu_glMultiTexRenderbufferEXT(GLenum texunit, GLenum targ
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexRenderbufferEXT)(texunit, target, renderbuffer);
+      _next->call(&_next->glMultiTexSubImage1DEXT)(texunit, target, level, xoffset, width, format, type, pixels);
       break;
     }
 
@@ -58137,7 +63611,7 @@ static void REGAL_CALL emu_glMultiTexRenderbufferEXT(GLenum texunit, GLenum targ
 
 }
 
-static void REGAL_CALL emu_glMultiTexSubImage1DEXT(GLenum texunit, GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const GLvoid *pixels)
+static void REGAL_CALL emu_glMultiTexSubImage2DEXT(GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid *pixels)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -58156,6 +63630,14 @@ static void REGAL_CALL emu_glMultiTexSubImage1DEXT(GLenum texunit, GLenum target
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -58189,7 +63671,7 @@ static void REGAL_CALL emu_glMultiTexSubImage1DEXT(GLenum texunit, GLenum target
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaActiveTexture( _context, texunit );
-        _dispatch.call(&_dispatch.glTexSubImage1D)( target, level, xoffset, width, format, type, pixels );
+        _dispatch.call(&_dispatch.glTexSubImage2D)( target, level, xoffset, yoffset, width, height, format, type, pixels );
         return;
       }
       #endif
@@ -58198,7 +63680,7 @@ static void REGAL_CALL emu_glMultiTexSubImage1DEXT(GLenum texunit, GLenum target
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexSubImage1DEXT)(texunit, target, level, xoffset, width, format, type, pixels);
+      _next->call(&_next->glMultiTexSubImage2DEXT)(texunit, target, level, xoffset, yoffset, width, height, format, type, pixels);
       break;
     }
 
@@ -58206,7 +63688,7 @@ static void REGAL_CALL emu_glMultiTexSubImage1DEXT(GLenum texunit, GLenum target
 
 }
 
-static void REGAL_CALL emu_glMultiTexSubImage2DEXT(GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid *pixels)
+static void REGAL_CALL emu_glMultiTexSubImage3DEXT(GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const GLvoid *pixels)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -58225,6 +63707,14 @@ static void REGAL_CALL emu_glMultiTexSubImage2DEXT(GLenum texunit, GLenum target
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -58258,7 +63748,7 @@ static void REGAL_CALL emu_glMultiTexSubImage2DEXT(GLenum texunit, GLenum target
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaActiveTexture( _context, texunit );
-        _dispatch.call(&_dispatch.glTexSubImage2D)( target, level, xoffset, yoffset, width, height, format, type, pixels );
+        _dispatch.call(&_dispatch.glTexSubImage3D)( target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels );
         return;
       }
       #endif
@@ -58267,7 +63757,7 @@ static void REGAL_CALL emu_glMultiTexSubImage2DEXT(GLenum texunit, GLenum target
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexSubImage2DEXT)(texunit, target, level, xoffset, yoffset, width, height, format, type, pixels);
+      _next->call(&_next->glMultiTexSubImage3DEXT)(texunit, target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
       break;
     }
 
@@ -58275,7 +63765,7 @@ static void REGAL_CALL emu_glMultiTexSubImage2DEXT(GLenum texunit, GLenum target
 
 }
 
-static void REGAL_CALL emu_glMultiTexSubImage3DEXT(GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const GLvoid *pixels)
+static void REGAL_CALL emu_glNamedBufferDataEXT(GLuint buffer, GLsizeiptr size, const GLvoid *data, GLenum usage)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -58300,6 +63790,15 @@ static void REGAL_CALL emu_glMultiTexSubImage3DEXT(GLenum texunit, GLenum target
       #if REGAL_EMU_DSA
       if (_context->dsa) break;
       #endif
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -58326,8 +63825,8 @@ static void REGAL_CALL emu_glMultiTexSubImage3DEXT(GLenum texunit, GLenum target
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
-        _context->dsa->DsaActiveTexture( _context, texunit );
-        _dispatch.call(&_dispatch.glTexSubImage3D)( target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels );
+        _context->dsa->DsaBuffer( _context, buffer);
+        _dispatch.call(&_dispatch.glBufferData)( GL_ARRAY_BUFFER, size, data, usage );
         return;
       }
       #endif
@@ -58336,7 +63835,7 @@ static void REGAL_CALL emu_glMultiTexSubImage3DEXT(GLenum texunit, GLenum target
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glMultiTexSubImage3DEXT)(texunit, target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+      _next->call(&_next->glNamedBufferDataEXT)(buffer, size, data, usage);
       break;
     }
 
@@ -58344,7 +63843,7 @@ static void REGAL_CALL emu_glMultiTexSubImage3DEXT(GLenum texunit, GLenum target
 
 }
 
-static void REGAL_CALL emu_glNamedBufferDataEXT(GLuint buffer, GLsizeiptr size, const GLvoid *data, GLenum usage)
+static void REGAL_CALL emu_glNamedBufferSubDataEXT(GLuint buffer, GLintptr offset, GLsizeiptr size, const GLvoid *data)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -58369,6 +63868,15 @@ static void REGAL_CALL emu_glNamedBufferDataEXT(GLuint buffer, GLsizeiptr size,
       #if REGAL_EMU_DSA
       if (_context->dsa) break;
       #endif
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -58396,7 +63904,7 @@ static void REGAL_CALL emu_glNamedBufferDataEXT(GLuint buffer, GLsizeiptr size,
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaBuffer( _context, buffer);
-        _dispatch.call(&_dispatch.glBufferData)( GL_ARRAY_BUFFER, size, data, usage );
+        _dispatch.call(&_dispatch.glBufferSubData)( GL_ARRAY_BUFFER, offset, size, data );
         return;
       }
       #endif
@@ -58405,7 +63913,7 @@ static void REGAL_CALL emu_glNamedBufferDataEXT(GLuint buffer, GLsizeiptr size,
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glNamedBufferDataEXT)(buffer, size, data, usage);
+      _next->call(&_next->glNamedBufferSubDataEXT)(buffer, offset, size, data);
       break;
     }
 
@@ -58413,7 +63921,7 @@ static void REGAL_CALL emu_glNamedBufferDataEXT(GLuint buffer, GLsizeiptr size,
 
 }
 
-static void REGAL_CALL emu_glNamedBufferSubDataEXT(GLuint buffer, GLintptr offset, GLsizeiptr size, const GLvoid *data)
+static void REGAL_CALL emu_glNamedCopyBufferSubDataEXT(GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -58438,6 +63946,15 @@ static void REGAL_CALL emu_glNamedBufferSubDataEXT(GLuint buffer, GLintptr offse
       #if REGAL_EMU_DSA
       if (_context->dsa) break;
       #endif
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -58464,8 +63981,8 @@ static void REGAL_CALL emu_glNamedBufferSubDataEXT(GLuint buffer, GLintptr offse
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
-        _context->dsa->DsaBuffer( _context, buffer);
-        _dispatch.call(&_dispatch.glBufferSubData)( GL_ARRAY_BUFFER, offset, size, data );
+        _context->dsa->DsaBuffer( _context, readBuffer);
+        _dispatch.call(&_dispatch.glCopyBufferSubData)( GL_ARRAY_BUFFER, writeBuffer, readOffset, writeOffset, size );
         return;
       }
       #endif
@@ -58474,7 +63991,7 @@ static void REGAL_CALL emu_glNamedBufferSubDataEXT(GLuint buffer, GLintptr offse
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glNamedBufferSubDataEXT)(buffer, offset, size, data);
+      _next->call(&_next->glNamedCopyBufferSubDataEXT)(readBuffer, writeBuffer, readOffset, writeOffset, size);
       break;
     }
 
@@ -58482,7 +63999,7 @@ static void REGAL_CALL emu_glNamedBufferSubDataEXT(GLuint buffer, GLintptr offse
 
 }
 
-static void REGAL_CALL emu_glNamedCopyBufferSubDataEXT(GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
+static void REGAL_CALL emu_glNamedFramebufferRenderbufferEXT(GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -58501,6 +64018,14 @@ static void REGAL_CALL emu_glNamedCopyBufferSubDataEXT(GLuint readBuffer, GLuint
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -58533,8 +64058,8 @@ static void REGAL_CALL emu_glNamedCopyBufferSubDataEXT(GLuint readBuffer, GLuint
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
-        _context->dsa->DsaBuffer( _context, readBuffer);
-        _dispatch.call(&_dispatch.glCopyBufferSubData)( GL_ARRAY_BUFFER, writeBuffer, readOffset, writeOffset, size );
+        _context->dsa->DsaFramebuffer( _context, GL_FRAMEBUFFER, framebuffer);
+        _dispatch.call(&_dispatch.glFramebufferRenderbuffer)( GL_FRAMEBUFFER, attachment, renderbuffertarget, renderbuffer );
         return;
       }
       #endif
@@ -58543,7 +64068,7 @@ static void REGAL_CALL emu_glNamedCopyBufferSubDataEXT(GLuint readBuffer, GLuint
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glNamedCopyBufferSubDataEXT)(readBuffer, writeBuffer, readOffset, writeOffset, size);
+      _next->call(&_next->glNamedFramebufferRenderbufferEXT)(framebuffer, attachment, renderbuffertarget, renderbuffer);
       break;
     }
 
@@ -58551,7 +64076,7 @@ static void REGAL_CALL emu_glNamedCopyBufferSubDataEXT(GLuint readBuffer, GLuint
 
 }
 
-static void REGAL_CALL emu_glNamedFramebufferRenderbufferEXT(GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
+static void REGAL_CALL emu_glNamedFramebufferTexture1DEXT(GLuint framebuffer, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -58570,6 +64095,14 @@ static void REGAL_CALL emu_glNamedFramebufferRenderbufferEXT(GLuint framebuffer,
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -58603,7 +64136,7 @@ static void REGAL_CALL emu_glNamedFramebufferRenderbufferEXT(GLuint framebuffer,
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaFramebuffer( _context, GL_FRAMEBUFFER, framebuffer);
-        _dispatch.call(&_dispatch.glFramebufferRenderbuffer)( GL_FRAMEBUFFER, attachment, renderbuffertarget, renderbuffer );
+        _dispatch.call(&_dispatch.glFramebufferTexture1D)( GL_FRAMEBUFFER, attachment, textarget, texture, level );
         return;
       }
       #endif
@@ -58612,7 +64145,7 @@ static void REGAL_CALL emu_glNamedFramebufferRenderbufferEXT(GLuint framebuffer,
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glNamedFramebufferRenderbufferEXT)(framebuffer, attachment, renderbuffertarget, renderbuffer);
+      _next->call(&_next->glNamedFramebufferTexture1DEXT)(framebuffer, attachment, textarget, texture, level);
       break;
     }
 
@@ -58620,7 +64153,7 @@ static void REGAL_CALL emu_glNamedFramebufferRenderbufferEXT(GLuint framebuffer,
 
 }
 
-static void REGAL_CALL emu_glNamedFramebufferTexture1DEXT(GLuint framebuffer, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+static void REGAL_CALL emu_glNamedFramebufferTexture2DEXT(GLuint framebuffer, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -58639,6 +64172,14 @@ static void REGAL_CALL emu_glNamedFramebufferTexture1DEXT(GLuint framebuffer, GL
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -58672,7 +64213,7 @@ static void REGAL_CALL emu_glNamedFramebufferTexture1DEXT(GLuint framebuffer, GL
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaFramebuffer( _context, GL_FRAMEBUFFER, framebuffer);
-        _dispatch.call(&_dispatch.glFramebufferTexture1D)( GL_FRAMEBUFFER, attachment, textarget, texture, level );
+        _dispatch.call(&_dispatch.glFramebufferTexture2D)( GL_FRAMEBUFFER, attachment, textarget, texture, level );
         return;
       }
       #endif
@@ -58681,7 +64222,7 @@ static void REGAL_CALL emu_glNamedFramebufferTexture1DEXT(GLuint framebuffer, GL
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glNamedFramebufferTexture1DEXT)(framebuffer, attachment, textarget, texture, level);
+      _next->call(&_next->glNamedFramebufferTexture2DEXT)(framebuffer, attachment, textarget, texture, level);
       break;
     }
 
@@ -58689,7 +64230,7 @@ static void REGAL_CALL emu_glNamedFramebufferTexture1DEXT(GLuint framebuffer, GL
 
 }
 
-static void REGAL_CALL emu_glNamedFramebufferTexture2DEXT(GLuint framebuffer, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+static void REGAL_CALL emu_glNamedFramebufferTexture3DEXT(GLuint framebuffer, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -58708,6 +64249,14 @@ static void REGAL_CALL emu_glNamedFramebufferTexture2DEXT(GLuint framebuffer, GL
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -58741,7 +64290,7 @@ static void REGAL_CALL emu_glNamedFramebufferTexture2DEXT(GLuint framebuffer, GL
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaFramebuffer( _context, GL_FRAMEBUFFER, framebuffer);
-        _dispatch.call(&_dispatch.glFramebufferTexture2D)( GL_FRAMEBUFFER, attachment, textarget, texture, level );
+        _dispatch.call(&_dispatch.glFramebufferTexture3D)( GL_FRAMEBUFFER, attachment, textarget, texture, level, zoffset );
         return;
       }
       #endif
@@ -58750,7 +64299,7 @@ static void REGAL_CALL emu_glNamedFramebufferTexture2DEXT(GLuint framebuffer, GL
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glNamedFramebufferTexture2DEXT)(framebuffer, attachment, textarget, texture, level);
+      _next->call(&_next->glNamedFramebufferTexture3DEXT)(framebuffer, attachment, textarget, texture, level, zoffset);
       break;
     }
 
@@ -58758,7 +64307,7 @@ static void REGAL_CALL emu_glNamedFramebufferTexture2DEXT(GLuint framebuffer, GL
 
 }
 
-static void REGAL_CALL emu_glNamedFramebufferTexture3DEXT(GLuint framebuffer, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset)
+static void REGAL_CALL emu_glNamedFramebufferTextureEXT(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -58777,6 +64326,14 @@ static void REGAL_CALL emu_glNamedFramebufferTexture3DEXT(GLuint framebuffer, GL
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -58810,7 +64367,7 @@ static void REGAL_CALL emu_glNamedFramebufferTexture3DEXT(GLuint framebuffer, GL
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaFramebuffer( _context, GL_FRAMEBUFFER, framebuffer);
-        _dispatch.call(&_dispatch.glFramebufferTexture3D)( GL_FRAMEBUFFER, attachment, textarget, texture, level, zoffset );
+        _dispatch.call(&_dispatch.glFramebufferTexture)( GL_FRAMEBUFFER, attachment, texture, level );
         return;
       }
       #endif
@@ -58819,7 +64376,7 @@ static void REGAL_CALL emu_glNamedFramebufferTexture3DEXT(GLuint framebuffer, GL
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glNamedFramebufferTexture3DEXT)(framebuffer, attachment, textarget, texture, level, zoffset);
+      _next->call(&_next->glNamedFramebufferTextureEXT)(framebuffer, attachment, texture, level);
       break;
     }
 
@@ -58827,7 +64384,7 @@ static void REGAL_CALL emu_glNamedFramebufferTexture3DEXT(GLuint framebuffer, GL
 
 }
 
-static void REGAL_CALL emu_glNamedFramebufferTextureEXT(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level)
+static void REGAL_CALL emu_glNamedFramebufferTextureFaceEXT(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLenum face)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -58846,6 +64403,14 @@ static void REGAL_CALL emu_glNamedFramebufferTextureEXT(GLuint framebuffer, GLen
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -58879,7 +64444,7 @@ static void REGAL_CALL emu_glNamedFramebufferTextureEXT(GLuint framebuffer, GLen
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaFramebuffer( _context, GL_FRAMEBUFFER, framebuffer);
-        _dispatch.call(&_dispatch.glFramebufferTexture)( GL_FRAMEBUFFER, attachment, texture, level );
+        _dispatch.call(&_dispatch.glFramebufferTextureFaceARB)( GL_FRAMEBUFFER, attachment, texture, level, face );
         return;
       }
       #endif
@@ -58888,7 +64453,7 @@ static void REGAL_CALL emu_glNamedFramebufferTextureEXT(GLuint framebuffer, GLen
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glNamedFramebufferTextureEXT)(framebuffer, attachment, texture, level);
+      _next->call(&_next->glNamedFramebufferTextureFaceEXT)(framebuffer, attachment, texture, level, face);
       break;
     }
 
@@ -58896,7 +64461,7 @@ static void REGAL_CALL emu_glNamedFramebufferTextureEXT(GLuint framebuffer, GLen
 
 }
 
-static void REGAL_CALL emu_glNamedFramebufferTextureFaceEXT(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLenum face)
+static void REGAL_CALL emu_glNamedFramebufferTextureLayerEXT(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -58915,6 +64480,14 @@ static void REGAL_CALL emu_glNamedFramebufferTextureFaceEXT(GLuint framebuffer,
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -58948,7 +64521,7 @@ static void REGAL_CALL emu_glNamedFramebufferTextureFaceEXT(GLuint framebuffer,
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaFramebuffer( _context, GL_FRAMEBUFFER, framebuffer);
-        _dispatch.call(&_dispatch.glFramebufferTextureFaceARB)( GL_FRAMEBUFFER, attachment, texture, level, face );
+        _dispatch.call(&_dispatch.glFramebufferTextureLayer)( GL_FRAMEBUFFER, attachment, texture, level, layer );
         return;
       }
       #endif
@@ -58957,7 +64530,7 @@ static void REGAL_CALL emu_glNamedFramebufferTextureFaceEXT(GLuint framebuffer,
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glNamedFramebufferTextureFaceEXT)(framebuffer, attachment, texture, level, face);
+      _next->call(&_next->glNamedFramebufferTextureLayerEXT)(framebuffer, attachment, texture, level, layer);
       break;
     }
 
@@ -58965,7 +64538,7 @@ static void REGAL_CALL emu_glNamedFramebufferTextureFaceEXT(GLuint framebuffer,
 
 }
 
-static void REGAL_CALL emu_glNamedFramebufferTextureLayerEXT(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer)
+static void REGAL_CALL emu_glNamedProgramLocalParameter4dEXT(GLuint program, GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -59016,8 +64589,8 @@ static void REGAL_CALL emu_glNamedFramebufferTextureLayerEXT(GLuint framebuffer,
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
-        _context->dsa->DsaFramebuffer( _context, GL_FRAMEBUFFER, framebuffer);
-        _dispatch.call(&_dispatch.glFramebufferTextureLayer)( GL_FRAMEBUFFER, attachment, texture, level, layer );
+        _context->dsa->DsaAsmProgram( _context, target, program);
+        _dispatch.call(&_dispatch.glProgramLocalParameter4dARB)( target, index, x, y, z, w );
         return;
       }
       #endif
@@ -59026,7 +64599,7 @@ static void REGAL_CALL emu_glNamedFramebufferTextureLayerEXT(GLuint framebuffer,
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glNamedFramebufferTextureLayerEXT)(framebuffer, attachment, texture, level, layer);
+      _next->call(&_next->glNamedProgramLocalParameter4dEXT)(program, target, index, x, y, z, w);
       break;
     }
 
@@ -59034,7 +64607,7 @@ static void REGAL_CALL emu_glNamedFramebufferTextureLayerEXT(GLuint framebuffer,
 
 }
 
-static void REGAL_CALL emu_glNamedProgramLocalParameter4dEXT(GLuint program, GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+static void REGAL_CALL emu_glNamedProgramLocalParameter4dvEXT(GLuint program, GLenum target, GLuint index, const GLdouble *params)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -59086,7 +64659,7 @@ static void REGAL_CALL emu_glNamedProgramLocalParameter4dEXT(GLuint program, GLe
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaAsmProgram( _context, target, program);
-        _dispatch.call(&_dispatch.glProgramLocalParameter4dARB)( target, index, x, y, z, w );
+        _dispatch.call(&_dispatch.glProgramLocalParameter4dvARB)( target, index, params );
         return;
       }
       #endif
@@ -59095,7 +64668,7 @@ static void REGAL_CALL emu_glNamedProgramLocalParameter4dEXT(GLuint program, GLe
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glNamedProgramLocalParameter4dEXT)(program, target, index, x, y, z, w);
+      _next->call(&_next->glNamedProgramLocalParameter4dvEXT)(program, target, index, params);
       break;
     }
 
@@ -59103,7 +64676,7 @@ static void REGAL_CALL emu_glNamedProgramLocalParameter4dEXT(GLuint program, GLe
 
 }
 
-static void REGAL_CALL emu_glNamedProgramLocalParameter4dvEXT(GLuint program, GLenum target, GLuint index, const GLdouble *params)
+static void REGAL_CALL emu_glNamedProgramLocalParameter4fEXT(GLuint program, GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -59155,7 +64728,7 @@ static void REGAL_CALL emu_glNamedProgramLocalParameter4dvEXT(GLuint program, GL
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaAsmProgram( _context, target, program);
-        _dispatch.call(&_dispatch.glProgramLocalParameter4dvARB)( target, index, params );
+        _dispatch.call(&_dispatch.glProgramLocalParameter4fARB)( target, index, x, y, z, w );
         return;
       }
       #endif
@@ -59164,7 +64737,7 @@ static void REGAL_CALL emu_glNamedProgramLocalParameter4dvEXT(GLuint program, GL
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glNamedProgramLocalParameter4dvEXT)(program, target, index, params);
+      _next->call(&_next->glNamedProgramLocalParameter4fEXT)(program, target, index, x, y, z, w);
       break;
     }
 
@@ -59172,7 +64745,7 @@ static void REGAL_CALL emu_glNamedProgramLocalParameter4dvEXT(GLuint program, GL
 
 }
 
-static void REGAL_CALL emu_glNamedProgramLocalParameter4fEXT(GLuint program, GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+static void REGAL_CALL emu_glNamedProgramLocalParameter4fvEXT(GLuint program, GLenum target, GLuint index, const GLfloat *params)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -59224,7 +64797,7 @@ static void REGAL_CALL emu_glNamedProgramLocalParameter4fEXT(GLuint program, GLe
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaAsmProgram( _context, target, program);
-        _dispatch.call(&_dispatch.glProgramLocalParameter4fARB)( target, index, x, y, z, w );
+        _dispatch.call(&_dispatch.glProgramLocalParameter4fvARB)( target, index, params );
         return;
       }
       #endif
@@ -59233,7 +64806,7 @@ static void REGAL_CALL emu_glNamedProgramLocalParameter4fEXT(GLuint program, GLe
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glNamedProgramLocalParameter4fEXT)(program, target, index, x, y, z, w);
+      _next->call(&_next->glNamedProgramLocalParameter4fvEXT)(program, target, index, params);
       break;
     }
 
@@ -59241,7 +64814,7 @@ static void REGAL_CALL emu_glNamedProgramLocalParameter4fEXT(GLuint program, GLe
 
 }
 
-static void REGAL_CALL emu_glNamedProgramLocalParameter4fvEXT(GLuint program, GLenum target, GLuint index, const GLfloat *params)
+static void REGAL_CALL emu_glNamedProgramLocalParameterI4iEXT(GLuint program, GLenum target, GLuint index, GLint x, GLint y, GLint z, GLint w)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -59293,7 +64866,7 @@ static void REGAL_CALL emu_glNamedProgramLocalParameter4fvEXT(GLuint program, GL
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaAsmProgram( _context, target, program);
-        _dispatch.call(&_dispatch.glProgramLocalParameter4fvARB)( target, index, params );
+        _dispatch.call(&_dispatch.glProgramLocalParameterI4iNV)( target, index, x, y, z, w );
         return;
       }
       #endif
@@ -59302,7 +64875,7 @@ static void REGAL_CALL emu_glNamedProgramLocalParameter4fvEXT(GLuint program, GL
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glNamedProgramLocalParameter4fvEXT)(program, target, index, params);
+      _next->call(&_next->glNamedProgramLocalParameterI4iEXT)(program, target, index, x, y, z, w);
       break;
     }
 
@@ -59310,7 +64883,76 @@ static void REGAL_CALL emu_glNamedProgramLocalParameter4fvEXT(GLuint program, GL
 
 }
 
-static void REGAL_CALL emu_glNamedProgramLocalParameterI4iEXT(GLuint program, GLenum target, GLuint index, GLint x, GLint y, GLint z, GLint w)
+static void REGAL_CALL emu_glNamedProgramLocalParameterI4ivEXT(GLuint program, GLenum target, GLuint index, const GLint *params)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa) break;
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  // impl
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 3;
+        _context->dsa->DsaAsmProgram( _context, target, program);
+        _dispatch.call(&_dispatch.glProgramLocalParameterI4ivNV)( target, index, params );
+        return;
+      }
+      #endif
+    case 1 :
+    default:
+    {
+      DispatchTableGL *_next = _dispatch.next();
+      RegalAssert(_next);
+      _next->call(&_next->glNamedProgramLocalParameterI4ivEXT)(program, target, index, params);
+      break;
+    }
+
+  }
+
+}
+
+static void REGAL_CALL emu_glNamedProgramLocalParameterI4uiEXT(GLuint program, GLenum target, GLuint index, GLuint x, GLuint y, GLuint z, GLuint w)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -59362,7 +65004,7 @@ static void REGAL_CALL emu_glNamedProgramLocalParameterI4iEXT(GLuint program, GL
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaAsmProgram( _context, target, program);
-        _dispatch.call(&_dispatch.glProgramLocalParameterI4iNV)( target, index, x, y, z, w );
+        _dispatch.call(&_dispatch.glProgramLocalParameterI4uiNV)( target, index, x, y, z, w );
         return;
       }
       #endif
@@ -59371,7 +65013,7 @@ static void REGAL_CALL emu_glNamedProgramLocalParameterI4iEXT(GLuint program, GL
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glNamedProgramLocalParameterI4iEXT)(program, target, index, x, y, z, w);
+      _next->call(&_next->glNamedProgramLocalParameterI4uiEXT)(program, target, index, x, y, z, w);
       break;
     }
 
@@ -59379,7 +65021,7 @@ static void REGAL_CALL emu_glNamedProgramLocalParameterI4iEXT(GLuint program, GL
 
 }
 
-static void REGAL_CALL emu_glNamedProgramLocalParameterI4ivEXT(GLuint program, GLenum target, GLuint index, const GLint *params)
+static void REGAL_CALL emu_glNamedProgramLocalParameterI4uivEXT(GLuint program, GLenum target, GLuint index, const GLuint *params)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -59431,7 +65073,7 @@ static void REGAL_CALL emu_glNamedProgramLocalParameterI4ivEXT(GLuint program, G
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaAsmProgram( _context, target, program);
-        _dispatch.call(&_dispatch.glProgramLocalParameterI4ivNV)( target, index, params );
+        _dispatch.call(&_dispatch.glProgramLocalParameterI4uivNV)( target, index, params );
         return;
       }
       #endif
@@ -59440,7 +65082,7 @@ static void REGAL_CALL emu_glNamedProgramLocalParameterI4ivEXT(GLuint program, G
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glNamedProgramLocalParameterI4ivEXT)(program, target, index, params);
+      _next->call(&_next->glNamedProgramLocalParameterI4uivEXT)(program, target, index, params);
       break;
     }
 
@@ -59448,7 +65090,7 @@ static void REGAL_CALL emu_glNamedProgramLocalParameterI4ivEXT(GLuint program, G
 
 }
 
-static void REGAL_CALL emu_glNamedProgramLocalParameterI4uiEXT(GLuint program, GLenum target, GLuint index, GLuint x, GLuint y, GLuint z, GLuint w)
+static void REGAL_CALL emu_glNamedProgramLocalParameters4fvEXT(GLuint program, GLenum target, GLuint index, GLsizei count, const GLfloat *params)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -59500,7 +65142,7 @@ static void REGAL_CALL emu_glNamedProgramLocalParameterI4uiEXT(GLuint program, G
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaAsmProgram( _context, target, program);
-        _dispatch.call(&_dispatch.glProgramLocalParameterI4uiNV)( target, index, x, y, z, w );
+        _dispatch.call(&_dispatch.glProgramLocalParameters4fvEXT)( target, index, count, params );
         return;
       }
       #endif
@@ -59509,7 +65151,7 @@ static void REGAL_CALL emu_glNamedProgramLocalParameterI4uiEXT(GLuint program, G
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glNamedProgramLocalParameterI4uiEXT)(program, target, index, x, y, z, w);
+      _next->call(&_next->glNamedProgramLocalParameters4fvEXT)(program, target, index, count, params);
       break;
     }
 
@@ -59517,7 +65159,7 @@ static void REGAL_CALL emu_glNamedProgramLocalParameterI4uiEXT(GLuint program, G
 
 }
 
-static void REGAL_CALL emu_glNamedProgramLocalParameterI4uivEXT(GLuint program, GLenum target, GLuint index, const GLuint *params)
+static void REGAL_CALL emu_glNamedProgramLocalParametersI4ivEXT(GLuint program, GLenum target, GLuint index, GLsizei count, const GLint *params)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -59569,7 +65211,7 @@ static void REGAL_CALL emu_glNamedProgramLocalParameterI4uivEXT(GLuint program,
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaAsmProgram( _context, target, program);
-        _dispatch.call(&_dispatch.glProgramLocalParameterI4uivNV)( target, index, params );
+        _dispatch.call(&_dispatch.glProgramLocalParametersI4ivNV)( target, index, count, params );
         return;
       }
       #endif
@@ -59578,7 +65220,7 @@ static void REGAL_CALL emu_glNamedProgramLocalParameterI4uivEXT(GLuint program,
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glNamedProgramLocalParameterI4uivEXT)(program, target, index, params);
+      _next->call(&_next->glNamedProgramLocalParametersI4ivEXT)(program, target, index, count, params);
       break;
     }
 
@@ -59586,7 +65228,7 @@ static void REGAL_CALL emu_glNamedProgramLocalParameterI4uivEXT(GLuint program,
 
 }
 
-static void REGAL_CALL emu_glNamedProgramLocalParameters4fvEXT(GLuint program, GLenum target, GLuint index, GLsizei count, const GLfloat *params)
+static void REGAL_CALL emu_glNamedProgramLocalParametersI4uivEXT(GLuint program, GLenum target, GLuint index, GLsizei count, const GLuint *params)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -59638,7 +65280,7 @@ static void REGAL_CALL emu_glNamedProgramLocalParameters4fvEXT(GLuint program, G
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaAsmProgram( _context, target, program);
-        _dispatch.call(&_dispatch.glProgramLocalParameters4fvEXT)( target, index, count, params );
+        _dispatch.call(&_dispatch.glProgramLocalParametersI4uivNV)( target, index, count, params );
         return;
       }
       #endif
@@ -59647,7 +65289,7 @@ static void REGAL_CALL emu_glNamedProgramLocalParameters4fvEXT(GLuint program, G
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glNamedProgramLocalParameters4fvEXT)(program, target, index, count, params);
+      _next->call(&_next->glNamedProgramLocalParametersI4uivEXT)(program, target, index, count, params);
       break;
     }
 
@@ -59655,7 +65297,7 @@ static void REGAL_CALL emu_glNamedProgramLocalParameters4fvEXT(GLuint program, G
 
 }
 
-static void REGAL_CALL emu_glNamedProgramLocalParametersI4ivEXT(GLuint program, GLenum target, GLuint index, GLsizei count, const GLint *params)
+static void REGAL_CALL emu_glNamedProgramStringEXT(GLuint program, GLenum target, GLenum format, GLsizei len, const GLvoid *string)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -59707,7 +65349,7 @@ static void REGAL_CALL emu_glNamedProgramLocalParametersI4ivEXT(GLuint program,
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaAsmProgram( _context, target, program);
-        _dispatch.call(&_dispatch.glProgramLocalParametersI4ivNV)( target, index, count, params );
+        _dispatch.call(&_dispatch.glProgramStringARB)( target, format, len, string );
         return;
       }
       #endif
@@ -59716,7 +65358,7 @@ static void REGAL_CALL emu_glNamedProgramLocalParametersI4ivEXT(GLuint program,
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glNamedProgramLocalParametersI4ivEXT)(program, target, index, count, params);
+      _next->call(&_next->glNamedProgramStringEXT)(program, target, format, len, string);
       break;
     }
 
@@ -59724,7 +65366,7 @@ static void REGAL_CALL emu_glNamedProgramLocalParametersI4ivEXT(GLuint program,
 
 }
 
-static void REGAL_CALL emu_glNamedProgramLocalParametersI4uivEXT(GLuint program, GLenum target, GLuint index, GLsizei count, const GLuint *params)
+static void REGAL_CALL emu_glNamedRenderbufferStorageEXT(GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -59775,8 +65417,8 @@ static void REGAL_CALL emu_glNamedProgramLocalParametersI4uivEXT(GLuint program,
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
-        _context->dsa->DsaAsmProgram( _context, target, program);
-        _dispatch.call(&_dispatch.glProgramLocalParametersI4uivNV)( target, index, count, params );
+        _context->dsa->DsaRenderbuffer( _context, GL_RENDERBUFFER, renderbuffer);
+        _dispatch.call(&_dispatch.glRenderbufferStorage)( GL_RENDERBUFFER, internalformat, width, height );
         return;
       }
       #endif
@@ -59785,7 +65427,7 @@ static void REGAL_CALL emu_glNamedProgramLocalParametersI4uivEXT(GLuint program,
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glNamedProgramLocalParametersI4uivEXT)(program, target, index, count, params);
+      _next->call(&_next->glNamedRenderbufferStorageEXT)(renderbuffer, internalformat, width, height);
       break;
     }
 
@@ -59793,7 +65435,7 @@ static void REGAL_CALL emu_glNamedProgramLocalParametersI4uivEXT(GLuint program,
 
 }
 
-static void REGAL_CALL emu_glNamedProgramStringEXT(GLuint program, GLenum target, GLenum format, GLsizei len, const GLvoid *string)
+static void REGAL_CALL emu_glNamedRenderbufferStorageMultisampleCoverageEXT(GLuint renderbuffer, GLsizei coverageSamples, GLsizei colorSamples, GLenum internalformat, GLsizei width, GLsizei height)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -59844,8 +65486,8 @@ static void REGAL_CALL emu_glNamedProgramStringEXT(GLuint program, GLenum target
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
-        _context->dsa->DsaAsmProgram( _context, target, program);
-        _dispatch.call(&_dispatch.glProgramStringARB)( target, format, len, string );
+        _context->dsa->DsaRenderbuffer( _context, GL_RENDERBUFFER, renderbuffer);
+        _dispatch.call(&_dispatch.glRenderbufferStorageMultisampleCoverageNV)( GL_RENDERBUFFER, coverageSamples, colorSamples, internalformat, width, height );
         return;
       }
       #endif
@@ -59854,7 +65496,7 @@ static void REGAL_CALL emu_glNamedProgramStringEXT(GLuint program, GLenum target
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glNamedProgramStringEXT)(program, target, format, len, string);
+      _next->call(&_next->glNamedRenderbufferStorageMultisampleCoverageEXT)(renderbuffer, coverageSamples, colorSamples, internalformat, width, height);
       break;
     }
 
@@ -59862,7 +65504,7 @@ static void REGAL_CALL emu_glNamedProgramStringEXT(GLuint program, GLenum target
 
 }
 
-static void REGAL_CALL emu_glNamedRenderbufferStorageEXT(GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height)
+static void REGAL_CALL emu_glNamedRenderbufferStorageMultisampleEXT(GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -59914,7 +65556,7 @@ static void REGAL_CALL emu_glNamedRenderbufferStorageEXT(GLuint renderbuffer, GL
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaRenderbuffer( _context, GL_RENDERBUFFER, renderbuffer);
-        _dispatch.call(&_dispatch.glRenderbufferStorage)( GL_RENDERBUFFER, internalformat, width, height );
+        _dispatch.call(&_dispatch.glRenderbufferStorageMultisample)( GL_RENDERBUFFER, samples, internalformat, width, height );
         return;
       }
       #endif
@@ -59923,7 +65565,7 @@ static void REGAL_CALL emu_glNamedRenderbufferStorageEXT(GLuint renderbuffer, GL
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glNamedRenderbufferStorageEXT)(renderbuffer, internalformat, width, height);
+      _next->call(&_next->glNamedRenderbufferStorageMultisampleEXT)(renderbuffer, samples, internalformat, width, height);
       break;
     }
 
@@ -59931,7 +65573,7 @@ static void REGAL_CALL emu_glNamedRenderbufferStorageEXT(GLuint renderbuffer, GL
 
 }
 
-static void REGAL_CALL emu_glNamedRenderbufferStorageMultisampleCoverageEXT(GLuint renderbuffer, GLsizei coverageSamples, GLsizei colorSamples, GLenum internalformat, GLsizei width, GLsizei height)
+static void REGAL_CALL emu_glProgramUniform1dEXT(GLuint program, GLint location, GLdouble x)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -59982,8 +65624,8 @@ static void REGAL_CALL emu_glNamedRenderbufferStorageMultisampleCoverageEXT(GLui
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
-        _context->dsa->DsaRenderbuffer( _context, GL_RENDERBUFFER, renderbuffer);
-        _dispatch.call(&_dispatch.glRenderbufferStorageMultisampleCoverageNV)( GL_RENDERBUFFER, coverageSamples, colorSamples, internalformat, width, height );
+        _context->dsa->DsaGlslProgram( _context, program);
+        _dispatch.call(&_dispatch.glUniform1d)( location, x );
         return;
       }
       #endif
@@ -59992,7 +65634,7 @@ static void REGAL_CALL emu_glNamedRenderbufferStorageMultisampleCoverageEXT(GLui
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glNamedRenderbufferStorageMultisampleCoverageEXT)(renderbuffer, coverageSamples, colorSamples, internalformat, width, height);
+      _next->call(&_next->glProgramUniform1dEXT)(program, location, x);
       break;
     }
 
@@ -60000,7 +65642,7 @@ static void REGAL_CALL emu_glNamedRenderbufferStorageMultisampleCoverageEXT(GLui
 
 }
 
-static void REGAL_CALL emu_glNamedRenderbufferStorageMultisampleEXT(GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)
+static void REGAL_CALL emu_glProgramUniform1dvEXT(GLuint program, GLint location, GLsizei count, const GLdouble *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -60051,8 +65693,8 @@ static void REGAL_CALL emu_glNamedRenderbufferStorageMultisampleEXT(GLuint rende
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
-        _context->dsa->DsaRenderbuffer( _context, GL_RENDERBUFFER, renderbuffer);
-        _dispatch.call(&_dispatch.glRenderbufferStorageMultisample)( GL_RENDERBUFFER, samples, internalformat, width, height );
+        _context->dsa->DsaGlslProgram( _context, program);
+        _dispatch.call(&_dispatch.glUniform1dv)( location, count, value );
         return;
       }
       #endif
@@ -60061,7 +65703,7 @@ static void REGAL_CALL emu_glNamedRenderbufferStorageMultisampleEXT(GLuint rende
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glNamedRenderbufferStorageMultisampleEXT)(renderbuffer, samples, internalformat, width, height);
+      _next->call(&_next->glProgramUniform1dvEXT)(program, location, count, value);
       break;
     }
 
@@ -60069,7 +65711,7 @@ static void REGAL_CALL emu_glNamedRenderbufferStorageMultisampleEXT(GLuint rende
 
 }
 
-static void REGAL_CALL emu_glProgramUniform1dEXT(GLuint program, GLint location, GLdouble x)
+static void REGAL_CALL emu_glProgramUniform1fEXT(GLuint program, GLint location, GLfloat v0)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -60121,7 +65763,7 @@ static void REGAL_CALL emu_glProgramUniform1dEXT(GLuint program, GLint location,
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniform1d)( location, x );
+        _dispatch.call(&_dispatch.glUniform1f)( location, v0 );
         return;
       }
       #endif
@@ -60130,7 +65772,7 @@ static void REGAL_CALL emu_glProgramUniform1dEXT(GLuint program, GLint location,
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniform1dEXT)(program, location, x);
+      _next->call(&_next->glProgramUniform1fEXT)(program, location, v0);
       break;
     }
 
@@ -60138,7 +65780,7 @@ static void REGAL_CALL emu_glProgramUniform1dEXT(GLuint program, GLint location,
 
 }
 
-static void REGAL_CALL emu_glProgramUniform1dvEXT(GLuint program, GLint location, GLsizei count, const GLdouble *value)
+static void REGAL_CALL emu_glProgramUniform1fvEXT(GLuint program, GLint location, GLsizei count, const GLfloat *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -60190,7 +65832,7 @@ static void REGAL_CALL emu_glProgramUniform1dvEXT(GLuint program, GLint location
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniform1dv)( location, count, value );
+        _dispatch.call(&_dispatch.glUniform1fv)( location, count, value );
         return;
       }
       #endif
@@ -60199,7 +65841,7 @@ static void REGAL_CALL emu_glProgramUniform1dvEXT(GLuint program, GLint location
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniform1dvEXT)(program, location, count, value);
+      _next->call(&_next->glProgramUniform1fvEXT)(program, location, count, value);
       break;
     }
 
@@ -60207,7 +65849,7 @@ static void REGAL_CALL emu_glProgramUniform1dvEXT(GLuint program, GLint location
 
 }
 
-static void REGAL_CALL emu_glProgramUniform1fEXT(GLuint program, GLint location, GLfloat v0)
+static void REGAL_CALL emu_glProgramUniform1iEXT(GLuint program, GLint location, GLint v0)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -60259,7 +65901,7 @@ static void REGAL_CALL emu_glProgramUniform1fEXT(GLuint program, GLint location,
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniform1f)( location, v0 );
+        _dispatch.call(&_dispatch.glUniform1i)( location, v0 );
         return;
       }
       #endif
@@ -60268,7 +65910,7 @@ static void REGAL_CALL emu_glProgramUniform1fEXT(GLuint program, GLint location,
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniform1fEXT)(program, location, v0);
+      _next->call(&_next->glProgramUniform1iEXT)(program, location, v0);
       break;
     }
 
@@ -60276,7 +65918,7 @@ static void REGAL_CALL emu_glProgramUniform1fEXT(GLuint program, GLint location,
 
 }
 
-static void REGAL_CALL emu_glProgramUniform1fvEXT(GLuint program, GLint location, GLsizei count, const GLfloat *value)
+static void REGAL_CALL emu_glProgramUniform1ivEXT(GLuint program, GLint location, GLsizei count, const GLint *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -60328,7 +65970,7 @@ static void REGAL_CALL emu_glProgramUniform1fvEXT(GLuint program, GLint location
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniform1fv)( location, count, value );
+        _dispatch.call(&_dispatch.glUniform1iv)( location, count, value );
         return;
       }
       #endif
@@ -60337,7 +65979,7 @@ static void REGAL_CALL emu_glProgramUniform1fvEXT(GLuint program, GLint location
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniform1fvEXT)(program, location, count, value);
+      _next->call(&_next->glProgramUniform1ivEXT)(program, location, count, value);
       break;
     }
 
@@ -60345,7 +65987,7 @@ static void REGAL_CALL emu_glProgramUniform1fvEXT(GLuint program, GLint location
 
 }
 
-static void REGAL_CALL emu_glProgramUniform1iEXT(GLuint program, GLint location, GLint v0)
+static void REGAL_CALL emu_glProgramUniform1uiEXT(GLuint program, GLint location, GLuint v0)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -60397,7 +66039,7 @@ static void REGAL_CALL emu_glProgramUniform1iEXT(GLuint program, GLint location,
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniform1i)( location, v0 );
+        _dispatch.call(&_dispatch.glUniform1ui)( location, v0 );
         return;
       }
       #endif
@@ -60406,7 +66048,7 @@ static void REGAL_CALL emu_glProgramUniform1iEXT(GLuint program, GLint location,
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniform1iEXT)(program, location, v0);
+      _next->call(&_next->glProgramUniform1uiEXT)(program, location, v0);
       break;
     }
 
@@ -60414,7 +66056,7 @@ static void REGAL_CALL emu_glProgramUniform1iEXT(GLuint program, GLint location,
 
 }
 
-static void REGAL_CALL emu_glProgramUniform1ivEXT(GLuint program, GLint location, GLsizei count, const GLint *value)
+static void REGAL_CALL emu_glProgramUniform1uivEXT(GLuint program, GLint location, GLsizei count, const GLuint *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -60466,7 +66108,7 @@ static void REGAL_CALL emu_glProgramUniform1ivEXT(GLuint program, GLint location
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniform1iv)( location, count, value );
+        _dispatch.call(&_dispatch.glUniform1uiv)( location, count, value );
         return;
       }
       #endif
@@ -60475,7 +66117,7 @@ static void REGAL_CALL emu_glProgramUniform1ivEXT(GLuint program, GLint location
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniform1ivEXT)(program, location, count, value);
+      _next->call(&_next->glProgramUniform1uivEXT)(program, location, count, value);
       break;
     }
 
@@ -60483,7 +66125,7 @@ static void REGAL_CALL emu_glProgramUniform1ivEXT(GLuint program, GLint location
 
 }
 
-static void REGAL_CALL emu_glProgramUniform1uiEXT(GLuint program, GLint location, GLuint v0)
+static void REGAL_CALL emu_glProgramUniform2dEXT(GLuint program, GLint location, GLdouble x, GLdouble y)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -60535,7 +66177,7 @@ static void REGAL_CALL emu_glProgramUniform1uiEXT(GLuint program, GLint location
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniform1ui)( location, v0 );
+        _dispatch.call(&_dispatch.glUniform2d)( location, x, y );
         return;
       }
       #endif
@@ -60544,7 +66186,7 @@ static void REGAL_CALL emu_glProgramUniform1uiEXT(GLuint program, GLint location
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniform1uiEXT)(program, location, v0);
+      _next->call(&_next->glProgramUniform2dEXT)(program, location, x, y);
       break;
     }
 
@@ -60552,7 +66194,7 @@ static void REGAL_CALL emu_glProgramUniform1uiEXT(GLuint program, GLint location
 
 }
 
-static void REGAL_CALL emu_glProgramUniform1uivEXT(GLuint program, GLint location, GLsizei count, const GLuint *value)
+static void REGAL_CALL emu_glProgramUniform2dvEXT(GLuint program, GLint location, GLsizei count, const GLdouble *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -60604,7 +66246,7 @@ static void REGAL_CALL emu_glProgramUniform1uivEXT(GLuint program, GLint locatio
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniform1uiv)( location, count, value );
+        _dispatch.call(&_dispatch.glUniform2dv)( location, count, value );
         return;
       }
       #endif
@@ -60613,7 +66255,7 @@ static void REGAL_CALL emu_glProgramUniform1uivEXT(GLuint program, GLint locatio
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniform1uivEXT)(program, location, count, value);
+      _next->call(&_next->glProgramUniform2dvEXT)(program, location, count, value);
       break;
     }
 
@@ -60621,7 +66263,7 @@ static void REGAL_CALL emu_glProgramUniform1uivEXT(GLuint program, GLint locatio
 
 }
 
-static void REGAL_CALL emu_glProgramUniform2dEXT(GLuint program, GLint location, GLdouble x, GLdouble y)
+static void REGAL_CALL emu_glProgramUniform2fEXT(GLuint program, GLint location, GLfloat v0, GLfloat v1)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -60673,7 +66315,7 @@ static void REGAL_CALL emu_glProgramUniform2dEXT(GLuint program, GLint location,
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniform2d)( location, x, y );
+        _dispatch.call(&_dispatch.glUniform2f)( location, v0, v1 );
         return;
       }
       #endif
@@ -60682,7 +66324,7 @@ static void REGAL_CALL emu_glProgramUniform2dEXT(GLuint program, GLint location,
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniform2dEXT)(program, location, x, y);
+      _next->call(&_next->glProgramUniform2fEXT)(program, location, v0, v1);
       break;
     }
 
@@ -60690,7 +66332,7 @@ static void REGAL_CALL emu_glProgramUniform2dEXT(GLuint program, GLint location,
 
 }
 
-static void REGAL_CALL emu_glProgramUniform2dvEXT(GLuint program, GLint location, GLsizei count, const GLdouble *value)
+static void REGAL_CALL emu_glProgramUniform2fvEXT(GLuint program, GLint location, GLsizei count, const GLfloat *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -60742,7 +66384,7 @@ static void REGAL_CALL emu_glProgramUniform2dvEXT(GLuint program, GLint location
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniform2dv)( location, count, value );
+        _dispatch.call(&_dispatch.glUniform2fv)( location, count, value );
         return;
       }
       #endif
@@ -60751,7 +66393,7 @@ static void REGAL_CALL emu_glProgramUniform2dvEXT(GLuint program, GLint location
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniform2dvEXT)(program, location, count, value);
+      _next->call(&_next->glProgramUniform2fvEXT)(program, location, count, value);
       break;
     }
 
@@ -60759,7 +66401,7 @@ static void REGAL_CALL emu_glProgramUniform2dvEXT(GLuint program, GLint location
 
 }
 
-static void REGAL_CALL emu_glProgramUniform2fEXT(GLuint program, GLint location, GLfloat v0, GLfloat v1)
+static void REGAL_CALL emu_glProgramUniform2iEXT(GLuint program, GLint location, GLint v0, GLint v1)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -60811,7 +66453,7 @@ static void REGAL_CALL emu_glProgramUniform2fEXT(GLuint program, GLint location,
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniform2f)( location, v0, v1 );
+        _dispatch.call(&_dispatch.glUniform2i)( location, v0, v1 );
         return;
       }
       #endif
@@ -60820,7 +66462,7 @@ static void REGAL_CALL emu_glProgramUniform2fEXT(GLuint program, GLint location,
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniform2fEXT)(program, location, v0, v1);
+      _next->call(&_next->glProgramUniform2iEXT)(program, location, v0, v1);
       break;
     }
 
@@ -60828,7 +66470,7 @@ static void REGAL_CALL emu_glProgramUniform2fEXT(GLuint program, GLint location,
 
 }
 
-static void REGAL_CALL emu_glProgramUniform2fvEXT(GLuint program, GLint location, GLsizei count, const GLfloat *value)
+static void REGAL_CALL emu_glProgramUniform2ivEXT(GLuint program, GLint location, GLsizei count, const GLint *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -60880,7 +66522,7 @@ static void REGAL_CALL emu_glProgramUniform2fvEXT(GLuint program, GLint location
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniform2fv)( location, count, value );
+        _dispatch.call(&_dispatch.glUniform2iv)( location, count, value );
         return;
       }
       #endif
@@ -60889,7 +66531,7 @@ static void REGAL_CALL emu_glProgramUniform2fvEXT(GLuint program, GLint location
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniform2fvEXT)(program, location, count, value);
+      _next->call(&_next->glProgramUniform2ivEXT)(program, location, count, value);
       break;
     }
 
@@ -60897,7 +66539,7 @@ static void REGAL_CALL emu_glProgramUniform2fvEXT(GLuint program, GLint location
 
 }
 
-static void REGAL_CALL emu_glProgramUniform2iEXT(GLuint program, GLint location, GLint v0, GLint v1)
+static void REGAL_CALL emu_glProgramUniform2uiEXT(GLuint program, GLint location, GLuint v0, GLuint v1)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -60949,7 +66591,7 @@ static void REGAL_CALL emu_glProgramUniform2iEXT(GLuint program, GLint location,
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniform2i)( location, v0, v1 );
+        _dispatch.call(&_dispatch.glUniform2ui)( location, v0, v1 );
         return;
       }
       #endif
@@ -60958,7 +66600,7 @@ static void REGAL_CALL emu_glProgramUniform2iEXT(GLuint program, GLint location,
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniform2iEXT)(program, location, v0, v1);
+      _next->call(&_next->glProgramUniform2uiEXT)(program, location, v0, v1);
       break;
     }
 
@@ -60966,7 +66608,7 @@ static void REGAL_CALL emu_glProgramUniform2iEXT(GLuint program, GLint location,
 
 }
 
-static void REGAL_CALL emu_glProgramUniform2ivEXT(GLuint program, GLint location, GLsizei count, const GLint *value)
+static void REGAL_CALL emu_glProgramUniform2uivEXT(GLuint program, GLint location, GLsizei count, const GLuint *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -61018,7 +66660,7 @@ static void REGAL_CALL emu_glProgramUniform2ivEXT(GLuint program, GLint location
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniform2iv)( location, count, value );
+        _dispatch.call(&_dispatch.glUniform2uiv)( location, count, value );
         return;
       }
       #endif
@@ -61027,7 +66669,7 @@ static void REGAL_CALL emu_glProgramUniform2ivEXT(GLuint program, GLint location
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniform2ivEXT)(program, location, count, value);
+      _next->call(&_next->glProgramUniform2uivEXT)(program, location, count, value);
       break;
     }
 
@@ -61035,7 +66677,7 @@ static void REGAL_CALL emu_glProgramUniform2ivEXT(GLuint program, GLint location
 
 }
 
-static void REGAL_CALL emu_glProgramUniform2uiEXT(GLuint program, GLint location, GLuint v0, GLuint v1)
+static void REGAL_CALL emu_glProgramUniform3dEXT(GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -61087,7 +66729,7 @@ static void REGAL_CALL emu_glProgramUniform2uiEXT(GLuint program, GLint location
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniform2ui)( location, v0, v1 );
+        _dispatch.call(&_dispatch.glUniform3d)( location, x, y, z );
         return;
       }
       #endif
@@ -61096,7 +66738,7 @@ static void REGAL_CALL emu_glProgramUniform2uiEXT(GLuint program, GLint location
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniform2uiEXT)(program, location, v0, v1);
+      _next->call(&_next->glProgramUniform3dEXT)(program, location, x, y, z);
       break;
     }
 
@@ -61104,7 +66746,7 @@ static void REGAL_CALL emu_glProgramUniform2uiEXT(GLuint program, GLint location
 
 }
 
-static void REGAL_CALL emu_glProgramUniform2uivEXT(GLuint program, GLint location, GLsizei count, const GLuint *value)
+static void REGAL_CALL emu_glProgramUniform3dvEXT(GLuint program, GLint location, GLsizei count, const GLdouble *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -61156,7 +66798,7 @@ static void REGAL_CALL emu_glProgramUniform2uivEXT(GLuint program, GLint locatio
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniform2uiv)( location, count, value );
+        _dispatch.call(&_dispatch.glUniform3dv)( location, count, value );
         return;
       }
       #endif
@@ -61165,7 +66807,7 @@ static void REGAL_CALL emu_glProgramUniform2uivEXT(GLuint program, GLint locatio
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniform2uivEXT)(program, location, count, value);
+      _next->call(&_next->glProgramUniform3dvEXT)(program, location, count, value);
       break;
     }
 
@@ -61173,7 +66815,7 @@ static void REGAL_CALL emu_glProgramUniform2uivEXT(GLuint program, GLint locatio
 
 }
 
-static void REGAL_CALL emu_glProgramUniform3dEXT(GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z)
+static void REGAL_CALL emu_glProgramUniform3fEXT(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -61225,7 +66867,7 @@ static void REGAL_CALL emu_glProgramUniform3dEXT(GLuint program, GLint location,
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniform3d)( location, x, y, z );
+        _dispatch.call(&_dispatch.glUniform3f)( location, v0, v1, v2 );
         return;
       }
       #endif
@@ -61234,7 +66876,7 @@ static void REGAL_CALL emu_glProgramUniform3dEXT(GLuint program, GLint location,
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniform3dEXT)(program, location, x, y, z);
+      _next->call(&_next->glProgramUniform3fEXT)(program, location, v0, v1, v2);
       break;
     }
 
@@ -61242,7 +66884,7 @@ static void REGAL_CALL emu_glProgramUniform3dEXT(GLuint program, GLint location,
 
 }
 
-static void REGAL_CALL emu_glProgramUniform3dvEXT(GLuint program, GLint location, GLsizei count, const GLdouble *value)
+static void REGAL_CALL emu_glProgramUniform3fvEXT(GLuint program, GLint location, GLsizei count, const GLfloat *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -61294,7 +66936,7 @@ static void REGAL_CALL emu_glProgramUniform3dvEXT(GLuint program, GLint location
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniform3dv)( location, count, value );
+        _dispatch.call(&_dispatch.glUniform3fv)( location, count, value );
         return;
       }
       #endif
@@ -61303,7 +66945,7 @@ static void REGAL_CALL emu_glProgramUniform3dvEXT(GLuint program, GLint location
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniform3dvEXT)(program, location, count, value);
+      _next->call(&_next->glProgramUniform3fvEXT)(program, location, count, value);
       break;
     }
 
@@ -61311,7 +66953,7 @@ static void REGAL_CALL emu_glProgramUniform3dvEXT(GLuint program, GLint location
 
 }
 
-static void REGAL_CALL emu_glProgramUniform3fEXT(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+static void REGAL_CALL emu_glProgramUniform3iEXT(GLuint program, GLint location, GLint v0, GLint v1, GLint v2)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -61363,7 +67005,7 @@ static void REGAL_CALL emu_glProgramUniform3fEXT(GLuint program, GLint location,
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniform3f)( location, v0, v1, v2 );
+        _dispatch.call(&_dispatch.glUniform3i)( location, v0, v1, v2 );
         return;
       }
       #endif
@@ -61372,7 +67014,7 @@ static void REGAL_CALL emu_glProgramUniform3fEXT(GLuint program, GLint location,
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniform3fEXT)(program, location, v0, v1, v2);
+      _next->call(&_next->glProgramUniform3iEXT)(program, location, v0, v1, v2);
       break;
     }
 
@@ -61380,7 +67022,76 @@ static void REGAL_CALL emu_glProgramUniform3fEXT(GLuint program, GLint location,
 
 }
 
-static void REGAL_CALL emu_glProgramUniform3fvEXT(GLuint program, GLint location, GLsizei count, const GLfloat *value)
+static void REGAL_CALL emu_glProgramUniform3ivEXT(GLuint program, GLint location, GLsizei count, const GLint *value)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa) break;
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  // impl
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 3;
+        _context->dsa->DsaGlslProgram( _context, program);
+        _dispatch.call(&_dispatch.glUniform3iv)( location, count, value );
+        return;
+      }
+      #endif
+    case 1 :
+    default:
+    {
+      DispatchTableGL *_next = _dispatch.next();
+      RegalAssert(_next);
+      _next->call(&_next->glProgramUniform3ivEXT)(program, location, count, value);
+      break;
+    }
+
+  }
+
+}
+
+static void REGAL_CALL emu_glProgramUniform3uiEXT(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -61432,7 +67143,7 @@ static void REGAL_CALL emu_glProgramUniform3fvEXT(GLuint program, GLint location
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniform3fv)( location, count, value );
+        _dispatch.call(&_dispatch.glUniform3ui)( location, v0, v1, v2 );
         return;
       }
       #endif
@@ -61441,7 +67152,7 @@ static void REGAL_CALL emu_glProgramUniform3fvEXT(GLuint program, GLint location
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniform3fvEXT)(program, location, count, value);
+      _next->call(&_next->glProgramUniform3uiEXT)(program, location, v0, v1, v2);
       break;
     }
 
@@ -61449,7 +67160,7 @@ static void REGAL_CALL emu_glProgramUniform3fvEXT(GLuint program, GLint location
 
 }
 
-static void REGAL_CALL emu_glProgramUniform3iEXT(GLuint program, GLint location, GLint v0, GLint v1, GLint v2)
+static void REGAL_CALL emu_glProgramUniform3uivEXT(GLuint program, GLint location, GLsizei count, const GLuint *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -61501,7 +67212,7 @@ static void REGAL_CALL emu_glProgramUniform3iEXT(GLuint program, GLint location,
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniform3i)( location, v0, v1, v2 );
+        _dispatch.call(&_dispatch.glUniform3uiv)( location, count, value );
         return;
       }
       #endif
@@ -61510,7 +67221,7 @@ static void REGAL_CALL emu_glProgramUniform3iEXT(GLuint program, GLint location,
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniform3iEXT)(program, location, v0, v1, v2);
+      _next->call(&_next->glProgramUniform3uivEXT)(program, location, count, value);
       break;
     }
 
@@ -61518,7 +67229,7 @@ static void REGAL_CALL emu_glProgramUniform3iEXT(GLuint program, GLint location,
 
 }
 
-static void REGAL_CALL emu_glProgramUniform3ivEXT(GLuint program, GLint location, GLsizei count, const GLint *value)
+static void REGAL_CALL emu_glProgramUniform4dEXT(GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -61570,7 +67281,7 @@ static void REGAL_CALL emu_glProgramUniform3ivEXT(GLuint program, GLint location
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniform3iv)( location, count, value );
+        _dispatch.call(&_dispatch.glUniform4d)( location, x, y, z, w );
         return;
       }
       #endif
@@ -61579,7 +67290,7 @@ static void REGAL_CALL emu_glProgramUniform3ivEXT(GLuint program, GLint location
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniform3ivEXT)(program, location, count, value);
+      _next->call(&_next->glProgramUniform4dEXT)(program, location, x, y, z, w);
       break;
     }
 
@@ -61587,7 +67298,7 @@ static void REGAL_CALL emu_glProgramUniform3ivEXT(GLuint program, GLint location
 
 }
 
-static void REGAL_CALL emu_glProgramUniform3uiEXT(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2)
+static void REGAL_CALL emu_glProgramUniform4dvEXT(GLuint program, GLint location, GLsizei count, const GLdouble *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -61639,7 +67350,7 @@ static void REGAL_CALL emu_glProgramUniform3uiEXT(GLuint program, GLint location
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniform3ui)( location, v0, v1, v2 );
+        _dispatch.call(&_dispatch.glUniform4dv)( location, count, value );
         return;
       }
       #endif
@@ -61648,7 +67359,7 @@ static void REGAL_CALL emu_glProgramUniform3uiEXT(GLuint program, GLint location
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniform3uiEXT)(program, location, v0, v1, v2);
+      _next->call(&_next->glProgramUniform4dvEXT)(program, location, count, value);
       break;
     }
 
@@ -61656,7 +67367,7 @@ static void REGAL_CALL emu_glProgramUniform3uiEXT(GLuint program, GLint location
 
 }
 
-static void REGAL_CALL emu_glProgramUniform3uivEXT(GLuint program, GLint location, GLsizei count, const GLuint *value)
+static void REGAL_CALL emu_glProgramUniform4fEXT(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -61708,7 +67419,7 @@ static void REGAL_CALL emu_glProgramUniform3uivEXT(GLuint program, GLint locatio
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniform3uiv)( location, count, value );
+        _dispatch.call(&_dispatch.glUniform4f)( location, v0, v1, v2, v3 );
         return;
       }
       #endif
@@ -61717,7 +67428,7 @@ static void REGAL_CALL emu_glProgramUniform3uivEXT(GLuint program, GLint locatio
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniform3uivEXT)(program, location, count, value);
+      _next->call(&_next->glProgramUniform4fEXT)(program, location, v0, v1, v2, v3);
       break;
     }
 
@@ -61725,7 +67436,7 @@ static void REGAL_CALL emu_glProgramUniform3uivEXT(GLuint program, GLint locatio
 
 }
 
-static void REGAL_CALL emu_glProgramUniform4dEXT(GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+static void REGAL_CALL emu_glProgramUniform4fvEXT(GLuint program, GLint location, GLsizei count, const GLfloat *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -61777,7 +67488,7 @@ static void REGAL_CALL emu_glProgramUniform4dEXT(GLuint program, GLint location,
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniform4d)( location, x, y, z, w );
+        _dispatch.call(&_dispatch.glUniform4fv)( location, count, value );
         return;
       }
       #endif
@@ -61786,7 +67497,7 @@ static void REGAL_CALL emu_glProgramUniform4dEXT(GLuint program, GLint location,
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniform4dEXT)(program, location, x, y, z, w);
+      _next->call(&_next->glProgramUniform4fvEXT)(program, location, count, value);
       break;
     }
 
@@ -61794,7 +67505,7 @@ static void REGAL_CALL emu_glProgramUniform4dEXT(GLuint program, GLint location,
 
 }
 
-static void REGAL_CALL emu_glProgramUniform4dvEXT(GLuint program, GLint location, GLsizei count, const GLdouble *value)
+static void REGAL_CALL emu_glProgramUniform4iEXT(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -61846,7 +67557,7 @@ static void REGAL_CALL emu_glProgramUniform4dvEXT(GLuint program, GLint location
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniform4dv)( location, count, value );
+        _dispatch.call(&_dispatch.glUniform4i)( location, v0, v1, v2, v3 );
         return;
       }
       #endif
@@ -61855,7 +67566,7 @@ static void REGAL_CALL emu_glProgramUniform4dvEXT(GLuint program, GLint location
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniform4dvEXT)(program, location, count, value);
+      _next->call(&_next->glProgramUniform4iEXT)(program, location, v0, v1, v2, v3);
       break;
     }
 
@@ -61863,7 +67574,7 @@ static void REGAL_CALL emu_glProgramUniform4dvEXT(GLuint program, GLint location
 
 }
 
-static void REGAL_CALL emu_glProgramUniform4fEXT(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+static void REGAL_CALL emu_glProgramUniform4ivEXT(GLuint program, GLint location, GLsizei count, const GLint *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -61915,7 +67626,7 @@ static void REGAL_CALL emu_glProgramUniform4fEXT(GLuint program, GLint location,
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniform4f)( location, v0, v1, v2, v3 );
+        _dispatch.call(&_dispatch.glUniform4iv)( location, count, value );
         return;
       }
       #endif
@@ -61924,7 +67635,7 @@ static void REGAL_CALL emu_glProgramUniform4fEXT(GLuint program, GLint location,
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniform4fEXT)(program, location, v0, v1, v2, v3);
+      _next->call(&_next->glProgramUniform4ivEXT)(program, location, count, value);
       break;
     }
 
@@ -61932,7 +67643,7 @@ static void REGAL_CALL emu_glProgramUniform4fEXT(GLuint program, GLint location,
 
 }
 
-static void REGAL_CALL emu_glProgramUniform4fvEXT(GLuint program, GLint location, GLsizei count, const GLfloat *value)
+static void REGAL_CALL emu_glProgramUniform4uiEXT(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -61984,7 +67695,7 @@ static void REGAL_CALL emu_glProgramUniform4fvEXT(GLuint program, GLint location
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniform4fv)( location, count, value );
+        _dispatch.call(&_dispatch.glUniform4ui)( location, v0, v1, v2, v3 );
         return;
       }
       #endif
@@ -61993,7 +67704,7 @@ static void REGAL_CALL emu_glProgramUniform4fvEXT(GLuint program, GLint location
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniform4fvEXT)(program, location, count, value);
+      _next->call(&_next->glProgramUniform4uiEXT)(program, location, v0, v1, v2, v3);
       break;
     }
 
@@ -62001,7 +67712,7 @@ static void REGAL_CALL emu_glProgramUniform4fvEXT(GLuint program, GLint location
 
 }
 
-static void REGAL_CALL emu_glProgramUniform4iEXT(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+static void REGAL_CALL emu_glProgramUniform4uivEXT(GLuint program, GLint location, GLsizei count, const GLuint *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -62053,7 +67764,7 @@ static void REGAL_CALL emu_glProgramUniform4iEXT(GLuint program, GLint location,
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniform4i)( location, v0, v1, v2, v3 );
+        _dispatch.call(&_dispatch.glUniform4uiv)( location, count, value );
         return;
       }
       #endif
@@ -62062,7 +67773,7 @@ static void REGAL_CALL emu_glProgramUniform4iEXT(GLuint program, GLint location,
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniform4iEXT)(program, location, v0, v1, v2, v3);
+      _next->call(&_next->glProgramUniform4uivEXT)(program, location, count, value);
       break;
     }
 
@@ -62070,7 +67781,7 @@ static void REGAL_CALL emu_glProgramUniform4iEXT(GLuint program, GLint location,
 
 }
 
-static void REGAL_CALL emu_glProgramUniform4ivEXT(GLuint program, GLint location, GLsizei count, const GLint *value)
+static void REGAL_CALL emu_glProgramUniformMatrix2dvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -62122,7 +67833,7 @@ static void REGAL_CALL emu_glProgramUniform4ivEXT(GLuint program, GLint location
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniform4iv)( location, count, value );
+        _dispatch.call(&_dispatch.glUniformMatrix2dv)( location, count, transpose, value );
         return;
       }
       #endif
@@ -62131,7 +67842,7 @@ static void REGAL_CALL emu_glProgramUniform4ivEXT(GLuint program, GLint location
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniform4ivEXT)(program, location, count, value);
+      _next->call(&_next->glProgramUniformMatrix2dvEXT)(program, location, count, transpose, value);
       break;
     }
 
@@ -62139,7 +67850,7 @@ static void REGAL_CALL emu_glProgramUniform4ivEXT(GLuint program, GLint location
 
 }
 
-static void REGAL_CALL emu_glProgramUniform4uiEXT(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
+static void REGAL_CALL emu_glProgramUniformMatrix2fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -62191,7 +67902,7 @@ static void REGAL_CALL emu_glProgramUniform4uiEXT(GLuint program, GLint location
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniform4ui)( location, v0, v1, v2, v3 );
+        _dispatch.call(&_dispatch.glUniformMatrix2fv)( location, count, transpose, value );
         return;
       }
       #endif
@@ -62200,7 +67911,7 @@ static void REGAL_CALL emu_glProgramUniform4uiEXT(GLuint program, GLint location
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniform4uiEXT)(program, location, v0, v1, v2, v3);
+      _next->call(&_next->glProgramUniformMatrix2fvEXT)(program, location, count, transpose, value);
       break;
     }
 
@@ -62208,7 +67919,7 @@ static void REGAL_CALL emu_glProgramUniform4uiEXT(GLuint program, GLint location
 
 }
 
-static void REGAL_CALL emu_glProgramUniform4uivEXT(GLuint program, GLint location, GLsizei count, const GLuint *value)
+static void REGAL_CALL emu_glProgramUniformMatrix2x3dvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -62260,7 +67971,7 @@ static void REGAL_CALL emu_glProgramUniform4uivEXT(GLuint program, GLint locatio
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniform4uiv)( location, count, value );
+        _dispatch.call(&_dispatch.glUniformMatrix2x3dv)( location, count, transpose, value );
         return;
       }
       #endif
@@ -62269,7 +67980,7 @@ static void REGAL_CALL emu_glProgramUniform4uivEXT(GLuint program, GLint locatio
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniform4uivEXT)(program, location, count, value);
+      _next->call(&_next->glProgramUniformMatrix2x3dvEXT)(program, location, count, transpose, value);
       break;
     }
 
@@ -62277,7 +67988,7 @@ static void REGAL_CALL emu_glProgramUniform4uivEXT(GLuint program, GLint locatio
 
 }
 
-static void REGAL_CALL emu_glProgramUniformMatrix2dvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+static void REGAL_CALL emu_glProgramUniformMatrix2x3fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -62329,7 +68040,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix2dvEXT(GLuint program, GLint lo
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniformMatrix2dv)( location, count, transpose, value );
+        _dispatch.call(&_dispatch.glUniformMatrix2x3fv)( location, count, transpose, value );
         return;
       }
       #endif
@@ -62338,7 +68049,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix2dvEXT(GLuint program, GLint lo
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniformMatrix2dvEXT)(program, location, count, transpose, value);
+      _next->call(&_next->glProgramUniformMatrix2x3fvEXT)(program, location, count, transpose, value);
       break;
     }
 
@@ -62346,7 +68057,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix2dvEXT(GLuint program, GLint lo
 
 }
 
-static void REGAL_CALL emu_glProgramUniformMatrix2fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+static void REGAL_CALL emu_glProgramUniformMatrix2x4dvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -62398,7 +68109,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix2fvEXT(GLuint program, GLint lo
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniformMatrix2fv)( location, count, transpose, value );
+        _dispatch.call(&_dispatch.glUniformMatrix2x4dv)( location, count, transpose, value );
         return;
       }
       #endif
@@ -62407,7 +68118,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix2fvEXT(GLuint program, GLint lo
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniformMatrix2fvEXT)(program, location, count, transpose, value);
+      _next->call(&_next->glProgramUniformMatrix2x4dvEXT)(program, location, count, transpose, value);
       break;
     }
 
@@ -62415,7 +68126,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix2fvEXT(GLuint program, GLint lo
 
 }
 
-static void REGAL_CALL emu_glProgramUniformMatrix2x3dvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+static void REGAL_CALL emu_glProgramUniformMatrix2x4fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -62467,7 +68178,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix2x3dvEXT(GLuint program, GLint
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniformMatrix2x3dv)( location, count, transpose, value );
+        _dispatch.call(&_dispatch.glUniformMatrix2x4fv)( location, count, transpose, value );
         return;
       }
       #endif
@@ -62476,7 +68187,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix2x3dvEXT(GLuint program, GLint
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniformMatrix2x3dvEXT)(program, location, count, transpose, value);
+      _next->call(&_next->glProgramUniformMatrix2x4fvEXT)(program, location, count, transpose, value);
       break;
     }
 
@@ -62484,7 +68195,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix2x3dvEXT(GLuint program, GLint
 
 }
 
-static void REGAL_CALL emu_glProgramUniformMatrix2x3fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+static void REGAL_CALL emu_glProgramUniformMatrix3dvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -62536,7 +68247,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix2x3fvEXT(GLuint program, GLint
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniformMatrix2x3fv)( location, count, transpose, value );
+        _dispatch.call(&_dispatch.glUniformMatrix3dv)( location, count, transpose, value );
         return;
       }
       #endif
@@ -62545,7 +68256,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix2x3fvEXT(GLuint program, GLint
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniformMatrix2x3fvEXT)(program, location, count, transpose, value);
+      _next->call(&_next->glProgramUniformMatrix3dvEXT)(program, location, count, transpose, value);
       break;
     }
 
@@ -62553,7 +68264,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix2x3fvEXT(GLuint program, GLint
 
 }
 
-static void REGAL_CALL emu_glProgramUniformMatrix2x4dvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+static void REGAL_CALL emu_glProgramUniformMatrix3fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -62605,7 +68316,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix2x4dvEXT(GLuint program, GLint
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniformMatrix2x4dv)( location, count, transpose, value );
+        _dispatch.call(&_dispatch.glUniformMatrix3fv)( location, count, transpose, value );
         return;
       }
       #endif
@@ -62614,7 +68325,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix2x4dvEXT(GLuint program, GLint
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniformMatrix2x4dvEXT)(program, location, count, transpose, value);
+      _next->call(&_next->glProgramUniformMatrix3fvEXT)(program, location, count, transpose, value);
       break;
     }
 
@@ -62622,7 +68333,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix2x4dvEXT(GLuint program, GLint
 
 }
 
-static void REGAL_CALL emu_glProgramUniformMatrix2x4fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+static void REGAL_CALL emu_glProgramUniformMatrix3x2dvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -62674,7 +68385,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix2x4fvEXT(GLuint program, GLint
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniformMatrix2x4fv)( location, count, transpose, value );
+        _dispatch.call(&_dispatch.glUniformMatrix3x2dv)( location, count, transpose, value );
         return;
       }
       #endif
@@ -62683,7 +68394,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix2x4fvEXT(GLuint program, GLint
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniformMatrix2x4fvEXT)(program, location, count, transpose, value);
+      _next->call(&_next->glProgramUniformMatrix3x2dvEXT)(program, location, count, transpose, value);
       break;
     }
 
@@ -62691,7 +68402,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix2x4fvEXT(GLuint program, GLint
 
 }
 
-static void REGAL_CALL emu_glProgramUniformMatrix3dvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+static void REGAL_CALL emu_glProgramUniformMatrix3x2fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -62743,7 +68454,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix3dvEXT(GLuint program, GLint lo
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniformMatrix3dv)( location, count, transpose, value );
+        _dispatch.call(&_dispatch.glUniformMatrix3x2fv)( location, count, transpose, value );
         return;
       }
       #endif
@@ -62752,7 +68463,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix3dvEXT(GLuint program, GLint lo
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniformMatrix3dvEXT)(program, location, count, transpose, value);
+      _next->call(&_next->glProgramUniformMatrix3x2fvEXT)(program, location, count, transpose, value);
       break;
     }
 
@@ -62760,7 +68471,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix3dvEXT(GLuint program, GLint lo
 
 }
 
-static void REGAL_CALL emu_glProgramUniformMatrix3fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+static void REGAL_CALL emu_glProgramUniformMatrix3x4dvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -62812,7 +68523,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix3fvEXT(GLuint program, GLint lo
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniformMatrix3fv)( location, count, transpose, value );
+        _dispatch.call(&_dispatch.glUniformMatrix3x4dv)( location, count, transpose, value );
         return;
       }
       #endif
@@ -62821,7 +68532,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix3fvEXT(GLuint program, GLint lo
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniformMatrix3fvEXT)(program, location, count, transpose, value);
+      _next->call(&_next->glProgramUniformMatrix3x4dvEXT)(program, location, count, transpose, value);
       break;
     }
 
@@ -62829,7 +68540,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix3fvEXT(GLuint program, GLint lo
 
 }
 
-static void REGAL_CALL emu_glProgramUniformMatrix3x2dvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+static void REGAL_CALL emu_glProgramUniformMatrix3x4fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -62881,7 +68592,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix3x2dvEXT(GLuint program, GLint
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniformMatrix3x2dv)( location, count, transpose, value );
+        _dispatch.call(&_dispatch.glUniformMatrix3x4fv)( location, count, transpose, value );
         return;
       }
       #endif
@@ -62890,7 +68601,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix3x2dvEXT(GLuint program, GLint
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniformMatrix3x2dvEXT)(program, location, count, transpose, value);
+      _next->call(&_next->glProgramUniformMatrix3x4fvEXT)(program, location, count, transpose, value);
       break;
     }
 
@@ -62898,7 +68609,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix3x2dvEXT(GLuint program, GLint
 
 }
 
-static void REGAL_CALL emu_glProgramUniformMatrix3x2fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+static void REGAL_CALL emu_glProgramUniformMatrix4dvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -62950,7 +68661,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix3x2fvEXT(GLuint program, GLint
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniformMatrix3x2fv)( location, count, transpose, value );
+        _dispatch.call(&_dispatch.glUniformMatrix4dv)( location, count, transpose, value );
         return;
       }
       #endif
@@ -62959,7 +68670,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix3x2fvEXT(GLuint program, GLint
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniformMatrix3x2fvEXT)(program, location, count, transpose, value);
+      _next->call(&_next->glProgramUniformMatrix4dvEXT)(program, location, count, transpose, value);
       break;
     }
 
@@ -62967,7 +68678,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix3x2fvEXT(GLuint program, GLint
 
 }
 
-static void REGAL_CALL emu_glProgramUniformMatrix3x4dvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+static void REGAL_CALL emu_glProgramUniformMatrix4fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -63019,7 +68730,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix3x4dvEXT(GLuint program, GLint
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniformMatrix3x4dv)( location, count, transpose, value );
+        _dispatch.call(&_dispatch.glUniformMatrix4fv)( location, count, transpose, value );
         return;
       }
       #endif
@@ -63028,7 +68739,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix3x4dvEXT(GLuint program, GLint
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniformMatrix3x4dvEXT)(program, location, count, transpose, value);
+      _next->call(&_next->glProgramUniformMatrix4fvEXT)(program, location, count, transpose, value);
       break;
     }
 
@@ -63036,7 +68747,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix3x4dvEXT(GLuint program, GLint
 
 }
 
-static void REGAL_CALL emu_glProgramUniformMatrix3x4fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+static void REGAL_CALL emu_glProgramUniformMatrix4x2dvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -63088,7 +68799,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix3x4fvEXT(GLuint program, GLint
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniformMatrix3x4fv)( location, count, transpose, value );
+        _dispatch.call(&_dispatch.glUniformMatrix4x2dv)( location, count, transpose, value );
         return;
       }
       #endif
@@ -63097,7 +68808,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix3x4fvEXT(GLuint program, GLint
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniformMatrix3x4fvEXT)(program, location, count, transpose, value);
+      _next->call(&_next->glProgramUniformMatrix4x2dvEXT)(program, location, count, transpose, value);
       break;
     }
 
@@ -63105,7 +68816,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix3x4fvEXT(GLuint program, GLint
 
 }
 
-static void REGAL_CALL emu_glProgramUniformMatrix4dvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+static void REGAL_CALL emu_glProgramUniformMatrix4x2fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -63157,7 +68868,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix4dvEXT(GLuint program, GLint lo
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniformMatrix4dv)( location, count, transpose, value );
+        _dispatch.call(&_dispatch.glUniformMatrix4x2fv)( location, count, transpose, value );
         return;
       }
       #endif
@@ -63166,7 +68877,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix4dvEXT(GLuint program, GLint lo
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniformMatrix4dvEXT)(program, location, count, transpose, value);
+      _next->call(&_next->glProgramUniformMatrix4x2fvEXT)(program, location, count, transpose, value);
       break;
     }
 
@@ -63174,7 +68885,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix4dvEXT(GLuint program, GLint lo
 
 }
 
-static void REGAL_CALL emu_glProgramUniformMatrix4fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+static void REGAL_CALL emu_glProgramUniformMatrix4x3dvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -63226,7 +68937,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix4fvEXT(GLuint program, GLint lo
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniformMatrix4fv)( location, count, transpose, value );
+        _dispatch.call(&_dispatch.glUniformMatrix4x3dv)( location, count, transpose, value );
         return;
       }
       #endif
@@ -63235,7 +68946,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix4fvEXT(GLuint program, GLint lo
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniformMatrix4fvEXT)(program, location, count, transpose, value);
+      _next->call(&_next->glProgramUniformMatrix4x3dvEXT)(program, location, count, transpose, value);
       break;
     }
 
@@ -63243,7 +68954,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix4fvEXT(GLuint program, GLint lo
 
 }
 
-static void REGAL_CALL emu_glProgramUniformMatrix4x2dvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+static void REGAL_CALL emu_glProgramUniformMatrix4x3fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -63295,7 +69006,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix4x2dvEXT(GLuint program, GLint
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniformMatrix4x2dv)( location, count, transpose, value );
+        _dispatch.call(&_dispatch.glUniformMatrix4x3fv)( location, count, transpose, value );
         return;
       }
       #endif
@@ -63304,7 +69015,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix4x2dvEXT(GLuint program, GLint
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniformMatrix4x2dvEXT)(program, location, count, transpose, value);
+      _next->call(&_next->glProgramUniformMatrix4x3fvEXT)(program, location, count, transpose, value);
       break;
     }
 
@@ -63312,7 +69023,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix4x2dvEXT(GLuint program, GLint
 
 }
 
-static void REGAL_CALL emu_glProgramUniformMatrix4x2fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+static void REGAL_CALL emu_glPushClientAttribDefaultEXT(GLbitfield mask)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -63325,6 +69036,9 @@ static void REGAL_CALL emu_glProgramUniformMatrix4x2fvEXT(GLuint program, GLint
     case 15 :
     case 14 :
     case 13 :
+      #if REGAL_EMU_PPCA
+      if (_context->ppca) break;
+      #endif
     case 12 :
     case 11 :
     case 10 :
@@ -63349,6 +69063,15 @@ static void REGAL_CALL emu_glProgramUniformMatrix4x2fvEXT(GLuint program, GLint
     case 15 :
     case 14 :
     case 13 :
+      #if REGAL_EMU_PPCA
+      if (_context->ppca)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 12;
+        _context->ppca->glPushClientAttribDefaultEXT( *_context, mask );
+        return;
+      }
+      #endif
     case 12 :
     case 11 :
     case 10 :
@@ -63363,8 +69086,9 @@ static void REGAL_CALL emu_glProgramUniformMatrix4x2fvEXT(GLuint program, GLint
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
-        _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniformMatrix4x2fv)( location, count, transpose, value );
+        DispatchTableGL &tbl = _context->dispatcher.emulation;
+        tbl.call(&tbl.glPushClientAttrib)(mask);
+        _context->dsa->ClientAttribDefault(_context, mask);
         return;
       }
       #endif
@@ -63373,7 +69097,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix4x2fvEXT(GLuint program, GLint
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniformMatrix4x2fvEXT)(program, location, count, transpose, value);
+      _next->call(&_next->glPushClientAttribDefaultEXT)(mask);
       break;
     }
 
@@ -63381,7 +69105,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix4x2fvEXT(GLuint program, GLint
 
 }
 
-static void REGAL_CALL emu_glProgramUniformMatrix4x3dvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value)
+static void REGAL_CALL emu_glTextureBufferEXT(GLuint texture, GLenum target, GLenum internalformat, GLuint buffer)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -63400,6 +69124,14 @@ static void REGAL_CALL emu_glProgramUniformMatrix4x3dvEXT(GLuint program, GLint
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -63432,8 +69164,8 @@ static void REGAL_CALL emu_glProgramUniformMatrix4x3dvEXT(GLuint program, GLint
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
-        _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniformMatrix4x3dv)( location, count, transpose, value );
+        _context->dsa->DsaTexture( _context, target, texture );
+        _dispatch.call(&_dispatch.glTexBuffer)( target, internalformat, buffer );
         return;
       }
       #endif
@@ -63442,7 +69174,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix4x3dvEXT(GLuint program, GLint
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniformMatrix4x3dvEXT)(program, location, count, transpose, value);
+      _next->call(&_next->glTextureBufferEXT)(texture, target, internalformat, buffer);
       break;
     }
 
@@ -63450,7 +69182,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix4x3dvEXT(GLuint program, GLint
 
 }
 
-static void REGAL_CALL emu_glProgramUniformMatrix4x3fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+static void REGAL_CALL emu_glTextureImage1DEXT(GLuint texture, GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const GLvoid *pixels)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -63469,6 +69201,15 @@ static void REGAL_CALL emu_glProgramUniformMatrix4x3fvEXT(GLuint program, GLint
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+        _context->iff->ShadowTextureInfo( texture, target, internalformat );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -63501,8 +69242,8 @@ static void REGAL_CALL emu_glProgramUniformMatrix4x3fvEXT(GLuint program, GLint
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
-        _context->dsa->DsaGlslProgram( _context, program);
-        _dispatch.call(&_dispatch.glUniformMatrix4x3fv)( location, count, transpose, value );
+        _context->dsa->DsaTexture( _context, target, texture );
+        _dispatch.call(&_dispatch.glTexImage1D)( target, level, internalformat, width, border, format, type, pixels );
         return;
       }
       #endif
@@ -63511,7 +69252,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix4x3fvEXT(GLuint program, GLint
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glProgramUniformMatrix4x3fvEXT)(program, location, count, transpose, value);
+      _next->call(&_next->glTextureImage1DEXT)(texture, target, level, internalformat, width, border, format, type, pixels);
       break;
     }
 
@@ -63519,7 +69260,7 @@ static void REGAL_CALL emu_glProgramUniformMatrix4x3fvEXT(GLuint program, GLint
 
 }
 
-static void REGAL_CALL emu_glPushClientAttribDefaultEXT(GLbitfield mask)
+static void REGAL_CALL emu_glTextureImage2DEXT(GLuint texture, GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const GLvoid *pixels)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -63532,15 +69273,21 @@ static void REGAL_CALL emu_glPushClientAttribDefaultEXT(GLbitfield mask)
     case 15 :
     case 14 :
     case 13 :
-      #if REGAL_EMU_PPCA
-      if (_context->ppca) break;
-      #endif
     case 12 :
     case 11 :
     case 10 :
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+        _context->iff->ShadowTextureInfo( texture, target, internalformat );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -63559,15 +69306,6 @@ static void REGAL_CALL emu_glPushClientAttribDefaultEXT(GLbitfield mask)
     case 15 :
     case 14 :
     case 13 :
-      #if REGAL_EMU_PPCA
-      if (_context->ppca)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 12;
-        _context->ppca->glPushClientAttribDefaultEXT( *_context, mask );
-        return;
-      }
-      #endif
     case 12 :
     case 11 :
     case 10 :
@@ -63582,9 +69320,8 @@ static void REGAL_CALL emu_glPushClientAttribDefaultEXT(GLbitfield mask)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
-        DispatchTableGL &tbl = _context->dispatcher.emulation;
-        tbl.call(&tbl.glPushClientAttrib)(mask);
-        _context->dsa->ClientAttribDefault(_context, mask);
+        _context->dsa->DsaTexture( _context, target, texture );
+        _dispatch.call(&_dispatch.glTexImage2D)( target, level, internalformat, width, height, border, format, type, pixels );
         return;
       }
       #endif
@@ -63593,7 +69330,7 @@ static void REGAL_CALL emu_glPushClientAttribDefaultEXT(GLbitfield mask)
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glPushClientAttribDefaultEXT)(mask);
+      _next->call(&_next->glTextureImage2DEXT)(texture, target, level, internalformat, width, height, border, format, type, pixels);
       break;
     }
 
@@ -63601,7 +69338,7 @@ static void REGAL_CALL emu_glPushClientAttribDefaultEXT(GLbitfield mask)
 
 }
 
-static void REGAL_CALL emu_glTextureBufferEXT(GLuint texture, GLenum target, GLenum internalformat, GLuint buffer)
+static void REGAL_CALL emu_glTextureImage3DEXT(GLuint texture, GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const GLvoid *pixels)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -63620,6 +69357,15 @@ static void REGAL_CALL emu_glTextureBufferEXT(GLuint texture, GLenum target, GLe
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+        _context->iff->ShadowTextureInfo( texture, target, internalformat );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -63653,7 +69399,7 @@ static void REGAL_CALL emu_glTextureBufferEXT(GLuint texture, GLenum target, GLe
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaTexture( _context, target, texture );
-        _dispatch.call(&_dispatch.glTexBuffer)( target, internalformat, buffer );
+        _dispatch.call(&_dispatch.glTexImage3D)( target, level, internalformat, width, height, depth, border, format, type, pixels );
         return;
       }
       #endif
@@ -63662,7 +69408,7 @@ static void REGAL_CALL emu_glTextureBufferEXT(GLuint texture, GLenum target, GLe
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glTextureBufferEXT)(texture, target, internalformat, buffer);
+      _next->call(&_next->glTextureImage3DEXT)(texture, target, level, internalformat, width, height, depth, border, format, type, pixels);
       break;
     }
 
@@ -63670,7 +69416,7 @@ static void REGAL_CALL emu_glTextureBufferEXT(GLuint texture, GLenum target, GLe
 
 }
 
-static void REGAL_CALL emu_glTextureImage1DEXT(GLuint texture, GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const GLvoid *pixels)
+static void REGAL_CALL emu_glTextureParameterIivEXT(GLuint texture, GLenum target, GLenum pname, const GLint *params)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -63694,7 +69440,7 @@ static void REGAL_CALL emu_glTextureImage1DEXT(GLuint texture, GLenum target, GL
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->ShadowTextureInfo( texture, target, internalformat );
+        _context->iff->FlushBatch( _context );
       }
       #endif
     case 6 :
@@ -63730,7 +69476,7 @@ static void REGAL_CALL emu_glTextureImage1DEXT(GLuint texture, GLenum target, GL
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaTexture( _context, target, texture );
-        _dispatch.call(&_dispatch.glTexImage1D)( target, level, internalformat, width, border, format, type, pixels );
+        _dispatch.call(&_dispatch.glTexParameterIiv)( target, pname, params );
         return;
       }
       #endif
@@ -63739,7 +69485,7 @@ static void REGAL_CALL emu_glTextureImage1DEXT(GLuint texture, GLenum target, GL
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glTextureImage1DEXT)(texture, target, level, internalformat, width, border, format, type, pixels);
+      _next->call(&_next->glTextureParameterIivEXT)(texture, target, pname, params);
       break;
     }
 
@@ -63747,7 +69493,7 @@ static void REGAL_CALL emu_glTextureImage1DEXT(GLuint texture, GLenum target, GL
 
 }
 
-static void REGAL_CALL emu_glTextureImage2DEXT(GLuint texture, GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const GLvoid *pixels)
+static void REGAL_CALL emu_glTextureParameterIuivEXT(GLuint texture, GLenum target, GLenum pname, const GLuint *params)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -63771,7 +69517,7 @@ static void REGAL_CALL emu_glTextureImage2DEXT(GLuint texture, GLenum target, GL
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->ShadowTextureInfo( texture, target, internalformat );
+        _context->iff->FlushBatch( _context );
       }
       #endif
     case 6 :
@@ -63807,7 +69553,7 @@ static void REGAL_CALL emu_glTextureImage2DEXT(GLuint texture, GLenum target, GL
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaTexture( _context, target, texture );
-        _dispatch.call(&_dispatch.glTexImage2D)( target, level, internalformat, width, height, border, format, type, pixels );
+        _dispatch.call(&_dispatch.glTexParameterIuiv)( target, pname, params );
         return;
       }
       #endif
@@ -63816,7 +69562,7 @@ static void REGAL_CALL emu_glTextureImage2DEXT(GLuint texture, GLenum target, GL
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glTextureImage2DEXT)(texture, target, level, internalformat, width, height, border, format, type, pixels);
+      _next->call(&_next->glTextureParameterIuivEXT)(texture, target, pname, params);
       break;
     }
 
@@ -63824,7 +69570,7 @@ static void REGAL_CALL emu_glTextureImage2DEXT(GLuint texture, GLenum target, GL
 
 }
 
-static void REGAL_CALL emu_glTextureImage3DEXT(GLuint texture, GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const GLvoid *pixels)
+static void REGAL_CALL emu_glTextureParameterfEXT(GLuint texture, GLenum target, GLenum pname, GLfloat param)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -63848,7 +69594,7 @@ static void REGAL_CALL emu_glTextureImage3DEXT(GLuint texture, GLenum target, GL
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->ShadowTextureInfo( texture, target, internalformat );
+        _context->iff->FlushBatch( _context );
       }
       #endif
     case 6 :
@@ -63884,7 +69630,7 @@ static void REGAL_CALL emu_glTextureImage3DEXT(GLuint texture, GLenum target, GL
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaTexture( _context, target, texture );
-        _dispatch.call(&_dispatch.glTexImage3D)( target, level, internalformat, width, height, depth, border, format, type, pixels );
+        _dispatch.call(&_dispatch.glTexParameterf)( target, pname, param );
         return;
       }
       #endif
@@ -63893,7 +69639,7 @@ static void REGAL_CALL emu_glTextureImage3DEXT(GLuint texture, GLenum target, GL
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glTextureImage3DEXT)(texture, target, level, internalformat, width, height, depth, border, format, type, pixels);
+      _next->call(&_next->glTextureParameterfEXT)(texture, target, pname, param);
       break;
     }
 
@@ -63901,7 +69647,7 @@ static void REGAL_CALL emu_glTextureImage3DEXT(GLuint texture, GLenum target, GL
 
 }
 
-static void REGAL_CALL emu_glTextureParameterIivEXT(GLuint texture, GLenum target, GLenum pname, const GLint *params)
+static void REGAL_CALL emu_glTextureParameterfvEXT(GLuint texture, GLenum target, GLenum pname, const GLfloat *params)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -63920,75 +69666,14 @@ static void REGAL_CALL emu_glTextureParameterIivEXT(GLuint texture, GLenum targe
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa) break;
-      #endif
-    case 1 :
-    default:
-      break;
-  }
-
-  // impl
-  switch( _context->emuLevel )
-  {
-    case 16 :
-    case 15 :
-    case 14 :
-    case 13 :
-    case 12 :
-    case 11 :
-    case 10 :
-    case 9 :
-    case 8 :
-    case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        _context->dsa->DsaTexture( _context, target, texture );
-        _dispatch.call(&_dispatch.glTexParameterIiv)( target, pname, params );
-        return;
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
       }
       #endif
-    case 1 :
-    default:
-    {
-      DispatchTableGL *_next = _dispatch.next();
-      RegalAssert(_next);
-      _next->call(&_next->glTextureParameterIivEXT)(texture, target, pname, params);
-      break;
-    }
-
-  }
-
-}
-
-static void REGAL_CALL emu_glTextureParameterIuivEXT(GLuint texture, GLenum target, GLenum pname, const GLuint *params)
-{
-  RegalContext *_context = REGAL_GET_CONTEXT();
-  RegalAssert(_context);
-  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
-
-  // prefix
-  switch( _context->emuLevel )
-  {
-    case 16 :
-    case 15 :
-    case 14 :
-    case 13 :
-    case 12 :
-    case 11 :
-    case 10 :
-    case 9 :
-    case 8 :
-    case 7 :
     case 6 :
     case 5 :
     case 4 :
@@ -64022,7 +69707,7 @@ static void REGAL_CALL emu_glTextureParameterIuivEXT(GLuint texture, GLenum targ
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaTexture( _context, target, texture );
-        _dispatch.call(&_dispatch.glTexParameterIuiv)( target, pname, params );
+        _dispatch.call(&_dispatch.glTexParameterfv)( target, pname, params );
         return;
       }
       #endif
@@ -64031,7 +69716,7 @@ static void REGAL_CALL emu_glTextureParameterIuivEXT(GLuint texture, GLenum targ
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glTextureParameterIuivEXT)(texture, target, pname, params);
+      _next->call(&_next->glTextureParameterfvEXT)(texture, target, pname, params);
       break;
     }
 
@@ -64039,7 +69724,7 @@ static void REGAL_CALL emu_glTextureParameterIuivEXT(GLuint texture, GLenum targ
 
 }
 
-static void REGAL_CALL emu_glTextureParameterfEXT(GLuint texture, GLenum target, GLenum pname, GLfloat param)
+static void REGAL_CALL emu_glTextureParameteriEXT(GLuint texture, GLenum target, GLenum pname, GLint param)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -64058,75 +69743,14 @@ static void REGAL_CALL emu_glTextureParameterfEXT(GLuint texture, GLenum target,
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa) break;
-      #endif
-    case 1 :
-    default:
-      break;
-  }
-
-  // impl
-  switch( _context->emuLevel )
-  {
-    case 16 :
-    case 15 :
-    case 14 :
-    case 13 :
-    case 12 :
-    case 11 :
-    case 10 :
-    case 9 :
-    case 8 :
-    case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        _context->dsa->DsaTexture( _context, target, texture );
-        _dispatch.call(&_dispatch.glTexParameterf)( target, pname, param );
-        return;
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
       }
       #endif
-    case 1 :
-    default:
-    {
-      DispatchTableGL *_next = _dispatch.next();
-      RegalAssert(_next);
-      _next->call(&_next->glTextureParameterfEXT)(texture, target, pname, param);
-      break;
-    }
-
-  }
-
-}
-
-static void REGAL_CALL emu_glTextureParameterfvEXT(GLuint texture, GLenum target, GLenum pname, const GLfloat *params)
-{
-  RegalContext *_context = REGAL_GET_CONTEXT();
-  RegalAssert(_context);
-  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
-
-  // prefix
-  switch( _context->emuLevel )
-  {
-    case 16 :
-    case 15 :
-    case 14 :
-    case 13 :
-    case 12 :
-    case 11 :
-    case 10 :
-    case 9 :
-    case 8 :
-    case 7 :
     case 6 :
     case 5 :
     case 4 :
@@ -64160,7 +69784,7 @@ static void REGAL_CALL emu_glTextureParameterfvEXT(GLuint texture, GLenum target
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
         _context->dsa->DsaTexture( _context, target, texture );
-        _dispatch.call(&_dispatch.glTexParameterfv)( target, pname, params );
+        _dispatch.call(&_dispatch.glTexParameteri)( target, pname, param );
         return;
       }
       #endif
@@ -64169,7 +69793,7 @@ static void REGAL_CALL emu_glTextureParameterfvEXT(GLuint texture, GLenum target
     {
       DispatchTableGL *_next = _dispatch.next();
       RegalAssert(_next);
-      _next->call(&_next->glTextureParameterfvEXT)(texture, target, pname, params);
+      _next->call(&_next->glTextureParameteriEXT)(texture, target, pname, param);
       break;
     }
 
@@ -64177,7 +69801,7 @@ static void REGAL_CALL emu_glTextureParameterfvEXT(GLuint texture, GLenum target
 
 }
 
-static void REGAL_CALL emu_glTextureParameteriEXT(GLuint texture, GLenum target, GLenum pname, GLint param)
+static void REGAL_CALL emu_glTextureParameterivEXT(GLuint texture, GLenum target, GLenum pname, const GLint *params)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -64196,75 +69820,14 @@ static void REGAL_CALL emu_glTextureParameteriEXT(GLuint texture, GLenum target,
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa) break;
-      #endif
-    case 1 :
-    default:
-      break;
-  }
-
-  // impl
-  switch( _context->emuLevel )
-  {
-    case 16 :
-    case 15 :
-    case 14 :
-    case 13 :
-    case 12 :
-    case 11 :
-    case 10 :
-    case 9 :
-    case 8 :
-    case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        _context->dsa->DsaTexture( _context, target, texture );
-        _dispatch.call(&_dispatch.glTexParameteri)( target, pname, param );
-        return;
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
       }
       #endif
-    case 1 :
-    default:
-    {
-      DispatchTableGL *_next = _dispatch.next();
-      RegalAssert(_next);
-      _next->call(&_next->glTextureParameteriEXT)(texture, target, pname, param);
-      break;
-    }
-
-  }
-
-}
-
-static void REGAL_CALL emu_glTextureParameterivEXT(GLuint texture, GLenum target, GLenum pname, const GLint *params)
-{
-  RegalContext *_context = REGAL_GET_CONTEXT();
-  RegalAssert(_context);
-  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
-
-  // prefix
-  switch( _context->emuLevel )
-  {
-    case 16 :
-    case 15 :
-    case 14 :
-    case 13 :
-    case 12 :
-    case 11 :
-    case 10 :
-    case 9 :
-    case 8 :
-    case 7 :
     case 6 :
     case 5 :
     case 4 :
@@ -64334,6 +69897,14 @@ static void REGAL_CALL emu_glTextureRenderbufferEXT(GLuint texture, GLenum targe
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -64403,6 +69974,14 @@ static void REGAL_CALL emu_glTextureSubImage1DEXT(GLuint texture, GLenum target,
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -64472,6 +70051,14 @@ static void REGAL_CALL emu_glTextureSubImage2DEXT(GLuint texture, GLenum target,
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -64541,6 +70128,14 @@ static void REGAL_CALL emu_glTextureSubImage3DEXT(GLuint texture, GLenum target,
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -64616,6 +70211,15 @@ static GLboolean REGAL_CALL emu_glUnmapNamedBufferEXT(GLuint buffer)
       #if REGAL_EMU_DSA
       if (_context->dsa) break;
       #endif
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -65597,6 +71201,55 @@ static void REGAL_CALL emu_glVertexArrayVertexOffsetEXT(GLuint vaobj, GLuint buf
 
 // GL_EXT_disjoint_timer_query
 
+static void REGAL_CALL emu_glGetQueryObjectivEXT(GLuint id, GLenum pname, GLint *params)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->QueryBufferWrite();
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glGetQueryObjectivEXT)(id, pname, params);
+}
+
 // GL_EXT_draw_buffers2
 
 static void REGAL_CALL emu_glColorMaskIndexedEXT(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a)
@@ -65750,6 +71403,7 @@ static void REGAL_CALL emu_glDisableIndexedEXT(GLenum target, GLuint index)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->DisableIndexed( target, index );
         return;
       }
@@ -65870,6 +71524,7 @@ static void REGAL_CALL emu_glEnableIndexedEXT(GLenum target, GLuint index)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->EnableIndexed( target, index );
         return;
       }
@@ -66193,6 +71848,7 @@ static void REGAL_CALL emu_glDrawArraysInstancedEXT(GLenum mode, GLint start, GL
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
         _context->iff->PreDraw( _context );
       }
       #endif
@@ -66216,6 +71872,15 @@ static void REGAL_CALL emu_glDrawArraysInstancedEXT(GLenum mode, GLint start, GL
         _context->dsa->Restore( _context );
       }
       #endif
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->DrawArrays(*_context, start, count );
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -66250,6 +71915,7 @@ static void REGAL_CALL emu_glDrawElementsInstancedEXT(GLenum mode, GLsizei count
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
         _context->iff->PreDraw( _context );
       }
       #endif
@@ -66309,6 +71975,7 @@ static void REGAL_CALL emu_glDrawRangeElementsEXT(GLenum mode, GLuint start, GLu
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
         _context->iff->PreDraw( _context );
       }
       #endif
@@ -66387,6 +72054,7 @@ static void REGAL_CALL emu_glFogCoordPointerEXT(GLenum type, GLsizei stride, con
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
         _context->iff->FogCoordPointer( _context, type, stride, pointer );
         return;
       }
@@ -66440,6 +72108,14 @@ static void REGAL_CALL emu_glBlitFramebufferEXT(GLint srcX0, GLint srcY0, GLint
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -66561,6 +72237,14 @@ static void REGAL_CALL emu_glBindFramebufferEXT(GLenum target, GLuint framebuffe
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -66652,6 +72336,14 @@ static void REGAL_CALL emu_glBindRenderbufferEXT(GLenum target, GLuint renderbuf
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -66988,6 +72680,14 @@ static void REGAL_CALL emu_glFramebufferRenderbufferEXT(GLenum target, GLenum at
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -67076,6 +72776,14 @@ static void REGAL_CALL emu_glFramebufferTexture1DEXT(GLenum target, GLenum attac
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -67173,6 +72881,14 @@ static void REGAL_CALL emu_glFramebufferTexture2DEXT(GLenum target, GLenum attac
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -67270,6 +72986,14 @@ static void REGAL_CALL emu_glFramebufferTexture3DEXT(GLenum target, GLenum attac
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -67518,6 +73242,14 @@ static void REGAL_CALL emu_glGenerateMipmapEXT(GLenum target)
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -68030,6 +73762,14 @@ static void REGAL_CALL emu_glFramebufferTextureEXT(GLenum target, GLenum attachm
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -68070,6 +73810,14 @@ static void REGAL_CALL emu_glFramebufferTextureFaceEXT(GLenum target, GLenum att
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -68135,6 +73883,15 @@ static void REGAL_CALL emu_glFlushMappedBufferRangeEXT(GLenum target, GLintptr o
         _context->dsa->RestoreBuffer( _context );
       }
       #endif
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -68175,6 +73932,15 @@ static void *REGAL_CALL emu_glMapBufferRangeEXT(GLenum target, GLintptr offset,
         _context->dsa->RestoreBuffer( _context );
       }
       #endif
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->MapBufferRange( access );
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -68211,6 +73977,7 @@ static void REGAL_CALL emu_glMultiDrawArraysEXT(GLenum mode, const GLint *first,
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
         _context->iff->PreDraw( _context );
       }
       #endif
@@ -68234,6 +74001,15 @@ static void REGAL_CALL emu_glMultiDrawArraysEXT(GLenum mode, const GLint *first,
         _context->dsa->Restore( _context );
       }
       #endif
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->MultiDrawArrays(*_context, first, count, primcount );
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -68268,6 +74044,7 @@ static void REGAL_CALL emu_glMultiDrawElementsEXT(GLenum mode, const GLsizei *co
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
         _context->iff->PreDraw( _context );
       }
       #endif
@@ -68403,6 +74180,55 @@ static void REGAL_CALL emu_glGetIntegeri_vEXT(GLenum target, GLuint index, GLint
 
 // GL_EXT_occlusion_query_boolean
 
+static void REGAL_CALL emu_glGetQueryObjectuivEXT(GLuint id, GLenum pname, GLuint *params)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->QueryBufferWrite();
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glGetQueryObjectuivEXT)(id, pname, params);
+}
+
 // GL_EXT_paletted_texture
 
 // GL_EXT_pixel_transform
@@ -68453,6 +74279,47 @@ static void REGAL_CALL emu_glProvokingVertexEXT(GLenum mode)
 
 // GL_EXT_robustness
 
+static void REGAL_CALL emu_glReadnPixelsEXT(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, GLvoid *data)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glReadnPixelsEXT)(x, y, width, height, format, type, bufSize, data);
+}
+
 // GL_EXT_scene_marker
 
 // GL_EXT_secondary_color
@@ -69501,6 +75368,7 @@ static void REGAL_CALL emu_glSecondaryColorPointerEXT(GLint size, GLenum type, G
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
         _context->iff->SecondaryColorPointer( _context, size, type, stride, pointer );
         return;
       }
@@ -69535,6 +75403,55 @@ static void REGAL_CALL emu_glSecondaryColorPointerEXT(GLint size, GLenum type, G
 
 // GL_EXT_shader_image_load_store
 
+static void REGAL_CALL emu_glMemoryBarrierEXT(GLbitfield barriers)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glMemoryBarrierEXT)(barriers);
+}
+
 // GL_EXT_stencil_clear_tag
 
 // GL_EXT_stencil_two_side
@@ -69621,6 +75538,7 @@ static void REGAL_CALL emu_glTexImage3DEXT(GLenum target, GLint level, GLenum in
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->ShadowTexInfo( target, internalformat );
       }
       #endif
@@ -69655,6 +75573,14 @@ static void REGAL_CALL emu_glFramebufferTextureLayerEXT(GLenum target, GLenum at
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -69844,6 +75770,7 @@ static void REGAL_CALL emu_glBindTextureEXT(GLenum target, GLuint texture)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->ShadowTexBinding( target, texture );
       }
       #endif
@@ -69927,6 +75854,14 @@ static void REGAL_CALL emu_glDeleteTexturesEXT(GLsizei n, const GLuint *textures
     case 9 :
     case 8 :
     case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
     case 6 :
     case 5 :
     case 4 :
@@ -70007,36 +75942,339 @@ static void REGAL_CALL emu_glGenTexturesEXT(GLsizei n, GLuint *textures)
     case 5 :
     case 4 :
     case 3 :
-    case 2 :
-      #if REGAL_EMU_TEXC
-      if (_context->texc)
+    case 2 :
+      #if REGAL_EMU_TEXC
+      if (_context->texc)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 1;
+
+        _context->dispatcher.emulation.glGenTextures( n, textures );
+        _context->texc->ShadowGenTextures( n, textures );
+        return;
+      }
+      #endif
+    case 1 :
+    default:
+    {
+      DispatchTableGL *_next = _dispatch.next();
+      RegalAssert(_next);
+      _next->call(&_next->glGenTexturesEXT)(n, textures);
+      break;
+    }
+
+  }
+
+}
+
+// GL_EXT_texture_perturb_normal
+
+// GL_EXT_texture_storage
+
+static void REGAL_CALL emu_glTexStorage1DEXT(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+      #if REGAL_EMU_TEXSTO
+      if (_context->texsto) break;
+      #endif
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  // impl
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+      #if REGAL_EMU_TEXSTO
+      if (_context->texsto)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 9;
+        _context->texsto->TextureStorage( _context, target, levels, internalformat, width );
+        return;
+      }
+      #endif
+    case 1 :
+    default:
+    {
+      DispatchTableGL *_next = _dispatch.next();
+      RegalAssert(_next);
+      _next->call(&_next->glTexStorage1DEXT)(target, levels, internalformat, width);
+      break;
+    }
+
+  }
+
+}
+
+static void REGAL_CALL emu_glTexStorage2DEXT(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+      #if REGAL_EMU_TEXSTO
+      if (_context->texsto) break;
+      #endif
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  // impl
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+      #if REGAL_EMU_TEXSTO
+      if (_context->texsto)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 9;
+        _context->texsto->TextureStorage( _context, target, levels, internalformat, width, height );
+        return;
+      }
+      #endif
+    case 1 :
+    default:
+    {
+      DispatchTableGL *_next = _dispatch.next();
+      RegalAssert(_next);
+      _next->call(&_next->glTexStorage2DEXT)(target, levels, internalformat, width, height);
+      break;
+    }
+
+  }
+
+}
+
+static void REGAL_CALL emu_glTexStorage3DEXT(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+      #if REGAL_EMU_TEXSTO
+      if (_context->texsto) break;
+      #endif
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  // impl
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+      #if REGAL_EMU_TEXSTO
+      if (_context->texsto)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 9;
+        _context->texsto->TextureStorage( _context, target, levels, internalformat, width, height, depth );
+        return;
+      }
+      #endif
+    case 1 :
+    default:
+    {
+      DispatchTableGL *_next = _dispatch.next();
+      RegalAssert(_next);
+      _next->call(&_next->glTexStorage3DEXT)(target, levels, internalformat, width, height, depth);
+      break;
+    }
+
+  }
+
+}
+
+// GL_EXT_timer_query
+
+static void REGAL_CALL emu_glGetQueryObjecti64vEXT(GLuint id, GLenum pname, GLint64EXT *params)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->QueryBufferWrite();
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glGetQueryObjecti64vEXT)(id, pname, params);
+}
+
+static void REGAL_CALL emu_glGetQueryObjectui64vEXT(GLuint id, GLenum pname, GLuint64EXT *params)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+      }
+      #endif
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 1;
-
-        _context->dispatcher.emulation.glGenTextures( n, textures );
-        _context->texc->ShadowGenTextures( n, textures );
-        return;
+        _context->emuLevel = 2;
+        _context->vao->QueryBufferWrite();
       }
       #endif
     case 1 :
     default:
-    {
-      DispatchTableGL *_next = _dispatch.next();
-      RegalAssert(_next);
-      _next->call(&_next->glGenTexturesEXT)(n, textures);
       break;
-    }
-
   }
 
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glGetQueryObjectui64vEXT)(id, pname, params);
 }
 
-// GL_EXT_texture_perturb_normal
-
-// GL_EXT_texture_storage
+// GL_EXT_transform_feedback
 
-static void REGAL_CALL emu_glTexStorage1DEXT(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width)
+static void REGAL_CALL emu_glBeginTransformFeedbackEXT(GLenum primitiveMode)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -70052,47 +76290,32 @@ static void REGAL_CALL emu_glTexStorage1DEXT(GLenum target, GLsizei levels, GLen
     case 12 :
     case 11 :
     case 10 :
-      #if REGAL_EMU_TEXSTO
-      if (_context->texsto) break;
-      #endif
-    case 1 :
-    default:
-      break;
-  }
-
-  // impl
-  switch( _context->emuLevel )
-  {
-    case 16 :
-    case 15 :
-    case 14 :
-    case 13 :
-    case 12 :
-    case 11 :
-    case 10 :
-      #if REGAL_EMU_TEXSTO
-      if (_context->texsto)
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 9;
-        _context->texsto->TextureStorage( _context, target, levels, internalformat, width );
-        return;
+        _context->emuLevel = 2;
+        _context->vao->TransformFeedback( true );
       }
       #endif
     case 1 :
     default:
-    {
-      DispatchTableGL *_next = _dispatch.next();
-      RegalAssert(_next);
-      _next->call(&_next->glTexStorage1DEXT)(target, levels, internalformat, width);
       break;
-    }
-
   }
 
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glBeginTransformFeedbackEXT)(primitiveMode);
 }
 
-static void REGAL_CALL emu_glTexStorage2DEXT(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height)
+static void REGAL_CALL emu_glBindBufferBaseEXT(GLenum target, GLuint index, GLuint buffer)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -70108,15 +76331,35 @@ static void REGAL_CALL emu_glTexStorage2DEXT(GLenum target, GLsizei levels, GLen
     case 12 :
     case 11 :
     case 10 :
-      #if REGAL_EMU_TEXSTO
-      if (_context->texsto) break;
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
+        _context->iff->ShadowBindBuffer( target, buffer );
+      }
       #endif
     case 1 :
     default:
       break;
   }
 
-  // impl
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glBindBufferBaseEXT)(target, index, buffer);
+}
+
+static void REGAL_CALL emu_glBindBufferOffsetEXT(GLenum target, GLuint index, GLuint buffer, GLintptr offset)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
   switch( _context->emuLevel )
   {
     case 16 :
@@ -70126,29 +76369,29 @@ static void REGAL_CALL emu_glTexStorage2DEXT(GLenum target, GLsizei levels, GLen
     case 12 :
     case 11 :
     case 10 :
-      #if REGAL_EMU_TEXSTO
-      if (_context->texsto)
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 9;
-        _context->texsto->TextureStorage( _context, target, levels, internalformat, width, height );
-        return;
+        _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
+        _context->iff->ShadowBindBuffer( target, buffer );
       }
       #endif
     case 1 :
     default:
-    {
-      DispatchTableGL *_next = _dispatch.next();
-      RegalAssert(_next);
-      _next->call(&_next->glTexStorage2DEXT)(target, levels, internalformat, width, height);
       break;
-    }
-
   }
 
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glBindBufferOffsetEXT)(target, index, buffer, offset);
 }
 
-static void REGAL_CALL emu_glTexStorage3DEXT(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth)
+static void REGAL_CALL emu_glBindBufferRangeEXT(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -70164,15 +76407,35 @@ static void REGAL_CALL emu_glTexStorage3DEXT(GLenum target, GLsizei levels, GLen
     case 12 :
     case 11 :
     case 10 :
-      #if REGAL_EMU_TEXSTO
-      if (_context->texsto) break;
+    case 9 :
+    case 8 :
+    case 7 :
+      #if REGAL_EMU_IFF
+      if (_context->iff)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
+        _context->iff->ShadowBindBuffer( target, buffer );
+      }
       #endif
     case 1 :
     default:
       break;
   }
 
-  // impl
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glBindBufferRangeEXT)(target, index, buffer, offset, size);
+}
+
+static void REGAL_CALL emu_glEndTransformFeedbackEXT(void)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
   switch( _context->emuLevel )
   {
     case 16 :
@@ -70182,32 +76445,31 @@ static void REGAL_CALL emu_glTexStorage3DEXT(GLenum target, GLsizei levels, GLen
     case 12 :
     case 11 :
     case 10 :
-      #if REGAL_EMU_TEXSTO
-      if (_context->texsto)
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 9;
-        _context->texsto->TextureStorage( _context, target, levels, internalformat, width, height, depth );
-        return;
+        _context->emuLevel = 2;
+        _context->vao->TransformFeedback( false );
       }
       #endif
     case 1 :
     default:
-    {
-      DispatchTableGL *_next = _dispatch.next();
-      RegalAssert(_next);
-      _next->call(&_next->glTexStorage3DEXT)(target, levels, internalformat, width, height, depth);
       break;
-    }
-
   }
 
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glEndTransformFeedbackEXT)();
 }
 
-// GL_EXT_timer_query
-
-// GL_EXT_transform_feedback
-
 // GL_EXT_vertex_array
 
 static void REGAL_CALL emu_glArrayElementEXT(GLint i)
@@ -70324,6 +76586,7 @@ static void REGAL_CALL emu_glColorPointerEXT(GLint size, GLenum type, GLsizei st
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
         _context->iff->ColorPointer( _context, size, type, stride, pointer );
         return;
       }
@@ -70378,6 +76641,7 @@ static void REGAL_CALL emu_glDrawArraysEXT(GLenum mode, GLint first, GLsizei cou
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
         _context->iff->PreDraw( _context );
       }
       #endif
@@ -70404,6 +76668,15 @@ static void REGAL_CALL emu_glDrawArraysEXT(GLenum mode, GLint first, GLsizei cou
         _context->dsa->Restore( _context );
       }
       #endif
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->DrawArrays(*_context, first, count );
+      }
+      #endif
     case 1 :
     default:
       break;
@@ -70494,6 +76767,7 @@ static void REGAL_CALL emu_glEdgeFlagPointerEXT(GLsizei stride, GLsizei count, c
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
         _context->iff->EdgeFlagPointer( _context, stride, pointer );
         return;
       }
@@ -70563,6 +76837,7 @@ static void REGAL_CALL emu_glNormalPointerEXT(GLenum type, GLsizei stride, GLsiz
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
         _context->iff->NormalPointer( _context, type, stride, pointer );
         return;
       }
@@ -70645,6 +76920,7 @@ static void REGAL_CALL emu_glTexCoordPointerEXT(GLint size, GLenum type, GLsizei
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
         _context->iff->TexCoordPointer( _context, size, type, stride, pointer );
         return;
       }
@@ -70727,6 +77003,7 @@ static void REGAL_CALL emu_glVertexPointerEXT(GLint size, GLenum type, GLsizei s
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
         _context->iff->VertexPointer( _context, size, type, stride, pointer );
         return;
       }
@@ -70791,6 +77068,47 @@ static void REGAL_CALL emu_glVertexPointerEXT(GLint size, GLenum type, GLsizei s
 
 // GL_KHR_robustness
 
+static void REGAL_CALL emu_glReadnPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, GLvoid *data)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->BufferWrite();
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glReadnPixels)(x, y, width, height, format, type, bufSize, data);
+}
+
 // GL_KTX_buffer_region
 
 // GL_MESA_resize_buffers
@@ -70899,8 +77217,300 @@ static void REGAL_CALL emu_glTexRenderbufferNV(GLenum target, GLuint renderbuffe
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
-        _context->dsa->RestoreTexture( _context );
-        _context->dsa->RestoreActiveTexture( _context );
+        _context->dsa->RestoreTexture( _context );
+        _context->dsa->RestoreActiveTexture( _context );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glTexRenderbufferNV)(target, renderbuffer);
+}
+
+// GL_NV_fence
+
+// GL_NV_fragment_program
+
+// GL_NV_framebuffer_blit
+
+// GL_NV_framebuffer_multisample_coverage
+
+static void REGAL_CALL emu_glRenderbufferStorageMultisampleCoverageNV(GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLenum internalformat, GLsizei width, GLsizei height)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 3;
+        _context->dsa->RestoreRenderbuffer( _context );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glRenderbufferStorageMultisampleCoverageNV)(target, coverageSamples, colorSamples, internalformat, width, height);
+}
+
+// GL_NV_geometry_program4
+
+// GL_NV_gpu_program4
+
+static void REGAL_CALL emu_glGetProgramEnvParameterIivNV(GLenum target, GLuint index, GLint *params)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 3;
+        _context->dsa->RestoreAsmProgram( _context, target );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glGetProgramEnvParameterIivNV)(target, index, params);
+}
+
+static void REGAL_CALL emu_glGetProgramEnvParameterIuivNV(GLenum target, GLuint index, GLuint *params)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 3;
+        _context->dsa->RestoreAsmProgram( _context, target );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glGetProgramEnvParameterIuivNV)(target, index, params);
+}
+
+static void REGAL_CALL emu_glGetProgramLocalParameterIivNV(GLenum target, GLuint index, GLint *params)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 3;
+        _context->dsa->RestoreAsmProgram( _context, target );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glGetProgramLocalParameterIivNV)(target, index, params);
+}
+
+static void REGAL_CALL emu_glGetProgramLocalParameterIuivNV(GLenum target, GLuint index, GLuint *params)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 3;
+        _context->dsa->RestoreAsmProgram( _context, target );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glGetProgramLocalParameterIuivNV)(target, index, params);
+}
+
+static void REGAL_CALL emu_glProgramEnvParameterI4iNV(GLenum target, GLuint index, GLint x, GLint y, GLint z, GLint w)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 3;
+        _context->dsa->RestoreAsmProgram( _context, target );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glProgramEnvParameterI4iNV)(target, index, x, y, z, w);
+}
+
+static void REGAL_CALL emu_glProgramEnvParameterI4ivNV(GLenum target, GLuint index, const GLint *params)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+      #if REGAL_EMU_DSA
+      if (_context->dsa)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 3;
+        _context->dsa->RestoreAsmProgram( _context, target );
       }
       #endif
     case 1 :
@@ -70910,18 +77520,10 @@ static void REGAL_CALL emu_glTexRenderbufferNV(GLenum target, GLuint renderbuffe
 
   DispatchTableGL *_next = _dispatch.next();
   RegalAssert(_next);
-  _next->call(& _next->glTexRenderbufferNV)(target, renderbuffer);
+  _next->call(& _next->glProgramEnvParameterI4ivNV)(target, index, params);
 }
 
-// GL_NV_fence
-
-// GL_NV_fragment_program
-
-// GL_NV_framebuffer_blit
-
-// GL_NV_framebuffer_multisample_coverage
-
-static void REGAL_CALL emu_glRenderbufferStorageMultisampleCoverageNV(GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLenum internalformat, GLsizei width, GLsizei height)
+static void REGAL_CALL emu_glProgramEnvParameterI4uiNV(GLenum target, GLuint index, GLuint x, GLuint y, GLuint z, GLuint w)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -70948,7 +77550,7 @@ static void REGAL_CALL emu_glRenderbufferStorageMultisampleCoverageNV(GLenum tar
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 3;
-        _context->dsa->RestoreRenderbuffer( _context );
+        _context->dsa->RestoreAsmProgram( _context, target );
       }
       #endif
     case 1 :
@@ -70958,14 +77560,10 @@ static void REGAL_CALL emu_glRenderbufferStorageMultisampleCoverageNV(GLenum tar
 
   DispatchTableGL *_next = _dispatch.next();
   RegalAssert(_next);
-  _next->call(& _next->glRenderbufferStorageMultisampleCoverageNV)(target, coverageSamples, colorSamples, internalformat, width, height);
+  _next->call(& _next->glProgramEnvParameterI4uiNV)(target, index, x, y, z, w);
 }
 
-// GL_NV_geometry_program4
-
-// GL_NV_gpu_program4
-
-static void REGAL_CALL emu_glGetProgramEnvParameterIivNV(GLenum target, GLuint index, GLint *params)
+static void REGAL_CALL emu_glProgramEnvParameterI4uivNV(GLenum target, GLuint index, const GLuint *params)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -71002,10 +77600,10 @@ static void REGAL_CALL emu_glGetProgramEnvParameterIivNV(GLenum target, GLuint i
 
   DispatchTableGL *_next = _dispatch.next();
   RegalAssert(_next);
-  _next->call(& _next->glGetProgramEnvParameterIivNV)(target, index, params);
+  _next->call(& _next->glProgramEnvParameterI4uivNV)(target, index, params);
 }
 
-static void REGAL_CALL emu_glGetProgramEnvParameterIuivNV(GLenum target, GLuint index, GLuint *params)
+static void REGAL_CALL emu_glProgramEnvParametersI4ivNV(GLenum target, GLuint index, GLsizei count, const GLint *params)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -71042,10 +77640,10 @@ static void REGAL_CALL emu_glGetProgramEnvParameterIuivNV(GLenum target, GLuint
 
   DispatchTableGL *_next = _dispatch.next();
   RegalAssert(_next);
-  _next->call(& _next->glGetProgramEnvParameterIuivNV)(target, index, params);
+  _next->call(& _next->glProgramEnvParametersI4ivNV)(target, index, count, params);
 }
 
-static void REGAL_CALL emu_glGetProgramLocalParameterIivNV(GLenum target, GLuint index, GLint *params)
+static void REGAL_CALL emu_glProgramEnvParametersI4uivNV(GLenum target, GLuint index, GLsizei count, const GLuint *params)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -71082,10 +77680,10 @@ static void REGAL_CALL emu_glGetProgramLocalParameterIivNV(GLenum target, GLuint
 
   DispatchTableGL *_next = _dispatch.next();
   RegalAssert(_next);
-  _next->call(& _next->glGetProgramLocalParameterIivNV)(target, index, params);
+  _next->call(& _next->glProgramEnvParametersI4uivNV)(target, index, count, params);
 }
 
-static void REGAL_CALL emu_glGetProgramLocalParameterIuivNV(GLenum target, GLuint index, GLuint *params)
+static void REGAL_CALL emu_glProgramLocalParameterI4iNV(GLenum target, GLuint index, GLint x, GLint y, GLint z, GLint w)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -71122,10 +77720,10 @@ static void REGAL_CALL emu_glGetProgramLocalParameterIuivNV(GLenum target, GLuin
 
   DispatchTableGL *_next = _dispatch.next();
   RegalAssert(_next);
-  _next->call(& _next->glGetProgramLocalParameterIuivNV)(target, index, params);
+  _next->call(& _next->glProgramLocalParameterI4iNV)(target, index, x, y, z, w);
 }
 
-static void REGAL_CALL emu_glProgramEnvParameterI4iNV(GLenum target, GLuint index, GLint x, GLint y, GLint z, GLint w)
+static void REGAL_CALL emu_glProgramLocalParameterI4ivNV(GLenum target, GLuint index, const GLint *params)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -71162,10 +77760,10 @@ static void REGAL_CALL emu_glProgramEnvParameterI4iNV(GLenum target, GLuint inde
 
   DispatchTableGL *_next = _dispatch.next();
   RegalAssert(_next);
-  _next->call(& _next->glProgramEnvParameterI4iNV)(target, index, x, y, z, w);
+  _next->call(& _next->glProgramLocalParameterI4ivNV)(target, index, params);
 }
 
-static void REGAL_CALL emu_glProgramEnvParameterI4ivNV(GLenum target, GLuint index, const GLint *params)
+static void REGAL_CALL emu_glProgramLocalParameterI4uiNV(GLenum target, GLuint index, GLuint x, GLuint y, GLuint z, GLuint w)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -71202,10 +77800,10 @@ static void REGAL_CALL emu_glProgramEnvParameterI4ivNV(GLenum target, GLuint ind
 
   DispatchTableGL *_next = _dispatch.next();
   RegalAssert(_next);
-  _next->call(& _next->glProgramEnvParameterI4ivNV)(target, index, params);
+  _next->call(& _next->glProgramLocalParameterI4uiNV)(target, index, x, y, z, w);
 }
 
-static void REGAL_CALL emu_glProgramEnvParameterI4uiNV(GLenum target, GLuint index, GLuint x, GLuint y, GLuint z, GLuint w)
+static void REGAL_CALL emu_glProgramLocalParameterI4uivNV(GLenum target, GLuint index, const GLuint *params)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -71242,10 +77840,10 @@ static void REGAL_CALL emu_glProgramEnvParameterI4uiNV(GLenum target, GLuint ind
 
   DispatchTableGL *_next = _dispatch.next();
   RegalAssert(_next);
-  _next->call(& _next->glProgramEnvParameterI4uiNV)(target, index, x, y, z, w);
+  _next->call(& _next->glProgramLocalParameterI4uivNV)(target, index, params);
 }
 
-static void REGAL_CALL emu_glProgramEnvParameterI4uivNV(GLenum target, GLuint index, const GLuint *params)
+static void REGAL_CALL emu_glProgramLocalParametersI4ivNV(GLenum target, GLuint index, GLsizei count, const GLint *params)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -71282,10 +77880,10 @@ static void REGAL_CALL emu_glProgramEnvParameterI4uivNV(GLenum target, GLuint in
 
   DispatchTableGL *_next = _dispatch.next();
   RegalAssert(_next);
-  _next->call(& _next->glProgramEnvParameterI4uivNV)(target, index, params);
+  _next->call(& _next->glProgramLocalParametersI4ivNV)(target, index, count, params);
 }
 
-static void REGAL_CALL emu_glProgramEnvParametersI4ivNV(GLenum target, GLuint index, GLsizei count, const GLint *params)
+static void REGAL_CALL emu_glProgramLocalParametersI4uivNV(GLenum target, GLuint index, GLsizei count, const GLuint *params)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -71322,90 +77920,42 @@ static void REGAL_CALL emu_glProgramEnvParametersI4ivNV(GLenum target, GLuint in
 
   DispatchTableGL *_next = _dispatch.next();
   RegalAssert(_next);
-  _next->call(& _next->glProgramEnvParametersI4ivNV)(target, index, count, params);
+  _next->call(& _next->glProgramLocalParametersI4uivNV)(target, index, count, params);
 }
 
-static void REGAL_CALL emu_glProgramEnvParametersI4uivNV(GLenum target, GLuint index, GLsizei count, const GLuint *params)
-{
-  RegalContext *_context = REGAL_GET_CONTEXT();
-  RegalAssert(_context);
-  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+// GL_NV_gpu_shader5
 
-  // prefix
-  switch( _context->emuLevel )
-  {
-    case 16 :
-    case 15 :
-    case 14 :
-    case 13 :
-    case 12 :
-    case 11 :
-    case 10 :
-    case 9 :
-    case 8 :
-    case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        _context->dsa->RestoreAsmProgram( _context, target );
-      }
-      #endif
-    case 1 :
-    default:
-      break;
-  }
+// GL_NV_half_float
 
-  DispatchTableGL *_next = _dispatch.next();
-  RegalAssert(_next);
-  _next->call(& _next->glProgramEnvParametersI4uivNV)(target, index, count, params);
-}
+// GL_NV_non_square_matrices
 
-static void REGAL_CALL emu_glProgramLocalParameterI4iNV(GLenum target, GLuint index, GLint x, GLint y, GLint z, GLint w)
-{
-  RegalContext *_context = REGAL_GET_CONTEXT();
-  RegalAssert(_context);
-  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+// GL_NV_occlusion_query
 
-  // prefix
-  switch( _context->emuLevel )
-  {
-    case 16 :
-    case 15 :
-    case 14 :
-    case 13 :
-    case 12 :
-    case 11 :
-    case 10 :
-    case 9 :
-    case 8 :
-    case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
-      {
-        Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        _context->dsa->RestoreAsmProgram( _context, target );
-      }
-      #endif
-    case 1 :
-    default:
-      break;
-  }
+// GL_NV_parameter_buffer_object
 
-  DispatchTableGL *_next = _dispatch.next();
-  RegalAssert(_next);
-  _next->call(& _next->glProgramLocalParameterI4iNV)(target, index, x, y, z, w);
-}
+// GL_NV_path_rendering
 
-static void REGAL_CALL emu_glProgramLocalParameterI4ivNV(GLenum target, GLuint index, const GLint *params)
+// GL_NV_pixel_data_range
+
+// GL_NV_point_sprite
+
+// GL_NV_present_video
+
+// GL_NV_primitive_restart
+
+// GL_NV_read_buffer
+
+// GL_NV_register_combiners
+
+// GL_NV_register_combiners2
+
+// GL_NV_shader_buffer_load
+
+// GL_NV_texture_barrier
+
+// GL_NV_texture_multisample
+
+static void REGAL_CALL emu_glTexImage2DMultisampleCoverageNV(GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLint internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -71424,15 +77974,13 @@ static void REGAL_CALL emu_glProgramLocalParameterI4ivNV(GLenum target, GLuint i
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        _context->dsa->RestoreAsmProgram( _context, target );
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+        _context->iff->ShadowTexInfo( target, internalFormat );
       }
       #endif
     case 1 :
@@ -71442,10 +77990,10 @@ static void REGAL_CALL emu_glProgramLocalParameterI4ivNV(GLenum target, GLuint i
 
   DispatchTableGL *_next = _dispatch.next();
   RegalAssert(_next);
-  _next->call(& _next->glProgramLocalParameterI4ivNV)(target, index, params);
+  _next->call(& _next->glTexImage2DMultisampleCoverageNV)(target, coverageSamples, colorSamples, internalFormat, width, height, fixedSampleLocations);
 }
 
-static void REGAL_CALL emu_glProgramLocalParameterI4uiNV(GLenum target, GLuint index, GLuint x, GLuint y, GLuint z, GLuint w)
+static void REGAL_CALL emu_glTexImage3DMultisampleCoverageNV(GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLint internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -71464,15 +78012,13 @@ static void REGAL_CALL emu_glProgramLocalParameterI4uiNV(GLenum target, GLuint i
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        _context->dsa->RestoreAsmProgram( _context, target );
+        _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
+        _context->iff->ShadowTexInfo( target, internalFormat );
       }
       #endif
     case 1 :
@@ -71482,10 +78028,12 @@ static void REGAL_CALL emu_glProgramLocalParameterI4uiNV(GLenum target, GLuint i
 
   DispatchTableGL *_next = _dispatch.next();
   RegalAssert(_next);
-  _next->call(& _next->glProgramLocalParameterI4uiNV)(target, index, x, y, z, w);
+  _next->call(& _next->glTexImage3DMultisampleCoverageNV)(target, coverageSamples, colorSamples, internalFormat, width, height, depth, fixedSampleLocations);
 }
 
-static void REGAL_CALL emu_glProgramLocalParameterI4uivNV(GLenum target, GLuint index, const GLuint *params)
+// GL_NV_transform_feedback
+
+static void REGAL_CALL emu_glBeginTransformFeedbackNV(GLenum primitiveMode)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -71507,12 +78055,13 @@ static void REGAL_CALL emu_glProgramLocalParameterI4uivNV(GLenum target, GLuint
     case 6 :
     case 5 :
     case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        _context->dsa->RestoreAsmProgram( _context, target );
+        _context->emuLevel = 2;
+        _context->vao->TransformFeedback( true );
       }
       #endif
     case 1 :
@@ -71522,10 +78071,10 @@ static void REGAL_CALL emu_glProgramLocalParameterI4uivNV(GLenum target, GLuint
 
   DispatchTableGL *_next = _dispatch.next();
   RegalAssert(_next);
-  _next->call(& _next->glProgramLocalParameterI4uivNV)(target, index, params);
+  _next->call(& _next->glBeginTransformFeedbackNV)(primitiveMode);
 }
 
-static void REGAL_CALL emu_glProgramLocalParametersI4ivNV(GLenum target, GLuint index, GLsizei count, const GLint *params)
+static void REGAL_CALL emu_glBindBufferBaseNV(GLenum target, GLuint index, GLuint buffer)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -71544,15 +78093,13 @@ static void REGAL_CALL emu_glProgramLocalParametersI4ivNV(GLenum target, GLuint
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        _context->dsa->RestoreAsmProgram( _context, target );
+        _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
+        _context->iff->ShadowBindBuffer( target, buffer );
       }
       #endif
     case 1 :
@@ -71562,10 +78109,10 @@ static void REGAL_CALL emu_glProgramLocalParametersI4ivNV(GLenum target, GLuint
 
   DispatchTableGL *_next = _dispatch.next();
   RegalAssert(_next);
-  _next->call(& _next->glProgramLocalParametersI4ivNV)(target, index, count, params);
+  _next->call(& _next->glBindBufferBaseNV)(target, index, buffer);
 }
 
-static void REGAL_CALL emu_glProgramLocalParametersI4uivNV(GLenum target, GLuint index, GLsizei count, const GLuint *params)
+static void REGAL_CALL emu_glBindBufferOffsetNV(GLenum target, GLuint index, GLuint buffer, GLintptr offset)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -71584,15 +78131,13 @@ static void REGAL_CALL emu_glProgramLocalParametersI4uivNV(GLenum target, GLuint
     case 9 :
     case 8 :
     case 7 :
-    case 6 :
-    case 5 :
-    case 4 :
-      #if REGAL_EMU_DSA
-      if (_context->dsa)
+      #if REGAL_EMU_IFF
+      if (_context->iff)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 3;
-        _context->dsa->RestoreAsmProgram( _context, target );
+        _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
+        _context->iff->ShadowBindBuffer( target, buffer );
       }
       #endif
     case 1 :
@@ -71602,42 +78147,10 @@ static void REGAL_CALL emu_glProgramLocalParametersI4uivNV(GLenum target, GLuint
 
   DispatchTableGL *_next = _dispatch.next();
   RegalAssert(_next);
-  _next->call(& _next->glProgramLocalParametersI4uivNV)(target, index, count, params);
+  _next->call(& _next->glBindBufferOffsetNV)(target, index, buffer, offset);
 }
 
-// GL_NV_gpu_shader5
-
-// GL_NV_half_float
-
-// GL_NV_non_square_matrices
-
-// GL_NV_occlusion_query
-
-// GL_NV_parameter_buffer_object
-
-// GL_NV_path_rendering
-
-// GL_NV_pixel_data_range
-
-// GL_NV_point_sprite
-
-// GL_NV_present_video
-
-// GL_NV_primitive_restart
-
-// GL_NV_read_buffer
-
-// GL_NV_register_combiners
-
-// GL_NV_register_combiners2
-
-// GL_NV_shader_buffer_load
-
-// GL_NV_texture_barrier
-
-// GL_NV_texture_multisample
-
-static void REGAL_CALL emu_glTexImage2DMultisampleCoverageNV(GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLint internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations)
+static void REGAL_CALL emu_glBindBufferRangeNV(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -71661,7 +78174,8 @@ static void REGAL_CALL emu_glTexImage2DMultisampleCoverageNV(GLenum target, GLsi
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
-        _context->iff->ShadowTexInfo( target, internalFormat );
+        _context->iff->RestoreVao( _context );
+        _context->iff->ShadowBindBuffer( target, buffer );
       }
       #endif
     case 1 :
@@ -71671,10 +78185,10 @@ static void REGAL_CALL emu_glTexImage2DMultisampleCoverageNV(GLenum target, GLsi
 
   DispatchTableGL *_next = _dispatch.next();
   RegalAssert(_next);
-  _next->call(& _next->glTexImage2DMultisampleCoverageNV)(target, coverageSamples, colorSamples, internalFormat, width, height, fixedSampleLocations);
+  _next->call(& _next->glBindBufferRangeNV)(target, index, buffer, offset, size);
 }
 
-static void REGAL_CALL emu_glTexImage3DMultisampleCoverageNV(GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLint internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations)
+static void REGAL_CALL emu_glEndTransformFeedbackNV(void)
 {
   RegalContext *_context = REGAL_GET_CONTEXT();
   RegalAssert(_context);
@@ -71693,12 +78207,16 @@ static void REGAL_CALL emu_glTexImage3DMultisampleCoverageNV(GLenum target, GLsi
     case 9 :
     case 8 :
     case 7 :
-      #if REGAL_EMU_IFF
-      if (_context->iff)
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
       {
         Push<int> pushLevel(_context->emuLevel);
-        _context->emuLevel = 6;
-        _context->iff->ShadowTexInfo( target, internalFormat );
+        _context->emuLevel = 2;
+        _context->vao->TransformFeedback( false );
       }
       #endif
     case 1 :
@@ -71708,13 +78226,93 @@ static void REGAL_CALL emu_glTexImage3DMultisampleCoverageNV(GLenum target, GLsi
 
   DispatchTableGL *_next = _dispatch.next();
   RegalAssert(_next);
-  _next->call(& _next->glTexImage3DMultisampleCoverageNV)(target, coverageSamples, colorSamples, internalFormat, width, height, depth, fixedSampleLocations);
+  _next->call(& _next->glEndTransformFeedbackNV)();
 }
 
-// GL_NV_transform_feedback
-
 // GL_NV_transform_feedback2
 
+static void REGAL_CALL emu_glPauseTransformFeedbackNV(void)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->TransformFeedback( false );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glPauseTransformFeedbackNV)();
+}
+
+static void REGAL_CALL emu_glResumeTransformFeedbackNV(void)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL &_dispatch = _context->dispatcher.emulation;
+
+  // prefix
+  switch( _context->emuLevel )
+  {
+    case 16 :
+    case 15 :
+    case 14 :
+    case 13 :
+    case 12 :
+    case 11 :
+    case 10 :
+    case 9 :
+    case 8 :
+    case 7 :
+    case 6 :
+    case 5 :
+    case 4 :
+    case 3 :
+      #if REGAL_EMU_VAO
+      if (_context->vao)
+      {
+        Push<int> pushLevel(_context->emuLevel);
+        _context->emuLevel = 2;
+        _context->vao->TransformFeedback( true );
+      }
+      #endif
+    case 1 :
+    default:
+      break;
+  }
+
+  DispatchTableGL *_next = _dispatch.next();
+  RegalAssert(_next);
+  _next->call(& _next->glResumeTransformFeedbackNV)();
+}
+
 // GL_NV_vdpau_interop
 
 // GL_NV_vertex_array_range
@@ -72063,6 +78661,7 @@ static void REGAL_CALL emu_glBindVertexArrayOES(GLuint array)
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->RestoreVao( _context );
         _context->iff->glBindVertexArray( _context, array );
       }
       #endif
@@ -72459,6 +79058,7 @@ static void REGAL_CALL emu_glTexImage4DSGIS(GLenum target, GLint level, GLenum i
       {
         Push<int> pushLevel(_context->emuLevel);
         _context->emuLevel = 6;
+        _context->iff->FlushBatch( _context );
         _context->iff->ShadowTexInfo( target, internalformat );
       }
       #endif
@@ -72529,6 +79129,7 @@ void InitDispatchTableEmu(DispatchTableGL &tbl)
    tbl.glBitmap = emu_glBitmap;
    tbl.glBlendFunc = emu_glBlendFunc;
    tbl.glCallList = emu_glCallList;
+   tbl.glClear = emu_glClear;
    tbl.glClearAccum = emu_glClearAccum;
    tbl.glClearColor = emu_glClearColor;
    tbl.glClearDepth = emu_glClearDepth;
@@ -72594,6 +79195,8 @@ void InitDispatchTableEmu(DispatchTableGL &tbl)
    tbl.glEvalMesh2 = emu_glEvalMesh2;
    tbl.glEvalPoint1 = emu_glEvalPoint1;
    tbl.glEvalPoint2 = emu_glEvalPoint2;
+   tbl.glFinish = emu_glFinish;
+   tbl.glFlush = emu_glFlush;
    tbl.glFogf = emu_glFogf;
    tbl.glFogfv = emu_glFogfv;
    tbl.glFogi = emu_glFogi;
@@ -72702,6 +79305,7 @@ void InitDispatchTableEmu(DispatchTableGL &tbl)
    tbl.glRasterPos4s = emu_glRasterPos4s;
    tbl.glRasterPos4sv = emu_glRasterPos4sv;
    tbl.glReadBuffer = emu_glReadBuffer;
+   tbl.glReadPixels = emu_glReadPixels;
    tbl.glRectd = emu_glRectd;
    tbl.glRectdv = emu_glRectdv;
    tbl.glRectf = emu_glRectf;
@@ -72801,7 +79405,10 @@ void InitDispatchTableEmu(DispatchTableGL &tbl)
    tbl.glArrayElement = emu_glArrayElement;
    tbl.glBindTexture = emu_glBindTexture;
    tbl.glColorPointer = emu_glColorPointer;
+   tbl.glCopyTexImage1D = emu_glCopyTexImage1D;
    tbl.glCopyTexImage2D = emu_glCopyTexImage2D;
+   tbl.glCopyTexSubImage1D = emu_glCopyTexSubImage1D;
+   tbl.glCopyTexSubImage2D = emu_glCopyTexSubImage2D;
    tbl.glDeleteTextures = emu_glDeleteTextures;
    tbl.glDisableClientState = emu_glDisableClientState;
    tbl.glDrawArrays = emu_glDrawArrays;
@@ -72817,20 +79424,28 @@ void InitDispatchTableEmu(DispatchTableGL &tbl)
    tbl.glPopClientAttrib = emu_glPopClientAttrib;
    tbl.glPushClientAttrib = emu_glPushClientAttrib;
    tbl.glTexCoordPointer = emu_glTexCoordPointer;
+   tbl.glTexSubImage1D = emu_glTexSubImage1D;
    tbl.glTexSubImage2D = emu_glTexSubImage2D;
    tbl.glVertexPointer = emu_glVertexPointer;
 
 // GL_VERSION_1_2
 
+   tbl.glCopyTexSubImage3D = emu_glCopyTexSubImage3D;
    tbl.glDrawRangeElements = emu_glDrawRangeElements;
    tbl.glTexImage3D = emu_glTexImage3D;
+   tbl.glTexSubImage3D = emu_glTexSubImage3D;
 
 // GL_VERSION_1_3
 
    tbl.glActiveTexture = emu_glActiveTexture;
    tbl.glClientActiveTexture = emu_glClientActiveTexture;
+   tbl.glCompressedTexImage1D = emu_glCompressedTexImage1D;
    tbl.glCompressedTexImage2D = emu_glCompressedTexImage2D;
+   tbl.glCompressedTexImage3D = emu_glCompressedTexImage3D;
+   tbl.glCompressedTexSubImage1D = emu_glCompressedTexSubImage1D;
    tbl.glCompressedTexSubImage2D = emu_glCompressedTexSubImage2D;
+   tbl.glCompressedTexSubImage3D = emu_glCompressedTexSubImage3D;
+   tbl.glGetCompressedTexImage = emu_glGetCompressedTexImage;
    tbl.glLoadTransposeMatrixd = emu_glLoadTransposeMatrixd;
    tbl.glLoadTransposeMatrixf = emu_glLoadTransposeMatrixf;
    tbl.glMultTransposeMatrixd = emu_glMultTransposeMatrixd;
@@ -72917,14 +79532,18 @@ void InitDispatchTableEmu(DispatchTableGL &tbl)
 
 // GL_VERSION_1_5
 
+   tbl.glBeginQuery = emu_glBeginQuery;
    tbl.glBindBuffer = emu_glBindBuffer;
    tbl.glBufferData = emu_glBufferData;
    tbl.glBufferSubData = emu_glBufferSubData;
    tbl.glDeleteBuffers = emu_glDeleteBuffers;
+   tbl.glEndQuery = emu_glEndQuery;
    tbl.glGenBuffers = emu_glGenBuffers;
    tbl.glGetBufferParameteriv = emu_glGetBufferParameteriv;
    tbl.glGetBufferPointerv = emu_glGetBufferPointerv;
    tbl.glGetBufferSubData = emu_glGetBufferSubData;
+   tbl.glGetQueryObjectiv = emu_glGetQueryObjectiv;
+   tbl.glGetQueryObjectuiv = emu_glGetQueryObjectuiv;
    tbl.glIsBuffer = emu_glIsBuffer;
    tbl.glMapBuffer = emu_glMapBuffer;
    tbl.glUnmapBuffer = emu_glUnmapBuffer;
@@ -73013,10 +79632,16 @@ void InitDispatchTableEmu(DispatchTableGL &tbl)
 
 // GL_VERSION_3_0
 
+   tbl.glBeginTransformFeedback = emu_glBeginTransformFeedback;
    tbl.glClampColor = emu_glClampColor;
+   tbl.glClearBufferfi = emu_glClearBufferfi;
+   tbl.glClearBufferfv = emu_glClearBufferfv;
+   tbl.glClearBufferiv = emu_glClearBufferiv;
+   tbl.glClearBufferuiv = emu_glClearBufferuiv;
    tbl.glColorMaski = emu_glColorMaski;
    tbl.glDisablei = emu_glDisablei;
    tbl.glEnablei = emu_glEnablei;
+   tbl.glEndTransformFeedback = emu_glEndTransformFeedback;
    tbl.glGetBooleani_v = emu_glGetBooleani_v;
    tbl.glGetTexParameterIiv = emu_glGetTexParameterIiv;
    tbl.glGetTexParameterIuiv = emu_glGetTexParameterIuiv;
@@ -73074,6 +79699,10 @@ void InitDispatchTableEmu(DispatchTableGL &tbl)
    tbl.glMultiDrawElementArrayAPPLE = emu_glMultiDrawElementArrayAPPLE;
    tbl.glMultiDrawRangeElementArrayAPPLE = emu_glMultiDrawRangeElementArrayAPPLE;
 
+// GL_APPLE_flush_buffer_range
+
+   tbl.glFlushMappedBufferRangeAPPLE = emu_glFlushMappedBufferRangeAPPLE;
+
 // GL_APPLE_vertex_array_object
 
    tbl.glBindVertexArrayAPPLE = emu_glBindVertexArrayAPPLE;
@@ -73087,16 +79716,52 @@ void InitDispatchTableEmu(DispatchTableGL &tbl)
 
 // GL_ARB_base_instance
 
+   tbl.glDrawArraysInstancedBaseInstance = emu_glDrawArraysInstancedBaseInstance;
+   tbl.glDrawElementsInstancedBaseInstance = emu_glDrawElementsInstancedBaseInstance;
    tbl.glDrawElementsInstancedBaseVertexBaseInstance = emu_glDrawElementsInstancedBaseVertexBaseInstance;
 
+// GL_ARB_buffer_storage
+
+   tbl.glBufferStorage = emu_glBufferStorage;
+   tbl.glNamedBufferStorageEXT = emu_glNamedBufferStorageEXT;
+
+// GL_ARB_clear_buffer_object
+
+   tbl.glClearBufferData = emu_glClearBufferData;
+   tbl.glClearBufferSubData = emu_glClearBufferSubData;
+   tbl.glClearNamedBufferDataEXT = emu_glClearNamedBufferDataEXT;
+   tbl.glClearNamedBufferSubDataEXT = emu_glClearNamedBufferSubDataEXT;
+
 // GL_ARB_copy_buffer
 
    tbl.glCopyBufferSubData = emu_glCopyBufferSubData;
 
+// GL_ARB_direct_state_access
+
+   tbl.glClearNamedBufferData = emu_glClearNamedBufferData;
+   tbl.glClearNamedBufferSubData = emu_glClearNamedBufferSubData;
+   tbl.glCopyNamedBufferSubData = emu_glCopyNamedBufferSubData;
+   tbl.glFlushMappedNamedBufferRange = emu_glFlushMappedNamedBufferRange;
+   tbl.glGetCompressedTextureImage = emu_glGetCompressedTextureImage;
+   tbl.glGetTextureImage = emu_glGetTextureImage;
+   tbl.glMapNamedBuffer = emu_glMapNamedBuffer;
+   tbl.glMapNamedBufferRange = emu_glMapNamedBufferRange;
+   tbl.glNamedBufferData = emu_glNamedBufferData;
+   tbl.glNamedBufferStorage = emu_glNamedBufferStorage;
+   tbl.glNamedBufferSubData = emu_glNamedBufferSubData;
+   tbl.glUnmapNamedBuffer = emu_glUnmapNamedBuffer;
+
 // GL_ARB_draw_buffers
 
    tbl.glDrawBuffersARB = emu_glDrawBuffersARB;
 
+// GL_ARB_draw_buffers_blend
+
+   tbl.glBlendEquationSeparateiARB = emu_glBlendEquationSeparateiARB;
+   tbl.glBlendEquationiARB = emu_glBlendEquationiARB;
+   tbl.glBlendFuncSeparateiARB = emu_glBlendFuncSeparateiARB;
+   tbl.glBlendFunciARB = emu_glBlendFunciARB;
+
 // GL_ARB_draw_elements_base_vertex
 
    tbl.glDrawElementsBaseVertex = emu_glDrawElementsBaseVertex;
@@ -73133,6 +79798,11 @@ void InitDispatchTableEmu(DispatchTableGL &tbl)
    tbl.glFramebufferTextureFaceARB = emu_glFramebufferTextureFaceARB;
    tbl.glFramebufferTextureLayerARB = emu_glFramebufferTextureLayerARB;
 
+// GL_ARB_get_texture_sub_image
+
+   tbl.glGetCompressedTextureSubImage = emu_glGetCompressedTextureSubImage;
+   tbl.glGetTextureSubImage = emu_glGetTextureSubImage;
+
 // GL_ARB_gpu_shader_fp64
 
    tbl.glUniform1d = emu_glUniform1d;
@@ -73180,6 +79850,10 @@ void InitDispatchTableEmu(DispatchTableGL &tbl)
    tbl.glMultiDrawArraysIndirect = emu_glMultiDrawArraysIndirect;
    tbl.glMultiDrawElementsIndirect = emu_glMultiDrawElementsIndirect;
 
+// GL_ARB_multisample
+
+   tbl.glSampleCoverageARB = emu_glSampleCoverageARB;
+
 // GL_ARB_multitexture
 
    tbl.glActiveTextureARB = emu_glActiveTextureARB;
@@ -73217,10 +79891,23 @@ void InitDispatchTableEmu(DispatchTableGL &tbl)
    tbl.glMultiTexCoord4sARB = emu_glMultiTexCoord4sARB;
    tbl.glMultiTexCoord4svARB = emu_glMultiTexCoord4svARB;
 
+// GL_ARB_occlusion_query
+
+   tbl.glBeginQueryARB = emu_glBeginQueryARB;
+   tbl.glEndQueryARB = emu_glEndQueryARB;
+   tbl.glGetQueryObjectivARB = emu_glGetQueryObjectivARB;
+   tbl.glGetQueryObjectuivARB = emu_glGetQueryObjectuivARB;
+
 // GL_ARB_provoking_vertex
 
    tbl.glProvokingVertex = emu_glProvokingVertex;
 
+// GL_ARB_robustness
+
+   tbl.glGetnCompressedTexImageARB = emu_glGetnCompressedTexImageARB;
+   tbl.glGetnTexImageARB = emu_glGetnTexImageARB;
+   tbl.glReadnPixelsARB = emu_glReadnPixelsARB;
+
 // GL_ARB_sampler_objects
 
    tbl.glBindSampler = emu_glBindSampler;
@@ -73242,6 +79929,10 @@ void InitDispatchTableEmu(DispatchTableGL &tbl)
 
    tbl.glBindProgramPipeline = emu_glBindProgramPipeline;
 
+// GL_ARB_shader_image_load_store
+
+   tbl.glMemoryBarrier = emu_glMemoryBarrier;
+
 // GL_ARB_shader_objects
 
    tbl.glAttachObjectARB = emu_glAttachObjectARB;
@@ -73276,12 +79967,20 @@ void InitDispatchTableEmu(DispatchTableGL &tbl)
 
 // GL_ARB_sync
 
+   tbl.glClientWaitSync = emu_glClientWaitSync;
+   tbl.glFenceSync = emu_glFenceSync;
    tbl.glGetInteger64v = emu_glGetInteger64v;
+   tbl.glWaitSync = emu_glWaitSync;
 
 // GL_ARB_texture_compression
 
+   tbl.glCompressedTexImage1DARB = emu_glCompressedTexImage1DARB;
    tbl.glCompressedTexImage2DARB = emu_glCompressedTexImage2DARB;
+   tbl.glCompressedTexImage3DARB = emu_glCompressedTexImage3DARB;
+   tbl.glCompressedTexSubImage1DARB = emu_glCompressedTexSubImage1DARB;
    tbl.glCompressedTexSubImage2DARB = emu_glCompressedTexSubImage2DARB;
+   tbl.glCompressedTexSubImage3DARB = emu_glCompressedTexSubImage3DARB;
+   tbl.glGetCompressedTexImageARB = emu_glGetCompressedTexImageARB;
 
 // GL_ARB_texture_multisample
 
@@ -73297,6 +79996,24 @@ void InitDispatchTableEmu(DispatchTableGL &tbl)
    tbl.glTextureStorage2DEXT = emu_glTextureStorage2DEXT;
    tbl.glTextureStorage3DEXT = emu_glTextureStorage3DEXT;
 
+// GL_ARB_texture_storage_multisample
+
+   tbl.glTexStorage2DMultisample = emu_glTexStorage2DMultisample;
+   tbl.glTexStorage3DMultisample = emu_glTexStorage3DMultisample;
+   tbl.glTextureStorage2DMultisampleEXT = emu_glTextureStorage2DMultisampleEXT;
+   tbl.glTextureStorage3DMultisampleEXT = emu_glTextureStorage3DMultisampleEXT;
+
+// GL_ARB_timer_query
+
+   tbl.glGetQueryObjecti64v = emu_glGetQueryObjecti64v;
+   tbl.glGetQueryObjectui64v = emu_glGetQueryObjectui64v;
+   tbl.glQueryCounter = emu_glQueryCounter;
+
+// GL_ARB_transform_feedback2
+
+   tbl.glPauseTransformFeedback = emu_glPauseTransformFeedback;
+   tbl.glResumeTransformFeedback = emu_glResumeTransformFeedback;
+
 // GL_ARB_transpose_matrix
 
    tbl.glLoadTransposeMatrixdARB = emu_glLoadTransposeMatrixdARB;
@@ -73306,6 +80023,8 @@ void InitDispatchTableEmu(DispatchTableGL &tbl)
 
 // GL_ARB_uniform_buffer_object
 
+   tbl.glBindBufferBase = emu_glBindBufferBase;
+   tbl.glBindBufferRange = emu_glBindBufferRange;
    tbl.glGetIntegeri_v = emu_glGetIntegeri_v;
 
 // GL_ARB_vertex_array_object
@@ -73332,6 +80051,7 @@ void InitDispatchTableEmu(DispatchTableGL &tbl)
 
    tbl.glBindBufferARB = emu_glBindBufferARB;
    tbl.glBufferDataARB = emu_glBufferDataARB;
+   tbl.glBufferSubDataARB = emu_glBufferSubDataARB;
    tbl.glDeleteBuffersARB = emu_glDeleteBuffersARB;
    tbl.glGenBuffersARB = emu_glGenBuffersARB;
    tbl.glIsBufferARB = emu_glIsBufferARB;
@@ -73429,10 +80149,23 @@ void InitDispatchTableEmu(DispatchTableGL &tbl)
 
    tbl.glBlendColorEXT = emu_glBlendColorEXT;
 
+// GL_EXT_blend_equation_separate
+
+   tbl.glBlendEquationSeparateEXT = emu_glBlendEquationSeparateEXT;
+
+// GL_EXT_blend_func_separate
+
+   tbl.glBlendFuncSeparateEXT = emu_glBlendFuncSeparateEXT;
+
 // GL_EXT_blend_minmax
 
    tbl.glBlendEquationEXT = emu_glBlendEquationEXT;
 
+// GL_EXT_copy_texture
+
+   tbl.glCopyTexImage1DEXT = emu_glCopyTexImage1DEXT;
+   tbl.glCopyTexImage2DEXT = emu_glCopyTexImage2DEXT;
+
 // GL_EXT_direct_state_access
 
    tbl.glBindMultiTextureEXT = emu_glBindMultiTextureEXT;
@@ -73661,6 +80394,10 @@ void InitDispatchTableEmu(DispatchTableGL &tbl)
    tbl.glVertexArrayVertexAttribOffsetEXT = emu_glVertexArrayVertexAttribOffsetEXT;
    tbl.glVertexArrayVertexOffsetEXT = emu_glVertexArrayVertexOffsetEXT;
 
+// GL_EXT_disjoint_timer_query
+
+   tbl.glGetQueryObjectivEXT = emu_glGetQueryObjectivEXT;
+
 // GL_EXT_draw_buffers2
 
    tbl.glColorMaskIndexedEXT = emu_glColorMaskIndexedEXT;
@@ -73734,10 +80471,18 @@ void InitDispatchTableEmu(DispatchTableGL &tbl)
 
    tbl.glGetIntegeri_vEXT = emu_glGetIntegeri_vEXT;
 
+// GL_EXT_occlusion_query_boolean
+
+   tbl.glGetQueryObjectuivEXT = emu_glGetQueryObjectuivEXT;
+
 // GL_EXT_provoking_vertex
 
    tbl.glProvokingVertexEXT = emu_glProvokingVertexEXT;
 
+// GL_EXT_robustness
+
+   tbl.glReadnPixelsEXT = emu_glReadnPixelsEXT;
+
 // GL_EXT_secondary_color
 
    tbl.glSecondaryColor3bEXT = emu_glSecondaryColor3bEXT;
@@ -73758,6 +80503,10 @@ void InitDispatchTableEmu(DispatchTableGL &tbl)
    tbl.glSecondaryColor3usvEXT = emu_glSecondaryColor3usvEXT;
    tbl.glSecondaryColorPointerEXT = emu_glSecondaryColorPointerEXT;
 
+// GL_EXT_shader_image_load_store
+
+   tbl.glMemoryBarrierEXT = emu_glMemoryBarrierEXT;
+
 // GL_EXT_subtexture
 
    tbl.glTexSubImage2DEXT = emu_glTexSubImage2DEXT;
@@ -73787,6 +80536,19 @@ void InitDispatchTableEmu(DispatchTableGL &tbl)
    tbl.glTexStorage2DEXT = emu_glTexStorage2DEXT;
    tbl.glTexStorage3DEXT = emu_glTexStorage3DEXT;
 
+// GL_EXT_timer_query
+
+   tbl.glGetQueryObjecti64vEXT = emu_glGetQueryObjecti64vEXT;
+   tbl.glGetQueryObjectui64vEXT = emu_glGetQueryObjectui64vEXT;
+
+// GL_EXT_transform_feedback
+
+   tbl.glBeginTransformFeedbackEXT = emu_glBeginTransformFeedbackEXT;
+   tbl.glBindBufferBaseEXT = emu_glBindBufferBaseEXT;
+   tbl.glBindBufferOffsetEXT = emu_glBindBufferOffsetEXT;
+   tbl.glBindBufferRangeEXT = emu_glBindBufferRangeEXT;
+   tbl.glEndTransformFeedbackEXT = emu_glEndTransformFeedbackEXT;
+
 // GL_EXT_vertex_array
 
    tbl.glArrayElementEXT = emu_glArrayElementEXT;
@@ -73797,6 +80559,10 @@ void InitDispatchTableEmu(DispatchTableGL &tbl)
    tbl.glTexCoordPointerEXT = emu_glTexCoordPointerEXT;
    tbl.glVertexPointerEXT = emu_glVertexPointerEXT;
 
+// GL_KHR_robustness
+
+   tbl.glReadnPixels = emu_glReadnPixels;
+
 // GL_NV_draw_buffers
 
    tbl.glDrawBuffersNV = emu_glDrawBuffersNV;
@@ -73833,6 +80599,19 @@ void InitDispatchTableEmu(DispatchTableGL &tbl)
    tbl.glTexImage2DMultisampleCoverageNV = emu_glTexImage2DMultisampleCoverageNV;
    tbl.glTexImage3DMultisampleCoverageNV = emu_glTexImage3DMultisampleCoverageNV;
 
+// GL_NV_transform_feedback
+
+   tbl.glBeginTransformFeedbackNV = emu_glBeginTransformFeedbackNV;
+   tbl.glBindBufferBaseNV = emu_glBindBufferBaseNV;
+   tbl.glBindBufferOffsetNV = emu_glBindBufferOffsetNV;
+   tbl.glBindBufferRangeNV = emu_glBindBufferRangeNV;
+   tbl.glEndTransformFeedbackNV = emu_glEndTransformFeedbackNV;
+
+// GL_NV_transform_feedback2
+
+   tbl.glPauseTransformFeedbackNV = emu_glPauseTransformFeedbackNV;
+   tbl.glResumeTransformFeedbackNV = emu_glResumeTransformFeedbackNV;
+
 // GL_NV_vertex_program
 
    tbl.glDeleteProgramsNV = emu_glDeleteProgramsNV;
@@ -73884,6 +80663,1604 @@ void InitDispatchTableEmu(DispatchTableGL &tbl)
 
 }
 
+// Entries of the emulation table acted on by the
+// emulation layers instantiated for this context
+
+void InitDispatchTableEmuRoute(RegalContext &ctx, DispatchTableGL &tbl)
+{
+  unsigned int layers = 0;
+  #if REGAL_EMU_OBJ
+  if (ctx.obj) layers |= EMU_ROUTE_OBJ;
+  #endif
+  #if REGAL_EMU_HINT
+  if (ctx.hint) layers |= EMU_ROUTE_HINT;
+  #endif
+  #if REGAL_EMU_PPA
+  if (ctx.ppa) layers |= EMU_ROUTE_PPA;
+  #endif
+  #if REGAL_EMU_PPCA
+  if (ctx.ppca) layers |= EMU_ROUTE_PPCA;
+  #endif
+  #if REGAL_EMU_BIN
+  if (ctx.bin) layers |= EMU_ROUTE_BIN;
+  #endif
+  #if REGAL_EMU_XFER
+  if (ctx.xfer) layers |= EMU_ROUTE_XFER;
+  #endif
+  #if REGAL_EMU_TEXSTO
+  if (ctx.texsto) layers |= EMU_ROUTE_TEXSTO;
+  #endif
+  #if REGAL_EMU_BASEVERTEX
+  if (ctx.bv) layers |= EMU_ROUTE_BV;
+  #endif
+  #if REGAL_EMU_RECT
+  if (ctx.rect) layers |= EMU_ROUTE_RECT;
+  #endif
+  #if REGAL_EMU_IFF
+  if (ctx.iff) layers |= EMU_ROUTE_IFF;
+  #endif
+  #if REGAL_EMU_QUADS
+  if (ctx.quads) layers |= EMU_ROUTE_QUADS;
+  #endif
+  #if REGAL_EMU_SO
+  if (ctx.so) layers |= EMU_ROUTE_SO;
+  #endif
+  #if REGAL_EMU_DSA
+  if (ctx.dsa) layers |= EMU_ROUTE_DSA;
+  #endif
+  #if REGAL_EMU_VAO
+  if (ctx.vao) layers |= EMU_ROUTE_VAO;
+  #endif
+  #if REGAL_EMU_TEXC
+  if (ctx.texc) layers |= EMU_ROUTE_TEXC;
+  #endif
+  #if REGAL_EMU_FILTER
+  if (ctx.filt) layers |= EMU_ROUTE_FILT;
+  #endif
+  UNUSED_PARAMETER(ctx);
+
+  // GL_VERSION_1_0
+
+  tbl.glAccum = layers&(EMU_ROUTE_FILT) ? emu_glAccum : NULL;
+  tbl.glAlphaFunc = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glAlphaFunc : NULL;
+  tbl.glBegin = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glBegin : NULL;
+  tbl.glBitmap = layers&(EMU_ROUTE_IFF|EMU_ROUTE_FILT) ? emu_glBitmap : NULL;
+  tbl.glBlendFunc = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glBlendFunc : NULL;
+  tbl.glCallList = layers&(EMU_ROUTE_FILT) ? emu_glCallList : NULL;
+  tbl.glClear = layers&(EMU_ROUTE_IFF) ? emu_glClear : NULL;
+  tbl.glClearAccum = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF|EMU_ROUTE_FILT) ? emu_glClearAccum : NULL;
+  tbl.glClearColor = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glClearColor : NULL;
+  tbl.glClearDepth = emu_glClearDepth;
+  tbl.glClearIndex = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glClearIndex : NULL;
+  tbl.glClearStencil = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glClearStencil : NULL;
+  tbl.glClipPlane = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glClipPlane : NULL;
+  tbl.glColor3b = layers&(EMU_ROUTE_IFF) ? emu_glColor3b : NULL;
+  tbl.glColor3bv = layers&(EMU_ROUTE_IFF) ? emu_glColor3bv : NULL;
+  tbl.glColor3d = layers&(EMU_ROUTE_IFF) ? emu_glColor3d : NULL;
+  tbl.glColor3dv = layers&(EMU_ROUTE_IFF) ? emu_glColor3dv : NULL;
+  tbl.glColor3f = layers&(EMU_ROUTE_IFF) ? emu_glColor3f : NULL;
+  tbl.glColor3fv = layers&(EMU_ROUTE_IFF) ? emu_glColor3fv : NULL;
+  tbl.glColor3i = layers&(EMU_ROUTE_IFF) ? emu_glColor3i : NULL;
+  tbl.glColor3iv = layers&(EMU_ROUTE_IFF) ? emu_glColor3iv : NULL;
+  tbl.glColor3s = layers&(EMU_ROUTE_IFF) ? emu_glColor3s : NULL;
+  tbl.glColor3sv = layers&(EMU_ROUTE_IFF) ? emu_glColor3sv : NULL;
+  tbl.glColor3ub = layers&(EMU_ROUTE_IFF) ? emu_glColor3ub : NULL;
+  tbl.glColor3ubv = layers&(EMU_ROUTE_IFF) ? emu_glColor3ubv : NULL;
+  tbl.glColor3ui = layers&(EMU_ROUTE_IFF) ? emu_glColor3ui : NULL;
+  tbl.glColor3uiv = layers&(EMU_ROUTE_IFF) ? emu_glColor3uiv : NULL;
+  tbl.glColor3us = layers&(EMU_ROUTE_IFF) ? emu_glColor3us : NULL;
+  tbl.glColor3usv = layers&(EMU_ROUTE_IFF) ? emu_glColor3usv : NULL;
+  tbl.glColor4b = layers&(EMU_ROUTE_IFF) ? emu_glColor4b : NULL;
+  tbl.glColor4bv = layers&(EMU_ROUTE_IFF) ? emu_glColor4bv : NULL;
+  tbl.glColor4d = layers&(EMU_ROUTE_IFF) ? emu_glColor4d : NULL;
+  tbl.glColor4dv = layers&(EMU_ROUTE_IFF) ? emu_glColor4dv : NULL;
+  tbl.glColor4f = layers&(EMU_ROUTE_IFF) ? emu_glColor4f : NULL;
+  tbl.glColor4fv = layers&(EMU_ROUTE_IFF) ? emu_glColor4fv : NULL;
+  tbl.glColor4i = layers&(EMU_ROUTE_IFF) ? emu_glColor4i : NULL;
+  tbl.glColor4iv = layers&(EMU_ROUTE_IFF) ? emu_glColor4iv : NULL;
+  tbl.glColor4s = layers&(EMU_ROUTE_IFF) ? emu_glColor4s : NULL;
+  tbl.glColor4sv = layers&(EMU_ROUTE_IFF) ? emu_glColor4sv : NULL;
+  tbl.glColor4ub = layers&(EMU_ROUTE_IFF) ? emu_glColor4ub : NULL;
+  tbl.glColor4ubv = layers&(EMU_ROUTE_IFF) ? emu_glColor4ubv : NULL;
+  tbl.glColor4ui = layers&(EMU_ROUTE_IFF) ? emu_glColor4ui : NULL;
+  tbl.glColor4uiv = layers&(EMU_ROUTE_IFF) ? emu_glColor4uiv : NULL;
+  tbl.glColor4us = layers&(EMU_ROUTE_IFF) ? emu_glColor4us : NULL;
+  tbl.glColor4usv = layers&(EMU_ROUTE_IFF) ? emu_glColor4usv : NULL;
+  tbl.glColorMask = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glColorMask : NULL;
+  tbl.glColorMaterial = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glColorMaterial : NULL;
+  tbl.glCopyPixels = layers&(EMU_ROUTE_IFF|EMU_ROUTE_FILT) ? emu_glCopyPixels : NULL;
+  tbl.glCullFace = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF|EMU_ROUTE_QUADS) ? emu_glCullFace : NULL;
+  tbl.glDeleteLists = layers&(EMU_ROUTE_FILT) ? emu_glDeleteLists : NULL;
+  tbl.glDepthFunc = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glDepthFunc : NULL;
+  tbl.glDepthMask = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glDepthMask : NULL;
+  tbl.glDepthRange = emu_glDepthRange;
+  tbl.glDisable = emu_glDisable;
+  tbl.glDrawBuffer = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF|EMU_ROUTE_FILT) ? emu_glDrawBuffer : NULL;
+  tbl.glDrawPixels = layers&(EMU_ROUTE_IFF|EMU_ROUTE_FILT) ? emu_glDrawPixels : NULL;
+  tbl.glEdgeFlag = layers&(EMU_ROUTE_FILT) ? emu_glEdgeFlag : NULL;
+  tbl.glEnable = emu_glEnable;
+  tbl.glEnd = layers&(EMU_ROUTE_IFF) ? emu_glEnd : NULL;
+  tbl.glEndList = layers&(EMU_ROUTE_FILT) ? emu_glEndList : NULL;
+  tbl.glEvalCoord1d = layers&(EMU_ROUTE_FILT) ? emu_glEvalCoord1d : NULL;
+  tbl.glEvalCoord1dv = layers&(EMU_ROUTE_FILT) ? emu_glEvalCoord1dv : NULL;
+  tbl.glEvalCoord1f = layers&(EMU_ROUTE_FILT) ? emu_glEvalCoord1f : NULL;
+  tbl.glEvalCoord1fv = layers&(EMU_ROUTE_FILT) ? emu_glEvalCoord1fv : NULL;
+  tbl.glEvalCoord2d = layers&(EMU_ROUTE_FILT) ? emu_glEvalCoord2d : NULL;
+  tbl.glEvalCoord2dv = layers&(EMU_ROUTE_FILT) ? emu_glEvalCoord2dv : NULL;
+  tbl.glEvalCoord2f = layers&(EMU_ROUTE_FILT) ? emu_glEvalCoord2f : NULL;
+  tbl.glEvalCoord2fv = layers&(EMU_ROUTE_FILT) ? emu_glEvalCoord2fv : NULL;
+  tbl.glEvalMesh1 = layers&(EMU_ROUTE_FILT) ? emu_glEvalMesh1 : NULL;
+  tbl.glEvalMesh2 = layers&(EMU_ROUTE_FILT) ? emu_glEvalMesh2 : NULL;
+  tbl.glEvalPoint1 = layers&(EMU_ROUTE_FILT) ? emu_glEvalPoint1 : NULL;
+  tbl.glEvalPoint2 = layers&(EMU_ROUTE_FILT) ? emu_glEvalPoint2 : NULL;
+  tbl.glFinish = layers&(EMU_ROUTE_IFF) ? emu_glFinish : NULL;
+  tbl.glFlush = layers&(EMU_ROUTE_IFF) ? emu_glFlush : NULL;
+  tbl.glFogf = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glFogf : NULL;
+  tbl.glFogfv = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glFogfv : NULL;
+  tbl.glFogi = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glFogi : NULL;
+  tbl.glFogiv = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glFogiv : NULL;
+  tbl.glFrontFace = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF|EMU_ROUTE_QUADS) ? emu_glFrontFace : NULL;
+  tbl.glFrustum = layers&(EMU_ROUTE_IFF) ? emu_glFrustum : NULL;
+  tbl.glGenLists = layers&(EMU_ROUTE_FILT) ? emu_glGenLists : NULL;
+  tbl.glGetBooleanv = layers&(EMU_ROUTE_HINT|EMU_ROUTE_PPA|EMU_ROUTE_PPCA|EMU_ROUTE_IFF|EMU_ROUTE_DSA|EMU_ROUTE_VAO|EMU_ROUTE_FILT) ? emu_glGetBooleanv : NULL;
+  tbl.glGetDoublev = layers&(EMU_ROUTE_HINT|EMU_ROUTE_PPA|EMU_ROUTE_PPCA|EMU_ROUTE_IFF|EMU_ROUTE_SO|EMU_ROUTE_DSA|EMU_ROUTE_VAO|EMU_ROUTE_FILT) ? emu_glGetDoublev : NULL;
+  tbl.glGetFloatv = layers&(EMU_ROUTE_HINT|EMU_ROUTE_PPA|EMU_ROUTE_PPCA|EMU_ROUTE_IFF|EMU_ROUTE_SO|EMU_ROUTE_DSA|EMU_ROUTE_VAO|EMU_ROUTE_FILT) ? emu_glGetFloatv : NULL;
+  tbl.glGetIntegerv = layers&(EMU_ROUTE_HINT|EMU_ROUTE_PPA|EMU_ROUTE_PPCA|EMU_ROUTE_IFF|EMU_ROUTE_SO|EMU_ROUTE_DSA|EMU_ROUTE_VAO|EMU_ROUTE_FILT) ? emu_glGetIntegerv : NULL;
+  tbl.glGetLightfv = layers&(EMU_ROUTE_PPA) ? emu_glGetLightfv : NULL;
+  tbl.glGetLightiv = layers&(EMU_ROUTE_PPA) ? emu_glGetLightiv : NULL;
+  tbl.glGetMaterialfv = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glGetMaterialfv : NULL;
+  tbl.glGetMaterialiv = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glGetMaterialiv : NULL;
+  tbl.glGetPolygonStipple = layers&(EMU_ROUTE_PPA) ? emu_glGetPolygonStipple : NULL;
+  tbl.glGetTexEnvfv = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glGetTexEnvfv : NULL;
+  tbl.glGetTexEnviv = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glGetTexEnviv : NULL;
+  tbl.glGetTexGendv = layers&(EMU_ROUTE_IFF) ? emu_glGetTexGendv : NULL;
+  tbl.glGetTexGenfv = layers&(EMU_ROUTE_IFF) ? emu_glGetTexGenfv : NULL;
+  tbl.glGetTexGeniv = layers&(EMU_ROUTE_IFF) ? emu_glGetTexGeniv : NULL;
+  tbl.glGetTexImage = layers&(EMU_ROUTE_IFF|EMU_ROUTE_VAO|EMU_ROUTE_FILT) ? emu_glGetTexImage : NULL;
+  tbl.glGetTexLevelParameterfv = layers&(EMU_ROUTE_PPA|EMU_ROUTE_FILT) ? emu_glGetTexLevelParameterfv : NULL;
+  tbl.glGetTexLevelParameteriv = layers&(EMU_ROUTE_PPA|EMU_ROUTE_FILT) ? emu_glGetTexLevelParameteriv : NULL;
+  tbl.glGetTexParameterfv = layers&(EMU_ROUTE_PPA|EMU_ROUTE_TEXSTO|EMU_ROUTE_SO|EMU_ROUTE_DSA) ? emu_glGetTexParameterfv : NULL;
+  tbl.glGetTexParameteriv = layers&(EMU_ROUTE_PPA|EMU_ROUTE_TEXSTO|EMU_ROUTE_SO|EMU_ROUTE_DSA|EMU_ROUTE_FILT) ? emu_glGetTexParameteriv : NULL;
+  tbl.glHint = layers&(EMU_ROUTE_HINT|EMU_ROUTE_PPA) ? emu_glHint : NULL;
+  tbl.glIndexMask = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glIndexMask : NULL;
+  tbl.glIsEnabled = emu_glIsEnabled;
+  tbl.glLightModelf = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glLightModelf : NULL;
+  tbl.glLightModelfv = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glLightModelfv : NULL;
+  tbl.glLightModeli = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glLightModeli : NULL;
+  tbl.glLightModeliv = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glLightModeliv : NULL;
+  tbl.glLightf = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glLightf : NULL;
+  tbl.glLightfv = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glLightfv : NULL;
+  tbl.glLighti = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glLighti : NULL;
+  tbl.glLightiv = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glLightiv : NULL;
+  tbl.glLineStipple = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF|EMU_ROUTE_FILT) ? emu_glLineStipple : NULL;
+  tbl.glLineWidth = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF|EMU_ROUTE_FILT) ? emu_glLineWidth : NULL;
+  tbl.glListBase = layers&(EMU_ROUTE_PPA) ? emu_glListBase : NULL;
+  tbl.glLoadIdentity = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glLoadIdentity : NULL;
+  tbl.glLoadMatrixd = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glLoadMatrixd : NULL;
+  tbl.glLoadMatrixf = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glLoadMatrixf : NULL;
+  tbl.glLogicOp = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glLogicOp : NULL;
+  tbl.glMap1d = layers&(EMU_ROUTE_FILT) ? emu_glMap1d : NULL;
+  tbl.glMap1f = layers&(EMU_ROUTE_FILT) ? emu_glMap1f : NULL;
+  tbl.glMap2d = layers&(EMU_ROUTE_FILT) ? emu_glMap2d : NULL;
+  tbl.glMap2f = layers&(EMU_ROUTE_FILT) ? emu_glMap2f : NULL;
+  tbl.glMapGrid1d = layers&(EMU_ROUTE_PPA|EMU_ROUTE_FILT) ? emu_glMapGrid1d : NULL;
+  tbl.glMapGrid1f = layers&(EMU_ROUTE_PPA|EMU_ROUTE_FILT) ? emu_glMapGrid1f : NULL;
+  tbl.glMapGrid2d = layers&(EMU_ROUTE_PPA|EMU_ROUTE_FILT) ? emu_glMapGrid2d : NULL;
+  tbl.glMapGrid2f = layers&(EMU_ROUTE_PPA|EMU_ROUTE_FILT) ? emu_glMapGrid2f : NULL;
+  tbl.glMaterialf = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glMaterialf : NULL;
+  tbl.glMaterialfv = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glMaterialfv : NULL;
+  tbl.glMateriali = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glMateriali : NULL;
+  tbl.glMaterialiv = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glMaterialiv : NULL;
+  tbl.glMatrixMode = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glMatrixMode : NULL;
+  tbl.glMultMatrixd = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glMultMatrixd : NULL;
+  tbl.glMultMatrixf = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glMultMatrixf : NULL;
+  tbl.glNewList = layers&(EMU_ROUTE_FILT) ? emu_glNewList : NULL;
+  tbl.glNormal3b = layers&(EMU_ROUTE_IFF) ? emu_glNormal3b : NULL;
+  tbl.glNormal3bv = layers&(EMU_ROUTE_IFF) ? emu_glNormal3bv : NULL;
+  tbl.glNormal3d = layers&(EMU_ROUTE_IFF) ? emu_glNormal3d : NULL;
+  tbl.glNormal3dv = layers&(EMU_ROUTE_IFF) ? emu_glNormal3dv : NULL;
+  tbl.glNormal3f = layers&(EMU_ROUTE_IFF) ? emu_glNormal3f : NULL;
+  tbl.glNormal3fv = layers&(EMU_ROUTE_IFF) ? emu_glNormal3fv : NULL;
+  tbl.glNormal3i = layers&(EMU_ROUTE_IFF) ? emu_glNormal3i : NULL;
+  tbl.glNormal3iv = layers&(EMU_ROUTE_IFF) ? emu_glNormal3iv : NULL;
+  tbl.glNormal3s = layers&(EMU_ROUTE_IFF) ? emu_glNormal3s : NULL;
+  tbl.glNormal3sv = layers&(EMU_ROUTE_IFF) ? emu_glNormal3sv : NULL;
+  tbl.glOrtho = layers&(EMU_ROUTE_IFF) ? emu_glOrtho : NULL;
+  tbl.glPixelStoref = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_XFER|EMU_ROUTE_FILT) ? emu_glPixelStoref : NULL;
+  tbl.glPixelStorei = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_XFER|EMU_ROUTE_TEXC|EMU_ROUTE_FILT) ? emu_glPixelStorei : NULL;
+  tbl.glPixelTransferf = layers&(EMU_ROUTE_PPA|EMU_ROUTE_FILT) ? emu_glPixelTransferf : NULL;
+  tbl.glPixelTransferi = layers&(EMU_ROUTE_PPA|EMU_ROUTE_FILT) ? emu_glPixelTransferi : NULL;
+  tbl.glPixelZoom = layers&(EMU_ROUTE_PPA|EMU_ROUTE_FILT) ? emu_glPixelZoom : NULL;
+  tbl.glPointSize = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glPointSize : NULL;
+  tbl.glPolygonMode = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF|EMU_ROUTE_QUADS|EMU_ROUTE_FILT) ? emu_glPolygonMode : NULL;
+  tbl.glPolygonStipple = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glPolygonStipple : NULL;
+  tbl.glPopAttrib = layers&(EMU_ROUTE_PPA) ? emu_glPopAttrib : NULL;
+  tbl.glPopMatrix = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glPopMatrix : NULL;
+  tbl.glPushAttrib = layers&(EMU_ROUTE_PPA) ? emu_glPushAttrib : NULL;
+  tbl.glPushMatrix = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glPushMatrix : NULL;
+  tbl.glRasterPos2d = layers&(EMU_ROUTE_IFF|EMU_ROUTE_FILT) ? emu_glRasterPos2d : NULL;
+  tbl.glRasterPos2dv = layers&(EMU_ROUTE_FILT) ? emu_glRasterPos2dv : NULL;
+  tbl.glRasterPos2f = layers&(EMU_ROUTE_IFF|EMU_ROUTE_FILT) ? emu_glRasterPos2f : NULL;
+  tbl.glRasterPos2fv = layers&(EMU_ROUTE_FILT) ? emu_glRasterPos2fv : NULL;
+  tbl.glRasterPos2i = layers&(EMU_ROUTE_IFF|EMU_ROUTE_FILT) ? emu_glRasterPos2i : NULL;
+  tbl.glRasterPos2iv = layers&(EMU_ROUTE_FILT) ? emu_glRasterPos2iv : NULL;
+  tbl.glRasterPos2s = layers&(EMU_ROUTE_IFF|EMU_ROUTE_FILT) ? emu_glRasterPos2s : NULL;
+  tbl.glRasterPos2sv = layers&(EMU_ROUTE_FILT) ? emu_glRasterPos2sv : NULL;
+  tbl.glRasterPos3d = layers&(EMU_ROUTE_IFF|EMU_ROUTE_FILT) ? emu_glRasterPos3d : NULL;
+  tbl.glRasterPos3dv = layers&(EMU_ROUTE_FILT) ? emu_glRasterPos3dv : NULL;
+  tbl.glRasterPos3f = layers&(EMU_ROUTE_IFF|EMU_ROUTE_FILT) ? emu_glRasterPos3f : NULL;
+  tbl.glRasterPos3fv = layers&(EMU_ROUTE_FILT) ? emu_glRasterPos3fv : NULL;
+  tbl.glRasterPos3i = layers&(EMU_ROUTE_IFF|EMU_ROUTE_FILT) ? emu_glRasterPos3i : NULL;
+  tbl.glRasterPos3iv = layers&(EMU_ROUTE_FILT) ? emu_glRasterPos3iv : NULL;
+  tbl.glRasterPos3s = layers&(EMU_ROUTE_IFF|EMU_ROUTE_FILT) ? emu_glRasterPos3s : NULL;
+  tbl.glRasterPos3sv = layers&(EMU_ROUTE_FILT) ? emu_glRasterPos3sv : NULL;
+  tbl.glRasterPos4d = layers&(EMU_ROUTE_FILT) ? emu_glRasterPos4d : NULL;
+  tbl.glRasterPos4dv = layers&(EMU_ROUTE_FILT) ? emu_glRasterPos4dv : NULL;
+  tbl.glRasterPos4f = layers&(EMU_ROUTE_FILT) ? emu_glRasterPos4f : NULL;
+  tbl.glRasterPos4fv = layers&(EMU_ROUTE_FILT) ? emu_glRasterPos4fv : NULL;
+  tbl.glRasterPos4i = layers&(EMU_ROUTE_FILT) ? emu_glRasterPos4i : NULL;
+  tbl.glRasterPos4iv = layers&(EMU_ROUTE_FILT) ? emu_glRasterPos4iv : NULL;
+  tbl.glRasterPos4s = layers&(EMU_ROUTE_FILT) ? emu_glRasterPos4s : NULL;
+  tbl.glRasterPos4sv = layers&(EMU_ROUTE_FILT) ? emu_glRasterPos4sv : NULL;
+  tbl.glReadBuffer = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF|EMU_ROUTE_FILT) ? emu_glReadBuffer : NULL;
+  tbl.glReadPixels = layers&(EMU_ROUTE_IFF|EMU_ROUTE_VAO) ? emu_glReadPixels : NULL;
+  tbl.glRectd = layers&(EMU_ROUTE_RECT|EMU_ROUTE_FILT) ? emu_glRectd : NULL;
+  tbl.glRectdv = layers&(EMU_ROUTE_RECT) ? emu_glRectdv : NULL;
+  tbl.glRectf = layers&(EMU_ROUTE_RECT|EMU_ROUTE_FILT) ? emu_glRectf : NULL;
+  tbl.glRectfv = layers&(EMU_ROUTE_RECT) ? emu_glRectfv : NULL;
+  tbl.glRecti = layers&(EMU_ROUTE_RECT|EMU_ROUTE_FILT) ? emu_glRecti : NULL;
+  tbl.glRectiv = layers&(EMU_ROUTE_RECT) ? emu_glRectiv : NULL;
+  tbl.glRects = layers&(EMU_ROUTE_RECT|EMU_ROUTE_FILT) ? emu_glRects : NULL;
+  tbl.glRectsv = layers&(EMU_ROUTE_RECT) ? emu_glRectsv : NULL;
+  tbl.glRenderMode = layers&(EMU_ROUTE_FILT) ? emu_glRenderMode : NULL;
+  tbl.glRotated = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glRotated : NULL;
+  tbl.glRotatef = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glRotatef : NULL;
+  tbl.glScaled = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glScaled : NULL;
+  tbl.glScalef = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glScalef : NULL;
+  tbl.glScissor = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glScissor : NULL;
+  tbl.glShadeModel = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF|EMU_ROUTE_QUADS|EMU_ROUTE_FILT) ? emu_glShadeModel : NULL;
+  tbl.glStencilFunc = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glStencilFunc : NULL;
+  tbl.glStencilMask = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glStencilMask : NULL;
+  tbl.glStencilOp = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glStencilOp : NULL;
+  tbl.glTexCoord1d = layers&(EMU_ROUTE_IFF) ? emu_glTexCoord1d : NULL;
+  tbl.glTexCoord1dv = layers&(EMU_ROUTE_IFF) ? emu_glTexCoord1dv : NULL;
+  tbl.glTexCoord1f = layers&(EMU_ROUTE_IFF) ? emu_glTexCoord1f : NULL;
+  tbl.glTexCoord1fv = layers&(EMU_ROUTE_IFF) ? emu_glTexCoord1fv : NULL;
+  tbl.glTexCoord1i = layers&(EMU_ROUTE_IFF) ? emu_glTexCoord1i : NULL;
+  tbl.glTexCoord1iv = layers&(EMU_ROUTE_IFF) ? emu_glTexCoord1iv : NULL;
+  tbl.glTexCoord1s = layers&(EMU_ROUTE_IFF) ? emu_glTexCoord1s : NULL;
+  tbl.glTexCoord1sv = layers&(EMU_ROUTE_IFF) ? emu_glTexCoord1sv : NULL;
+  tbl.glTexCoord2d = layers&(EMU_ROUTE_IFF) ? emu_glTexCoord2d : NULL;
+  tbl.glTexCoord2dv = layers&(EMU_ROUTE_IFF) ? emu_glTexCoord2dv : NULL;
+  tbl.glTexCoord2f = layers&(EMU_ROUTE_IFF) ? emu_glTexCoord2f : NULL;
+  tbl.glTexCoord2fv = layers&(EMU_ROUTE_IFF) ? emu_glTexCoord2fv : NULL;
+  tbl.glTexCoord2i = layers&(EMU_ROUTE_IFF) ? emu_glTexCoord2i : NULL;
+  tbl.glTexCoord2iv = layers&(EMU_ROUTE_IFF) ? emu_glTexCoord2iv : NULL;
+  tbl.glTexCoord2s = layers&(EMU_ROUTE_IFF) ? emu_glTexCoord2s : NULL;
+  tbl.glTexCoord2sv = layers&(EMU_ROUTE_IFF) ? emu_glTexCoord2sv : NULL;
+  tbl.glTexCoord3d = layers&(EMU_ROUTE_IFF) ? emu_glTexCoord3d : NULL;
+  tbl.glTexCoord3dv = layers&(EMU_ROUTE_IFF) ? emu_glTexCoord3dv : NULL;
+  tbl.glTexCoord3f = layers&(EMU_ROUTE_IFF) ? emu_glTexCoord3f : NULL;
+  tbl.glTexCoord3fv = layers&(EMU_ROUTE_IFF) ? emu_glTexCoord3fv : NULL;
+  tbl.glTexCoord3i = layers&(EMU_ROUTE_IFF) ? emu_glTexCoord3i : NULL;
+  tbl.glTexCoord3iv = layers&(EMU_ROUTE_IFF) ? emu_glTexCoord3iv : NULL;
+  tbl.glTexCoord3s = layers&(EMU_ROUTE_IFF) ? emu_glTexCoord3s : NULL;
+  tbl.glTexCoord3sv = layers&(EMU_ROUTE_IFF) ? emu_glTexCoord3sv : NULL;
+  tbl.glTexCoord4d = layers&(EMU_ROUTE_IFF) ? emu_glTexCoord4d : NULL;
+  tbl.glTexCoord4dv = layers&(EMU_ROUTE_IFF) ? emu_glTexCoord4dv : NULL;
+  tbl.glTexCoord4f = layers&(EMU_ROUTE_IFF) ? emu_glTexCoord4f : NULL;
+  tbl.glTexCoord4fv = layers&(EMU_ROUTE_IFF) ? emu_glTexCoord4fv : NULL;
+  tbl.glTexCoord4i = layers&(EMU_ROUTE_IFF) ? emu_glTexCoord4i : NULL;
+  tbl.glTexCoord4iv = layers&(EMU_ROUTE_IFF) ? emu_glTexCoord4iv : NULL;
+  tbl.glTexCoord4s = layers&(EMU_ROUTE_IFF) ? emu_glTexCoord4s : NULL;
+  tbl.glTexCoord4sv = layers&(EMU_ROUTE_IFF) ? emu_glTexCoord4sv : NULL;
+  tbl.glTexEnvf = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glTexEnvf : NULL;
+  tbl.glTexEnvfv = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glTexEnvfv : NULL;
+  tbl.glTexEnvi = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glTexEnvi : NULL;
+  tbl.glTexEnviv = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glTexEnviv : NULL;
+  tbl.glTexGend = layers&(EMU_ROUTE_IFF) ? emu_glTexGend : NULL;
+  tbl.glTexGendv = layers&(EMU_ROUTE_IFF) ? emu_glTexGendv : NULL;
+  tbl.glTexGenf = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glTexGenf : NULL;
+  tbl.glTexGenfv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glTexGenfv : NULL;
+  tbl.glTexGeni = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glTexGeni : NULL;
+  tbl.glTexGeniv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glTexGeniv : NULL;
+  tbl.glTexImage1D = layers&(EMU_ROUTE_IFF|EMU_ROUTE_FILT) ? emu_glTexImage1D : NULL;
+  tbl.glTexImage2D = emu_glTexImage2D;
+  tbl.glTexParameterf = layers&(EMU_ROUTE_IFF|EMU_ROUTE_SO|EMU_ROUTE_DSA|EMU_ROUTE_FILT) ? emu_glTexParameterf : NULL;
+  tbl.glTexParameterfv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_SO|EMU_ROUTE_DSA|EMU_ROUTE_FILT) ? emu_glTexParameterfv : NULL;
+  tbl.glTexParameteri = layers&(EMU_ROUTE_IFF|EMU_ROUTE_SO|EMU_ROUTE_DSA|EMU_ROUTE_FILT) ? emu_glTexParameteri : NULL;
+  tbl.glTexParameteriv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_SO|EMU_ROUTE_DSA|EMU_ROUTE_FILT) ? emu_glTexParameteriv : NULL;
+  tbl.glTranslated = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glTranslated : NULL;
+  tbl.glTranslatef = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glTranslatef : NULL;
+  tbl.glVertex2d = layers&(EMU_ROUTE_IFF) ? emu_glVertex2d : NULL;
+  tbl.glVertex2dv = layers&(EMU_ROUTE_IFF) ? emu_glVertex2dv : NULL;
+  tbl.glVertex2f = layers&(EMU_ROUTE_IFF) ? emu_glVertex2f : NULL;
+  tbl.glVertex2fv = layers&(EMU_ROUTE_IFF) ? emu_glVertex2fv : NULL;
+  tbl.glVertex2i = layers&(EMU_ROUTE_IFF) ? emu_glVertex2i : NULL;
+  tbl.glVertex2iv = layers&(EMU_ROUTE_IFF) ? emu_glVertex2iv : NULL;
+  tbl.glVertex2s = layers&(EMU_ROUTE_IFF) ? emu_glVertex2s : NULL;
+  tbl.glVertex2sv = layers&(EMU_ROUTE_IFF) ? emu_glVertex2sv : NULL;
+  tbl.glVertex3d = layers&(EMU_ROUTE_IFF) ? emu_glVertex3d : NULL;
+  tbl.glVertex3dv = layers&(EMU_ROUTE_IFF) ? emu_glVertex3dv : NULL;
+  tbl.glVertex3f = layers&(EMU_ROUTE_IFF) ? emu_glVertex3f : NULL;
+  tbl.glVertex3fv = layers&(EMU_ROUTE_IFF) ? emu_glVertex3fv : NULL;
+  tbl.glVertex3i = layers&(EMU_ROUTE_IFF) ? emu_glVertex3i : NULL;
+  tbl.glVertex3iv = layers&(EMU_ROUTE_IFF) ? emu_glVertex3iv : NULL;
+  tbl.glVertex3s = layers&(EMU_ROUTE_IFF) ? emu_glVertex3s : NULL;
+  tbl.glVertex3sv = layers&(EMU_ROUTE_IFF) ? emu_glVertex3sv : NULL;
+  tbl.glVertex4d = layers&(EMU_ROUTE_IFF) ? emu_glVertex4d : NULL;
+  tbl.glVertex4dv = layers&(EMU_ROUTE_IFF) ? emu_glVertex4dv : NULL;
+  tbl.glVertex4f = layers&(EMU_ROUTE_IFF) ? emu_glVertex4f : NULL;
+  tbl.glVertex4fv = layers&(EMU_ROUTE_IFF) ? emu_glVertex4fv : NULL;
+  tbl.glVertex4i = layers&(EMU_ROUTE_IFF) ? emu_glVertex4i : NULL;
+  tbl.glVertex4iv = layers&(EMU_ROUTE_IFF) ? emu_glVertex4iv : NULL;
+  tbl.glVertex4s = layers&(EMU_ROUTE_IFF) ? emu_glVertex4s : NULL;
+  tbl.glVertex4sv = layers&(EMU_ROUTE_IFF) ? emu_glVertex4sv : NULL;
+  tbl.glViewport = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glViewport : NULL;
+
+  // GL_VERSION_1_1
+
+  tbl.glArrayElement = layers&(EMU_ROUTE_IFF) ? emu_glArrayElement : NULL;
+  tbl.glBindTexture = emu_glBindTexture;
+  tbl.glColorPointer = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV|EMU_ROUTE_IFF|EMU_ROUTE_DSA|EMU_ROUTE_VAO) ? emu_glColorPointer : NULL;
+  tbl.glCopyTexImage1D = layers&(EMU_ROUTE_IFF) ? emu_glCopyTexImage1D : NULL;
+  tbl.glCopyTexImage2D = layers&(EMU_ROUTE_IFF) ? emu_glCopyTexImage2D : NULL;
+  tbl.glCopyTexSubImage1D = layers&(EMU_ROUTE_IFF) ? emu_glCopyTexSubImage1D : NULL;
+  tbl.glCopyTexSubImage2D = layers&(EMU_ROUTE_IFF) ? emu_glCopyTexSubImage2D : NULL;
+  tbl.glDeleteTextures = layers&(EMU_ROUTE_OBJ|EMU_ROUTE_TEXSTO|EMU_ROUTE_IFF|EMU_ROUTE_SO|EMU_ROUTE_DSA|EMU_ROUTE_TEXC) ? emu_glDeleteTextures : NULL;
+  tbl.glDisableClientState = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV|EMU_ROUTE_IFF|EMU_ROUTE_DSA|EMU_ROUTE_VAO) ? emu_glDisableClientState : NULL;
+  tbl.glDrawArrays = layers&(EMU_ROUTE_IFF|EMU_ROUTE_QUADS|EMU_ROUTE_SO|EMU_ROUTE_DSA|EMU_ROUTE_VAO) ? emu_glDrawArrays : NULL;
+  tbl.glDrawElements = layers&(EMU_ROUTE_IFF|EMU_ROUTE_SO|EMU_ROUTE_DSA|EMU_ROUTE_VAO) ? emu_glDrawElements : NULL;
+  tbl.glEdgeFlagPointer = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV|EMU_ROUTE_IFF) ? emu_glEdgeFlagPointer : NULL;
+  tbl.glEnableClientState = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV|EMU_ROUTE_IFF|EMU_ROUTE_DSA|EMU_ROUTE_VAO) ? emu_glEnableClientState : NULL;
+  tbl.glGenTextures = layers&(EMU_ROUTE_OBJ|EMU_ROUTE_SO|EMU_ROUTE_TEXC) ? emu_glGenTextures : NULL;
+  tbl.glIndexPointer = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV) ? emu_glIndexPointer : NULL;
+  tbl.glInterleavedArrays = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV|EMU_ROUTE_VAO) ? emu_glInterleavedArrays : NULL;
+  tbl.glIsTexture = layers&(EMU_ROUTE_OBJ) ? emu_glIsTexture : NULL;
+  tbl.glNormalPointer = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV|EMU_ROUTE_IFF|EMU_ROUTE_DSA|EMU_ROUTE_VAO) ? emu_glNormalPointer : NULL;
+  tbl.glPolygonOffset = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glPolygonOffset : NULL;
+  tbl.glPopClientAttrib = layers&(EMU_ROUTE_PPCA) ? emu_glPopClientAttrib : NULL;
+  tbl.glPushClientAttrib = layers&(EMU_ROUTE_PPCA) ? emu_glPushClientAttrib : NULL;
+  tbl.glTexCoordPointer = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV|EMU_ROUTE_IFF|EMU_ROUTE_DSA|EMU_ROUTE_VAO) ? emu_glTexCoordPointer : NULL;
+  tbl.glTexSubImage1D = layers&(EMU_ROUTE_IFF) ? emu_glTexSubImage1D : NULL;
+  tbl.glTexSubImage2D = emu_glTexSubImage2D;
+  tbl.glVertexPointer = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV|EMU_ROUTE_IFF|EMU_ROUTE_DSA|EMU_ROUTE_VAO) ? emu_glVertexPointer : NULL;
+
+  // GL_VERSION_1_2
+
+  tbl.glCopyTexSubImage3D = layers&(EMU_ROUTE_IFF) ? emu_glCopyTexSubImage3D : NULL;
+  tbl.glDrawRangeElements = layers&(EMU_ROUTE_IFF|EMU_ROUTE_SO|EMU_ROUTE_VAO|EMU_ROUTE_FILT) ? emu_glDrawRangeElements : NULL;
+  tbl.glTexImage3D = layers&(EMU_ROUTE_IFF|EMU_ROUTE_FILT) ? emu_glTexImage3D : NULL;
+  tbl.glTexSubImage3D = layers&(EMU_ROUTE_IFF) ? emu_glTexSubImage3D : NULL;
+
+  // GL_VERSION_1_3
+
+  tbl.glActiveTexture = layers&(EMU_ROUTE_PPA|EMU_ROUTE_XFER|EMU_ROUTE_IFF|EMU_ROUTE_SO|EMU_ROUTE_DSA|EMU_ROUTE_TEXC) ? emu_glActiveTexture : NULL;
+  tbl.glClientActiveTexture = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV|EMU_ROUTE_IFF|EMU_ROUTE_DSA|EMU_ROUTE_VAO|EMU_ROUTE_FILT) ? emu_glClientActiveTexture : NULL;
+  tbl.glCompressedTexImage1D = layers&(EMU_ROUTE_IFF) ? emu_glCompressedTexImage1D : NULL;
+  tbl.glCompressedTexImage2D = layers&(EMU_ROUTE_XFER|EMU_ROUTE_IFF) ? emu_glCompressedTexImage2D : NULL;
+  tbl.glCompressedTexImage3D = layers&(EMU_ROUTE_IFF) ? emu_glCompressedTexImage3D : NULL;
+  tbl.glCompressedTexSubImage1D = layers&(EMU_ROUTE_IFF) ? emu_glCompressedTexSubImage1D : NULL;
+  tbl.glCompressedTexSubImage2D = layers&(EMU_ROUTE_XFER|EMU_ROUTE_IFF) ? emu_glCompressedTexSubImage2D : NULL;
+  tbl.glCompressedTexSubImage3D = layers&(EMU_ROUTE_IFF) ? emu_glCompressedTexSubImage3D : NULL;
+  tbl.glGetCompressedTexImage = layers&(EMU_ROUTE_IFF|EMU_ROUTE_VAO) ? emu_glGetCompressedTexImage : NULL;
+  tbl.glLoadTransposeMatrixd = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glLoadTransposeMatrixd : NULL;
+  tbl.glLoadTransposeMatrixf = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glLoadTransposeMatrixf : NULL;
+  tbl.glMultTransposeMatrixd = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glMultTransposeMatrixd : NULL;
+  tbl.glMultTransposeMatrixf = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glMultTransposeMatrixf : NULL;
+  tbl.glMultiTexCoord1d = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord1d : NULL;
+  tbl.glMultiTexCoord1dv = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord1dv : NULL;
+  tbl.glMultiTexCoord1f = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord1f : NULL;
+  tbl.glMultiTexCoord1fv = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord1fv : NULL;
+  tbl.glMultiTexCoord1i = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord1i : NULL;
+  tbl.glMultiTexCoord1iv = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord1iv : NULL;
+  tbl.glMultiTexCoord1s = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord1s : NULL;
+  tbl.glMultiTexCoord1sv = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord1sv : NULL;
+  tbl.glMultiTexCoord2d = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord2d : NULL;
+  tbl.glMultiTexCoord2dv = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord2dv : NULL;
+  tbl.glMultiTexCoord2f = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord2f : NULL;
+  tbl.glMultiTexCoord2fv = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord2fv : NULL;
+  tbl.glMultiTexCoord2i = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord2i : NULL;
+  tbl.glMultiTexCoord2iv = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord2iv : NULL;
+  tbl.glMultiTexCoord2s = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord2s : NULL;
+  tbl.glMultiTexCoord2sv = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord2sv : NULL;
+  tbl.glMultiTexCoord3d = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord3d : NULL;
+  tbl.glMultiTexCoord3dv = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord3dv : NULL;
+  tbl.glMultiTexCoord3f = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord3f : NULL;
+  tbl.glMultiTexCoord3fv = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord3fv : NULL;
+  tbl.glMultiTexCoord3i = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord3i : NULL;
+  tbl.glMultiTexCoord3iv = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord3iv : NULL;
+  tbl.glMultiTexCoord3s = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord3s : NULL;
+  tbl.glMultiTexCoord3sv = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord3sv : NULL;
+  tbl.glMultiTexCoord4d = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord4d : NULL;
+  tbl.glMultiTexCoord4dv = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord4dv : NULL;
+  tbl.glMultiTexCoord4f = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord4f : NULL;
+  tbl.glMultiTexCoord4fv = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord4fv : NULL;
+  tbl.glMultiTexCoord4i = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord4i : NULL;
+  tbl.glMultiTexCoord4iv = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord4iv : NULL;
+  tbl.glMultiTexCoord4s = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord4s : NULL;
+  tbl.glMultiTexCoord4sv = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord4sv : NULL;
+  tbl.glSampleCoverage = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glSampleCoverage : NULL;
+
+  // GL_VERSION_1_4
+
+  tbl.glBlendColor = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glBlendColor : NULL;
+  tbl.glBlendEquation = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glBlendEquation : NULL;
+  tbl.glBlendFuncSeparate = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glBlendFuncSeparate : NULL;
+  tbl.glFogCoordPointer = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV|EMU_ROUTE_IFF|EMU_ROUTE_VAO) ? emu_glFogCoordPointer : NULL;
+  tbl.glMultiDrawArrays = layers&(EMU_ROUTE_IFF|EMU_ROUTE_SO|EMU_ROUTE_DSA|EMU_ROUTE_VAO) ? emu_glMultiDrawArrays : NULL;
+  tbl.glMultiDrawElements = layers&(EMU_ROUTE_IFF|EMU_ROUTE_SO|EMU_ROUTE_DSA|EMU_ROUTE_VAO) ? emu_glMultiDrawElements : NULL;
+  tbl.glPointParameterf = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glPointParameterf : NULL;
+  tbl.glPointParameterfv = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glPointParameterfv : NULL;
+  tbl.glPointParameteri = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glPointParameteri : NULL;
+  tbl.glPointParameteriv = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glPointParameteriv : NULL;
+  tbl.glSecondaryColor3b = layers&(EMU_ROUTE_IFF) ? emu_glSecondaryColor3b : NULL;
+  tbl.glSecondaryColor3bv = layers&(EMU_ROUTE_IFF) ? emu_glSecondaryColor3bv : NULL;
+  tbl.glSecondaryColor3d = layers&(EMU_ROUTE_IFF) ? emu_glSecondaryColor3d : NULL;
+  tbl.glSecondaryColor3dv = layers&(EMU_ROUTE_IFF) ? emu_glSecondaryColor3dv : NULL;
+  tbl.glSecondaryColor3f = layers&(EMU_ROUTE_IFF) ? emu_glSecondaryColor3f : NULL;
+  tbl.glSecondaryColor3fv = layers&(EMU_ROUTE_IFF) ? emu_glSecondaryColor3fv : NULL;
+  tbl.glSecondaryColor3i = layers&(EMU_ROUTE_IFF) ? emu_glSecondaryColor3i : NULL;
+  tbl.glSecondaryColor3iv = layers&(EMU_ROUTE_IFF) ? emu_glSecondaryColor3iv : NULL;
+  tbl.glSecondaryColor3s = layers&(EMU_ROUTE_IFF) ? emu_glSecondaryColor3s : NULL;
+  tbl.glSecondaryColor3sv = layers&(EMU_ROUTE_IFF) ? emu_glSecondaryColor3sv : NULL;
+  tbl.glSecondaryColor3ub = layers&(EMU_ROUTE_IFF) ? emu_glSecondaryColor3ub : NULL;
+  tbl.glSecondaryColor3ubv = layers&(EMU_ROUTE_IFF) ? emu_glSecondaryColor3ubv : NULL;
+  tbl.glSecondaryColor3ui = layers&(EMU_ROUTE_IFF) ? emu_glSecondaryColor3ui : NULL;
+  tbl.glSecondaryColor3uiv = layers&(EMU_ROUTE_IFF) ? emu_glSecondaryColor3uiv : NULL;
+  tbl.glSecondaryColor3us = layers&(EMU_ROUTE_IFF) ? emu_glSecondaryColor3us : NULL;
+  tbl.glSecondaryColor3usv = layers&(EMU_ROUTE_IFF) ? emu_glSecondaryColor3usv : NULL;
+  tbl.glSecondaryColorPointer = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV|EMU_ROUTE_IFF|EMU_ROUTE_DSA|EMU_ROUTE_VAO) ? emu_glSecondaryColorPointer : NULL;
+  tbl.glWindowPos2d = layers&(EMU_ROUTE_IFF|EMU_ROUTE_FILT) ? emu_glWindowPos2d : NULL;
+  tbl.glWindowPos2dv = layers&(EMU_ROUTE_FILT) ? emu_glWindowPos2dv : NULL;
+  tbl.glWindowPos2f = layers&(EMU_ROUTE_IFF|EMU_ROUTE_FILT) ? emu_glWindowPos2f : NULL;
+  tbl.glWindowPos2fv = layers&(EMU_ROUTE_FILT) ? emu_glWindowPos2fv : NULL;
+  tbl.glWindowPos2i = layers&(EMU_ROUTE_IFF|EMU_ROUTE_FILT) ? emu_glWindowPos2i : NULL;
+  tbl.glWindowPos2iv = layers&(EMU_ROUTE_FILT) ? emu_glWindowPos2iv : NULL;
+  tbl.glWindowPos2s = layers&(EMU_ROUTE_IFF|EMU_ROUTE_FILT) ? emu_glWindowPos2s : NULL;
+  tbl.glWindowPos2sv = layers&(EMU_ROUTE_FILT) ? emu_glWindowPos2sv : NULL;
+  tbl.glWindowPos3d = layers&(EMU_ROUTE_IFF|EMU_ROUTE_FILT) ? emu_glWindowPos3d : NULL;
+  tbl.glWindowPos3dv = layers&(EMU_ROUTE_FILT) ? emu_glWindowPos3dv : NULL;
+  tbl.glWindowPos3f = layers&(EMU_ROUTE_IFF|EMU_ROUTE_FILT) ? emu_glWindowPos3f : NULL;
+  tbl.glWindowPos3fv = layers&(EMU_ROUTE_FILT) ? emu_glWindowPos3fv : NULL;
+  tbl.glWindowPos3i = layers&(EMU_ROUTE_IFF|EMU_ROUTE_FILT) ? emu_glWindowPos3i : NULL;
+  tbl.glWindowPos3iv = layers&(EMU_ROUTE_FILT) ? emu_glWindowPos3iv : NULL;
+  tbl.glWindowPos3s = layers&(EMU_ROUTE_IFF|EMU_ROUTE_FILT) ? emu_glWindowPos3s : NULL;
+  tbl.glWindowPos3sv = layers&(EMU_ROUTE_FILT) ? emu_glWindowPos3sv : NULL;
+
+  // GL_VERSION_1_5
+
+  tbl.glBeginQuery = layers&(EMU_ROUTE_IFF) ? emu_glBeginQuery : NULL;
+  tbl.glBindBuffer = layers&(EMU_ROUTE_OBJ|EMU_ROUTE_PPCA|EMU_ROUTE_BV|EMU_ROUTE_IFF|EMU_ROUTE_QUADS|EMU_ROUTE_DSA|EMU_ROUTE_VAO) ? emu_glBindBuffer : NULL;
+  tbl.glBufferData = layers&(EMU_ROUTE_DSA|EMU_ROUTE_VAO) ? emu_glBufferData : NULL;
+  tbl.glBufferSubData = layers&(EMU_ROUTE_DSA|EMU_ROUTE_VAO) ? emu_glBufferSubData : NULL;
+  tbl.glDeleteBuffers = layers&(EMU_ROUTE_OBJ|EMU_ROUTE_PPCA|EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glDeleteBuffers : NULL;
+  tbl.glEndQuery = layers&(EMU_ROUTE_IFF) ? emu_glEndQuery : NULL;
+  tbl.glGenBuffers = layers&(EMU_ROUTE_OBJ) ? emu_glGenBuffers : NULL;
+  tbl.glGetBufferParameteriv = layers&(EMU_ROUTE_DSA) ? emu_glGetBufferParameteriv : NULL;
+  tbl.glGetBufferPointerv = layers&(EMU_ROUTE_DSA) ? emu_glGetBufferPointerv : NULL;
+  tbl.glGetBufferSubData = layers&(EMU_ROUTE_DSA) ? emu_glGetBufferSubData : NULL;
+  tbl.glGetQueryObjectiv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_VAO) ? emu_glGetQueryObjectiv : NULL;
+  tbl.glGetQueryObjectuiv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_VAO) ? emu_glGetQueryObjectuiv : NULL;
+  tbl.glIsBuffer = layers&(EMU_ROUTE_OBJ) ? emu_glIsBuffer : NULL;
+  tbl.glMapBuffer = layers&(EMU_ROUTE_DSA|EMU_ROUTE_VAO|EMU_ROUTE_FILT) ? emu_glMapBuffer : NULL;
+  tbl.glUnmapBuffer = layers&(EMU_ROUTE_DSA|EMU_ROUTE_VAO|EMU_ROUTE_FILT) ? emu_glUnmapBuffer : NULL;
+
+  // GL_VERSION_2_0
+
+  tbl.glBlendEquationSeparate = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glBlendEquationSeparate : NULL;
+  tbl.glCreateShader = layers&(EMU_ROUTE_IFF) ? emu_glCreateShader : NULL;
+  tbl.glDeleteProgram = layers&(EMU_ROUTE_DSA) ? emu_glDeleteProgram : NULL;
+  tbl.glDisableVertexAttribArray = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV|EMU_ROUTE_IFF|EMU_ROUTE_VAO) ? emu_glDisableVertexAttribArray : NULL;
+  tbl.glDrawBuffers = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF|EMU_ROUTE_FILT) ? emu_glDrawBuffers : NULL;
+  tbl.glEnableVertexAttribArray = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV|EMU_ROUTE_IFF|EMU_ROUTE_VAO) ? emu_glEnableVertexAttribArray : NULL;
+  tbl.glGetVertexAttribPointerv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_VAO) ? emu_glGetVertexAttribPointerv : NULL;
+  tbl.glGetVertexAttribdv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_VAO) ? emu_glGetVertexAttribdv : NULL;
+  tbl.glGetVertexAttribfv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_VAO) ? emu_glGetVertexAttribfv : NULL;
+  tbl.glGetVertexAttribiv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_VAO) ? emu_glGetVertexAttribiv : NULL;
+  tbl.glLinkProgram = layers&(EMU_ROUTE_IFF) ? emu_glLinkProgram : NULL;
+  tbl.glShaderSource = layers&(EMU_ROUTE_IFF) ? emu_glShaderSource : NULL;
+  tbl.glStencilFuncSeparate = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glStencilFuncSeparate : NULL;
+  tbl.glStencilMaskSeparate = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glStencilMaskSeparate : NULL;
+  tbl.glStencilOpSeparate = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glStencilOpSeparate : NULL;
+  tbl.glUniform1f = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniform1f : NULL;
+  tbl.glUniform1fv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniform1fv : NULL;
+  tbl.glUniform1i = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniform1i : NULL;
+  tbl.glUniform1iv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniform1iv : NULL;
+  tbl.glUniform2f = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniform2f : NULL;
+  tbl.glUniform2fv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniform2fv : NULL;
+  tbl.glUniform2i = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniform2i : NULL;
+  tbl.glUniform2iv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniform2iv : NULL;
+  tbl.glUniform3f = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniform3f : NULL;
+  tbl.glUniform3fv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniform3fv : NULL;
+  tbl.glUniform3i = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniform3i : NULL;
+  tbl.glUniform3iv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniform3iv : NULL;
+  tbl.glUniform4f = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniform4f : NULL;
+  tbl.glUniform4fv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniform4fv : NULL;
+  tbl.glUniform4i = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniform4i : NULL;
+  tbl.glUniform4iv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniform4iv : NULL;
+  tbl.glUniformMatrix2fv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniformMatrix2fv : NULL;
+  tbl.glUniformMatrix3fv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniformMatrix3fv : NULL;
+  tbl.glUniformMatrix4fv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniformMatrix4fv : NULL;
+  tbl.glUseProgram = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUseProgram : NULL;
+  tbl.glVertexAttrib1d = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib1d : NULL;
+  tbl.glVertexAttrib1dv = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib1dv : NULL;
+  tbl.glVertexAttrib1f = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib1f : NULL;
+  tbl.glVertexAttrib1fv = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib1fv : NULL;
+  tbl.glVertexAttrib1s = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib1s : NULL;
+  tbl.glVertexAttrib1sv = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib1sv : NULL;
+  tbl.glVertexAttrib2d = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib2d : NULL;
+  tbl.glVertexAttrib2dv = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib2dv : NULL;
+  tbl.glVertexAttrib2f = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib2f : NULL;
+  tbl.glVertexAttrib2fv = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib2fv : NULL;
+  tbl.glVertexAttrib2s = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib2s : NULL;
+  tbl.glVertexAttrib2sv = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib2sv : NULL;
+  tbl.glVertexAttrib3d = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib3d : NULL;
+  tbl.glVertexAttrib3dv = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib3dv : NULL;
+  tbl.glVertexAttrib3f = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib3f : NULL;
+  tbl.glVertexAttrib3fv = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib3fv : NULL;
+  tbl.glVertexAttrib3s = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib3s : NULL;
+  tbl.glVertexAttrib3sv = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib3sv : NULL;
+  tbl.glVertexAttrib4Nbv = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib4Nbv : NULL;
+  tbl.glVertexAttrib4Niv = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib4Niv : NULL;
+  tbl.glVertexAttrib4Nsv = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib4Nsv : NULL;
+  tbl.glVertexAttrib4Nub = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib4Nub : NULL;
+  tbl.glVertexAttrib4Nubv = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib4Nubv : NULL;
+  tbl.glVertexAttrib4Nusv = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib4Nusv : NULL;
+  tbl.glVertexAttrib4bv = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib4bv : NULL;
+  tbl.glVertexAttrib4d = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib4d : NULL;
+  tbl.glVertexAttrib4dv = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib4dv : NULL;
+  tbl.glVertexAttrib4f = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib4f : NULL;
+  tbl.glVertexAttrib4fv = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib4fv : NULL;
+  tbl.glVertexAttrib4iv = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib4iv : NULL;
+  tbl.glVertexAttrib4s = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib4s : NULL;
+  tbl.glVertexAttrib4sv = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib4sv : NULL;
+  tbl.glVertexAttrib4ubv = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib4ubv : NULL;
+  tbl.glVertexAttrib4usv = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib4usv : NULL;
+  tbl.glVertexAttribPointer = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV|EMU_ROUTE_IFF|EMU_ROUTE_VAO) ? emu_glVertexAttribPointer : NULL;
+
+  // GL_VERSION_2_1
+
+  tbl.glUniformMatrix2x3fv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniformMatrix2x3fv : NULL;
+  tbl.glUniformMatrix2x4fv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniformMatrix2x4fv : NULL;
+  tbl.glUniformMatrix3x2fv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniformMatrix3x2fv : NULL;
+  tbl.glUniformMatrix3x4fv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniformMatrix3x4fv : NULL;
+  tbl.glUniformMatrix4x2fv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniformMatrix4x2fv : NULL;
+  tbl.glUniformMatrix4x3fv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniformMatrix4x3fv : NULL;
+
+  // GL_VERSION_3_0
+
+  tbl.glBeginTransformFeedback = layers&(EMU_ROUTE_VAO) ? emu_glBeginTransformFeedback : NULL;
+  tbl.glClampColor = layers&(EMU_ROUTE_PPA) ? emu_glClampColor : NULL;
+  tbl.glClearBufferfi = layers&(EMU_ROUTE_IFF) ? emu_glClearBufferfi : NULL;
+  tbl.glClearBufferfv = layers&(EMU_ROUTE_IFF) ? emu_glClearBufferfv : NULL;
+  tbl.glClearBufferiv = layers&(EMU_ROUTE_IFF) ? emu_glClearBufferiv : NULL;
+  tbl.glClearBufferuiv = layers&(EMU_ROUTE_IFF) ? emu_glClearBufferuiv : NULL;
+  tbl.glColorMaski = layers&(EMU_ROUTE_PPA) ? emu_glColorMaski : NULL;
+  tbl.glDisablei = layers&(EMU_ROUTE_PPA|EMU_ROUTE_PPCA|EMU_ROUTE_BV|EMU_ROUTE_IFF) ? emu_glDisablei : NULL;
+  tbl.glEnablei = layers&(EMU_ROUTE_PPA|EMU_ROUTE_PPCA|EMU_ROUTE_BV|EMU_ROUTE_IFF) ? emu_glEnablei : NULL;
+  tbl.glEndTransformFeedback = layers&(EMU_ROUTE_VAO) ? emu_glEndTransformFeedback : NULL;
+  tbl.glGetBooleani_v = layers&(EMU_ROUTE_PPA) ? emu_glGetBooleani_v : NULL;
+  tbl.glGetTexParameterIiv = layers&(EMU_ROUTE_TEXSTO|EMU_ROUTE_SO) ? emu_glGetTexParameterIiv : NULL;
+  tbl.glGetTexParameterIuiv = layers&(EMU_ROUTE_TEXSTO|EMU_ROUTE_SO) ? emu_glGetTexParameterIuiv : NULL;
+  tbl.glIsEnabledi = layers&(EMU_ROUTE_PPA) ? emu_glIsEnabledi : NULL;
+  tbl.glTexParameterIiv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_SO) ? emu_glTexParameterIiv : NULL;
+  tbl.glTexParameterIuiv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_SO) ? emu_glTexParameterIuiv : NULL;
+  tbl.glUniform1ui = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniform1ui : NULL;
+  tbl.glUniform1uiv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniform1uiv : NULL;
+  tbl.glUniform2ui = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniform2ui : NULL;
+  tbl.glUniform2uiv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniform2uiv : NULL;
+  tbl.glUniform3ui = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniform3ui : NULL;
+  tbl.glUniform3uiv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniform3uiv : NULL;
+  tbl.glUniform4ui = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniform4ui : NULL;
+  tbl.glUniform4uiv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniform4uiv : NULL;
+  tbl.glVertexAttribIPointer = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV|EMU_ROUTE_VAO) ? emu_glVertexAttribIPointer : NULL;
+
+  // GL_VERSION_3_1
+
+  tbl.glDrawArraysInstanced = layers&(EMU_ROUTE_IFF|EMU_ROUTE_SO|EMU_ROUTE_DSA|EMU_ROUTE_VAO) ? emu_glDrawArraysInstanced : NULL;
+  tbl.glDrawElementsInstanced = layers&(EMU_ROUTE_IFF|EMU_ROUTE_SO|EMU_ROUTE_DSA|EMU_ROUTE_VAO) ? emu_glDrawElementsInstanced : NULL;
+  tbl.glPrimitiveRestartIndex = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV) ? emu_glPrimitiveRestartIndex : NULL;
+  tbl.glTexBuffer = layers&(EMU_ROUTE_DSA) ? emu_glTexBuffer : NULL;
+
+  // GL_VERSION_3_2
+
+  tbl.glFramebufferTexture = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glFramebufferTexture : NULL;
+
+  // GL_VERSION_3_3
+
+  tbl.glVertexAttribDivisor = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV) ? emu_glVertexAttribDivisor : NULL;
+
+  // GL_VERSION_4_0
+
+  tbl.glBlendEquationSeparatei = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glBlendEquationSeparatei : NULL;
+  tbl.glBlendEquationi = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glBlendEquationi : NULL;
+  tbl.glBlendFuncSeparatei = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glBlendFuncSeparatei : NULL;
+  tbl.glBlendFunci = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glBlendFunci : NULL;
+  tbl.glDrawArraysIndirect = layers&(EMU_ROUTE_IFF|EMU_ROUTE_SO|EMU_ROUTE_DSA) ? emu_glDrawArraysIndirect : NULL;
+  tbl.glDrawElementsIndirect = layers&(EMU_ROUTE_IFF|EMU_ROUTE_SO|EMU_ROUTE_DSA) ? emu_glDrawElementsIndirect : NULL;
+  tbl.glMinSampleShading = layers&(EMU_ROUTE_PPA) ? emu_glMinSampleShading : NULL;
+
+  // GL_AMD_multi_draw_indirect
+
+  tbl.glMultiDrawArraysIndirectAMD = layers&(EMU_ROUTE_IFF|EMU_ROUTE_SO|EMU_ROUTE_DSA) ? emu_glMultiDrawArraysIndirectAMD : NULL;
+  tbl.glMultiDrawElementsIndirectAMD = layers&(EMU_ROUTE_IFF|EMU_ROUTE_SO|EMU_ROUTE_DSA) ? emu_glMultiDrawElementsIndirectAMD : NULL;
+
+  // GL_ANGLE_framebuffer_blit
+
+  tbl.glBlitFramebufferANGLE = layers&(EMU_ROUTE_FILT) ? emu_glBlitFramebufferANGLE : NULL;
+
+  // GL_APPLE_element_array
+
+  tbl.glDrawElementArrayAPPLE = layers&(EMU_ROUTE_IFF|EMU_ROUTE_SO|EMU_ROUTE_DSA) ? emu_glDrawElementArrayAPPLE : NULL;
+  tbl.glDrawRangeElementArrayAPPLE = layers&(EMU_ROUTE_IFF|EMU_ROUTE_SO) ? emu_glDrawRangeElementArrayAPPLE : NULL;
+  tbl.glMultiDrawElementArrayAPPLE = layers&(EMU_ROUTE_IFF|EMU_ROUTE_SO|EMU_ROUTE_DSA) ? emu_glMultiDrawElementArrayAPPLE : NULL;
+  tbl.glMultiDrawRangeElementArrayAPPLE = layers&(EMU_ROUTE_IFF|EMU_ROUTE_SO) ? emu_glMultiDrawRangeElementArrayAPPLE : NULL;
+
+  // GL_APPLE_flush_buffer_range
+
+  tbl.glFlushMappedBufferRangeAPPLE = layers&(EMU_ROUTE_VAO) ? emu_glFlushMappedBufferRangeAPPLE : NULL;
+
+  // GL_APPLE_vertex_array_object
+
+  tbl.glBindVertexArrayAPPLE = layers&(EMU_ROUTE_IFF) ? emu_glBindVertexArrayAPPLE : NULL;
+  tbl.glDeleteVertexArraysAPPLE = layers&(EMU_ROUTE_DSA) ? emu_glDeleteVertexArraysAPPLE : NULL;
+
+  // GL_ARB_ES2_compatibility
+
+  tbl.glClearDepthf = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF) ? emu_glClearDepthf : NULL;
+  tbl.glDepthRangef = layers&(EMU_ROUTE_PPA) ? emu_glDepthRangef : NULL;
+  tbl.glShaderBinary = layers&(EMU_ROUTE_BIN) ? emu_glShaderBinary : NULL;
+
+  // GL_ARB_base_instance
+
+  tbl.glDrawArraysInstancedBaseInstance = layers&(EMU_ROUTE_VAO) ? emu_glDrawArraysInstancedBaseInstance : NULL;
+  tbl.glDrawElementsInstancedBaseInstance = layers&(EMU_ROUTE_VAO) ? emu_glDrawElementsInstancedBaseInstance : NULL;
+  tbl.glDrawElementsInstancedBaseVertexBaseInstance = layers&(EMU_ROUTE_BV|EMU_ROUTE_VAO) ? emu_glDrawElementsInstancedBaseVertexBaseInstance : NULL;
+
+  // GL_ARB_buffer_storage
+
+  tbl.glBufferStorage = layers&(EMU_ROUTE_VAO) ? emu_glBufferStorage : NULL;
+  tbl.glNamedBufferStorageEXT = layers&(EMU_ROUTE_VAO) ? emu_glNamedBufferStorageEXT : NULL;
+
+  // GL_ARB_clear_buffer_object
+
+  tbl.glClearBufferData = layers&(EMU_ROUTE_VAO) ? emu_glClearBufferData : NULL;
+  tbl.glClearBufferSubData = layers&(EMU_ROUTE_VAO) ? emu_glClearBufferSubData : NULL;
+  tbl.glClearNamedBufferDataEXT = layers&(EMU_ROUTE_VAO) ? emu_glClearNamedBufferDataEXT : NULL;
+  tbl.glClearNamedBufferSubDataEXT = layers&(EMU_ROUTE_VAO) ? emu_glClearNamedBufferSubDataEXT : NULL;
+
+  // GL_ARB_copy_buffer
+
+  tbl.glCopyBufferSubData = layers&(EMU_ROUTE_DSA|EMU_ROUTE_VAO) ? emu_glCopyBufferSubData : NULL;
+
+  // GL_ARB_direct_state_access
+
+  tbl.glClearNamedBufferData = layers&(EMU_ROUTE_VAO) ? emu_glClearNamedBufferData : NULL;
+  tbl.glClearNamedBufferSubData = layers&(EMU_ROUTE_VAO) ? emu_glClearNamedBufferSubData : NULL;
+  tbl.glCopyNamedBufferSubData = layers&(EMU_ROUTE_VAO) ? emu_glCopyNamedBufferSubData : NULL;
+  tbl.glFlushMappedNamedBufferRange = layers&(EMU_ROUTE_VAO) ? emu_glFlushMappedNamedBufferRange : NULL;
+  tbl.glGetCompressedTextureImage = layers&(EMU_ROUTE_VAO) ? emu_glGetCompressedTextureImage : NULL;
+  tbl.glGetTextureImage = layers&(EMU_ROUTE_VAO) ? emu_glGetTextureImage : NULL;
+  tbl.glMapNamedBuffer = layers&(EMU_ROUTE_VAO) ? emu_glMapNamedBuffer : NULL;
+  tbl.glMapNamedBufferRange = layers&(EMU_ROUTE_VAO) ? emu_glMapNamedBufferRange : NULL;
+  tbl.glNamedBufferData = layers&(EMU_ROUTE_VAO) ? emu_glNamedBufferData : NULL;
+  tbl.glNamedBufferStorage = layers&(EMU_ROUTE_VAO) ? emu_glNamedBufferStorage : NULL;
+  tbl.glNamedBufferSubData = layers&(EMU_ROUTE_VAO) ? emu_glNamedBufferSubData : NULL;
+  tbl.glUnmapNamedBuffer = layers&(EMU_ROUTE_VAO) ? emu_glUnmapNamedBuffer : NULL;
+
+  // GL_ARB_draw_buffers
+
+  tbl.glDrawBuffersARB = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF|EMU_ROUTE_FILT) ? emu_glDrawBuffersARB : NULL;
+
+  // GL_ARB_draw_buffers_blend
+
+  tbl.glBlendEquationSeparateiARB = layers&(EMU_ROUTE_IFF) ? emu_glBlendEquationSeparateiARB : NULL;
+  tbl.glBlendEquationiARB = layers&(EMU_ROUTE_IFF) ? emu_glBlendEquationiARB : NULL;
+  tbl.glBlendFuncSeparateiARB = layers&(EMU_ROUTE_IFF) ? emu_glBlendFuncSeparateiARB : NULL;
+  tbl.glBlendFunciARB = layers&(EMU_ROUTE_IFF) ? emu_glBlendFunciARB : NULL;
+
+  // GL_ARB_draw_elements_base_vertex
+
+  tbl.glDrawElementsBaseVertex = layers&(EMU_ROUTE_BV|EMU_ROUTE_IFF|EMU_ROUTE_SO|EMU_ROUTE_DSA|EMU_ROUTE_VAO) ? emu_glDrawElementsBaseVertex : NULL;
+  tbl.glDrawElementsInstancedBaseVertex = layers&(EMU_ROUTE_BV|EMU_ROUTE_IFF|EMU_ROUTE_SO|EMU_ROUTE_DSA|EMU_ROUTE_VAO) ? emu_glDrawElementsInstancedBaseVertex : NULL;
+  tbl.glDrawRangeElementsBaseVertex = layers&(EMU_ROUTE_BV|EMU_ROUTE_IFF|EMU_ROUTE_SO|EMU_ROUTE_VAO|EMU_ROUTE_FILT) ? emu_glDrawRangeElementsBaseVertex : NULL;
+  tbl.glMultiDrawElementsBaseVertex = layers&(EMU_ROUTE_BV|EMU_ROUTE_IFF|EMU_ROUTE_SO|EMU_ROUTE_DSA|EMU_ROUTE_VAO) ? emu_glMultiDrawElementsBaseVertex : NULL;
+
+  // GL_ARB_draw_instanced
+
+  tbl.glDrawArraysInstancedARB = layers&(EMU_ROUTE_IFF|EMU_ROUTE_SO|EMU_ROUTE_DSA|EMU_ROUTE_VAO) ? emu_glDrawArraysInstancedARB : NULL;
+  tbl.glDrawElementsInstancedARB = layers&(EMU_ROUTE_IFF|EMU_ROUTE_SO|EMU_ROUTE_DSA) ? emu_glDrawElementsInstancedARB : NULL;
+
+  // GL_ARB_framebuffer_object
+
+  tbl.glBindFramebuffer = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA|EMU_ROUTE_FILT) ? emu_glBindFramebuffer : NULL;
+  tbl.glBindRenderbuffer = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glBindRenderbuffer : NULL;
+  tbl.glBlitFramebuffer = layers&(EMU_ROUTE_IFF|EMU_ROUTE_FILT) ? emu_glBlitFramebuffer : NULL;
+  tbl.glDeleteFramebuffers = layers&(EMU_ROUTE_DSA) ? emu_glDeleteFramebuffers : NULL;
+  tbl.glDeleteRenderbuffers = layers&(EMU_ROUTE_DSA) ? emu_glDeleteRenderbuffers : NULL;
+  tbl.glFramebufferRenderbuffer = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA|EMU_ROUTE_FILT) ? emu_glFramebufferRenderbuffer : NULL;
+  tbl.glFramebufferTexture1D = layers&(EMU_ROUTE_OBJ|EMU_ROUTE_IFF|EMU_ROUTE_DSA|EMU_ROUTE_FILT) ? emu_glFramebufferTexture1D : NULL;
+  tbl.glFramebufferTexture2D = layers&(EMU_ROUTE_OBJ|EMU_ROUTE_IFF|EMU_ROUTE_DSA|EMU_ROUTE_FILT) ? emu_glFramebufferTexture2D : NULL;
+  tbl.glFramebufferTexture3D = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA|EMU_ROUTE_FILT) ? emu_glFramebufferTexture3D : NULL;
+  tbl.glFramebufferTextureLayer = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glFramebufferTextureLayer : NULL;
+  tbl.glGenerateMipmap = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA|EMU_ROUTE_TEXC|EMU_ROUTE_FILT) ? emu_glGenerateMipmap : NULL;
+  tbl.glGetFramebufferAttachmentParameteriv = layers&(EMU_ROUTE_OBJ|EMU_ROUTE_FILT) ? emu_glGetFramebufferAttachmentParameteriv : NULL;
+  tbl.glGetRenderbufferParameteriv = layers&(EMU_ROUTE_DSA) ? emu_glGetRenderbufferParameteriv : NULL;
+  tbl.glRenderbufferStorage = layers&(EMU_ROUTE_DSA) ? emu_glRenderbufferStorage : NULL;
+  tbl.glRenderbufferStorageMultisample = layers&(EMU_ROUTE_DSA) ? emu_glRenderbufferStorageMultisample : NULL;
+
+  // GL_ARB_geometry_shader4
+
+  tbl.glFramebufferTextureARB = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glFramebufferTextureARB : NULL;
+  tbl.glFramebufferTextureFaceARB = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glFramebufferTextureFaceARB : NULL;
+  tbl.glFramebufferTextureLayerARB = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glFramebufferTextureLayerARB : NULL;
+
+  // GL_ARB_get_texture_sub_image
+
+  tbl.glGetCompressedTextureSubImage = layers&(EMU_ROUTE_VAO) ? emu_glGetCompressedTextureSubImage : NULL;
+  tbl.glGetTextureSubImage = layers&(EMU_ROUTE_VAO) ? emu_glGetTextureSubImage : NULL;
+
+  // GL_ARB_gpu_shader_fp64
+
+  tbl.glUniform1d = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniform1d : NULL;
+  tbl.glUniform1dv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniform1dv : NULL;
+  tbl.glUniform2d = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniform2d : NULL;
+  tbl.glUniform2dv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniform2dv : NULL;
+  tbl.glUniform3d = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniform3d : NULL;
+  tbl.glUniform3dv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniform3dv : NULL;
+  tbl.glUniform4d = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniform4d : NULL;
+  tbl.glUniform4dv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniform4dv : NULL;
+  tbl.glUniformMatrix2dv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniformMatrix2dv : NULL;
+  tbl.glUniformMatrix2x3dv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniformMatrix2x3dv : NULL;
+  tbl.glUniformMatrix2x4dv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniformMatrix2x4dv : NULL;
+  tbl.glUniformMatrix3dv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniformMatrix3dv : NULL;
+  tbl.glUniformMatrix3x2dv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniformMatrix3x2dv : NULL;
+  tbl.glUniformMatrix3x4dv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniformMatrix3x4dv : NULL;
+  tbl.glUniformMatrix4dv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniformMatrix4dv : NULL;
+  tbl.glUniformMatrix4x2dv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniformMatrix4x2dv : NULL;
+  tbl.glUniformMatrix4x3dv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glUniformMatrix4x3dv : NULL;
+
+  // GL_ARB_imaging
+
+  tbl.glColorTableParameterfv = layers&(EMU_ROUTE_PPA) ? emu_glColorTableParameterfv : NULL;
+  tbl.glColorTableParameteriv = layers&(EMU_ROUTE_PPA) ? emu_glColorTableParameteriv : NULL;
+  tbl.glConvolutionParameterf = layers&(EMU_ROUTE_PPA) ? emu_glConvolutionParameterf : NULL;
+  tbl.glConvolutionParameterfv = layers&(EMU_ROUTE_PPA) ? emu_glConvolutionParameterfv : NULL;
+  tbl.glConvolutionParameteri = layers&(EMU_ROUTE_PPA) ? emu_glConvolutionParameteri : NULL;
+  tbl.glConvolutionParameteriv = layers&(EMU_ROUTE_PPA) ? emu_glConvolutionParameteriv : NULL;
+  tbl.glGetColorTableParameterfv = layers&(EMU_ROUTE_PPA) ? emu_glGetColorTableParameterfv : NULL;
+  tbl.glGetColorTableParameteriv = layers&(EMU_ROUTE_PPA) ? emu_glGetColorTableParameteriv : NULL;
+  tbl.glGetConvolutionParameterfv = layers&(EMU_ROUTE_PPA) ? emu_glGetConvolutionParameterfv : NULL;
+  tbl.glGetConvolutionParameteriv = layers&(EMU_ROUTE_PPA) ? emu_glGetConvolutionParameteriv : NULL;
+
+  // GL_ARB_map_buffer_range
+
+  tbl.glFlushMappedBufferRange = layers&(EMU_ROUTE_DSA|EMU_ROUTE_VAO) ? emu_glFlushMappedBufferRange : NULL;
+  tbl.glMapBufferRange = layers&(EMU_ROUTE_DSA|EMU_ROUTE_VAO) ? emu_glMapBufferRange : NULL;
+
+  // GL_ARB_multi_bind
+
+  tbl.glBindVertexBuffers = layers&(EMU_ROUTE_PPCA) ? emu_glBindVertexBuffers : NULL;
+
+  // GL_ARB_multi_draw_indirect
+
+  tbl.glMultiDrawArraysIndirect = layers&(EMU_ROUTE_IFF|EMU_ROUTE_SO|EMU_ROUTE_DSA) ? emu_glMultiDrawArraysIndirect : NULL;
+  tbl.glMultiDrawElementsIndirect = layers&(EMU_ROUTE_IFF|EMU_ROUTE_SO|EMU_ROUTE_DSA) ? emu_glMultiDrawElementsIndirect : NULL;
+
+  // GL_ARB_multisample
+
+  tbl.glSampleCoverageARB = layers&(EMU_ROUTE_IFF) ? emu_glSampleCoverageARB : NULL;
+
+  // GL_ARB_multitexture
+
+  tbl.glActiveTextureARB = layers&(EMU_ROUTE_PPA|EMU_ROUTE_XFER|EMU_ROUTE_IFF|EMU_ROUTE_SO|EMU_ROUTE_DSA|EMU_ROUTE_TEXC|EMU_ROUTE_FILT) ? emu_glActiveTextureARB : NULL;
+  tbl.glClientActiveTextureARB = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV|EMU_ROUTE_IFF|EMU_ROUTE_DSA|EMU_ROUTE_VAO|EMU_ROUTE_FILT) ? emu_glClientActiveTextureARB : NULL;
+  tbl.glMultiTexCoord1dARB = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord1dARB : NULL;
+  tbl.glMultiTexCoord1dvARB = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord1dvARB : NULL;
+  tbl.glMultiTexCoord1fARB = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord1fARB : NULL;
+  tbl.glMultiTexCoord1fvARB = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord1fvARB : NULL;
+  tbl.glMultiTexCoord1iARB = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord1iARB : NULL;
+  tbl.glMultiTexCoord1ivARB = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord1ivARB : NULL;
+  tbl.glMultiTexCoord1sARB = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord1sARB : NULL;
+  tbl.glMultiTexCoord1svARB = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord1svARB : NULL;
+  tbl.glMultiTexCoord2dARB = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord2dARB : NULL;
+  tbl.glMultiTexCoord2dvARB = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord2dvARB : NULL;
+  tbl.glMultiTexCoord2fARB = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord2fARB : NULL;
+  tbl.glMultiTexCoord2fvARB = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord2fvARB : NULL;
+  tbl.glMultiTexCoord2iARB = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord2iARB : NULL;
+  tbl.glMultiTexCoord2ivARB = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord2ivARB : NULL;
+  tbl.glMultiTexCoord2sARB = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord2sARB : NULL;
+  tbl.glMultiTexCoord2svARB = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord2svARB : NULL;
+  tbl.glMultiTexCoord3dARB = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord3dARB : NULL;
+  tbl.glMultiTexCoord3dvARB = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord3dvARB : NULL;
+  tbl.glMultiTexCoord3fARB = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord3fARB : NULL;
+  tbl.glMultiTexCoord3fvARB = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord3fvARB : NULL;
+  tbl.glMultiTexCoord3iARB = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord3iARB : NULL;
+  tbl.glMultiTexCoord3ivARB = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord3ivARB : NULL;
+  tbl.glMultiTexCoord3sARB = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord3sARB : NULL;
+  tbl.glMultiTexCoord3svARB = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord3svARB : NULL;
+  tbl.glMultiTexCoord4dARB = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord4dARB : NULL;
+  tbl.glMultiTexCoord4dvARB = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord4dvARB : NULL;
+  tbl.glMultiTexCoord4fARB = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord4fARB : NULL;
+  tbl.glMultiTexCoord4fvARB = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord4fvARB : NULL;
+  tbl.glMultiTexCoord4iARB = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord4iARB : NULL;
+  tbl.glMultiTexCoord4ivARB = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord4ivARB : NULL;
+  tbl.glMultiTexCoord4sARB = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord4sARB : NULL;
+  tbl.glMultiTexCoord4svARB = layers&(EMU_ROUTE_IFF) ? emu_glMultiTexCoord4svARB : NULL;
+
+  // GL_ARB_occlusion_query
+
+  tbl.glBeginQueryARB = layers&(EMU_ROUTE_IFF) ? emu_glBeginQueryARB : NULL;
+  tbl.glEndQueryARB = layers&(EMU_ROUTE_IFF) ? emu_glEndQueryARB : NULL;
+  tbl.glGetQueryObjectivARB = layers&(EMU_ROUTE_IFF|EMU_ROUTE_VAO) ? emu_glGetQueryObjectivARB : NULL;
+  tbl.glGetQueryObjectuivARB = layers&(EMU_ROUTE_IFF|EMU_ROUTE_VAO) ? emu_glGetQueryObjectuivARB : NULL;
+
+  // GL_ARB_provoking_vertex
+
+  tbl.glProvokingVertex = layers&(EMU_ROUTE_PPA|EMU_ROUTE_QUADS) ? emu_glProvokingVertex : NULL;
+
+  // GL_ARB_robustness
+
+  tbl.glGetnCompressedTexImageARB = layers&(EMU_ROUTE_VAO) ? emu_glGetnCompressedTexImageARB : NULL;
+  tbl.glGetnTexImageARB = layers&(EMU_ROUTE_VAO) ? emu_glGetnTexImageARB : NULL;
+  tbl.glReadnPixelsARB = layers&(EMU_ROUTE_VAO) ? emu_glReadnPixelsARB : NULL;
+
+  // GL_ARB_sampler_objects
+
+  tbl.glBindSampler = layers&(EMU_ROUTE_IFF|EMU_ROUTE_SO) ? emu_glBindSampler : NULL;
+  tbl.glDeleteSamplers = layers&(EMU_ROUTE_SO) ? emu_glDeleteSamplers : NULL;
+  tbl.glGenSamplers = layers&(EMU_ROUTE_SO|EMU_ROUTE_FILT) ? emu_glGenSamplers : NULL;
+  tbl.glGetSamplerParameterIiv = layers&(EMU_ROUTE_SO) ? emu_glGetSamplerParameterIiv : NULL;
+  tbl.glGetSamplerParameterIuiv = layers&(EMU_ROUTE_SO) ? emu_glGetSamplerParameterIuiv : NULL;
+  tbl.glGetSamplerParameterfv = layers&(EMU_ROUTE_SO) ? emu_glGetSamplerParameterfv : NULL;
+  tbl.glGetSamplerParameteriv = layers&(EMU_ROUTE_SO) ? emu_glGetSamplerParameteriv : NULL;
+  tbl.glIsSampler = layers&(EMU_ROUTE_SO) ? emu_glIsSampler : NULL;
+  tbl.glSamplerParameterIiv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_SO) ? emu_glSamplerParameterIiv : NULL;
+  tbl.glSamplerParameterIuiv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_SO) ? emu_glSamplerParameterIuiv : NULL;
+  tbl.glSamplerParameterf = layers&(EMU_ROUTE_IFF|EMU_ROUTE_SO) ? emu_glSamplerParameterf : NULL;
+  tbl.glSamplerParameterfv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_SO) ? emu_glSamplerParameterfv : NULL;
+  tbl.glSamplerParameteri = layers&(EMU_ROUTE_IFF|EMU_ROUTE_SO) ? emu_glSamplerParameteri : NULL;
+  tbl.glSamplerParameteriv = layers&(EMU_ROUTE_IFF|EMU_ROUTE_SO) ? emu_glSamplerParameteriv : NULL;
+
+  // GL_ARB_separate_shader_objects
+
+  tbl.glBindProgramPipeline = layers&(EMU_ROUTE_IFF) ? emu_glBindProgramPipeline : NULL;
+
+  // GL_ARB_shader_image_load_store
+
+  tbl.glMemoryBarrier = layers&(EMU_ROUTE_IFF|EMU_ROUTE_VAO) ? emu_glMemoryBarrier : NULL;
+
+  // GL_ARB_shader_objects
+
+  tbl.glAttachObjectARB = layers&(EMU_ROUTE_FILT) ? emu_glAttachObjectARB : NULL;
+  tbl.glCompileShaderARB = layers&(EMU_ROUTE_FILT) ? emu_glCompileShaderARB : NULL;
+  tbl.glCreateProgramObjectARB = layers&(EMU_ROUTE_FILT) ? emu_glCreateProgramObjectARB : NULL;
+  tbl.glCreateShaderObjectARB = layers&(EMU_ROUTE_IFF) ? emu_glCreateShaderObjectARB : NULL;
+  tbl.glGetInfoLogARB = layers&(EMU_ROUTE_FILT) ? emu_glGetInfoLogARB : NULL;
+  tbl.glGetObjectParameterivARB = layers&(EMU_ROUTE_FILT) ? emu_glGetObjectParameterivARB : NULL;
+  tbl.glGetUniformLocationARB = layers&(EMU_ROUTE_FILT) ? emu_glGetUniformLocationARB : NULL;
+  tbl.glLinkProgramARB = layers&(EMU_ROUTE_IFF) ? emu_glLinkProgramARB : NULL;
+  tbl.glShaderSourceARB = layers&(EMU_ROUTE_IFF) ? emu_glShaderSourceARB : NULL;
+  tbl.glUniform1fARB = layers&(EMU_ROUTE_IFF) ? emu_glUniform1fARB : NULL;
+  tbl.glUniform1fvARB = layers&(EMU_ROUTE_IFF) ? emu_glUniform1fvARB : NULL;
+  tbl.glUniform1iARB = layers&(EMU_ROUTE_IFF|EMU_ROUTE_FILT) ? emu_glUniform1iARB : NULL;
+  tbl.glUniform1ivARB = layers&(EMU_ROUTE_IFF) ? emu_glUniform1ivARB : NULL;
+  tbl.glUniform2fARB = layers&(EMU_ROUTE_IFF) ? emu_glUniform2fARB : NULL;
+  tbl.glUniform2fvARB = layers&(EMU_ROUTE_IFF) ? emu_glUniform2fvARB : NULL;
+  tbl.glUniform2iARB = layers&(EMU_ROUTE_IFF) ? emu_glUniform2iARB : NULL;
+  tbl.glUniform2ivARB = layers&(EMU_ROUTE_IFF) ? emu_glUniform2ivARB : NULL;
+  tbl.glUniform3fARB = layers&(EMU_ROUTE_IFF) ? emu_glUniform3fARB : NULL;
+  tbl.glUniform3fvARB = layers&(EMU_ROUTE_IFF) ? emu_glUniform3fvARB : NULL;
+  tbl.glUniform3iARB = layers&(EMU_ROUTE_IFF) ? emu_glUniform3iARB : NULL;
+  tbl.glUniform3ivARB = layers&(EMU_ROUTE_IFF) ? emu_glUniform3ivARB : NULL;
+  tbl.glUniform4fARB = layers&(EMU_ROUTE_IFF) ? emu_glUniform4fARB : NULL;
+  tbl.glUniform4fvARB = layers&(EMU_ROUTE_IFF) ? emu_glUniform4fvARB : NULL;
+  tbl.glUniform4iARB = layers&(EMU_ROUTE_IFF) ? emu_glUniform4iARB : NULL;
+  tbl.glUniform4ivARB = layers&(EMU_ROUTE_IFF) ? emu_glUniform4ivARB : NULL;
+  tbl.glUniformMatrix2fvARB = layers&(EMU_ROUTE_IFF) ? emu_glUniformMatrix2fvARB : NULL;
+  tbl.glUniformMatrix3fvARB = layers&(EMU_ROUTE_IFF) ? emu_glUniformMatrix3fvARB : NULL;
+  tbl.glUniformMatrix4fvARB = layers&(EMU_ROUTE_IFF) ? emu_glUniformMatrix4fvARB : NULL;
+  tbl.glUseProgramObjectARB = layers&(EMU_ROUTE_IFF) ? emu_glUseProgramObjectARB : NULL;
+
+  // GL_ARB_sync
+
+  tbl.glClientWaitSync = layers&(EMU_ROUTE_IFF) ? emu_glClientWaitSync : NULL;
+  tbl.glFenceSync = layers&(EMU_ROUTE_IFF) ? emu_glFenceSync : NULL;
+  tbl.glGetInteger64v = layers&(EMU_ROUTE_SO|EMU_ROUTE_VAO|EMU_ROUTE_FILT) ? emu_glGetInteger64v : NULL;
+  tbl.glWaitSync = layers&(EMU_ROUTE_IFF) ? emu_glWaitSync : NULL;
+
+  // GL_ARB_texture_compression
+
+  tbl.glCompressedTexImage1DARB = layers&(EMU_ROUTE_IFF) ? emu_glCompressedTexImage1DARB : NULL;
+  tbl.glCompressedTexImage2DARB = layers&(EMU_ROUTE_XFER|EMU_ROUTE_IFF) ? emu_glCompressedTexImage2DARB : NULL;
+  tbl.glCompressedTexImage3DARB = layers&(EMU_ROUTE_IFF) ? emu_glCompressedTexImage3DARB : NULL;
+  tbl.glCompressedTexSubImage1DARB = layers&(EMU_ROUTE_IFF) ? emu_glCompressedTexSubImage1DARB : NULL;
+  tbl.glCompressedTexSubImage2DARB = layers&(EMU_ROUTE_XFER|EMU_ROUTE_IFF) ? emu_glCompressedTexSubImage2DARB : NULL;
+  tbl.glCompressedTexSubImage3DARB = layers&(EMU_ROUTE_IFF) ? emu_glCompressedTexSubImage3DARB : NULL;
+  tbl.glGetCompressedTexImageARB = layers&(EMU_ROUTE_IFF|EMU_ROUTE_VAO) ? emu_glGetCompressedTexImageARB : NULL;
+
+  // GL_ARB_texture_multisample
+
+  tbl.glTexImage2DMultisample = layers&(EMU_ROUTE_IFF) ? emu_glTexImage2DMultisample : NULL;
+  tbl.glTexImage3DMultisample = layers&(EMU_ROUTE_IFF) ? emu_glTexImage3DMultisample : NULL;
+
+  // GL_ARB_texture_storage
+
+  tbl.glTexStorage1D = layers&(EMU_ROUTE_TEXSTO|EMU_ROUTE_IFF) ? emu_glTexStorage1D : NULL;
+  tbl.glTexStorage2D = layers&(EMU_ROUTE_TEXSTO|EMU_ROUTE_IFF) ? emu_glTexStorage2D : NULL;
+  tbl.glTexStorage3D = layers&(EMU_ROUTE_TEXSTO|EMU_ROUTE_IFF) ? emu_glTexStorage3D : NULL;
+  tbl.glTextureStorage1DEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glTextureStorage1DEXT : NULL;
+  tbl.glTextureStorage2DEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glTextureStorage2DEXT : NULL;
+  tbl.glTextureStorage3DEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glTextureStorage3DEXT : NULL;
+
+  // GL_ARB_texture_storage_multisample
+
+  tbl.glTexStorage2DMultisample = layers&(EMU_ROUTE_IFF) ? emu_glTexStorage2DMultisample : NULL;
+  tbl.glTexStorage3DMultisample = layers&(EMU_ROUTE_IFF) ? emu_glTexStorage3DMultisample : NULL;
+  tbl.glTextureStorage2DMultisampleEXT = layers&(EMU_ROUTE_IFF) ? emu_glTextureStorage2DMultisampleEXT : NULL;
+  tbl.glTextureStorage3DMultisampleEXT = layers&(EMU_ROUTE_IFF) ? emu_glTextureStorage3DMultisampleEXT : NULL;
+
+  // GL_ARB_timer_query
+
+  tbl.glGetQueryObjecti64v = layers&(EMU_ROUTE_IFF|EMU_ROUTE_VAO) ? emu_glGetQueryObjecti64v : NULL;
+  tbl.glGetQueryObjectui64v = layers&(EMU_ROUTE_IFF|EMU_ROUTE_VAO) ? emu_glGetQueryObjectui64v : NULL;
+  tbl.glQueryCounter = layers&(EMU_ROUTE_IFF) ? emu_glQueryCounter : NULL;
+
+  // GL_ARB_transform_feedback2
+
+  tbl.glPauseTransformFeedback = layers&(EMU_ROUTE_VAO) ? emu_glPauseTransformFeedback : NULL;
+  tbl.glResumeTransformFeedback = layers&(EMU_ROUTE_VAO) ? emu_glResumeTransformFeedback : NULL;
+
+  // GL_ARB_transpose_matrix
+
+  tbl.glLoadTransposeMatrixdARB = layers&(EMU_ROUTE_IFF) ? emu_glLoadTransposeMatrixdARB : NULL;
+  tbl.glLoadTransposeMatrixfARB = layers&(EMU_ROUTE_IFF) ? emu_glLoadTransposeMatrixfARB : NULL;
+  tbl.glMultTransposeMatrixdARB = layers&(EMU_ROUTE_IFF) ? emu_glMultTransposeMatrixdARB : NULL;
+  tbl.glMultTransposeMatrixfARB = layers&(EMU_ROUTE_IFF) ? emu_glMultTransposeMatrixfARB : NULL;
+
+  // GL_ARB_uniform_buffer_object
+
+  tbl.glBindBufferBase = layers&(EMU_ROUTE_IFF) ? emu_glBindBufferBase : NULL;
+  tbl.glBindBufferRange = layers&(EMU_ROUTE_IFF) ? emu_glBindBufferRange : NULL;
+  tbl.glGetIntegeri_v = layers&(EMU_ROUTE_PPA) ? emu_glGetIntegeri_v : NULL;
+
+  // GL_ARB_vertex_array_object
+
+  tbl.glBindVertexArray = layers&(EMU_ROUTE_OBJ|EMU_ROUTE_PPCA|EMU_ROUTE_BV|EMU_ROUTE_IFF|EMU_ROUTE_DSA|EMU_ROUTE_VAO) ? emu_glBindVertexArray : NULL;
+  tbl.glDeleteVertexArrays = layers&(EMU_ROUTE_OBJ|EMU_ROUTE_PPCA|EMU_ROUTE_IFF|EMU_ROUTE_DSA|EMU_ROUTE_VAO) ? emu_glDeleteVertexArrays : NULL;
+  tbl.glGenVertexArrays = layers&(EMU_ROUTE_OBJ|EMU_ROUTE_VAO) ? emu_glGenVertexArrays : NULL;
+  tbl.glIsVertexArray = layers&(EMU_ROUTE_OBJ|EMU_ROUTE_IFF|EMU_ROUTE_VAO) ? emu_glIsVertexArray : NULL;
+
+  // GL_ARB_vertex_attrib_64bit
+
+  tbl.glVertexAttribLPointer = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV) ? emu_glVertexAttribLPointer : NULL;
+
+  // GL_ARB_vertex_attrib_binding
+
+  tbl.glBindVertexBuffer = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV) ? emu_glBindVertexBuffer : NULL;
+  tbl.glVertexAttribBinding = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV) ? emu_glVertexAttribBinding : NULL;
+  tbl.glVertexAttribFormat = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV) ? emu_glVertexAttribFormat : NULL;
+  tbl.glVertexAttribIFormat = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV) ? emu_glVertexAttribIFormat : NULL;
+  tbl.glVertexAttribLFormat = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV) ? emu_glVertexAttribLFormat : NULL;
+  tbl.glVertexBindingDivisor = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV) ? emu_glVertexBindingDivisor : NULL;
+
+  // GL_ARB_vertex_buffer_object
+
+  tbl.glBindBufferARB = layers&(EMU_ROUTE_OBJ|EMU_ROUTE_IFF|EMU_ROUTE_DSA|EMU_ROUTE_VAO) ? emu_glBindBufferARB : NULL;
+  tbl.glBufferDataARB = layers&(EMU_ROUTE_VAO|EMU_ROUTE_FILT) ? emu_glBufferDataARB : NULL;
+  tbl.glBufferSubDataARB = layers&(EMU_ROUTE_VAO) ? emu_glBufferSubDataARB : NULL;
+  tbl.glDeleteBuffersARB = layers&(EMU_ROUTE_OBJ|EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glDeleteBuffersARB : NULL;
+  tbl.glGenBuffersARB = layers&(EMU_ROUTE_OBJ) ? emu_glGenBuffersARB : NULL;
+  tbl.glIsBufferARB = layers&(EMU_ROUTE_OBJ) ? emu_glIsBufferARB : NULL;
+  tbl.glMapBufferARB = layers&(EMU_ROUTE_DSA|EMU_ROUTE_VAO|EMU_ROUTE_FILT) ? emu_glMapBufferARB : NULL;
+  tbl.glUnmapBufferARB = layers&(EMU_ROUTE_DSA|EMU_ROUTE_VAO|EMU_ROUTE_FILT) ? emu_glUnmapBufferARB : NULL;
+
+  // GL_ARB_vertex_program
+
+  tbl.glBindProgramARB = layers&(EMU_ROUTE_DSA|EMU_ROUTE_FILT) ? emu_glBindProgramARB : NULL;
+  tbl.glDeleteProgramsARB = layers&(EMU_ROUTE_DSA) ? emu_glDeleteProgramsARB : NULL;
+  tbl.glDisableVertexAttribArrayARB = layers&(EMU_ROUTE_IFF|EMU_ROUTE_VAO) ? emu_glDisableVertexAttribArrayARB : NULL;
+  tbl.glEnableVertexAttribArrayARB = layers&(EMU_ROUTE_IFF|EMU_ROUTE_VAO) ? emu_glEnableVertexAttribArrayARB : NULL;
+  tbl.glGenProgramsARB = layers&(EMU_ROUTE_FILT) ? emu_glGenProgramsARB : NULL;
+  tbl.glGetProgramEnvParameterdvARB = layers&(EMU_ROUTE_DSA) ? emu_glGetProgramEnvParameterdvARB : NULL;
+  tbl.glGetProgramEnvParameterfvARB = layers&(EMU_ROUTE_DSA) ? emu_glGetProgramEnvParameterfvARB : NULL;
+  tbl.glGetProgramLocalParameterdvARB = layers&(EMU_ROUTE_DSA) ? emu_glGetProgramLocalParameterdvARB : NULL;
+  tbl.glGetProgramLocalParameterfvARB = layers&(EMU_ROUTE_DSA) ? emu_glGetProgramLocalParameterfvARB : NULL;
+  tbl.glGetProgramivARB = layers&(EMU_ROUTE_FILT) ? emu_glGetProgramivARB : NULL;
+  tbl.glGetVertexAttribPointervARB = layers&(EMU_ROUTE_IFF|EMU_ROUTE_VAO) ? emu_glGetVertexAttribPointervARB : NULL;
+  tbl.glGetVertexAttribdvARB = layers&(EMU_ROUTE_IFF|EMU_ROUTE_VAO) ? emu_glGetVertexAttribdvARB : NULL;
+  tbl.glGetVertexAttribfvARB = layers&(EMU_ROUTE_IFF|EMU_ROUTE_VAO) ? emu_glGetVertexAttribfvARB : NULL;
+  tbl.glGetVertexAttribivARB = layers&(EMU_ROUTE_IFF|EMU_ROUTE_VAO) ? emu_glGetVertexAttribivARB : NULL;
+  tbl.glProgramEnvParameter4dARB = layers&(EMU_ROUTE_DSA) ? emu_glProgramEnvParameter4dARB : NULL;
+  tbl.glProgramEnvParameter4dvARB = layers&(EMU_ROUTE_DSA) ? emu_glProgramEnvParameter4dvARB : NULL;
+  tbl.glProgramEnvParameter4fARB = layers&(EMU_ROUTE_DSA) ? emu_glProgramEnvParameter4fARB : NULL;
+  tbl.glProgramEnvParameter4fvARB = layers&(EMU_ROUTE_DSA) ? emu_glProgramEnvParameter4fvARB : NULL;
+  tbl.glProgramLocalParameter4dARB = layers&(EMU_ROUTE_DSA) ? emu_glProgramLocalParameter4dARB : NULL;
+  tbl.glProgramLocalParameter4dvARB = layers&(EMU_ROUTE_DSA) ? emu_glProgramLocalParameter4dvARB : NULL;
+  tbl.glProgramLocalParameter4fARB = layers&(EMU_ROUTE_DSA) ? emu_glProgramLocalParameter4fARB : NULL;
+  tbl.glProgramLocalParameter4fvARB = layers&(EMU_ROUTE_DSA) ? emu_glProgramLocalParameter4fvARB : NULL;
+  tbl.glProgramStringARB = layers&(EMU_ROUTE_FILT) ? emu_glProgramStringARB : NULL;
+  tbl.glVertexAttrib1dARB = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib1dARB : NULL;
+  tbl.glVertexAttrib1dvARB = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib1dvARB : NULL;
+  tbl.glVertexAttrib1fARB = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib1fARB : NULL;
+  tbl.glVertexAttrib1fvARB = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib1fvARB : NULL;
+  tbl.glVertexAttrib1sARB = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib1sARB : NULL;
+  tbl.glVertexAttrib1svARB = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib1svARB : NULL;
+  tbl.glVertexAttrib2dARB = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib2dARB : NULL;
+  tbl.glVertexAttrib2dvARB = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib2dvARB : NULL;
+  tbl.glVertexAttrib2fARB = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib2fARB : NULL;
+  tbl.glVertexAttrib2fvARB = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib2fvARB : NULL;
+  tbl.glVertexAttrib2sARB = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib2sARB : NULL;
+  tbl.glVertexAttrib2svARB = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib2svARB : NULL;
+  tbl.glVertexAttrib3dARB = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib3dARB : NULL;
+  tbl.glVertexAttrib3dvARB = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib3dvARB : NULL;
+  tbl.glVertexAttrib3fARB = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib3fARB : NULL;
+  tbl.glVertexAttrib3fvARB = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib3fvARB : NULL;
+  tbl.glVertexAttrib3sARB = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib3sARB : NULL;
+  tbl.glVertexAttrib3svARB = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib3svARB : NULL;
+  tbl.glVertexAttrib4NbvARB = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib4NbvARB : NULL;
+  tbl.glVertexAttrib4NivARB = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib4NivARB : NULL;
+  tbl.glVertexAttrib4NsvARB = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib4NsvARB : NULL;
+  tbl.glVertexAttrib4NubARB = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib4NubARB : NULL;
+  tbl.glVertexAttrib4NubvARB = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib4NubvARB : NULL;
+  tbl.glVertexAttrib4NusvARB = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib4NusvARB : NULL;
+  tbl.glVertexAttrib4bvARB = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib4bvARB : NULL;
+  tbl.glVertexAttrib4dARB = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib4dARB : NULL;
+  tbl.glVertexAttrib4dvARB = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib4dvARB : NULL;
+  tbl.glVertexAttrib4fARB = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib4fARB : NULL;
+  tbl.glVertexAttrib4fvARB = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib4fvARB : NULL;
+  tbl.glVertexAttrib4ivARB = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib4ivARB : NULL;
+  tbl.glVertexAttrib4sARB = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib4sARB : NULL;
+  tbl.glVertexAttrib4svARB = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib4svARB : NULL;
+  tbl.glVertexAttrib4ubvARB = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib4ubvARB : NULL;
+  tbl.glVertexAttrib4usvARB = layers&(EMU_ROUTE_IFF) ? emu_glVertexAttrib4usvARB : NULL;
+  tbl.glVertexAttribPointerARB = layers&(EMU_ROUTE_IFF|EMU_ROUTE_VAO) ? emu_glVertexAttribPointerARB : NULL;
+
+  // GL_ARB_vertex_shader
+
+  tbl.glBindAttribLocationARB = layers&(EMU_ROUTE_FILT) ? emu_glBindAttribLocationARB : NULL;
+
+  // GL_ARB_viewport_array
+
+  tbl.glDepthRangeArrayv = layers&(EMU_ROUTE_PPA) ? emu_glDepthRangeArrayv : NULL;
+  tbl.glDepthRangeIndexed = layers&(EMU_ROUTE_PPA) ? emu_glDepthRangeIndexed : NULL;
+  tbl.glGetDoublei_v = layers&(EMU_ROUTE_PPA|EMU_ROUTE_DSA) ? emu_glGetDoublei_v : NULL;
+  tbl.glGetFloati_v = layers&(EMU_ROUTE_PPA|EMU_ROUTE_DSA) ? emu_glGetFloati_v : NULL;
+  tbl.glScissorArrayv = layers&(EMU_ROUTE_PPA) ? emu_glScissorArrayv : NULL;
+  tbl.glScissorIndexed = layers&(EMU_ROUTE_PPA) ? emu_glScissorIndexed : NULL;
+  tbl.glScissorIndexedv = layers&(EMU_ROUTE_PPA) ? emu_glScissorIndexedv : NULL;
+  tbl.glViewportArrayv = layers&(EMU_ROUTE_PPA) ? emu_glViewportArrayv : NULL;
+  tbl.glViewportIndexedf = layers&(EMU_ROUTE_PPA) ? emu_glViewportIndexedf : NULL;
+  tbl.glViewportIndexedfv = layers&(EMU_ROUTE_PPA) ? emu_glViewportIndexedfv : NULL;
+
+  // GL_ATI_draw_buffers
+
+  tbl.glDrawBuffersATI = layers&(EMU_ROUTE_FILT) ? emu_glDrawBuffersATI : NULL;
+
+  // GL_ATI_element_array
+
+  tbl.glDrawElementArrayATI = layers&(EMU_ROUTE_IFF|EMU_ROUTE_SO|EMU_ROUTE_DSA) ? emu_glDrawElementArrayATI : NULL;
+  tbl.glDrawRangeElementArrayATI = layers&(EMU_ROUTE_IFF|EMU_ROUTE_SO) ? emu_glDrawRangeElementArrayATI : NULL;
+
+  // GL_EXT_blend_color
+
+  tbl.glBlendColorEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_FILT) ? emu_glBlendColorEXT : NULL;
+
+  // GL_EXT_blend_equation_separate
+
+  tbl.glBlendEquationSeparateEXT = layers&(EMU_ROUTE_IFF) ? emu_glBlendEquationSeparateEXT : NULL;
+
+  // GL_EXT_blend_func_separate
+
+  tbl.glBlendFuncSeparateEXT = layers&(EMU_ROUTE_IFF) ? emu_glBlendFuncSeparateEXT : NULL;
+
+  // GL_EXT_blend_minmax
+
+  tbl.glBlendEquationEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_FILT) ? emu_glBlendEquationEXT : NULL;
+
+  // GL_EXT_copy_texture
+
+  tbl.glCopyTexImage1DEXT = layers&(EMU_ROUTE_IFF) ? emu_glCopyTexImage1DEXT : NULL;
+  tbl.glCopyTexImage2DEXT = layers&(EMU_ROUTE_IFF) ? emu_glCopyTexImage2DEXT : NULL;
+
+  // GL_EXT_direct_state_access
+
+  tbl.glBindMultiTextureEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glBindMultiTextureEXT : NULL;
+  tbl.glCheckNamedFramebufferStatusEXT = layers&(EMU_ROUTE_DSA) ? emu_glCheckNamedFramebufferStatusEXT : NULL;
+  tbl.glClientAttribDefaultEXT = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_DSA) ? emu_glClientAttribDefaultEXT : NULL;
+  tbl.glCompressedMultiTexImage1DEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glCompressedMultiTexImage1DEXT : NULL;
+  tbl.glCompressedMultiTexImage2DEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glCompressedMultiTexImage2DEXT : NULL;
+  tbl.glCompressedMultiTexImage3DEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glCompressedMultiTexImage3DEXT : NULL;
+  tbl.glCompressedMultiTexSubImage1DEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glCompressedMultiTexSubImage1DEXT : NULL;
+  tbl.glCompressedMultiTexSubImage2DEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glCompressedMultiTexSubImage2DEXT : NULL;
+  tbl.glCompressedMultiTexSubImage3DEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glCompressedMultiTexSubImage3DEXT : NULL;
+  tbl.glCompressedTextureImage1DEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glCompressedTextureImage1DEXT : NULL;
+  tbl.glCompressedTextureImage2DEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glCompressedTextureImage2DEXT : NULL;
+  tbl.glCompressedTextureImage3DEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glCompressedTextureImage3DEXT : NULL;
+  tbl.glCompressedTextureSubImage1DEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glCompressedTextureSubImage1DEXT : NULL;
+  tbl.glCompressedTextureSubImage2DEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glCompressedTextureSubImage2DEXT : NULL;
+  tbl.glCompressedTextureSubImage3DEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glCompressedTextureSubImage3DEXT : NULL;
+  tbl.glCopyMultiTexImage1DEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glCopyMultiTexImage1DEXT : NULL;
+  tbl.glCopyMultiTexImage2DEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glCopyMultiTexImage2DEXT : NULL;
+  tbl.glCopyMultiTexSubImage1DEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glCopyMultiTexSubImage1DEXT : NULL;
+  tbl.glCopyMultiTexSubImage2DEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glCopyMultiTexSubImage2DEXT : NULL;
+  tbl.glCopyMultiTexSubImage3DEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glCopyMultiTexSubImage3DEXT : NULL;
+  tbl.glCopyTextureImage1DEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glCopyTextureImage1DEXT : NULL;
+  tbl.glCopyTextureImage2DEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glCopyTextureImage2DEXT : NULL;
+  tbl.glCopyTextureSubImage1DEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glCopyTextureSubImage1DEXT : NULL;
+  tbl.glCopyTextureSubImage2DEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glCopyTextureSubImage2DEXT : NULL;
+  tbl.glCopyTextureSubImage3DEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glCopyTextureSubImage3DEXT : NULL;
+  tbl.glDisableClientStateIndexedEXT = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV|EMU_ROUTE_DSA) ? emu_glDisableClientStateIndexedEXT : NULL;
+  tbl.glDisableClientStateiEXT = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV|EMU_ROUTE_DSA) ? emu_glDisableClientStateiEXT : NULL;
+  tbl.glDisableVertexArrayAttribEXT = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV|EMU_ROUTE_DSA) ? emu_glDisableVertexArrayAttribEXT : NULL;
+  tbl.glDisableVertexArrayEXT = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV|EMU_ROUTE_DSA) ? emu_glDisableVertexArrayEXT : NULL;
+  tbl.glEnableClientStateIndexedEXT = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV|EMU_ROUTE_DSA) ? emu_glEnableClientStateIndexedEXT : NULL;
+  tbl.glEnableClientStateiEXT = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV|EMU_ROUTE_DSA) ? emu_glEnableClientStateiEXT : NULL;
+  tbl.glEnableVertexArrayAttribEXT = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV|EMU_ROUTE_DSA) ? emu_glEnableVertexArrayAttribEXT : NULL;
+  tbl.glEnableVertexArrayEXT = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV|EMU_ROUTE_DSA) ? emu_glEnableVertexArrayEXT : NULL;
+  tbl.glFlushMappedNamedBufferRangeEXT = layers&(EMU_ROUTE_DSA|EMU_ROUTE_VAO) ? emu_glFlushMappedNamedBufferRangeEXT : NULL;
+  tbl.glFramebufferDrawBufferEXT = layers&(EMU_ROUTE_DSA) ? emu_glFramebufferDrawBufferEXT : NULL;
+  tbl.glFramebufferDrawBuffersEXT = layers&(EMU_ROUTE_DSA) ? emu_glFramebufferDrawBuffersEXT : NULL;
+  tbl.glFramebufferReadBufferEXT = layers&(EMU_ROUTE_DSA) ? emu_glFramebufferReadBufferEXT : NULL;
+  tbl.glGenerateMultiTexMipmapEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glGenerateMultiTexMipmapEXT : NULL;
+  tbl.glGenerateTextureMipmapEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glGenerateTextureMipmapEXT : NULL;
+  tbl.glGetCompressedMultiTexImageEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA|EMU_ROUTE_VAO) ? emu_glGetCompressedMultiTexImageEXT : NULL;
+  tbl.glGetCompressedTextureImageEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA|EMU_ROUTE_VAO) ? emu_glGetCompressedTextureImageEXT : NULL;
+  tbl.glGetDoubleIndexedvEXT = layers&(EMU_ROUTE_DSA) ? emu_glGetDoubleIndexedvEXT : NULL;
+  tbl.glGetDoublei_vEXT = layers&(EMU_ROUTE_PPA|EMU_ROUTE_DSA) ? emu_glGetDoublei_vEXT : NULL;
+  tbl.glGetFloatIndexedvEXT = layers&(EMU_ROUTE_DSA) ? emu_glGetFloatIndexedvEXT : NULL;
+  tbl.glGetFloati_vEXT = layers&(EMU_ROUTE_PPA|EMU_ROUTE_DSA) ? emu_glGetFloati_vEXT : NULL;
+  tbl.glGetFramebufferParameterivEXT = layers&(EMU_ROUTE_DSA) ? emu_glGetFramebufferParameterivEXT : NULL;
+  tbl.glGetMultiTexEnvfvEXT = layers&(EMU_ROUTE_PPA|EMU_ROUTE_DSA) ? emu_glGetMultiTexEnvfvEXT : NULL;
+  tbl.glGetMultiTexEnvivEXT = layers&(EMU_ROUTE_PPA|EMU_ROUTE_DSA) ? emu_glGetMultiTexEnvivEXT : NULL;
+  tbl.glGetMultiTexGendvEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glGetMultiTexGendvEXT : NULL;
+  tbl.glGetMultiTexGenfvEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glGetMultiTexGenfvEXT : NULL;
+  tbl.glGetMultiTexGenivEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glGetMultiTexGenivEXT : NULL;
+  tbl.glGetMultiTexImageEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA|EMU_ROUTE_VAO) ? emu_glGetMultiTexImageEXT : NULL;
+  tbl.glGetMultiTexLevelParameterfvEXT = layers&(EMU_ROUTE_DSA) ? emu_glGetMultiTexLevelParameterfvEXT : NULL;
+  tbl.glGetMultiTexLevelParameterivEXT = layers&(EMU_ROUTE_DSA) ? emu_glGetMultiTexLevelParameterivEXT : NULL;
+  tbl.glGetMultiTexParameterIivEXT = layers&(EMU_ROUTE_DSA) ? emu_glGetMultiTexParameterIivEXT : NULL;
+  tbl.glGetMultiTexParameterIuivEXT = layers&(EMU_ROUTE_DSA) ? emu_glGetMultiTexParameterIuivEXT : NULL;
+  tbl.glGetMultiTexParameterfvEXT = layers&(EMU_ROUTE_DSA) ? emu_glGetMultiTexParameterfvEXT : NULL;
+  tbl.glGetMultiTexParameterivEXT = layers&(EMU_ROUTE_DSA) ? emu_glGetMultiTexParameterivEXT : NULL;
+  tbl.glGetNamedBufferParameterivEXT = layers&(EMU_ROUTE_DSA) ? emu_glGetNamedBufferParameterivEXT : NULL;
+  tbl.glGetNamedBufferPointervEXT = layers&(EMU_ROUTE_DSA) ? emu_glGetNamedBufferPointervEXT : NULL;
+  tbl.glGetNamedBufferSubDataEXT = layers&(EMU_ROUTE_DSA) ? emu_glGetNamedBufferSubDataEXT : NULL;
+  tbl.glGetNamedFramebufferAttachmentParameterivEXT = layers&(EMU_ROUTE_DSA) ? emu_glGetNamedFramebufferAttachmentParameterivEXT : NULL;
+  tbl.glGetNamedProgramLocalParameterIivEXT = layers&(EMU_ROUTE_DSA) ? emu_glGetNamedProgramLocalParameterIivEXT : NULL;
+  tbl.glGetNamedProgramLocalParameterIuivEXT = layers&(EMU_ROUTE_DSA) ? emu_glGetNamedProgramLocalParameterIuivEXT : NULL;
+  tbl.glGetNamedProgramLocalParameterdvEXT = layers&(EMU_ROUTE_DSA) ? emu_glGetNamedProgramLocalParameterdvEXT : NULL;
+  tbl.glGetNamedProgramLocalParameterfvEXT = layers&(EMU_ROUTE_DSA) ? emu_glGetNamedProgramLocalParameterfvEXT : NULL;
+  tbl.glGetNamedProgramStringEXT = layers&(EMU_ROUTE_DSA) ? emu_glGetNamedProgramStringEXT : NULL;
+  tbl.glGetNamedProgramivEXT = layers&(EMU_ROUTE_DSA) ? emu_glGetNamedProgramivEXT : NULL;
+  tbl.glGetNamedRenderbufferParameterivEXT = layers&(EMU_ROUTE_DSA) ? emu_glGetNamedRenderbufferParameterivEXT : NULL;
+  tbl.glGetPointerIndexedvEXT = layers&(EMU_ROUTE_DSA) ? emu_glGetPointerIndexedvEXT : NULL;
+  tbl.glGetTextureImageEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA|EMU_ROUTE_VAO) ? emu_glGetTextureImageEXT : NULL;
+  tbl.glGetTextureLevelParameterfvEXT = layers&(EMU_ROUTE_PPA|EMU_ROUTE_DSA) ? emu_glGetTextureLevelParameterfvEXT : NULL;
+  tbl.glGetTextureLevelParameterivEXT = layers&(EMU_ROUTE_PPA|EMU_ROUTE_DSA) ? emu_glGetTextureLevelParameterivEXT : NULL;
+  tbl.glGetTextureParameterIivEXT = layers&(EMU_ROUTE_DSA) ? emu_glGetTextureParameterIivEXT : NULL;
+  tbl.glGetTextureParameterIuivEXT = layers&(EMU_ROUTE_DSA) ? emu_glGetTextureParameterIuivEXT : NULL;
+  tbl.glGetTextureParameterfvEXT = layers&(EMU_ROUTE_PPA|EMU_ROUTE_DSA) ? emu_glGetTextureParameterfvEXT : NULL;
+  tbl.glGetTextureParameterivEXT = layers&(EMU_ROUTE_PPA|EMU_ROUTE_DSA) ? emu_glGetTextureParameterivEXT : NULL;
+  tbl.glMapNamedBufferEXT = layers&(EMU_ROUTE_DSA|EMU_ROUTE_VAO) ? emu_glMapNamedBufferEXT : NULL;
+  tbl.glMapNamedBufferRangeEXT = layers&(EMU_ROUTE_DSA|EMU_ROUTE_VAO) ? emu_glMapNamedBufferRangeEXT : NULL;
+  tbl.glMatrixFrustumEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glMatrixFrustumEXT : NULL;
+  tbl.glMatrixLoadIdentityEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glMatrixLoadIdentityEXT : NULL;
+  tbl.glMatrixLoadTransposedEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glMatrixLoadTransposedEXT : NULL;
+  tbl.glMatrixLoadTransposefEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glMatrixLoadTransposefEXT : NULL;
+  tbl.glMatrixLoaddEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glMatrixLoaddEXT : NULL;
+  tbl.glMatrixLoadfEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glMatrixLoadfEXT : NULL;
+  tbl.glMatrixMultTransposedEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glMatrixMultTransposedEXT : NULL;
+  tbl.glMatrixMultTransposefEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glMatrixMultTransposefEXT : NULL;
+  tbl.glMatrixMultdEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glMatrixMultdEXT : NULL;
+  tbl.glMatrixMultfEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glMatrixMultfEXT : NULL;
+  tbl.glMatrixOrthoEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glMatrixOrthoEXT : NULL;
+  tbl.glMatrixPopEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glMatrixPopEXT : NULL;
+  tbl.glMatrixPushEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glMatrixPushEXT : NULL;
+  tbl.glMatrixRotatedEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glMatrixRotatedEXT : NULL;
+  tbl.glMatrixRotatefEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glMatrixRotatefEXT : NULL;
+  tbl.glMatrixScaledEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glMatrixScaledEXT : NULL;
+  tbl.glMatrixScalefEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glMatrixScalefEXT : NULL;
+  tbl.glMatrixTranslatedEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glMatrixTranslatedEXT : NULL;
+  tbl.glMatrixTranslatefEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glMatrixTranslatefEXT : NULL;
+  tbl.glMultiTexBufferEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glMultiTexBufferEXT : NULL;
+  tbl.glMultiTexCoordPointerEXT = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV|EMU_ROUTE_DSA) ? emu_glMultiTexCoordPointerEXT : NULL;
+  tbl.glMultiTexEnvfEXT = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glMultiTexEnvfEXT : NULL;
+  tbl.glMultiTexEnvfvEXT = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glMultiTexEnvfvEXT : NULL;
+  tbl.glMultiTexEnviEXT = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glMultiTexEnviEXT : NULL;
+  tbl.glMultiTexEnvivEXT = layers&(EMU_ROUTE_PPA|EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glMultiTexEnvivEXT : NULL;
+  tbl.glMultiTexGendEXT = layers&(EMU_ROUTE_DSA) ? emu_glMultiTexGendEXT : NULL;
+  tbl.glMultiTexGendvEXT = layers&(EMU_ROUTE_DSA) ? emu_glMultiTexGendvEXT : NULL;
+  tbl.glMultiTexGenfEXT = layers&(EMU_ROUTE_DSA) ? emu_glMultiTexGenfEXT : NULL;
+  tbl.glMultiTexGenfvEXT = layers&(EMU_ROUTE_DSA) ? emu_glMultiTexGenfvEXT : NULL;
+  tbl.glMultiTexGeniEXT = layers&(EMU_ROUTE_DSA) ? emu_glMultiTexGeniEXT : NULL;
+  tbl.glMultiTexGenivEXT = layers&(EMU_ROUTE_DSA) ? emu_glMultiTexGenivEXT : NULL;
+  tbl.glMultiTexImage1DEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glMultiTexImage1DEXT : NULL;
+  tbl.glMultiTexImage2DEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glMultiTexImage2DEXT : NULL;
+  tbl.glMultiTexImage3DEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glMultiTexImage3DEXT : NULL;
+  tbl.glMultiTexParameterIivEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glMultiTexParameterIivEXT : NULL;
+  tbl.glMultiTexParameterIuivEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glMultiTexParameterIuivEXT : NULL;
+  tbl.glMultiTexParameterfEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glMultiTexParameterfEXT : NULL;
+  tbl.glMultiTexParameterfvEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glMultiTexParameterfvEXT : NULL;
+  tbl.glMultiTexParameteriEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glMultiTexParameteriEXT : NULL;
+  tbl.glMultiTexParameterivEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glMultiTexParameterivEXT : NULL;
+  tbl.glMultiTexRenderbufferEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glMultiTexRenderbufferEXT : NULL;
+  tbl.glMultiTexSubImage1DEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glMultiTexSubImage1DEXT : NULL;
+  tbl.glMultiTexSubImage2DEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glMultiTexSubImage2DEXT : NULL;
+  tbl.glMultiTexSubImage3DEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glMultiTexSubImage3DEXT : NULL;
+  tbl.glNamedBufferDataEXT = layers&(EMU_ROUTE_DSA|EMU_ROUTE_VAO) ? emu_glNamedBufferDataEXT : NULL;
+  tbl.glNamedBufferSubDataEXT = layers&(EMU_ROUTE_DSA|EMU_ROUTE_VAO) ? emu_glNamedBufferSubDataEXT : NULL;
+  tbl.glNamedCopyBufferSubDataEXT = layers&(EMU_ROUTE_DSA|EMU_ROUTE_VAO) ? emu_glNamedCopyBufferSubDataEXT : NULL;
+  tbl.glNamedFramebufferRenderbufferEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glNamedFramebufferRenderbufferEXT : NULL;
+  tbl.glNamedFramebufferTexture1DEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glNamedFramebufferTexture1DEXT : NULL;
+  tbl.glNamedFramebufferTexture2DEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glNamedFramebufferTexture2DEXT : NULL;
+  tbl.glNamedFramebufferTexture3DEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glNamedFramebufferTexture3DEXT : NULL;
+  tbl.glNamedFramebufferTextureEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glNamedFramebufferTextureEXT : NULL;
+  tbl.glNamedFramebufferTextureFaceEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glNamedFramebufferTextureFaceEXT : NULL;
+  tbl.glNamedFramebufferTextureLayerEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glNamedFramebufferTextureLayerEXT : NULL;
+  tbl.glNamedProgramLocalParameter4dEXT = layers&(EMU_ROUTE_DSA) ? emu_glNamedProgramLocalParameter4dEXT : NULL;
+  tbl.glNamedProgramLocalParameter4dvEXT = layers&(EMU_ROUTE_DSA) ? emu_glNamedProgramLocalParameter4dvEXT : NULL;
+  tbl.glNamedProgramLocalParameter4fEXT = layers&(EMU_ROUTE_DSA) ? emu_glNamedProgramLocalParameter4fEXT : NULL;
+  tbl.glNamedProgramLocalParameter4fvEXT = layers&(EMU_ROUTE_DSA) ? emu_glNamedProgramLocalParameter4fvEXT : NULL;
+  tbl.glNamedProgramLocalParameterI4iEXT = layers&(EMU_ROUTE_DSA) ? emu_glNamedProgramLocalParameterI4iEXT : NULL;
+  tbl.glNamedProgramLocalParameterI4ivEXT = layers&(EMU_ROUTE_DSA) ? emu_glNamedProgramLocalParameterI4ivEXT : NULL;
+  tbl.glNamedProgramLocalParameterI4uiEXT = layers&(EMU_ROUTE_DSA) ? emu_glNamedProgramLocalParameterI4uiEXT : NULL;
+  tbl.glNamedProgramLocalParameterI4uivEXT = layers&(EMU_ROUTE_DSA) ? emu_glNamedProgramLocalParameterI4uivEXT : NULL;
+  tbl.glNamedProgramLocalParameters4fvEXT = layers&(EMU_ROUTE_DSA) ? emu_glNamedProgramLocalParameters4fvEXT : NULL;
+  tbl.glNamedProgramLocalParametersI4ivEXT = layers&(EMU_ROUTE_DSA) ? emu_glNamedProgramLocalParametersI4ivEXT : NULL;
+  tbl.glNamedProgramLocalParametersI4uivEXT = layers&(EMU_ROUTE_DSA) ? emu_glNamedProgramLocalParametersI4uivEXT : NULL;
+  tbl.glNamedProgramStringEXT = layers&(EMU_ROUTE_DSA) ? emu_glNamedProgramStringEXT : NULL;
+  tbl.glNamedRenderbufferStorageEXT = layers&(EMU_ROUTE_DSA) ? emu_glNamedRenderbufferStorageEXT : NULL;
+  tbl.glNamedRenderbufferStorageMultisampleCoverageEXT = layers&(EMU_ROUTE_DSA) ? emu_glNamedRenderbufferStorageMultisampleCoverageEXT : NULL;
+  tbl.glNamedRenderbufferStorageMultisampleEXT = layers&(EMU_ROUTE_DSA) ? emu_glNamedRenderbufferStorageMultisampleEXT : NULL;
+  tbl.glProgramUniform1dEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniform1dEXT : NULL;
+  tbl.glProgramUniform1dvEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniform1dvEXT : NULL;
+  tbl.glProgramUniform1fEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniform1fEXT : NULL;
+  tbl.glProgramUniform1fvEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniform1fvEXT : NULL;
+  tbl.glProgramUniform1iEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniform1iEXT : NULL;
+  tbl.glProgramUniform1ivEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniform1ivEXT : NULL;
+  tbl.glProgramUniform1uiEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniform1uiEXT : NULL;
+  tbl.glProgramUniform1uivEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniform1uivEXT : NULL;
+  tbl.glProgramUniform2dEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniform2dEXT : NULL;
+  tbl.glProgramUniform2dvEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniform2dvEXT : NULL;
+  tbl.glProgramUniform2fEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniform2fEXT : NULL;
+  tbl.glProgramUniform2fvEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniform2fvEXT : NULL;
+  tbl.glProgramUniform2iEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniform2iEXT : NULL;
+  tbl.glProgramUniform2ivEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniform2ivEXT : NULL;
+  tbl.glProgramUniform2uiEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniform2uiEXT : NULL;
+  tbl.glProgramUniform2uivEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniform2uivEXT : NULL;
+  tbl.glProgramUniform3dEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniform3dEXT : NULL;
+  tbl.glProgramUniform3dvEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniform3dvEXT : NULL;
+  tbl.glProgramUniform3fEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniform3fEXT : NULL;
+  tbl.glProgramUniform3fvEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniform3fvEXT : NULL;
+  tbl.glProgramUniform3iEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniform3iEXT : NULL;
+  tbl.glProgramUniform3ivEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniform3ivEXT : NULL;
+  tbl.glProgramUniform3uiEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniform3uiEXT : NULL;
+  tbl.glProgramUniform3uivEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniform3uivEXT : NULL;
+  tbl.glProgramUniform4dEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniform4dEXT : NULL;
+  tbl.glProgramUniform4dvEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniform4dvEXT : NULL;
+  tbl.glProgramUniform4fEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniform4fEXT : NULL;
+  tbl.glProgramUniform4fvEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniform4fvEXT : NULL;
+  tbl.glProgramUniform4iEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniform4iEXT : NULL;
+  tbl.glProgramUniform4ivEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniform4ivEXT : NULL;
+  tbl.glProgramUniform4uiEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniform4uiEXT : NULL;
+  tbl.glProgramUniform4uivEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniform4uivEXT : NULL;
+  tbl.glProgramUniformMatrix2dvEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniformMatrix2dvEXT : NULL;
+  tbl.glProgramUniformMatrix2fvEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniformMatrix2fvEXT : NULL;
+  tbl.glProgramUniformMatrix2x3dvEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniformMatrix2x3dvEXT : NULL;
+  tbl.glProgramUniformMatrix2x3fvEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniformMatrix2x3fvEXT : NULL;
+  tbl.glProgramUniformMatrix2x4dvEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniformMatrix2x4dvEXT : NULL;
+  tbl.glProgramUniformMatrix2x4fvEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniformMatrix2x4fvEXT : NULL;
+  tbl.glProgramUniformMatrix3dvEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniformMatrix3dvEXT : NULL;
+  tbl.glProgramUniformMatrix3fvEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniformMatrix3fvEXT : NULL;
+  tbl.glProgramUniformMatrix3x2dvEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniformMatrix3x2dvEXT : NULL;
+  tbl.glProgramUniformMatrix3x2fvEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniformMatrix3x2fvEXT : NULL;
+  tbl.glProgramUniformMatrix3x4dvEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniformMatrix3x4dvEXT : NULL;
+  tbl.glProgramUniformMatrix3x4fvEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniformMatrix3x4fvEXT : NULL;
+  tbl.glProgramUniformMatrix4dvEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniformMatrix4dvEXT : NULL;
+  tbl.glProgramUniformMatrix4fvEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniformMatrix4fvEXT : NULL;
+  tbl.glProgramUniformMatrix4x2dvEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniformMatrix4x2dvEXT : NULL;
+  tbl.glProgramUniformMatrix4x2fvEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniformMatrix4x2fvEXT : NULL;
+  tbl.glProgramUniformMatrix4x3dvEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniformMatrix4x3dvEXT : NULL;
+  tbl.glProgramUniformMatrix4x3fvEXT = layers&(EMU_ROUTE_DSA) ? emu_glProgramUniformMatrix4x3fvEXT : NULL;
+  tbl.glPushClientAttribDefaultEXT = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_DSA) ? emu_glPushClientAttribDefaultEXT : NULL;
+  tbl.glTextureBufferEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glTextureBufferEXT : NULL;
+  tbl.glTextureImage1DEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glTextureImage1DEXT : NULL;
+  tbl.glTextureImage2DEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glTextureImage2DEXT : NULL;
+  tbl.glTextureImage3DEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glTextureImage3DEXT : NULL;
+  tbl.glTextureParameterIivEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glTextureParameterIivEXT : NULL;
+  tbl.glTextureParameterIuivEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glTextureParameterIuivEXT : NULL;
+  tbl.glTextureParameterfEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glTextureParameterfEXT : NULL;
+  tbl.glTextureParameterfvEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glTextureParameterfvEXT : NULL;
+  tbl.glTextureParameteriEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glTextureParameteriEXT : NULL;
+  tbl.glTextureParameterivEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glTextureParameterivEXT : NULL;
+  tbl.glTextureRenderbufferEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glTextureRenderbufferEXT : NULL;
+  tbl.glTextureSubImage1DEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glTextureSubImage1DEXT : NULL;
+  tbl.glTextureSubImage2DEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glTextureSubImage2DEXT : NULL;
+  tbl.glTextureSubImage3DEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glTextureSubImage3DEXT : NULL;
+  tbl.glUnmapNamedBufferEXT = layers&(EMU_ROUTE_DSA|EMU_ROUTE_VAO) ? emu_glUnmapNamedBufferEXT : NULL;
+  tbl.glVertexArrayColorOffsetEXT = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV|EMU_ROUTE_DSA) ? emu_glVertexArrayColorOffsetEXT : NULL;
+  tbl.glVertexArrayEdgeFlagOffsetEXT = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV|EMU_ROUTE_DSA) ? emu_glVertexArrayEdgeFlagOffsetEXT : NULL;
+  tbl.glVertexArrayFogCoordOffsetEXT = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV|EMU_ROUTE_DSA) ? emu_glVertexArrayFogCoordOffsetEXT : NULL;
+  tbl.glVertexArrayIndexOffsetEXT = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV|EMU_ROUTE_DSA) ? emu_glVertexArrayIndexOffsetEXT : NULL;
+  tbl.glVertexArrayMultiTexCoordOffsetEXT = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV|EMU_ROUTE_DSA) ? emu_glVertexArrayMultiTexCoordOffsetEXT : NULL;
+  tbl.glVertexArrayNormalOffsetEXT = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV|EMU_ROUTE_DSA) ? emu_glVertexArrayNormalOffsetEXT : NULL;
+  tbl.glVertexArraySecondaryColorOffsetEXT = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV|EMU_ROUTE_DSA) ? emu_glVertexArraySecondaryColorOffsetEXT : NULL;
+  tbl.glVertexArrayTexCoordOffsetEXT = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV|EMU_ROUTE_DSA) ? emu_glVertexArrayTexCoordOffsetEXT : NULL;
+  tbl.glVertexArrayVertexAttribIOffsetEXT = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV|EMU_ROUTE_DSA) ? emu_glVertexArrayVertexAttribIOffsetEXT : NULL;
+  tbl.glVertexArrayVertexAttribOffsetEXT = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV|EMU_ROUTE_DSA) ? emu_glVertexArrayVertexAttribOffsetEXT : NULL;
+  tbl.glVertexArrayVertexOffsetEXT = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV|EMU_ROUTE_DSA) ? emu_glVertexArrayVertexOffsetEXT : NULL;
+
+  // GL_EXT_disjoint_timer_query
+
+  tbl.glGetQueryObjectivEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_VAO) ? emu_glGetQueryObjectivEXT : NULL;
+
+  // GL_EXT_draw_buffers2
+
+  tbl.glColorMaskIndexedEXT = layers&(EMU_ROUTE_FILT) ? emu_glColorMaskIndexedEXT : NULL;
+  tbl.glDisableIndexedEXT = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV|EMU_ROUTE_IFF|EMU_ROUTE_DSA|EMU_ROUTE_FILT) ? emu_glDisableIndexedEXT : NULL;
+  tbl.glEnableIndexedEXT = layers&(EMU_ROUTE_PPCA|EMU_ROUTE_BV|EMU_ROUTE_IFF|EMU_ROUTE_DSA|EMU_ROUTE_FILT) ? emu_glEnableIndexedEXT : NULL;
+  tbl.glGetBooleanIndexedvEXT = layers&(EMU_ROUTE_FILT) ? emu_glGetBooleanIndexedvEXT : NULL;
+  tbl.glGetIntegerIndexedvEXT = layers&(EMU_ROUTE_FILT) ? emu_glGetIntegerIndexedvEXT : NULL;
+  tbl.glIsEnabledIndexedEXT = layers&(EMU_ROUTE_DSA|EMU_ROUTE_FILT) ? emu_glIsEnabledIndexedEXT : NULL;
+
+  // GL_EXT_draw_instanced
+
+  tbl.glDrawArraysInstancedEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_SO|EMU_ROUTE_DSA|EMU_ROUTE_VAO) ? emu_glDrawArraysInstancedEXT : NULL;
+  tbl.glDrawElementsInstancedEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_SO|EMU_ROUTE_DSA) ? emu_glDrawElementsInstancedEXT : NULL;
+
+  // GL_EXT_draw_range_elements
+
+  tbl.glDrawRangeElementsEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_SO) ? emu_glDrawRangeElementsEXT : NULL;
+
+  // GL_EXT_fog_coord
+
+  tbl.glFogCoordPointerEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_VAO) ? emu_glFogCoordPointerEXT : NULL;
+
+  // GL_EXT_framebuffer_blit
+
+  tbl.glBlitFramebufferEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_FILT) ? emu_glBlitFramebufferEXT : NULL;
+
+  // GL_EXT_framebuffer_multisample
+
+  tbl.glRenderbufferStorageMultisampleEXT = layers&(EMU_ROUTE_DSA) ? emu_glRenderbufferStorageMultisampleEXT : NULL;
+
+  // GL_EXT_framebuffer_object
+
+  tbl.glBindFramebufferEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA|EMU_ROUTE_FILT) ? emu_glBindFramebufferEXT : NULL;
+  tbl.glBindRenderbufferEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA|EMU_ROUTE_FILT) ? emu_glBindRenderbufferEXT : NULL;
+  tbl.glCheckFramebufferStatusEXT = layers&(EMU_ROUTE_FILT) ? emu_glCheckFramebufferStatusEXT : NULL;
+  tbl.glDeleteFramebuffersEXT = layers&(EMU_ROUTE_DSA|EMU_ROUTE_FILT) ? emu_glDeleteFramebuffersEXT : NULL;
+  tbl.glDeleteRenderbuffersEXT = layers&(EMU_ROUTE_DSA|EMU_ROUTE_FILT) ? emu_glDeleteRenderbuffersEXT : NULL;
+  tbl.glFramebufferRenderbufferEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA|EMU_ROUTE_FILT) ? emu_glFramebufferRenderbufferEXT : NULL;
+  tbl.glFramebufferTexture1DEXT = layers&(EMU_ROUTE_OBJ|EMU_ROUTE_IFF|EMU_ROUTE_DSA|EMU_ROUTE_FILT) ? emu_glFramebufferTexture1DEXT : NULL;
+  tbl.glFramebufferTexture2DEXT = layers&(EMU_ROUTE_OBJ|EMU_ROUTE_IFF|EMU_ROUTE_DSA|EMU_ROUTE_FILT) ? emu_glFramebufferTexture2DEXT : NULL;
+  tbl.glFramebufferTexture3DEXT = layers&(EMU_ROUTE_OBJ|EMU_ROUTE_IFF|EMU_ROUTE_DSA|EMU_ROUTE_FILT) ? emu_glFramebufferTexture3DEXT : NULL;
+  tbl.glGenFramebuffersEXT = layers&(EMU_ROUTE_FILT) ? emu_glGenFramebuffersEXT : NULL;
+  tbl.glGenRenderbuffersEXT = layers&(EMU_ROUTE_FILT) ? emu_glGenRenderbuffersEXT : NULL;
+  tbl.glGenerateMipmapEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA|EMU_ROUTE_TEXC|EMU_ROUTE_FILT) ? emu_glGenerateMipmapEXT : NULL;
+  tbl.glGetFramebufferAttachmentParameterivEXT = layers&(EMU_ROUTE_OBJ|EMU_ROUTE_FILT) ? emu_glGetFramebufferAttachmentParameterivEXT : NULL;
+  tbl.glGetRenderbufferParameterivEXT = layers&(EMU_ROUTE_DSA|EMU_ROUTE_FILT) ? emu_glGetRenderbufferParameterivEXT : NULL;
+  tbl.glIsFramebufferEXT = layers&(EMU_ROUTE_FILT) ? emu_glIsFramebufferEXT : NULL;
+  tbl.glIsRenderbufferEXT = layers&(EMU_ROUTE_FILT) ? emu_glIsRenderbufferEXT : NULL;
+  tbl.glRenderbufferStorageEXT = layers&(EMU_ROUTE_DSA|EMU_ROUTE_FILT) ? emu_glRenderbufferStorageEXT : NULL;
+
+  // GL_EXT_geometry_shader4
+
+  tbl.glFramebufferTextureEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glFramebufferTextureEXT : NULL;
+  tbl.glFramebufferTextureFaceEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glFramebufferTextureFaceEXT : NULL;
+
+  // GL_EXT_map_buffer_range
+
+  tbl.glFlushMappedBufferRangeEXT = layers&(EMU_ROUTE_DSA|EMU_ROUTE_VAO) ? emu_glFlushMappedBufferRangeEXT : NULL;
+  tbl.glMapBufferRangeEXT = layers&(EMU_ROUTE_DSA|EMU_ROUTE_VAO) ? emu_glMapBufferRangeEXT : NULL;
+
+  // GL_EXT_multi_draw_arrays
+
+  tbl.glMultiDrawArraysEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_SO|EMU_ROUTE_DSA|EMU_ROUTE_VAO) ? emu_glMultiDrawArraysEXT : NULL;
+  tbl.glMultiDrawElementsEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_SO|EMU_ROUTE_DSA) ? emu_glMultiDrawElementsEXT : NULL;
+
+  // GL_EXT_multisampled_render_to_texture
+
+  tbl.glFramebufferTexture2DMultisampleEXT = layers&(EMU_ROUTE_OBJ) ? emu_glFramebufferTexture2DMultisampleEXT : NULL;
+
+  // GL_EXT_multiview_draw_buffers
+
+  tbl.glGetIntegeri_vEXT = layers&(EMU_ROUTE_PPA) ? emu_glGetIntegeri_vEXT : NULL;
+
+  // GL_EXT_occlusion_query_boolean
+
+  tbl.glGetQueryObjectuivEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_VAO) ? emu_glGetQueryObjectuivEXT : NULL;
+
+  // GL_EXT_provoking_vertex
+
+  tbl.glProvokingVertexEXT = layers&(EMU_ROUTE_QUADS) ? emu_glProvokingVertexEXT : NULL;
+
+  // GL_EXT_robustness
+
+  tbl.glReadnPixelsEXT = layers&(EMU_ROUTE_VAO) ? emu_glReadnPixelsEXT : NULL;
+
+  // GL_EXT_secondary_color
+
+  tbl.glSecondaryColor3bEXT = layers&(EMU_ROUTE_IFF) ? emu_glSecondaryColor3bEXT : NULL;
+  tbl.glSecondaryColor3bvEXT = layers&(EMU_ROUTE_IFF) ? emu_glSecondaryColor3bvEXT : NULL;
+  tbl.glSecondaryColor3dEXT = layers&(EMU_ROUTE_IFF) ? emu_glSecondaryColor3dEXT : NULL;
+  tbl.glSecondaryColor3dvEXT = layers&(EMU_ROUTE_IFF) ? emu_glSecondaryColor3dvEXT : NULL;
+  tbl.glSecondaryColor3fEXT = layers&(EMU_ROUTE_IFF) ? emu_glSecondaryColor3fEXT : NULL;
+  tbl.glSecondaryColor3fvEXT = layers&(EMU_ROUTE_IFF) ? emu_glSecondaryColor3fvEXT : NULL;
+  tbl.glSecondaryColor3iEXT = layers&(EMU_ROUTE_IFF) ? emu_glSecondaryColor3iEXT : NULL;
+  tbl.glSecondaryColor3ivEXT = layers&(EMU_ROUTE_IFF) ? emu_glSecondaryColor3ivEXT : NULL;
+  tbl.glSecondaryColor3sEXT = layers&(EMU_ROUTE_IFF) ? emu_glSecondaryColor3sEXT : NULL;
+  tbl.glSecondaryColor3svEXT = layers&(EMU_ROUTE_IFF) ? emu_glSecondaryColor3svEXT : NULL;
+  tbl.glSecondaryColor3ubEXT = layers&(EMU_ROUTE_IFF) ? emu_glSecondaryColor3ubEXT : NULL;
+  tbl.glSecondaryColor3ubvEXT = layers&(EMU_ROUTE_IFF) ? emu_glSecondaryColor3ubvEXT : NULL;
+  tbl.glSecondaryColor3uiEXT = layers&(EMU_ROUTE_IFF) ? emu_glSecondaryColor3uiEXT : NULL;
+  tbl.glSecondaryColor3uivEXT = layers&(EMU_ROUTE_IFF) ? emu_glSecondaryColor3uivEXT : NULL;
+  tbl.glSecondaryColor3usEXT = layers&(EMU_ROUTE_IFF) ? emu_glSecondaryColor3usEXT : NULL;
+  tbl.glSecondaryColor3usvEXT = layers&(EMU_ROUTE_IFF) ? emu_glSecondaryColor3usvEXT : NULL;
+  tbl.glSecondaryColorPointerEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_VAO) ? emu_glSecondaryColorPointerEXT : NULL;
+
+  // GL_EXT_shader_image_load_store
+
+  tbl.glMemoryBarrierEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_VAO) ? emu_glMemoryBarrierEXT : NULL;
+
+  // GL_EXT_subtexture
+
+  tbl.glTexSubImage2DEXT = layers&(EMU_ROUTE_XFER) ? emu_glTexSubImage2DEXT : NULL;
+
+  // GL_EXT_texture3D
+
+  tbl.glTexImage3DEXT = layers&(EMU_ROUTE_IFF) ? emu_glTexImage3DEXT : NULL;
+
+  // GL_EXT_texture_array
+
+  tbl.glFramebufferTextureLayerEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA) ? emu_glFramebufferTextureLayerEXT : NULL;
+
+  // GL_EXT_texture_integer
+
+  tbl.glTexParameterIivEXT = layers&(EMU_ROUTE_SO) ? emu_glTexParameterIivEXT : NULL;
+  tbl.glTexParameterIuivEXT = layers&(EMU_ROUTE_SO) ? emu_glTexParameterIuivEXT : NULL;
+
+  // GL_EXT_texture_object
+
+  tbl.glBindTextureEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA|EMU_ROUTE_TEXC) ? emu_glBindTextureEXT : NULL;
+  tbl.glDeleteTexturesEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_DSA|EMU_ROUTE_TEXC) ? emu_glDeleteTexturesEXT : NULL;
+  tbl.glGenTexturesEXT = layers&(EMU_ROUTE_TEXC) ? emu_glGenTexturesEXT : NULL;
+
+  // GL_EXT_texture_storage
+
+  tbl.glTexStorage1DEXT = layers&(EMU_ROUTE_TEXSTO|EMU_ROUTE_IFF) ? emu_glTexStorage1DEXT : NULL;
+  tbl.glTexStorage2DEXT = layers&(EMU_ROUTE_TEXSTO|EMU_ROUTE_IFF) ? emu_glTexStorage2DEXT : NULL;
+  tbl.glTexStorage3DEXT = layers&(EMU_ROUTE_TEXSTO|EMU_ROUTE_IFF) ? emu_glTexStorage3DEXT : NULL;
+
+  // GL_EXT_timer_query
+
+  tbl.glGetQueryObjecti64vEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_VAO) ? emu_glGetQueryObjecti64vEXT : NULL;
+  tbl.glGetQueryObjectui64vEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_VAO) ? emu_glGetQueryObjectui64vEXT : NULL;
+
+  // GL_EXT_transform_feedback
+
+  tbl.glBeginTransformFeedbackEXT = layers&(EMU_ROUTE_VAO) ? emu_glBeginTransformFeedbackEXT : NULL;
+  tbl.glBindBufferBaseEXT = layers&(EMU_ROUTE_IFF) ? emu_glBindBufferBaseEXT : NULL;
+  tbl.glBindBufferOffsetEXT = layers&(EMU_ROUTE_IFF) ? emu_glBindBufferOffsetEXT : NULL;
+  tbl.glBindBufferRangeEXT = layers&(EMU_ROUTE_IFF) ? emu_glBindBufferRangeEXT : NULL;
+  tbl.glEndTransformFeedbackEXT = layers&(EMU_ROUTE_VAO) ? emu_glEndTransformFeedbackEXT : NULL;
+
+  // GL_EXT_vertex_array
+
+  tbl.glArrayElementEXT = layers&(EMU_ROUTE_IFF) ? emu_glArrayElementEXT : NULL;
+  tbl.glColorPointerEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_VAO) ? emu_glColorPointerEXT : NULL;
+  tbl.glDrawArraysEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_QUADS|EMU_ROUTE_SO|EMU_ROUTE_DSA|EMU_ROUTE_VAO) ? emu_glDrawArraysEXT : NULL;
+  tbl.glEdgeFlagPointerEXT = layers&(EMU_ROUTE_IFF) ? emu_glEdgeFlagPointerEXT : NULL;
+  tbl.glNormalPointerEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_VAO) ? emu_glNormalPointerEXT : NULL;
+  tbl.glTexCoordPointerEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_VAO) ? emu_glTexCoordPointerEXT : NULL;
+  tbl.glVertexPointerEXT = layers&(EMU_ROUTE_IFF|EMU_ROUTE_VAO) ? emu_glVertexPointerEXT : NULL;
+
+  // GL_KHR_robustness
+
+  tbl.glReadnPixels = layers&(EMU_ROUTE_VAO) ? emu_glReadnPixels : NULL;
+
+  // GL_NV_draw_buffers
+
+  tbl.glDrawBuffersNV = layers&(EMU_ROUTE_PPA) ? emu_glDrawBuffersNV : NULL;
+
+  // GL_NV_explicit_multisample
+
+  tbl.glTexRenderbufferNV = layers&(EMU_ROUTE_DSA) ? emu_glTexRenderbufferNV : NULL;
+
+  // GL_NV_framebuffer_multisample_coverage
+
+  tbl.glRenderbufferStorageMultisampleCoverageNV = layers&(EMU_ROUTE_DSA) ? emu_glRenderbufferStorageMultisampleCoverageNV : NULL;
+
+  // GL_NV_gpu_program4
+
+  tbl.glGetProgramEnvParameterIivNV = layers&(EMU_ROUTE_DSA) ? emu_glGetProgramEnvParameterIivNV : NULL;
+  tbl.glGetProgramEnvParameterIuivNV = layers&(EMU_ROUTE_DSA) ? emu_glGetProgramEnvParameterIuivNV : NULL;
+  tbl.glGetProgramLocalParameterIivNV = layers&(EMU_ROUTE_DSA) ? emu_glGetProgramLocalParameterIivNV : NULL;
+  tbl.glGetProgramLocalParameterIuivNV = layers&(EMU_ROUTE_DSA) ? emu_glGetProgramLocalParameterIuivNV : NULL;
+  tbl.glProgramEnvParameterI4iNV = layers&(EMU_ROUTE_DSA) ? emu_glProgramEnvParameterI4iNV : NULL;
+  tbl.glProgramEnvParameterI4ivNV = layers&(EMU_ROUTE_DSA) ? emu_glProgramEnvParameterI4ivNV : NULL;
+  tbl.glProgramEnvParameterI4uiNV = layers&(EMU_ROUTE_DSA) ? emu_glProgramEnvParameterI4uiNV : NULL;
+  tbl.glProgramEnvParameterI4uivNV = layers&(EMU_ROUTE_DSA) ? emu_glProgramEnvParameterI4uivNV : NULL;
+  tbl.glProgramEnvParametersI4ivNV = layers&(EMU_ROUTE_DSA) ? emu_glProgramEnvParametersI4ivNV : NULL;
+  tbl.glProgramEnvParametersI4uivNV = layers&(EMU_ROUTE_DSA) ? emu_glProgramEnvParametersI4uivNV : NULL;
+  tbl.glProgramLocalParameterI4iNV = layers&(EMU_ROUTE_DSA) ? emu_glProgramLocalParameterI4iNV : NULL;
+  tbl.glProgramLocalParameterI4ivNV = layers&(EMU_ROUTE_DSA) ? emu_glProgramLocalParameterI4ivNV : NULL;
+  tbl.glProgramLocalParameterI4uiNV = layers&(EMU_ROUTE_DSA) ? emu_glProgramLocalParameterI4uiNV : NULL;
+  tbl.glProgramLocalParameterI4uivNV = layers&(EMU_ROUTE_DSA) ? emu_glProgramLocalParameterI4uivNV : NULL;
+  tbl.glProgramLocalParametersI4ivNV = layers&(EMU_ROUTE_DSA) ? emu_glProgramLocalParametersI4ivNV : NULL;
+  tbl.glProgramLocalParametersI4uivNV = layers&(EMU_ROUTE_DSA) ? emu_glProgramLocalParametersI4uivNV : NULL;
+
+  // GL_NV_texture_multisample
+
+  tbl.glTexImage2DMultisampleCoverageNV = layers&(EMU_ROUTE_IFF) ? emu_glTexImage2DMultisampleCoverageNV : NULL;
+  tbl.glTexImage3DMultisampleCoverageNV = layers&(EMU_ROUTE_IFF) ? emu_glTexImage3DMultisampleCoverageNV : NULL;
+
+  // GL_NV_transform_feedback
+
+  tbl.glBeginTransformFeedbackNV = layers&(EMU_ROUTE_VAO) ? emu_glBeginTransformFeedbackNV : NULL;
+  tbl.glBindBufferBaseNV = layers&(EMU_ROUTE_IFF) ? emu_glBindBufferBaseNV : NULL;
+  tbl.glBindBufferOffsetNV = layers&(EMU_ROUTE_IFF) ? emu_glBindBufferOffsetNV : NULL;
+  tbl.glBindBufferRangeNV = layers&(EMU_ROUTE_IFF) ? emu_glBindBufferRangeNV : NULL;
+  tbl.glEndTransformFeedbackNV = layers&(EMU_ROUTE_VAO) ? emu_glEndTransformFeedbackNV : NULL;
+
+  // GL_NV_transform_feedback2
+
+  tbl.glPauseTransformFeedbackNV = layers&(EMU_ROUTE_VAO) ? emu_glPauseTransformFeedbackNV : NULL;
+  tbl.glResumeTransformFeedbackNV = layers&(EMU_ROUTE_VAO) ? emu_glResumeTransformFeedbackNV : NULL;
+
+  // GL_NV_vertex_program
+
+  tbl.glDeleteProgramsNV = layers&(EMU_ROUTE_DSA) ? emu_glDeleteProgramsNV : NULL;
+
+  // GL_OES_framebuffer_object
+
+  tbl.glBindFramebufferOES = layers&(EMU_ROUTE_FILT) ? emu_glBindFramebufferOES : NULL;
+  tbl.glDeleteFramebuffersOES = layers&(EMU_ROUTE_DSA) ? emu_glDeleteFramebuffersOES : NULL;
+  tbl.glDeleteRenderbuffersOES = layers&(EMU_ROUTE_DSA) ? emu_glDeleteRenderbuffersOES : NULL;
+  tbl.glFramebufferTexture2DOES = layers&(EMU_ROUTE_OBJ) ? emu_glFramebufferTexture2DOES : NULL;
+
+  // GL_OES_texture_3D
+
+  tbl.glFramebufferTexture3DOES = layers&(EMU_ROUTE_OBJ) ? emu_glFramebufferTexture3DOES : NULL;
+
+  // GL_OES_vertex_array_object
+
+  tbl.glBindVertexArrayOES = layers&(EMU_ROUTE_IFF) ? emu_glBindVertexArrayOES : NULL;
+  tbl.glDeleteVertexArraysOES = layers&(EMU_ROUTE_DSA) ? emu_glDeleteVertexArraysOES : NULL;
+
+  // GL_REGAL_ES1_0_compatibility
+
+  tbl.glFogxv = NULL;
+  tbl.glLightModelxv = NULL;
+  tbl.glLightxv = NULL;
+  tbl.glLoadMatrixx = NULL;
+  tbl.glMaterialxv = NULL;
+  tbl.glMultMatrixx = NULL;
+  tbl.glTexEnvxv = NULL;
+
+  // GL_REGAL_ES1_1_compatibility
+
+  tbl.glClipPlanef = NULL;
+  tbl.glClipPlanex = NULL;
+  tbl.glGetClipPlanef = NULL;
+  tbl.glGetClipPlanex = NULL;
+  tbl.glGetFixedv = NULL;
+  tbl.glGetLightxv = layers&(EMU_ROUTE_PPA) ? emu_glGetLightxv : NULL;
+  tbl.glGetMaterialxv = layers&(EMU_ROUTE_PPA) ? emu_glGetMaterialxv : NULL;
+  tbl.glGetTexEnvxv = NULL;
+  tbl.glGetTexParameterxv = NULL;
+  tbl.glPointParameterx = NULL;
+  tbl.glPointParameterxv = NULL;
+  tbl.glTexParameterxv = NULL;
+
+  // GL_SGIS_texture4D
+
+  tbl.glTexImage4DSGIS = layers&(EMU_ROUTE_IFF) ? emu_glTexImage4DSGIS : NULL;
+
+}
+
 REGAL_NAMESPACE_END
 
 #endif
@@ -0,0 +1,1146 @@
+/* NOTE: Do not edit this file, it is generated by a script:
+   Export.py --api gl 4.5 --api wgl 4.5 --api glx 4.5 --api cgl 1.4 --api egl 1.0 --outdir .
+*/
+
+/*
+  Copyright (c) 2011-2014 NVIDIA Corporation
+  Copyright (c) 2012-2014 Scott Nations
+  Copyright (c) 2012-2014 Nigel Stewart
+  Copyright (c) 2011-2013 Cass Everitt
+  Copyright (c) 2012 Mathias Schott
+  Copyright (c) 2012-2013 Google Inc.
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+    Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+  IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+  OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+  OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+  Intended formatting conventions:
+  $ astyle --style=allman --indent=spaces=2 --indent-switches
+*/
+
+#include "pch.h" /* For MS precompiled header support */
+
+#include "RegalUtil.h"
+
+#if REGAL_REDUNDANT
+
+REGAL_GLOBAL_BEGIN
+
+#include "RegalConfig.h"
+#include "RegalThread.h"
+#include "RegalContext.h"
+#include "RegalDispatcher.h"
+#include "RegalRedundant.h"
+#include "RegalStatistics.h"
+
+REGAL_GLOBAL_END
+
+REGAL_NAMESPACE_BEGIN
+
+// Calls that would not change the state last sent downstream are
+// dropped, and counted per entry point in Statistics.
+
+static void REGAL_CALL redundant_glEnable(GLenum cap)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  if (_redundant->enable(cap,GL_TRUE))
+  {
+    #if REGAL_STATISTICS
+    if (_context->statistics)
+      _context->statistics->redundant_glEnable++;
+    #endif
+    return;
+  }
+  _next->call(&_next->glEnable)(cap);
+}
+
+static void REGAL_CALL redundant_glDisable(GLenum cap)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  if (_redundant->enable(cap,GL_FALSE))
+  {
+    #if REGAL_STATISTICS
+    if (_context->statistics)
+      _context->statistics->redundant_glDisable++;
+    #endif
+    return;
+  }
+  _next->call(&_next->glDisable)(cap);
+}
+
+static void REGAL_CALL redundant_glActiveTexture(GLenum texture)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  if (_redundant->activeTexture(texture))
+  {
+    #if REGAL_STATISTICS
+    if (_context->statistics)
+      _context->statistics->redundant_glActiveTexture++;
+    #endif
+    return;
+  }
+  _next->call(&_next->glActiveTexture)(texture);
+}
+
+static void REGAL_CALL redundant_glActiveTextureARB(GLenum texture)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  if (_redundant->activeTexture(texture))
+  {
+    #if REGAL_STATISTICS
+    if (_context->statistics)
+      _context->statistics->redundant_glActiveTexture++;
+    #endif
+    return;
+  }
+  _next->call(&_next->glActiveTextureARB)(texture);
+}
+
+static void REGAL_CALL redundant_glBindTexture(GLenum target, GLuint texture)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  if (_redundant->bindTexture(target,texture))
+  {
+    #if REGAL_STATISTICS
+    if (_context->statistics)
+      _context->statistics->redundant_glBindTexture++;
+    #endif
+    return;
+  }
+  _next->call(&_next->glBindTexture)(target, texture);
+}
+
+static void REGAL_CALL redundant_glBindTextureEXT(GLenum target, GLuint texture)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  if (_redundant->bindTexture(target,texture))
+  {
+    #if REGAL_STATISTICS
+    if (_context->statistics)
+      _context->statistics->redundant_glBindTexture++;
+    #endif
+    return;
+  }
+  _next->call(&_next->glBindTextureEXT)(target, texture);
+}
+
+static void REGAL_CALL redundant_glUseProgram(GLuint program)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  if (_redundant->useProgram(program))
+  {
+    #if REGAL_STATISTICS
+    if (_context->statistics)
+      _context->statistics->redundant_glUseProgram++;
+    #endif
+    return;
+  }
+  _next->call(&_next->glUseProgram)(program);
+}
+
+static void REGAL_CALL redundant_glBindBuffer(GLenum target, GLuint buffer)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  #if REGAL_EMULATION
+  // Vao emulation binds buffers behind our back
+  if (!_context->vao && _redundant->bindBuffer(target,buffer))
+  #else
+  if (_redundant->bindBuffer(target,buffer))
+  #endif
+  {
+    #if REGAL_STATISTICS
+    if (_context->statistics)
+      _context->statistics->redundant_glBindBuffer++;
+    #endif
+    return;
+  }
+  _next->call(&_next->glBindBuffer)(target, buffer);
+}
+
+static void REGAL_CALL redundant_glBindBufferARB(GLenum target, GLuint buffer)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  #if REGAL_EMULATION
+  // Vao emulation binds buffers behind our back
+  if (!_context->vao && _redundant->bindBuffer(target,buffer))
+  #else
+  if (_redundant->bindBuffer(target,buffer))
+  #endif
+  {
+    #if REGAL_STATISTICS
+    if (_context->statistics)
+      _context->statistics->redundant_glBindBuffer++;
+    #endif
+    return;
+  }
+  _next->call(&_next->glBindBufferARB)(target, buffer);
+}
+
+static void REGAL_CALL redundant_glBindFramebuffer(GLenum target, GLuint framebuffer)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  if (_redundant->bindFramebuffer(target,framebuffer))
+  {
+    #if REGAL_STATISTICS
+    if (_context->statistics)
+      _context->statistics->redundant_glBindFramebuffer++;
+    #endif
+    return;
+  }
+  _next->call(&_next->glBindFramebuffer)(target, framebuffer);
+}
+
+static void REGAL_CALL redundant_glBindFramebufferEXT(GLenum target, GLuint framebuffer)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  if (_redundant->bindFramebuffer(target,framebuffer))
+  {
+    #if REGAL_STATISTICS
+    if (_context->statistics)
+      _context->statistics->redundant_glBindFramebuffer++;
+    #endif
+    return;
+  }
+  _next->call(&_next->glBindFramebufferEXT)(target, framebuffer);
+}
+
+static void REGAL_CALL redundant_glBindVertexArray(GLuint array)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  #if REGAL_EMULATION
+  // Vao emulation binds buffers behind our back
+  if (!_context->vao && _redundant->bindVertexArray(array))
+  #else
+  if (_redundant->bindVertexArray(array))
+  #endif
+  {
+    #if REGAL_STATISTICS
+    if (_context->statistics)
+      _context->statistics->redundant_glBindVertexArray++;
+    #endif
+    return;
+  }
+  _next->call(&_next->glBindVertexArray)(array);
+}
+
+static void REGAL_CALL redundant_glDepthFunc(GLenum func)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  if (_redundant->depthFunc(func))
+  {
+    #if REGAL_STATISTICS
+    if (_context->statistics)
+      _context->statistics->redundant_glDepthFunc++;
+    #endif
+    return;
+  }
+  _next->call(&_next->glDepthFunc)(func);
+}
+
+static void REGAL_CALL redundant_glDepthMask(GLboolean flag)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  if (_redundant->depthMask(flag))
+  {
+    #if REGAL_STATISTICS
+    if (_context->statistics)
+      _context->statistics->redundant_glDepthMask++;
+    #endif
+    return;
+  }
+  _next->call(&_next->glDepthMask)(flag);
+}
+
+static void REGAL_CALL redundant_glBlendFunc(GLenum sfactor, GLenum dfactor)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  if (_redundant->blendFunc(sfactor,dfactor,sfactor,dfactor))
+  {
+    #if REGAL_STATISTICS
+    if (_context->statistics)
+      _context->statistics->redundant_glBlendFunc++;
+    #endif
+    return;
+  }
+  _next->call(&_next->glBlendFunc)(sfactor, dfactor);
+}
+
+static void REGAL_CALL redundant_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  if (_redundant->blendFunc(sfactorRGB,dfactorRGB,sfactorAlpha,dfactorAlpha))
+  {
+    #if REGAL_STATISTICS
+    if (_context->statistics)
+      _context->statistics->redundant_glBlendFuncSeparate++;
+    #endif
+    return;
+  }
+  _next->call(&_next->glBlendFuncSeparate)(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+
+static void REGAL_CALL redundant_glBlendFuncSeparateEXT(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  if (_redundant->blendFunc(sfactorRGB,dfactorRGB,sfactorAlpha,dfactorAlpha))
+  {
+    #if REGAL_STATISTICS
+    if (_context->statistics)
+      _context->statistics->redundant_glBlendFuncSeparate++;
+    #endif
+    return;
+  }
+  _next->call(&_next->glBlendFuncSeparateEXT)(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+
+static void REGAL_CALL redundant_glBlendEquation(GLenum mode)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  if (_redundant->blendEquation(mode,mode))
+  {
+    #if REGAL_STATISTICS
+    if (_context->statistics)
+      _context->statistics->redundant_glBlendEquation++;
+    #endif
+    return;
+  }
+  _next->call(&_next->glBlendEquation)(mode);
+}
+
+static void REGAL_CALL redundant_glBlendEquationEXT(GLenum mode)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  if (_redundant->blendEquation(mode,mode))
+  {
+    #if REGAL_STATISTICS
+    if (_context->statistics)
+      _context->statistics->redundant_glBlendEquation++;
+    #endif
+    return;
+  }
+  _next->call(&_next->glBlendEquationEXT)(mode);
+}
+
+static void REGAL_CALL redundant_glCullFace(GLenum mode)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  if (_redundant->cullFace(mode))
+  {
+    #if REGAL_STATISTICS
+    if (_context->statistics)
+      _context->statistics->redundant_glCullFace++;
+    #endif
+    return;
+  }
+  _next->call(&_next->glCullFace)(mode);
+}
+
+static void REGAL_CALL redundant_glFrontFace(GLenum mode)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  if (_redundant->frontFace(mode))
+  {
+    #if REGAL_STATISTICS
+    if (_context->statistics)
+      _context->statistics->redundant_glFrontFace++;
+    #endif
+    return;
+  }
+  _next->call(&_next->glFrontFace)(mode);
+}
+
+static void REGAL_CALL redundant_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  if (_redundant->colorMask(red,green,blue,alpha))
+  {
+    #if REGAL_STATISTICS
+    if (_context->statistics)
+      _context->statistics->redundant_glColorMask++;
+    #endif
+    return;
+  }
+  _next->call(&_next->glColorMask)(red, green, blue, alpha);
+}
+
+static void REGAL_CALL redundant_glViewport(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  if (_redundant->viewport(x,y,width,height))
+  {
+    #if REGAL_STATISTICS
+    if (_context->statistics)
+      _context->statistics->redundant_glViewport++;
+    #endif
+    return;
+  }
+  _next->call(&_next->glViewport)(x, y, width, height);
+}
+
+static void REGAL_CALL redundant_glScissor(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  if (_redundant->scissor(x,y,width,height))
+  {
+    #if REGAL_STATISTICS
+    if (_context->statistics)
+      _context->statistics->redundant_glScissor++;
+    #endif
+    return;
+  }
+  _next->call(&_next->glScissor)(x, y, width, height);
+}
+
+static void REGAL_CALL redundant_glClearColor(GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  if (_redundant->clearColor(red,green,blue,alpha))
+  {
+    #if REGAL_STATISTICS
+    if (_context->statistics)
+      _context->statistics->redundant_glClearColor++;
+    #endif
+    return;
+  }
+  _next->call(&_next->glClearColor)(red, green, blue, alpha);
+}
+
+// Calls which change shadowed state in ways not followed
+// by the filters above
+
+static void REGAL_CALL redundant_glNewList(GLuint list, GLenum mode)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  _redundant->newList();
+  _next->call(&_next->glNewList)(list, mode);
+}
+
+static void REGAL_CALL redundant_glEndList(void)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  _redundant->endList();
+  _next->call(&_next->glEndList)();
+}
+
+static void REGAL_CALL redundant_glCallList(GLuint list)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  _redundant->reset();
+  _next->call(&_next->glCallList)(list);
+}
+
+static void REGAL_CALL redundant_glCallLists(GLsizei n, GLenum type, const GLvoid *lists)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  _redundant->reset();
+  _next->call(&_next->glCallLists)(n, type, lists);
+}
+
+static void REGAL_CALL redundant_glPopAttrib(void)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  _redundant->reset();
+  _next->call(&_next->glPopAttrib)();
+}
+
+static void REGAL_CALL redundant_glPopClientAttrib(void)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  _redundant->reset();
+  _next->call(&_next->glPopClientAttrib)();
+}
+
+static void REGAL_CALL redundant_glDisablei(GLenum target, GLuint index)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  _redundant->invalidateEnable(target);
+  _next->call(&_next->glDisablei)(target, index);
+}
+
+static void REGAL_CALL redundant_glEnablei(GLenum target, GLuint index)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  _redundant->invalidateEnable(target);
+  _next->call(&_next->glEnablei)(target, index);
+}
+
+static void REGAL_CALL redundant_glDisableIndexedEXT(GLenum target, GLuint index)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  _redundant->invalidateEnable(target);
+  _next->call(&_next->glDisableIndexedEXT)(target, index);
+}
+
+static void REGAL_CALL redundant_glEnableIndexedEXT(GLenum target, GLuint index)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  _redundant->invalidateEnable(target);
+  _next->call(&_next->glEnableIndexedEXT)(target, index);
+}
+
+static void REGAL_CALL redundant_glDeleteTextures(GLsizei n, const GLuint *textures)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  _redundant->invalidateTextures();
+  _next->call(&_next->glDeleteTextures)(n, textures);
+}
+
+static void REGAL_CALL redundant_glBindTextureUnit(GLuint unit, GLuint texture)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  _redundant->invalidateTextures();
+  _next->call(&_next->glBindTextureUnit)(unit, texture);
+}
+
+static void REGAL_CALL redundant_glBindTextures(GLuint first, GLsizei count, const GLuint *textures)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  _redundant->invalidateTextures();
+  _next->call(&_next->glBindTextures)(first, count, textures);
+}
+
+static void REGAL_CALL redundant_glBindMultiTextureEXT(GLenum texunit, GLenum target, GLuint texture)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  _redundant->invalidateTextures();
+  _next->call(&_next->glBindMultiTextureEXT)(texunit, target, texture);
+}
+
+static void REGAL_CALL redundant_glDeleteProgram(GLuint program)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  _redundant->invalidateProgram();
+  _next->call(&_next->glDeleteProgram)(program);
+}
+
+static void REGAL_CALL redundant_glDeleteObjectARB(GLhandleARB obj)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  _redundant->invalidateProgram();
+  _next->call(&_next->glDeleteObjectARB)(obj);
+}
+
+static void REGAL_CALL redundant_glUseProgramObjectARB(GLhandleARB programObj)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  _redundant->invalidateProgram();
+  _next->call(&_next->glUseProgramObjectARB)(programObj);
+}
+
+static void REGAL_CALL redundant_glDeleteBuffers(GLsizei n, const GLuint *buffers)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  _redundant->invalidateBuffers();
+  _next->call(&_next->glDeleteBuffers)(n, buffers);
+}
+
+static void REGAL_CALL redundant_glDeleteBuffersARB(GLsizei n, const GLuint *buffers)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  _redundant->invalidateBuffers();
+  _next->call(&_next->glDeleteBuffersARB)(n, buffers);
+}
+
+static void REGAL_CALL redundant_glBindBuffersBase(GLenum target, GLuint first, GLsizei count, const GLuint *buffers)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  _redundant->invalidateBuffer(target);
+  _next->call(&_next->glBindBuffersBase)(target, first, count, buffers);
+}
+
+static void REGAL_CALL redundant_glBindBuffersRange(GLenum target, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizeiptr *sizes)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  _redundant->invalidateBuffer(target);
+  _next->call(&_next->glBindBuffersRange)(target, first, count, buffers, offsets, sizes);
+}
+
+static void REGAL_CALL redundant_glBindBufferBase(GLenum target, GLuint index, GLuint buffer)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  _redundant->invalidateBuffer(target);
+  _next->call(&_next->glBindBufferBase)(target, index, buffer);
+}
+
+static void REGAL_CALL redundant_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  _redundant->invalidateBuffer(target);
+  _next->call(&_next->glBindBufferRange)(target, index, buffer, offset, size);
+}
+
+static void REGAL_CALL redundant_glBindTransformFeedback(GLenum target, GLuint id)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  _redundant->invalidateBuffer(GL_TRANSFORM_FEEDBACK_BUFFER);
+  _next->call(&_next->glBindTransformFeedback)(target, id);
+}
+
+static void REGAL_CALL redundant_glBindVertexArrayAPPLE(GLuint array)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  _redundant->invalidateVertexArray();
+  _next->call(&_next->glBindVertexArrayAPPLE)(array);
+}
+
+static void REGAL_CALL redundant_glDeleteVertexArraysAPPLE(GLsizei n, const GLuint *arrays)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  _redundant->invalidateVertexArray();
+  _next->call(&_next->glDeleteVertexArraysAPPLE)(n, arrays);
+}
+
+static void REGAL_CALL redundant_glDeleteVertexArrays(GLsizei n, const GLuint *arrays)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  _redundant->invalidateVertexArray();
+  _next->call(&_next->glDeleteVertexArrays)(n, arrays);
+}
+
+static void REGAL_CALL redundant_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  _redundant->invalidateFramebuffers();
+  _next->call(&_next->glDeleteFramebuffers)(n, framebuffers);
+}
+
+static void REGAL_CALL redundant_glDeleteFramebuffersEXT(GLsizei n, const GLuint *framebuffers)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  _redundant->invalidateFramebuffers();
+  _next->call(&_next->glDeleteFramebuffersEXT)(n, framebuffers);
+}
+
+static void REGAL_CALL redundant_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  _redundant->invalidateBlend();
+  _next->call(&_next->glBlendEquationSeparate)(modeRGB, modeAlpha);
+}
+
+static void REGAL_CALL redundant_glBlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum modeAlpha)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  _redundant->invalidateBlend();
+  _next->call(&_next->glBlendEquationSeparatei)(buf, modeRGB, modeAlpha);
+}
+
+static void REGAL_CALL redundant_glBlendEquationi(GLuint buf, GLenum mode)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  _redundant->invalidateBlend();
+  _next->call(&_next->glBlendEquationi)(buf, mode);
+}
+
+static void REGAL_CALL redundant_glBlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  _redundant->invalidateBlend();
+  _next->call(&_next->glBlendFuncSeparatei)(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+}
+
+static void REGAL_CALL redundant_glBlendFunci(GLuint buf, GLenum src, GLenum dst)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  _redundant->invalidateBlend();
+  _next->call(&_next->glBlendFunci)(buf, src, dst);
+}
+
+static void REGAL_CALL redundant_glBlendEquationSeparateEXT(GLenum modeRGB, GLenum modeAlpha)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  _redundant->invalidateBlend();
+  _next->call(&_next->glBlendEquationSeparateEXT)(modeRGB, modeAlpha);
+}
+
+static void REGAL_CALL redundant_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  _redundant->invalidateColorMask();
+  _next->call(&_next->glColorMaski)(index, r, g, b, a);
+}
+
+static void REGAL_CALL redundant_glColorMaskIndexedEXT(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  _redundant->invalidateColorMask();
+  _next->call(&_next->glColorMaskIndexedEXT)(index, r, g, b, a);
+}
+
+static void REGAL_CALL redundant_glViewportArrayv(GLuint first, GLsizei count, const GLfloat *v)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  _redundant->invalidateViewport();
+  _next->call(&_next->glViewportArrayv)(first, count, v);
+}
+
+static void REGAL_CALL redundant_glViewportIndexedf(GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  _redundant->invalidateViewport();
+  _next->call(&_next->glViewportIndexedf)(index, x, y, w, h);
+}
+
+static void REGAL_CALL redundant_glViewportIndexedfv(GLuint index, const GLfloat *v)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  _redundant->invalidateViewport();
+  _next->call(&_next->glViewportIndexedfv)(index, v);
+}
+
+static void REGAL_CALL redundant_glScissorArrayv(GLuint first, GLsizei count, const GLint *v)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  _redundant->invalidateScissor();
+  _next->call(&_next->glScissorArrayv)(first, count, v);
+}
+
+static void REGAL_CALL redundant_glScissorIndexed(GLuint index, GLint left, GLint bottom, GLint width, GLint height)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  _redundant->invalidateScissor();
+  _next->call(&_next->glScissorIndexed)(index, left, bottom, width, height);
+}
+
+static void REGAL_CALL redundant_glScissorIndexedv(GLuint index, const GLint *v)
+{
+  RegalContext *_context = REGAL_GET_CONTEXT();
+  RegalAssert(_context);
+  DispatchTableGL *_next = _context->dispatcher.redundant.next();
+  RegalAssert(_next);
+  Redundant *_redundant = _context->redundant;
+  RegalAssert(_redundant);
+  _redundant->invalidateScissor();
+  _next->call(&_next->glScissorIndexedv)(index, v);
+}
+
+void InitDispatchTableRedundant(DispatchTableGL &tbl)
+{
+  tbl.glEnable                   = redundant_glEnable;
+  tbl.glDisable                  = redundant_glDisable;
+  tbl.glActiveTexture            = redundant_glActiveTexture;
+  tbl.glActiveTextureARB         = redundant_glActiveTextureARB;
+  tbl.glBindTexture              = redundant_glBindTexture;
+  tbl.glBindTextureEXT           = redundant_glBindTextureEXT;
+  tbl.glUseProgram               = redundant_glUseProgram;
+  tbl.glBindBuffer               = redundant_glBindBuffer;
+  tbl.glBindBufferARB            = redundant_glBindBufferARB;
+  tbl.glBindFramebuffer          = redundant_glBindFramebuffer;
+  tbl.glBindFramebufferEXT       = redundant_glBindFramebufferEXT;
+  tbl.glBindVertexArray          = redundant_glBindVertexArray;
+  tbl.glDepthFunc                = redundant_glDepthFunc;
+  tbl.glDepthMask                = redundant_glDepthMask;
+  tbl.glBlendFunc                = redundant_glBlendFunc;
+  tbl.glBlendFuncSeparate        = redundant_glBlendFuncSeparate;
+  tbl.glBlendFuncSeparateEXT     = redundant_glBlendFuncSeparateEXT;
+  tbl.glBlendEquation            = redundant_glBlendEquation;
+  tbl.glBlendEquationEXT         = redundant_glBlendEquationEXT;
+  tbl.glCullFace                 = redundant_glCullFace;
+  tbl.glFrontFace                = redundant_glFrontFace;
+  tbl.glColorMask                = redundant_glColorMask;
+  tbl.glViewport                 = redundant_glViewport;
+  tbl.glScissor                  = redundant_glScissor;
+  tbl.glClearColor               = redundant_glClearColor;
+  tbl.glNewList                  = redundant_glNewList;
+  tbl.glEndList                  = redundant_glEndList;
+  tbl.glCallList                 = redundant_glCallList;
+  tbl.glCallLists                = redundant_glCallLists;
+  tbl.glPopAttrib                = redundant_glPopAttrib;
+  tbl.glPopClientAttrib          = redundant_glPopClientAttrib;
+  tbl.glDisablei                 = redundant_glDisablei;
+  tbl.glEnablei                  = redundant_glEnablei;
+  tbl.glDisableIndexedEXT        = redundant_glDisableIndexedEXT;
+  tbl.glEnableIndexedEXT         = redundant_glEnableIndexedEXT;
+  tbl.glDeleteTextures           = redundant_glDeleteTextures;
+  tbl.glBindTextureUnit          = redundant_glBindTextureUnit;
+  tbl.glBindTextures             = redundant_glBindTextures;
+  tbl.glBindMultiTextureEXT      = redundant_glBindMultiTextureEXT;
+  tbl.glDeleteProgram            = redundant_glDeleteProgram;
+  tbl.glDeleteObjectARB          = redundant_glDeleteObjectARB;
+  tbl.glUseProgramObjectARB      = redundant_glUseProgramObjectARB;
+  tbl.glDeleteBuffers            = redundant_glDeleteBuffers;
+  tbl.glDeleteBuffersARB         = redundant_glDeleteBuffersARB;
+  tbl.glBindBuffersBase          = redundant_glBindBuffersBase;
+  tbl.glBindBuffersRange         = redundant_glBindBuffersRange;
+  tbl.glBindBufferBase           = redundant_glBindBufferBase;
+  tbl.glBindBufferRange          = redundant_glBindBufferRange;
+  tbl.glBindTransformFeedback    = redundant_glBindTransformFeedback;
+  tbl.glBindVertexArrayAPPLE     = redundant_glBindVertexArrayAPPLE;
+  tbl.glDeleteVertexArraysAPPLE  = redundant_glDeleteVertexArraysAPPLE;
+  tbl.glDeleteVertexArrays       = redundant_glDeleteVertexArrays;
+  tbl.glDeleteFramebuffers       = redundant_glDeleteFramebuffers;
+  tbl.glDeleteFramebuffersEXT    = redundant_glDeleteFramebuffersEXT;
+  tbl.glBlendEquationSeparate    = redundant_glBlendEquationSeparate;
+  tbl.glBlendEquationSeparatei   = redundant_glBlendEquationSeparatei;
+  tbl.glBlendEquationi           = redundant_glBlendEquationi;
+  tbl.glBlendFuncSeparatei       = redundant_glBlendFuncSeparatei;
+  tbl.glBlendFunci               = redundant_glBlendFunci;
+  tbl.glBlendEquationSeparateEXT = redundant_glBlendEquationSeparateEXT;
+  tbl.glColorMaski               = redundant_glColorMaski;
+  tbl.glColorMaskIndexedEXT      = redundant_glColorMaskIndexedEXT;
+  tbl.glViewportArrayv           = redundant_glViewportArrayv;
+  tbl.glViewportIndexedf         = redundant_glViewportIndexedf;
+  tbl.glViewportIndexedfv        = redundant_glViewportIndexedfv;
+  tbl.glScissorArrayv            = redundant_glScissorArrayv;
+  tbl.glScissorIndexed           = redundant_glScissorIndexed;
+  tbl.glScissorIndexedv          = redundant_glScissorIndexedv;
+}
+
+REGAL_NAMESPACE_END
+
+#endif // REGAL_REDUNDANT
@@ -61,6 +61,7 @@ Dispatcher::push_back(DispatchTable &table, bool enabled)
   table._enabled = enabled;
   table._next = NULL;
   table._prev = NULL;
+  table._lookup = &table;
 
   if (size())
   {
@@ -111,6 +112,7 @@ Dispatcher::insert(DispatchTable &other, DispatchTable &table)
   {
     table._next = &other;
     table._prev = other._prev;
+    table._lookup = &table;
     if (table._next)
       table._next->_prev = &table;
     if (table._prev)
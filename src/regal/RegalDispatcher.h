@@ -77,6 +77,16 @@ protected:
     return table._enabled;
   }
 
+  // Entries of lookup stand in for those of table when
+  // stepping down the stack.  Calling table directly,
+  // or starting a lookup from it, is unaffected.
+
+  inline void
+  setLookup(DispatchTable &table, DispatchTable &lookup)
+  {
+    table._lookup = &lookup;
+  }
+
   inline DispatchTable &operator[](const std::size_t i)
   {
     RegalAssert(i<size());
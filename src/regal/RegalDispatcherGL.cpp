@@ -37,6 +37,7 @@ REGAL_GLOBAL_BEGIN
 
 #include <algorithm>
 
+#include "RegalLog.h"
 #include "RegalConfig.h"
 #include "RegalDispatcherGL.h"
 
@@ -49,6 +50,15 @@ REGAL_NAMESPACE_BEGIN
 DispatcherGL::DispatcherGL()
 : Dispatcher()
 {
+  ::memset(&compiled,0,sizeof(DispatchTableGL));
+  push_back(compiled,false);
+
+  #if REGAL_STATISTICS
+  ::memset(&timing,0,sizeof(DispatchTableGL));
+  InitDispatchTableTiming(timing);
+  push_back(timing,Config::enableStatistics && Config::dispatchTiming);
+  #endif
+
   #if REGAL_TRACE
   ::memset(&trace,0,sizeof(DispatchTableGL));
   InitDispatchTableTrace(trace);
@@ -73,6 +83,7 @@ DispatcherGL::DispatcherGL()
 
   #if REGAL_EMULATION
   ::memset(&emulation,0,sizeof(DispatchTableGL));
+  ::memset(&emulationRoute,0,sizeof(DispatchTableGL));
   InitDispatchTableEmu(emulation);               // emulated functions only
   push_back(emulation,Config::enableEmulation || Config::forceEmulation);
   #endif
@@ -83,6 +94,12 @@ DispatcherGL::DispatcherGL()
   push_back(cache,true);
   #endif
 
+  #if REGAL_REDUNDANT
+  ::memset(&redundant,0,sizeof(DispatchTableGL));
+  InitDispatchTableRedundant(redundant);
+  push_back(redundant,Config::enableRedundant);
+  #endif
+
   #if REGAL_CODE
   ::memset(&code,0,sizeof(DispatchTableGL));
   InitDispatchTableCode(code);
@@ -100,6 +117,12 @@ DispatcherGL::DispatcherGL()
   push_back(logging,Config::enableLog);
   #endif
 
+  #if REGAL_LOG_BINARY
+  ::memset(&binaryLog,0,sizeof(DispatchTableGL));
+  InitDispatchTableBinaryLog(binaryLog);
+  push_back(binaryLog,Logging::binary);
+  #endif
+
   #if REGAL_DRIVER
   #if REGAL_STATIC_ES2
   ::memset(&driver,0,sizeof(DispatchTableGL));
@@ -125,10 +148,52 @@ DispatcherGL::DispatcherGL()
   if (erase(error))
     insert(cache,error);
   #endif
+
+  if (Config::dispatchCompiled)
+    enable(compiled);
 }
 
 DispatcherGL::~DispatcherGL()
 {
 }
 
+// Entry points start at the front of the stack, so the compiled
+// table only needs to be correct while it is enabled.  Entries are
+// looked up exactly as Dispatch::call would from the next table.
+
+void *
+DispatcherGL::resolve(const std::size_t offset)
+{
+  for (DispatchTableGL *i = compiled.next(); i; i = i->next())
+  {
+    DispatchTableGL *lookup = i->_lookup ? static_cast<DispatchTableGL *>(i->_lookup) : i;
+    void *func = reinterpret_cast<void **>(static_cast<Dispatch::GL *>(lookup))[offset];
+    if (i->_enabled && func)
+      return func;
+  }
+  return NULL;
+}
+
+void
+DispatcherGL::compile()
+{
+  if (!size() || !isEnabled(compiled))
+    return;
+
+  void **func = reinterpret_cast<void **>(static_cast<Dispatch::GL *>(&compiled));
+  for (std::size_t i=0; i<sizeof(Dispatch::GL)/sizeof(void *); ++i)
+    func[i] = resolve(i);
+}
+
+void
+DispatcherGL::update(DispatchTableGL &table, void (**func)())
+{
+  if (!size() || !isEnabled(compiled))
+    return;
+
+  const std::size_t offset = reinterpret_cast<void **>(func) - reinterpret_cast<void **>(static_cast<Dispatch::GL *>(&table));
+  RegalAssert(offset<sizeof(Dispatch::GL)/sizeof(void *));
+  reinterpret_cast<void **>(static_cast<Dispatch::GL *>(&compiled))[offset] = resolve(offset);
+}
+
 REGAL_NAMESPACE_END
@@ -42,10 +42,18 @@ REGAL_GLOBAL_END
 
 REGAL_NAMESPACE_BEGIN
 
+struct RegalContext;
+
 struct DispatcherGL : public Dispatcher
 {
 public:
 
+   // With Config::dispatchCompiled, each entry of the front table
+   // points directly at the first enabled layer that provides it,
+   // rather than stepping down the stack on every call.
+
+   DispatchTableGL compiled;
+
 #if REGAL_HTTP
   DispatchTableGL http;
 #endif
@@ -60,17 +68,23 @@ public:
 
 #if REGAL_EMULATION
    DispatchTableGL emulation;
+   DispatchTableGL emulationRoute;  // Emulation entries acted on by the active layers
 #endif
 
 #if REGAL_CACHE
    DispatchTableGL cache;
 #endif
 
+#if REGAL_REDUNDANT
+   DispatchTableGL redundant;
+#endif
+
 #if REGAL_CODE
    DispatchTableGL code;
 #endif
 
 #if REGAL_STATISTICS
+   DispatchTableGL timing;      // Front of the stack, for per-call timing
    DispatchTableGL statistics;
 #endif
 
@@ -78,6 +92,10 @@ public:
    DispatchTableGL logging;
 #endif
 
+#if REGAL_LOG_BINARY
+   DispatchTableGL binaryLog;
+#endif
+
 #if REGAL_TRACE
    DispatchTableGL trace;
 #endif
@@ -100,30 +118,49 @@ public:
     #endif
 
     Dispatcher::push_back(table,enable);
+    compile();
   }
 
-  inline bool erase    (DispatchTableGL &table)                         { return Dispatcher::erase(table); }
-  inline bool insert   (DispatchTableGL &other, DispatchTableGL &table) { return Dispatcher::insert(other,table); }
+  inline bool erase    (DispatchTableGL &table)                         { const bool ok = Dispatcher::erase(table);        compile(); return ok; }
+  inline bool insert   (DispatchTableGL &other, DispatchTableGL &table) { const bool ok = Dispatcher::insert(other,table); compile(); return ok; }
 
-  inline void enable (DispatchTableGL &table)             { Dispatcher::enable (table); }
-  inline void disable(DispatchTableGL &table)             { Dispatcher::disable(table); }
+  inline void enable (DispatchTableGL &table)             { Dispatcher::enable (table); compile(); }
+  inline void disable(DispatchTableGL &table)             { Dispatcher::disable(table); compile(); }
 
   inline bool isEnabled(DispatchTableGL &table) const     { return Dispatcher::isEnabled(table); }
 
+  inline void setLookup(DispatchTableGL &table, DispatchTableGL &lookup) { Dispatcher::setLookup(table,lookup); compile(); }
+
   inline DispatchTableGL &operator[](const std::size_t i) { return reinterpret_cast<DispatchTableGL &>(Dispatcher::operator[](i)); }
   inline DispatchTableGL &front()                         { return reinterpret_cast<DispatchTableGL &>(Dispatcher::front());       }
   inline DispatchTableGL &back()                          { return reinterpret_cast<DispatchTableGL &>(Dispatcher::back());        }
+
+  // Rebuild the compiled table, if enabled
+
+  void compile();
+
+  // Follow a change to a single entry of one of the tables,
+  // such as the lazy loader resolving a driver function.
+
+  void update(DispatchTableGL &table, void (**func)());
+
+private:
+  void *resolve(const std::size_t offset);
 };
 
 // regaltest needs these declarations too
 
+extern void InitDispatchTableBinaryLog (DispatchTableGL &tbl);
 extern void InitDispatchTableCode      (DispatchTableGL &tbl);
 extern void InitDispatchTableDebug     (DispatchTableGL &tbl);
 extern void InitDispatchTableError     (DispatchTableGL &tbl);
 extern void InitDispatchTableEmu       (DispatchTableGL &tbl);
+extern void InitDispatchTableEmuRoute  (RegalContext &ctx, DispatchTableGL &tbl);
 extern void InitDispatchTableLog       (DispatchTableGL &tbl);
 extern void InitDispatchTablePpapi     (DispatchTableGL &tbl);
+extern void InitDispatchTableRedundant (DispatchTableGL &tbl);
 extern void InitDispatchTableStatistics(DispatchTableGL &tbl);
+extern void InitDispatchTableTiming    (DispatchTableGL &tbl);
 extern void InitDispatchTableStaticES2 (DispatchTableGL &tbl);
 extern void InitDispatchTableCache     (DispatchTableGL &tbl);
 extern void InitDispatchTableTrace     (DispatchTableGL &tbl);
@@ -52,6 +52,26 @@ REGAL_NAMESPACE_BEGIN
 #define REGAL_DSA_NUM_BUFFER_TYPES 2
 #define REGAL_DSA_INVALID 0xffffffff
 
+// Dsa::dirty bits, one per category of DSA-modified binding.
+// A bit is set exactly when the corresponding dsa cache entry is valid.
+
+#define REGAL_DSA_DIRTY_MATRIX_MODE           (1u<<0)
+#define REGAL_DSA_DIRTY_ACTIVE_TEXTURE        (1u<<1)
+#define REGAL_DSA_DIRTY_CLIENT_ACTIVE_TEXTURE (1u<<2)
+#define REGAL_DSA_DIRTY_GLSL_PROGRAM          (1u<<3)
+#define REGAL_DSA_DIRTY_FRAMEBUFFER           (1u<<4)
+#define REGAL_DSA_DIRTY_RENDERBUFFER          (1u<<5)
+#define REGAL_DSA_DIRTY_VAO                   (1u<<6)
+#define REGAL_DSA_DIRTY_BUFFER                (1u<<7)
+#define REGAL_DSA_DIRTY_TEXTURE               (1u<<8)
+#define REGAL_DSA_DIRTY_ASM_PROGRAM_SHIFT     9
+#define REGAL_DSA_DIRTY_ASM_PROGRAM(i)        (1u<<(REGAL_DSA_DIRTY_ASM_PROGRAM_SHIFT+(i)))
+#define REGAL_DSA_DIRTY_ASM_PROGRAMS          (((1u<<REGAL_DSA_NUM_ASM_PROG_TYPES)-1)<<REGAL_DSA_DIRTY_ASM_PROGRAM_SHIFT)
+
+// Categories restored by Dsa::Restore ahead of a draw
+
+#define REGAL_DSA_DIRTY_RESTORE (~REGAL_DSA_DIRTY_RENDERBUFFER)
+
 namespace Emu {
 
 template<typename T> inline void DsaGetv( DispatchTableGL & tbl, GLenum pname, T * params ) { UNUSED_PARAMETER(tbl); UNUSED_PARAMETER(pname); UNUSED_PARAMETER(params);}
@@ -62,6 +82,7 @@ template<> inline void DsaGetv( DispatchTableGL & tbl, GLenum pname, GLdouble *
 struct Dsa
 {
     int callDepth;
+    GLuint dirty;    // REGAL_DSA_DIRTY_* bits
     struct Cache {
         GLenum matrixMode;
         GLenum activeTexture;
@@ -85,6 +106,7 @@ struct Dsa
         UNUSED_PARAMETER(ctx);
 
         callDepth = 0;
+        dirty = 0;
         drv.matrixMode = GL_MODELVIEW;
         drv.activeTexture = GL_TEXTURE0;
         drv.clientActiveTexture = GL_TEXTURE0;
@@ -123,20 +145,41 @@ struct Dsa
         UNUSED_PARAMETER(ctx);
     }
 
+    // Called ahead of every draw.  Nothing to do unless a DSA call
+    // has modified some binding since the previous restore.
+
     void Restore( RegalContext * ctx ) {
-        RestoreMatrixMode( ctx );
-        RestoreGlslProgram( ctx );
-        RestoreFramebuffer( ctx );
-        RestoreAsmProgram( ctx, GL_VERTEX_PROGRAM_ARB );
-        RestoreAsmProgram( ctx, GL_FRAGMENT_PROGRAM_ARB );
-        RestoreAsmProgram( ctx, GL_GEOMETRY_PROGRAM_NV );
-        RestoreAsmProgram( ctx, GL_TESS_CONTROL_PROGRAM_NV );
-        RestoreAsmProgram( ctx, GL_TESS_EVALUATION_PROGRAM_NV );
-        RestoreVao( ctx );
-        RestoreBuffer( ctx );
-        RestoreTexture( ctx );
-        RestoreActiveTexture( ctx );  // flushTexture() may dirty this
-        RestoreClientActiveTexture( ctx );
+        if( !( dirty & REGAL_DSA_DIRTY_RESTORE ) ) {
+            return;
+        }
+        if( dirty & REGAL_DSA_DIRTY_MATRIX_MODE ) {
+            RestoreMatrixMode( ctx );
+        }
+        if( dirty & REGAL_DSA_DIRTY_GLSL_PROGRAM ) {
+            RestoreGlslProgram( ctx );
+        }
+        if( dirty & REGAL_DSA_DIRTY_FRAMEBUFFER ) {
+            RestoreFramebuffer( ctx );
+        }
+        while( dirty & REGAL_DSA_DIRTY_ASM_PROGRAMS ) {
+            GLuint i = lowestBit( dirty & REGAL_DSA_DIRTY_ASM_PROGRAMS ) - REGAL_DSA_DIRTY_ASM_PROGRAM_SHIFT;
+            RestoreAsmProgram( ctx, IndexToAsmTarget( i ) );
+        }
+        if( dirty & REGAL_DSA_DIRTY_VAO ) {
+            RestoreVao( ctx );
+        }
+        if( dirty & REGAL_DSA_DIRTY_BUFFER ) {
+            RestoreBuffer( ctx );
+        }
+        if( dirty & REGAL_DSA_DIRTY_TEXTURE ) {
+            RestoreTexture( ctx );
+        }
+        if( dirty & REGAL_DSA_DIRTY_ACTIVE_TEXTURE ) {
+            RestoreActiveTexture( ctx );  // flushTexture() may dirty this
+        }
+        if( dirty & REGAL_DSA_DIRTY_CLIENT_ACTIVE_TEXTURE ) {
+            RestoreClientActiveTexture( ctx );
+        }
     }
 
 
@@ -153,6 +196,7 @@ struct Dsa
     void DsaMatrixMode( RegalContext * ctx, GLenum mode ) {
         if( NotMatrixMode( mode ) ) {
             dsa.matrixMode = mode;
+            dirty |= REGAL_DSA_DIRTY_MATRIX_MODE;
             switch( mode ) {
                 //<>  dsn: wtf?  Why are these accepted?  And why only up to GL_TEXTURE3?
                 case GL_TEXTURE0: case GL_TEXTURE1: case GL_TEXTURE2: case GL_TEXTURE3:
@@ -168,6 +212,7 @@ struct Dsa
             ctx->dispatcher.emulation.glMatrixMode( drv.matrixMode );
             RestoreActiveTexture( ctx );
             dsa.matrixMode = REGAL_DSA_INVALID;
+            dirty &= ~REGAL_DSA_DIRTY_MATRIX_MODE;
         }
     }
 
@@ -187,6 +232,7 @@ struct Dsa
             return;
         if( NotActiveTexture( tex ) ) {
             dsa.activeTexture = tex;
+            dirty |= REGAL_DSA_DIRTY_ACTIVE_TEXTURE;
             ctx->dispatcher.emulation.glActiveTexture( dsa.activeTexture );
         }
     }
@@ -194,6 +240,7 @@ struct Dsa
         if( dsa.activeTexture != REGAL_DSA_INVALID ) {
             ctx->dispatcher.emulation.glActiveTexture( drv.activeTexture );
             dsa.activeTexture = REGAL_DSA_INVALID;
+            dirty &= ~REGAL_DSA_DIRTY_ACTIVE_TEXTURE;
         }
     }
 
@@ -208,6 +255,7 @@ struct Dsa
     void DsaClientActiveTexture( RegalContext * ctx, GLenum tex ) {
         if( NotClientActiveTexture( tex ) ) {
             dsa.clientActiveTexture = tex;
+            dirty |= REGAL_DSA_DIRTY_CLIENT_ACTIVE_TEXTURE;
             ctx->dispatcher.emulation.glClientActiveTexture( dsa.clientActiveTexture );
         }
     }
@@ -215,6 +263,7 @@ struct Dsa
         if( dsa.clientActiveTexture != REGAL_DSA_INVALID ) {
             ctx->dispatcher.emulation.glClientActiveTexture( drv.clientActiveTexture );
             dsa.clientActiveTexture = REGAL_DSA_INVALID;
+            dirty &= ~REGAL_DSA_DIRTY_CLIENT_ACTIVE_TEXTURE;
         }
     }
 
@@ -229,6 +278,7 @@ struct Dsa
     void DsaGlslProgram( RegalContext * ctx, GLuint program ) {
         if( NotGlslProgram( program ) ) {
             dsa.glslProgram = program;
+            dirty |= REGAL_DSA_DIRTY_GLSL_PROGRAM;
             ctx->dispatcher.emulation.glUseProgram( dsa.glslProgram );
         }
     }
@@ -236,6 +286,7 @@ struct Dsa
         if( dsa.glslProgram != REGAL_DSA_INVALID ) {
             ctx->dispatcher.emulation.glUseProgram( drv.glslProgram );
             dsa.glslProgram = REGAL_DSA_INVALID;
+            dirty &= ~REGAL_DSA_DIRTY_GLSL_PROGRAM;
         }
     }
     void DeleteGlslProgram( RegalContext * ctx, GLuint program ) {
@@ -261,6 +312,7 @@ struct Dsa
         if( NotFramebuffer( target, framebuffer ) ) {
             dsa.framebufferTarget = target;
             dsa.framebuffer = framebuffer;
+            dirty |= REGAL_DSA_DIRTY_FRAMEBUFFER;
             ctx->dispatcher.emulation.glBindFramebuffer( dsa.framebufferTarget, dsa.framebuffer );
         }
     }
@@ -269,6 +321,7 @@ struct Dsa
             ctx->dispatcher.emulation.glBindFramebuffer( drv.framebufferTarget, drv.framebuffer );
             dsa.framebufferTarget = REGAL_DSA_INVALID;
             dsa.framebuffer = REGAL_DSA_INVALID;
+            dirty &= ~REGAL_DSA_DIRTY_FRAMEBUFFER;
         }
     }
     void DeleteFramebuffers( RegalContext * ctx, GLsizei n, const GLuint * framebuffers ) {
@@ -295,6 +348,7 @@ struct Dsa
         if( NotRenderbuffer( target, renderbuffer ) ) {
             dsa.renderbufferTarget = target;
             dsa.renderbuffer = renderbuffer;
+            dirty |= REGAL_DSA_DIRTY_RENDERBUFFER;
             ctx->dispatcher.emulation.glBindRenderbuffer( dsa.renderbufferTarget, dsa.renderbuffer );
         }
     }
@@ -303,6 +357,7 @@ struct Dsa
             ctx->dispatcher.emulation.glBindRenderbuffer( drv.renderbufferTarget, drv.renderbuffer );
             dsa.renderbufferTarget = REGAL_DSA_INVALID;
             dsa.renderbuffer = REGAL_DSA_INVALID;
+            dirty &= ~REGAL_DSA_DIRTY_RENDERBUFFER;
         }
     }
     void DeleteRenderbuffers( RegalContext * ctx, GLsizei n, const GLuint *renderbuffers ) {
@@ -353,6 +408,7 @@ struct Dsa
         int idx = AsmTargetIndex( target );
         if( NotAsmProgram( target, prog ) ) {
             dsa.asmProgram[idx] = prog;
+            dirty |= REGAL_DSA_DIRTY_ASM_PROGRAM(idx);
             ctx->dispatcher.emulation.glBindProgramARB( target, dsa.asmProgram[idx] );
         }
     }
@@ -361,6 +417,7 @@ struct Dsa
         if( dsa.asmProgram[idx] != REGAL_DSA_INVALID ) {
             ctx->dispatcher.emulation.glBindProgramARB( target, drv.asmProgram[idx] );
             dsa.asmProgram[idx] = REGAL_DSA_INVALID;
+            dirty &= ~REGAL_DSA_DIRTY_ASM_PROGRAM(idx);
         }
     }
     void DeleteAsmPrograms( RegalContext * ctx, GLsizei n, const GLuint *progs ) {
@@ -390,6 +447,7 @@ struct Dsa
     void DsaVao( RegalContext * ctx, GLuint vao ) {
         if( NotVao( vao ) ) {
             dsa.vao = vao;
+            dirty |= REGAL_DSA_DIRTY_VAO;
             ctx->dispatcher.emulation.glBindVertexArray( dsa.vao );
         }
     }
@@ -397,6 +455,7 @@ struct Dsa
         if( dsa.vao != REGAL_DSA_INVALID ) {
             ctx->dispatcher.emulation.glBindVertexArray( drv.vao );
             dsa.vao = REGAL_DSA_INVALID;
+            dirty &= ~REGAL_DSA_DIRTY_VAO;
         }
     }
     void DeleteVaos( RegalContext * ctx, GLsizei n, const GLuint * arrays ) {
@@ -424,6 +483,7 @@ struct Dsa
     void DsaBuffer( RegalContext * ctx, GLuint buf ) {
         if( NotBuffer( buf ) ) {
             dsa.buffer = buf;
+            dirty |= REGAL_DSA_DIRTY_BUFFER;
             ctx->dispatcher.emulation.glBindBuffer( GL_ARRAY_BUFFER, dsa.buffer );
         }
     }
@@ -431,6 +491,7 @@ struct Dsa
         if( dsa.buffer != REGAL_DSA_INVALID ) {
             ctx->dispatcher.emulation.glBindBuffer( GL_ARRAY_BUFFER, drv.buffer );
             dsa.buffer = REGAL_DSA_INVALID;
+            dirty &= ~REGAL_DSA_DIRTY_BUFFER;
         }
     }
     void DeleteBuffers( RegalContext * ctx, GLsizei n, const GLuint * buffers ) {
@@ -478,6 +539,7 @@ struct Dsa
         if( NotTexture( target, texture ) ) {
             dsa.textureTarget = target;
             dsa.texture = texture;
+            dirty |= REGAL_DSA_DIRTY_TEXTURE;
             DsaActiveTexture( ctx, GL_TEXTURE0 );
             ctx->dispatcher.emulation.glBindTexture( dsa.textureTarget, dsa.texture );
         }
@@ -488,6 +550,7 @@ struct Dsa
             ctx->dispatcher.emulation.glBindTexture( drv.textureTarget, drv.texture );
             dsa.textureTarget = REGAL_DSA_INVALID;
             dsa.texture = REGAL_DSA_INVALID;
+            dirty &= ~REGAL_DSA_DIRTY_TEXTURE;
         }
     }
     void DeleteTextures( RegalContext * ctx, GLsizei n, const GLuint *textures ) {
@@ -44,6 +44,10 @@ REGAL_GLOBAL_BEGIN
 
 #include <GL/Regal.h>
 
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
 REGAL_GLOBAL_END
 
 REGAL_NAMESPACE_BEGIN
@@ -115,6 +119,46 @@ namespace Emu
 extern bool validTextureEnum(GLenum texture);
 extern bool validTextureUnit(GLuint unit);
 
+// Index of the lowest set bit of a non-zero mask, for visiting
+// only the set bits of a dirty mask.
+
+inline GLuint lowestBit(GLuint64 mask)
+{
+  RegalAssert(mask);
+#if defined(__GNUC__)
+  return static_cast<GLuint>(__builtin_ctzll(mask));
+#elif defined(_MSC_VER) && defined(_WIN64)
+  unsigned long i;
+  _BitScanForward64(&i, mask);
+  return static_cast<GLuint>(i);
+#else
+  GLuint i = 0;
+  for (; !(mask & 1); mask >>= 1)
+    ++i;
+  return i;
+#endif
+}
+
+// Index of the highest set bit of a non-zero mask, for visiting
+// the set bits in descending order.
+
+inline GLuint highestBit(GLuint64 mask)
+{
+  RegalAssert(mask);
+#if defined(__GNUC__)
+  return static_cast<GLuint>(63 - __builtin_clzll(mask));
+#elif defined(_MSC_VER) && defined(_WIN64)
+  unsigned long i;
+  _BitScanReverse64(&i, mask);
+  return static_cast<GLuint>(i);
+#else
+  GLuint i = 0;
+  for (; mask >>= 1; )
+    ++i;
+  return i;
+#endif
+}
+
 #endif // REGAL_EMULATION
 
 };
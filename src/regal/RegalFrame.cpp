@@ -38,6 +38,9 @@ REGAL_GLOBAL_BEGIN
 
 #include "md5.h"
 
+#include <cstring>
+#include <vector>
+
 #if !REGAL_NO_PNG
 #include <zlib.h>
 #include <png.h>
@@ -49,11 +52,118 @@ using ::boost::print::print_string;
 
 #include "RegalFrame.h"
 #include "RegalStatistics.h"
+#include "RegalCallTiming.h"
+#include "RegalGpuTiming.h"
+#include "RegalContextInfo.h"
 
 REGAL_GLOBAL_END
 
 REGAL_NAMESPACE_BEGIN
 
+#if !REGAL_NO_PNG
+static void savePNG(const size_t frame, const GLint width, const GLint height, const GLbyte *buffer)
+{
+  static png_color_8 pngSBIT = {8, 8, 8, 0, 8};
+
+  string filename = print_string(Config::frameSaveColorPrefix,boost::print::right(frame,3,'0'),".png");
+  FILE *fp = fopen(filename.c_str(), "wb");
+  if (fp)
+  {
+    png_structp pngPtr = png_create_write_struct(PNG_LIBPNG_VER_STRING,NULL,NULL,NULL);
+    if (pngPtr)
+    {
+      png_infop pngInfo = png_create_info_struct(pngPtr);
+      if (pngInfo)
+      {
+        png_init_io(pngPtr, fp);
+
+        // Z_NO_COMPRESSION, Z_BEST_SPEED, Z_BEST_COMPRESSION,
+        // Z_DEFAULT_COMPRESSION
+
+        png_set_compression_level(pngPtr, Z_BEST_COMPRESSION);
+        png_set_IHDR(pngPtr, pngInfo, width, height,
+                     8, PNG_COLOR_TYPE_RGBA, PNG_INTERLACE_NONE,
+                     PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
+        png_set_pHYs(pngPtr, pngInfo, 72 * 40, 72 * 40, PNG_RESOLUTION_METER);
+        png_set_sBIT(pngPtr, pngInfo, &pngSBIT);
+        png_write_info(pngPtr, pngInfo);
+        for (int y = height; y--; )
+          png_write_row(pngPtr, reinterpret_cast<png_byte *>(const_cast<GLbyte *>(buffer) + y * width * 4));
+        png_write_end(pngPtr, pngInfo);
+      }
+      png_destroy_write_struct(&pngPtr, &pngInfo);
+    }
+    fclose(fp);
+  }
+}
+#endif
+
+// Apply masking, compute pixel md5sum and log it
+
+static void md5Color(GLbyte *buffer, const size_t bufferSize, const unsigned char mask, const size_t frame, const bool async)
+{
+  for (size_t i=0; i<bufferSize; ++i)
+    buffer[i] &= mask;
+
+  MD5Context md5c;
+  MD5Init(&md5c);
+  MD5Update(&md5c, reinterpret_cast<const unsigned char *>(buffer), bufferSize);
+
+  unsigned char digest[16];
+  MD5Final(digest, &md5c);
+
+  // Convert md5sum to string
+
+  char md5sum[sizeof(digest)*2+1];
+  for (size_t i=0; i<sizeof(digest); ++i)
+    sprintf(md5sum+i*2,"%02x",digest[i]);
+
+  // Background md5s may complete out of order, so identify the frame
+
+  if (async)
+  {
+    Info("Color md5sum ",md5sum," frame ",frame);
+  }
+  else
+  {
+    Info("Color md5sum ",md5sum);
+  }
+}
+
+// Background processing of one captured frame
+
+struct FrameJob : public Thread::Job
+{
+  FrameJob(const size_t f, const GLint w, const GLint h, const GLbyte *pixels)
+  : frame(f),
+    width(w),
+    height(h),
+    save(Config::frameSaveColor),
+    md5(Config::frameMd5Color),
+    mask(Config::frameMd5ColorMask),
+    buffer(pixels, pixels + width*height*4)
+  {
+  }
+
+  void run()
+  {
+#if !REGAL_NO_PNG
+    if (save)
+      savePNG(frame, width, height, &buffer[0]);
+#endif
+    if (md5)
+      md5Color(&buffer[0], buffer.size(), mask, frame, true);
+  }
+
+  size_t              frame;
+  GLint               width;
+  GLint               height;
+  bool                save;
+  bool                md5;
+  unsigned char       mask;
+  std::vector<GLbyte> buffer;
+};
+
 void Frame::capture(RegalContext &context,const bool frameTerminator)
 {
   Internal("Regal::Frame::capture context=",boost::print::optional(&context,Logging::pointers));
@@ -88,6 +198,14 @@ void Frame::capture(RegalContext &context,const bool frameTerminator)
       }
       #endif
     }
+
+    #if REGAL_STATISTICS
+    if (context.statistics && context.statistics->timing)
+      context.statistics->timing->frame();
+    #endif
+
+    if (Config::frameGpuTiming && (gpuTiming || startGpuTiming(context)))
+      gpuTiming->frame(context, frame);
   }
 
   if
@@ -116,81 +234,28 @@ void Frame::capture(RegalContext &context,const bool frameTerminator)
     {
       if (Config::frameMd5Color || Config::frameSaveColor)
       {
-        // Read the pixels as RGBA
-
-        const GLint bufferSize = width*height*4*sizeof(GLbyte);
-        GLbyte *buffer = (GLbyte *) calloc(bufferSize,1);
+        if (Config::frameAsync && asyncSupported(context))
+          readback(context, width, height);
+        else
+        {
+          // Read the pixels as RGBA
 
-//       _next->call(&_next->glReadBuffer)(GL_FRONT);
-       _next->call(&_next->glReadPixels)(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, buffer);
+          const GLint bufferSize = width*height*4*sizeof(GLbyte);
+          GLbyte *buffer = (GLbyte *) calloc(bufferSize,1);
 
-        // Do once we have the pixels, could we do the rest in another
-        // thread?
+//        _next->call(&_next->glReadBuffer)(GL_FRONT);
+          _next->call(&_next->glReadPixels)(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, buffer);
 
 #if !REGAL_NO_PNG
-        if (Config::frameSaveColor)
-        {
-          static png_color_8 pngSBIT = {8, 8, 8, 0, 8};
-
-          string filename = print_string(Config::frameSaveColorPrefix,boost::print::right(frame,3,'0'),".png");
-          FILE *fp = fopen(filename.c_str(), "wb");
-          if (fp)
-          {
-            png_structp pngPtr = png_create_write_struct(PNG_LIBPNG_VER_STRING,NULL,NULL,NULL);
-            if (pngPtr)
-            {
-              png_infop pngInfo = png_create_info_struct(pngPtr);
-              if (pngInfo)
-              {
-                png_init_io(pngPtr, fp);
-
-                // Z_NO_COMPRESSION, Z_BEST_SPEED, Z_BEST_COMPRESSION,
-                // Z_DEFAULT_COMPRESSION
-
-                png_set_compression_level(pngPtr, Z_BEST_COMPRESSION);
-                png_set_IHDR(pngPtr, pngInfo, width, height,
-                             8, PNG_COLOR_TYPE_RGBA, PNG_INTERLACE_NONE,
-                             PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
-                png_set_pHYs(pngPtr, pngInfo, 72 * 40, 72 * 40, PNG_RESOLUTION_METER);
-                png_set_sBIT(pngPtr, pngInfo, &pngSBIT);
-                png_write_info(pngPtr, pngInfo);
-                for (int y = height; y--; )
-                  png_write_row(pngPtr, reinterpret_cast<png_byte *>(buffer + y * width * 4));
-                png_write_end(pngPtr, pngInfo);
-              }
-              png_destroy_write_struct(&pngPtr, &pngInfo);
-            }
-            fclose(fp);
-          }
-        }
+          if (Config::frameSaveColor)
+            savePNG(frame, width, height, buffer);
 #endif
 
-        if (Config::frameMd5Color)
-        {
-          // Apply masking
-
-          for (GLint i=0; i<bufferSize; ++i)
-            buffer[i] &= Config::frameMd5ColorMask;
-
-          // Compute pixel md5sum
-
-          MD5Context md5c;
-          MD5Init(&md5c);
-          MD5Update(&md5c, reinterpret_cast<const unsigned char *>(buffer), bufferSize);
+          if (Config::frameMd5Color)
+            md5Color(buffer, bufferSize, Config::frameMd5ColorMask, frame, false);
 
-          unsigned char digest[16];
-          MD5Final(digest, &md5c);
-
-          // Convert md5sum to string
-
-          char md5sum[sizeof(digest)*2+1];
-          for (size_t i=0; i<sizeof(digest); ++i)
-            sprintf(md5sum+i*2,"%02x",digest[i]);
-
-          Info("Color md5sum ",md5sum);
+          free(buffer);
         }
-
-        free(buffer);
       }
     }
   }
@@ -200,8 +265,191 @@ void Frame::capture(RegalContext &context,const bool frameTerminator)
     // Exit from the application if Config::frameLimit is reached.
 
     if ( Config::frameLimit>0 && frame>=size_t(Config::frameLimit))
+    {
+      flush(context);
       exit(0);
+    }
+  }
+}
+
+void Frame::Cleanup(RegalContext &context)
+{
+  Internal("Regal::Frame::Cleanup","()");
+
+  release(context);
+
+  if (gpuTiming)
+  {
+    gpuTiming->Cleanup(context);
+    gpuTiming = NULL;
+  }
+}
+
+// Finish pending readbacks and delete their buffers
+
+void Frame::release(RegalContext &context)
+{
+  flush(context);
+
+  DispatchTableGL *_next = &context.dispatcher.front();
+  RegalAssert(_next);
+
+  for (size_t i=0; i<readbacks.size(); ++i)
+    if (readbacks[i].buffer)
+      _next->call(&_next->glDeleteBuffers)(1, &readbacks[i].buffer);
+
+  readbacks.clear();
+  readbackNext = 0;
+}
+
+// Pixel pack buffers and fences are needed for asynchronous readback
+
+bool Frame::asyncSupported(RegalContext &context)
+{
+  if (!context.info)
+    return false;
+
+  const ContextInfo &info = *context.info;
+
+  if (context.isES2())
+    return info.gles_version_major>=3;
+
+  return (info.gl_version_3_2 || info.gl_arb_sync) &&
+         (info.gl_version_3_0 || info.gl_arb_map_buffer_range) &&
+         (info.gl_version_2_1 || info.gl_arb_pixel_buffer_object);
+}
+
+// Timer queries are created on first use, if supported
+
+bool Frame::startGpuTiming(RegalContext &context)
+{
+  if (gpuTimingChecked)
+    return false;
+  gpuTimingChecked = true;
+
+  if (!GpuTiming::supported(context))
+  {
+    Warning("Regal::Frame GPU timing needs GL 3.3 or GL_ARB_timer_query, REGAL_FRAME_GPU_TIMING ignored.");
+    return false;
+  }
+
+  gpuTiming = new GpuTiming();
+  return true;
+}
+
+// Start reading the current frame into the next buffer of the ring,
+// handing over whatever that buffer held before.
+
+void Frame::readback(RegalContext &context, const GLint width, const GLint height)
+{
+  Internal("Regal::Frame::readback","width=",width," height=",height);
+
+  DispatchTableGL *_next = &context.dispatcher.front();
+  RegalAssert(_next);
+
+  const size_t latency = size_t(Config::frameAsyncLatency>0 ? Config::frameAsyncLatency : 1);
+  if (readbacks.size()!=latency)
+  {
+    release(context);
+    Readback empty = { 0, 0, 0, 0, 0, 0 };
+    readbacks.resize(latency, empty);
+  }
+
+  if (!workers)
+    workers = new Thread::WorkQueue(size_t(Config::frameAsyncThreads>0 ? Config::frameAsyncThreads : 0),
+                                    size_t(Config::frameAsyncQueue>0   ? Config::frameAsyncQueue   : 0));
+
+  Readback &r = readbacks[readbackNext];
+  readbackNext = (readbackNext+1)%readbacks.size();
+
+  if (r.fence)
+    resolve(context, r);
+
+  GLint pack = 0;
+  _next->call(&_next->glGetIntegerv)(GL_PIXEL_PACK_BUFFER_BINDING, &pack);
+
+  if (!r.buffer)
+    _next->call(&_next->glGenBuffers)(1, &r.buffer);
+  _next->call(&_next->glBindBuffer)(GL_PIXEL_PACK_BUFFER, r.buffer);
+
+  const GLsizeiptr size = GLsizeiptr(width)*height*4;
+  if (r.size!=size)
+  {
+    _next->call(&_next->glBufferData)(GL_PIXEL_PACK_BUFFER, size, NULL, GL_STREAM_READ);
+    r.size = size;
+  }
+
+  _next->call(&_next->glReadPixels)(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+  r.fence  = _next->call(&_next->glFenceSync)(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  r.frame  = frame;
+  r.width  = width;
+  r.height = height;
+
+  _next->call(&_next->glBindBuffer)(GL_PIXEL_PACK_BUFFER, pack);
+}
+
+// Wait for a pending readback, copy the pixels out and queue them for the workers
+
+void Frame::resolve(RegalContext &context, Readback &r)
+{
+  Internal("Regal::Frame::resolve","frame=",r.frame);
+
+  RegalAssert(r.fence);
+
+  DispatchTableGL *_next = &context.dispatcher.front();
+  RegalAssert(_next);
+
+  // Typically already signalled, since a few frames have passed
+
+  GLenum status = GL_TIMEOUT_EXPIRED;
+  while (status==GL_TIMEOUT_EXPIRED)
+    status = _next->call(&_next->glClientWaitSync)(r.fence, GL_SYNC_FLUSH_COMMANDS_BIT, GLuint64(1000000000));
+  _next->call(&_next->glDeleteSync)(r.fence);
+  r.fence = 0;
+
+  if (status==GL_WAIT_FAILED)
+  {
+    Warning("Regal::Frame::resolve glClientWaitSync failed for frame ",r.frame);
+    return;
   }
+
+  GLint pack = 0;
+  _next->call(&_next->glGetIntegerv)(GL_PIXEL_PACK_BUFFER_BINDING, &pack);
+  _next->call(&_next->glBindBuffer)(GL_PIXEL_PACK_BUFFER, r.buffer);
+
+  const GLbyte *pixels = static_cast<const GLbyte *>(_next->call(&_next->glMapBufferRange)(GL_PIXEL_PACK_BUFFER, 0, r.size, GL_MAP_READ_BIT));
+  if (pixels)
+  {
+    Thread::Job *job = new FrameJob(r.frame, r.width, r.height, pixels);
+    _next->call(&_next->glUnmapBuffer)(GL_PIXEL_PACK_BUFFER);
+
+    // Rather than queue copies of frames without bound, wait for the workers
+
+    if (workers->full())
+      Warning("Regal::Frame::resolve frame ",r.frame," waits for a full capture queue");
+    workers->push(job);
+  }
+  else
+  {
+    Warning("Regal::Frame::resolve glMapBufferRange failed for frame ",r.frame);
+  }
+
+  _next->call(&_next->glBindBuffer)(GL_PIXEL_PACK_BUFFER, pack);
+}
+
+// Resolve all pending readbacks, oldest first, and wait for the workers
+
+void Frame::flush(RegalContext &context)
+{
+  for (size_t i=0; i<readbacks.size(); ++i)
+  {
+    Readback &r = readbacks[(readbackNext+i)%readbacks.size()];
+    if (r.fence)
+      resolve(context, r);
+  }
+
+  if (workers)
+    workers->wait();
 }
 
 REGAL_NAMESPACE_END
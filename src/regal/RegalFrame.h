@@ -44,8 +44,14 @@
 
 REGAL_GLOBAL_BEGIN
 
+#include <vector>
+
 #include "RegalTimer.h"
+#include "RegalConfig.h"
 #include "RegalContext.h"
+#include "RegalGpuTiming.h"
+#include "RegalScopedPtr.h"
+#include "RegalWorkQueue.h"
 
 REGAL_GLOBAL_END
 
@@ -56,6 +62,8 @@ struct Frame {
   Frame()
   : frame(0),
     frameSamples(0),
+    readbackNext(0),
+    gpuTimingChecked(false),
     mode(AutoDetect)
   {
     frameTimer.restart();
@@ -67,6 +75,10 @@ struct Frame {
     Internal("Regal::Frame::Init","()");
   }
 
+  // Finish any pending asynchronous captures, while the context is still current
+
+  void Cleanup(RegalContext &ctx);
+
   //
   // Per-frame state and configuration
   //
@@ -88,9 +100,48 @@ struct Frame {
 
   inline void capture(RegalContext &ctx) { capture(ctx,false); }
 
+  // Group markers, for GPU timing, see Config::frameGpuTiming
+
+  inline void pushGroupMarker(RegalContext &ctx, const std::string &name) { if (Config::frameGpuTiming && (gpuTiming || startGpuTiming(ctx))) gpuTiming->push(ctx,name); }
+  inline void popGroupMarker (RegalContext &ctx)                          { if (gpuTiming) gpuTiming->pop(ctx); }
+
 private:
   void capture(RegalContext &ctx, const bool frameTerminator);
 
+  //
+  // Asynchronous capture, see Config::frameAsync
+  //
+  // Pixels are read into a ring of pixel pack buffers and mapped
+  // Config::frameAsyncLatency captures later, once the fence is
+  // signalled.  Masking, md5 and PNG encoding happen on the workers.
+  //
+
+  struct Readback
+  {
+    GLuint     buffer;
+    GLsizeiptr size;
+    GLsync     fence;
+    size_t     frame;
+    GLint      width;
+    GLint      height;
+  };
+
+  std::vector<Readback>         readbacks;
+  size_t                        readbackNext;
+  scoped_ptr<Thread::WorkQueue> workers;
+
+  static bool asyncSupported(RegalContext &ctx);
+
+  void readback(RegalContext &ctx, const GLint width, const GLint height);
+  void resolve (RegalContext &ctx, Readback &r);
+  void flush   (RegalContext &ctx);
+  void release (RegalContext &ctx);
+
+  scoped_ptr<GpuTiming>         gpuTiming;
+  bool                          gpuTimingChecked;
+
+  bool startGpuTiming(RegalContext &ctx);
+
   enum Mode
   {
     AutoDetect,
@@ -0,0 +1,364 @@
+/*
+  Copyright (c) 2011-2013 NVIDIA Corporation
+  Copyright (c) 2011-2013 Cass Everitt
+  Copyright (c) 2012-2013 Scott Nations
+  Copyright (c) 2012-2013 Nigel Stewart
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+    Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+  IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+  OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+  OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+  Intended formatting conventions:
+  $ astyle --style=allman --indent=spaces=2 --indent-switches
+*/
+
+#include "pch.h" /* For MS precompiled header support */
+
+#include "RegalUtil.h"
+
+#if REGAL_FRAME
+
+REGAL_GLOBAL_BEGIN
+
+#include <boost/print/json.hpp>
+#include <boost/print/print_string.hpp>
+using ::boost::print::print_string;
+
+#include "RegalGpuTiming.h"
+#include "RegalContext.h"
+#include "RegalContextInfo.h"
+#include "RegalFrame.h"
+#include "RegalThread.h"
+#include "RegalLog.h"
+
+REGAL_GLOBAL_END
+
+REGAL_NAMESPACE_BEGIN
+
+namespace Json { struct Output : public ::boost::print::json::output<std::string> {}; }
+
+// Trace thread for GPU events, outside the range of logged thread ids
+
+static const std::size_t gpuThread = 1<<16;
+
+GpuTiming::GpuTiming()
+: timing(false),
+  started(false),
+  gpuBase(0),
+  cpuBase(0),
+  named(false)
+{
+  current.number = 0;
+  current.begin  = 0;
+  current.end    = 0;
+}
+
+// Timestamp queries, without relying on disjoint timer query for ES
+
+bool GpuTiming::supported(RegalContext &context)
+{
+  if (!context.info || context.isES2())
+    return false;
+
+  const ContextInfo &info = *context.info;
+  return info.gl_version_3_3 || info.gl_arb_timer_query;
+}
+
+// A timestamp query issued now, from the pool if possible
+
+GLuint GpuTiming::query(RegalContext &context)
+{
+  DispatchTableGL *_next = &context.dispatcher.front();
+  RegalAssert(_next);
+
+  GLuint id = 0;
+  if (pool.size())
+  {
+    id = pool.back();
+    pool.pop_back();
+  }
+  else
+    _next->call(&_next->glGenQueries)(1, &id);
+
+  _next->call(&_next->glQueryCounter)(id, GL_TIMESTAMP);
+  return id;
+}
+
+// Begin timing a frame, unless too many are still waiting for results
+
+void GpuTiming::start(RegalContext &context, const std::size_t number)
+{
+  if (!started)
+  {
+    DispatchTableGL *_next = &context.dispatcher.front();
+    RegalAssert(_next);
+
+    GLint64 gpu = 0;
+    _next->call(&_next->glGetInteger64v)(GL_TIMESTAMP, &gpu);
+    calibrate(gpu, Timer().now());
+    started = true;
+  }
+
+  current.number = number;
+  current.regions.clear();
+  open.clear();
+
+  timing = pending.size()<REGAL_GPU_TIMING_MAX_PENDING;
+  current.begin = timing ? query(context) : 0;
+  current.end   = 0;
+
+  // Groups still open carry over into the new frame
+
+  for (std::size_t i=0; i<stack.size(); ++i)
+  {
+    open.push_back(current.regions.size());
+    if (timing)
+    {
+      Region r = { stack[i], i+1, 0, 0 };
+      current.regions.push_back(r);
+    }
+  }
+}
+
+void GpuTiming::push(RegalContext &context, const std::string &name)
+{
+  Internal("Regal::GpuTiming::push","name=",name);
+
+  if (!started)
+    start(context, context.frame ? context.frame->frame+1 : 1);
+
+  stack.push_back(name);
+  open.push_back(current.regions.size());
+  if (timing)
+  {
+    Region r = { name, stack.size(), query(context), 0 };
+    current.regions.push_back(r);
+  }
+}
+
+void GpuTiming::pop(RegalContext &context)
+{
+  Internal("Regal::GpuTiming::pop","()");
+
+  if (stack.empty())
+    return;
+
+  if (timing)
+    current.regions[open.back()].end = query(context);
+
+  stack.pop_back();
+  open.pop_back();
+}
+
+void GpuTiming::frame(RegalContext &context, const std::size_t number)
+{
+  Internal("Regal::GpuTiming::frame","number=",number);
+
+  if (timing)
+  {
+    current.end = query(context);
+    pending.push_back(Queries());
+    pending.back().number = current.number;
+    pending.back().begin  = current.begin;
+    pending.back().end    = current.end;
+    pending.back().regions.swap(current.regions);
+  }
+
+  resolve(context, false);
+  start(context, number+1);
+}
+
+void GpuTiming::Cleanup(RegalContext &context)
+{
+  Internal("Regal::GpuTiming::Cleanup","()");
+
+  resolve(context, true);
+
+  DispatchTableGL *_next = &context.dispatcher.front();
+  RegalAssert(_next);
+
+  // Queries of the unfinished frame are released without results
+
+  if (current.begin)
+    pool.push_back(current.begin);
+  for (std::size_t i=0; i<current.regions.size(); ++i)
+  {
+    if (current.regions[i].begin) pool.push_back(current.regions[i].begin);
+    if (current.regions[i].end)   pool.push_back(current.regions[i].end);
+  }
+
+  if (pool.size())
+    _next->call(&_next->glDeleteQueries)(GLsizei(pool.size()), &pool[0]);
+
+  pool.clear();
+  current.regions.clear();
+  current.begin = 0;
+  timing  = false;
+  started = false;
+}
+
+// Write out completed frames, oldest first.  Timestamps become
+// available in order, so a frame is ready once its last one is.
+
+void GpuTiming::resolve(RegalContext &context, const bool wait)
+{
+  if (pending.empty())
+    return;
+
+  DispatchTableGL *_next = &context.dispatcher.front();
+  RegalAssert(_next);
+
+  // Results would be written to a bound query buffer instead
+
+  GLint queryBuffer = 0;
+  const bool queryBufferObject = context.info && (context.info->gl_version_4_4 || context.info->gl_arb_query_buffer_object);
+  if (queryBufferObject)
+  {
+    _next->call(&_next->glGetIntegerv)(GL_QUERY_BUFFER_BINDING, &queryBuffer);
+    if (queryBuffer)
+      _next->call(&_next->glBindBuffer)(GL_QUERY_BUFFER, 0);
+  }
+
+  while (pending.size())
+  {
+    if (!wait)
+    {
+      GLuint available = GL_FALSE;
+      _next->call(&_next->glGetQueryObjectuiv)(pending.front().end, GL_QUERY_RESULT_AVAILABLE, &available);
+      if (!available)
+        break;
+    }
+
+    emit(context, pending.front());
+    pending.pop_front();
+  }
+
+  if (queryBuffer)
+    _next->call(&_next->glBindBuffer)(GL_QUERY_BUFFER, queryBuffer);
+}
+
+// Read back the results of a frame, trace it and recycle the queries
+
+void GpuTiming::emit(RegalContext &context, Queries &q)
+{
+  DispatchTableGL *_next = &context.dispatcher.front();
+  RegalAssert(_next);
+
+  Span frame = { 0, 0 };
+  _next->call(&_next->glGetQueryObjectui64v)(q.begin, GL_QUERY_RESULT, &frame.begin);
+  _next->call(&_next->glGetQueryObjectui64v)(q.end,   GL_QUERY_RESULT, &frame.end);
+  pool.push_back(q.begin);
+  pool.push_back(q.end);
+
+  std::vector<Span> regions(q.regions.size(), frame);
+  for (std::size_t i=0; i<q.regions.size(); ++i)
+  {
+    const Region &r = q.regions[i];
+    if (r.begin)
+    {
+      _next->call(&_next->glGetQueryObjectui64v)(r.begin, GL_QUERY_RESULT, &regions[i].begin);
+      pool.push_back(r.begin);
+    }
+    if (r.end)
+    {
+      _next->call(&_next->glGetQueryObjectui64v)(r.end, GL_QUERY_RESULT, &regions[i].end);
+      pool.push_back(r.end);
+    }
+  }
+
+  if (Logging::frameTime)
+  {
+    const GLuint64 REGAL_UNUSED elapsed = frame.end>frame.begin ? frame.end-frame.begin : 0;
+    UNUSED_PARAMETER(elapsed); // Unused if info logging disabled at compile-time
+    Info("Frame ",q.number,' ',elapsed/1000000.0," msec GPU.");
+  }
+
+  Logging::jsonTrace(trace(q, frame, regions));
+}
+
+std::string GpuTiming::trace(const Queries &q, const Span &frame, const std::vector<Span> &regions)
+{
+#if REGAL_NO_JSON
+  UNUSED_PARAMETER(q);
+  UNUSED_PARAMETER(frame);
+  UNUSED_PARAMETER(regions);
+  return std::string();
+#else
+  RegalAssert(q.regions.size()==regions.size());
+
+  const std::size_t pid = Thread::procId();
+  std::string events;
+
+  // Label the GPU track the first time
+
+  if (!named)
+  {
+    Json::Output jo;
+    jo.object();
+      jo.member("name","thread_name");
+      jo.member("ph",  "M");
+      jo.member("pid", pid);
+      jo.member("tid", gpuThread);
+      jo.object("args");
+        jo.member("name","GPU");
+      jo.end();
+    jo.end();
+    events += jo.str() + ",\n";
+    named = true;
+  }
+
+  // Complete events, nested by time
+
+  for (std::size_t i=0; i<=regions.size(); ++i)
+  {
+    const Span        &s     = i ? regions[i-1] : frame;
+    const std::string  name  = i ? q.regions[i-1].name : print_string("Frame ",q.number);
+    const std::size_t  depth = i ? q.regions[i-1].depth : 0;
+    const GLuint64     ns    = s.end>s.begin ? s.end-s.begin : 0;
+    const Timer::Value begin = traceTime(s.begin);
+
+    Json::Output jo;
+    jo.object();
+      jo.member("cat", std::string("gpu"));
+      jo.member("pid", pid);
+      jo.member("tid", gpuThread);
+      jo.member("ts",  begin);
+      jo.member("dur", traceTime(s.begin+ns) - begin);
+      jo.member("ph",  "X");
+      jo.member("name",name);
+      jo.object("args");
+        jo.member("frame", q.number);
+        jo.member("depth", depth);
+        jo.member("ns",    ns);
+      jo.end();
+    jo.end();
+    events += jo.str() + ",\n";
+  }
+
+  return events;
+#endif
+}
+
+REGAL_NAMESPACE_END
+
+#endif // REGAL_FRAME
@@ -0,0 +1,152 @@
+/*
+  Copyright (c) 2011-2013 NVIDIA Corporation
+  Copyright (c) 2011-2013 Cass Everitt
+  Copyright (c) 2012-2013 Scott Nations
+  Copyright (c) 2012-2013 Nigel Stewart
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+    Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+  IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+  OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+  OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+
+ GPU timing of frames and debug groups
+
+ Each frame and each group marker pushed within it is bracketed by
+ GL_TIMESTAMP queries taken from a recycled pool.  Completed frames
+ are read back once their queries are available, typically a few
+ frames later, and written to the JSON trace as a nested timeline.
+
+ */
+
+#ifndef __REGAL_GPU_TIMING_H__
+#define __REGAL_GPU_TIMING_H__
+
+#include "RegalUtil.h"
+
+#if REGAL_FRAME
+
+REGAL_GLOBAL_BEGIN
+
+#include <deque>
+#include <string>
+#include <vector>
+
+#include <GL/Regal.h>
+
+#include "RegalTimer.h"
+
+REGAL_GLOBAL_END
+
+REGAL_NAMESPACE_BEGIN
+
+struct RegalContext;
+
+// Frames awaiting results before new ones go untimed
+
+#ifndef REGAL_GPU_TIMING_MAX_PENDING
+#define REGAL_GPU_TIMING_MAX_PENDING 8
+#endif
+
+struct GpuTiming
+{
+  GpuTiming();
+
+  static bool supported(RegalContext &ctx);
+
+  // Group markers, see Marker
+
+  void push(RegalContext &ctx, const std::string &name);
+  void pop (RegalContext &ctx);
+
+  // End of frame, see Frame::capture
+
+  void frame(RegalContext &ctx, const std::size_t number);
+
+  // Wait for and write out pending frames, release the queries
+
+  void Cleanup(RegalContext &ctx);
+
+  // Pair a GPU timestamp with the trace clock
+
+  inline void calibrate(const GLint64 gpu, const Timer::Value cpu) { gpuBase = gpu; cpuBase = cpu; }
+
+  // Trace time in microseconds for a GPU timestamp in nanoseconds
+
+  inline Timer::Value traceTime(const GLuint64 gpu) const
+  {
+    const GLint64 delta = GLint64(gpu) - gpuBase;
+    return Timer::Value(GLint64(cpuBase) + delta/1000);
+  }
+
+  struct Region
+  {
+    std::string name;
+    std::size_t depth;      // One for outermost groups
+    GLuint      begin;      // Zero for groups carried over from the previous frame
+    GLuint      end;        // Zero for groups still open at the end of the frame
+  };
+
+  struct Queries
+  {
+    std::size_t         number;
+    GLuint              begin;
+    GLuint              end;
+    std::vector<Region> regions;
+  };
+
+  // Query results, in nanoseconds
+
+  struct Span
+  {
+    GLuint64 begin;
+    GLuint64 end;
+  };
+
+  // Chrome trace events for a frame and its regions
+
+  std::string trace(const Queries &q, const Span &frame, const std::vector<Span> &regions);
+
+private:
+  GLuint query  (RegalContext &ctx);
+  void   start  (RegalContext &ctx, const std::size_t number);
+  void   resolve(RegalContext &ctx, const bool wait);
+  void   emit   (RegalContext &ctx, Queries &q);
+
+  std::vector<GLuint>      pool;       // Queries free for re-use
+  std::deque<Queries>      pending;    // Completed frames, oldest first
+  Queries                  current;
+  bool                     timing;     // Queries issued for the current frame
+  bool                     started;
+  std::vector<std::string> stack;      // Names of open groups
+  std::vector<std::size_t> open;       // Their regions in the current frame
+
+  GLint64                  gpuBase;    // GPU time in nanoseconds at cpuBase
+  Timer::Value             cpuBase;    // Trace time in microseconds
+  bool                     named;      // Trace thread name written
+};
+
+REGAL_NAMESPACE_END
+
+#endif // REGAL_FRAME
+
+#endif // __REGAL_GPU_TIMING_H__
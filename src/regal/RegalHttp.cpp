@@ -89,6 +89,7 @@ REGAL_GLOBAL_BEGIN
 #include "RegalFavicon.h"
 #include "RegalContextInfo.h"
 #include "RegalEmuInfo.h"
+#include "RegalStatistics.h"
 
 #include <map>
 
@@ -98,6 +99,7 @@ REGAL_GLOBAL_BEGIN
 using namespace std;
 
 #include <boost/print/print_string.hpp>
+#include <boost/print/json.hpp>
 using boost::print::print_string;
 
 #include "civetweb.h"
@@ -106,6 +108,8 @@ REGAL_GLOBAL_END
 
 REGAL_NAMESPACE_BEGIN
 
+namespace Json { struct Output : public ::boost::print::json::output<std::string> {}; }
+
 
 namespace Http
 {
@@ -1326,6 +1330,25 @@ namespace Http
 
 
 
+  struct StatisticsHandler : public RequestHandler {
+    virtual void HandleRequest( Connection & conn ) {
+      Json::Output jo;
+      jo.object();
+#if REGAL_STATISTICS
+      RegalContext * ctx = ::REGAL_NAMESPACE_INTERNAL::Init::getContextByIndex( 0 );
+      if( ctx && ctx->statistics ) {
+        ScopedContextAcquire sca( ctx );
+        ctx->statistics->writeJSON( jo );
+      }
+#endif
+      jo.end();
+      SendText( conn, "application/json", jo.str() );
+    }
+    virtual string GetHandlerString() {
+      return "statistics";
+    }
+  };
+
   void CreateHandlers()
   {
     Http::RequestHandler *h[] = { new Http::DebugHandler,
@@ -1335,6 +1358,7 @@ namespace Http
                                   new Http::ProgramHandler,
                                   new Http::ShaderHandler,
                                   new Http::LogHandler,
+                                  new Http::StatisticsHandler,
                                   new Http::EnableHandler,
                                   new Http::DisableHandler,
                                   new Http::FaviconHandler,
@@ -50,10 +50,21 @@ typedef boost::print::string_list<string> string_list;
 #include "RegalLog.h"
 #include "RegalToken.h"
 #include "RegalHelper.h"
+#include "RegalPush.h"
 #include "RegalShader.h"
+#include "RegalConfig.h"
+#include "RegalContextInfo.h"
+#include "RegalCacheProgram.h"
+#include "RegalStatistics.h"
 
 REGAL_GLOBAL_END
 
+// GL_KHR_parallel_shader_compile and GL_ARB_parallel_shader_compile
+
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+
 REGAL_NAMESPACE_BEGIN
 
 namespace Emu
@@ -1352,6 +1363,96 @@ static void GenerateFragmentShaderSource( Iff * rff, string_list &src )
   src << "}\n";
 }
 
+// The uber program is a conservative stand-in for the specialized
+// programs while they are compiled in the background.  It handles
+// vertex transform, the current or per-vertex color and a modulated
+// 2D texture on unit 0, as selected by the rglUberFlags uniform.
+
+static void GenerateUberHeader( const Iff * rff, string_list & src )
+{
+  if ( rff->gles )
+  {
+#if REGAL_FORCE_DESKTOP_GLSL
+    src << "#version 140\n";
+#else
+    src << "#version 100\n";
+#endif
+  }
+  else if ( rff->legacy )
+  {
+    src << "#version 120\n";
+  }
+  else
+  {
+    src << "#version 140\n";
+  }
+  src << "// uber program\n";
+}
+
+static void GenerateUberVertexShaderSource( const Iff * rff, string_list & src )
+{
+  Internal("Regal::Iff::GenerateUberVertexShaderSource", boost::print::optional(rff,Logging::pointers));
+
+  GenerateUberHeader( rff, src );
+  if ( rff->gles || rff->legacy )
+  {
+    src << "#define in attribute\n";
+    src << "#define out varying\n";
+  }
+  if ( rff->gles )
+  {
+    src << "precision highp float;\n";
+  }
+  RegalAssertArrayIndex( rff->ffAttrMap, RFF2A_Color );
+  src << "uniform vec4 rglAttrib[" << REGAL_EMU_MAX_VERTEX_ATTRIBS << "];\n";
+  src << "uniform mat4 rglModelViewMatrix;\n";
+  src << "uniform mat4 rglProjectionMatrix;\n";
+  src << "uniform mat4 rglTextureMatrix0;\n";
+  src << "uniform vec4 rglUberFlags;\n";
+  src << "in vec4 rglVertex;\n";
+  src << "in vec4 rglColor;\n";
+  src << "in vec4 rglMultiTexCoord0;\n";
+  src << "out vec4 rglFrontColor;\n";
+  src << "out vec4 rglTEXCOORD0;\n";
+  src << "void main()\n";
+  src << "{\n";
+  src << "  gl_Position = rglProjectionMatrix * rglModelViewMatrix * rglVertex;\n";
+  src << "  rglFrontColor = mix( rglAttrib[" << rff->ffAttrMap[ RFF2A_Color ] << "], rglColor, rglUberFlags.x );\n";
+  src << "  rglTEXCOORD0 = rglTextureMatrix0 * rglMultiTexCoord0;\n";
+  src << "}\n";
+}
+
+static void GenerateUberFragmentShaderSource( const Iff * rff, string_list & src )
+{
+  Internal("Regal::Iff::GenerateUberFragmentShaderSource", boost::print::optional(rff,Logging::pointers));
+
+  GenerateUberHeader( rff, src );
+  if ( rff->gles || rff->legacy )
+  {
+    src << "#define in varying\n";
+    src << "#define rglFragColor gl_FragColor\n";
+  }
+  else
+  {
+    src << "out vec4 rglFragColor;\n";
+  }
+  if ( rff->gles )
+  {
+    src << "precision highp float;\n";
+  }
+  src << "uniform sampler2D rglSampler0;\n";
+  src << "uniform vec4 rglUberFlags;\n";
+  src << "in vec4 rglFrontColor;\n";
+  src << "in vec4 rglTEXCOORD0;\n";
+  src << "void main()\n";
+  src << "{\n";
+  src << "  vec4 c = rglFrontColor;\n";
+  src << "  if ( rglUberFlags.y > 0.0 )\n";
+  src << "    c *= " << TextureFetch( rff->gles, rff->legacy, Iff::TT_2D ) << "( rglSampler0, rglTEXCOORD0.xy );\n";
+  src << "  rglFragColor = c;\n";
+  src << "}\n";
+}
+
 static void Copy( Float4 & dst, const GLfloat * src )
 {
   dst.x = src[0];
@@ -1807,6 +1908,14 @@ void Program::Init( RegalContext * ctx, const Store & sstore, GLuint vshd, GLuin
 {
   Internal("Regal::Iff::Program::Init","()");
 
+  Link( ctx, sstore, vshd, fshd );
+  Finish( ctx );
+}
+
+void Program::Link( RegalContext * ctx, const Store & sstore, GLuint vshd, GLuint fshd )
+{
+  Internal("Regal::Iff::Program::Link","()");
+
   // update emu info with the limits that this layer supports
 
   RegalAssert(ctx);
@@ -1826,7 +1935,22 @@ void Program::Init( RegalContext * ctx, const Store & sstore, GLuint vshd, GLuin
   fs = fshd;
   tbl.call(&tbl.glAttachShader)(pg, fs );
   Attribs( ctx );
+  if ( ctx->iff->programBinary && !ctx->iff->gles )
+    tbl.call(&tbl.glProgramParameteri)( pg, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE );
   tbl.call(&tbl.glLinkProgram)( pg );
+}
+
+// Querying the link status or uniform locations waits for the link
+// to complete, so this is deferred for programs linking in the
+// background.
+
+void Program::Finish( RegalContext * ctx )
+{
+  Internal("Regal::Iff::Program::Finish","()");
+
+  RegalAssert(ctx);
+  DispatchTableGL & tbl = ctx->dispatcher.emulation;
+  pending = false;
 
 #ifndef NDEBUG
   GLint status = 0;
@@ -1845,6 +1969,81 @@ void Program::Init( RegalContext * ctx, const Store & sstore, GLuint vshd, GLuin
   tbl.call(&tbl.glUseProgram)( ctx->iff->program );
 }
 
+bool Program::InitBinary( RegalContext * ctx, const Store & sstore, GLenum format, const std::string & binary )
+{
+  Internal("Regal::Iff::Program::InitBinary","()");
+
+  RegalAssert(ctx);
+  RegalAssert(ctx->emuInfo);
+  DispatchTableGL & tbl = ctx->dispatcher.emulation;
+
+  GLuint prog = tbl.call(&tbl.glCreateProgram)();
+  if ( ctx->iff->gles )
+    tbl.call(&tbl.glProgramBinaryOES)( prog, format, binary.data(), static_cast<GLint>(binary.size()) );
+  else
+    tbl.call(&tbl.glProgramBinary)( prog, format, binary.data(), static_cast<GLsizei>(binary.size()) );
+
+  // The driver is free to reject a binary it previously produced,
+  // in which case the caller falls back to compiling from source.
+
+  GLint status = 0;
+  tbl.call(&tbl.glGetProgramiv)( prog, GL_LINK_STATUS, &status );
+  if (!status)
+  {
+    tbl.call(&tbl.glDeleteProgram)( prog );
+    return false;
+  }
+
+  ctx->emuInfo->gl_max_texture_coords = REGAL_EMU_MAX_TEXTURE_COORDS;
+  ctx->emuInfo->gl_max_vertex_attribs = REGAL_EMU_MAX_VERTEX_ATTRIBS;
+  ctx->emuInfo->gl_max_texture_units  = REGAL_EMU_MAX_TEXTURE_UNITS;
+
+  ver = ::std::numeric_limits<GLuint64>::max();
+  progcount = 0;
+  store = sstore;
+  pg = prog;
+  vs = 0;
+  fs = 0;
+
+  // Attribute locations are part of the binary, but samplers
+  // and uniform locations need to be set up as usual.
+
+  tbl.call(&tbl.glUseProgram)( pg );
+  Samplers( ctx, tbl );
+  Uniforms( ctx, tbl );
+  tbl.call(&tbl.glUseProgram)( ctx->iff->program );
+  return true;
+}
+
+bool Program::GetBinary( RegalContext * ctx, GLenum & format, std::string & binary ) const
+{
+  Internal("Regal::Iff::Program::GetBinary","()");
+
+  RegalAssert(ctx);
+  DispatchTableGL & tbl = ctx->dispatcher.emulation;
+
+  GLint status = 0;
+  tbl.call(&tbl.glGetProgramiv)( pg, GL_LINK_STATUS, &status );
+  if (!status)
+    return false;
+
+  GLint length = 0;
+  tbl.call(&tbl.glGetProgramiv)( pg, GL_PROGRAM_BINARY_LENGTH, &length );
+  if (length<=0)
+    return false;
+
+  binary.resize(length);
+  GLsizei written = 0;
+  format = GL_NONE;
+  if ( ctx->iff->gles )
+    tbl.call(&tbl.glGetProgramBinaryOES)( pg, length, &written, &format, &binary[0] );
+  else
+    tbl.call(&tbl.glGetProgramBinary)( pg, length, &written, &format, &binary[0] );
+  binary.resize(written>0 ? written : 0);
+
+  return !binary.empty();
+}
+
 void Program::Shader( RegalContext * ctx, DispatchTableGL & tbl, GLenum type, GLuint & shader, const GLchar *src )
 {
   Internal("Regal::Iff::Program::Shader","()");
@@ -1985,7 +2184,7 @@ void Program::Uniforms( RegalContext * ctx, DispatchTableGL & tbl )
 {
   Internal("Regal::Iff::Program::Uniforms","()");
 
-  UNUSED_PARAMETER(ctx);
+  RegalAssert(ctx);
 
   size_t n = array_size( regalFFUniformInfo );
   for ( size_t i = 1; i < n; i++ )
@@ -1996,6 +2195,16 @@ void Program::Uniforms( RegalContext * ctx, DispatchTableGL & tbl )
     if (slot > -1)
       uniforms[ ri.val ] = UniformInfo(~GLuint64(0), slot);
   }
+
+  // Members of the fixed-function uniform block have no location,
+  // and are updated via Iff::UpdateUniformBuffer instead.
+
+  if ( ctx->iff->uniformBuffer )
+  {
+    GLuint index = tbl.call(&tbl.glGetUniformBlockIndex)( pg, "rglState" );
+    if ( index != GL_INVALID_INDEX )
+      tbl.call(&tbl.glUniformBlockBinding)( pg, index, ctx->iff->uniformBinding );
+  }
 }
 
 Iff::Iff()
@@ -2013,6 +2222,15 @@ Iff::Iff()
 , immVboElement(0)
 , immVao(0)
 , immShadowVao(0)
+, immStream(false)
+, immPackedCount(0)
+, immStride(0)
+, immWritten(0)
+, immBatch(false)
+, immPending(false)
+, immBatchStart(0)
+, immStateChanged(false)
+, immLevel(0)
 , shadowMatrixMode(GL_MODELVIEW)
 , shadowActiveTextureIndex(0)
 , activeTextureIndex(0)
@@ -2023,8 +2241,23 @@ Iff::Iff()
 , currVao(0)
 , gles(false)
 , legacy(false)
+, programBinary(false)
+, asyncCompile(false)
+, ffuberFlags(-1)
+, uniformBuffer(false)
+, uniformMultiBind(false)
+, shadowUniformBuffer(0)
+, uniformBinding(0)
+, uniformAlignment(1)
+, uniformOffset(0)
+, uniformVer(0)
 {
   memset(immArray,0,sizeof(immArray));
+  memset(immLayout,0,sizeof(immLayout));
+  memset(immBoundLayout,0,sizeof(immBoundLayout));
+  memset(immPacked,0,sizeof(immPacked));
+  for (size_t i = 0; i < array_size( immSize ); i++)
+    immSize[ i ] = 4;
 
   size_t n = array_size( ffAttrMap );
   RegalAssert( array_size( ffAttrInvMap ) == n);
@@ -2045,9 +2278,6 @@ Iff::Iff()
     textureEnvColorVer[ i ] = 0;
     textureBinding[ i ] = 0;
   }
-  n = array_size( ffprogs );
-  for (size_t i = 0; i < n; ++i)
-    ffprogs[ i ] = Program();
 }
 
 void Iff::Cleanup( RegalContext &ctx )
@@ -2061,11 +2291,14 @@ void Iff::Cleanup( RegalContext &ctx )
   tbl.call(&tbl.glDeleteBuffers)(1, &immVboElement);
   tbl.call(&tbl.glDeleteVertexArrays)(1, &immVao);
 
-  size_t n = array_size( ffprogs );
-  for (size_t i = 0; i < n; ++i)
+  immRing.Cleanup(tbl);
+  immStream = false;
+  uniformRing.Cleanup(tbl);
+  uniformBuffer = false;
+
+  for (ProgramList::const_iterator i = ffprogs.begin(); i != ffprogs.end(); ++i)
   {
-    RegalAssertArrayIndex( ffprogs, i );
-    const Program &pgm = ffprogs[i];
+    const Program &pgm = *i;
     if (pgm.pg)
     {
       if (&pgm == currprog)
@@ -2078,6 +2311,21 @@ void Iff::Cleanup( RegalContext &ctx )
       tbl.call(&tbl.glDeleteProgram)(pgm.pg);
     }
   }
+  ffprogs.clear();
+  ffprogsMap.clear();
+
+  if (ffuber.pg)
+  {
+    if (&ffuber == currprog)
+    {
+      tbl.call(&tbl.glUseProgram)(0);
+      currprog = NULL;
+    }
+    tbl.call(&tbl.glDeleteShader)(ffuber.vs);
+    tbl.call(&tbl.glDeleteShader)(ffuber.fs);
+    tbl.call(&tbl.glDeleteProgram)(ffuber.pg);
+    ffuber = Program();
+  }
 
   const bool isWebGLish = (ctx.info->vendor == "Chromium" || ctx.info->webgl);
 
@@ -2382,12 +2630,29 @@ void Iff::InitImmediate(RegalContext &ctx)
   tbl.glBufferData( GL_ELEMENT_ARRAY_BUFFER, sizeof( immArrayElement ), NULL, GL_STATIC_DRAW );
 #endif
 
+  InitImmediateStream(ctx);
+  immBatch = Config::iffImmediateBatch;
+  immPending = false;
+  immBatchStart = 0;
+  immStateChanged = false;
+  immLevel = ctx.emuLevel;
+
   for (GLuint i = 0; i < max_vertex_attribs; i++)
   {
     EnableArray( &ctx, i ); // to keep ffn current
     tbl.glEnableVertexAttribArray( i );
-    tbl.glVertexAttribPointer( i, 4, GL_FLOAT, GL_FALSE, max_vertex_attribs * sizeof(Float4), (GLubyte *)NULL + i * sizeof(Float4) );
+    if (immStream)
+    {
+      // Initially every attribute is a constant, see FlushStream
+
+      tbl.glVertexAttribFormat( i, 4, GL_FLOAT, GL_FALSE, i * sizeof(Float4) );
+      tbl.glVertexAttribBinding( i, 1 );
+    }
+    else
+      tbl.glVertexAttribPointer( i, 4, GL_FLOAT, GL_FALSE, max_vertex_attribs * sizeof(Float4), (GLubyte *)NULL + i * sizeof(Float4) );
   }
+  if (immStream)
+    tbl.glVertexBindingDivisor( 1, 1 );
   tbl.glBindVertexArray( 0 );
   BindVertexArray( &ctx, 0 ); // to keep ffn current
 
@@ -2418,6 +2683,44 @@ void Iff::InitImmediate(RegalContext &ctx)
   // The initial values for all generic vertex attributes are (0:0; 0:0; 0:0; 1:0).
 }
 
+void Iff::InitImmediateStream(RegalContext &ctx)
+{
+  Internal("Regal::Iff::InitImmediateStream","()");
+
+  RegalAssert(ctx.info);
+
+  immStream = false;
+  immStride = max_vertex_attribs * sizeof(Float4);
+
+  if (!Config::iffImmediateStream)
+    return;
+
+  const ContextInfo &info = *ctx.info;
+
+  if ( gles || legacy ||
+       !( info.gl_version_4_3 || info.gl_arb_vertex_attrib_binding ) ||
+       !( info.gl_version_4_4 || info.gl_arb_buffer_storage ) ||
+       !( info.gl_version_3_2 || info.gl_arb_sync ) )
+  {
+    Info("IFF immediate mode streaming not supported by ",info.vendor," ",info.renderer);
+    return;
+  }
+
+  // Each segment holds at least one full immArray
+
+  DispatchTableGL &tbl = ctx.dispatcher.emulation;
+  if (!immRing.Init( tbl, REGAL_IMMEDIATE_STREAM_SIZE, 4 ))
+    return;
+
+  RegalAssert( immRing.segmentSize > GLsizeiptr( sizeof( immArray ) + sizeof( immVab ) ) );
+
+  memset(immLayout,0,sizeof(immLayout));
+  memset(immBoundLayout,0,sizeof(immBoundLayout));
+  immWritten = 0;
+  ImmediatePacking();
+  immStream = true;
+}
+
 void Iff::glDeleteVertexArrays( RegalContext * ctx, GLsizei n, const GLuint * arrays )
 {
   RegalAssert( ctx != NULL );
@@ -2435,8 +2738,12 @@ void Iff::glDeleteBuffers( RegalContext * ctx, GLsizei n, const GLuint * buffers
   for (GLsizei i = 0; i < n; i++)
   {
     GLuint name = buffers[ i ];
-    if (name != immVbo && name != immVboElement)
+    if (name != immVbo && name != immVboElement && name != immRing.buffer && name != uniformRing.buffer)
+    {
       ctx->dispatcher.emulation.glDeleteBuffers( 1, &name );
+      if (name == shadowUniformBuffer)
+        shadowUniformBuffer = 0;
+    }
   }
 }
 
@@ -2459,6 +2766,12 @@ void Iff::glBindVertexArray( RegalContext *ctx, GLuint vao )
   }
 }
 
+void Iff::ShadowBindBuffer( GLenum target, GLuint buffer )
+{
+  if (target == GL_UNIFORM_BUFFER)
+    shadowUniformBuffer = buffer;
+}
+
 void Iff::ShadowClientActiveTexture( GLenum texture )
 {
   if ( (texture - GL_TEXTURE0) < REGAL_EMU_MAX_TEXTURE_COORDS)
@@ -2469,6 +2782,24 @@ void Iff::ShadowClientActiveTexture( GLenum texture )
 
 void Iff::Begin( RegalContext * ctx, GLenum mode )
 {
+  // Nothing has changed since the pending glEnd, otherwise
+  // RestoreVao would have drawn the batch.
+
+  if (immPending)
+  {
+    immPending = false;
+    if (mode == immPrim)
+    {
+#if REGAL_STATISTICS
+      if (ctx->statistics)
+        ctx->statistics->iff_immediate_batch++;
+#endif
+      immBatchStart = immCurrent;
+      return;
+    }
+    Flush( ctx );
+  }
+
   if (immActive == false)
   {
     immActive = true;
@@ -2479,16 +2810,52 @@ void Iff::Begin( RegalContext * ctx, GLenum mode )
   immCurrent = 0;
   immCurrentElement = 0;
   immPrim = mode;
+  immBatchStart = 0;
+  immStateChanged = false;
+
+  // Start with the attributes written by the previous batch,
+  // wide enough for their current values.
+
+  if (immStream)
+  {
+    for (GLuint i = 0; i < max_vertex_attribs; i++)
+      immLayout[ i ] = immWritten & ( 1u << i ) ? std::max( immLayout[ i ], immSize[ i ] ) : 0;
+    immWritten = 0;
+    ImmediatePacking();
+  }
 }
 
 void Iff::End( RegalContext * ctx )
 {
+  if (immStateChanged)
+  {
+    immStateChanged = false;
+    PreDraw( ctx );
+  }
+
+  const GLuint n = immBatch && !immCurrentElement ? ImmediateBatchVertices( immPrim ) : 0;
+  if (n)
+  {
+    // Incomplete primitives are dropped so that the next block
+    // starts on a primitive boundary.
+
+    immCurrent -= immCurrent % n;
+    immPending = true;
+    return;
+  }
+
   Flush( ctx );
   RestoreVao( ctx );
 }
 
 void Iff::RestoreVao( RegalContext * ctx )
 {
+  if (immPending)
+  {
+    immPending = false;
+    Flush( ctx );
+  }
+
   if (immActive)
   {
     ctx->dispatcher.emulation.glBindVertexArray( immShadowVao );
@@ -2497,9 +2864,51 @@ void Iff::RestoreVao( RegalContext * ctx )
   }
 }
 
+void Iff::FlushBatch( RegalContext * ctx )
+{
+  if (immPending)
+  {
+    RestoreVao( ctx );
+    return;
+  }
+
+  if (!immActive)
+    return;
+
+  // A state change between glBegin and glEnd.  The earlier blocks
+  // of the batch are drawn with the state they were specified with,
+  // the vertices of this block are kept for glEnd.
+
+  if (immBatchStart)
+  {
+    const GLuint current = immCurrent;
+    immCurrent = immBatchStart;
+    Flush( ctx );
+    immCurrent = current - immBatchStart;
+    memmove( immArray, immArray + immBatchStart * immStride, immCurrent * immStride );
+    immBatchStart = 0;
+  }
+  immStateChanged = true;
+}
+
+// Draw a pending batch ahead of a swap.  Called from the
+// platform swap entry points, above the emulation dispatch.
+
+void Iff::SwapBuffers( RegalContext * ctx )
+{
+  if (immPending)
+  {
+    Push<int> pushLevel( ctx->emuLevel );
+    ctx->emuLevel = immLevel;
+    RestoreVao( ctx );
+  }
+}
+
 void Iff::Flush( RegalContext * ctx )
 {
-  if (immCurrent>0)   // Do nothing for empty buffer
+  if (immCurrent>0 && immStream)
+    FlushStream( ctx );
+  else if (immCurrent>0)   // Do nothing for empty buffer
   {
     DispatchTableGL &tbl = ctx->dispatcher.emulation;
     tbl.glBufferData( GL_ARRAY_BUFFER, immCurrent * max_vertex_attribs * sizeof(Float4), immArray, GL_DYNAMIC_DRAW );
@@ -2540,14 +2949,110 @@ void Iff::Flush( RegalContext * ctx )
   }
 }
 
+// The number of vertices per primitive, for the independent
+// primitives that can be merged across glBegin/glEnd blocks.
+// Zero for strips, loops, fans and polygons.
+
+GLuint Iff::ImmediateBatchVertices( GLenum mode )
+{
+  switch( mode )
+  {
+    case GL_POINTS:    return 1;
+    case GL_LINES:     return 2;
+    case GL_TRIANGLES: return 3;
+    case GL_QUADS:     return 4;
+    default:           return 0;
+  }
+}
+
+// The vertices are copied to the ring buffer and drawn from
+// their offset, rather than reallocating immVbo for each batch.
+
+void Iff::FlushStream( RegalContext * ctx )
+{
+  Internal("Regal::Iff::FlushStream", boost::print::optional(ctx,Logging::pointers));
+
+  RegalAssert( immStream );
+  RegalAssert( immStride );
+
+  DispatchTableGL &tbl = ctx->dispatcher.emulation;
+
+  if (memcmp( immLayout, immBoundLayout, sizeof(immLayout) ))
+  {
+    GLuint offset = 0;
+    for (GLuint i = 0; i < max_vertex_attribs; i++)
+    {
+      if (immLayout[ i ])
+      {
+        tbl.glVertexAttribFormat( i, immLayout[ i ], GL_FLOAT, GL_FALSE, offset );
+        tbl.glVertexAttribBinding( i, 0 );
+        offset += immLayout[ i ] * sizeof(GLfloat);
+      }
+      else
+      {
+        tbl.glVertexAttribFormat( i, 4, GL_FLOAT, GL_FALSE, i * sizeof(Float4) );
+        tbl.glVertexAttribBinding( i, 1 );
+      }
+    }
+    tbl.glBindVertexBuffer( 0, immRing.buffer, 0, immStride );
+    memcpy( immBoundLayout, immLayout, sizeof(immLayout) );
+#if REGAL_STATISTICS
+    if (ctx->statistics)
+      ctx->statistics->iff_immediate_relayout++;
+#endif
+  }
+
+  // The constant attributes are uploaded with each batch, since
+  // an earlier copy may since have been overwritten in the ring.
+
+  if (immPackedCount < max_vertex_attribs)
+  {
+    GLintptr offset = 0;
+    GLubyte *dst = immRing.Allocate( tbl, max_vertex_attribs * sizeof(Float4), sizeof(Float4), offset );
+    RegalAssert( dst );
+    memcpy( dst, &immVab[0].x, max_vertex_attribs * sizeof(Float4) );
+    tbl.glBindVertexBuffer( 1, immRing.buffer, offset, 0 );
+  }
+
+  // Vertices are aligned to the stride, so that they can be
+  // drawn by index from the start of the buffer.
+
+  GLintptr offset = 0;
+  GLubyte *dst = immRing.Allocate( tbl, immCurrent * immStride, immStride, offset );
+  RegalAssert( dst );
+  memcpy( dst, immArray, immCurrent * immStride );
+
+  GLenum derivedPrim = immPrim;
+  if (( immPrim == GL_POLYGON ) && ( ctx->info->core == true || ctx->info->es2 ))
+    derivedPrim = GL_TRIANGLE_FAN;
+  tbl.glDrawArrays( derivedPrim, GLint( offset / immStride ), immCurrent );
+
+#if REGAL_STATISTICS
+  if (ctx->statistics)
+    ctx->statistics->iff_immediate_flush++;
+#endif
+}
+
 void Iff::Provoke( RegalContext * ctx )
 {
-  memcpy( immArray + immCurrent * max_vertex_attribs * sizeof(Float4), &immVab[0].x, max_vertex_attribs * sizeof(Float4) );
+  if (immStream)
+  {
+    GLfloat *dst = reinterpret_cast<GLfloat *>( immArray + immCurrent * immStride );
+    for (GLuint i = 0; i < immPackedCount; i++)
+    {
+      const GLuint idx = immPacked[ i ];
+      memcpy( dst, &immVab[ idx ].x, immLayout[ idx ] * sizeof(GLfloat) );
+      dst += immLayout[ idx ];
+    }
+  }
+  else
+    memcpy( immArray + immCurrent * immStride, &immVab[0].x, max_vertex_attribs * sizeof(Float4) );
   immCurrent++;
 
-  if ( immCurrent >= ((REGAL_IMMEDIATE_BUFFER_SIZE * REGAL_EMU_MAX_VERTEX_ATTRIBS) / max_vertex_attribs) )
+  if ( immCurrent >= ( immStream ? REGAL_IMMEDIATE_BUFFER_SIZE : ((REGAL_IMMEDIATE_BUFFER_SIZE * REGAL_EMU_MAX_VERTEX_ATTRIBS) / max_vertex_attribs) ) )
   {
     Flush( ctx );
+    immBatchStart = 0;
     int restartVerts = 0;
     switch( immPrim )
     {
@@ -2578,18 +3083,81 @@ void Iff::Provoke( RegalContext * ctx )
 
     if (immPrim==GL_TRIANGLE_FAN)
     {
-      memcpy( immArray + max_vertex_attribs * sizeof(Float4), immArray + (REGAL_IMMEDIATE_BUFFER_SIZE - 1) * max_vertex_attribs * sizeof(Float4), max_vertex_attribs * sizeof(Float4));
+      memcpy( immArray + immStride, immArray + (REGAL_IMMEDIATE_BUFFER_SIZE - 1) * immStride, immStride);
       immCurrent = 2;
     }
     else
     {
       int offset = REGAL_IMMEDIATE_BUFFER_SIZE - restartVerts;
-      memcpy( immArray, immArray + offset * max_vertex_attribs * sizeof(Float4), restartVerts * max_vertex_attribs * sizeof(Float4));
+      memcpy( immArray, immArray + offset * immStride, restartVerts * immStride);
       immCurrent = restartVerts;
     }
   }
 }
 
+// An attribute is written between glBegin and glEnd that is not
+// packed, or is packed with too few components.  The vertices so
+// far are repacked, with the previous value of the attribute.
+
+void Iff::ImmediateLayout( RegalContext * ctx, GLuint idx, GLuint size )
+{
+  Internal("Regal::Iff::ImmediateLayout", boost::print::optional(ctx,Logging::pointers), idx, size);
+
+  UNUSED_PARAMETER(ctx);
+  RegalAssertArrayIndex( immLayout, idx );
+
+  GLuint prevLayout[ REGAL_EMU_MAX_VERTEX_ATTRIBS ];
+  memcpy( prevLayout, immLayout, sizeof(immLayout) );
+  const GLuint prevStride = immStride;
+
+  immLayout[ idx ] = std::max( size, immCurrent ? immSize[ idx ] : 0 );
+  immLayout[ idx ] = std::max( immLayout[ idx ], prevLayout[ idx ] );
+  ImmediatePacking();
+
+  if (!immCurrent)
+    return;
+
+  std::vector<GLubyte> prev( immArray, immArray + immCurrent * prevStride );
+  for (GLuint v = 0; v < immCurrent; v++)
+  {
+    const GLfloat *src = reinterpret_cast<const GLfloat *>( &prev[0] + v * prevStride );
+    GLfloat       *dst = reinterpret_cast<GLfloat *>( immArray + v * immStride );
+    for (GLuint i = 0; i < max_vertex_attribs; i++)
+    {
+      const GLuint n = immLayout[ i ];
+      if (prevLayout[ i ])
+      {
+        // Missing components default to ( 0, 0, 0, 1 )
+
+        for (GLuint c = 0; c < n; c++)
+          dst[ c ] = c < prevLayout[ i ] ? src[ c ] : ( c == 3 ? 1.0f : 0.0f );
+        src += prevLayout[ i ];
+      }
+      else if (n)
+        memcpy( dst, &immVab[ i ].x, n * sizeof(GLfloat) );
+      dst += n;
+    }
+  }
+}
+
+void Iff::ImmediatePacking()
+{
+  GLuint stride = 0;
+  immPackedCount = 0;
+  for (GLuint i = 0; i < max_vertex_attribs; i++)
+  {
+    if (immLayout[ i ])
+    {
+      immPacked[ immPackedCount++ ] = i;
+      stride += immLayout[ i ] * sizeof(GLfloat);
+    }
+  }
+
+  // An empty layout still needs a valid stride for FlushStream
+
+  immStride = stride ? stride : sizeof(GLfloat);
+}
+
 void Iff::ProvokeElement( RegalContext * ctx, GLint i )
 {
   immArrayElement[immCurrentElement++] = i;
@@ -2751,6 +3319,163 @@ void Iff::InitFixedFunction(RegalContext &ctx)
   fmtmap[ GL_RG16UI      ] = GL_RG;
   fmtmap[ GL_RG32I       ] = GL_RG;
   fmtmap[ GL_RG32UI      ] = GL_RG;
+
+  InitUniformBuffer(ctx);
+  InitProgramBinary(ctx);
+
+  asyncCompile = Config::iffAsyncCompile &&
+                 ( ctx.info->getExtension("GL_KHR_parallel_shader_compile") ||
+                   ctx.info->getExtension("GL_ARB_parallel_shader_compile") );
+}
+
+void Iff::InitProgramBinary(RegalContext &ctx)
+{
+  Internal("Regal::Iff::InitProgramBinary","()");
+
+  RegalAssert(ctx.info);
+
+  programBinary = false;
+  programBinaryEnv.clear();
+
+#if REGAL_CACHE && REGAL_CACHE_PROGRAM
+  if (!Config::cache || !Config::cacheProgram)
+    return;
+
+  if (!Config::cacheProgramRead && !Config::cacheProgramWrite)
+    return;
+
+  const ContextInfo &info = *ctx.info;
+
+  if (gles)
+    programBinary = info.gl_oes_get_program_binary;
+  else
+    programBinary = info.gl_version_4_1 || info.gl_arb_get_program_binary;
+
+  if (!programBinary)
+  {
+    Info("Program binary caching not supported by ",info.vendor," ",info.renderer);
+    return;
+  }
+
+  // Program binaries are only valid for the driver that produced
+  // them, and the generated sources also depend on the attribute
+  // layout chosen in InitVertexArray.
+
+  string_list env;
+  env << info.vendor << '\n' << info.renderer << '\n' << info.version << '\n';
+  env << (gles ? "gles" : "gl") << (legacy ? " legacy" : "") << (uniformBuffer ? " ubo" : "") << '\n';
+  env << ffAttrTexBegin << ' ' << ffAttrNumTex << '\n';
+  programBinaryEnv = env.str();
+  programBinaryEnv.append(reinterpret_cast<const char *>(ffAttrMap), sizeof(ffAttrMap));
+#endif
+}
+
+uint64_t Iff::ProgramBinaryKey( const State::Store & p, std::string & key ) const
+{
+  // The key is every byte of State::Store that is hashed for
+  // the in-memory cache, prefixed by the driver environment.
+
+  const char *begin = reinterpret_cast<const char *>(&p.hash) + sizeof( p.hash );
+  const char *end   = reinterpret_cast<const char *>((&p)+1);
+
+  key = programBinaryEnv;
+  key.append(begin, end - begin);
+
+  uint32_t pc = 0;
+  uint32_t pb = 0;
+  Lookup3::hashlittle2(key.data(), key.size(), &pc, &pb);
+  return static_cast<uint64_t>(pc) | (static_cast<uint64_t>(pb)<<32);
+}
+
+// Append a member to the fixed-function uniform block.  Every
+// member is a multiple of vec4 in size, other than rglAlphaRef
+// at the end, so the std140 offsets are simply cumulative.
+
+static void AddUniformBlockMember( Iff::UniformMap & block, string_list & src, GLint & offset,
+                                   RegalFFUniformEnum val, const char * type, const string & name, GLint count, GLint size )
+{
+  block[ val ] = Iff::UniformInfo( ~GLuint64(0), offset );
+  src << "  " << type << " " << name;
+  if ( count > 1 )
+    src << "[" << count << "]";
+  src << ";\n";
+  offset += size * count;
+}
+
+void Iff::InitUniformBuffer(RegalContext &ctx)
+{
+  Internal("Regal::Iff::InitUniformBuffer","()");
+
+  RegalAssert(ctx.info);
+
+  uniformBuffer = false;
+
+  if (!Config::iffUniformBuffer)
+    return;
+
+  const ContextInfo &info = *ctx.info;
+
+  if ( gles || legacy ||
+       !( info.gl_version_3_1 || info.gl_arb_uniform_buffer_object ) ||
+       !( info.gl_version_4_4 || info.gl_arb_buffer_storage ) ||
+       !( info.gl_version_3_2 || info.gl_arb_sync ) )
+  {
+    Info("IFF uniform buffer not supported by ",info.vendor," ",info.renderer);
+    return;
+  }
+
+  // The block is declared with literal array sizes, since the
+  // generated sources only define ME_ELEMENTS and LE_ELEMENTS
+  // when lighting is enabled.
+
+  const char *stq = "STRQ";
+  uniformBlock.clear();
+  string_list src;
+  GLint offset = 0;
+  src << "layout(std140) uniform rglState\n{\n";
+  AddUniformBlockMember( uniformBlock, src, offset, FFU_Attrib, "vec4", "rglAttrib", REGAL_EMU_MAX_VERTEX_ATTRIBS, 16 );
+  AddUniformBlockMember( uniformBlock, src, offset, FFU_ModelViewMatrix, "mat4", "rglModelViewMatrix", 1, 64 );
+  AddUniformBlockMember( uniformBlock, src, offset, FFU_ProjectionMatrix, "mat4", "rglProjectionMatrix", 1, 64 );
+  AddUniformBlockMember( uniformBlock, src, offset, FFU_NormalMatrix, "mat3", "rglNormalMatrix", 1, 48 );
+  for ( int i = 0; i < REGAL_EMU_MAX_TEXTURE_UNITS; i++ )
+    AddUniformBlockMember( uniformBlock, src, offset, RegalFFUniformEnum( FFU_TextureMatrix0 + i ), "mat4", boost::print::print_string( "rglTextureMatrix", i ), 1, 64 );
+  for ( int i = 0; i < REGAL_EMU_MAX_TEXTURE_UNITS; i++ )
+    AddUniformBlockMember( uniformBlock, src, offset, RegalFFUniformEnum( FFU_TextureEnvColor0 + i ), "vec4", boost::print::print_string( "rglTexEnvColor", i ), 1, 16 );
+  for ( int i = 0; i < REGAL_EMU_MAX_TEXTURE_UNITS; i++ )
+    for ( int j = 0; j < 4; j++ )
+    {
+      AddUniformBlockMember( uniformBlock, src, offset, RegalFFUniformEnum( FFU_Texgen0ObjS + i * 8 + j ),     "vec4", boost::print::print_string( "rglTexGen", i, "Obj", stq[j] ), 1, 16 );
+      AddUniformBlockMember( uniformBlock, src, offset, RegalFFUniformEnum( FFU_Texgen0ObjS + i * 8 + 4 + j ), "vec4", boost::print::print_string( "rglTexGen", i, "Eye", stq[j] ), 1, 16 );
+    }
+  for ( int i = 0; i < REGAL_FIXED_FUNCTION_MAX_CLIP_PLANES; i++ )
+    AddUniformBlockMember( uniformBlock, src, offset, RegalFFUniformEnum( FFU_ClipPlane0 + i ), "vec4", boost::print::print_string( "rglClipPlane", i ), 1, 16 );
+  AddUniformBlockMember( uniformBlock, src, offset, FFU_LightModelAmbient, "vec4", "rglLightModelAmbient", 1, 16 );
+  AddUniformBlockMember( uniformBlock, src, offset, FFU_MaterialFront, "vec4", "rglMaterialFront", ME_Elements, 16 );
+  AddUniformBlockMember( uniformBlock, src, offset, FFU_MaterialBack,  "vec4", "rglMaterialBack",  ME_Elements, 16 );
+  for ( int i = 0; i < REGAL_FIXED_FUNCTION_MAX_LIGHTS; i++ )
+    AddUniformBlockMember( uniformBlock, src, offset, RegalFFUniformEnum( FFU_Light0 + i ), "vec4", boost::print::print_string( "rglLight", i ), LE_Elements, 16 );
+  AddUniformBlockMember( uniformBlock, src, offset, FFU_Fog, "vec4", "rglFog", 2, 16 );
+  AddUniformBlockMember( uniformBlock, src, offset, FFU_AlphaRef, "vec2", "rglAlphaRef", 1, 8 );
+  src << "};\n";
+  uniformBlockSource = src.str();
+
+  DispatchTableGL &tbl = ctx.dispatcher.emulation;
+
+  GLint bindings = 0;
+  tbl.call(&tbl.glGetIntegerv)( GL_MAX_UNIFORM_BUFFER_BINDINGS, &bindings );
+  tbl.call(&tbl.glGetIntegerv)( GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &uniformAlignment );
+  if ( bindings < 1 || !uniformRing.Init( tbl, REGAL_UNIFORM_BUFFER_SIZE, 4 ) )
+    return;
+
+  // The last binding point is reserved for the block, and is
+  // least likely to be used by the application.
+
+  uniformBinding   = GLuint( bindings - 1 );
+  uniformMultiBind = info.gl_version_4_4 || info.gl_arb_multi_bind;
+  uniformOffset    = 0;
+  uniformVer       = ::std::numeric_limits<GLuint64>::max();
+  uniformShadow.assign( offset, 0 );
+  uniformBuffer    = true;
 }
 
 void Iff::PreDraw( RegalContext * ctx )
@@ -2758,6 +3483,11 @@ void Iff::PreDraw( RegalContext * ctx )
   if (programPipeline)
     return;    // FIXME: Eventually will need to handle empty or partially populated PPO
 
+#if REGAL_STATISTICS
+  if (ctx->statistics)
+    ctx->statistics->iff_draw++;
+#endif
+
   ver.Reset();
   if  (program)
     UseShaderProgram( ctx );
@@ -3633,16 +4363,84 @@ void Iff::State::Process( Iff * ffn )
       }
     }
   }
-  p.hash = Lookup3::hashlittle(reinterpret_cast<const char *>(&p.hash) + sizeof( p.hash ),
-                               reinterpret_cast<const char *>((&p)+1) - reinterpret_cast<const char *>(&p.hash) - sizeof( p.hash ), 0);
+  uint32_t pc = 0;
+  uint32_t pb = 0;
+  Lookup3::hashlittle2(reinterpret_cast<const char *>(&p.hash) + sizeof( p.hash ),
+                       reinterpret_cast<const char *>((&p)+1) - reinterpret_cast<const char *>(&p.hash) - sizeof( p.hash ), &pc, &pb);
+  p.hash = static_cast<GLuint64>(pc) | (static_cast<GLuint64>(pb)<<32);
+}
+
+
+// With a uniform block, values are written to the block at the
+// byte offset in slot, rather than set on the current program.
+
+static void SetUniform4fv( RegalContext * ctx, GLubyte * block, GLint slot, GLsizei count, const GLfloat * v )
+{
+  if ( block )
+  {
+    memcpy( block + slot, v, count * 4 * sizeof(GLfloat) );
+    return;
+  }
+  DispatchTableGL & tbl = ctx->dispatcher.emulation;
+  tbl.glUniform4fv( slot, count, v );
+#if REGAL_STATISTICS
+  if (ctx->statistics)
+    ctx->statistics->iff_uniform_call++;
+#endif
+}
+
+static void SetUniform2f( RegalContext * ctx, GLubyte * block, GLint slot, GLfloat x, GLfloat y )
+{
+  if ( block )
+  {
+    const GLfloat v[2] = { x, y };
+    memcpy( block + slot, v, sizeof(v) );
+    return;
+  }
+  DispatchTableGL & tbl = ctx->dispatcher.emulation;
+  tbl.glUniform2f( slot, x, y );
+#if REGAL_STATISTICS
+  if (ctx->statistics)
+    ctx->statistics->iff_uniform_call++;
+#endif
+}
+
+static void SetUniformMatrix4fv( RegalContext * ctx, GLubyte * block, GLint slot, const GLfloat * m )
+{
+  if ( block )
+  {
+    memcpy( block + slot, m, 16 * sizeof(GLfloat) );
+    return;
+  }
+  DispatchTableGL & tbl = ctx->dispatcher.emulation;
+  tbl.glUniformMatrix4fv( slot, 1, GL_FALSE, m );
+#if REGAL_STATISTICS
+  if (ctx->statistics)
+    ctx->statistics->iff_uniform_call++;
+#endif
 }
 
+static void SetUniformMatrix3fv( RegalContext * ctx, GLubyte * block, GLint slot, const GLfloat * m )
+{
+  if ( block )
+  {
+    // std140 pads each mat3 column to a vec4
+    for ( int c = 0; c < 3; c++ )
+      memcpy( block + slot + c * 4 * sizeof(GLfloat), m + c * 3, 3 * sizeof(GLfloat) );
+    return;
+  }
+  DispatchTableGL & tbl = ctx->dispatcher.emulation;
+  tbl.glUniformMatrix3fv( slot, 1, GL_FALSE, m );
+#if REGAL_STATISTICS
+  if (ctx->statistics)
+    ctx->statistics->iff_uniform_call++;
+#endif
+}
 
 void Iff::UpdateUniforms( RegalContext * ctx )
 {
   Internal("Regal::Iff::UpdateUniforms", boost::print::optional(ctx,Logging::pointers));
 
-  DispatchTableGL & tbl = ctx->dispatcher.emulation;
   UniformMap * umap = NULL;
   if( currinst ) {
     if( currinst->prevInstance == NULL ) {
@@ -3665,9 +4463,14 @@ void Iff::UpdateUniforms( RegalContext * ctx )
     umap = & pgm.uniforms;
   }
 
+  UpdateUniforms( ctx, *umap, NULL );
+}
+
+void Iff::UpdateUniforms( RegalContext * ctx, UniformMap & umap, GLubyte * block )
+{
   const State::Store & p = ffstate.processed;
   const State::StoreUniform & u = ffstate.uniform;
-  for ( UniformMap::iterator i = umap->begin(); i != umap->end(); ++i )
+  for ( UniformMap::iterator i = umap.begin(); i != umap.end(); ++i )
   {
     UniformInfo & ui = (*i).second;
     bool inverse = false;
@@ -3699,7 +4502,7 @@ void Iff::UpdateUniforms( RegalContext * ctx )
             m = RescaleNormal( m );
           }
           r3::Matrix3f m3 = r3::ToMatrix3( m ).Transpose(); // FIXME: r3::Matrix3f should be column major like Matrix4...
-          tbl.glUniformMatrix3fv( ui.slot, 1, GL_FALSE, m3.Ptr() );
+          SetUniformMatrix3fv( ctx, block, ui.slot, m3.Ptr() );
         }
         break;
       }
@@ -3715,7 +4518,7 @@ void Iff::UpdateUniforms( RegalContext * ctx )
           if( transpose ) {
             m = m.Transpose();
           }
-          tbl.glUniformMatrix4fv( ui.slot, 1, GL_FALSE, m.Ptr() );
+          SetUniformMatrix4fv( ctx, block, ui.slot, m.Ptr() );
         }
         break;
       }
@@ -3731,7 +4534,7 @@ void Iff::UpdateUniforms( RegalContext * ctx )
           if( transpose ) {
             m = m.Transpose();
           }
-          tbl.glUniformMatrix4fv( ui.slot, 1, GL_FALSE, m.Ptr() );
+          SetUniformMatrix4fv( ctx, block, ui.slot, m.Ptr() );
         }
         break;
       }
@@ -3748,7 +4551,7 @@ void Iff::UpdateUniforms( RegalContext * ctx )
           if( transpose ) {
             m = m.Transpose();
           }
-          tbl.glUniformMatrix4fv( ui.slot, 1, GL_FALSE, m.Ptr() );
+          SetUniformMatrix4fv( ctx, block, ui.slot, m.Ptr() );
         }
         break;
       }
@@ -3781,7 +4584,7 @@ void Iff::UpdateUniforms( RegalContext * ctx )
           if( transpose ) {
             m = m.Transpose();
           }
-          tbl.glUniformMatrix4fv( ui.slot, 1, GL_FALSE, m.Ptr() );
+          SetUniformMatrix4fv( ctx, block, ui.slot, m.Ptr() );
         }
         break;
       }
@@ -3807,7 +4610,7 @@ void Iff::UpdateUniforms( RegalContext * ctx )
         if ( ui.ver != textureEnvColorVer[ idx ] )
         {
           ui.ver = textureEnvColorVer[ idx ];
-          tbl.glUniform4fv( ui.slot, 1, &textureEnvColor[ idx ].x);
+          SetUniform4fv( ctx, block, ui.slot, 1, &textureEnvColor[ idx ].x );
         }
         break;
       }
@@ -3825,7 +4628,7 @@ void Iff::UpdateUniforms( RegalContext * ctx )
         if ( ui.ver != u.light[ idx ].ver )
         {
           ui.ver = u.light[ idx ].ver;
-          tbl.glUniform4fv( ui.slot, LE_Elements, &u.light[ idx ].ambient.x);
+          SetUniform4fv( ctx, block, ui.slot, LE_Elements, &u.light[ idx ].ambient.x );
         }
         break;
       }
@@ -3837,13 +4640,13 @@ void Iff::UpdateUniforms( RegalContext * ctx )
         if ( ui.ver != u.mat[ idx ].ver )
         {
           ui.ver = u.mat[ idx ].ver;
-          tbl.glUniform4fv( ui.slot, ME_Elements, &u.mat[ idx ].ambient.x);
+          SetUniform4fv( ctx, block, ui.slot, ME_Elements, &u.mat[ idx ].ambient.x );
         }
         break;
       }
       case FFU_LightModelAmbient:
       {
-        tbl.glUniform4fv( ui.slot, 1, &u.lightModelAmbient.x);
+        SetUniform4fv( ctx, block, ui.slot, 1, &u.lightModelAmbient.x );
         break;
       }
       case FFU_Texgen0ObjS:
@@ -3890,7 +4693,7 @@ void Iff::UpdateUniforms( RegalContext * ctx )
           if ( ui.ver != tg.eyeVer )
           {
             ui.ver = tg.eyeVer;
-            tbl.glUniform4fv( ui.slot, 1, & tg.eye.x );
+            SetUniform4fv( ctx, block, ui.slot, 1, & tg.eye.x );
           }
         }
         else
@@ -3898,7 +4701,7 @@ void Iff::UpdateUniforms( RegalContext * ctx )
           if ( ui.ver != tg.objVer )
           {
             ui.ver = tg.objVer;
-            tbl.glUniform4fv( ui.slot, 1, & tg.obj.x );
+            SetUniform4fv( ctx, block, ui.slot, 1, & tg.obj.x );
           }
         }
         break;
@@ -3917,7 +4720,7 @@ void Iff::UpdateUniforms( RegalContext * ctx )
         if ( ui.ver != u.clip[idx].ver )
         {
           ui.ver = u.clip[idx].ver;
-          tbl.glUniform4fv( ui.slot, 1, & u.clip[idx].plane.x );
+          SetUniform4fv( ctx, block, ui.slot, 1, & u.clip[idx].plane.x );
         }
         break;
       }
@@ -3926,7 +4729,7 @@ void Iff::UpdateUniforms( RegalContext * ctx )
         if ( ui.ver != u.fog.ver )
         {
           ui.ver = u.fog.ver;
-          tbl.glUniform4fv( ui.slot, 2, &u.fog.params[0].x);
+          SetUniform4fv( ctx, block, ui.slot, 2, &u.fog.params[0].x );
         }
         break;
       }
@@ -3935,7 +4738,7 @@ void Iff::UpdateUniforms( RegalContext * ctx )
         if ( ui.ver != u.alphaTest.ver )
         {
           ui.ver = u.alphaTest.ver;
-          tbl.glUniform2f( ui.slot, u.alphaTest.alphaRef, u.alphaTest.alphaTestEnable );
+          SetUniform2f( ctx, block, ui.slot, u.alphaTest.alphaRef, u.alphaTest.alphaTestEnable );
         }
         break;
       }
@@ -3944,7 +4747,7 @@ void Iff::UpdateUniforms( RegalContext * ctx )
         if ( ui.ver != u.vabVer )
         {
           ui.ver = u.vabVer;
-          tbl.glUniform4fv( ui.slot, REGAL_EMU_MAX_VERTEX_ATTRIBS, & immVab[0].x );
+          SetUniform4fv( ctx, block, ui.slot, REGAL_EMU_MAX_VERTEX_ATTRIBS, & immVab[0].x );
         }
         break;
       }
@@ -3954,6 +4757,96 @@ void Iff::UpdateUniforms( RegalContext * ctx )
   }
 }
 
+// Fixed-function uniforms are written to a new range of the ring
+// buffer whenever the state changes.  Using a cached program only
+// needs the current range to be bound.
+
+void Iff::UpdateUniformBuffer( RegalContext * ctx )
+{
+  Internal("Regal::Iff::UpdateUniformBuffer", boost::print::optional(ctx,Logging::pointers));
+
+  RegalAssert( uniformBuffer );
+
+  DispatchTableGL & tbl = ctx->dispatcher.emulation;
+  GLsizeiptr size = GLsizeiptr( uniformShadow.size() );
+
+  if ( uniformVer != ffstate.Ver() )
+  {
+    uniformVer = ffstate.Ver();
+    UpdateUniforms( ctx, uniformBlock, &uniformShadow[0] );
+
+    GLubyte * dst = uniformRing.Allocate( tbl, size, uniformAlignment, uniformOffset );
+    RegalAssert( dst );
+    memcpy( dst, &uniformShadow[0], size );
+#if REGAL_STATISTICS
+    if (ctx->statistics)
+      ctx->statistics->iff_uniform_block_upload++;
+#endif
+  }
+
+  // glBindBufferRange also changes the generic binding, which
+  // belongs to the application, ARB_multi_bind leaves it alone.
+
+  if ( uniformMultiBind )
+  {
+    GLuint buffer = uniformRing.buffer;
+    tbl.call(&tbl.glBindBuffersRange)( GL_UNIFORM_BUFFER, uniformBinding, 1, &buffer, &uniformOffset, &size );
+  }
+  else
+  {
+    tbl.call(&tbl.glBindBufferRange)( GL_UNIFORM_BUFFER, uniformBinding, uniformRing.buffer, uniformOffset, size );
+    tbl.call(&tbl.glBindBuffer)( GL_UNIFORM_BUFFER, shadowUniformBuffer );
+  }
+#if REGAL_STATISTICS
+  if (ctx->statistics)
+    ctx->statistics->iff_uniform_block_bind++;
+#endif
+}
+
+// Move the generated uniform declarations that are members of the
+// fixed-function uniform block into the block itself.
+
+string Iff::FixedFunctionSource( const string & src ) const
+{
+  if ( !uniformBuffer )
+    return src;
+
+  string dst;
+  dst.reserve( src.size() + uniformBlockSource.size() );
+  size_t pos = 0;
+  bool first = true;
+  while ( pos < src.size() )
+  {
+    size_t end = src.find( '\n', pos );
+    end = end == string::npos ? src.size() : end + 1;
+    const string line = src.substr( pos, end - pos );
+    pos = end;
+
+    if ( line.compare( 0, 8, "uniform " ) == 0 )
+    {
+      size_t begin = line.find( ' ', 8 );
+      if ( begin != string::npos )
+      {
+        begin++;
+        const string name = line.substr( begin, line.find_first_of( " [;", begin ) - begin );
+        if ( uniformBlockSource.find( " " + name + ";" ) != string::npos ||
+             uniformBlockSource.find( " " + name + "[" ) != string::npos )
+          continue;
+      }
+    }
+
+    dst += line;
+
+    // The block follows the #version directive
+    if ( first )
+    {
+      dst += uniformBlockSource;
+      first = false;
+    }
+  }
+  return dst;
+}
+
 // a debug routine for forcing instanced program's uniforms to be updated
 void Iff::ClearVersionsForProgram( RegalContext * ctx )
 {
@@ -4128,7 +5021,7 @@ inline bool operator == ( const Iff::State::Store & lhs, const Iff::State::Store
 }
 
 
-GLuint Iff::GetFixedFunctionStateHash() {
+GLuint64 Iff::GetFixedFunctionStateHash() {
   ffstate.Process( this );  // this early outs if version numbers match between raw and processed
   return ffstate.processed.hash;
 }
@@ -4137,59 +5030,217 @@ void Iff::UseFixedFunctionProgram( RegalContext * ctx )
 {
   Internal("Regal::Iff::UseFixedFunctionProgram", boost::print::optional(ctx,Logging::pointers));
 
-  if ( currprog != NULL && currprog->ver == ver.Current() )
+  if ( currprog != NULL && currprog != &ffuber && currprog->ver == ver.Current() )
   {
     return;
   }
   ffstate.Process( this );
-  uint32_t base = ( static_cast<uint32_t>(ffstate.processed.hash) & REGAL_FIXED_FUNCTION_PROGRAM_CACHE_MASK ) << REGAL_FIXED_FUNCTION_PROGRAM_CACHE_SET_BITS;
-  int match = -1;
-  const uint32_t n = static_cast<int>(array_size( ffprogs ));
-  for ( uint32_t i = 0; i < REGAL_FIXED_FUNCTION_PROGRAM_CACHE_SET; i++ )
+
+  // The 64-bit hash finds the candidate, comparing the full
+  // state guards against collisions.
+
+  const GLuint64 hash = ffstate.processed.hash;
+  ProgramMap::iterator i = ffprogsMap.find( hash );
+  if ( i != ffprogsMap.end() && i->second->store == ffstate.processed )
   {
-    RegalAssertArrayIndex( ffprogs, base + i );
-    if ( base + i >= n )
-      continue;
-    if ( ffprogs[ base + i ].store == ffstate.processed )
-    {
-      match = i;
-      break;
-    }
+    ffprogs.splice( ffprogs.begin(), ffprogs, i->second );
+#if REGAL_STATISTICS
+    if (ctx->statistics)
+      ctx->statistics->iff_program_cache_hit++;
+#endif
   }
-  Program * p = NULL;
-  if ( match < 0 )
+  else
   {
-    match = 0;
+#if REGAL_STATISTICS
+    if (ctx->statistics)
+      ctx->statistics->iff_program_cache_miss++;
+#endif
     progcount++;
-    for ( int i = 1; i < REGAL_FIXED_FUNCTION_PROGRAM_CACHE_SET; i++ )
+
+    // A colliding program is replaced, otherwise make room by
+    // evicting the least recently used programs.
+
+    if ( i != ffprogsMap.end() )
+      EvictFixedFunctionProgram( ctx, i->second );
+
+    if ( Config::iffProgramCacheSize > 0 )
     {
-      RegalAssertArrayIndex( ffprogs, base + i );
-      RegalAssertArrayIndex( ffprogs, base + match );
-      if ( ffprogs[ base + i ].ver < ffprogs[ base + match ].ver )
-      {
-        match = i;
-      }
+      while ( !ffprogs.empty() && ffprogs.size() >= static_cast<size_t>(Config::iffProgramCacheSize) )
+        EvictFixedFunctionProgram( ctx, --ffprogs.end() );
     }
-    RegalAssertArrayIndex( ffprogs, base + match );
-    p = & ffprogs[ base + match ];
-    // delete this program
-    if ( p->pg != 0 )
+
+    ffprogs.push_front( Program() );
+    InitFixedFunctionProgram( ctx, ffprogs.front() );
+    ffprogs.front().progcount = progcount;
+    ffprogsMap[ hash ] = ffprogs.begin();
+  }
+
+  if ( !FinishFixedFunctionProgram( ctx, ffprogs.front() ) )
+  {
+    UseUberProgram( ctx );
+    return;
+  }
+
+  currprog = & ffprogs.front();
+  ctx->dispatcher.emulation.glUseProgram( currprog->pg );
+  if ( uniformBuffer )
+    UpdateUniformBuffer( ctx );
+  UpdateUniforms( ctx );
+}
+
+void Iff::InitFixedFunctionProgram( RegalContext * ctx, Program & p )
+{
+  Internal("Regal::Iff::InitFixedFunctionProgram", boost::print::optional(ctx,Logging::pointers));
+
+  // Try the on-disk program binary cache before compiling
+
+  bool loaded = false;
+  uint64_t hash = 0;
+  string key;
+  if ( programBinary )
+  {
+    GLenum format = GL_NONE;
+    string binary;
+    hash = ProgramBinaryKey( ffstate.processed, key );
+    loaded = Cache::readProgramBinary( hash, key.data(), key.size(), format, binary ) &&
+             p.InitBinary( ctx, ffstate.processed, format, binary );
+#if REGAL_STATISTICS
+    if (ctx->statistics)
     {
-      DispatchTableGL & tbl = ctx->dispatcher.emulation;
-      tbl.call(&tbl.glDeleteShader)( p->vs );
-      tbl.call(&tbl.glDeleteShader)( p->fs );
-      tbl.call(&tbl.glDeleteProgram)( p->pg );
-      *p = Program();
+      if (loaded)
+        ctx->statistics->iff_program_binary_hit++;
+      else
+        ctx->statistics->iff_program_binary_miss++;
     }
+#endif
+  }
+
+  if ( !loaded )
+  {
     GLuint vs = CreateFixedFunctionVertexShader( ctx );
     GLuint fs = CreateFixedFunctionFragmentShader( ctx );
-    p->Init( ctx, ffstate.processed, vs, fs );
-    p->progcount = progcount;
+    p.Link( ctx, ffstate.processed, vs, fs );
+
+    if ( asyncCompile )
+    {
+      p.pending = true;
+#if REGAL_STATISTICS
+      if (ctx->statistics)
+        ctx->statistics->iff_program_async_compile++;
+#endif
+      return;
+    }
+
+    p.Finish( ctx );
+    WriteFixedFunctionProgramBinary( ctx, p );
   }
-  RegalAssertArrayIndex( ffprogs, base + match );
-  currprog = & ffprogs[ base + match ];
-  ctx->dispatcher.emulation.glUseProgram( currprog->pg );
+}
+
+bool Iff::FinishFixedFunctionProgram( RegalContext * ctx, Program & p )
+{
+  if ( !p.pending )
+    return true;
+
+  DispatchTableGL & tbl = ctx->dispatcher.emulation;
+  GLint complete = GL_FALSE;
+  tbl.call(&tbl.glGetProgramiv)( p.pg, GL_COMPLETION_STATUS_KHR, &complete );
+  if ( !complete )
+    return false;
+
+  p.Finish( ctx );
+  WriteFixedFunctionProgramBinary( ctx, p );
+  return true;
+}
+
+void Iff::WriteFixedFunctionProgramBinary( RegalContext * ctx, Program & p )
+{
+  if ( !programBinary )
+    return;
+
+  string key;
+  const uint64_t hash = ProgramBinaryKey( p.store, key );
+
+  GLenum format = GL_NONE;
+  string binary;
+  if ( p.GetBinary( ctx, format, binary ) &&
+       Cache::writeProgramBinary( hash, key.data(), key.size(), format, binary ) )
+  {
+#if REGAL_STATISTICS
+    if (ctx->statistics)
+      ctx->statistics->iff_program_binary_write++;
+#endif
+  }
+}
+
+void Iff::UseUberProgram( RegalContext * ctx )
+{
+  Internal("Regal::Iff::UseUberProgram", boost::print::optional(ctx,Logging::pointers));
+
+  DispatchTableGL & tbl = ctx->dispatcher.emulation;
+
+  if ( !ffuber.pg )
+  {
+    string_list vsSrc;
+    string_list fsSrc;
+    GenerateUberVertexShaderSource( this, vsSrc );
+    GenerateUberFragmentShaderSource( this, fsSrc );
+
+    GLuint vs = 0;
+    GLuint fs = 0;
+    Program::Shader( ctx, tbl, GL_VERTEX_SHADER,   vs, FixedFunctionSource( vsSrc.str() ).c_str() );
+    Program::Shader( ctx, tbl, GL_FRAGMENT_SHADER, fs, FixedFunctionSource( fsSrc.str() ).c_str() );
+
+    // A state with color and texture coordinate arrays enabled
+    // so that Program::Attribs binds all of the uber attributes.
+
+    State::Store store;
+    RegalAssertArrayIndex( ffAttrMap, RFF2A_Color );
+    store.attrArrayFlags = 1 << ffAttrMap[ RFF2A_Color ];
+    store.tex[0].enables = TT_2D;
+
+    ffuber.Init( ctx, store, vs, fs );
+    ffuberFlags = tbl.call(&tbl.glGetUniformLocation)( ffuber.pg, "rglUberFlags" );
+  }
+
+  const State::Store & st = ffstate.processed;
+  const bool colorArray = ( st.attrArrayFlags & ( 1 << ffAttrMap[ RFF2A_Color ] ) ) && ( st.lighting == false || st.colorMaterial );
+  const bool texture0   = st.tex[0].enables == TT_2D;
+
+  currprog = & ffuber;
+  tbl.glUseProgram( ffuber.pg );
+  if ( ffuberFlags >= 0 )
+    tbl.glUniform4f( ffuberFlags, colorArray ? 1.0f : 0.0f, texture0 ? 1.0f : 0.0f, 0.0f, 0.0f );
+  if ( uniformBuffer )
+    UpdateUniformBuffer( ctx );
   UpdateUniforms( ctx );
+
+#if REGAL_STATISTICS
+  if (ctx->statistics)
+    ctx->statistics->iff_program_uber_draw++;
+#endif
+}
+
+void Iff::EvictFixedFunctionProgram( RegalContext * ctx, ProgramList::iterator i )
+{
+  Internal("Regal::Iff::EvictFixedFunctionProgram", boost::print::optional(ctx,Logging::pointers));
+
+  RegalAssert( i != ffprogs.end() );
+
+  if ( &*i == currprog )
+    currprog = NULL;
+
+  DispatchTableGL & tbl = ctx->dispatcher.emulation;
+  tbl.call(&tbl.glDeleteShader)( i->vs );
+  tbl.call(&tbl.glDeleteShader)( i->fs );
+  tbl.call(&tbl.glDeleteProgram)( i->pg );
+
+  ffprogsMap.erase( i->store.hash );
+  ffprogs.erase( i );
+
+#if REGAL_STATISTICS
+  if (ctx->statistics)
+    ctx->statistics->iff_program_cache_evict++;
+#endif
 }
 
 GLuint Iff::CreateFixedFunctionVertexShader( RegalContext * ctx ) {
@@ -4197,7 +5248,7 @@ GLuint Iff::CreateFixedFunctionVertexShader( RegalContext * ctx ) {
   string_list vsSrc;
   GenerateVertexShaderSource( this, ffstate, vsSrc );
   GLuint vs;
-  Program::Shader( ctx, ctx->dispatcher.emulation, GL_VERTEX_SHADER, vs, vsSrc.str().c_str() );
+  Program::Shader( ctx, ctx->dispatcher.emulation, GL_VERTEX_SHADER, vs, FixedFunctionSource( vsSrc.str() ).c_str() );
   return vs;
 }
 
@@ -4206,7 +5257,7 @@ GLuint Iff::CreateFixedFunctionFragmentShader( RegalContext * ctx ) {
   string_list fsSrc;
   GenerateFragmentShaderSource( this, fsSrc );
   GLuint fs;
-  Program::Shader( ctx, ctx->dispatcher.emulation, GL_FRAGMENT_SHADER, fs, fsSrc.str().c_str() );
+  Program::Shader( ctx, ctx->dispatcher.emulation, GL_FRAGMENT_SHADER, fs, FixedFunctionSource( fsSrc.str() ).c_str() );
   return fs;
 }
 
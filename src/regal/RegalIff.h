@@ -43,14 +43,8 @@
 #include "lookup3.h"
 
 #define REGAL_IMMEDIATE_BUFFER_SIZE 8192
-
-#define REGAL_FIXED_FUNCTION_PROGRAM_CACHE_SIZE_BITS 8
-#define REGAL_FIXED_FUNCTION_PROGRAM_CACHE_SET_BITS  2
-
-#define REGAL_FIXED_FUNCTION_PROGRAM_CACHE_SIZE  (1<<REGAL_FIXED_FUNCTION_PROGRAM_CACHE_SIZE_BITS)
-#define REGAL_FIXED_FUNCTION_PROGRAM_CACHE_SET   (1<<REGAL_FIXED_FUNCTION_PROGRAM_CACHE_SET_BITS)
-#define REGAL_FIXED_FUNCTION_PROGRAM_CACHE_MASK  ((1<<(REGAL_FIXED_FUNCTION_PROGRAM_CACHE_SIZE_BITS-REGAL_FIXED_FUNCTION_PROGRAM_CACHE_SET_BITS))-1)
-
+#define REGAL_UNIFORM_BUFFER_SIZE   (1<<20)
+#define REGAL_IMMEDIATE_STREAM_SIZE (16<<20)
 
 #define REGAL_FIXED_FUNCTION_MATRIX_STACK_DEPTH 128
 #define REGAL_FIXED_FUNCTION_MAX_LIGHTS           8
@@ -64,6 +58,7 @@ REGAL_GLOBAL_BEGIN
 #include <cstring>
 
 #include <map>
+#include <list>
 #include <vector>
 #include <string>
 #include <algorithm>
@@ -77,6 +72,7 @@ REGAL_GLOBAL_BEGIN
 #include "RegalSharedMap.h"
 #include "RegalFloat4.h"
 #include "RegalShaderInstance.h"
+#include "RegalRingBuffer.h"
 #include "linear.h"
 
 REGAL_GLOBAL_END
@@ -826,18 +822,60 @@ struct Iff
   GLuint  immVao;
   GLuint  immShadowVao;
 
+  // Streaming of immediate mode vertices through a persistently
+  // mapped ring buffer.  Only the attributes written between
+  // glBegin and glEnd are packed per vertex, with immLayout the
+  // number of floats for each attribute.  The others are sourced
+  // from a single copy of immVab with a vertex binding divisor.
+  // immSize is the number of components of each current value,
+  // immBoundLayout is the layout last specified to GL.
+
+  bool       immStream;
+  RingBuffer immRing;
+  GLuint     immSize[ REGAL_EMU_MAX_VERTEX_ATTRIBS ];
+  GLuint     immLayout[ REGAL_EMU_MAX_VERTEX_ATTRIBS ];
+  GLuint     immBoundLayout[ REGAL_EMU_MAX_VERTEX_ATTRIBS ];
+  GLuint     immPacked[ REGAL_EMU_MAX_VERTEX_ATTRIBS ];
+  GLuint     immPackedCount;
+  GLuint     immStride;
+  GLuint     immWritten;
+
+  // Batching of consecutive glBegin/glEnd blocks of the same list
+  // primitive.  glEnd leaves the vertices pending in immArray, with
+  // immVao still bound, until RestoreVao or a different glBegin.
+  // State calls go through FlushBatch, which draws a pending batch
+  // but leaves a glBegin in progress bound.  Within a glBegin,
+  // immBatchStart is the number of vertices from earlier blocks and
+  // immStateChanged defers the state to glEnd, as for glMaterial.
+  // immLevel is the emulation level below Iff, for drawing the
+  // batch from outside the emulation dispatch.
+
+  bool       immBatch;
+  bool       immPending;
+  GLuint     immBatchStart;
+  bool       immStateChanged;
+  int        immLevel;
+
   void InitImmediate(RegalContext &ctx);
+  void InitImmediateStream(RegalContext &ctx);
   void glDeleteVertexArrays( RegalContext * ctx, GLsizei n, const GLuint * arrays );
   void glDeleteBuffers( RegalContext * ctx, GLsizei n, const GLuint * buffers );
   GLboolean IsVertexArray( RegalContext * ctx, GLuint name );
   void glBindVertexArray( RegalContext *ctx, GLuint vao );
+  void ShadowBindBuffer( GLenum target, GLuint buffer );
   void ShadowClientActiveTexture( GLenum texture );
   void Begin( RegalContext * ctx, GLenum mode );
   void End( RegalContext * ctx );
   void RestoreVao( RegalContext * ctx );
+  void FlushBatch( RegalContext * ctx );
+  void SwapBuffers( RegalContext * ctx );
   void Flush( RegalContext * ctx );
+  void FlushStream( RegalContext * ctx );
   void Provoke( RegalContext * ctx );
+  void ImmediateLayout( RegalContext * ctx, GLuint idx, GLuint size );
+  void ImmediatePacking();
   void ProvokeElement( RegalContext * ctx, GLint i );
+  static GLuint ImmediateBatchVertices( GLenum mode );
 
   template <int N, bool Norm, typename T> void Attribute( RegalContext * ctx, GLuint idx, const T * v )
   {
@@ -847,6 +885,15 @@ struct Iff
       return;
     }
     RegalAssertArrayIndex( immVab, idx );
+    if (immPending && ( idx == immProvoking || ( immStream && immLayout[ idx ] < GLuint(N) ) ))
+      RestoreVao( ctx );
+    if (immStream && immActive && !immPending)
+    {
+      if (immLayout[ idx ] < GLuint(N))
+        ImmediateLayout( ctx, idx, N );
+      immWritten |= 1u << idx;
+    }
+    immSize[ idx ] = N;
     Float4 & a = immVab[ idx ];
     a.x = ToFloat<Norm>( v[0] );
     a.y = N > 1 ? ToFloat<Norm>( v[1] ) : 0.0f;
@@ -1299,7 +1346,7 @@ struct Iff
       }
 
       GLuint64  ver;
-      GLuint    hash;
+      GLuint64  hash;
       Light     light[ REGAL_FIXED_FUNCTION_MAX_LIGHTS ];
       Texture   tex[ REGAL_EMU_MAX_TEXTURE_UNITS ];
       bool      clipPlaneEnabled[ REGAL_FIXED_FUNCTION_MAX_CLIP_PLANES ];
@@ -1511,6 +1558,7 @@ struct Iff
       , fs(0)
       , pginst(0)
       , instanced(false)
+      , pending(false)
       , progcount(0)
     {
     }
@@ -1521,12 +1569,17 @@ struct Iff
     GLuint   fs;
     GLuint   pginst;
     bool     instanced;
+    bool     pending;    // linking in the background, see Iff::asyncCompile
     int      progcount;
 
     UniformMap uniforms;
     State::Store store;
 
     void Init( RegalContext * ctx, const State::Store & sstore, GLuint vshd, GLuint fshd );
+    void Link( RegalContext * ctx, const State::Store & sstore, GLuint vshd, GLuint fshd );
+    void Finish( RegalContext * ctx );
+    bool InitBinary( RegalContext * ctx, const State::Store & sstore, GLenum format, const std::string & binary );
+    bool GetBinary( RegalContext * ctx, GLenum & format, std::string & binary ) const;
     static void Shader( RegalContext * ctx, DispatchTableGL & tbl, GLenum type, GLuint & shader, const GLchar *src );
     void Attribs( RegalContext * ctx );
     void UserShaderModeAttribs( RegalContext * ctx );
@@ -1554,7 +1607,15 @@ struct Iff
   Version ver;
   State ffstate;
 
-  Program  ffprogs[ REGAL_FIXED_FUNCTION_PROGRAM_CACHE_SIZE ];
+  // Fixed-function programs, most recently used at the front.
+  // ffprogsMap indexes the list by State::Store hash, and
+  // Config::iffProgramCacheSize limits the number of programs.
+
+  typedef std::list<Program>                        ProgramList;
+  typedef std::map<GLuint64, ProgramList::iterator> ProgramMap;
+
+  ProgramList ffprogs;
+  ProgramMap  ffprogsMap;
 
   shared_map<GLuint, GLenum> textureObjToFmt;
 
@@ -1573,7 +1634,44 @@ struct Iff
   bool gles;   // what about ES1?
   bool legacy; // 2.x mac
 
+  // Persistent program binary cache, see RegalCacheProgram.h
+  // programBinaryEnv identifies the driver and the parts of
+  // Iff state (other than State::Store) that affect codegen.
+
+  bool        programBinary;
+  std::string programBinaryEnv;
+
+  // Background compilation via KHR/ARB_parallel_shader_compile.
+  // While a program is pending, draws use the generic ffuber program.
+
+  bool        asyncCompile;
+  Program     ffuber;
+  GLint       ffuberFlags;
+
+  // Fixed-function uniforms packed into a std140 uniform block,
+  // shared by all of the fixed-function programs.  Each update is
+  // written to a new range of uniformRing, so that switching
+  // programs only needs the range to be bound.  The slot of each
+  // uniformBlock entry is a byte offset into uniformShadow.
+  // Without ARB_multi_bind, binding the range also changes the
+  // generic binding, restored from shadowUniformBuffer.
+
+  bool                 uniformBuffer;
+  bool                 uniformMultiBind;
+  GLuint               shadowUniformBuffer;
+  RingBuffer           uniformRing;
+  GLuint               uniformBinding;
+  GLint                uniformAlignment;
+  GLintptr             uniformOffset;
+  GLuint64             uniformVer;
+  UniformMap           uniformBlock;
+  std::vector<GLubyte> uniformShadow;
+  std::string          uniformBlockSource;
+
   void InitFixedFunction(RegalContext &ctx);
+  void InitProgramBinary(RegalContext &ctx);
+  void InitUniformBuffer(RegalContext &ctx);
+  uint64_t ProgramBinaryKey( const State::Store & store, std::string & key ) const;
   void PreDraw( RegalContext * ctx );
   void SetCurrentMatrixStack( GLenum mode );
   bool ShadowMatrixMode( GLenum mode );
@@ -2086,6 +2184,9 @@ struct Iff
       case GL_CURRENT_PROGRAM:
         *param = ((program != 0) ? GL_TRUE : GL_FALSE);
         break;
+      case GL_VERTEX_ARRAY_BINDING:
+        *param = ((immShadowVao != 0) ? GL_TRUE : GL_FALSE);
+        break;
       case GL_MAX_MODELVIEW_STACK_DEPTH:
       case GL_MAX_PROJECTION_STACK_DEPTH:
       case GL_MAX_TEXTURE_STACK_DEPTH:
@@ -2216,6 +2317,9 @@ struct Iff
       case GL_CURRENT_PROGRAM:
         *params = static_cast<T>(program);
         break;
+      case GL_VERTEX_ARRAY_BINDING:
+        *params = static_cast<T>(immShadowVao);
+        break;
       case GL_MAX_MODELVIEW_STACK_DEPTH:
       case GL_MAX_PROJECTION_STACK_DEPTH:
       case GL_MAX_TEXTURE_STACK_DEPTH:
@@ -2409,11 +2513,19 @@ struct Iff
   void EnableArray( RegalContext * ctx, GLuint index );
   void DisableArray( RegalContext * ctx, GLuint index );
   void UpdateUniforms( RegalContext * ctx );
+  void UpdateUniforms( RegalContext * ctx, UniformMap & umap, GLubyte * block );
+  void UpdateUniformBuffer( RegalContext * ctx );
+  std::string FixedFunctionSource( const std::string & src ) const;
   void ClearVersionsForProgram( RegalContext *ctx );
-  GLuint GetFixedFunctionStateHash();
+  GLuint64 GetFixedFunctionStateHash();
   GLuint CreateFixedFunctionVertexShader( RegalContext * ctx );
   GLuint CreateFixedFunctionFragmentShader( RegalContext * ctx );
   void UseFixedFunctionProgram( RegalContext * ctx );
+  void InitFixedFunctionProgram( RegalContext * ctx, Program & p );
+  bool FinishFixedFunctionProgram( RegalContext * ctx, Program & p );
+  void WriteFixedFunctionProgramBinary( RegalContext * ctx, Program & p );
+  void UseUberProgram( RegalContext * ctx );
+  void EvictFixedFunctionProgram( RegalContext * ctx, ProgramList::iterator i );
   void UseShaderProgram( RegalContext * ctx );
   void ShaderSource( RegalContext *ctx, GLuint shader, GLsizei count, const GLchar * const * string, const GLint *length);
   void LinkProgram( RegalContext *ctx, GLuint program );
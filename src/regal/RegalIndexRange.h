@@ -0,0 +1,365 @@
+/*
+  Copyright (c) 2011-2013 NVIDIA Corporation
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+    Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+  IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+  OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+  OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+
+ Regal index range scanning
+
+ Smallest and largest vertex index referenced by an element array,
+ skipping the primitive restart index, with SSE2 kernels for
+ 8, 16 and 32-bit indices.
+
+ */
+
+#ifndef __REGAL_INDEX_RANGE_H__
+#define __REGAL_INDEX_RANGE_H__
+
+#include "RegalUtil.h"
+
+#if REGAL_EMULATION
+
+REGAL_GLOBAL_BEGIN
+
+#include <cstring>
+
+#include <GL/Regal.h>
+
+#include "RegalThread.h"
+#include "RegalSharedPtr.h"
+
+#ifndef REGAL_INDEX_RANGE_SSE2
+# if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  define REGAL_INDEX_RANGE_SSE2 1
+# else
+#  define REGAL_INDEX_RANGE_SSE2 0
+# endif
+#endif
+
+#if REGAL_INDEX_RANGE_SSE2
+#include <emmintrin.h>
+#endif
+
+REGAL_GLOBAL_END
+
+REGAL_NAMESPACE_BEGIN
+
+namespace Emu {
+
+// Range of indices referenced by a draw.  min > max if every index
+// was the restart index, or count was zero.
+
+struct IndexRange
+{
+  IndexRange() : min(~GLuint(0)), max(0) {}
+  IndexRange(GLuint lo, GLuint hi) : min(lo), max(hi) {}
+
+  bool empty() const { return min > max; }
+
+  GLuint min;
+  GLuint max;
+};
+
+// Portable version, also used for the tail of the SIMD kernels
+
+template<typename T>
+inline void IndexRangeScalar(const T *indices, size_t count, GLuint restartIdx, bool restart, IndexRange &range)
+{
+  GLuint lo = range.min;
+  GLuint hi = range.max;
+  if (restart)
+  {
+    for (size_t i = 0; i < count; ++i)
+    {
+      const GLuint j = indices[i];
+      if (j == restartIdx)
+        continue;
+      if (j < lo) lo = j;
+      if (j > hi) hi = j;
+    }
+  }
+  else
+  {
+    for (size_t i = 0; i < count; ++i)
+    {
+      const GLuint j = indices[i];
+      if (j < lo) lo = j;
+      if (j > hi) hi = j;
+    }
+  }
+  range.min = lo;
+  range.max = hi;
+}
+
+#if REGAL_INDEX_RANGE_SSE2
+
+// Restart indices are masked to the identity of each reduction,
+// all ones for min and zero for max.  SSE2 only has unsigned byte
+// min/max, so 16 and 32-bit lanes are biased into signed range.
+
+struct IndexRangeSse2
+{
+  static inline void reduce(const __m128i lo, const __m128i hi, GLuint bias, size_t lanes, size_t size, IndexRange &range)
+  {
+    GLubyte l[16], h[16];
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(l), lo);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(h), hi);
+    for (size_t i = 0; i < lanes; ++i)
+    {
+      GLuint a = 0, b = 0;
+      std::memcpy(&a, l + i * size, size);
+      std::memcpy(&b, h + i * size, size);
+      a ^= bias;
+      b ^= bias;
+      if (a < range.min) range.min = a;
+      if (b > range.max) range.max = b;
+    }
+  }
+
+  static inline __m128i min32(const __m128i a, const __m128i b)
+  {
+    const __m128i gt = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(gt, b), _mm_andnot_si128(gt, a));
+  }
+
+  static inline __m128i max32(const __m128i a, const __m128i b)
+  {
+    const __m128i gt = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(gt, a), _mm_andnot_si128(gt, b));
+  }
+
+  static size_t scan(const GLubyte *indices, size_t count, GLuint restartIdx, bool restart, IndexRange &range)
+  {
+    const size_t n = count & ~size_t(15);
+    __m128i lo = _mm_set1_epi8(char(0xff));
+    __m128i hi = _mm_setzero_si128();
+    const __m128i r = _mm_set1_epi8(char(restartIdx));
+    for (size_t i = 0; i < n; i += 16)
+    {
+      const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(indices + i));
+      const __m128i m = restart ? _mm_cmpeq_epi8(v, r) : _mm_setzero_si128();
+      lo = _mm_min_epu8(lo, _mm_or_si128(v, m));
+      hi = _mm_max_epu8(hi, _mm_andnot_si128(m, v));
+    }
+    if (n)
+      reduce(lo, hi, 0, 16, 1, range);
+    return n;
+  }
+
+  static size_t scan(const GLushort *indices, size_t count, GLuint restartIdx, bool restart, IndexRange &range)
+  {
+    const size_t n = count & ~size_t(7);
+    const __m128i bias = _mm_set1_epi16(short(0x8000));
+    __m128i lo = _mm_set1_epi16(0x7fff);
+    __m128i hi = bias;
+    const __m128i r = _mm_set1_epi16(short(restartIdx));
+    for (size_t i = 0; i < n; i += 8)
+    {
+      const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(indices + i));
+      const __m128i m = restart ? _mm_cmpeq_epi16(v, r) : _mm_setzero_si128();
+      lo = _mm_min_epi16(lo, _mm_xor_si128(_mm_or_si128(v, m), bias));
+      hi = _mm_max_epi16(hi, _mm_xor_si128(_mm_andnot_si128(m, v), bias));
+    }
+    if (n)
+      reduce(lo, hi, 0x8000, 8, 2, range);
+    return n;
+  }
+
+  static size_t scan(const GLuint *indices, size_t count, GLuint restartIdx, bool restart, IndexRange &range)
+  {
+    const size_t n = count & ~size_t(3);
+    const __m128i bias = _mm_set1_epi32(int(0x80000000));
+    __m128i lo = _mm_set1_epi32(0x7fffffff);
+    __m128i hi = bias;
+    const __m128i r = _mm_set1_epi32(int(restartIdx));
+    for (size_t i = 0; i < n; i += 4)
+    {
+      const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(indices + i));
+      const __m128i m = restart ? _mm_cmpeq_epi32(v, r) : _mm_setzero_si128();
+      lo = min32(lo, _mm_xor_si128(_mm_or_si128(v, m), bias));
+      hi = max32(hi, _mm_xor_si128(_mm_andnot_si128(m, v), bias));
+    }
+    if (n)
+      reduce(lo, hi, 0x80000000, 4, 4, range);
+    return n;
+  }
+};
+
+#endif
+
+template<typename T>
+inline IndexRange IndexRangeScan(const T *indices, size_t count, GLuint restartIdx, bool restart)
+{
+  // A restart index that T cannot represent never matches
+
+  if (restart && restartIdx > GLuint(T(~T(0))))
+    restart = false;
+
+  IndexRange range;
+  size_t done = 0;
+#if REGAL_INDEX_RANGE_SSE2
+  done = IndexRangeSse2::scan(indices, count, restartIdx, restart, range);
+#endif
+  IndexRangeScalar(indices + done, count - done, restartIdx, restart, range);
+
+  if (range.min > range.max)
+    range = IndexRange();
+  return range;
+}
+
+inline IndexRange IndexRangeScan(GLenum type, const GLvoid *indices, size_t count, GLuint restartIdx, bool restart)
+{
+  switch (type)
+  {
+    case GL_UNSIGNED_BYTE:
+      return IndexRangeScan(static_cast<const GLubyte  *>(indices), count, restartIdx, restart);
+    case GL_UNSIGNED_SHORT:
+      return IndexRangeScan(static_cast<const GLushort *>(indices), count, restartIdx, restart);
+    case GL_UNSIGNED_INT:
+      return IndexRangeScan(static_cast<const GLuint   *>(indices), count, restartIdx, restart);
+    default:
+      return IndexRange();
+  }
+}
+
+// Small direct-mapped memo of index ranges for element array buffers,
+// keyed by buffer, offset, count, type and restart state.  Entries are
+// stamped with a generation that is advanced whenever buffer contents
+// may have changed, which invalidates the whole cache at once.
+//
+// Buffer objects are shared, so the generation and the enable are
+// shared by the caches of every context in a share group.  A write in
+// one context invalidates the entries of all of them.
+
+struct IndexRangeCache
+{
+  enum { size = 64 };
+
+  struct Entry
+  {
+    Entry() : buffer(0), offset(0), count(0), type(GL_NONE), restartIdx(0), restart(false), generation(0) {}
+
+    GLuint     buffer;
+    GLintptr   offset;
+    GLsizei    count;
+    GLenum     type;
+    GLuint     restartIdx;
+    bool       restart;
+    long       generation;
+    IndexRange range;
+  };
+
+  struct Shared
+  {
+    Shared() : generation(1), enabled(1) {}
+
+    volatile long generation;
+    volatile long enabled;
+  };
+
+  IndexRangeCache() : shared(new Shared()) {}
+
+  void Share(const IndexRangeCache &other)
+  {
+    shared = other.shared;
+  }
+
+  void Invalidate()
+  {
+    Thread::atomicAdd(shared->generation, 1);
+  }
+
+  void Disable()
+  {
+    Thread::storeRelease(shared->enabled, 0L);
+    Invalidate();
+  }
+
+  bool Enabled() const
+  {
+    return Thread::loadAcquire(shared->enabled) != 0;
+  }
+
+  // Taken before the indices are read, so that a write by another
+  // context during the scan leaves the entry stale rather than current.
+
+  long Generation() const
+  {
+    return Thread::loadAcquire(shared->generation);
+  }
+
+  static size_t slot(GLuint buffer, GLintptr offset, GLsizei count, GLenum type)
+  {
+    GLuint64 h = (GLuint64(buffer) << 32) ^ GLuint64(offset) ^ (GLuint64(count) << 16) ^ type;
+    h *= 0x9e3779b97f4a7c15ull;
+    return size_t(h >> 58) & (size - 1);
+  }
+
+  bool Lookup(GLuint buffer, GLintptr offset, GLsizei count, GLenum type, GLuint restartIdx, bool restart, IndexRange &range) const
+  {
+    if (!Enabled())
+      return false;
+
+    const Entry &e = entries[slot(buffer, offset, count, type)];
+    if (e.generation != Generation() || e.buffer != buffer || e.offset != offset || e.count != count ||
+        e.type != type || e.restart != restart || (restart && e.restartIdx != restartIdx))
+      return false;
+
+    range = e.range;
+    return true;
+  }
+
+  void Insert(GLuint buffer, GLintptr offset, GLsizei count, GLenum type, GLuint restartIdx, bool restart, const IndexRange &range)
+  {
+    Insert(buffer, offset, count, type, restartIdx, restart, Generation(), range);
+  }
+
+  void Insert(GLuint buffer, GLintptr offset, GLsizei count, GLenum type, GLuint restartIdx, bool restart, long generation, const IndexRange &range)
+  {
+    if (!Enabled())
+      return;
+
+    Entry &e = entries[slot(buffer, offset, count, type)];
+    e.buffer     = buffer;
+    e.offset     = offset;
+    e.count      = count;
+    e.type       = type;
+    e.restartIdx = restartIdx;
+    e.restart    = restart;
+    e.generation = generation;
+    e.range      = range;
+  }
+
+  Entry              entries[size];
+  shared_ptr<Shared> shared;
+};
+
+}
+
+REGAL_NAMESPACE_END
+
+#endif // REGAL_EMULATION
+
+#endif // ! __REGAL_INDEX_RANGE_H__
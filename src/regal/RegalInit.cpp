@@ -49,11 +49,14 @@ using namespace std;
 #include "RegalConfig.h"
 #include "RegalContext.h"
 #include "RegalThread.h"
+#include "RegalLogRing.h"
 #include "RegalDispatcher.h"
 #include "RegalContextInfo.h"
 #include "RegalEmuInfo.h"
 #include "RegalPpa.h"
 #include "RegalMutex.h"
+#include "RegalSnapshotMap.h"
+#include "RegalCacheTexture.h"
 
 #if REGAL_TRACE
 namespace trace { extern const char *regalWriterFileName; }
@@ -81,8 +84,12 @@ extern "C" { static void (__stdcall * myDeleteDC   )(void *) = DeleteDC;    }
 extern "C" { static void (__stdcall * myGetFocus   )(void  ) = GetFocus;    }
 #endif
 
-typedef map<RegalSystemContext, RegalContext *> SC2RC;
-typedef map<Thread::Thread,     RegalContext *> TH2RC;
+// System contexts are looked up on every makeCurrent, from any
+// thread, so that map is read without locking.  sc2rcMutex
+// serializes context creation and destruction.
+
+typedef Thread::SnapshotMap<RegalSystemContext, RegalContext *> SC2RC;
+typedef map<Thread::Thread, RegalContext *>                      TH2RC;
 
 SC2RC sc2rc;
 TH2RC th2rc;
@@ -183,6 +190,9 @@ Init::~Init()
 #if REGAL_HTTP
   Http::Stop();
   Http::Cleanup();
+#endif
+#if REGAL_CACHE
+  Cache::flushTextures();
 #endif
   Logging::Cleanup();
 
@@ -222,22 +232,29 @@ Init::getContext(RegalSystemContext sysCtx)
 {
   RegalAssert(sysCtx);
 
-  Thread::ScopedLock lock(sc2rcMutex);
-  SC2RC::iterator i = sc2rc.find(sysCtx);
-  if (i!=sc2rc.end())
+  RegalContext *context = NULL;
+  if (sc2rc.find(sysCtx,context))
   {
     Internal("Init::context", "lookup for sysCtx=",boost::print::optional(sysCtx,Logging::pointers));
-    return i->second;
+    return context;
   }
-  else
+
+  // Check again with the lock held, another thread may
+  // have created it since.
+
+  Thread::ScopedLock lock(sc2rcMutex);
+  if (sc2rc.find(sysCtx,context))
   {
-    Internal("Init::context", "factory for sysCtx=",boost::print::optional(sysCtx,Logging::pointers));
-    RegalContext *context = new RegalContext();
-    RegalAssert(context);
-    sc2rc[sysCtx] = context;
-    context->sysCtx = sysCtx;
+    Internal("Init::context", "lookup for sysCtx=",boost::print::optional(sysCtx,Logging::pointers));
     return context;
   }
+
+  Internal("Init::context", "factory for sysCtx=",boost::print::optional(sysCtx,Logging::pointers));
+  context = new RegalContext();
+  RegalAssert(context);
+  context->sysCtx = sysCtx;
+  sc2rc.insert(sysCtx,context);
+  return context;
 }
 
 void
@@ -247,6 +264,12 @@ Init::setContext(RegalContext *context)
 
   Internal("Init::setContext","thread=",boost::print::optional(::boost::print::hex(Thread::threadId()),Logging::thread)," context=",boost::print::optional(context,Logging::pointers)," ",context ? context->info->version : "");
 
+  // Making the same context current again on the same thread
+  // changes nothing, so skip the thread map and its lock.
+
+  if (context && context->thread==thread && Thread::CurrentContext()==context)
+    return;
+
   // std::map lookup
 
   Thread::ScopedLock lock(th2rcMutex);
@@ -310,9 +333,33 @@ ThreadLocal ThreadLocal::_instance;
     #endif
   #else
     pthread_key_t ThreadLocal::_instanceKey(~0);
+    #if REGAL_THREAD_LOCAL
+      __thread ThreadLocal *ThreadLocal::_current = NULL;
+    #endif
   #endif
 #endif
 
+ThreadLocal::~ThreadLocal()
+{
+  #if REGAL_LOG_ASYNC
+    Logging::releaseRing(logRing);
+  #endif
+}
+
+#if !REGAL_NO_TLS && !REGAL_SYS_WGL
+
+// Thread exit, for the pthread key
+
+static void destroyThreadLocal(void *instance)
+{
+  #if REGAL_THREAD_LOCAL
+    ThreadLocal::_current = NULL;
+  #endif
+  delete static_cast<ThreadLocal *>(instance);
+}
+
+#endif
+
 struct ThreadLocalInit
 {
   ThreadLocalInit()
@@ -323,7 +370,7 @@ struct ThreadLocalInit
           ThreadLocal::_instanceIndex = TlsAlloc();
         #endif
       #else
-        pthread_key_create(&ThreadLocal::_instanceKey, NULL);
+        pthread_key_create(&ThreadLocal::_instanceKey, destroyThreadLocal);
       #endif
     #endif
   }
@@ -470,6 +517,18 @@ Init::makeCurrent(RegalSystemContext sysCtx)
       RegalAssert(context->initialized);
     }
 
+    // Follow changes to the compiled dispatch setting,
+    // JSON configuration may have changed it since.
+
+    DispatcherGL &dispatcher = context->dispatcher;
+    if (dispatcher.isEnabled(dispatcher.compiled)!=Config::dispatchCompiled)
+    {
+      if (Config::dispatchCompiled)
+        dispatcher.enable(dispatcher.compiled);
+      else
+        dispatcher.disable(dispatcher.compiled);
+    }
+
     setContext(context);
 
     return;
@@ -520,7 +579,8 @@ Init::getContextListingHTML(std::string &text)
   static const char *const br = "<br/>\n";
 
   Thread::ScopedLock lock(sc2rcMutex);
-  for (SC2RC::const_iterator i = sc2rc.begin(); i!=sc2rc.end(); ++i)
+  const SC2RC::Map &contexts = sc2rc.snapshot();
+  for (SC2RC::Map::const_iterator i = contexts.begin(); i!=contexts.end(); ++i)
   {
     RegalContext *ctx = i->second;
 
@@ -594,16 +654,16 @@ Init::getContextListingHTML(std::string &text)
 size_t
 Init::getNumContexts()
 {
-  Thread::ScopedLock lock(sc2rcMutex);
-  return sc2rc.size();
+  return SC2RC::Reader(sc2rc)->size();
 }
 
 RegalContext *
 Init::getContextByIndex(size_t index)
 {
   Thread::ScopedLock lock(sc2rcMutex);
+  const SC2RC::Map &contexts = sc2rc.snapshot();
   size_t i = 0;
-  for (SC2RC::iterator it = sc2rc.begin(); it!=sc2rc.end(); ++it)
+  for (SC2RC::Map::const_iterator it = contexts.begin(); it!=contexts.end(); ++it)
   {
     if( i == index ) {
       return it->second;
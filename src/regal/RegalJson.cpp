@@ -61,9 +61,17 @@ const Object parent[JSON_UNDEFINED+1] =
   JSON_REGAL_CONFIG_CACHE,
   JSON_REGAL_CONFIG_CACHE,
   JSON_REGAL_CONFIG_CACHE,
+  JSON_REGAL_CONFIG_CACHE,
+  JSON_REGAL_CONFIG_CACHE,
+  JSON_REGAL_CONFIG_CACHE,
+  JSON_REGAL_CONFIG_CACHE,
+  JSON_REGAL_CONFIG_CACHE,
+  JSON_REGAL_CONFIG_CACHE,
+  JSON_REGAL_CONFIG_CACHE,
   JSON_REGAL_CONFIG,
   JSON_REGAL_CONFIG,
   JSON_REGAL_CONFIG_DISPATCH,
+  JSON_REGAL_CONFIG_DISPATCH,
   JSON_REGAL_CONFIG_DISPATCH_EMULATION,
   JSON_REGAL_CONFIG_DISPATCH_EMULATION_ENABLE,
   JSON_REGAL_CONFIG_DISPATCH_EMULATION_ENABLE,
@@ -100,6 +108,15 @@ const Object parent[JSON_UNDEFINED+1] =
   JSON_REGAL_CONFIG_DISPATCH_EMULATION_FORCE,
   JSON_REGAL_CONFIG_DISPATCH_EMULATION_FORCE,
   JSON_REGAL_CONFIG_DISPATCH_EMULATION_FORCE,
+  JSON_REGAL_CONFIG_DISPATCH_EMULATION,
+  JSON_REGAL_CONFIG_DISPATCH_EMULATION_IFF,
+  JSON_REGAL_CONFIG_DISPATCH_EMULATION_IFF,
+  JSON_REGAL_CONFIG_DISPATCH_EMULATION_IFF,
+  JSON_REGAL_CONFIG_DISPATCH_EMULATION_IFF,
+  JSON_REGAL_CONFIG_DISPATCH_EMULATION_IFF,
+  JSON_REGAL_CONFIG_DISPATCH_EMULATION,
+  JSON_REGAL_CONFIG_DISPATCH_EMULATION_VAO,
+  JSON_REGAL_CONFIG_DISPATCH_EMULATION_VAO,
   JSON_REGAL_CONFIG_DISPATCH,
   JSON_REGAL_CONFIG_DISPATCH_ENABLE,
   JSON_REGAL_CONFIG_DISPATCH_ENABLE,
@@ -110,14 +127,22 @@ const Object parent[JSON_UNDEFINED+1] =
   JSON_REGAL_CONFIG_DISPATCH_ENABLE,
   JSON_REGAL_CONFIG_DISPATCH_ENABLE,
   JSON_REGAL_CONFIG_DISPATCH_ENABLE,
+  JSON_REGAL_CONFIG_DISPATCH_ENABLE,
   JSON_REGAL_CONFIG_DISPATCH,
   JSON_REGAL_CONFIG_DISPATCH_FORCE,
+  JSON_REGAL_CONFIG_DISPATCH,
   JSON_REGAL_CONFIG,
   JSON_REGAL_CONFIG_FORCE,
   JSON_REGAL_CONFIG_FORCE,
   JSON_REGAL_CONFIG_FORCE,
   JSON_REGAL_CONFIG,
   JSON_REGAL_CONFIG_FRAME,
+  JSON_REGAL_CONFIG_FRAME_ASYNC,
+  JSON_REGAL_CONFIG_FRAME_ASYNC,
+  JSON_REGAL_CONFIG_FRAME_ASYNC,
+  JSON_REGAL_CONFIG_FRAME_ASYNC,
+  JSON_REGAL_CONFIG_FRAME,
+  JSON_REGAL_CONFIG_FRAME,
   JSON_REGAL_CONFIG_FRAME,
   JSON_REGAL_CONFIG_FRAME_MD5,
   JSON_REGAL_CONFIG_FRAME_MD5,
@@ -151,6 +176,10 @@ const Object parent[JSON_UNDEFINED+1] =
   JSON_REGAL_LOGGING,
   JSON_REGAL_LOGGING,
   JSON_REGAL_LOGGING,
+  JSON_REGAL_LOGGING,
+  JSON_REGAL_LOGGING,
+  JSON_REGAL_LOGGING,
+  JSON_REGAL_LOGGING,
   JSON_REGAL_LOGGING_ENABLE,
   JSON_REGAL_LOGGING_ENABLE,
   JSON_REGAL_LOGGING_ENABLE,
@@ -214,23 +243,34 @@ Parser::onPush(const string &name)
     case JSON_REGAL_CONFIG_CACHE:
       if (name=="directory"   ) { current = JSON_REGAL_CONFIG_CACHE_DIRECTORY;                 return; }
       if (name=="enable"      ) { current = JSON_REGAL_CONFIG_CACHE_ENABLE;                    return; }
+      if (name=="glsl"        ) { current = JSON_REGAL_CONFIG_CACHE_GLSL;                      return; }
+      if (name=="program"     ) { current = JSON_REGAL_CONFIG_CACHE_PROGRAM;                   return; }
+      if (name=="programRead" ) { current = JSON_REGAL_CONFIG_CACHE_PROGRAMREAD;               return; }
+      if (name=="programWrite") { current = JSON_REGAL_CONFIG_CACHE_PROGRAMWRITE;              return; }
       if (name=="shader"      ) { current = JSON_REGAL_CONFIG_CACHE_SHADER;                    return; }
+      if (name=="shaderCompress") { current = JSON_REGAL_CONFIG_CACHE_SHADERCOMPRESS;            return; }
       if (name=="shaderRead"  ) { current = JSON_REGAL_CONFIG_CACHE_SHADERREAD;                return; }
       if (name=="shaderWrite" ) { current = JSON_REGAL_CONFIG_CACHE_SHADERWRITE;               return; }
       if (name=="texture"     ) { current = JSON_REGAL_CONFIG_CACHE_TEXTURE;                   return; }
+      if (name=="textureAsync") { current = JSON_REGAL_CONFIG_CACHE_TEXTUREASYNC;              return; }
+      if (name=="textureCompress") { current = JSON_REGAL_CONFIG_CACHE_TEXTURECOMPRESS;        return; }
       if (name=="textureRead" ) { current = JSON_REGAL_CONFIG_CACHE_TEXTUREREAD;               return; }
       if (name=="textureWrite") { current = JSON_REGAL_CONFIG_CACHE_TEXTUREWRITE;              return; }
       break;
 
     case JSON_REGAL_CONFIG_DISPATCH:
+      if (name=="compiled"    ) { current = JSON_REGAL_CONFIG_DISPATCH_COMPILED;               return; }
       if (name=="emulation"   ) { current = JSON_REGAL_CONFIG_DISPATCH_EMULATION;              return; }
       if (name=="enable"      ) { current = JSON_REGAL_CONFIG_DISPATCH_ENABLE;                 return; }
       if (name=="force"       ) { current = JSON_REGAL_CONFIG_DISPATCH_FORCE;                  return; }
+      if (name=="timing"      ) { current = JSON_REGAL_CONFIG_DISPATCH_TIMING;                 return; }
       break;
 
     case JSON_REGAL_CONFIG_DISPATCH_EMULATION:
       if (name=="enable"      ) { current = JSON_REGAL_CONFIG_DISPATCH_EMULATION_ENABLE;       return; }
       if (name=="force"       ) { current = JSON_REGAL_CONFIG_DISPATCH_EMULATION_FORCE;        return; }
+      if (name=="iff"         ) { current = JSON_REGAL_CONFIG_DISPATCH_EMULATION_IFF;          return; }
+      if (name=="vao"         ) { current = JSON_REGAL_CONFIG_DISPATCH_EMULATION_VAO;          return; }
       break;
 
     case JSON_REGAL_CONFIG_DISPATCH_EMULATION_ENABLE:
@@ -273,6 +313,19 @@ Parser::onPush(const string &name)
       if (name=="xfer"        ) { current = JSON_REGAL_CONFIG_DISPATCH_EMULATION_FORCE_XFER;   return; }
       break;
 
+    case JSON_REGAL_CONFIG_DISPATCH_EMULATION_IFF:
+      if (name=="asyncCompile") { current = JSON_REGAL_CONFIG_DISPATCH_EMULATION_IFF_ASYNCCOMPILE; return; }
+      if (name=="immediateBatch") { current = JSON_REGAL_CONFIG_DISPATCH_EMULATION_IFF_IMMEDIATEBATCH; return; }
+      if (name=="immediateStream") { current = JSON_REGAL_CONFIG_DISPATCH_EMULATION_IFF_IMMEDIATESTREAM; return; }
+      if (name=="programCacheSize") { current = JSON_REGAL_CONFIG_DISPATCH_EMULATION_IFF_PROGRAMCACHESIZE; return; }
+      if (name=="uniformBuffer") { current = JSON_REGAL_CONFIG_DISPATCH_EMULATION_IFF_UNIFORMBUFFER; return; }
+      break;
+
+    case JSON_REGAL_CONFIG_DISPATCH_EMULATION_VAO:
+      if (name=="uploadCache" ) { current = JSON_REGAL_CONFIG_DISPATCH_EMULATION_VAO_UPLOADCACHE; return; }
+      if (name=="uploadCacheSize") { current = JSON_REGAL_CONFIG_DISPATCH_EMULATION_VAO_UPLOADCACHESIZE; return; }
+      break;
+
     case JSON_REGAL_CONFIG_DISPATCH_ENABLE:
       if (name=="code"        ) { current = JSON_REGAL_CONFIG_DISPATCH_ENABLE_CODE;            return; }
       if (name=="debug"       ) { current = JSON_REGAL_CONFIG_DISPATCH_ENABLE_DEBUG;           return; }
@@ -281,6 +334,7 @@ Parser::onPush(const string &name)
       if (name=="error"       ) { current = JSON_REGAL_CONFIG_DISPATCH_ENABLE_ERROR;           return; }
       if (name=="log"         ) { current = JSON_REGAL_CONFIG_DISPATCH_ENABLE_LOG;             return; }
       if (name=="missing"     ) { current = JSON_REGAL_CONFIG_DISPATCH_ENABLE_MISSING;         return; }
+      if (name=="redundant"   ) { current = JSON_REGAL_CONFIG_DISPATCH_ENABLE_REDUNDANT;       return; }
       if (name=="statistics"  ) { current = JSON_REGAL_CONFIG_DISPATCH_ENABLE_STATISTICS;      return; }
       if (name=="trace"       ) { current = JSON_REGAL_CONFIG_DISPATCH_ENABLE_TRACE;           return; }
       break;
@@ -296,11 +350,20 @@ Parser::onPush(const string &name)
       break;
 
     case JSON_REGAL_CONFIG_FRAME:
+      if (name=="async"       ) { current = JSON_REGAL_CONFIG_FRAME_ASYNC;                     return; }
+      if (name=="gpuTiming"   ) { current = JSON_REGAL_CONFIG_FRAME_GPUTIMING;                 return; }
       if (name=="limit"       ) { current = JSON_REGAL_CONFIG_FRAME_LIMIT;                     return; }
       if (name=="md5"         ) { current = JSON_REGAL_CONFIG_FRAME_MD5;                       return; }
       if (name=="save"        ) { current = JSON_REGAL_CONFIG_FRAME_SAVE;                      return; }
       break;
 
+    case JSON_REGAL_CONFIG_FRAME_ASYNC:
+      if (name=="enable"      ) { current = JSON_REGAL_CONFIG_FRAME_ASYNC_ENABLE;              return; }
+      if (name=="latency"     ) { current = JSON_REGAL_CONFIG_FRAME_ASYNC_LATENCY;             return; }
+      if (name=="queue"       ) { current = JSON_REGAL_CONFIG_FRAME_ASYNC_QUEUE;               return; }
+      if (name=="threads"     ) { current = JSON_REGAL_CONFIG_FRAME_ASYNC_THREADS;             return; }
+      break;
+
     case JSON_REGAL_CONFIG_FRAME_MD5:
       if (name=="color"       ) { current = JSON_REGAL_CONFIG_FRAME_MD5_COLOR;                 return; }
       if (name=="depth"       ) { current = JSON_REGAL_CONFIG_FRAME_MD5_DEPTH;                 return; }
@@ -350,6 +413,10 @@ Parser::onPush(const string &name)
       break;
 
     case JSON_REGAL_LOGGING:
+      if (name=="async"       ) { current = JSON_REGAL_LOGGING_ASYNC;                          return; }
+      if (name=="asyncRecords") { current = JSON_REGAL_LOGGING_ASYNCRECORDS;                   return; }
+      if (name=="binary"      ) { current = JSON_REGAL_LOGGING_BINARY;                         return; }
+      if (name=="binaryFile"  ) { current = JSON_REGAL_LOGGING_BINARYFILE;                     return; }
       if (name=="bufferLimit" ) { current = JSON_REGAL_LOGGING_BUFFERLIMIT;                    return; }
       if (name=="callback"    ) { current = JSON_REGAL_LOGGING_CALLBACK;                       return; }
       if (name=="enable"      ) { current = JSON_REGAL_LOGGING_ENABLE;                         return; }
@@ -415,12 +482,19 @@ Parser::onValue(const bool value)
   switch (current)
   {
     case JSON_REGAL_CONFIG_CACHE_ENABLE                    : { set_json_regal_config_cache_enable(value);                   return; }
+    case JSON_REGAL_CONFIG_CACHE_GLSL                      : { set_json_regal_config_cache_glsl(value);                     return; }
+    case JSON_REGAL_CONFIG_CACHE_PROGRAM                   : { set_json_regal_config_cache_program(value);                  return; }
+    case JSON_REGAL_CONFIG_CACHE_PROGRAMREAD               : { set_json_regal_config_cache_programread(value);              return; }
+    case JSON_REGAL_CONFIG_CACHE_PROGRAMWRITE              : { set_json_regal_config_cache_programwrite(value);             return; }
     case JSON_REGAL_CONFIG_CACHE_SHADER                    : { set_json_regal_config_cache_shader(value);                   return; }
+    case JSON_REGAL_CONFIG_CACHE_SHADERCOMPRESS            : { set_json_regal_config_cache_shadercompress(value);           return; }
     case JSON_REGAL_CONFIG_CACHE_SHADERREAD                : { set_json_regal_config_cache_shaderread(value);               return; }
     case JSON_REGAL_CONFIG_CACHE_SHADERWRITE               : { set_json_regal_config_cache_shaderwrite(value);              return; }
     case JSON_REGAL_CONFIG_CACHE_TEXTURE                   : { set_json_regal_config_cache_texture(value);                  return; }
+    case JSON_REGAL_CONFIG_CACHE_TEXTUREASYNC              : { set_json_regal_config_cache_textureasync(value);             return; }
     case JSON_REGAL_CONFIG_CACHE_TEXTUREREAD               : { set_json_regal_config_cache_textureread(value);              return; }
     case JSON_REGAL_CONFIG_CACHE_TEXTUREWRITE              : { set_json_regal_config_cache_texturewrite(value);             return; }
+    case JSON_REGAL_CONFIG_DISPATCH_COMPILED               : { set_json_regal_config_dispatch_compiled(value);              return; }
     case JSON_REGAL_CONFIG_DISPATCH_EMULATION_ENABLE_BIN   : { set_json_regal_config_dispatch_emulation_enable_bin(value);  return; }
     case JSON_REGAL_CONFIG_DISPATCH_EMULATION_ENABLE_BV    : { set_json_regal_config_dispatch_emulation_enable_bv(value);   return; }
     case JSON_REGAL_CONFIG_DISPATCH_EMULATION_ENABLE_DSA   : { set_json_regal_config_dispatch_emulation_enable_dsa(value);  return; }
@@ -455,6 +529,11 @@ Parser::onValue(const bool value)
     case JSON_REGAL_CONFIG_DISPATCH_EMULATION_FORCE_TEXSTO : { set_json_regal_config_dispatch_emulation_force_texsto(value); return; }
     case JSON_REGAL_CONFIG_DISPATCH_EMULATION_FORCE_VAO    : { set_json_regal_config_dispatch_emulation_force_vao(value);   return; }
     case JSON_REGAL_CONFIG_DISPATCH_EMULATION_FORCE_XFER   : { set_json_regal_config_dispatch_emulation_force_xfer(value);  return; }
+    case JSON_REGAL_CONFIG_DISPATCH_EMULATION_IFF_ASYNCCOMPILE: { set_json_regal_config_dispatch_emulation_iff_asynccompile(value); return; }
+    case JSON_REGAL_CONFIG_DISPATCH_EMULATION_IFF_IMMEDIATEBATCH: { set_json_regal_config_dispatch_emulation_iff_immediatebatch(value); return; }
+    case JSON_REGAL_CONFIG_DISPATCH_EMULATION_IFF_IMMEDIATESTREAM: { set_json_regal_config_dispatch_emulation_iff_immediatestream(value); return; }
+    case JSON_REGAL_CONFIG_DISPATCH_EMULATION_IFF_UNIFORMBUFFER: { set_json_regal_config_dispatch_emulation_iff_uniformbuffer(value); return; }
+    case JSON_REGAL_CONFIG_DISPATCH_EMULATION_VAO_UPLOADCACHE: { set_json_regal_config_dispatch_emulation_vao_uploadcache(value); return; }
     case JSON_REGAL_CONFIG_DISPATCH_ENABLE_CODE            : { set_json_regal_config_dispatch_enable_code(value);           return; }
     case JSON_REGAL_CONFIG_DISPATCH_ENABLE_DEBUG           : { set_json_regal_config_dispatch_enable_debug(value);          return; }
     case JSON_REGAL_CONFIG_DISPATCH_ENABLE_DRIVER          : { set_json_regal_config_dispatch_enable_driver(value);         return; }
@@ -462,12 +541,16 @@ Parser::onValue(const bool value)
     case JSON_REGAL_CONFIG_DISPATCH_ENABLE_ERROR           : { set_json_regal_config_dispatch_enable_error(value);          return; }
     case JSON_REGAL_CONFIG_DISPATCH_ENABLE_LOG             : { set_json_regal_config_dispatch_enable_log(value);            return; }
     case JSON_REGAL_CONFIG_DISPATCH_ENABLE_MISSING         : { set_json_regal_config_dispatch_enable_missing(value);        return; }
+    case JSON_REGAL_CONFIG_DISPATCH_ENABLE_REDUNDANT       : { set_json_regal_config_dispatch_enable_redundant(value);      return; }
     case JSON_REGAL_CONFIG_DISPATCH_ENABLE_STATISTICS      : { set_json_regal_config_dispatch_enable_statistics(value);     return; }
     case JSON_REGAL_CONFIG_DISPATCH_ENABLE_TRACE           : { set_json_regal_config_dispatch_enable_trace(value);          return; }
     case JSON_REGAL_CONFIG_DISPATCH_FORCE_EMULATION        : { set_json_regal_config_dispatch_force_emulation(value);       return; }
+    case JSON_REGAL_CONFIG_DISPATCH_TIMING                 : { set_json_regal_config_dispatch_timing(value);                return; }
     case JSON_REGAL_CONFIG_FORCE_CORE                      : { set_json_regal_config_force_core(value);                     return; }
     case JSON_REGAL_CONFIG_FORCE_ES1                       : { set_json_regal_config_force_es1(value);                      return; }
     case JSON_REGAL_CONFIG_FORCE_ES2                       : { set_json_regal_config_force_es2(value);                      return; }
+    case JSON_REGAL_CONFIG_FRAME_ASYNC_ENABLE              : { set_json_regal_config_frame_async_enable(value);             return; }
+    case JSON_REGAL_CONFIG_FRAME_GPUTIMING                 : { set_json_regal_config_frame_gputiming(value);                return; }
     case JSON_REGAL_CONFIG_FRAME_MD5_COLOR                 : { set_json_regal_config_frame_md5_color(value);                return; }
     case JSON_REGAL_CONFIG_FRAME_MD5_DEPTH                 : { set_json_regal_config_frame_md5_depth(value);                return; }
     case JSON_REGAL_CONFIG_FRAME_MD5_STENCIL               : { set_json_regal_config_frame_md5_stencil(value);              return; }
@@ -479,6 +562,8 @@ Parser::onValue(const bool value)
     case JSON_REGAL_CONFIG_SYSTEM_ES2                      : { set_json_regal_config_system_es2(value);                     return; }
     case JSON_REGAL_CONFIG_SYSTEM_GL                       : { set_json_regal_config_system_gl(value);                      return; }
     case JSON_REGAL_CONFIG_SYSTEM_GLX                      : { set_json_regal_config_system_glx(value);                     return; }
+    case JSON_REGAL_LOGGING_ASYNC                          : { set_json_regal_logging_async(value);                         return; }
+    case JSON_REGAL_LOGGING_BINARY                         : { set_json_regal_logging_binary(value);                        return; }
     case JSON_REGAL_LOGGING_CALLBACK                       : { set_json_regal_logging_callback(value);                      return; }
     case JSON_REGAL_LOGGING_FRAMESTATISTICS                : { set_json_regal_logging_framestatistics(value);               return; }
     case JSON_REGAL_LOGGING_FRAMETIME                      : { set_json_regal_logging_frametime(value);                     return; }
@@ -508,10 +593,16 @@ Parser::onValue(const long value)
 
   switch (current)
   {
+    case JSON_REGAL_CONFIG_DISPATCH_EMULATION_IFF_PROGRAMCACHESIZE: { set_json_regal_config_dispatch_emulation_iff_programcachesize(value); return; }
+    case JSON_REGAL_CONFIG_DISPATCH_EMULATION_VAO_UPLOADCACHESIZE: { set_json_regal_config_dispatch_emulation_vao_uploadcachesize(value); return; }
+    case JSON_REGAL_CONFIG_FRAME_ASYNC_LATENCY             : { set_json_regal_config_frame_async_latency(value);            return; }
+    case JSON_REGAL_CONFIG_FRAME_ASYNC_QUEUE               : { set_json_regal_config_frame_async_queue(value);              return; }
+    case JSON_REGAL_CONFIG_FRAME_ASYNC_THREADS             : { set_json_regal_config_frame_async_threads(value);            return; }
     case JSON_REGAL_CONFIG_FRAME_LIMIT                     : { set_json_regal_config_frame_limit(value);                    return; }
     case JSON_REGAL_CONFIG_FRAME_MD5_MASK_COLOR            : { set_json_regal_config_frame_md5_mask_color(value);           return; }
     case JSON_REGAL_CONFIG_FRAME_MD5_MASK_DEPTH            : { set_json_regal_config_frame_md5_mask_depth(value);           return; }
     case JSON_REGAL_CONFIG_FRAME_MD5_MASK_STENCIL          : { set_json_regal_config_frame_md5_mask_stencil(value);         return; }
+    case JSON_REGAL_LOGGING_ASYNCRECORDS                   : { set_json_regal_logging_asyncrecords(value);                  return; }
     case JSON_REGAL_LOGGING_BUFFERLIMIT                    : { set_json_regal_logging_bufferlimit(value);                   return; }
     case JSON_REGAL_LOGGING_MAXBYTES                       : { set_json_regal_logging_maxbytes(value);                      return; }
     case JSON_REGAL_LOGGING_MAXLINES                       : { set_json_regal_logging_maxlines(value);                      return; }
@@ -530,6 +621,7 @@ Parser::onValue(const string &value)
   {
     case JSON_REGAL_CONFIG_CONFIGFILE                      : { set_json_regal_config_configfile(value);                     return; }
     case JSON_REGAL_CONFIG_CACHE_DIRECTORY                 : { set_json_regal_config_cache_directory(value);                return; }
+    case JSON_REGAL_CONFIG_CACHE_TEXTURECOMPRESS           : { set_json_regal_config_cache_texturecompress(value);          return; }
     case JSON_REGAL_CONFIG_FRAME_SAVE_PREFIX_COLOR         : { set_json_regal_config_frame_save_prefix_color(value);        return; }
     case JSON_REGAL_CONFIG_FRAME_SAVE_PREFIX_DEPTH         : { set_json_regal_config_frame_save_prefix_depth(value);        return; }
     case JSON_REGAL_CONFIG_FRAME_SAVE_PREFIX_STENCIL       : { set_json_regal_config_frame_save_prefix_stencil(value);      return; }
@@ -537,6 +629,7 @@ Parser::onValue(const string &value)
     case JSON_REGAL_CONFIG_LOAD_ES2                        : { set_json_regal_config_load_es2(value);                       return; }
     case JSON_REGAL_CONFIG_LOAD_GL                         : { set_json_regal_config_load_gl(value);                        return; }
     case JSON_REGAL_CONFIG_TRACE_FILE                      : { set_json_regal_config_trace_file(value);                     return; }
+    case JSON_REGAL_LOGGING_BINARYFILE                     : { set_json_regal_logging_binaryfile(value);                    return; }
     case JSON_REGAL_LOGGING_FILENAME                       : { set_json_regal_logging_filename(value);                      return; }
     case JSON_REGAL_LOGGING_JSONFILE                       : { set_json_regal_logging_jsonfile(value);                      return; }
     default:
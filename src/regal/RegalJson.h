@@ -51,14 +51,22 @@ enum Object
   JSON_REGAL_CONFIG_CACHE,
   JSON_REGAL_CONFIG_CACHE_DIRECTORY,
   JSON_REGAL_CONFIG_CACHE_ENABLE,
+  JSON_REGAL_CONFIG_CACHE_GLSL,
+  JSON_REGAL_CONFIG_CACHE_PROGRAM,
+  JSON_REGAL_CONFIG_CACHE_PROGRAMREAD,
+  JSON_REGAL_CONFIG_CACHE_PROGRAMWRITE,
   JSON_REGAL_CONFIG_CACHE_SHADER,
+  JSON_REGAL_CONFIG_CACHE_SHADERCOMPRESS,
   JSON_REGAL_CONFIG_CACHE_SHADERREAD,
   JSON_REGAL_CONFIG_CACHE_SHADERWRITE,
   JSON_REGAL_CONFIG_CACHE_TEXTURE,
+  JSON_REGAL_CONFIG_CACHE_TEXTUREASYNC,
+  JSON_REGAL_CONFIG_CACHE_TEXTURECOMPRESS,
   JSON_REGAL_CONFIG_CACHE_TEXTUREREAD,
   JSON_REGAL_CONFIG_CACHE_TEXTUREWRITE,
   JSON_REGAL_CONFIG_CONFIGFILE,
   JSON_REGAL_CONFIG_DISPATCH,
+  JSON_REGAL_CONFIG_DISPATCH_COMPILED,
   JSON_REGAL_CONFIG_DISPATCH_EMULATION,
   JSON_REGAL_CONFIG_DISPATCH_EMULATION_ENABLE,
   JSON_REGAL_CONFIG_DISPATCH_EMULATION_ENABLE_BIN,
@@ -96,6 +104,15 @@ enum Object
   JSON_REGAL_CONFIG_DISPATCH_EMULATION_FORCE_TEXSTO,
   JSON_REGAL_CONFIG_DISPATCH_EMULATION_FORCE_VAO,
   JSON_REGAL_CONFIG_DISPATCH_EMULATION_FORCE_XFER,
+  JSON_REGAL_CONFIG_DISPATCH_EMULATION_IFF,
+  JSON_REGAL_CONFIG_DISPATCH_EMULATION_IFF_ASYNCCOMPILE,
+  JSON_REGAL_CONFIG_DISPATCH_EMULATION_IFF_IMMEDIATEBATCH,
+  JSON_REGAL_CONFIG_DISPATCH_EMULATION_IFF_IMMEDIATESTREAM,
+  JSON_REGAL_CONFIG_DISPATCH_EMULATION_IFF_PROGRAMCACHESIZE,
+  JSON_REGAL_CONFIG_DISPATCH_EMULATION_IFF_UNIFORMBUFFER,
+  JSON_REGAL_CONFIG_DISPATCH_EMULATION_VAO,
+  JSON_REGAL_CONFIG_DISPATCH_EMULATION_VAO_UPLOADCACHE,
+  JSON_REGAL_CONFIG_DISPATCH_EMULATION_VAO_UPLOADCACHESIZE,
   JSON_REGAL_CONFIG_DISPATCH_ENABLE,
   JSON_REGAL_CONFIG_DISPATCH_ENABLE_CODE,
   JSON_REGAL_CONFIG_DISPATCH_ENABLE_DEBUG,
@@ -104,15 +121,23 @@ enum Object
   JSON_REGAL_CONFIG_DISPATCH_ENABLE_ERROR,
   JSON_REGAL_CONFIG_DISPATCH_ENABLE_LOG,
   JSON_REGAL_CONFIG_DISPATCH_ENABLE_MISSING,
+  JSON_REGAL_CONFIG_DISPATCH_ENABLE_REDUNDANT,
   JSON_REGAL_CONFIG_DISPATCH_ENABLE_STATISTICS,
   JSON_REGAL_CONFIG_DISPATCH_ENABLE_TRACE,
   JSON_REGAL_CONFIG_DISPATCH_FORCE,
   JSON_REGAL_CONFIG_DISPATCH_FORCE_EMULATION,
+  JSON_REGAL_CONFIG_DISPATCH_TIMING,
   JSON_REGAL_CONFIG_FORCE,
   JSON_REGAL_CONFIG_FORCE_CORE,
   JSON_REGAL_CONFIG_FORCE_ES1,
   JSON_REGAL_CONFIG_FORCE_ES2,
   JSON_REGAL_CONFIG_FRAME,
+  JSON_REGAL_CONFIG_FRAME_ASYNC,
+  JSON_REGAL_CONFIG_FRAME_ASYNC_ENABLE,
+  JSON_REGAL_CONFIG_FRAME_ASYNC_LATENCY,
+  JSON_REGAL_CONFIG_FRAME_ASYNC_QUEUE,
+  JSON_REGAL_CONFIG_FRAME_ASYNC_THREADS,
+  JSON_REGAL_CONFIG_FRAME_GPUTIMING,
   JSON_REGAL_CONFIG_FRAME_LIMIT,
   JSON_REGAL_CONFIG_FRAME_MD5,
   JSON_REGAL_CONFIG_FRAME_MD5_COLOR,
@@ -144,6 +169,10 @@ enum Object
   JSON_REGAL_CONFIG_TRACE,
   JSON_REGAL_CONFIG_TRACE_FILE,
   JSON_REGAL_LOGGING,
+  JSON_REGAL_LOGGING_ASYNC,
+  JSON_REGAL_LOGGING_ASYNCRECORDS,
+  JSON_REGAL_LOGGING_BINARY,
+  JSON_REGAL_LOGGING_BINARYFILE,
   JSON_REGAL_LOGGING_BUFFERLIMIT,
   JSON_REGAL_LOGGING_CALLBACK,
   JSON_REGAL_LOGGING_ENABLE,
@@ -1,12 +1,20 @@
 #define set_json_regal_config_cache_directory(value)                     Config::cacheDirectory = value
 #define set_json_regal_config_cache_enable(value)                        Config::cache = value
+#define set_json_regal_config_cache_glsl(value)                          Config::cacheGlsl = value
+#define set_json_regal_config_cache_program(value)                       Config::cacheProgram = value
+#define set_json_regal_config_cache_programread(value)                   Config::cacheProgramRead = value
+#define set_json_regal_config_cache_programwrite(value)                  Config::cacheProgramWrite = value
 #define set_json_regal_config_cache_shader(value)                        Config::cacheShader = value
+#define set_json_regal_config_cache_shadercompress(value)                Config::cacheShaderCompress = value
 #define set_json_regal_config_cache_shaderread(value)                    Config::cacheShaderRead = value
 #define set_json_regal_config_cache_shaderwrite(value)                   Config::cacheShaderWrite = value
 #define set_json_regal_config_cache_texture(value)                       Config::cacheTexture = value
+#define set_json_regal_config_cache_textureasync(value)                  Config::cacheTextureAsync = value
+#define set_json_regal_config_cache_texturecompress(value)               Config::cacheTextureCompress = value
 #define set_json_regal_config_cache_textureread(value)                   Config::cacheTextureRead = value
 #define set_json_regal_config_cache_texturewrite(value)                  Config::cacheTextureWrite = value
 #define set_json_regal_config_configfile(value)                          Config::configFile = value
+#define set_json_regal_config_dispatch_compiled(value)                   Config::dispatchCompiled = value
 #define set_json_regal_config_dispatch_emulation_enable_bin(value)       Config::enableEmuBin = value
 #define set_json_regal_config_dispatch_emulation_enable_bv(value)        Config::enableEmuBaseVertex = value
 #define set_json_regal_config_dispatch_emulation_enable_dsa(value)       Config::enableEmuDsa = value
@@ -41,6 +49,13 @@
 #define set_json_regal_config_dispatch_emulation_force_texsto(value)     Config::forceEmuTexSto = value
 #define set_json_regal_config_dispatch_emulation_force_vao(value)        Config::forceEmuVao = value
 #define set_json_regal_config_dispatch_emulation_force_xfer(value)       Config::forceEmuXfer = value
+#define set_json_regal_config_dispatch_emulation_iff_asynccompile(value) Config::iffAsyncCompile = value
+#define set_json_regal_config_dispatch_emulation_iff_immediatebatch(value) Config::iffImmediateBatch = value
+#define set_json_regal_config_dispatch_emulation_iff_immediatestream(value) Config::iffImmediateStream = value
+#define set_json_regal_config_dispatch_emulation_iff_programcachesize(value) Config::iffProgramCacheSize = value
+#define set_json_regal_config_dispatch_emulation_iff_uniformbuffer(value) Config::iffUniformBuffer = value
+#define set_json_regal_config_dispatch_emulation_vao_uploadcache(value)  Config::vaoUploadCache = value
+#define set_json_regal_config_dispatch_emulation_vao_uploadcachesize(value) Config::vaoUploadCacheSize = value
 #define set_json_regal_config_dispatch_enable_code(value)                Config::enableCode = value
 #define set_json_regal_config_dispatch_enable_debug(value)               Config::enableDebug = value
 #define set_json_regal_config_dispatch_enable_driver(value)              Config::enableDriver = value
@@ -48,12 +63,19 @@
 #define set_json_regal_config_dispatch_enable_error(value)               Config::enableError = value
 #define set_json_regal_config_dispatch_enable_log(value)                 Config::enableLog = value
 #define set_json_regal_config_dispatch_enable_missing(value)             Config::enableMissing = value
+#define set_json_regal_config_dispatch_enable_redundant(value)           Config::enableRedundant = value
 #define set_json_regal_config_dispatch_enable_statistics(value)          Config::enableStatistics = value
 #define set_json_regal_config_dispatch_enable_trace(value)               Config::enableTrace = value
 #define set_json_regal_config_dispatch_force_emulation(value)            Config::forceEmulation = value
+#define set_json_regal_config_dispatch_timing(value)                     Config::dispatchTiming = value
 #define set_json_regal_config_force_core(value)                          Config::forceCoreProfile = value
 #define set_json_regal_config_force_es1(value)                           Config::forceES1Profile = value
 #define set_json_regal_config_force_es2(value)                           Config::forceES2Profile = value
+#define set_json_regal_config_frame_async_enable(value)                  Config::frameAsync = value
+#define set_json_regal_config_frame_async_latency(value)                 Config::frameAsyncLatency = value
+#define set_json_regal_config_frame_async_queue(value)                   Config::frameAsyncQueue = value
+#define set_json_regal_config_frame_async_threads(value)                 Config::frameAsyncThreads = value
+#define set_json_regal_config_frame_gputiming(value)                     Config::frameGpuTiming = value
 #define set_json_regal_config_frame_limit(value)                         Config::frameLimit = value
 #define set_json_regal_config_frame_md5_color(value)                     Config::frameMd5Color = value
 #define set_json_regal_config_frame_md5_depth(value)                     Config::frameMd5Depth = value
@@ -76,6 +98,10 @@
 #define set_json_regal_config_system_gl(value)                           Config::sysGL = value
 #define set_json_regal_config_system_glx(value)                          Config::sysGLX = value
 #define set_json_regal_config_trace_file(value)                          Config::traceFile = value
+#define set_json_regal_logging_async(value)                              Logging::async = value
+#define set_json_regal_logging_asyncrecords(value)                       Logging::asyncRecords = value
+#define set_json_regal_logging_binary(value)                             Logging::binary = value
+#define set_json_regal_logging_binaryfile(value)                         Logging::binaryFilename = value
 #define set_json_regal_logging_bufferlimit(value)                        Logging::bufferLimit = value
 #define set_json_regal_logging_callback(value)                           Logging::callback = value
 #define set_json_regal_logging_enable_app(value)                         Logging::enableApp = value
@@ -48,6 +48,9 @@ REGAL_GLOBAL_BEGIN
 #include "RegalThread.h"
 #include "RegalContext.h"
 #include "RegalMutex.h"
+#include "RegalLogRing.h"
+#include "RegalLogBinary.h"
+#include "RegalWorkQueue.h"
 
 #if !REGAL_SYS_WIN32
 #include <pthread.h>
@@ -117,6 +120,21 @@ namespace Logging {
   std::string  jsonFilename;
   FILE        *jsonOutput   = NULL;
 
+  bool         binary         = false;
+  std::string  binaryFilename = "regal.bin";
+
+  bool         async        = false;
+  std::size_t  asyncRecords = 4096;
+
+#if REGAL_LOG_ASYNC
+  Thread::Mutex          *ringMutex  = NULL;    // Registration of per-thread rings
+  Thread::Mutex          *drainMutex = NULL;    // One consumer at a time
+  std::vector<Ring *>    *rings      = NULL;    // Freed once drained and released by their threads
+  Thread::WorkQueue      *writer     = NULL;
+  Thread::Event          *writerWake = NULL;    // A ring went from empty to non-empty, or done
+  volatile bool           writerDone = false;
+#endif
+
   Thread::Mutex          *bufferMutex = NULL;
   std::list<std::string> *buffer = NULL;
   std::size_t             bufferSize  = 0;
@@ -134,6 +152,10 @@ namespace Logging {
 
   Timer                   timer;
 
+#if REGAL_LOG_ASYNC
+  void startWriter();
+#endif
+
   void Init()
   {
 #ifndef REGAL_NO_GETENV
@@ -173,6 +195,10 @@ namespace Logging {
     getEnv("REGAL_LOG_FILE",       logFilename);
     getEnv("REGAL_LOG_JSON",       json);
     getEnv("REGAL_LOG_JSON_FILE",  jsonFilename);
+    getEnv("REGAL_LOG_BINARY",        binary);
+    getEnv("REGAL_LOG_BINARY_FILE",   binaryFilename);
+    getEnv("REGAL_LOG_ASYNC",         async);
+    getEnv("REGAL_LOG_ASYNC_RECORDS", asyncRecords);
     getEnv("REGAL_HTTP_LOG_LIMIT", bufferLimit);
 #endif
 
@@ -195,6 +221,15 @@ namespace Logging {
     if (jsonOutput)
       fprintf(jsonOutput,"%s","{ \"traceEvents\" : [\n");
 
+    // Binary call logging
+
+#if REGAL_LOG_BINARY
+    if (binary)
+      binary = BinaryLog::Open(binaryFilename);
+#else
+    binary = false;
+#endif
+
     Internal("Logging::Init","()");
 
     initialized = true;
@@ -239,6 +274,14 @@ namespace Logging {
     Info("REGAL_LOG_CALLBACK        ", callback        ? "enabled" : "disabled");
 #endif
 
+#if REGAL_LOG_BINARY
+    Info("REGAL_LOG_BINARY          ", binary          ? "enabled" : "disabled");
+#endif
+
+#if REGAL_LOG_ASYNC
+    Info("REGAL_LOG_ASYNC           ", async           ? "enabled" : "disabled");
+#endif
+
 #if REGAL_LOG_ONCE
     Info("REGAL_LOG_ONCE            ", once            ? "enabled" : "disabled");
 #endif
@@ -263,8 +306,26 @@ namespace Logging {
   {
     Internal("Logging::Cleanup","()");
 
+#if REGAL_LOG_ASYNC
+    if (writer)
+    {
+      storeRelease(writerDone,true);
+      writerWake->signal();
+      delete writer;
+      delete writerWake;
+      writer = NULL;
+      writerWake = NULL;
+      flush();
+    }
+#endif
+
     initialized = false;
 
+#if REGAL_LOG_BINARY
+    if (binary)
+      BinaryLog::Close();
+#endif
+
     if (logOutput)
       fileClose(&logOutput);
 
@@ -281,6 +342,12 @@ namespace Logging {
     uniqueMutex = NULL;
 #endif
 
+#if REGAL_LOG_ASYNC
+    delete ringMutex;
+    delete drainMutex;
+    ringMutex = drainMutex = NULL;
+#endif
+
     delete buffer;
     delete bufferMutex;
     buffer = NULL;
@@ -319,6 +386,10 @@ namespace Logging {
       jo.member("json",        json);
       jo.member("jsonFile",    jsonFilename);
       jo.member("bufferLimit", bufferLimit);
+      jo.member("binary",      binary);
+      jo.member("binaryFile",  binaryFilename);
+      jo.member("async",       async);
+      jo.member("asyncRecords",asyncRecords);
 
     jo.end();
 #endif
@@ -357,7 +428,7 @@ namespace Logging {
     return indent;
   }
 
-  inline string message(const char *prefix, const char *delim, const char *name, const string &str)
+  inline string message(const char *prefix, const char *delim, const char *name, const string &str, const size_t indent, const size_t tid)
   {
     static const char *trimSuffix = " ...";
     string_list trimPrefix;
@@ -365,12 +436,12 @@ namespace Logging {
     if (process)
       trimPrefix << print_string(hex(Thread::procId()),delim ? delim : "");
     if (thread)
-      trimPrefix << print_string(hex(Thread::threadId()),delim ? delim : "");
-    trimPrefix << print_string(string(indent(),' '),name ? name : "",name ? " " : "");
+      trimPrefix << print_string(hex(tid),delim ? delim : "");
+    trimPrefix << print_string(string(indent,' '),name ? name : "",name ? " " : "");
     return print_string(trim(str.c_str(),'\n',maxLines>0 ? maxLines : ~0,trimPrefix.str().c_str(),trimSuffix), '\n');
   }
 
-  inline string jsonObject(const char *prefix, const char *name, const string &str)
+  string jsonObject(const char *prefix, const char *name, const string &str, const unsigned long long time, const size_t pid, const size_t tid)
   {
 #if REGAL_NO_JSON
     return string();
@@ -393,9 +464,9 @@ namespace Logging {
 
     jo.object();
     jo.member("cat",prefix);
-    jo.member("pid",Thread::procId());
-    jo.member("tid",Thread::threadId()%(1<<16));
-    jo.member("ts", timer.now());
+    jo.member("pid",pid);
+    jo.member("tid",tid%(1<<16));
+    jo.member("ts", time);
 
     // Unnamed logging events such as error, warning and info ones
 
@@ -471,10 +542,22 @@ namespace Logging {
 #endif // REGAL_NO_JSON
   }
 
+  void jsonTrace(const string &events)
+  {
+#if REGAL_LOG_JSON && !REGAL_NO_JSON
+    if (json && jsonOutput && events.length())
+      fwrite(events.c_str(),events.length(),1,jsonOutput);
+#else
+    UNUSED_PARAMETER(events);
+#endif
+  }
+
   void getLogMessagesHTML(std::string &text)
   {
     static const char *const br = "<br/>\n";
 
+    flush();
+
     if (buffer)
     {
       Thread::ScopedLock lock(bufferMutex);
@@ -510,40 +593,246 @@ namespace Logging {
 #if REGAL_LOG_ONCE
     uniqueMutex = new Thread::Mutex();
 #endif
+
+#if REGAL_LOG_ASYNC
+    ringMutex  = new Thread::Mutex();
+    drainMutex = new Thread::Mutex();
+    if (async && asyncRecords)
+      startWriter();
+#endif
   }
 
 #ifndef REGAL_LOG_TAG
 #define REGAL_LOG_TAG "Regal"
 #endif
 
-  void Output(const Mode mode, const char *file, const int line, const char *prefix, const char *delim, const char *name, const string &str)
+  // Prefix each line of a message, numbering them if more than one
+
+  inline string format(const char *prefix, const char *delim, const char *name, const string &str, const size_t indent, const size_t tid)
   {
-    if (initialized && str.length())
+    string m = message(prefix,delim,name,str,indent,tid);
+
+    string full_prefix = string(prefix) + string(delim);
+    size_t p = m.find( full_prefix, 0 );
+    int count = 0;
+    if( m.find( full_prefix, full_prefix.size() ) != string::npos )
     {
-      string m = message(prefix,delim,name,str);
+      while( p != string::npos && count < 1000 )
+      {
+        std::string lineNumber;
+        boost::print::printf(lineNumber, "%03i ", count);
+        p += full_prefix.size();
+        m.insert( p, lineNumber.c_str(), lineNumber.size() );
+        p = m.find( full_prefix, p );
+        count++;
+      }
+    }
 
-      string full_prefix = string(prefix) + string(delim);
-      size_t p = m.find( full_prefix, 0 );
-      int count = 0;
-      if( m.find( full_prefix, full_prefix.size() ) != string::npos )
+    return m;
+  }
+
+  // False for a repeated warning or error, when only logging once
+
+  inline bool unique(const Mode mode, const string &m)
+  {
+#if REGAL_LOG_ONCE
+    if (once)
+      switch (mode)
       {
-        while( p != string::npos && count < 1000 )
+        case LOG_WARNING:
         {
-          std::string lineNumber;
-          boost::print::printf(lineNumber, "%03i ", count);
-          p += full_prefix.size();
-          m.insert( p, lineNumber.c_str(), lineNumber.size() );
-          p = m.find( full_prefix, p );
-          count++;
+          Thread::ScopedLock lock(uniqueMutex);
+          if (uniqueWarnings.find(m)!=uniqueWarnings.end())
+            return false;
+          uniqueWarnings.insert(m);
+          break;
         }
+
+        case LOG_ERROR:
+        {
+          Thread::ScopedLock lock(uniqueMutex);
+          if (uniqueErrors.find(m)!=uniqueErrors.end())
+            return false;
+          uniqueErrors.insert(m);
+          break;
+        }
+
+        default:
+          break;
       }
+#else
+    UNUSED_PARAMETER(mode);
+    UNUSED_PARAMETER(m);
+#endif
+    return true;
+  }
 
-#if 1
-      UNUSED_PARAMETER(file);
-      UNUSED_PARAMETER(line);
+  // Platform, JSON, file and HTTP buffer output
+
+  void write(const Mode mode, const char *prefix, const char *name, const string &str, string &m, const Timer::Value time, const size_t tid)
+  {
+#if REGAL_SYS_WGL
+    UNUSED_PARAMETER(mode);
+    OutputDebugStringA(m.c_str());
+#elif REGAL_SYS_ANDROID
+    if (!logOutput)
+    {
+      android_LogPriority adrLog;
+
+      switch(mode)
+      {
+        case LOG_ERROR:   adrLog = ANDROID_LOG_ERROR; break;
+        case LOG_WARNING: adrLog = ANDROID_LOG_WARN;  break;
+        case LOG_INFO:    adrLog = ANDROID_LOG_INFO;  break;
+        default:          adrLog = ANDROID_LOG_DEBUG; break;
+      }
+
+      __android_log_write(adrLog, REGAL_LOG_TAG, m.c_str());
+    }
 #else
-      m = print_string(file,":",line," ",m);
+    UNUSED_PARAMETER(mode);
+#endif
+
+#if REGAL_LOG_JSON && !REGAL_NO_JSON
+    if (json && jsonOutput)
+    {
+      string j = jsonObject(prefix,name,str,time,Thread::procId(),tid) + ",\n";
+      fwrite(j.c_str(),j.length(),1,jsonOutput);
+    }
+#else
+    UNUSED_PARAMETER(prefix);
+    UNUSED_PARAMETER(name);
+    UNUSED_PARAMETER(str);
+    UNUSED_PARAMETER(time);
+    UNUSED_PARAMETER(tid);
+#endif
+
+#if REGAL_LOG
+    if (log && logOutput)
+    {
+      fprintf(logOutput, "%s", m.c_str());
+      fflush(logOutput);
+    }
+#endif
+
+    append(m);
+  }
+
+#if REGAL_LOG_ASYNC
+
+  // The calling thread's ring, created on first use
+
+  inline Ring *threadRing()
+  {
+    Thread::ThreadLocal &instance = Thread::ThreadLocal::instance();
+    if (!instance.logRing)
+    {
+      Ring *ring = new Ring(asyncRecords);
+      Thread::ScopedLock lock(ringMutex);
+      if (!rings)
+        rings = new std::vector<Ring *>();
+      rings->push_back(ring);
+      instance.logRing = ring;
+    }
+    return instance.logRing;
+  }
+
+  // Write out everything queued so far, returning the number of messages
+
+  size_t drain()
+  {
+    Thread::ScopedLock drainLock(drainMutex);
+    Thread::ScopedLock ringLock(ringMutex);
+
+    size_t n = 0;
+    if (!rings)
+      return n;
+
+    for (size_t i=0; i<rings->size();)
+    {
+      Ring &ring = *(*rings)[i];
+
+      for (Record *r = ring.front(); r; r = ring.front(), ++n)
+      {
+        const char *name = r->hasName ? r->name.c_str() : NULL;
+        string m = format(r->prefix,r->delim,name,r->text,r->indent,r->thread);
+        if (unique(r->mode,m))
+          write(r->mode,r->prefix,name,r->text,m,r->time,r->thread);
+        ring.pop();
+      }
+
+      const size_t dropped = loadAcquire(ring.dropped);
+      if (dropped!=ring.reported)
+      {
+        const string str = print_string(dropped-ring.reported," log messages dropped, REGAL_LOG_ASYNC_RECORDS is ",ring.capacity());
+        string m = format("warning ", " | ", NULL, str, 0, 0);
+        write(LOG_WARNING,"warning ",NULL,str,m,timer.now(),0);
+        ring.reported = dropped;
+      }
+
+      // Nothing more is pushed once the thread has released it
+
+      if (loadAcquire(ring.released) && !ring.front() && loadAcquire(ring.dropped)==ring.reported)
+      {
+        delete &ring;
+        rings->erase(rings->begin()+i);
+      }
+      else
+        ++i;
+    }
+
+    return n;
+  }
+
+  void releaseRing(Ring *ring)
+  {
+    if (ring)
+      storeRelease(ring->released,true);
+  }
+
+  struct Writer : public Thread::Job
+  {
+    void run()
+    {
+      // Sleep until there is something to write, a drain that
+      // wrote anything goes around again for what came meanwhile
+
+      while (!loadAcquire(writerDone))
+        if (!drain())
+          writerWake->wait();
+    }
+  };
+
+  void startWriter()
+  {
+    writer = new Thread::WorkQueue(1);
+    if (!writer->threads())
+    {
+      delete writer;
+      writer = NULL;
+      return;
+    }
+    writerWake = new Thread::Event();
+    writerDone = false;
+    writer->push(new Writer());
+  }
+
+#endif // REGAL_LOG_ASYNC
+
+  void flush()
+  {
+#if REGAL_LOG_ASYNC
+    if (drainMutex)
+      drain();
 #endif
+  }
+
+  void Output(const Mode mode, const char *file, const int line, const char *prefix, const char *delim, const char *name, const string &str)
+  {
+    if (initialized && str.length())
+    {
+      UNUSED_PARAMETER(file);
+      UNUSED_PARAMETER(line);
 
 #if REGAL_BREAK
       switch (mode)
@@ -554,33 +843,6 @@ namespace Logging {
       }
 #endif
 
-#if REGAL_LOG_ONCE
-      if (once)
-        switch (mode)
-        {
-          case LOG_WARNING:
-          {
-            Thread::ScopedLock lock(uniqueMutex);
-            if (uniqueWarnings.find(m)!=uniqueWarnings.end())
-              return;
-            uniqueWarnings.insert(m);
-            break;
-          }
-
-          case LOG_ERROR:
-          {
-            Thread::ScopedLock lock(uniqueMutex);
-            if (uniqueErrors.find(m)!=uniqueErrors.end())
-              return;
-            uniqueErrors.insert(m);
-            break;
-          }
-
-          default:
-            break;
-        }
-#endif
-
       RegalContext *rCtx = NULL;
 
 #if !REGAL_SYS_WGL && !REGAL_NO_TLS
@@ -590,47 +852,52 @@ namespace Logging {
       rCtx = REGAL_GET_CONTEXT();
 #endif
 
+      // Queue the message for the background writer, unless an
+      // application callback expects it on the calling thread.
+
+#if REGAL_LOG_ASYNC
 #if REGAL_LOG_CALLBACK
-      if (callback && rCtx && rCtx->logCallback)
-        rCtx->logCallback(GL_LOG_INFO_REGAL, (GLsizei) m.length(), m.c_str(), reinterpret_cast<void *>(rCtx->sysCtx));
+      if (writer && !(callback && rCtx && rCtx->logCallback))
+#else
+      if (writer)
 #endif
-
-#if REGAL_SYS_WGL
-      OutputDebugStringA(m.c_str());
-#elif REGAL_SYS_ANDROID
-      if (!logOutput)
       {
-        android_LogPriority adrLog;
-
-        switch(mode)
+        Ring   *ring = threadRing();
+        Record *r    = ring->back();
+        if (r)
         {
-          case LOG_ERROR:   adrLog = ANDROID_LOG_ERROR; break;
-          case LOG_WARNING: adrLog = ANDROID_LOG_WARN;  break;
-          case LOG_INFO:    adrLog = ANDROID_LOG_INFO;  break;
-          default:          adrLog = ANDROID_LOG_DEBUG; break;
+          r->mode    = mode;
+          r->prefix  = prefix;
+          r->delim   = delim;
+          r->hasName = name!=NULL;
+          r->name.assign(name ? name : "");
+          r->text.assign(str);
+          r->indent  = indent();
+          r->thread  = Thread::threadId();
+          r->time    = timer.now();
+          ring->push();
+
+          // Only the first message into an empty ring wakes the
+          // writer, it drains everything queued after that
+
+          if (ring->size()==1)
+            writerWake->signal();
         }
-
-        __android_log_write(adrLog, REGAL_LOG_TAG, m.c_str());
+        return;
       }
 #endif
 
-#if REGAL_LOG_JSON && !REGAL_NO_JSON
-      if (json && jsonOutput)
-      {
-        string m = jsonObject(prefix,name,str) + ",\n";
-        fwrite(m.c_str(),m.length(),1,jsonOutput);
-      }
-#endif
+      string m = format(prefix,delim,name,str,indent(),Thread::threadId());
 
-#if REGAL_LOG
-      if (log && logOutput)
-      {
-        fprintf(logOutput, "%s", m.c_str());
-        fflush(logOutput);
-      }
+      if (!unique(mode,m))
+        return;
+
+#if REGAL_LOG_CALLBACK
+      if (callback && rCtx && rCtx->logCallback)
+        rCtx->logCallback(GL_LOG_INFO_REGAL, (GLsizei) m.length(), m.c_str(), reinterpret_cast<void *>(rCtx->sysCtx));
 #endif
 
-      append(m);
+      write(mode,prefix,name,str,m,timer.now(),Thread::threadId());
     }
   }
 }
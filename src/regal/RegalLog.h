@@ -129,6 +129,14 @@ namespace Json { struct Output; }
 # define REGAL_LOG_CALLBACK 1
 #endif
 
+#ifndef REGAL_LOG_ASYNC
+# if REGAL_WRANGLER || REGAL_NO_TLS || REGAL_SYS_EMSCRIPTEN || REGAL_SYS_PPAPI
+#  define REGAL_LOG_ASYNC 0
+# else
+#  define REGAL_LOG_ASYNC 1
+# endif
+#endif
+
 #ifdef REGAL_LOG_ALL
 # undef REGAL_LOG_ERROR
 # undef REGAL_LOG_WARNING
@@ -173,6 +181,18 @@ namespace Logging
 
   extern void createLocks();
 
+  // Chrome trace event for a logged message
+
+  extern std::string jsonObject(const char *prefix, const char *name, const std::string &str, const unsigned long long time, const std::size_t pid, const std::size_t tid);
+
+  // Append Chrome trace events, each followed by ",\n", to the JSON output
+
+  extern void jsonTrace(const std::string &events);
+
+  // Write out messages still queued for the background writer
+
+  extern void flush();
+
   // Runtime control of logging
 
   extern bool enableError;
@@ -213,6 +233,16 @@ namespace Logging
   extern std::string  jsonFilename;
   extern FILE        *jsonOutput;
 
+  // Binary call log, see RegalLogBinary.h
+
+  extern bool         binary;
+  extern std::string  binaryFilename;
+
+  // Asynchronous output via per-thread ring buffers
+
+  extern bool         async;
+  extern std::size_t  asyncRecords;     // Ring buffer size, per thread
+
   // Buffering for HTTP query purposes
 
   extern std::size_t             bufferSize;
@@ -0,0 +1,520 @@
+/*
+  Copyright (c) 2011-2013 NVIDIA Corporation
+  Copyright (c) 2011-2013 Cass Everitt
+  Copyright (c) 2012-2013 Scott Nations
+  Copyright (c) 2012-2013 Nigel Stewart
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+    Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+  IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+  OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+  OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+  Intended formatting conventions:
+  $ astyle --style=allman --indent=spaces=2 --indent-switches
+*/
+
+#include "pch.h" /* For MS precompiled header support */
+
+#include "RegalUtil.h"
+
+#if REGAL_LOG_BINARY
+
+REGAL_GLOBAL_BEGIN
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include <boost/print/print_string.hpp>
+
+#if REGAL_SYS_WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
+#include "RegalLog.h"
+#include "RegalLogBinary.h"
+#include "RegalLogRing.h"
+#include "RegalMutex.h"
+#include "RegalThread.h"
+#include "RegalTimer.h"
+#include "RegalToken.h"
+
+REGAL_GLOBAL_END
+
+REGAL_NAMESPACE_BEGIN
+
+using ::std::string;
+using ::std::vector;
+using ::boost::print::print_string;
+
+namespace BinaryLog
+{
+  namespace
+  {
+    const GLuint      version     = 1;
+    const std::size_t segmentSize = REGAL_LOG_BINARY_SEGMENT;
+    const std::size_t maxSegments = 4096;
+
+    inline std::size_t pad(const std::size_t size, const std::size_t n) { return (size+n-1)&~(n-1); }
+
+#if REGAL_SYS_WIN32
+    HANDLE         file = INVALID_HANDLE_VALUE;
+    HANDLE         mappings[maxSegments];
+#else
+    int            file = -1;
+#endif
+
+    char * volatile   segments[maxSegments];
+    volatile GLuint64 offset = 0;
+    volatile bool     opened = false;
+    volatile long     writers = 0;            // Calls writing a record
+    Thread::Mutex    *mutex  = NULL;          // Mapping of new segments
+    Timer             timer;
+
+    // Close waits for the calls that saw the log open to finish
+    // writing before it unmaps.  The writer count is raised before
+    // opened is checked, and opened is cleared before the count is
+    // read, both with full ordering.
+
+    struct Writer
+    {
+      Writer()
+      {
+#if defined(_MSC_VER)
+        _InterlockedIncrement(&writers);
+#else
+        __atomic_add_fetch(&writers, 1, __ATOMIC_SEQ_CST);
+#endif
+      }
+
+      ~Writer()
+      {
+#if defined(_MSC_VER)
+        _InterlockedDecrement(&writers);
+#else
+        __atomic_sub_fetch(&writers, 1, __ATOMIC_RELEASE);
+#endif
+      }
+
+      bool open() const
+      {
+#if defined(_MSC_VER)
+        return opened;
+#else
+        return __atomic_load_n(&opened, __ATOMIC_SEQ_CST);
+#endif
+      }
+    };
+
+    // Extend the file and map segment i
+
+    char *map(const std::size_t i)
+    {
+      Thread::ScopedLock lock(mutex);
+
+      char *base = segments[i];
+      if (base)
+        return base;
+
+      const GLuint64 begin = GLuint64(i)*segmentSize;
+      const GLuint64 end   = begin + segmentSize;
+
+#if REGAL_SYS_WIN32
+      mappings[i] = CreateFileMappingA(file, NULL, PAGE_READWRITE, DWORD(end>>32), DWORD(end), NULL);
+      if (mappings[i])
+        base = static_cast<char *>(MapViewOfFile(mappings[i], FILE_MAP_WRITE, DWORD(begin>>32), DWORD(begin), segmentSize));
+#else
+      if (!ftruncate(file, off_t(end)))
+      {
+        void *tmp = mmap(NULL, segmentSize, PROT_READ | PROT_WRITE, MAP_SHARED, file, off_t(begin));
+        base = tmp==MAP_FAILED ? NULL : static_cast<char *>(tmp);
+      }
+#endif
+
+      if (!base)
+      {
+        Warning("Binary log could not map ",segmentSize," bytes at offset ",begin);
+        return NULL;
+      }
+
+      Thread::storeRelease(segments[i],base);
+      return base;
+    }
+
+    inline char *segment(const std::size_t i)
+    {
+      char *base = Thread::loadAcquire(segments[i]);
+      return base ? base : map(i);
+    }
+
+    // Mark a reserved range as unused
+
+    inline void padding(char *p, const GLuint size)
+    {
+      Record *r = reinterpret_cast<Record *>(p);
+      r->size  = size;
+      r->kind  = BINARY_PADDING;
+      r->count = 0;
+    }
+
+    // Claim size bytes of the file, records never straddle segments
+
+    char *reserve(const std::size_t size)
+    {
+      RegalAssert(size<=segmentSize && (size&7)==0);
+
+      for (;;)
+      {
+#if defined(_MSC_VER)
+        const GLuint64 begin = GLuint64(_InterlockedExchangeAdd64(reinterpret_cast<volatile __int64 *>(&offset), __int64(size)));
+#else
+        const GLuint64 begin = __atomic_fetch_add(&offset, GLuint64(size), __ATOMIC_RELAXED);
+#endif
+        const std::size_t i   = std::size_t(begin/segmentSize);
+        const std::size_t pos = std::size_t(begin%segmentSize);
+
+        if (i+1>=maxSegments)
+          return NULL;
+
+        char *base = segment(i);
+        if (!base)
+          return NULL;
+
+        if (pos+size<=segmentSize)
+          return base+pos;
+
+        // Skip over the tail of this segment, and the
+        // part of our claim that spilled into the next
+
+        padding(base+pos, GLuint(segmentSize-pos));
+        char *next = segment(i+1);
+        if (!next)
+          return NULL;
+        padding(next, GLuint(pos+size-segmentSize));
+      }
+    }
+
+    void function(const GLuint id, const Function &f)
+    {
+      const std::size_t name      = strlen(f.name)+1;
+      const std::size_t signature = strlen(f.signature)+1;
+      const std::size_t size      = pad(sizeof(Record)+name+signature,8);
+
+      char *p = reserve(size);
+      if (!p)
+        return;
+
+      Record *r = reinterpret_cast<Record *>(p);
+      r->size   = GLuint(size);
+      r->kind   = BINARY_FUNCTION;
+      r->count  = 0;
+      r->id     = id;
+      r->thread = 0;
+      r->time   = 0;
+      memcpy(p+sizeof(Record),      f.name,      name);
+      memcpy(p+sizeof(Record)+name, f.signature, signature);
+    }
+  }
+
+  bool
+  Open(const string &filename)
+  {
+    RegalAssert(!opened);
+
+    memset(const_cast<char **>(segments),0,sizeof(segments));
+
+#if REGAL_SYS_WIN32
+    file = CreateFileA(filename.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file==INVALID_HANDLE_VALUE)
+#else
+    file = open(filename.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (file<0)
+#endif
+    {
+      Warning("Binary log ",filename," could not be opened for writing.");
+      return false;
+    }
+
+    mutex = new Thread::Mutex();
+
+    Header *h = reinterpret_cast<Header *>(segment(0));
+    if (!h)
+    {
+      Close();
+      return false;
+    }
+
+    memcpy(h->magic,"REGALBIN",8);
+    h->version = version;
+    h->pid     = GLuint(Thread::procId());
+    h->start   = timer.now();
+    offset     = pad(sizeof(Header),8);
+
+    for (GLuint i=0; i<functionCount; ++i)
+      function(i,functions[i]);
+
+    Thread::storeRelease(opened,true);
+    return true;
+  }
+
+  void
+  Close()
+  {
+#if defined(_MSC_VER)
+    _InterlockedExchange8(reinterpret_cast<volatile char *>(&opened), 0);
+#else
+    __atomic_store_n(&opened, false, __ATOMIC_SEQ_CST);
+#endif
+
+    // Wait for calls in flight on other threads
+
+#if defined(_MSC_VER)
+    while (_InterlockedCompareExchange(&writers, 0, 0))
+      Sleep( 1 );
+#else
+    while (__atomic_load_n(&writers, __ATOMIC_ACQUIRE))
+      usleep( 1000 );
+#endif
+
+    const GLuint64 size = offset;
+
+    for (std::size_t i=0; i<maxSegments && segments[i]; ++i)
+    {
+#if REGAL_SYS_WIN32
+      UnmapViewOfFile(segments[i]);
+      CloseHandle(mappings[i]);
+#else
+      munmap(segments[i],segmentSize);
+#endif
+      segments[i] = NULL;
+    }
+
+    // Trim the unused part of the last segment
+
+#if REGAL_SYS_WIN32
+    if (file!=INVALID_HANDLE_VALUE)
+    {
+      LARGE_INTEGER end;
+      end.QuadPart = LONGLONG(size);
+      if (SetFilePointerEx(file, end, NULL, FILE_BEGIN))
+        SetEndOfFile(file);
+      CloseHandle(file);
+      file = INVALID_HANDLE_VALUE;
+    }
+#else
+    if (file>=0)
+    {
+      if (ftruncate(file, off_t(size)))
+        Warning("Binary log could not be trimmed to ",size," bytes.");
+      close(file);
+      file = -1;
+    }
+#endif
+
+    delete mutex;
+    mutex  = NULL;
+    offset = 0;
+  }
+
+  bool
+  isOpen()
+  {
+    return Thread::loadAcquire(opened);
+  }
+
+  void
+  call(const GLuint id, const GLuint64 *args, const GLushort count, const char * const *strings, const GLint *lengths, const std::size_t stringCount)
+  {
+    if (!isOpen())
+      return;
+
+    const Writer writer;
+    if (!writer.open())
+      return;
+
+    RegalAssert(stringCount<=count);
+
+    GLuint      stored[32];
+    std::size_t size = sizeof(Record) + count*sizeof(GLuint64);
+
+    for (std::size_t i=0; i<stringCount && i<32; ++i)
+    {
+      if (!strings[i])
+        stored[i] = ~GLuint(0);
+      else if (lengths && lengths[i]>=0)
+        stored[i] = GLuint(std::min<GLint>(lengths[i],REGAL_LOG_BINARY_STRING));
+      else
+        stored[i] = GLuint(strnlen(strings[i],REGAL_LOG_BINARY_STRING));
+      size += sizeof(GLuint) + (strings[i] ? pad(stored[i],4) : 0);
+    }
+    size = pad(size,8);
+
+    char *p = reserve(size);
+    if (!p)
+      return;
+
+    Record *r = reinterpret_cast<Record *>(p);
+    r->size   = GLuint(size);
+    r->kind   = BINARY_CALL;
+    r->count  = count;
+    r->id     = id;
+    r->thread = GLuint(Thread::threadId());
+    r->time   = timer.now();
+
+    p += sizeof(Record);
+    memcpy(p, args, count*sizeof(GLuint64));
+    p += count*sizeof(GLuint64);
+
+    for (std::size_t i=0; i<stringCount && i<32; ++i)
+    {
+      memcpy(p, &stored[i], sizeof(GLuint));
+      p += sizeof(GLuint);
+      if (strings[i])
+      {
+        memcpy(p, strings[i], stored[i]);
+        p += pad(stored[i],4);
+      }
+    }
+  }
+
+  //
+  // Decoding
+  //
+
+  namespace
+  {
+    string argument(const char type, const GLuint64 w, const char *&payload)
+    {
+      switch (type)
+      {
+        case 'e': return Token::GLenumToString(GLenum(w));
+        case 'b': return Token::GLbooleanToString(GLboolean(w));
+        case 'x': return print_string("0x",boost::print::hex(GLbitfield(w)));
+        case 'i': return print_string(GLint64(w));
+        case 'u': return print_string(w);
+        case 'f':
+        {
+          union { GLuint u; GLfloat f; } tmp;
+          tmp.u = GLuint(w);
+          return print_string(tmp.f);
+        }
+        case 'd':
+        {
+          union { GLuint64 u; GLdouble d; } tmp;
+          tmp.u = w;
+          return print_string(tmp.d);
+        }
+        case 's':
+        {
+          GLuint length;
+          memcpy(&length, payload, sizeof(GLuint));
+          payload += sizeof(GLuint);
+          if (length==~GLuint(0))
+            return "NULL";
+          const string tmp(payload,length);
+          payload += pad(length,4);
+          return print_string(boost::print::quote(tmp.c_str(),'"'));
+        }
+        default:
+          return w ? print_string(reinterpret_cast<const void *>(size_t(w))) : string("NULL");
+      }
+    }
+  }
+
+  bool
+  decode(const string &filename, FILE *output, const bool json)
+  {
+    FILE *f = fopen(filename.c_str(),"rb");
+    if (!f)
+      return false;
+
+    vector<char> data;
+    char buffer[64*1024];
+    for (std::size_t n; (n = fread(buffer,1,sizeof(buffer),f))>0; )
+      data.insert(data.end(),buffer,buffer+n);
+    fclose(f);
+
+    const Header *h = reinterpret_cast<const Header *>(data.empty() ? NULL : &data[0]);
+    if (data.size()<sizeof(Header) || memcmp(h->magic,"REGALBIN",8) || h->version!=version)
+      return false;
+
+    vector<const char *> names;
+    vector<const char *> signatures;
+
+    if (json)
+      fprintf(output,"%s","{ \"traceEvents\" : [\n");
+
+    for (std::size_t pos = pad(sizeof(Header),8); pos+2*sizeof(GLuint)<=data.size(); )
+    {
+      const Record *r = reinterpret_cast<const Record *>(&data[pos]);
+      if (!r->size || pos+r->size>data.size())
+        break;
+      pos += r->size;
+
+      if (r->kind==BINARY_FUNCTION)
+      {
+        if (r->id>=names.size())
+        {
+          names.resize(r->id+1,NULL);
+          signatures.resize(r->id+1,NULL);
+        }
+        names[r->id]      = reinterpret_cast<const char *>(r+1);
+        signatures[r->id] = names[r->id] + strlen(names[r->id]) + 1;
+        continue;
+      }
+
+      if (r->kind!=BINARY_CALL || r->id>=names.size() || !names[r->id])
+        continue;
+
+      const char     *name      = names[r->id];
+      const char     *signature = signatures[r->id];
+      const GLuint64 *args      = reinterpret_cast<const GLuint64 *>(r+1);
+      const char     *payload   = reinterpret_cast<const char *>(args+r->count);
+      const bool      ret       = signature[0]!='v';
+
+      string str("(");
+      for (GLushort i=0; i+(ret ? 1 : 0)<r->count && signature[i+1]; ++i)
+        str += print_string(i ? ", " : "", argument(signature[i+1],args[i],payload));
+      str += ")";
+      if (ret && r->count)
+        str += print_string(" returned ",argument(signature[0],args[r->count-1],payload));
+
+      if (json)
+        fprintf(output,"%s,\n",Logging::jsonObject("driver  ",name,str,r->time,h->pid,r->thread).c_str());
+      else
+        fprintf(output,"driver   | %s%s\n",name,str.c_str());
+    }
+
+    if (json)
+      fprintf(output,"%s","{} ] }\n");
+
+    return true;
+  }
+}
+
+REGAL_NAMESPACE_END
+
+#endif // REGAL_LOG_BINARY
@@ -0,0 +1,165 @@
+/*
+  Copyright (c) 2011-2013 NVIDIA Corporation
+  Copyright (c) 2011-2013 Cass Everitt
+  Copyright (c) 2012-2013 Scott Nations
+  Copyright (c) 2012-2013 Nigel Stewart
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+    Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+  IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+  OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+  OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+
+ Regal binary call log
+
+ Records each call as its entry point id, timestamp, thread and raw
+ argument words, with copies of input strings, into a memory-mapped
+ file.  Nothing is formatted at call time, the regallog tool renders
+ the file as the text or JSON log offline.
+
+ File layout, native byte order:
+
+   Header                         "REGALBIN", version, pid, start time
+   Record (BINARY_FUNCTION) * N   entry point name and signature
+   Record (BINARY_CALL) ...       argument words, then string payloads
+
+ Every record is a multiple of 8 bytes, a zero size marks the end.
+ Signatures are one character for the return type then one per
+ parameter:
+
+   v void   e GLenum   b GLboolean   x GLbitfield   i signed
+   u unsigned   f float   d double   s input string   p other
+
+ String arguments are stored as a 32-bit length (~0 for NULL) and
+ at most REGAL_LOG_BINARY_STRING bytes, padded to 4 bytes.  Strings
+ passed with a length, as for glObjectLabel, are copied up to that
+ length rather than scanned for a terminator.
+
+ */
+
+#ifndef __REGAL_LOG_BINARY_H__
+#define __REGAL_LOG_BINARY_H__
+
+#include "RegalUtil.h"
+
+#if REGAL_LOG_BINARY
+
+REGAL_GLOBAL_BEGIN
+
+#include <cstdio>
+#include <string>
+
+#include <GL/Regal.h>
+
+REGAL_GLOBAL_END
+
+REGAL_NAMESPACE_BEGIN
+
+// Longest string argument copied into the log
+
+#ifndef REGAL_LOG_BINARY_STRING
+#define REGAL_LOG_BINARY_STRING 256
+#endif
+
+// The log file grows in mapped segments of this size
+
+#ifndef REGAL_LOG_BINARY_SEGMENT
+#define REGAL_LOG_BINARY_SEGMENT (16*1024*1024)
+#endif
+
+namespace BinaryLog
+{
+  enum Kind
+  {
+    BINARY_PADDING  = 0,
+    BINARY_FUNCTION = 1,
+    BINARY_CALL     = 2
+  };
+
+  struct Header
+  {
+    char     magic[8];
+    GLuint   version;
+    GLuint   pid;
+    GLuint64 start;     // Microseconds
+  };
+
+  struct Record
+  {
+    GLuint   size;      // In bytes, including this header
+    GLushort kind;
+    GLushort count;     // Argument words following this header
+    GLuint   id;        // Entry point
+    GLuint   thread;
+    GLuint64 time;      // Microseconds
+  };
+
+  // Entry points, indexed by id
+
+  struct Function
+  {
+    const char *name;
+    const char *signature;
+  };
+
+  extern const Function functions[];
+  extern const GLuint   functionCount;
+
+  extern bool Open(const std::string &filename);
+  extern void Close();
+
+  extern bool isOpen();
+
+  // Append a call record, lock-free.  lengths has a length per string,
+  // negative if the string is NUL-terminated, or is NULL if all are.
+
+  extern void call(const GLuint id, const GLuint64 *args, const GLushort count, const char * const *strings, const GLint *lengths, const std::size_t stringCount);
+
+  // Argument words
+
+  template<typename T> inline GLuint64 word(T *v)        { return static_cast<GLuint64>(reinterpret_cast<size_t>(v)); }
+  template<typename T> inline GLuint64 word(const T v)   { return static_cast<GLuint64>(v); }
+
+  inline GLuint64 word(const GLfloat v)
+  {
+    union { GLfloat f; GLuint u; } tmp;
+    tmp.f = v;
+    return tmp.u;
+  }
+
+  inline GLuint64 word(const GLdouble v)
+  {
+    union { GLdouble d; GLuint64 u; } tmp;
+    tmp.d = v;
+    return tmp.u;
+  }
+
+  // Render a log as Regal text output, or Chrome trace JSON
+
+  extern bool decode(const std::string &filename, FILE *output, const bool json);
+}
+
+REGAL_NAMESPACE_END
+
+#endif // REGAL_LOG_BINARY
+
+#endif // __REGAL_LOG_BINARY_H__
@@ -0,0 +1,156 @@
+/*
+  Copyright (c) 2011-2013 NVIDIA Corporation
+  Copyright (c) 2011-2013 Cass Everitt
+  Copyright (c) 2012-2013 Scott Nations
+  Copyright (c) 2012-2013 Nigel Stewart
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+    Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+  IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+  OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+  OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+
+ Regal per-thread log ring buffers
+
+ Each logging thread owns a single-producer single-consumer ring of
+ pre-allocated records.  The producer only stores into its own ring,
+ the background writer drains all of them, so logging from the
+ rendering thread takes no locks.  When a ring is full the message
+ is dropped and counted rather than blocking.  Once its thread has
+ exited, a ring is freed by the writer after draining it.
+
+ */
+
+#ifndef __REGAL_LOG_RING_H__
+#define __REGAL_LOG_RING_H__
+
+#include "RegalUtil.h"
+
+REGAL_GLOBAL_BEGIN
+
+#include <string>
+#include <vector>
+
+#include "RegalLog.h"
+#include "RegalTimer.h"
+#include "RegalThread.h"
+
+REGAL_GLOBAL_END
+
+REGAL_NAMESPACE_BEGIN
+
+namespace Logging
+{
+  // Ordering of ring indices between the producer and consumer
+
+  using Thread::loadAcquire;
+  using Thread::storeRelease;
+
+  //
+  // Record
+  //
+
+  // Everything needed to format a message on the writer thread.
+  // Prefix and delimiter are string literals from the log macros.
+
+  struct Record
+  {
+    Record()
+    : mode(LOG_INFO), prefix(NULL), delim(NULL), hasName(false), indent(0), thread(0), time(0)
+    {
+    }
+
+    Mode          mode;
+    const char   *prefix;
+    const char   *delim;
+    bool          hasName;
+    std::string   name;
+    std::string   text;
+    std::size_t   indent;
+    std::size_t   thread;
+    Timer::Value  time;
+  };
+
+  //
+  // Ring
+  //
+
+  struct Ring
+  {
+    explicit Ring(const std::size_t size)
+    : records(size), head(0), tail(0), dropped(0), released(false), reported(0)
+    {
+      RegalAssert(size>0);
+    }
+
+    // Producer side, null if full
+
+    inline Record *back()
+    {
+      const std::size_t h = head;
+      if (h-loadAcquire(tail)>=records.size())
+      {
+        storeRelease(dropped,dropped+1);
+        return NULL;
+      }
+      return &records[h%records.size()];
+    }
+
+    inline void push()            { storeRelease(head,head+1); }
+
+    // Consumer side, null if empty
+
+    inline Record *front()
+    {
+      const std::size_t t = tail;
+      return t==loadAcquire(head) ? NULL : &records[t%records.size()];
+    }
+
+    inline void pop()             { storeRelease(tail,tail+1); }
+
+    inline std::size_t size() const     { return loadAcquire(head)-loadAcquire(tail); }
+    inline std::size_t capacity() const { return records.size(); }
+
+    std::vector<Record>   records;
+    volatile std::size_t  head;     // Written by the producer only
+    volatile std::size_t  tail;     // Written by the consumer only
+    volatile std::size_t  dropped;  // Written by the producer only
+    volatile bool         released; // Producer has exited, written by the producer only
+    std::size_t           reported; // Drops already logged, consumer only
+
+  private:
+    Ring(const Ring &other);
+    Ring &operator=(const Ring &other);
+  };
+
+  // From the exiting thread, after its last message
+
+  void releaseRing(Ring *ring);
+
+#if REGAL_LOG_ASYNC
+  extern std::vector<Ring *> *rings;
+#endif
+}
+
+REGAL_NAMESPACE_END
+
+#endif // __REGAL_LOG_RING_H__
@@ -49,6 +49,7 @@ REGAL_GLOBAL_BEGIN
 
 #include "RegalLog.h"
 #include "RegalContext.h"
+#include "RegalFrame.h"
 
 REGAL_GLOBAL_END
 
@@ -76,6 +77,10 @@ struct Marker {
     Internal("Regal::Marker::PushGroupMarker","marker=",marker);
     //Info("// ",marker," ...");
     markerStack.push_back(marker);
+#if REGAL_FRAME
+    if (ctx.frame)
+      ctx.frame->pushGroupMarker(ctx,marker);
+#endif
   }
 
   void PopGroupMarker(RegalContext &ctx)
@@ -84,6 +89,10 @@ struct Marker {
     Internal("Regal::Marker::PopGroupMarker","()");
     if (markerStack.size())
     {
+#if REGAL_FRAME
+      if (ctx.frame)
+        ctx.frame->popGroupMarker(ctx);
+#endif
       std::string marker;
       marker.swap(markerStack.back());
       markerStack.pop_back();
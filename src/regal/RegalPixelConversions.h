@@ -53,6 +53,40 @@ using ::boost::uint8_t;
 using ::boost::uint16_t;
 using ::boost::uint32_t;
 
+// SSE2 kernels are used wherever the compiler targets SSE2.
+// SSSE3 kernels are compiled in alongside and selected at runtime.
+
+#ifndef REGAL_PIXEL_CONVERSIONS_SSE2
+# if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  define REGAL_PIXEL_CONVERSIONS_SSE2 1
+# else
+#  define REGAL_PIXEL_CONVERSIONS_SSE2 0
+# endif
+#endif
+
+#ifndef REGAL_PIXEL_CONVERSIONS_SSSE3
+# if REGAL_PIXEL_CONVERSIONS_SSE2 && (defined(_MSC_VER) || defined(__clang__) || __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))
+#  define REGAL_PIXEL_CONVERSIONS_SSSE3 1
+# else
+#  define REGAL_PIXEL_CONVERSIONS_SSSE3 0
+# endif
+#endif
+
+#if REGAL_PIXEL_CONVERSIONS_SSE2
+#include <emmintrin.h>
+#endif
+
+#if REGAL_PIXEL_CONVERSIONS_SSSE3
+#include <tmmintrin.h>
+# if defined(_MSC_VER)
+#  include <intrin.h>
+#  define REGAL_TARGET_SSSE3
+# else
+#  include <cpuid.h>
+#  define REGAL_TARGET_SSSE3 __attribute__((target("ssse3")))
+# endif
+#endif
+
 REGAL_GLOBAL_END
 
 REGAL_NAMESPACE_BEGIN
@@ -126,7 +126,7 @@ template <> struct Component<0> {
 template <typename P_> uint32_t Read ( const uint8_t* src );
 template <typename P_> void     Write( uint8_t* dst, uint32_t v );
 
-template <> uint32_t Read<uint32_t>( const uint8_t* src ) {
+template <> inline uint32_t Read<uint32_t>( const uint8_t* src ) {
   uint32_t v = 0;
   v |= src[ 0 ] << 0;
   v |= src[ 1 ] << 8;
@@ -135,7 +135,7 @@ template <> uint32_t Read<uint32_t>( const uint8_t* src ) {
   return v;
 }
 
-template <> uint32_t Read<uint24_t>( const uint8_t* src ) {
+template <> inline uint32_t Read<uint24_t>( const uint8_t* src ) {
   uint32_t v = 0;
   v |= src[ 0 ] << 0;
   v |= src[ 1 ] << 8;
@@ -143,39 +143,258 @@ template <> uint32_t Read<uint24_t>( const uint8_t* src ) {
   return v;
 }
 
-template <> uint32_t Read<uint16_t>( const uint8_t* src ) {
+template <> inline uint32_t Read<uint16_t>( const uint8_t* src ) {
   uint32_t v = 0;
   v |= src[ 0 ] << 0;
   v |= src[ 1 ] << 8;
   return v;
 }
 
-template <> uint32_t Read<uint8_t>( const uint8_t* src ) {
+template <> inline uint32_t Read<uint8_t>( const uint8_t* src ) {
   return src[ 0 ] << 0;
 }
 
-template <> void Write<uint32_t>( uint8_t* dst, uint32_t v ) {
+template <> inline void Write<uint32_t>( uint8_t* dst, uint32_t v ) {
   dst[ 0 ] = static_cast<uint8_t>(( v >>  0 ) & 255);
   dst[ 1 ] = static_cast<uint8_t>(( v >>  8 ) & 255);
   dst[ 2 ] = static_cast<uint8_t>(( v >> 16 ) & 255);
   dst[ 3 ] = static_cast<uint8_t>(( v >> 24 ) & 255);
 }
 
-template <> void Write<uint24_t>( uint8_t* dst, uint32_t v ) {
+template <> inline void Write<uint24_t>( uint8_t* dst, uint32_t v ) {
   dst[ 0 ] = static_cast<uint8_t>(( v >>  0 ) & 255);
   dst[ 1 ] = static_cast<uint8_t>(( v >>  8 ) & 255);
   dst[ 2 ] = static_cast<uint8_t>(( v >> 16 ) & 255);
 }
 
-template <> void Write<uint16_t>( uint8_t* dst, uint32_t v ) {
+template <> inline void Write<uint16_t>( uint8_t* dst, uint32_t v ) {
   dst[ 0 ] = static_cast<uint8_t>(( v >> 0 ) & 255);
   dst[ 1 ] = static_cast<uint8_t>(( v >> 8 ) & 255);
 }
 
-template <> void Write<uint8_t>( uint8_t* dst, uint32_t v ) {
+template <> inline void Write<uint8_t>( uint8_t* dst, uint32_t v ) {
   dst[ 0 ] = static_cast<uint8_t>(( v >> 0 ) & 255);
 }
 
+// ===========================================================================
+// SIMD pixel packing and unpacking.
+//
+// PixelSimd converts as many leading pixels as a vector kernel can handle,
+// returning the number converted. The remainder is left for the scalar
+// code. The default handles none, so a format or instruction set without a
+// kernel simply falls back to the scalar code.
+// ===========================================================================
+
+template <typename PT_, uint32_t RM_, uint32_t GM_, uint32_t BM_, uint32_t AM_>
+struct PixelSimd
+{
+  static size_t Unpack32( const uint8_t* src, uint32_t* dst, size_t cnt ) {
+    UNUSED_PARAMETER(src); UNUSED_PARAMETER(dst); UNUSED_PARAMETER(cnt);
+    return 0;
+  }
+
+  static size_t Pack32( const uint32_t* src, uint8_t* dst, size_t cnt ) {
+    UNUSED_PARAMETER(src); UNUSED_PARAMETER(dst); UNUSED_PARAMETER(cnt);
+    return 0;
+  }
+};
+
+#if REGAL_PIXEL_CONVERSIONS_SSE2
+
+// Single component packing and unpacking of eight 16 bit lanes, matching
+// Component<>::u8 and Component<>::p8 for each lane.
+
+template <uint32_t CM_> struct ComponentSse2
+{
+  typedef Component<CM_> C;
+
+  enum Value
+  {
+    BITS  = C::COMPONENT_BIT_COUNT,
+    SHIFT = C::LEADING_BIT_COUNT
+  };
+
+  static inline __m128i u8( __m128i v )
+  {
+    v = _mm_and_si128( v, _mm_set1_epi16( static_cast<short>( CM_ ) ) );
+    v = _mm_srli_epi16( v, SHIFT );
+    v = _mm_slli_epi16( v, 8 - BITS );
+    v = _mm_or_si128( v, _mm_srli_epi16( v, ( BITS * 1 ) < 8 ? ( BITS * 1 ) : 0 ) );
+    v = _mm_or_si128( v, _mm_srli_epi16( v, ( BITS * 2 ) < 8 ? ( BITS * 2 ) : 0 ) );
+    v = _mm_or_si128( v, _mm_srli_epi16( v, ( BITS * 4 ) < 8 ? ( BITS * 4 ) : 0 ) );
+    return v;
+  }
+
+  static inline __m128i p8( __m128i v )
+  {
+    return _mm_slli_epi16( _mm_srli_epi16( v, 8 - BITS ), SHIFT );
+  }
+};
+
+template <> struct ComponentSse2<0>
+{
+  static inline __m128i u8( __m128i ) { return _mm_setzero_si128(); }
+  static inline __m128i p8( __m128i ) { return _mm_setzero_si128(); }
+};
+
+// Eight pixels, one per 16 bit lane, to and from RGBA8888.
+
+template <uint32_t RM_, uint32_t GM_, uint32_t BM_, uint32_t AM_>
+struct PixelSse2
+{
+  static inline void Unpack8( __m128i v, uint32_t* dst )
+  {
+    __m128i rg = _mm_or_si128( ComponentSse2<RM_>::u8( v ), _mm_slli_epi16( ComponentSse2<GM_>::u8( v ), 8 ) );
+    __m128i ba = _mm_or_si128( ComponentSse2<BM_>::u8( v ), _mm_slli_epi16( ComponentSse2<AM_>::u8( v ), 8 ) );
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( dst     ), _mm_unpacklo_epi16( rg, ba ) );
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( dst + 4 ), _mm_unpackhi_epi16( rg, ba ) );
+  }
+
+  static inline __m128i Pack8( const uint32_t* src )
+  {
+    const __m128i mask = _mm_set1_epi32( 0xff );
+    __m128i p0 = _mm_loadu_si128( reinterpret_cast<const __m128i*>( src     ) );
+    __m128i p1 = _mm_loadu_si128( reinterpret_cast<const __m128i*>( src + 4 ) );
+    __m128i r = _mm_packs_epi32( _mm_and_si128( p0, mask ), _mm_and_si128( p1, mask ) );
+    __m128i g = _mm_packs_epi32( _mm_and_si128( _mm_srli_epi32( p0, 8 ), mask ), _mm_and_si128( _mm_srli_epi32( p1, 8 ), mask ) );
+    __m128i b = _mm_packs_epi32( _mm_and_si128( _mm_srli_epi32( p0, 16 ), mask ), _mm_and_si128( _mm_srli_epi32( p1, 16 ), mask ) );
+    __m128i a = _mm_packs_epi32( _mm_srli_epi32( p0, 24 ), _mm_srli_epi32( p1, 24 ) );
+    return _mm_or_si128( _mm_or_si128( ComponentSse2<RM_>::p8( r ), ComponentSse2<GM_>::p8( g ) ),
+                         _mm_or_si128( ComponentSse2<BM_>::p8( b ), ComponentSse2<AM_>::p8( a ) ) );
+  }
+};
+
+// 16 bit formats: RGB565, RGBA4444, RGBA5551, LUMINANCE_ALPHA, etc.
+
+template <uint32_t RM_, uint32_t GM_, uint32_t BM_, uint32_t AM_>
+struct PixelSimd<uint16_t, RM_, GM_, BM_, AM_>
+{
+  typedef PixelSse2<RM_, GM_, BM_, AM_> Sse2;
+
+  static size_t Unpack32( const uint8_t* src, uint32_t* dst, size_t cnt ) {
+    const size_t n = cnt & ~size_t( 7 );
+    for ( size_t i = 0; i < n; i += 8 ) {
+      Sse2::Unpack8( _mm_loadu_si128( reinterpret_cast<const __m128i*>( src + i * 2 ) ), dst + i );
+    }
+    return n;
+  }
+
+  static size_t Pack32( const uint32_t* src, uint8_t* dst, size_t cnt ) {
+    const size_t n = cnt & ~size_t( 7 );
+    for ( size_t i = 0; i < n; i += 8 ) {
+      _mm_storeu_si128( reinterpret_cast<__m128i*>( dst + i * 2 ), Sse2::Pack8( src + i ) );
+    }
+    return n;
+  }
+};
+
+// 8 bit formats: LUMINANCE, ALPHA
+
+template <uint32_t RM_, uint32_t GM_, uint32_t BM_, uint32_t AM_>
+struct PixelSimd<uint8_t, RM_, GM_, BM_, AM_>
+{
+  typedef PixelSse2<RM_, GM_, BM_, AM_> Sse2;
+
+  static size_t Unpack32( const uint8_t* src, uint32_t* dst, size_t cnt ) {
+    const __m128i zero = _mm_setzero_si128();
+    const size_t n = cnt & ~size_t( 15 );
+    for ( size_t i = 0; i < n; i += 16 ) {
+      __m128i v = _mm_loadu_si128( reinterpret_cast<const __m128i*>( src + i ) );
+      Sse2::Unpack8( _mm_unpacklo_epi8( v, zero ), dst + i     );
+      Sse2::Unpack8( _mm_unpackhi_epi8( v, zero ), dst + i + 8 );
+    }
+    return n;
+  }
+
+  static size_t Pack32( const uint32_t* src, uint8_t* dst, size_t cnt ) {
+    const size_t n = cnt & ~size_t( 15 );
+    for ( size_t i = 0; i < n; i += 16 ) {
+      __m128i v = _mm_packus_epi16( Sse2::Pack8( src + i ), Sse2::Pack8( src + i + 8 ) );
+      _mm_storeu_si128( reinterpret_cast<__m128i*>( dst + i ), v );
+    }
+    return n;
+  }
+};
+
+#endif // REGAL_PIXEL_CONVERSIONS_SSE2
+
+#if REGAL_PIXEL_CONVERSIONS_SSSE3
+
+// Runtime check for SSSE3, which is not implied by the compiler target.
+
+inline bool DetectSsse3()
+{
+#if defined(_MSC_VER)
+  int info[ 4 ];
+  __cpuid( info, 1 );
+  return ( info[ 2 ] & ( 1 << 9 ) ) != 0;
+#else
+  unsigned int eax, ebx, ecx, edx;
+  if ( !__get_cpuid( 1, &eax, &ebx, &ecx, &edx ) ) {
+    return false;
+  }
+  return ( ecx & ( 1 << 9 ) ) != 0;
+#endif
+}
+
+inline bool HasSsse3()
+{
+  static const bool ssse3 = DetectSsse3();
+  return ssse3;
+}
+
+// 24 bit RGB, sixteen pixels (48 bytes) at a time, byte shuffled to and
+// from RGBA8888. Alpha unpacks as zero, as for the scalar code.
+
+REGAL_TARGET_SSSE3 inline size_t Unpack24Ssse3( const uint8_t* src, uint32_t* dst, size_t cnt )
+{
+  const __m128i shuffle = _mm_setr_epi8( 0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1 );
+  const size_t n = cnt & ~size_t( 15 );
+  for ( size_t i = 0; i < n; i += 16 ) {
+    __m128i a = _mm_loadu_si128( reinterpret_cast<const __m128i*>( src + i * 3      ) );
+    __m128i b = _mm_loadu_si128( reinterpret_cast<const __m128i*>( src + i * 3 + 16 ) );
+    __m128i c = _mm_loadu_si128( reinterpret_cast<const __m128i*>( src + i * 3 + 32 ) );
+    __m128i* d = reinterpret_cast<__m128i*>( dst + i );
+    _mm_storeu_si128( d + 0, _mm_shuffle_epi8( a, shuffle ) );
+    _mm_storeu_si128( d + 1, _mm_shuffle_epi8( _mm_alignr_epi8( b, a, 12 ), shuffle ) );
+    _mm_storeu_si128( d + 2, _mm_shuffle_epi8( _mm_alignr_epi8( c, b,  8 ), shuffle ) );
+    _mm_storeu_si128( d + 3, _mm_shuffle_epi8( _mm_srli_si128( c, 4 ), shuffle ) );
+  }
+  return n;
+}
+
+REGAL_TARGET_SSSE3 inline size_t Pack24Ssse3( const uint32_t* src, uint8_t* dst, size_t cnt )
+{
+  const __m128i shuffle = _mm_setr_epi8( 0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1 );
+  const size_t n = cnt & ~size_t( 15 );
+  for ( size_t i = 0; i < n; i += 16 ) {
+    const __m128i* s = reinterpret_cast<const __m128i*>( src + i );
+    __m128i p0 = _mm_shuffle_epi8( _mm_loadu_si128( s + 0 ), shuffle );
+    __m128i p1 = _mm_shuffle_epi8( _mm_loadu_si128( s + 1 ), shuffle );
+    __m128i p2 = _mm_shuffle_epi8( _mm_loadu_si128( s + 2 ), shuffle );
+    __m128i p3 = _mm_shuffle_epi8( _mm_loadu_si128( s + 3 ), shuffle );
+    __m128i* d = reinterpret_cast<__m128i*>( dst + i * 3 );
+    _mm_storeu_si128( d + 0, _mm_or_si128( p0, _mm_slli_si128( p1, 12 ) ) );
+    _mm_storeu_si128( d + 1, _mm_or_si128( _mm_srli_si128( p1, 4 ), _mm_slli_si128( p2, 8 ) ) );
+    _mm_storeu_si128( d + 2, _mm_or_si128( _mm_srli_si128( p2, 8 ), _mm_slli_si128( p3, 4 ) ) );
+  }
+  return n;
+}
+
+template <>
+struct PixelSimd<uint24_t, 0x0000ff, 0x00ff00, 0xff0000, 0>
+{
+  static size_t Unpack32( const uint8_t* src, uint32_t* dst, size_t cnt ) {
+    return HasSsse3() ? Unpack24Ssse3( src, dst, cnt ) : 0;
+  }
+
+  static size_t Pack32( const uint32_t* src, uint8_t* dst, size_t cnt ) {
+    return HasSsse3() ? Pack24Ssse3( src, dst, cnt ) : 0;
+  }
+};
+
+#endif // REGAL_PIXEL_CONVERSIONS_SSSE3
+
 // ===========================================================================
 // Pixel packing and unpacking, all components, and for any number of
 // continuous pixel data in memory.
@@ -238,11 +457,15 @@ struct PixelAny
   }
 
   static void Unpack32( const void* src, uint32_t* dst, size_t cnt ) {
-    Unpack32( static_cast<const uint8_t*>( src ), dst, cnt );
+    const uint8_t* s = static_cast<const uint8_t*>( src );
+    size_t done = PixelSimd<PT_, RM_, GM_, BM_, AM_>::Unpack32( s, dst, cnt );
+    Unpack32( s + done * PACKED_BYTES, dst + done, cnt - done );
   }
 
   static void Pack32( const uint32_t* src, void* dst, size_t cnt ) {
-    Pack32( src, static_cast<uint8_t*>( dst ), cnt );
+    uint8_t* d = static_cast<uint8_t*>( dst );
+    size_t done = PixelSimd<PT_, RM_, GM_, BM_, AM_>::Pack32( src, d, cnt );
+    Pack32( src + done, d + done * PACKED_BYTES, cnt - done );
   }
 };
 
@@ -279,21 +502,34 @@ struct Pixel : public PixelAny<PT_, PBS_, RM_, GM_, BM_, AM_>
     }
   }
 
+  // The vector kernels handle any alignment, the scalar code handles
+  // whatever they leave over.
+
   static void Unpack32( const void* src, uint32_t* dst, size_t cnt ) {
-    bool aligned = ( reinterpret_cast<intptr_t>( src ) & ( PACKED_BYTES - 1 ) ) == 0;
+    const uint8_t* s = static_cast<const uint8_t*>( src );
+    size_t done = PixelSimd<PT_, RM_, GM_, BM_, AM_>::Unpack32( s, dst, cnt );
+    s += done * PACKED_BYTES;
+    dst += done;
+    cnt -= done;
+    bool aligned = ( reinterpret_cast<intptr_t>( s ) & ( PACKED_BYTES - 1 ) ) == 0;
     if ( aligned ) {
-      Unpack32( static_cast<const PixelType*>( src ), dst, cnt );
+      Unpack32( reinterpret_cast<const PixelType*>( s ), dst, cnt );
     } else {
-      BaseType::Unpack32( static_cast<const uint8_t*>( src ), dst, cnt );
+      BaseType::Unpack32( s, dst, cnt );
     }
   }
 
   static void Pack32( const uint32_t* src, void* dst, size_t cnt ) {
-    bool aligned = ( reinterpret_cast<intptr_t>( dst ) & ( PACKED_BYTES - 1 ) ) == 0;
+    uint8_t* d = static_cast<uint8_t*>( dst );
+    size_t done = PixelSimd<PT_, RM_, GM_, BM_, AM_>::Pack32( src, d, cnt );
+    src += done;
+    d += done * PACKED_BYTES;
+    cnt -= done;
+    bool aligned = ( reinterpret_cast<intptr_t>( d ) & ( PACKED_BYTES - 1 ) ) == 0;
     if ( aligned ) {
-      Pack32( src, static_cast<PixelType*>( dst ), cnt );
+      Pack32( src, reinterpret_cast<PixelType*>( d ), cnt );
     } else {
-      BaseType::Pack32( src, static_cast<uint8_t*>( dst ), cnt );
+      BaseType::Pack32( src, d, cnt );
     }
   }
 };
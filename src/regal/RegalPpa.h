@@ -288,18 +288,20 @@ struct Ppa : public State::Stencil, State::Depth, State::Polygon, State::Transfo
       GLbitfield mask = maskStack.back();
       maskStack.pop_back();
 
+      // With GL_ENABLE_BIT, the enables shared with other groups
+      // are restored once, by Enable
+
+      const bool enables = !(mask&GL_ENABLE_BIT);
+
       if (mask&GL_DEPTH_BUFFER_BIT)
       {
         RegalAssert(depthStack.size());
         State::Depth::swap(depthStack.back());
-        depthStack.pop_back();
 
         Internal("Regal::Ppa::PopAttrib GL_DEPTH_BUFFER_BIT ",State::Depth::toString());
 
-        // Ideally we'd only set the state that has changed
-        // since the glPushAttrib() - revisit
-
-        State::Depth::set(ctx->dispatcher.emulation);
+        State::Depth::transition(ctx->dispatcher.emulation, depthStack.back(), enables);
+        depthStack.pop_back();
 
         mask &= ~GL_DEPTH_BUFFER_BIT;
       }
@@ -308,14 +310,11 @@ struct Ppa : public State::Stencil, State::Depth, State::Polygon, State::Transfo
       {
         RegalAssert(stencilStack.size());
         State::Stencil::swap(stencilStack.back());
-        stencilStack.pop_back();
 
         Internal("Regal::Ppa::PopAttrib GL_STENCIL_BUFFER_BIT ",State::Stencil::toString());
 
-        // Ideally we'd only set the state that has changed
-        // since the glPushAttrib() - revisit
-
-        State::Stencil::set(ctx->dispatcher.emulation);
+        State::Stencil::transition(ctx->dispatcher.emulation, stencilStack.back(), enables);
+        stencilStack.pop_back();
 
         mask &= ~GL_STENCIL_BUFFER_BIT;
       }
@@ -324,14 +323,11 @@ struct Ppa : public State::Stencil, State::Depth, State::Polygon, State::Transfo
       {
         RegalAssert(polygonStack.size());
         State::Polygon::swap(polygonStack.back());
-        polygonStack.pop_back();
 
         Internal("Regal::Ppa::PopAttrib GL_POLYGON_BIT ",State::Polygon::toString());
 
-        // Ideally we'd only set the state that has changed
-        // since the glPushAttrib() - revisit
-
-        State::Polygon::set(ctx->dispatcher.emulation);
+        State::Polygon::transition(ctx->dispatcher.emulation, polygonStack.back(), enables);
+        polygonStack.pop_back();
 
         mask &= ~GL_POLYGON_BIT;
       }
@@ -343,7 +339,7 @@ struct Ppa : public State::Stencil, State::Depth, State::Polygon, State::Transfo
 
         Internal("Regal::Ppa::PopAttrib GL_TRANSFORM_BIT ",State::Transform::toString());
 
-        State::Transform::transition(ctx->dispatcher.emulation, transformStack.back());
+        State::Transform::transition(ctx->dispatcher.emulation, transformStack.back(), enables);
         transformStack.pop_back();
 
         mask &= ~GL_TRANSFORM_BIT;
@@ -353,14 +349,11 @@ struct Ppa : public State::Stencil, State::Depth, State::Polygon, State::Transfo
       {
         RegalAssert(hintStack.size());
         State::Hint::swap(hintStack.back());
-        hintStack.pop_back();
 
         Internal("Regal::Ppa::PopAttrib GL_HINT_BIT ",State::Hint::toString());
 
-        // Ideally we'd only set the state that has changed
-        // since the glPushAttrib() - revisit
-
-        State::Hint::set(ctx->dispatcher.emulation);
+        State::Hint::transition(ctx->dispatcher.emulation, hintStack.back());
+        hintStack.pop_back();
 
         mask &= ~GL_HINT_BIT;
       }
@@ -369,14 +362,11 @@ struct Ppa : public State::Stencil, State::Depth, State::Polygon, State::Transfo
       {
         RegalAssert(enableStack.size());
         State::Enable::swap(enableStack.back());
-        enableStack.pop_back();
 
         Internal("Regal::Ppa::PopAttrib GL_ENABLE_BIT ",State::Enable::toString());
 
-        // Ideally we'd only set the state that has changed
-        // since the glPushAttrib() - revisit
-
-        State::Enable::set(*ctx);
+        State::Enable::transition(*ctx, enableStack.back());
+        enableStack.pop_back();
 
         mask &= ~GL_ENABLE_BIT;
       }
@@ -385,14 +375,11 @@ struct Ppa : public State::Stencil, State::Depth, State::Polygon, State::Transfo
       {
         RegalAssert(listStack.size());
         State::List::swap(listStack.back());
-        listStack.pop_back();
 
         Internal("Regal::Ppa::PopAttrib GL_LIST_BIT ",State::List::toString());
 
-        // Ideally we'd only set the state that has changed
-        // since the glPushAttrib() - revisit
-
-        State::List::set(ctx->dispatcher.emulation);
+        State::List::transition(ctx->dispatcher.emulation, listStack.back());
+        listStack.pop_back();
 
         mask &= ~GL_LIST_BIT;
       }
@@ -401,14 +388,11 @@ struct Ppa : public State::Stencil, State::Depth, State::Polygon, State::Transfo
       {
         RegalAssert(accumBufferStack.size());
         State::AccumBuffer::swap(accumBufferStack.back());
-        accumBufferStack.pop_back();
 
         Internal("Regal::Ppa::PopAttrib GL_ACCUM_BUFFER_BIT ",State::AccumBuffer::toString());
 
-        // Ideally we'd only set the state that has changed
-        // since the glPushAttrib() - revisit
-
-        State::AccumBuffer::set(ctx->dispatcher.emulation);
+        State::AccumBuffer::transition(ctx->dispatcher.emulation, accumBufferStack.back());
+        accumBufferStack.pop_back();
 
         mask &= ~GL_ACCUM_BUFFER_BIT;
       }
@@ -417,16 +401,13 @@ struct Ppa : public State::Stencil, State::Depth, State::Polygon, State::Transfo
       {
         RegalAssert(scissorStack.size());
         State::Scissor::swap(scissorStack.back());
-        scissorStack.pop_back();
 
         Internal("Regal::Ppa::PopAttrib GL_SCISSOR_BIT ",State::Scissor::toString());
 
-        // Ideally we'd only set the state that has changed
-        // since the glPushAttrib() - revisit
-
         if (!State::Scissor::fullyDefined())
           State::Scissor::getUndefined(ctx->dispatcher.emulation);
-        State::Scissor::set(ctx->dispatcher.emulation);
+        State::Scissor::transition(ctx->dispatcher.emulation, scissorStack.back(), enables);
+        scissorStack.pop_back();
 
         mask &= ~GL_SCISSOR_BIT;
       }
@@ -435,16 +416,13 @@ struct Ppa : public State::Stencil, State::Depth, State::Polygon, State::Transfo
       {
         RegalAssert(viewportStack.size());
         State::Viewport::swap(viewportStack.back());
-        viewportStack.pop_back();
 
         Internal("Regal::Ppa::PopAttrib GL_VIEWPORT_BIT ",State::Viewport::toString());
 
-        // Ideally we'd only set the state that has changed
-        // since the glPushAttrib() - revisit
-
         if (!State::Viewport::fullyDefined())
           State::Viewport::getUndefined(ctx->dispatcher.emulation);
-        State::Viewport::set(ctx->dispatcher.emulation);
+        State::Viewport::transition(ctx->dispatcher.emulation, viewportStack.back());
+        viewportStack.pop_back();
 
         mask &= ~GL_VIEWPORT_BIT;
       }
@@ -453,14 +431,11 @@ struct Ppa : public State::Stencil, State::Depth, State::Polygon, State::Transfo
       {
         RegalAssert(lineStack.size());
         State::Line::swap(lineStack.back());
-        lineStack.pop_back();
 
         Internal("Regal::Ppa::PopAttrib GL_LINE_BIT ",State::Line::toString());
 
-        // Ideally we'd only set the state that has changed
-        // since the glPushAttrib() - revisit
-
-        State::Line::set(ctx->dispatcher.emulation);
+        State::Line::transition(ctx->dispatcher.emulation, lineStack.back(), enables);
+        lineStack.pop_back();
 
         mask &= ~GL_LINE_BIT;
       }
@@ -469,14 +444,11 @@ struct Ppa : public State::Stencil, State::Depth, State::Polygon, State::Transfo
       {
         RegalAssert(multisampleStack.size());
         State::Multisample::swap(multisampleStack.back());
-        multisampleStack.pop_back();
 
         Internal("Regal::Ppa::PopAttrib GL_MULTISAMPLE_BIT ",State::Multisample::toString());
 
-        // Ideally we'd only set the state that has changed
-        // since the glPushAttrib() - revisit
-
-        State::Multisample::set(*ctx);
+        State::Multisample::transition(*ctx, multisampleStack.back(), enables);
+        multisampleStack.pop_back();
 
         mask &= ~GL_MULTISAMPLE_BIT;
       }
@@ -485,14 +457,11 @@ struct Ppa : public State::Stencil, State::Depth, State::Polygon, State::Transfo
       {
         RegalAssert(evalStack.size());
         State::Eval::swap(evalStack.back());
-        evalStack.pop_back();
 
         Internal("Regal::Ppa::PopAttrib GL_EVAL_BIT ",State::Eval::toString());
 
-        // Ideally we'd only set the state that has changed
-        // since the glPushAttrib() - revisit
-
-        State::Eval::set(ctx->dispatcher.emulation);
+        State::Eval::transition(ctx->dispatcher.emulation, evalStack.back(), enables);
+        evalStack.pop_back();
 
         mask &= ~GL_EVAL_BIT;
       }
@@ -501,14 +470,11 @@ struct Ppa : public State::Stencil, State::Depth, State::Polygon, State::Transfo
       {
         RegalAssert(fogStack.size());
         State::Fog::swap(fogStack.back());
-        fogStack.pop_back();
 
         Internal("Regal::Ppa::PopAttrib GL_FOG_BIT ",State::Fog::toString());
 
-        // Ideally we'd only set the state that has changed
-        // since the glPushAttrib() - revisit
-
-        State::Fog::set(ctx->dispatcher.emulation);
+        State::Fog::transition(ctx->dispatcher.emulation, fogStack.back(), enables);
+        fogStack.pop_back();
 
         mask &= ~GL_FOG_BIT;
       }
@@ -517,16 +483,13 @@ struct Ppa : public State::Stencil, State::Depth, State::Polygon, State::Transfo
       {
         RegalAssert(pointStack.size());
         State::Point::swap(pointStack.back());
-        pointStack.pop_back();
 
         Internal("Regal::Ppa::PopAttrib GL_POINT_BIT ",State::Point::toString());
 
-        // Ideally we'd only set the state that has changed
-        // since the glPushAttrib() - revisit
-
         if (!State::Point::fullyDefined())
           State::Point::getUndefined(ctx->dispatcher.emulation);
-        State::Point::set(ctx->dispatcher.emulation);
+        State::Point::transition(ctx->dispatcher.emulation, pointStack.back(), enables);
+        pointStack.pop_back();
 
         mask &= ~GL_POINT_BIT;
       }
@@ -535,14 +498,11 @@ struct Ppa : public State::Stencil, State::Depth, State::Polygon, State::Transfo
       {
         RegalAssert(polygonStippleStack.size());
         State::PolygonStipple::swap(polygonStippleStack.back());
-        polygonStippleStack.pop_back();
 
         Internal("Regal::Ppa::PopAttrib GL_POLYGON_STIPPLE_BIT ",State::PolygonStipple::toString());
 
-        // Ideally we'd only set the state that has changed
-        // since the glPushAttrib() - revisit
-
-        State::PolygonStipple::set(ctx->dispatcher.emulation);
+        State::PolygonStipple::transition(ctx->dispatcher.emulation, polygonStippleStack.back());
+        polygonStippleStack.pop_back();
 
         mask &= ~GL_POLYGON_STIPPLE_BIT;
       }
@@ -551,16 +511,13 @@ struct Ppa : public State::Stencil, State::Depth, State::Polygon, State::Transfo
       {
         RegalAssert(colorBufferStack.size());
         State::ColorBuffer::swap(colorBufferStack.back());
-        colorBufferStack.pop_back();
 
         Internal("Regal::Ppa::PopAttrib GL_COLOR_BUFFER_BIT ",State::ColorBuffer::toString());
 
-        // Ideally we'd only set the state that has changed
-        // since the glPushAttrib() - revisit
-
         if (!State::ColorBuffer::fullyDefined())
           State::ColorBuffer::getUndefined(ctx->dispatcher.emulation);
-        State::ColorBuffer::set(ctx->dispatcher.emulation);
+        State::ColorBuffer::transition(ctx->dispatcher.emulation, colorBufferStack.back(), enables);
+        colorBufferStack.pop_back();
 
         mask &= ~GL_COLOR_BUFFER_BIT;
       }
@@ -569,16 +526,13 @@ struct Ppa : public State::Stencil, State::Depth, State::Polygon, State::Transfo
       {
         RegalAssert(pixelModeStack.size());
         State::PixelMode::swap(pixelModeStack.back());
-        pixelModeStack.pop_back();
 
         Internal("Regal::Ppa::PopAttrib GL_PIXEL_MODE_BIT ",State::PixelMode::toString());
 
-        // Ideally we'd only set the state that has changed
-        // since the glPushAttrib() - revisit
-
         if (!State::PixelMode::fullyDefined())
           State::PixelMode::getUndefined(ctx->dispatcher.emulation);
-        State::PixelMode::set(ctx->dispatcher.emulation);
+        State::PixelMode::transition(ctx->dispatcher.emulation, pixelModeStack.back(), enables);
+        pixelModeStack.pop_back();
 
         mask &= ~GL_PIXEL_MODE_BIT;
       }
@@ -587,14 +541,11 @@ struct Ppa : public State::Stencil, State::Depth, State::Polygon, State::Transfo
       {
         RegalAssert(lightingStack.size());
         State::Lighting::swap(lightingStack.back());
-        lightingStack.pop_back();
 
         Internal("Regal::Ppa::PopAttrib GL_LIGHTING_BIT ",State::Lighting::toString());
 
-        // Ideally we'd only set the state that has changed
-        // since the glPushAttrib() - revisit
-
-        State::Lighting::set(ctx->dispatcher.emulation);
+        State::Lighting::transition(ctx->dispatcher.emulation, lightingStack.back(), enables);
+        lightingStack.pop_back();
 
         mask &= ~GL_LIGHTING_BIT;
       }
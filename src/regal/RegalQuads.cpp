@@ -84,6 +84,7 @@ REGAL_GLOBAL_BEGIN
 #include <GL/Regal.h>
 
 #include <vector>
+#include <algorithm>
 
 REGAL_GLOBAL_END
 
@@ -97,6 +98,8 @@ void Quads::Init(RegalContext &ctx)
   elementArrayBuffer = 0;
   DispatchTableGL & d = *ctx.dispatcher.emulation.next();
   d.call(&d.glGenBuffers)(1, &quadIndexBuffer);
+  memset(indexCache, 0, sizeof(indexCache));
+  baseVertex = ctx.info->gl_version_3_2 || ctx.info->gl_arb_draw_elements_base_vertex;
   windingMode = GL_CCW;
   frontFaceMode = backFaceMode = GL_FILL;
   shadeMode = GL_SMOOTH;
@@ -108,7 +111,12 @@ void Quads::Init(RegalContext &ctx)
 
 void Quads::Cleanup(RegalContext &ctx)
 {
-  UNUSED_PARAMETER(ctx);
+  DispatchTableGL & d = *ctx.dispatcher.emulation.next();
+  d.call(&d.glDeleteBuffers)(1, &quadIndexBuffer);
+  for (size_t i = 0; i < IndexPatternCount; ++i)
+    if (indexCache[i].buffer)
+      d.call(&d.glDeleteBuffers)(1, &indexCache[i].buffer);
+  memset(indexCache, 0, sizeof(indexCache));
 }
 
 bool Quads::glDrawArrays(RegalContext *ctx, GLenum mode, GLint first, GLsizei count)
@@ -180,8 +188,6 @@ bool Quads::glDrawArrays(RegalContext *ctx, GLenum mode, GLint first, GLsizei co
 
   DispatchTableGL &dt = ctx->dispatcher.emulation;
 
-#define EMU_QUADS_BUFFER_SIZE 1024
-
   if (drawQuads)
   {
     if (frontFaceMode != GL_FILL || backFaceMode != GL_FILL)
@@ -189,159 +195,19 @@ bool Quads::glDrawArrays(RegalContext *ctx, GLenum mode, GLint first, GLsizei co
 
     GLsizei myCount = count &= (( mode == GL_QUADS ) ? (~0x3) : (~0x1));
 
-    if ( mode == GL_QUAD_STRIP )
-    {
-      // convert quad strips into triangles
-
-      GLuint  indices[EMU_QUADS_BUFFER_SIZE * 6];
-      GLsizei n = ((myCount/2-1) < EMU_QUADS_BUFFER_SIZE) ? (myCount/2-1) : EMU_QUADS_BUFFER_SIZE;
-      if (shadeMode != GL_FLAT)
-      {
-        for (GLuint ii=0; ii<static_cast<GLuint>(n); ii++)
-        {
-#if 1
-          // split 1
-          indices[ii * 6 + 0] = first + ii * 2 + 1;
-          indices[ii * 6 + 1] = first + ii * 2 + 3;
-          indices[ii * 6 + 2] = first + ii * 2 + 0;
-          indices[ii * 6 + 3] = first + ii * 2 + 2;
-          indices[ii * 6 + 4] = first + ii * 2 + 0;
-          indices[ii * 6 + 5] = first + ii * 2 + 3;
-#else
-          // split 1
-          indices[ii * 6 + 0] = first + ii * 2 + 0;
-          indices[ii * 6 + 1] = first + ii * 2 + 1;
-          indices[ii * 6 + 2] = first + ii * 2 + 2;
-          indices[ii * 6 + 3] = first + ii * 2 + 3;
-          indices[ii * 6 + 4] = first + ii * 2 + 2;
-          indices[ii * 6 + 5] = first + ii * 2 + 1;
-
-          // split 3
-          indices[ii * 6 + 0] = first + ii * 2 + 1;
-          indices[ii * 6 + 1] = first + ii * 2 + 0;
-          indices[ii * 6 + 2] = first + ii * 2 + 3;
-          indices[ii * 6 + 3] = first + ii * 2 + 2;
-          indices[ii * 6 + 4] = first + ii * 2 + 3;
-          indices[ii * 6 + 5] = first + ii * 2 + 0;
-
-          // split 4
-          indices[ii * 6 + 0] = first + ii * 2 + 0;
-          indices[ii * 6 + 1] = first + ii * 2 + 2;
-          indices[ii * 6 + 2] = first + ii * 2 + 1;
-          indices[ii * 6 + 3] = first + ii * 2 + 3;
-          indices[ii * 6 + 4] = first + ii * 2 + 1;
-          indices[ii * 6 + 5] = first + ii * 2 + 2;
-#endif
-        }
-      }
-      else
-      {
-        if (!gl_quads_follow_provoking_vertex_convention || (provokeMode == GL_LAST_VERTEX_CONVENTION))
-        {
-          for (GLuint ii=0; ii<static_cast<GLuint>(n); ii++)
-          {
-            indices[ii * 6 + 0] = first + ii * 2 + 0;
-            indices[ii * 6 + 1] = first + ii * 2 + 1;
-            indices[ii * 6 + 2] = first + ii * 2 + 3;
-            indices[ii * 6 + 3] = first + ii * 2 + 2;
-            indices[ii * 6 + 4] = first + ii * 2 + 0;
-            indices[ii * 6 + 5] = first + ii * 2 + 3;
-          }
-        }
-        else
-        {
-          for (GLuint ii=0; ii<static_cast<GLuint>(n); ii++)
-          {
-            indices[ii * 6 + 0] = first + ii * 2 + 1;
-            indices[ii * 6 + 1] = first + ii * 2 + 3;
-            indices[ii * 6 + 2] = first + ii * 2 + 0;
-            indices[ii * 6 + 3] = first + ii * 2 + 3;
-            indices[ii * 6 + 4] = first + ii * 2 + 2;
-            indices[ii * 6 + 5] = first + ii * 2 + 0;
-          }
-        }
-      }
+    // convert quads or quad strips into triangles
 
-      while (myCount >= 2)
-      {
-        Internal("Regal::Emu::Quads::glDrawArrays","glDrawElements(GL_TRIANGLES,",n*6,",GL_UNSIGNED_INT, [])");
-        dt.call(&dt.glDrawElements)(GL_TRIANGLES, n*6, GL_UNSIGNED_INT, indices);
-        myCount -= (EMU_QUADS_BUFFER_SIZE * 2);
-
-        if (myCount >= 2)
-        {
-          n = ((myCount/2-1) < EMU_QUADS_BUFFER_SIZE) ? (myCount/2-1) : EMU_QUADS_BUFFER_SIZE;
-          for (GLsizei ii=0; ii<(n * 6); ii++)
-            indices[ii] += (EMU_QUADS_BUFFER_SIZE * 2);
-        }
-      }
-    }
-    else if ( mode == GL_QUADS )
+    IndexPattern pattern = mode == GL_QUADS ? QuadsFill : QuadStripFill;
+    if (shadeMode == GL_FLAT)
     {
-      // convert quads into triangles
-
-      GLuint  indices[EMU_QUADS_BUFFER_SIZE * 6];
-      GLsizei n = ((myCount/4) < EMU_QUADS_BUFFER_SIZE) ? (myCount/4) : EMU_QUADS_BUFFER_SIZE;
-      if (shadeMode != GL_FLAT)
-      {
-        for (GLuint ii=0; ii<static_cast<GLuint>(n); ii++)
-        {
-          indices[ii * 6 + 0] = first + ii * 4 + 0;
-          indices[ii * 6 + 1] = first + ii * 4 + 1;
-          indices[ii * 6 + 2] = first + ii * 4 + 2;
-          indices[ii * 6 + 3] = first + ii * 4 + 3;
-          indices[ii * 6 + 4] = first + ii * 4 + 0;
-          indices[ii * 6 + 5] = first + ii * 4 + 2;
-        }
-      }
+      if (!gl_quads_follow_provoking_vertex_convention || (provokeMode == GL_LAST_VERTEX_CONVENTION))
+        pattern = mode == GL_QUADS ? QuadsFillFlatLast : QuadStripFillFlatLast;
       else
-      {
-        if (!gl_quads_follow_provoking_vertex_convention || (provokeMode == GL_LAST_VERTEX_CONVENTION))
-        {
-          for (GLuint ii=0; ii<static_cast<GLuint>(n); ii++)
-          {
-            indices[ii * 6 + 0] = first + ii * 4 + 0;
-            indices[ii * 6 + 1] = first + ii * 4 + 1;
-            indices[ii * 6 + 2] = first + ii * 4 + 3;
-            indices[ii * 6 + 3] = first + ii * 4 + 1;
-            indices[ii * 6 + 4] = first + ii * 4 + 2;
-            indices[ii * 6 + 5] = first + ii * 4 + 3;
-          }
-        }
-        else
-        {
-          for (GLuint ii=0; ii<static_cast<GLuint>(n); ii++)
-          {
-            indices[ii * 6 + 0] = first + ii * 4 + 1;
-            indices[ii * 6 + 1] = first + ii * 4 + 2;
-            indices[ii * 6 + 2] = first + ii * 4 + 0;
-            indices[ii * 6 + 3] = first + ii * 4 + 2;
-            indices[ii * 6 + 4] = first + ii * 4 + 3;
-            indices[ii * 6 + 5] = first + ii * 4 + 0;
-          }
-        }
-      }
-
-
-      dt.call(&dt.glBindBuffer)( GL_ELEMENT_ARRAY_BUFFER, quadIndexBuffer);
-      while (myCount >= 4)
-      {
-        dt.call(&dt.glBufferData)( GL_ELEMENT_ARRAY_BUFFER, n * 6 * sizeof( GLuint ), indices, GL_STATIC_DRAW );
-        Internal("Regal::Emu::Quads::glDrawArrays","glDrawElements(GL_TRIANGLES,",n*6,",GL_UNSIGNED_INT, [])");
-        dt.call(&dt.glDrawElements)(GL_TRIANGLES, n*6, GL_UNSIGNED_INT, 0);
-        myCount -= (EMU_QUADS_BUFFER_SIZE * 4);
-
-        if (myCount >= 4)
-        {
-          n = ((myCount/4) < EMU_QUADS_BUFFER_SIZE) ? (myCount/4) : EMU_QUADS_BUFFER_SIZE;
-          for (GLsizei ii=0; ii<(n * 6); ii++)
-            indices[ii] += (EMU_QUADS_BUFFER_SIZE * 4);
-        }
-      }
-      dt.call(&dt.glBindBuffer)( GL_ELEMENT_ARRAY_BUFFER, elementArrayBuffer );
-
+        pattern = mode == GL_QUADS ? QuadsFillFlatFirst : QuadStripFillFlatFirst;
     }
 
+    DrawIndexed(ctx, pattern, GL_TRIANGLES, first, mode == GL_QUADS ? myCount/4 : myCount/2-1);
+
     if (frontFaceMode != GL_FILL)
       dt.call(&dt.glPolygonMode)(GL_FRONT, frontFaceMode);
     if (backFaceMode != GL_FILL)
@@ -354,105 +220,13 @@ bool Quads::glDrawArrays(RegalContext *ctx, GLenum mode, GLint first, GLsizei co
 
     GLsizei myCount = count &= (( mode == GL_QUADS ) ? (~0x3) : (~0x1));
 
-    if ( mode == GL_QUAD_STRIP )
-    {
-      // convert quad strips into quad outlines
-
-      GLuint  indices[EMU_QUADS_BUFFER_SIZE * 6 + 2];
-      GLsizei n = ((myCount/2-1) < EMU_QUADS_BUFFER_SIZE) ? (myCount/2-1) : EMU_QUADS_BUFFER_SIZE;
-
-      if (shadeMode == GL_FLAT && gl_quads_follow_provoking_vertex_convention && (provokeMode == GL_FIRST_VERTEX_CONVENTION))
-      {
-        for (GLuint ii=0; ii<static_cast<GLuint>(n); ii++)
-        {
-          indices[ii * 6 + 0] = first + ii * 2 + 3;
-          indices[ii * 6 + 1] = first + ii * 2 + 1;
-          indices[ii * 6 + 2] = first + ii * 2 + 1;
-          indices[ii * 6 + 3] = first + ii * 2 + 0;
-          indices[ii * 6 + 4] = first + ii * 2 + 2;
-          indices[ii * 6 + 5] = first + ii * 2 + 0;
-        }
-        indices[n * 6 + 0] = first + n * 2 + 1;
-        indices[n * 6 + 1] = first + n * 2 + 0;
-      }
-      else
-      {
-        indices[0] = first + 0;
-        indices[1] = first + 1;
-        for (GLuint ii=0; ii<static_cast<GLuint>(n); ii++)
-        {
-          indices[ii * 6 + 2] = first + ii * 2 + 0;
-          indices[ii * 6 + 3] = first + ii * 2 + 2;
-          indices[ii * 6 + 4] = first + ii * 2 + 2;
-          indices[ii * 6 + 5] = first + ii * 2 + 3;
-          indices[ii * 6 + 6] = first + ii * 2 + 1;
-          indices[ii * 6 + 7] = first + ii * 2 + 3;
-        }
-      }
-
-      while (myCount >= 2)
-      {
-        Internal("Regal::Emu::Quads::glDrawArrays","glDrawElements(GL_LINES,",n*6+2,",GL_UNSIGNED_INT, [])");
-        dt.call(&dt.glDrawElements)(GL_LINES, n*6+2, GL_UNSIGNED_INT, indices);
-        myCount -= (EMU_QUADS_BUFFER_SIZE * 2);
-
-        if (myCount >= 2)
-        {
-          n = ((myCount/2-1) < EMU_QUADS_BUFFER_SIZE) ? (myCount/2-1) : EMU_QUADS_BUFFER_SIZE;
-          for (GLsizei ii=0; ii<(n * 6 + 2); ii++)
-            indices[ii] += (EMU_QUADS_BUFFER_SIZE * 2);
-        }
-      }
-    }
-    else if ( mode == GL_QUADS )
-    {
-      // convert quads into quad outlines
+    // convert quads or quad strips into quad outlines
 
-      GLuint  indices[EMU_QUADS_BUFFER_SIZE * 8];
-      GLsizei n = ((myCount/4) < EMU_QUADS_BUFFER_SIZE) ? (myCount/4) : EMU_QUADS_BUFFER_SIZE;
-      if (shadeMode == GL_FLAT && gl_quads_follow_provoking_vertex_convention && (provokeMode == GL_FIRST_VERTEX_CONVENTION))
-      {
-        for (GLuint ii=0; ii<static_cast<GLuint>(n); ii++)
-        {
-          indices[ii * 8 + 0] = first + ii * 4 + 0;
-          indices[ii * 8 + 1] = first + ii * 4 + 1;
-          indices[ii * 8 + 2] = first + ii * 4 + 0;
-          indices[ii * 8 + 3] = first + ii * 4 + 3;
-          indices[ii * 8 + 4] = first + ii * 4 + 1;
-          indices[ii * 8 + 5] = first + ii * 4 + 2;
-          indices[ii * 8 + 6] = first + ii * 4 + 3;
-          indices[ii * 8 + 7] = first + ii * 4 + 2;
-        }
-      }
-      else
-      {
-        for (GLuint ii=0; ii<static_cast<GLuint>(n); ii++)
-        {
-          indices[ii * 8 + 0] = first + ii * 4 + 1;
-          indices[ii * 8 + 1] = first + ii * 4 + 0;
-          indices[ii * 8 + 2] = first + ii * 4 + 0;
-          indices[ii * 8 + 3] = first + ii * 4 + 3;
-          indices[ii * 8 + 4] = first + ii * 4 + 1;
-          indices[ii * 8 + 5] = first + ii * 4 + 2;
-          indices[ii * 8 + 6] = first + ii * 4 + 2;
-          indices[ii * 8 + 7] = first + ii * 4 + 3;
-        }
-      }
+    IndexPattern pattern = mode == GL_QUADS ? QuadsLine : QuadStripLine;
+    if (shadeMode == GL_FLAT && gl_quads_follow_provoking_vertex_convention && (provokeMode == GL_FIRST_VERTEX_CONVENTION))
+      pattern = mode == GL_QUADS ? QuadsLineFlatFirst : QuadStripLineFlatFirst;
 
-      while (myCount >= 4)
-      {
-        Internal("Regal::Emu::Quads::glDrawArrays","glDrawElements(GL_LINES,",n*8,",GL_UNSIGNED_INT, [])");
-        dt.call(&dt.glDrawElements)(GL_LINES, n*8, GL_UNSIGNED_INT, indices);
-        myCount -= (EMU_QUADS_BUFFER_SIZE * 4);
-
-        if (myCount >= 4)
-        {
-          n = ((myCount/4) < EMU_QUADS_BUFFER_SIZE) ? (myCount/4) : EMU_QUADS_BUFFER_SIZE;
-          for (GLsizei ii=0; ii<(n * 8); ii++)
-            indices[ii] += (EMU_QUADS_BUFFER_SIZE * 4);
-        }
-      }
-    }
+    DrawIndexed(ctx, pattern, GL_LINES, first, mode == GL_QUADS ? myCount/4 : myCount/2-1);
 
     if (frontFaceMode != GL_LINE)
       dt.call(&dt.glPolygonMode)(GL_FRONT, frontFaceMode);
@@ -479,6 +253,269 @@ bool Quads::glDrawArrays(RegalContext *ctx, GLenum mode, GLint first, GLsizei co
   return true;
 }
 
+// Write the indices of n quads, or n quads of a quad strip,
+// starting from vertex first.  Returns the number of indices.
+
+GLsizei Quads::Indices(IndexPattern pattern, GLuint *indices, GLuint first, GLsizei n)
+{
+  switch (pattern)
+  {
+    case QuadsFill:
+      for (GLuint ii=0; ii<static_cast<GLuint>(n); ii++)
+      {
+        indices[ii * 6 + 0] = first + ii * 4 + 0;
+        indices[ii * 6 + 1] = first + ii * 4 + 1;
+        indices[ii * 6 + 2] = first + ii * 4 + 2;
+        indices[ii * 6 + 3] = first + ii * 4 + 3;
+        indices[ii * 6 + 4] = first + ii * 4 + 0;
+        indices[ii * 6 + 5] = first + ii * 4 + 2;
+      }
+      return n * 6;
+
+    case QuadsFillFlatLast:
+      for (GLuint ii=0; ii<static_cast<GLuint>(n); ii++)
+      {
+        indices[ii * 6 + 0] = first + ii * 4 + 0;
+        indices[ii * 6 + 1] = first + ii * 4 + 1;
+        indices[ii * 6 + 2] = first + ii * 4 + 3;
+        indices[ii * 6 + 3] = first + ii * 4 + 1;
+        indices[ii * 6 + 4] = first + ii * 4 + 2;
+        indices[ii * 6 + 5] = first + ii * 4 + 3;
+      }
+      return n * 6;
+
+    case QuadsFillFlatFirst:
+      for (GLuint ii=0; ii<static_cast<GLuint>(n); ii++)
+      {
+        indices[ii * 6 + 0] = first + ii * 4 + 1;
+        indices[ii * 6 + 1] = first + ii * 4 + 2;
+        indices[ii * 6 + 2] = first + ii * 4 + 0;
+        indices[ii * 6 + 3] = first + ii * 4 + 2;
+        indices[ii * 6 + 4] = first + ii * 4 + 3;
+        indices[ii * 6 + 5] = first + ii * 4 + 0;
+      }
+      return n * 6;
+
+    case QuadsLine:
+      for (GLuint ii=0; ii<static_cast<GLuint>(n); ii++)
+      {
+        indices[ii * 8 + 0] = first + ii * 4 + 1;
+        indices[ii * 8 + 1] = first + ii * 4 + 0;
+        indices[ii * 8 + 2] = first + ii * 4 + 0;
+        indices[ii * 8 + 3] = first + ii * 4 + 3;
+        indices[ii * 8 + 4] = first + ii * 4 + 1;
+        indices[ii * 8 + 5] = first + ii * 4 + 2;
+        indices[ii * 8 + 6] = first + ii * 4 + 2;
+        indices[ii * 8 + 7] = first + ii * 4 + 3;
+      }
+      return n * 8;
+
+    case QuadsLineFlatFirst:
+      for (GLuint ii=0; ii<static_cast<GLuint>(n); ii++)
+      {
+        indices[ii * 8 + 0] = first + ii * 4 + 0;
+        indices[ii * 8 + 1] = first + ii * 4 + 1;
+        indices[ii * 8 + 2] = first + ii * 4 + 0;
+        indices[ii * 8 + 3] = first + ii * 4 + 3;
+        indices[ii * 8 + 4] = first + ii * 4 + 1;
+        indices[ii * 8 + 5] = first + ii * 4 + 2;
+        indices[ii * 8 + 6] = first + ii * 4 + 3;
+        indices[ii * 8 + 7] = first + ii * 4 + 2;
+      }
+      return n * 8;
+
+    case QuadStripFill:
+      for (GLuint ii=0; ii<static_cast<GLuint>(n); ii++)
+      {
+#if 1
+        // split 1
+        indices[ii * 6 + 0] = first + ii * 2 + 1;
+        indices[ii * 6 + 1] = first + ii * 2 + 3;
+        indices[ii * 6 + 2] = first + ii * 2 + 0;
+        indices[ii * 6 + 3] = first + ii * 2 + 2;
+        indices[ii * 6 + 4] = first + ii * 2 + 0;
+        indices[ii * 6 + 5] = first + ii * 2 + 3;
+#else
+        // split 1
+        indices[ii * 6 + 0] = first + ii * 2 + 0;
+        indices[ii * 6 + 1] = first + ii * 2 + 1;
+        indices[ii * 6 + 2] = first + ii * 2 + 2;
+        indices[ii * 6 + 3] = first + ii * 2 + 3;
+        indices[ii * 6 + 4] = first + ii * 2 + 2;
+        indices[ii * 6 + 5] = first + ii * 2 + 1;
+
+        // split 3
+        indices[ii * 6 + 0] = first + ii * 2 + 1;
+        indices[ii * 6 + 1] = first + ii * 2 + 0;
+        indices[ii * 6 + 2] = first + ii * 2 + 3;
+        indices[ii * 6 + 3] = first + ii * 2 + 2;
+        indices[ii * 6 + 4] = first + ii * 2 + 3;
+        indices[ii * 6 + 5] = first + ii * 2 + 0;
+
+        // split 4
+        indices[ii * 6 + 0] = first + ii * 2 + 0;
+        indices[ii * 6 + 1] = first + ii * 2 + 2;
+        indices[ii * 6 + 2] = first + ii * 2 + 1;
+        indices[ii * 6 + 3] = first + ii * 2 + 3;
+        indices[ii * 6 + 4] = first + ii * 2 + 1;
+        indices[ii * 6 + 5] = first + ii * 2 + 2;
+#endif
+      }
+      return n * 6;
+
+    case QuadStripFillFlatLast:
+      for (GLuint ii=0; ii<static_cast<GLuint>(n); ii++)
+      {
+        indices[ii * 6 + 0] = first + ii * 2 + 0;
+        indices[ii * 6 + 1] = first + ii * 2 + 1;
+        indices[ii * 6 + 2] = first + ii * 2 + 3;
+        indices[ii * 6 + 3] = first + ii * 2 + 2;
+        indices[ii * 6 + 4] = first + ii * 2 + 0;
+        indices[ii * 6 + 5] = first + ii * 2 + 3;
+      }
+      return n * 6;
+
+    case QuadStripFillFlatFirst:
+      for (GLuint ii=0; ii<static_cast<GLuint>(n); ii++)
+      {
+        indices[ii * 6 + 0] = first + ii * 2 + 1;
+        indices[ii * 6 + 1] = first + ii * 2 + 3;
+        indices[ii * 6 + 2] = first + ii * 2 + 0;
+        indices[ii * 6 + 3] = first + ii * 2 + 3;
+        indices[ii * 6 + 4] = first + ii * 2 + 2;
+        indices[ii * 6 + 5] = first + ii * 2 + 0;
+      }
+      return n * 6;
+
+    case QuadStripLine:
+      indices[0] = first + 0;
+      indices[1] = first + 1;
+      for (GLuint ii=0; ii<static_cast<GLuint>(n); ii++)
+      {
+        indices[ii * 6 + 2] = first + ii * 2 + 0;
+        indices[ii * 6 + 3] = first + ii * 2 + 2;
+        indices[ii * 6 + 4] = first + ii * 2 + 2;
+        indices[ii * 6 + 5] = first + ii * 2 + 3;
+        indices[ii * 6 + 6] = first + ii * 2 + 1;
+        indices[ii * 6 + 7] = first + ii * 2 + 3;
+      }
+      return n * 6 + 2;
+
+    case QuadStripLineFlatFirst:
+      for (GLuint ii=0; ii<static_cast<GLuint>(n); ii++)
+      {
+        indices[ii * 6 + 0] = first + ii * 2 + 3;
+        indices[ii * 6 + 1] = first + ii * 2 + 1;
+        indices[ii * 6 + 2] = first + ii * 2 + 1;
+        indices[ii * 6 + 3] = first + ii * 2 + 0;
+        indices[ii * 6 + 4] = first + ii * 2 + 2;
+        indices[ii * 6 + 5] = first + ii * 2 + 0;
+      }
+      indices[n * 6 + 0] = first + n * 2 + 1;
+      indices[n * 6 + 1] = first + n * 2 + 0;
+      return n * 6 + 2;
+
+    default:
+      RegalAssert(0);
+      return 0;
+  }
+}
+
+void Quads::DrawIndexed(RegalContext *ctx, IndexPattern pattern, GLenum prim, GLint first, GLsizei n)
+{
+  RegalAssert(ctx);
+
+  if (n <= 0)
+    return;
+
+  if (baseVertex)
+  {
+    DrawCached(ctx, pattern, prim, first, n);
+    return;
+  }
+
+  // Without glDrawElementsBaseVertex the indices are generated for
+  // each draw, REGAL_QUADS_BUFFER_SIZE quads at a time.
+
+  DispatchTableGL &dt = ctx->dispatcher.emulation;
+
+  const GLuint stride = pattern >= QuadStripFill ? 2 : 4;
+  GLuint indices[REGAL_QUADS_BUFFER_SIZE * 8 + 2];
+
+  dt.call(&dt.glBindBuffer)( GL_ELEMENT_ARRAY_BUFFER, quadIndexBuffer);
+  for (GLsizei done = 0; done < n; done += REGAL_QUADS_BUFFER_SIZE)
+  {
+    const GLsizei m = std::min<GLsizei>(n - done, REGAL_QUADS_BUFFER_SIZE);
+    const GLsizei c = Indices(pattern, indices, first + done * stride, m);
+    dt.call(&dt.glBufferData)( GL_ELEMENT_ARRAY_BUFFER, c * sizeof( GLuint ), indices, GL_STATIC_DRAW );
+    Internal("Regal::Emu::Quads::DrawIndexed","glDrawElements(",Token::toString(prim),",",c,",GL_UNSIGNED_INT, 0)");
+    dt.call(&dt.glDrawElements)(prim, c, GL_UNSIGNED_INT, 0);
+  }
+  dt.call(&dt.glBindBuffer)( GL_ELEMENT_ARRAY_BUFFER, elementArrayBuffer );
+}
+
+// The cached indices start from zero, and each draw offsets them
+// by the first vertex.  Meshes of more than REGAL_QUADS_INDEX_CACHE_SIZE
+// quads are drawn in chunks from the same indices.
+
+void Quads::DrawCached(RegalContext *ctx, IndexPattern pattern, GLenum prim, GLint first, GLsizei n)
+{
+  RegalAssert(ctx);
+  RegalAssert(baseVertex);
+  RegalAssertArrayIndex(indexCache, pattern);
+
+  DispatchTableGL &dt = ctx->dispatcher.emulation;
+
+  // The closing edge of a flat shaded quad strip outline is drawn
+  // from the indices of the next quad, so one extra is needed.
+
+  const bool    closing = pattern == QuadStripLineFlatFirst;
+  const GLuint  stride  = pattern >= QuadStripFill ? 2 : 4;
+  const GLsizei perQuad = pattern == QuadsLine || pattern == QuadsLineFlatFirst ? 8 : 6;
+  const GLsizei extra   = pattern == QuadStripLine ? 2 : 0;
+  const GLsizei chunk   = std::min<GLsizei>(n, REGAL_QUADS_INDEX_CACHE_SIZE);
+  const GLsizei needed  = chunk + (closing ? 1 : 0);
+
+  IndexCache &cache = indexCache[pattern];
+  if (!cache.buffer)
+    dt.call(&dt.glGenBuffers)(1, &cache.buffer);
+
+  dt.call(&dt.glBindBuffer)( GL_ELEMENT_ARRAY_BUFFER, cache.buffer );
+
+  if (cache.quads < needed)
+  {
+    GLsizei quads = REGAL_QUADS_BUFFER_SIZE;
+    while (quads < needed)
+      quads *= 2;
+
+    Internal("Regal::Emu::Quads::DrawCached","indices for ",quads," quads, pattern ",int(pattern));
+
+    std::vector<GLuint> indices(quads * 8 + 2);
+    const GLsizei c = Indices(pattern, &indices[0], 0, quads);
+    dt.call(&dt.glBufferData)( GL_ELEMENT_ARRAY_BUFFER, c * sizeof( GLuint ), &indices[0], GL_STATIC_DRAW );
+    cache.quads = quads;
+  }
+
+  for (GLsizei done = 0; done < n; done += chunk)
+  {
+    const GLsizei m    = std::min<GLsizei>(n - done, chunk);
+    const GLint   base = first + done * stride;
+    if (closing)
+    {
+      dt.call(&dt.glDrawElementsBaseVertex)(prim, m * perQuad, GL_UNSIGNED_INT, 0, base);
+      dt.call(&dt.glDrawElementsBaseVertex)(prim, 2, GL_UNSIGNED_INT, reinterpret_cast<GLvoid *>((m * perQuad + 2) * sizeof(GLuint)), base);
+    }
+    else
+    {
+      const GLsizei c = m * perQuad + extra;
+      Internal("Regal::Emu::Quads::DrawCached","glDrawElementsBaseVertex(",Token::toString(prim),",",c,",GL_UNSIGNED_INT, 0, ",base,")");
+      dt.call(&dt.glDrawElementsBaseVertex)(prim, c, GL_UNSIGNED_INT, 0, base);
+    }
+  }
+
+  dt.call(&dt.glBindBuffer)( GL_ELEMENT_ARRAY_BUFFER, elementArrayBuffer );
+}
+
 void Quads::glBindBuffer( GLenum target, GLuint buffer ) {
   if( target == GL_ELEMENT_ARRAY_BUFFER ) {
     elementArrayBuffer = buffer;
@@ -52,14 +52,39 @@ REGAL_GLOBAL_END
 
 REGAL_NAMESPACE_BEGIN
 
+#define REGAL_QUADS_BUFFER_SIZE      1024
+#define REGAL_QUADS_INDEX_CACHE_SIZE (1<<20)
+
 namespace Emu {
 
 struct Quads
 {
+  // Triangle or line index patterns for quads and quad strips,
+  // depending on the shade model and provoking vertex convention.
+
+  enum IndexPattern
+  {
+    QuadsFill = 0,
+    QuadsFillFlatLast,
+    QuadsFillFlatFirst,
+    QuadsLine,
+    QuadsLineFlatFirst,
+    QuadStripFill,
+    QuadStripFillFlatLast,
+    QuadStripFillFlatFirst,
+    QuadStripLine,
+    QuadStripLineFlatFirst,
+    IndexPatternCount
+  };
+
   void Init(RegalContext &ctx);
   void Cleanup(RegalContext &ctx);
   bool glDrawArrays(RegalContext *ctx, GLenum mode, GLint first, GLsizei count);
 
+  static GLsizei Indices(IndexPattern pattern, GLuint *indices, GLuint first, GLsizei n);
+  void DrawIndexed(RegalContext *ctx, IndexPattern pattern, GLenum prim, GLint first, GLsizei n);
+  void DrawCached(RegalContext *ctx, IndexPattern pattern, GLenum prim, GLint first, GLsizei n);
+
   void glBindBuffer(GLenum target, GLuint buffer );
   void glFrontFace(GLenum mode);
   void glPolygonMode(GLenum face, GLenum mode);
@@ -77,6 +102,19 @@ struct Quads
   GLenum cullFace;
   GLuint elementArrayBuffer;
   GLuint quadIndexBuffer;
+
+  // With glDrawElementsBaseVertex the indices of each pattern
+  // are generated once, from zero, into a buffer large enough
+  // for a power of two number of quads.
+
+  struct IndexCache
+  {
+    GLuint  buffer;
+    GLsizei quads;
+  };
+
+  IndexCache indexCache[IndexPatternCount];
+  bool   baseVertex : 1;
   bool   gl_quads_follow_provoking_vertex_convention : 1;
   bool   cullingFaces : 1;
 };
@@ -0,0 +1,342 @@
+/*
+  Copyright (c) 2011-2013 NVIDIA Corporation
+  Copyright (c) 2011-2013 Cass Everitt
+  Copyright (c) 2012-2013 Scott Nations
+  Copyright (c) 2012-2013 Nigel Stewart
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+    Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+  IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+  OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+  OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+  Intended formatting conventions:
+  $ astyle --style=allman --indent=spaces=2 --indent-switches
+*/
+
+#include "pch.h" /* For MS precompiled header support */
+
+#include "RegalUtil.h"
+
+#if REGAL_REDUNDANT
+
+REGAL_GLOBAL_BEGIN
+
+#include <cstring>
+
+#include "RegalRedundant.h"
+
+REGAL_GLOBAL_END
+
+REGAL_NAMESPACE_BEGIN
+
+Redundant::Redundant()
+{
+  reset();
+}
+
+void
+Redundant::reset()
+{
+  ::memset(this,0,sizeof(Redundant));
+}
+
+// Only global capabilities are shadowed, per-unit texturing
+// and per-light enables always pass through.
+
+int
+Redundant::enableIndex(GLenum cap)
+{
+  switch (cap)
+  {
+    case GL_ALPHA_TEST:               return 0;
+    case GL_BLEND:                    return 1;
+    case GL_COLOR_LOGIC_OP:           return 2;
+    case GL_COLOR_MATERIAL:           return 3;
+    case GL_CULL_FACE:                return 4;
+    case GL_DEPTH_TEST:               return 5;
+    case GL_DITHER:                   return 6;
+    case GL_FOG:                      return 7;
+    case GL_FRAMEBUFFER_SRGB:         return 8;
+    case GL_LIGHTING:                 return 9;
+    case GL_LINE_SMOOTH:              return 10;
+    case GL_MULTISAMPLE:              return 11;
+    case GL_NORMALIZE:                return 12;
+    case GL_POINT_SMOOTH:             return 13;
+    case GL_POLYGON_OFFSET_FILL:      return 14;
+    case GL_POLYGON_SMOOTH:           return 15;
+    case GL_PRIMITIVE_RESTART:        return 16;
+    case GL_PROGRAM_POINT_SIZE:       return 17;
+    case GL_RASTERIZER_DISCARD:       return 18;
+    case GL_SAMPLE_ALPHA_TO_COVERAGE: return 19;
+    case GL_SCISSOR_TEST:             return 20;
+    case GL_STENCIL_TEST:             return 21;
+    default:                          return -1;
+  }
+}
+
+int
+Redundant::textureTargetIndex(GLenum target)
+{
+  switch (target)
+  {
+    case GL_TEXTURE_1D:                   return 0;
+    case GL_TEXTURE_2D:                   return 1;
+    case GL_TEXTURE_3D:                   return 2;
+    case GL_TEXTURE_CUBE_MAP:             return 3;
+    case GL_TEXTURE_RECTANGLE:            return 4;
+    case GL_TEXTURE_1D_ARRAY:             return 5;
+    case GL_TEXTURE_2D_ARRAY:             return 6;
+    case GL_TEXTURE_CUBE_MAP_ARRAY:       return 7;
+    case GL_TEXTURE_BUFFER:               return 8;
+    case GL_TEXTURE_2D_MULTISAMPLE:       return 9;
+    case GL_TEXTURE_2D_MULTISAMPLE_ARRAY: return 10;
+    default:                              return -1;
+  }
+}
+
+int
+Redundant::bufferTargetIndex(GLenum target)
+{
+  switch (target)
+  {
+    case GL_ARRAY_BUFFER:              return 0;
+    case GL_ELEMENT_ARRAY_BUFFER:      return 1;
+    case GL_PIXEL_PACK_BUFFER:         return 2;
+    case GL_PIXEL_UNPACK_BUFFER:       return 3;
+    case GL_UNIFORM_BUFFER:            return 4;
+    case GL_COPY_READ_BUFFER:          return 5;
+    case GL_COPY_WRITE_BUFFER:         return 6;
+    case GL_DRAW_INDIRECT_BUFFER:      return 7;
+    case GL_TEXTURE_BUFFER:            return 8;
+    case GL_TRANSFORM_FEEDBACK_BUFFER: return 9;
+    case GL_SHADER_STORAGE_BUFFER:     return 10;
+    case GL_ATOMIC_COUNTER_BUFFER:     return 11;
+    case GL_DISPATCH_INDIRECT_BUFFER:  return 12;
+    case GL_QUERY_BUFFER:              return 13;
+    default:                           return -1;
+  }
+}
+
+bool
+Redundant::enable(GLenum cap, GLboolean enabled)
+{
+  const int i = enableIndex(cap);
+  if (compiling || i<0)
+    return false;
+  return enables[i].update(enabled);
+}
+
+bool
+Redundant::activeTexture(GLenum texture)
+{
+  if (compiling)
+    return false;
+
+  // An out-of-range unit leaves the current one unknown
+
+  const GLuint unit = texture - GL_TEXTURE0;
+  if (unit>=REGAL_REDUNDANT_MAX_TEXTURE_UNITS)
+  {
+    activeUnit.valid = false;
+    return false;
+  }
+  return activeUnit.update(unit);
+}
+
+bool
+Redundant::bindTexture(GLenum target, GLuint texture)
+{
+  const int i = textureTargetIndex(target);
+  if (compiling || i<0 || !activeUnit.valid)
+    return false;
+  return textures[activeUnit.value[0]][i].update(texture);
+}
+
+bool
+Redundant::useProgram(GLuint name)
+{
+  return !compiling && program.update(name);
+}
+
+bool
+Redundant::bindBuffer(GLenum target, GLuint buffer)
+{
+  const int i = bufferTargetIndex(target);
+  if (compiling || i<0)
+    return false;
+
+  // The element array binding belongs to the vertex array object,
+  // so it is only known while the vertex array binding is.
+
+  if (target==GL_ELEMENT_ARRAY_BUFFER && !vertexArray.valid)
+  {
+    buffers[i].valid = false;
+    return false;
+  }
+  return buffers[i].update(buffer);
+}
+
+bool
+Redundant::bindFramebuffer(GLenum target, GLuint framebuffer)
+{
+  if (compiling)
+    return false;
+
+  switch (target)
+  {
+    case GL_DRAW_FRAMEBUFFER: return drawFramebuffer.update(framebuffer);
+    case GL_READ_FRAMEBUFFER: return readFramebuffer.update(framebuffer);
+    case GL_FRAMEBUFFER:
+    {
+      const bool draw = drawFramebuffer.update(framebuffer);
+      const bool read = readFramebuffer.update(framebuffer);
+      return draw && read;
+    }
+    default:
+      return false;
+  }
+}
+
+bool
+Redundant::bindVertexArray(GLuint array)
+{
+  if (compiling)
+    return false;
+  if (vertexArray.update(array))
+    return true;
+  buffers[bufferTargetIndex(GL_ELEMENT_ARRAY_BUFFER)].valid = false;
+  return false;
+}
+
+bool
+Redundant::depthFunc(GLenum func)
+{
+  return !compiling && depthFuncs.update(func);
+}
+
+bool
+Redundant::depthMask(GLboolean flag)
+{
+  return !compiling && depthMasks.update(flag);
+}
+
+bool
+Redundant::blendFunc(GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
+{
+  const GLenum v[4] = { srcRGB, dstRGB, srcAlpha, dstAlpha };
+  return !compiling && blendFuncs.update(v);
+}
+
+bool
+Redundant::blendEquation(GLenum modeRGB, GLenum modeAlpha)
+{
+  const GLenum v[2] = { modeRGB, modeAlpha };
+  return !compiling && blendEquations.update(v);
+}
+
+bool
+Redundant::cullFace(GLenum mode)
+{
+  return !compiling && cullFaces.update(mode);
+}
+
+bool
+Redundant::frontFace(GLenum mode)
+{
+  return !compiling && frontFaces.update(mode);
+}
+
+bool
+Redundant::colorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)
+{
+  const GLboolean v[4] = { red, green, blue, alpha };
+  return !compiling && colorMasks.update(v);
+}
+
+bool
+Redundant::viewport(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+  const GLint v[4] = { x, y, width, height };
+  return !compiling && viewports.update(v);
+}
+
+bool
+Redundant::scissor(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+  const GLint v[4] = { x, y, width, height };
+  return !compiling && scissors.update(v);
+}
+
+bool
+Redundant::clearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+  const GLfloat v[4] = { red, green, blue, alpha };
+  return !compiling && clearColors.update(v);
+}
+
+void
+Redundant::invalidateEnable(GLenum cap)
+{
+  const int i = enableIndex(cap);
+  if (i>=0)
+    enables[i].valid = false;
+}
+
+void
+Redundant::invalidateTextures()
+{
+  for (size_t i=0; i<REGAL_REDUNDANT_MAX_TEXTURE_UNITS; ++i)
+    for (size_t j=0; j<NUM_TEXTURE_TARGETS; ++j)
+      textures[i][j].valid = false;
+}
+
+void
+Redundant::invalidateBuffer(GLenum target)
+{
+  const int i = bufferTargetIndex(target);
+  if (i>=0)
+    buffers[i].valid = false;
+}
+
+void
+Redundant::invalidateBuffers()
+{
+  for (size_t i=0; i<NUM_BUFFER_TARGETS; ++i)
+    buffers[i].valid = false;
+}
+
+void
+Redundant::invalidateVertexArray()
+{
+  vertexArray.valid = false;
+  invalidateBuffer(GL_ELEMENT_ARRAY_BUFFER);
+}
+
+void
+Redundant::invalidateFramebuffers()
+{
+  drawFramebuffer.valid = readFramebuffer.valid = false;
+}
+
+REGAL_NAMESPACE_END
+
+#endif // REGAL_REDUNDANT
@@ -0,0 +1,175 @@
+/*
+  Copyright (c) 2011-2013 NVIDIA Corporation
+  Copyright (c) 2011-2013 Cass Everitt
+  Copyright (c) 2012-2013 Scott Nations
+  Copyright (c) 2012-2013 Nigel Stewart
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+    Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+  IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+  OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+  OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+
+ Redundant state change filtering
+
+ Shadows the state most recently sent downstream of the redundant
+ dispatch layer, so that calls which would not change it can be
+ dropped before reaching the driver.  Everything starts out unknown,
+ so the first call for each piece of state always passes through.
+
+ */
+
+#ifndef __REGAL_REDUNDANT_H__
+#define __REGAL_REDUNDANT_H__
+
+#include "RegalUtil.h"
+
+#if REGAL_REDUNDANT
+
+REGAL_GLOBAL_BEGIN
+
+#include <algorithm>
+
+#include <GL/Regal.h>
+
+REGAL_GLOBAL_END
+
+REGAL_NAMESPACE_BEGIN
+
+// No. of texture units with shadowed bindings.
+// Bindings for higher units always pass through.
+
+#ifndef REGAL_REDUNDANT_MAX_TEXTURE_UNITS
+#define REGAL_REDUNDANT_MAX_TEXTURE_UNITS 32
+#endif
+
+struct Redundant
+{
+  enum
+  {
+    NUM_ENABLES         = 22,
+    NUM_TEXTURE_TARGETS = 11,
+    NUM_BUFFER_TARGETS  = 14
+  };
+
+  // A piece of driver state, and whether it is known
+
+  template <typename T, size_t N = 1>
+  struct Shadow
+  {
+    bool valid;
+    T    value[N];
+
+    // True if v is already current, otherwise v becomes current
+
+    inline bool update(const T (&v)[N])
+    {
+      if (valid && std::equal(value, value+N, v))
+        return true;
+      std::copy(v, v+N, value);
+      valid = true;
+      return false;
+    }
+
+    inline bool update(const T v)
+    {
+      RegalAssert(N==1);
+      const T tmp[N] = { v };
+      return update(tmp);
+    }
+  };
+
+  Redundant();
+
+  void reset();
+
+  // Display lists are compiled rather than executed,
+  // so nothing is filtered between glNewList and glEndList
+
+  inline void newList() { reset(); compiling = true;  }
+  inline void endList() { reset(); compiling = false; }
+
+  // Each returns true when the call can be skipped
+
+  bool enable         (GLenum cap, GLboolean enabled);
+  bool activeTexture  (GLenum texture);
+  bool bindTexture    (GLenum target, GLuint texture);
+  bool useProgram     (GLuint program);
+  bool bindBuffer     (GLenum target, GLuint buffer);
+  bool bindFramebuffer(GLenum target, GLuint framebuffer);
+  bool bindVertexArray(GLuint array);
+  bool depthFunc      (GLenum func);
+  bool depthMask      (GLboolean flag);
+  bool blendFunc      (GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha);
+  bool blendEquation  (GLenum modeRGB, GLenum modeAlpha);
+  bool cullFace       (GLenum mode);
+  bool frontFace      (GLenum mode);
+  bool colorMask      (GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha);
+  bool viewport       (GLint x, GLint y, GLsizei width, GLsizei height);
+  bool scissor        (GLint x, GLint y, GLsizei width, GLsizei height);
+  bool clearColor     (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);
+
+  // Forget state changed in ways the shadow does not follow
+
+  void invalidateEnable     (GLenum cap);
+  void invalidateTextures   ();
+  void invalidateBuffer     (GLenum target);
+  void invalidateBuffers    ();
+  void invalidateVertexArray();
+  void invalidateFramebuffers();
+  inline void invalidateProgram  () { program.valid   = false; }
+  inline void invalidateBlend    () { blendFuncs.valid = blendEquations.valid = false; }
+  inline void invalidateColorMask() { colorMasks.valid = false; }
+  inline void invalidateViewport () { viewports.valid  = false; }
+  inline void invalidateScissor  () { scissors.valid   = false; }
+
+  static int enableIndex       (GLenum cap);
+  static int textureTargetIndex(GLenum target);
+  static int bufferTargetIndex (GLenum target);
+
+  bool compiling;
+
+  Shadow<GLboolean>    enables[NUM_ENABLES];
+  Shadow<GLuint>       activeUnit;
+  Shadow<GLuint>       textures[REGAL_REDUNDANT_MAX_TEXTURE_UNITS][NUM_TEXTURE_TARGETS];
+  Shadow<GLuint>       program;
+  Shadow<GLuint>       buffers[NUM_BUFFER_TARGETS];
+  Shadow<GLuint>       vertexArray;
+  Shadow<GLuint>       drawFramebuffer;
+  Shadow<GLuint>       readFramebuffer;
+  Shadow<GLenum>       depthFuncs;
+  Shadow<GLboolean>    depthMasks;
+  Shadow<GLenum,4>     blendFuncs;
+  Shadow<GLenum,2>     blendEquations;
+  Shadow<GLenum>       cullFaces;
+  Shadow<GLenum>       frontFaces;
+  Shadow<GLboolean,4>  colorMasks;
+  Shadow<GLint,4>      viewports;
+  Shadow<GLint,4>      scissors;
+  Shadow<GLfloat,4>    clearColors;
+};
+
+REGAL_NAMESPACE_END
+
+#endif // REGAL_REDUNDANT
+
+#endif // __REGAL_REDUNDANT_H__
@@ -0,0 +1,178 @@
+/*
+  Copyright (c) 2011-2013 NVIDIA Corporation
+  Copyright (c) 2011-2012 Cass Everitt
+  Copyright (c) 2012 Scott Nations
+  Copyright (c) 2012 Mathias Schott
+  Copyright (c) 2012 Nigel Stewart
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+    Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+  IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+  OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+  OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+  Intended formatting conventions:
+  $ astyle --style=allman --indent=spaces=2 --indent-switches
+*/
+
+#include "pch.h" /* For MS precompiled header support */
+
+#include "RegalUtil.h"
+
+#if REGAL_EMULATION
+
+REGAL_GLOBAL_BEGIN
+
+#include "RegalLog.h"
+#include "RegalRingBuffer.h"
+
+REGAL_GLOBAL_END
+
+// Alias of GL_COPY_WRITE_BUFFER for glGet, as of OpenGL 4.2
+
+#ifndef GL_COPY_WRITE_BUFFER_BINDING
+#define GL_COPY_WRITE_BUFFER_BINDING GL_COPY_WRITE_BUFFER
+#endif
+
+REGAL_NAMESPACE_BEGIN
+
+namespace Emu {
+
+RingBuffer::RingBuffer()
+: buffer(0)
+, size(0)
+, segmentSize(0)
+, data(NULL)
+, head(0)
+, segment(0)
+{
+}
+
+bool RingBuffer::Init( DispatchTableGL &tbl, GLsizeiptr bufferSize, GLuint segments )
+{
+  Internal("Regal::Emu::RingBuffer::Init","()");
+
+  RegalAssert(!buffer);
+  RegalAssert(segments>1);
+
+  const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+  // Create the storage via the copy write binding, which
+  // is otherwise unused by emulation.
+
+  GLint prev = 0;
+  tbl.call(&tbl.glGetIntegerv)( GL_COPY_WRITE_BUFFER_BINDING, &prev );
+  tbl.call(&tbl.glGenBuffers)( 1, &buffer );
+  tbl.call(&tbl.glBindBuffer)( GL_COPY_WRITE_BUFFER, buffer );
+  tbl.call(&tbl.glBufferStorage)( GL_COPY_WRITE_BUFFER, bufferSize, NULL, flags );
+  data = static_cast<GLubyte *>(tbl.call(&tbl.glMapBufferRange)( GL_COPY_WRITE_BUFFER, 0, bufferSize, flags ));
+  tbl.call(&tbl.glBindBuffer)( GL_COPY_WRITE_BUFFER, prev );
+
+  if (!data)
+  {
+    Warning("Regal::Emu::RingBuffer::Init failed to map ",bufferSize," bytes.");
+    tbl.call(&tbl.glDeleteBuffers)( 1, &buffer );
+    buffer = 0;
+    return false;
+  }
+
+  size        = bufferSize;
+  segmentSize = bufferSize/segments;
+  head        = 0;
+  segment     = 0;
+  fences.assign(segments,static_cast<GLsync>(NULL));
+  return true;
+}
+
+void RingBuffer::Cleanup( DispatchTableGL &tbl )
+{
+  Internal("Regal::Emu::RingBuffer::Cleanup","()");
+
+  for (size_t i=0; i<fences.size(); ++i)
+    if (fences[i])
+      tbl.call(&tbl.glDeleteSync)( fences[i] );
+  fences.clear();
+
+  if (buffer)
+  {
+    // Deleting the buffer also unmaps it.
+    tbl.call(&tbl.glDeleteBuffers)( 1, &buffer );
+    buffer = 0;
+  }
+
+  size = segmentSize = 0;
+  data = NULL;
+  head = 0;
+  segment = 0;
+}
+
+GLubyte *RingBuffer::Allocate( DispatchTableGL &tbl, GLsizeiptr bytes, GLsizeiptr alignment, GLintptr &offset )
+{
+  RegalAssert(data);
+
+  if (alignment<1)
+    alignment = 1;
+
+  if (bytes+alignment>segmentSize)
+    return NULL;
+
+  // Allocations do not straddle segments, so that each one
+  // is covered by exactly one fence.  The alignment need not
+  // be a power of two.
+
+  GLintptr start = ((head+alignment-1)/alignment)*alignment;
+  if (start/segmentSize != (start+bytes-1)/segmentSize)
+  {
+    start = (start/segmentSize + 1)*segmentSize;
+    start = ((start+alignment-1)/alignment)*alignment;
+  }
+  if (start+bytes>GLintptr(segmentSize*fences.size()))
+    start = 0;
+
+  const GLuint next = GLuint(start/segmentSize);
+  if (next!=segment)
+  {
+    // Fence the segment we are leaving, then wait until the
+    // GPU has finished with the segment we are entering.
+
+    RegalAssert(!fences[segment]);
+    fences[segment] = tbl.call(&tbl.glFenceSync)( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 );
+
+    if (fences[next])
+    {
+      while (tbl.call(&tbl.glClientWaitSync)( fences[next], GL_SYNC_FLUSH_COMMANDS_BIT, 1000000 )==GL_TIMEOUT_EXPIRED)
+        ;
+      tbl.call(&tbl.glDeleteSync)( fences[next] );
+      fences[next] = NULL;
+    }
+    segment = next;
+  }
+
+  offset = start;
+  head   = start+bytes;
+  return data+start;
+}
+
+}
+
+REGAL_NAMESPACE_END
+
+#endif // REGAL_EMULATION
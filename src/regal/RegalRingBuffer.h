@@ -0,0 +1,96 @@
+/*
+  Copyright (c) 2011-2013 NVIDIA Corporation
+  Copyright (c) 2011-2012 Cass Everitt
+  Copyright (c) 2012 Scott Nations
+  Copyright (c) 2012 Mathias Schott
+  Copyright (c) 2012 Nigel Stewart
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+    Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+  IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+  OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+  OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+
+ Regal persistently mapped ring buffer
+
+ A buffer object is allocated with ARB_buffer_storage and
+ kept mapped for its lifetime.  Data is written sequentially,
+ wrapping to the start when the end is reached.  The buffer is
+ divided into segments, each guarded by an ARB_sync fence so
+ that a segment is not rewritten while the GPU may still be
+ reading from it.
+
+ */
+
+#ifndef __REGAL_RING_BUFFER_H__
+#define __REGAL_RING_BUFFER_H__
+
+#include "RegalUtil.h"
+
+#if REGAL_EMULATION
+
+REGAL_GLOBAL_BEGIN
+
+#include <vector>
+
+#include <GL/Regal.h>
+
+#include "RegalDispatch.h"
+
+REGAL_GLOBAL_END
+
+REGAL_NAMESPACE_BEGIN
+
+namespace Emu {
+
+struct RingBuffer
+{
+  RingBuffer();
+
+  // Create and map a buffer of size bytes, false if the
+  // buffer could not be mapped.
+
+  bool Init( DispatchTableGL &tbl, GLsizeiptr size, GLuint segments );
+  void Cleanup( DispatchTableGL &tbl );
+
+  // Reserve bytes at the requested alignment, returning the
+  // mapped pointer and the offset within the buffer, or NULL
+  // if the request is larger than a segment.
+
+  GLubyte *Allocate( DispatchTableGL &tbl, GLsizeiptr bytes, GLsizeiptr alignment, GLintptr &offset );
+
+  GLuint              buffer;
+  GLsizeiptr          size;
+  GLsizeiptr          segmentSize;
+  GLubyte            *data;
+  GLintptr            head;
+  GLuint              segment;
+  std::vector<GLsync> fences;
+};
+
+}
+
+REGAL_NAMESPACE_END
+
+#endif // REGAL_EMULATION
+
+#endif // ! __REGAL_RING_BUFFER_H__
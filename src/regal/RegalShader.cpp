@@ -48,8 +48,16 @@ REGAL_GLOBAL_BEGIN
 #include "linker.h"
 #endif // REGAL_GLSL_OPTIMIZER
 
+#include "RegalConfig.h"
+#include "RegalMutex.h"
+
+#include <lookup3.h>
+
+#include <boost/print/print_string.hpp>
+
 #include <map>
 using std::map;
+using ::boost::print::print_string;
 
 REGAL_GLOBAL_END
 
@@ -61,6 +69,158 @@ _mesa_new_shader(struct gl_context *ctx, GLuint name, GLenum type);
 
 namespace Shader {
 
+#if REGAL_GLSL_OPTIMIZER
+
+  // Optimizer output for each variant of a shader, process-wide.
+  // The key hashes the source along with everything else given
+  // to the optimizer, failures are kept too.
+
+  struct OptimizeKey
+  {
+    OptimizeKey(bool is_es, GLenum type, const string &input, Emu::Iff::CompareFunc comp)
+    : size(input.size())
+    {
+      hash[0] = type;
+      hash[1] = (is_es ? 0x100 : 0) | comp;
+      Lookup3::hashlittle2(input.c_str(), input.size(), &hash[0], &hash[1]);
+    }
+
+    inline bool operator<(const OptimizeKey &other) const
+    {
+      if (hash[0]!=other.hash[0]) return hash[0]<other.hash[0];
+      if (hash[1]!=other.hash[1]) return hash[1]<other.hash[1];
+      return size<other.size;
+    }
+
+    uint32_t hash[2];
+    size_t   size;
+  };
+
+  struct OptimizeResult
+  {
+    OptimizeResult() : ok(false) {}
+
+    bool   ok;
+    string output;
+  };
+
+  static Thread::Mutex                     optimizeMutex;  // Mesa front-end state is process-wide
+  static map<OptimizeKey,OptimizeResult>   optimizeCache;
+  static regal_glsl_ctx                   *optimizeContext[2] = { NULL, NULL };
+  static size_t                            optimizeHits = 0;
+  static size_t                            optimizeMisses = 0;
+
+  // Each context is set up once and kept, releasing it would
+  // have Mesa parse its built-in functions again for the next.
+
+  static regal_glsl_ctx *
+  optimizerContext(bool is_es)
+  {
+    regal_glsl_ctx *&ctx = optimizeContext[is_es ? 1 : 0];
+    if (!ctx)
+      ctx = regal_glsl_initialize(is_es ? API_OPENGLES2 : API_OPENGL_COMPAT);
+    return ctx;
+  }
+
+  // Successful output is also kept under Config::cacheDirectory,
+  // for REGAL_CACHE_GLSL.  Each file starts with a line giving the
+  // format version and the size of the output that follows, a file
+  // from another version or cut short is ignored.  Bump the version
+  // whenever the optimizer or its setup changes its output.
+
+  static const uint32_t optimizedVersion = 1;
+
+  static string
+  optimizedFilename(const OptimizeKey &key)
+  {
+    return makePath(Config::cacheDirectory,print_string("glsl_",boost::print::hex(key.hash[0]),boost::print::hex(key.hash[1]),"_v",optimizedVersion,".txt"));
+  }
+
+  static string
+  optimizedHeader(const string &output)
+  {
+    return print_string("// Regal GLSL cache ",optimizedVersion," ",output.size(),"\n");
+  }
+
+  static bool
+  optimizedRead(const OptimizeKey &key, string &output)
+  {
+    if (!REGAL_CACHE || !REGAL_CACHE_GLSL || !Config::cache || !Config::cacheGlsl)
+      return false;
+
+    const string filename = optimizedFilename(key);
+    FILE *f = fopen(filename.c_str(),"rb");
+    if (!f)
+      return false;
+
+    const string contents = fileRead(f);
+    fclose(f);
+
+    const size_t eol = contents.find('\n');
+    if (eol==string::npos || contents.compare(0,eol+1,optimizedHeader(contents.substr(eol+1)))!=0)
+    {
+      Warning("Cached GLSL ",filename," is stale or incomplete, ignored.");
+      return false;
+    }
+
+    output = contents.substr(eol+1);
+    Info("Cached GLSL ",boost::print::hex(key.hash[0]),boost::print::hex(key.hash[1])," read: ",filename);
+    return true;
+  }
+
+  static void
+  optimizedWrite(const OptimizeKey &key, const string &output)
+  {
+    if (!REGAL_CACHE || !REGAL_CACHE_GLSL || !Config::cache || !Config::cacheGlsl)
+      return;
+
+    // Written alongside, then renamed into place so that
+    // a partial file is never seen by a reader
+
+    const string filename = optimizedFilename(key);
+    const string tmp = filename + ".tmp";
+    FILE *f = fopen(tmp.c_str(),"wb");
+    if (!f)
+    {
+      Warning("Could not write GLSL to file ",filename,", permissions problem?");
+      return;
+    }
+
+    const string header = optimizedHeader(output);
+    bool ok = fwrite(header.c_str(),header.size(),1,f)==1 &&
+              (output.empty() || fwrite(output.c_str(),output.size(),1,f)==1);
+    ok = fclose(f)==0 && ok;
+    if (ok)
+    {
+      remove(filename.c_str());
+      ok = rename(tmp.c_str(),filename.c_str())==0;
+    }
+    if (!ok)
+    {
+      remove(tmp.c_str());
+      Warning("Could not write GLSL to file ",filename,".");
+      return;
+    }
+
+    Info("Cached GLSL ",boost::print::hex(key.hash[0]),boost::print::hex(key.hash[1])," written: ",filename);
+  }
+
+  void OptimizeGLSLCounts (size_t &hits, size_t &misses)
+  {
+    Thread::ScopedLock lock(&optimizeMutex);
+    hits   = optimizeHits;
+    misses = optimizeMisses;
+  }
+
+#else
+
+  void OptimizeGLSLCounts (size_t &hits, size_t &misses)
+  {
+    hits = misses = 0;
+  }
+
+#endif // REGAL_GLSL_OPTIMIZER
+
   // external interface for using the GLSL optimizer
   bool OptimizeGLSL (bool is_es, GLenum type, string input, string& output, Emu::Iff::CompareFunc comp )
 
@@ -74,10 +234,32 @@ namespace Shader {
 #else
 
   {
+    const OptimizeKey key(is_es, type, input, comp);
+
+    Thread::ScopedLock lock(&optimizeMutex);
+
+    map<OptimizeKey,OptimizeResult>::const_iterator i = optimizeCache.find(key);
+    if (i!=optimizeCache.end())
+    {
+      ++optimizeHits;
+      if (i->second.ok)
+        output = i->second.output;
+      return i->second.ok;
+    }
+
+    ++optimizeMisses;
+    OptimizeResult &result = optimizeCache[key];
+
+    if (optimizedRead(key, result.output))
+    {
+      result.ok = true;
+      output = result.output;
+      return true;
+    }
+
     bool res = true;
 
-    // this needs to be a global/plublic class member somewhere
-    regal_glsl_ctx* ctx = regal_glsl_initialize(is_es ? API_OPENGLES2 : API_OPENGL_COMPAT);
+    regal_glsl_ctx* ctx = optimizerContext(is_es);
 
     regal_glsl_shader_type shader_type = (type == GL_VERTEX_SHADER) ? kRegalGlslShaderVertex : kRegalGlslShaderFragment;
     regal_glsl_shader* shader = regal_glsl_parse (ctx, shader_type, input.c_str());
@@ -100,7 +282,14 @@ namespace Shader {
 
     regal_glsl_shader_delete (shader);
 
-    regal_glsl_cleanup (ctx);
+    regal_glsl_reset (ctx);
+
+    if (res)
+    {
+      result.ok     = true;
+      result.output = output;
+      optimizedWrite(key, output);
+    }
 
     return res;
   }
@@ -153,10 +342,6 @@ namespace Shader {
   struct regal_glsl_ctx {
     regal_glsl_ctx (gl_api api) {
       mem_ctx = ralloc_context (NULL);
-#if ! REGAL_NO_ASSERT
-      RegalContext *_context = REGAL_GET_CONTEXT();
-      RegalAssert(_context);
-#endif
       initialize_mesa_context (&mesa_ctx, api);
     }
     ~regal_glsl_ctx() {
@@ -171,6 +356,15 @@ namespace Shader {
     return new regal_glsl_ctx(api);
   }
 
+  // Free what was allocated for previous shaders, keeping
+  // the context and Mesa's built-ins for the next
+
+  void regal_glsl_reset (regal_glsl_ctx* ctx)
+  {
+    ralloc_free (ctx->mem_ctx);
+    ctx->mem_ctx = ralloc_context (NULL);
+  }
+
   void regal_glsl_cleanup (regal_glsl_ctx* ctx)
   {
     delete ctx;
@@ -381,6 +575,10 @@ namespace Shader {
       if ( fragData )
         a = new(ctx) ir_swizzle( new(ctx) ir_dereference_array(fragData, new(ctx) ir_constant( fragDataIndex )), 3, 0, 0, 0, 1 );
 
+      // nothing written to test
+      if ( a == NULL )
+        return visit_continue;
+
       ir_rvalue * ref = new(ctx) ir_swizzle( new(ctx) ir_dereference_variable( alphaRef ), 0, 0, 0, 0, 1 );
       switch( func ) {
         case Emu::Iff::CF_Less:     test = new(ctx) ir_expression( ir_binop_less, glsl_type::bool_type, a, ref ); break;
@@ -414,6 +612,9 @@ namespace Shader {
     if( shader == NULL || shader->shader == NULL || shader->shader->Type != GL_FRAGMENT_SHADER ) {
       return;
     }
+    if( shader->state == NULL || shader->state->error || shader->shader->ir == NULL ) {
+      return;
+    }
     add_alpha_test v(func);
 
     visit_list_elements(&v, shader->shader->ir );
@@ -60,8 +60,14 @@ namespace Shader {
     kRegalGlslShaderFragment,
   };
 
+  // Output is cached process-wide, so each variant of a shader
+  // is only optimized once.  Hits and misses are counted.
+
   bool OptimizeGLSL (bool is_es, GLenum type, string input, string& output, Emu::Iff::CompareFunc comp );
+  void OptimizeGLSLCounts (size_t &hits, size_t &misses);
+
   regal_glsl_ctx* regal_glsl_initialize (gl_api api);
+  void regal_glsl_reset (regal_glsl_ctx* ctx);
   void regal_glsl_cleanup (regal_glsl_ctx* ctx);
 
   regal_glsl_shader* regal_glsl_parse (regal_glsl_ctx* ctx, regal_glsl_shader_type type, const char* shaderSource);
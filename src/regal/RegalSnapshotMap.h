@@ -0,0 +1,169 @@
+/*
+  Copyright (c) 2011-2013 NVIDIA Corporation
+  Copyright (c) 2011-2013 Cass Everitt
+  Copyright (c) 2012-2013 Scott Nations
+  Copyright (c) 2012-2013 Nigel Stewart
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+    Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+  IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+  OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+  OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+
+ Regal read-mostly map
+
+ Lookups load the current snapshot and search it without locking.
+ Updates copy the snapshot, modify the copy and publish it, so a
+ reader always sees a complete map.  Replaced snapshots are retired
+ rather than deleted, since a reader may still be searching one.
+ Lookups in flight are counted, and an update that finds none
+ frees the retired snapshots.  Updates are expected to be rare and
+ must be serialized by the caller.
+
+ */
+
+#ifndef __REGAL_SNAPSHOT_MAP_H__
+#define __REGAL_SNAPSHOT_MAP_H__
+
+#include "RegalUtil.h"
+
+REGAL_GLOBAL_BEGIN
+
+#include <map>
+#include <vector>
+
+#include "RegalThread.h"
+
+REGAL_GLOBAL_END
+
+REGAL_NAMESPACE_BEGIN
+
+namespace Thread
+{
+  template<typename K, typename V>
+  struct SnapshotMap
+  {
+  public:
+    typedef std::map<K,V> Map;
+
+    SnapshotMap()
+    : _map(new Map()),
+      _readers(0)
+    {
+    }
+
+    ~SnapshotMap()
+    {
+      delete _map;
+      for (std::size_t i=0; i<_retired.size(); ++i)
+        delete _retired[i];
+    }
+
+    // A lookup in flight, from any thread.  The snapshot
+    // it loaded is not freed until it is done.
+
+    class Reader
+    {
+    public:
+      explicit Reader(const SnapshotMap &map)
+      : _readers(map._readers)
+      {
+        atomicAdd(_readers,1);
+        _snapshot = loadSequential(map._map);
+      }
+
+      ~Reader()
+      {
+        atomicAdd(_readers,-1);
+      }
+
+      inline const Map &operator*()  const { return *_snapshot; }
+      inline const Map *operator->() const { return _snapshot;  }
+
+    private:
+      volatile long &_readers;
+      const Map     *_snapshot;
+
+      Reader(const Reader &other);
+      Reader &operator=(const Reader &other);
+    };
+
+    inline bool find(const K &key, V &value) const
+    {
+      const Reader m(*this);
+      typename Map::const_iterator i = m->find(key);
+      if (i==m->end())
+        return false;
+      value = i->second;
+      return true;
+    }
+
+    // Writers, serialized by the caller
+
+    inline const Map &snapshot() const { return *_map; }
+
+    void insert(const K &key, const V &value)
+    {
+      Map *m = new Map(*_map);
+      (*m)[key] = value;
+      publish(m);
+    }
+
+    bool erase(const K &key)
+    {
+      if (_map->find(key)==_map->end())
+        return false;
+      Map *m = new Map(*_map);
+      m->erase(key);
+      publish(m);
+      return true;
+    }
+
+    inline std::size_t retired() const { return _retired.size(); }
+
+  private:
+    Map * volatile         _map;
+    mutable volatile long  _readers;
+    std::vector<Map *>     _retired;
+
+    // A lookup that starts after the exchange loads the new
+    // snapshot, so with none in flight nothing retired is in use.
+
+    inline void publish(Map *m)
+    {
+      _retired.push_back(exchangeSequential(_map,m));
+      if (!atomicAdd(_readers,0))
+      {
+        for (std::size_t i=0; i<_retired.size(); ++i)
+          delete _retired[i];
+        _retired.clear();
+      }
+    }
+
+    SnapshotMap(const SnapshotMap &other);
+    SnapshotMap &operator=(const SnapshotMap &other);
+  };
+}
+
+REGAL_NAMESPACE_END
+
+#endif // __REGAL_SNAPSHOT_MAP_H__
@@ -115,7 +115,11 @@ So::BindSampler(GLuint unit, GLuint so)
     SamplingState *pso = so != 0 ? samplerObjects[so] : NULL;
 
     RegalAssertArrayIndex( textureUnits, unit );
-    textureUnits[unit].boundSamplerObject = pso;
+    if (textureUnits[unit].boundSamplerObject != pso)
+    {
+        textureUnits[unit].boundSamplerObject = pso;
+        MarkDirty(unit, REGAL_SO_ALL_TARGETS);
+    }
 }
 
 void
@@ -229,6 +233,7 @@ So::BindTexture(RegalContext &ctx, GLuint unit, GLenum target, GLuint to)
 
     RegalAssertArrayIndex( textureUnits, unit );
     textureUnits[unit].boundTextureObjects[tti] = ts;
+    MarkDirty(unit, 1u << tti);
 
     return true;
 }
@@ -254,53 +259,61 @@ So::PreDraw( RegalContext &ctx )
 
   GLuint originallyActiveUnit = activeTextureUnit;
 
-  // ignoring sampler objects on the last unit... FIXME - cass
-  const int n = static_cast<GLuint>(array_size( textureUnits ));
-  for (int unit=n-1; unit >= 0; unit--)
-  {
-    RegalAssertArrayIndex( textureUnits, unit );
-    TextureUnit &tu = textureUnits[unit];
-    SamplingState *pSS = tu.boundSamplerObject;
+  // Only the units and targets marked dirty by BindSampler,
+  // BindTexture, SamplerParameter or TexParameter are visited,
+  // from the last unit down to unit zero.
 
-    size_t num = array_size( tu.boundTextureObjects );
-    for (size_t tt=0; tt < num; tt++)
+  for (size_t w = array_size( dirtyUnits ); w-- > 0; )
+  {
+    for (GLuint64 units = dirtyUnits[w]; units; )
     {
-      RegalAssertArrayIndex( tu.boundTextureObjects, tt );
-      TextureState* ts = tu.boundTextureObjects[tt];
-      GLenum target = TT_Index2Enum( tt );
-      if( target != GL_TEXTURE_2D )
-        continue;
-
-      //Internal( "RegalSo unit", unit, " texture ", ts ? ts->name : 0, " for sampler ", pSS ? pSS->name : 0 );
-      if( ts == NULL ) {
-        // no texture bound, don't bother trying to make samplers work with the default texture object
-        continue;
-      }
+      const GLuint bit = highestBit( units );
+      units &= ~(GLuint64(1) << bit);
+      const GLuint unit = static_cast<GLuint>(w * 64 + bit);
+      RegalAssertArrayIndex( textureUnits, unit );
+      TextureUnit &tu = textureUnits[unit];
+      SamplingState *pSS = tu.boundSamplerObject;
+
+      for (GLuint targets = tu.dirtyTargets & REGAL_SO_ALL_TARGETS; targets; targets &= targets - 1)
+      {
+        const GLuint tt = lowestBit( targets );
+        RegalAssertArrayIndex( tu.boundTextureObjects, tt );
+        TextureState* ts = tu.boundTextureObjects[tt];
+
+        //Internal( "RegalSo unit", unit, " texture ", ts ? ts->name : 0, " for sampler ", pSS ? pSS->name : 0 );
+        if( ts == NULL ) {
+          // no texture bound, don't bother trying to make samplers work with the default texture object
+          continue;
+        }
 
-      if( pSS == NULL && ts->samplerName == 0 && ts->samplerVer == ts->app.ver ) {
-        // this texture has no associated sampler
-        //Internal( "RegalSo", "no sampler association and up-to-date ", ts->samplerVer );
-        continue;
-      }
+        if( pSS == NULL && ts->samplerName == 0 && ts->samplerVer == ts->app.ver ) {
+          // this texture has no associated sampler
+          //Internal( "RegalSo", "no sampler association and up-to-date ", ts->samplerVer );
+          continue;
+        }
 
-      if( pSS && ts->samplerName == pSS->name && ts->samplerVer == pSS->ver ) {
-        // this pair is already associated and up-to-date
-        //Internal( "RegalSo", "already associated and up-to-date ", ts->samplerVer );
-        continue;
-      }
+        if( pSS && ts->samplerName == pSS->name && ts->samplerVer == pSS->ver ) {
+          // this pair is already associated and up-to-date
+          //Internal( "RegalSo", "already associated and up-to-date ", ts->samplerVer );
+          continue;
+        }
 
-      // otherwise, we need to send down updates
-      SamplingState *newState = pSS ? pSS : &ts->app;
+        // otherwise, we need to send down updates
+        SamplingState *newState = pSS ? pSS : &ts->app;
 
-      //Internal( "RegalSo", "about to send update samplerVer=", ts->samplerVer, " newState->ver=", newState->ver );
-      if (SendStateToDriver(ctx, static_cast<GLuint>(unit), ts->target, *newState, ts->drv)) {
-        //Internal( "RegalSo", "updated unit ", unit, " texture ", ts ? ts->name : 0, " for sampler ", pSS ? pSS->name : 0 );
-      } else {
-        //Internal( "RegalSo", "no update occurred" );
+        //Internal( "RegalSo", "about to send update samplerVer=", ts->samplerVer, " newState->ver=", newState->ver );
+        if (SendStateToDriver(ctx, unit, ts->target, *newState, ts->drv)) {
+          //Internal( "RegalSo", "updated unit ", unit, " texture ", ts ? ts->name : 0, " for sampler ", pSS ? pSS->name : 0 );
+        } else {
+          //Internal( "RegalSo", "no update occurred" );
+        }
+        ts->samplerName = pSS ? pSS->name : 0;
+        ts->samplerVer = newState->ver;
       }
-      ts->samplerName = pSS ? pSS->name : 0;
-      ts->samplerVer = newState->ver;
+
+      tu.dirtyTargets = 0;
     }
+    dirtyUnits[w] = 0;
   }
 
   if (activeTextureUnit != originallyActiveUnit)
@@ -378,7 +391,9 @@ So::SendStateToDriver(RegalContext &ctx, GLuint unit, GLenum target, SamplingSta
 
   if (target == GL_TEXTURE_2D ||
       target == GL_TEXTURE_3D ||
-      target == GL_TEXTURE_CUBE_MAP)
+      target == GL_TEXTURE_2D_ARRAY ||
+      target == GL_TEXTURE_CUBE_MAP ||
+      target == GL_TEXTURE_CUBE_MAP_ARRAY)
   {
     if (newState.WrapT != drv.WrapT)
     {
@@ -58,6 +58,10 @@ REGAL_NAMESPACE_BEGIN
 
 #define REGAL_NUM_TEXTURE_TARGETS 16
 
+// Target indices that can be bound, not including the cube map faces
+
+#define REGAL_SO_ALL_TARGETS ((1u << 10) - 1)
+
 namespace Emu {
 
 struct So
@@ -67,6 +71,7 @@ struct So
       nextSamplerObjectId(1),
       supportSrgb(false)
     {
+        memset(dirtyUnits, 0, sizeof(dirtyUnits));
     }
 
     ~So()
@@ -90,6 +95,7 @@ struct So
 
         supportSrgb = ctx.info->gl_ext_texture_srgb_decode || ctx.info->gl_ext_srgb;
         noSamplersInUse = true;
+        memset(dirtyUnits, 0, sizeof(dirtyUnits));
     }
 
     void Cleanup( RegalContext &ctx )
@@ -218,9 +224,11 @@ struct So
     {
         SamplingState* boundSamplerObject;
         TextureState* boundTextureObjects[REGAL_NUM_TEXTURE_TARGETS];
+        GLuint dirtyTargets;  // target indices to be checked by PreDraw
 
         TextureUnit()
         : boundSamplerObject(NULL)
+        , dirtyTargets(0)
         {
             size_t n = array_size( boundTextureObjects );
             for (size_t tti = 0; tti < n; tti++)
@@ -323,6 +331,14 @@ struct So
 
         ss->ver = mainVer.Update();
 
+        size_t n = array_size( textureUnits );
+        for (size_t unit = 0; unit < n; unit++)
+        {
+            RegalAssertArrayIndex( textureUnits, unit );
+            if (textureUnits[unit].boundSamplerObject == ss)
+                MarkDirty(static_cast<GLuint>(unit), REGAL_SO_ALL_TARGETS);
+        }
+
         return true;
     }
 
@@ -513,8 +529,19 @@ struct So
         as->ver = mainVer.Update();
         if (passthru) {
           ts->samplerVer = as->ver;
+          return false;
         }
-        return !passthru;
+
+        // The texture may also be bound to other units
+
+        size_t n = array_size( textureUnits );
+        for (size_t unit = 0; unit < n; unit++)
+        {
+            RegalAssertArrayIndex( textureUnits, unit );
+            if (textureUnits[unit].boundTextureObjects[tti] == ts)
+                MarkDirty(static_cast<GLuint>(unit), 1u << tti);
+        }
+        return true;
     }
 
     template <typename T> bool GetTexParameterv( RegalContext &ctx, GLenum target, GLenum pname, T * params )
@@ -712,6 +739,16 @@ struct So
 
     bool ActiveTexture(RegalContext &ctx, GLenum tex);
     void PreDraw(RegalContext &ctx);
+
+    // Units with dirty targets are set in dirtyUnits, so that
+    // PreDraw only visits what changed since the previous draw.
+
+    void MarkDirty(GLuint unit, GLuint targets)
+    {
+        RegalAssertArrayIndex( textureUnits, unit );
+        textureUnits[unit].dirtyTargets |= targets;
+        dirtyUnits[unit / 64] |= GLuint64(1) << (unit % 64);
+    }
     bool SendStateToDriver(RegalContext &ctx, GLuint unit, GLenum target, SamplingState& newSS, SamplingState& oldSS);
 
     Version mainVer;
@@ -720,6 +757,7 @@ struct So
     bool   supportSrgb;
     bool   noSamplersInUse;
     TextureUnit textureUnits[REGAL_EMU_MAX_COMBINED_TEXTURE_IMAGE_UNITS];
+    GLuint64 dirtyUnits[(REGAL_EMU_MAX_COMBINED_TEXTURE_IMAGE_UNITS + 63) / 64];
     std::map<GLuint, SamplingState*> samplerObjects;
     std::map<GLuint, TextureState*> textureObjects;
     static const GLenum index2Enum[REGAL_NUM_TEXTURE_TARGETS];
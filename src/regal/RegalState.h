@@ -110,6 +110,28 @@ inline static void setEnablei(DispatchTableGL &dt, const GLenum cap, const GLuin
     dt.call(&dt.glDisablei)(cap,index);
 }
 
+// Helpers for transition(), only issuing the calls that differ from current.
+// Groups sharing enables with GL_ENABLE_BIT skip them when enables is false,
+// so that popping both restores each enable once, from Enable.
+
+template <typename T, size_t N>
+inline static bool arrayEqual(const T (&a)[N], const T (&b)[N])
+{
+  return std::equal(a,a+N,b);
+}
+
+inline static void transitionEnable(DispatchTableGL &dt, const GLenum cap, const GLboolean current, const GLboolean enable)
+{
+  if (current != enable)
+    setEnable(dt,cap,enable);
+}
+
+inline static void transitionEnablei(DispatchTableGL &dt, const GLenum cap, const GLuint index, const GLboolean current, const GLboolean enable)
+{
+  if (current != enable)
+    setEnablei(dt,cap,index,enable);
+}
+
 inline static void enableToString(string_list &tmp, const GLboolean b, const char *bEnum, const char *delim = "\n")
 {
   tmp << print_string(b ? "glEnable(" : "glDisable(",bEnum,");",delim);
@@ -622,6 +644,122 @@ struct Enable
     return *this;
   }
 
+  inline const Enable &transition(RegalContext &ctx, Enable &current) const
+  {
+    DispatchTableGL &dt = ctx.dispatcher.emulation;
+    transitionEnable(dt,GL_ALPHA_TEST,current.alphaTest,alphaTest);
+    transitionEnable(dt,GL_AUTO_NORMAL,current.autoNormal,autoNormal);
+    size_t n = array_size( blend );
+    for (size_t ii=0; ii<n; ii++)
+    {
+      RegalAssertArrayIndex( blend, ii );
+      transitionEnablei(dt,GL_BLEND,static_cast<GLuint>(ii),current.blend[ii],blend[ii]);
+    }
+    transitionEnable(dt,GL_COLOR_LOGIC_OP,current.colorLogicOp,colorLogicOp);
+    if (current.clampFragmentColor != clampFragmentColor)
+      dt.call(&dt.glClampColor)(GL_CLAMP_FRAGMENT_COLOR,clampFragmentColor);
+    if (current.clampReadColor != clampReadColor)
+      dt.call(&dt.glClampColor)(GL_CLAMP_READ_COLOR,clampReadColor);
+    if (current.clampVertexColor != clampVertexColor)
+      dt.call(&dt.glClampColor)(GL_CLAMP_VERTEX_COLOR,clampVertexColor);
+    n = array_size( clipDistance );
+    for (size_t ii=0; ii<n; ii++)
+    {
+      RegalAssertArrayIndex( clipDistance, ii );
+      transitionEnable(dt,static_cast<GLenum>(GL_CLIP_DISTANCE0+ii),current.clipDistance[ii],clipDistance[ii]);
+    }
+    transitionEnable(dt,GL_COLOR_MATERIAL,current.colorMaterial,colorMaterial);
+    transitionEnable(dt,GL_COLOR_SUM,current.colorSum,colorSum);
+    transitionEnable(dt,GL_COLOR_TABLE,current.colorTable,colorTable);
+    transitionEnable(dt,GL_CONVOLUTION_1D,current.convolution1d,convolution1d);
+    transitionEnable(dt,GL_CONVOLUTION_2D,current.convolution2d,convolution2d);
+    transitionEnable(dt,GL_CULL_FACE,current.cullFace,cullFace);
+    transitionEnable(dt,GL_DEPTH_CLAMP,current.depthClamp,depthClamp);
+    transitionEnable(dt,GL_DEPTH_TEST,current.depthTest,depthTest);
+    transitionEnable(dt,GL_DITHER,current.dither,dither);
+    transitionEnable(dt,GL_FOG,current.fog,fog);
+    transitionEnable(dt,GL_FRAMEBUFFER_SRGB,current.framebufferSRGB,framebufferSRGB);
+    transitionEnable(dt,GL_HISTOGRAM,current.histogram,histogram);
+    transitionEnable(dt,GL_INDEX_LOGIC_OP,current.indexLogicOp,indexLogicOp);
+    n = array_size( light );
+    for (size_t ii=0; ii<n; ii++)
+    {
+      RegalAssertArrayIndex( light, ii );
+      transitionEnable(dt,static_cast<GLenum>(GL_LIGHT0+ii),current.light[ii],light[ii]);
+    }
+    transitionEnable(dt,GL_LIGHTING,current.lighting,lighting);
+    transitionEnable(dt,GL_LINE_SMOOTH,current.lineSmooth,lineSmooth);
+    transitionEnable(dt,GL_LINE_STIPPLE,current.lineStipple,lineStipple);
+    transitionEnable(dt,GL_MAP1_COLOR_4,current.map1Color4,map1Color4);
+    transitionEnable(dt,GL_MAP1_INDEX,current.map1Index,map1Index);
+    transitionEnable(dt,GL_MAP1_NORMAL,current.map1Normal,map1Normal);
+    transitionEnable(dt,GL_MAP1_TEXTURE_COORD_1,current.map1TextureCoord1,map1TextureCoord1);
+    transitionEnable(dt,GL_MAP1_TEXTURE_COORD_2,current.map1TextureCoord2,map1TextureCoord2);
+    transitionEnable(dt,GL_MAP1_TEXTURE_COORD_3,current.map1TextureCoord3,map1TextureCoord3);
+    transitionEnable(dt,GL_MAP1_TEXTURE_COORD_4,current.map1TextureCoord4,map1TextureCoord4);
+    transitionEnable(dt,GL_MAP1_VERTEX_3,current.map1Vertex3,map1Vertex3);
+    transitionEnable(dt,GL_MAP1_VERTEX_4,current.map1Vertex4,map1Vertex4);
+    transitionEnable(dt,GL_MAP2_COLOR_4,current.map2Color4,map2Color4);
+    transitionEnable(dt,GL_MAP2_INDEX,current.map2Index,map2Index);
+    transitionEnable(dt,GL_MAP2_NORMAL,current.map2Normal,map2Normal);
+    transitionEnable(dt,GL_MAP2_TEXTURE_COORD_1,current.map2TextureCoord1,map2TextureCoord1);
+    transitionEnable(dt,GL_MAP2_TEXTURE_COORD_2,current.map2TextureCoord2,map2TextureCoord2);
+    transitionEnable(dt,GL_MAP2_TEXTURE_COORD_3,current.map2TextureCoord3,map2TextureCoord3);
+    transitionEnable(dt,GL_MAP2_TEXTURE_COORD_4,current.map2TextureCoord4,map2TextureCoord4);
+    transitionEnable(dt,GL_MAP2_VERTEX_3,current.map2Vertex3,map2Vertex3);
+    transitionEnable(dt,GL_MAP2_VERTEX_4,current.map2Vertex4,map2Vertex4);
+    transitionEnable(dt,GL_MINMAX,current.minmax,minmax);
+    transitionEnable(dt,GL_MULTISAMPLE,current.multisample,multisample);
+    transitionEnable(dt,GL_NORMALIZE,current.normalize,normalize);
+    transitionEnable(dt,GL_POINT_SMOOTH,current.pointSmooth,pointSmooth);
+    transitionEnable(dt,GL_POINT_SPRITE,current.pointSprite,pointSprite);
+    transitionEnable(dt,GL_POLYGON_OFFSET_FILL,current.polygonOffsetFill,polygonOffsetFill);
+    transitionEnable(dt,GL_POLYGON_OFFSET_LINE,current.polygonOffsetLine,polygonOffsetLine);
+    transitionEnable(dt,GL_POLYGON_OFFSET_POINT,current.polygonOffsetPoint,polygonOffsetPoint);
+    transitionEnable(dt,GL_POLYGON_SMOOTH,current.polygonSmooth,polygonSmooth);
+    transitionEnable(dt,GL_POLYGON_STIPPLE,current.polygonStipple,polygonStipple);
+    transitionEnable(dt,GL_POST_COLOR_MATRIX_COLOR_TABLE,current.postColorMatrixColorTable,postColorMatrixColorTable);
+    transitionEnable(dt,GL_POST_CONVOLUTION_COLOR_TABLE,current.postConvolutionColorTable,postConvolutionColorTable);
+    transitionEnable(dt,GL_PROGRAM_POINT_SIZE,current.programPointSize,programPointSize);
+    transitionEnable(dt,GL_RESCALE_NORMAL,current.rescaleNormal,rescaleNormal);
+    transitionEnable(dt,GL_SAMPLE_ALPHA_TO_COVERAGE,current.sampleAlphaToCoverage,sampleAlphaToCoverage);
+    transitionEnable(dt,GL_SAMPLE_ALPHA_TO_ONE,current.sampleAlphaToOne,sampleAlphaToOne);
+    transitionEnable(dt,GL_SAMPLE_COVERAGE,current.sampleCoverage,sampleCoverage);
+    if (ctx.info->gl_version_4_0 || ctx.info->gl_arb_sample_shading)
+      transitionEnable(dt,GL_SAMPLE_SHADING,current.sampleShading,sampleShading);
+    transitionEnable(dt,GL_SEPARABLE_2D,current.separable2d,separable2d);
+    transitionEnable(dt,GL_STENCIL_TEST,current.stencilTest,stencilTest);
+    n = array_size( scissorTest );
+    for (size_t ii=0; ii<n; ii++)
+    {
+      RegalAssertArrayIndex( scissorTest, ii );
+      transitionEnablei(dt,GL_SCISSOR_TEST,static_cast<GLuint>(ii),current.scissorTest[ii],scissorTest[ii]);
+    }
+    n = array_size( texture1d );
+    RegalAssert( array_size( texture2d ) == n );
+    RegalAssert( array_size( texture3d ) == n );
+    RegalAssert( array_size( textureCubeMap ) == n );
+    RegalAssert( array_size( textureRectangle ) == n );
+    RegalAssert( array_size( textureGenS ) == n );
+    RegalAssert( array_size( textureGenT ) == n );
+    RegalAssert( array_size( textureGenR ) == n );
+    RegalAssert( array_size( textureGenQ ) == n );
+    for (GLuint ii=0; ii<static_cast<GLuint>(n); ii++)
+    {
+      transitionEnablei(dt,GL_TEXTURE_1D,ii,current.texture1d[ii],texture1d[ii]);
+      transitionEnablei(dt,GL_TEXTURE_2D,ii,current.texture2d[ii],texture2d[ii]);
+      transitionEnablei(dt,GL_TEXTURE_3D,ii,current.texture3d[ii],texture3d[ii]);
+      transitionEnablei(dt,GL_TEXTURE_CUBE_MAP,ii,current.textureCubeMap[ii],textureCubeMap[ii]);
+      transitionEnablei(dt,GL_TEXTURE_RECTANGLE,ii,current.textureRectangle[ii],textureRectangle[ii]);
+      transitionEnablei(dt,GL_TEXTURE_GEN_S,ii,current.textureGenS[ii],textureGenS[ii]);
+      transitionEnablei(dt,GL_TEXTURE_GEN_T,ii,current.textureGenT[ii],textureGenT[ii]);
+      transitionEnablei(dt,GL_TEXTURE_GEN_R,ii,current.textureGenR[ii],textureGenR[ii]);
+      transitionEnablei(dt,GL_TEXTURE_GEN_Q,ii,current.textureGenQ[ii],textureGenQ[ii]);
+    }
+    transitionEnable(dt,GL_VERTEX_PROGRAM_TWO_SIDE,current.vertexProgramTwoSide,vertexProgramTwoSide);
+    return *this;
+  }
+
   inline std::string toString(const char *delim = "\n") const
   {
     string_list tmp;
@@ -779,6 +917,19 @@ struct Depth
     return *this;
   }
 
+  inline const Depth &transition(DispatchTableGL &dt, Depth &current, const bool enables = true) const
+  {
+    if (enables)
+      transitionEnable(dt,GL_DEPTH_TEST,current.enable,enable);
+    if (current.func != func)
+      dt.call(&dt.glDepthFunc)(func);
+    if (current.clear != clear)
+      dt.call(&dt.glClearDepth)(clear);
+    if (current.mask != mask)
+      dt.call(&dt.glDepthMask)(mask);
+    return *this;
+  }
+
   inline std::string toString(const char *delim = "\n") const
   {
     string_list tmp;
@@ -858,6 +1009,17 @@ struct StencilFace
     return *this;
   }
 
+  inline const StencilFace &transition(DispatchTableGL &dt, GLenum face, StencilFace &current) const
+  {
+    if (current.func != func || current.ref != ref || current.valueMask != valueMask)
+      dt.call(&dt.glStencilFuncSeparate)(face,func,ref,valueMask);
+    if (current.writeMask != writeMask)
+      dt.call(&dt.glStencilMaskSeparate)(face,writeMask);
+    if (current.fail != fail || current.zfail != zfail || current.zpass != zpass)
+      dt.call(&dt.glStencilOpSeparate)(face,fail,zfail,zpass);
+    return *this;
+  }
+
   inline std::string toString(GLenum face,const char *delim = "\n") const
   {
     string_list tmp;
@@ -911,6 +1073,17 @@ struct Stencil
     return *this;
   }
 
+  inline const Stencil &transition(DispatchTableGL &dt, Stencil &current, const bool enables = true) const
+  {
+    if (enables)
+      transitionEnable(dt,GL_STENCIL_TEST,current.enable,enable);
+    if (current.clear != clear)
+      dt.call(&dt.glClearStencil)(clear);
+    front.transition(dt,GL_FRONT,current.front);
+    back.transition(dt,GL_BACK,current.back);
+    return *this;
+  }
+
   inline std::string toString(const char *delim = "\n") const
   {
     string_list tmp;
@@ -1097,6 +1270,31 @@ struct Polygon
     return *this;
   }
 
+  inline const Polygon &transition(DispatchTableGL &dt, Polygon &current, const bool enables = true) const
+  {
+    if (enables)
+      transitionEnable(dt,GL_CULL_FACE,current.cullEnable,cullEnable);
+    if (current.cullFaceMode != cullFaceMode)
+      dt.call(&dt.glCullFace)(cullFaceMode);
+    if (current.frontFace != frontFace)
+      dt.call(&dt.glFrontFace)(frontFace);
+    if (current.mode[0] != mode[0])
+      dt.call(&dt.glPolygonMode)(GL_FRONT,mode[0]);
+    if (current.mode[1] != mode[1])
+      dt.call(&dt.glPolygonMode)(GL_BACK,mode[1]);
+    if (enables)
+    {
+      transitionEnable(dt,GL_POLYGON_SMOOTH,current.smoothEnable,smoothEnable);
+      transitionEnable(dt,GL_POLYGON_STIPPLE,current.stippleEnable,stippleEnable);
+      transitionEnable(dt,GL_POLYGON_OFFSET_FILL,current.offsetFill,offsetFill);
+      transitionEnable(dt,GL_POLYGON_OFFSET_LINE,current.offsetLine,offsetLine);
+      transitionEnable(dt,GL_POLYGON_OFFSET_POINT,current.offsetPoint,offsetPoint);
+    }
+    if (current.factor != factor || current.units != units)
+      dt.call(&dt.glPolygonOffset)(factor,units);
+    return *this;
+  }
+
   inline std::string toString(const char *delim = "\n") const
   {
     string_list tmp;
@@ -1223,13 +1421,13 @@ struct Transform
     return *this;
   }
 
-  inline const Transform &transition(DispatchTableGL &dt, Transform &current) const
+  inline const Transform &transition(DispatchTableGL &dt, Transform &current, const bool enables = true) const
   {
     size_t n = array_size( clipPlane );
     for (size_t i = 0; i < n; i++)
     {
       RegalAssertArrayIndex( clipPlane, i );
-      if (current.clipPlane[i].enabled != clipPlane[i].enabled)
+      if (enables && current.clipPlane[i].enabled != clipPlane[i].enabled)
         setEnable(dt, static_cast<GLenum>(GL_CLIP_PLANE0 + i), clipPlane[i].enabled);
 
       if (current.clipPlane[i].equation != clipPlane[i].equation)
@@ -1239,13 +1437,13 @@ struct Transform
     if (current.matrixMode != matrixMode)
       dt.call(&dt.glMatrixMode)(matrixMode);
 
-    if (current.normalize != normalize)
+    if (enables && current.normalize != normalize)
       setEnable(dt, GL_NORMALIZE, normalize);
 
-    if (current.rescaleNormal != rescaleNormal)
+    if (enables && current.rescaleNormal != rescaleNormal)
       setEnable(dt, GL_RESCALE_NORMAL, rescaleNormal);
 
-    if (current.depthClamp != depthClamp )
+    if (enables && current.depthClamp != depthClamp )
       setEnable(dt, GL_DEPTH_CLAMP, depthClamp );
 
     return *this;
@@ -1358,6 +1556,27 @@ struct Hint
     return *this;
   }
 
+  inline const Hint &transition(DispatchTableGL &dt, Hint &current) const
+  {
+    if (current.perspectiveCorrection != perspectiveCorrection)
+      dt.call(&dt.glHint)(GL_PERSPECTIVE_CORRECTION_HINT, perspectiveCorrection);
+    if (current.pointSmooth != pointSmooth)
+      dt.call(&dt.glHint)(GL_POINT_SMOOTH_HINT, pointSmooth);
+    if (current.lineSmooth != lineSmooth)
+      dt.call(&dt.glHint)(GL_LINE_SMOOTH_HINT, lineSmooth);
+    if (current.polygonSmooth != polygonSmooth)
+      dt.call(&dt.glHint)(GL_POLYGON_SMOOTH_HINT, polygonSmooth);
+    if (current.fog != fog)
+      dt.call(&dt.glHint)(GL_FOG_HINT, fog);
+    if (current.generateMipmap != generateMipmap)
+      dt.call(&dt.glHint)(GL_GENERATE_MIPMAP_HINT, generateMipmap);
+    if (current.textureCompression != textureCompression)
+      dt.call(&dt.glHint)(GL_TEXTURE_COMPRESSION_HINT, textureCompression);
+    if (current.fragmentShaderDerivative != fragmentShaderDerivative)
+      dt.call(&dt.glHint)(GL_FRAGMENT_SHADER_DERIVATIVE_HINT, fragmentShaderDerivative);
+    return *this;
+  }
+
   inline std::string toString(const char *delim = "\n") const
   {
     string_list tmp;
@@ -1437,6 +1656,13 @@ struct List
     return *this;
   }
 
+  inline const List &transition(DispatchTableGL &dt, List &current) const
+  {
+    if (current.base != base)
+      dt.call(&dt.glListBase)(base);
+    return *this;
+  }
+
   inline std::string toString(const char *delim = "\n") const
   {
     string_list tmp;
@@ -1481,6 +1707,13 @@ struct AccumBuffer
     return *this;
   }
 
+  inline const AccumBuffer &transition(DispatchTableGL &dt, AccumBuffer &current) const
+  {
+    if (!arrayEqual(current.clear,clear))
+      dt.call(&dt.glClearAccum)(clear[0],clear[1],clear[2],clear[3]);
+    return *this;
+  }
+
   inline std::string toString(const char *delim = "\n") const
   {
     string_list tmp;
@@ -1594,6 +1827,22 @@ struct Scissor
     return *this;
   }
 
+  inline const Scissor &transition(DispatchTableGL &dt, Scissor &current, const bool enables = true) const
+  {
+    size_t n = array_size( scissorTest );
+    RegalAssert(array_size( valid ) == n);
+    for (size_t ii=0; ii<n; ii++)
+    {
+      RegalAssertArrayIndex( scissorTest, ii );
+      RegalAssertArrayIndex( valid, ii );
+      if (enables)
+        transitionEnablei(dt,GL_SCISSOR_TEST,static_cast<GLuint>(ii),current.scissorTest[ii],scissorTest[ii]);
+      if (valid[ii] && (!current.valid[ii] || !arrayEqual(current.scissorBox[ii],scissorBox[ii])))
+        dt.call(&dt.glScissorIndexedv)(static_cast<GLuint>(ii), &scissorBox[ii][0]);
+    }
+    return *this;
+  }
+
   inline std::string toString(const char *delim = "\n") const
   {
     string_list tmp;
@@ -1758,6 +2007,20 @@ struct Viewport
     return *this;
   }
 
+  inline const Viewport &transition(DispatchTableGL &dt, Viewport &current) const
+  {
+    if (!std::equal(&depthRange[0][0],&depthRange[0][0]+(REGAL_EMU_MAX_VIEWPORTS*2),&current.depthRange[0][0]))
+      dt.call(&dt.glDepthRangeArrayv)(0, REGAL_EMU_MAX_VIEWPORTS, &depthRange[0][0] );
+    size_t n = array_size( valid );
+    for (size_t ii=0; ii<n; ii++)
+    {
+      RegalAssertArrayIndex( valid, ii );
+      if (valid[ii] && (!current.valid[ii] || !arrayEqual(current.viewport[ii],viewport[ii])))
+        dt.call(&dt.glViewportIndexedfv)(static_cast<GLuint>(ii), &viewport[ii][0] );
+    }
+    return *this;
+  }
+
   inline std::string toString(const char *delim = "\n") const
   {
     string_list tmp;
@@ -1916,6 +2179,20 @@ struct Line
     return *this;
   }
 
+  inline const Line &transition(DispatchTableGL &dt, Line &current, const bool enables = true) const
+  {
+    if (current.width != width)
+      dt.call(&dt.glLineWidth)(width);
+    if (enables)
+    {
+      transitionEnable(dt,GL_LINE_SMOOTH,current.smooth,smooth);
+      transitionEnable(dt,GL_LINE_STIPPLE,current.stipple,stipple);
+    }
+    if (current.stippleRepeat != stippleRepeat || current.stipplePattern != stipplePattern)
+      dt.call(&dt.glLineStipple)(stippleRepeat, stipplePattern);
+    return *this;
+  }
+
   inline std::string toString(const char *delim = "\n") const
   {
     string_list tmp;
@@ -2007,6 +2284,25 @@ struct Multisample
     return *this;
   }
 
+  inline const Multisample &transition(RegalContext &ctx, Multisample &current, const bool enables = true) const
+  {
+    DispatchTableGL &dt = ctx.dispatcher.emulation;
+    if (enables)
+    {
+      transitionEnable(dt,GL_MULTISAMPLE,current.multisample,multisample);
+      transitionEnable(dt,GL_SAMPLE_ALPHA_TO_COVERAGE,current.sampleAlphaToCoverage,sampleAlphaToCoverage);
+      transitionEnable(dt,GL_SAMPLE_ALPHA_TO_ONE,current.sampleAlphaToOne,sampleAlphaToOne);
+      transitionEnable(dt,GL_SAMPLE_COVERAGE,current.sampleCoverage,sampleCoverage);
+    }
+    if (current.sampleCoverageValue != sampleCoverageValue || current.sampleCoverageInvert != sampleCoverageInvert)
+      dt.call(&dt.glSampleCoverage)(sampleCoverageValue, sampleCoverageInvert);
+    if (enables && (ctx.info->gl_version_4_0 || ctx.info->gl_arb_sample_shading))
+      transitionEnable(dt,GL_SAMPLE_SHADING,current.sampleShading,sampleShading);
+    if (current.minSampleShadingValue != minSampleShadingValue)
+      dt.call(&dt.glMinSampleShading)(minSampleShadingValue);
+    return *this;
+  }
+
   inline std::string toString(const char *delim = "\n") const
   {
     string_list tmp;
@@ -2106,6 +2402,24 @@ struct Eval
     return *this;
   }
 
+  inline const Eval &transition(DispatchTableGL &dt, Eval &current, const bool enables = true) const
+  {
+    if (enables)
+    {
+      transitionEnable(dt,GL_AUTO_NORMAL,current.autoNormal,autoNormal);
+      for (size_t ii=0; ii<9; ii++)
+        transitionEnable(dt,static_cast<GLenum>(GL_MAP1_COLOR_4+ii),current.map1dEnables[ii],map1dEnables[ii]);
+      for (size_t ii=0; ii<9; ii++)
+        transitionEnable(dt,static_cast<GLenum>(GL_MAP2_COLOR_4+ii),current.map2dEnables[ii],map2dEnables[ii]);
+    }
+    if (current.map1GridSegments != map1GridSegments || !arrayEqual(current.map1GridDomain,map1GridDomain))
+      dt.call(&dt.glMapGrid1d)(map1GridSegments, map1GridDomain[0], map1GridDomain[1]);
+    if (!arrayEqual(current.map2GridSegments,map2GridSegments) || !arrayEqual(current.map2GridDomain,map2GridDomain))
+      dt.call(&dt.glMapGrid2d)(map2GridSegments[0], map2GridDomain[0], map2GridDomain[1],
+                               map2GridSegments[1], map2GridDomain[2], map2GridDomain[3]);
+    return *this;
+  }
+
   inline std::string toString(const char *delim = "\n") const
   {
     string_list tmp;
@@ -2212,6 +2526,29 @@ struct Fog
     return *this;
   }
 
+  inline const Fog &transition(DispatchTableGL &dt, Fog &current, const bool enables = true) const
+  {
+    if (!arrayEqual(current.color,color))
+      dt.call(&dt.glFogfv)(GL_FOG_COLOR,color);
+    if (current.index != index)
+      dt.call(&dt.glFogf)(GL_FOG_INDEX,index);
+    if (current.density != density)
+      dt.call(&dt.glFogf)(GL_FOG_DENSITY,density);
+    if (current.start != start)
+      dt.call(&dt.glFogf)(GL_FOG_START,start);
+    if (current.end != end)
+      dt.call(&dt.glFogf)(GL_FOG_END,end);
+    if (current.mode != mode)
+      dt.call(&dt.glFogi)(GL_FOG_MODE,mode);
+    if (enables)
+      transitionEnable(dt,GL_FOG,current.enable,enable);
+    if (current.coordSrc != coordSrc)
+      dt.call(&dt.glFogi)(GL_FOG_COORD_SRC,coordSrc);
+    if (enables)
+      transitionEnable(dt,GL_COLOR_SUM,current.colorSum,colorSum);
+    return *this;
+  }
+
   inline std::string toString(const char *delim = "\n") const
   {
     string_list tmp;
@@ -2226,6 +2563,49 @@ struct Fog
     enableToString(tmp, colorSum, "GL_COLOR_SUM",delim);
     return tmp;
   }
+
+  template <typename T> void glFog( GLenum pname, T param )
+  {
+    switch (pname)
+    {
+      case GL_FOG_INDEX:
+        index = static_cast<GLfloat>(param);
+        break;
+      case GL_FOG_DENSITY:
+        density = static_cast<GLfloat>(param);
+        break;
+      case GL_FOG_START:
+        start = static_cast<GLfloat>(param);
+        break;
+      case GL_FOG_END:
+        end = static_cast<GLfloat>(param);
+        break;
+      case GL_FOG_MODE:
+        mode = static_cast<GLenum>(param);
+        break;
+      case GL_FOG_COORD_SRC:
+        coordSrc = static_cast<GLenum>(param);
+        break;
+      default:
+        break;
+    }
+  }
+
+  template <typename T> void glFogv( GLenum pname, const T *params )
+  {
+    switch (pname)
+    {
+      case GL_FOG_COLOR:
+        color[0] = static_cast<GLfloat>(params[0]);
+        color[1] = static_cast<GLfloat>(params[1]);
+        color[2] = static_cast<GLfloat>(params[2]);
+        color[3] = static_cast<GLfloat>(params[3]);
+        break;
+      default:
+        glFog(pname,params[0]);
+        break;
+    }
+  }
 };
 
 //
@@ -2335,6 +2715,35 @@ struct Point
     return *this;
   }
 
+  inline const Point &transition(DispatchTableGL &dt, Point &current, const bool enables = true) const
+  {
+    if (current.size != size)
+      dt.call(&dt.glPointSize)(size);
+    if (enables)
+    {
+      transitionEnable(dt,GL_POINT_SMOOTH,current.smooth,smooth);
+      transitionEnable(dt,GL_POINT_SPRITE,current.sprite,sprite);
+    }
+    if (current.sizeMin != sizeMin)
+      dt.call(&dt.glPointParameterf)(GL_POINT_SIZE_MIN,sizeMin);
+    if (current.sizeMax != sizeMax)
+      dt.call(&dt.glPointParameterf)(GL_POINT_SIZE_MAX,sizeMax);
+    if (current.fadeThresholdSize != fadeThresholdSize)
+      dt.call(&dt.glPointParameterf)(GL_POINT_FADE_THRESHOLD_SIZE,fadeThresholdSize);
+    if (!arrayEqual(current.distanceAttenuation,distanceAttenuation))
+      dt.call(&dt.glPointParameterfv)(GL_POINT_DISTANCE_ATTENUATION,distanceAttenuation);
+    if (current.spriteCoordOrigin != spriteCoordOrigin)
+      dt.call(&dt.glPointParameteri)(GL_POINT_SPRITE_COORD_ORIGIN,spriteCoordOrigin);
+    size_t n = array_size( coordReplace );
+    for (size_t ii=0; ii<n; ii++)
+    {
+      RegalAssertArrayIndex( coordReplace, ii );
+      if (current.coordReplace[ii] != coordReplace[ii])
+        dt.call(&dt.glMultiTexEnviEXT)(static_cast<GLenum>(GL_TEXTURE0+ii),GL_POINT_SPRITE,GL_COORD_REPLACE,coordReplace[ii]);
+    }
+    return *this;
+  }
+
   inline std::string toString(const char *delim = "\n") const
   {
     string_list tmp;
@@ -2448,6 +2857,13 @@ struct PolygonStipple
     return *this;
   }
 
+  inline const PolygonStipple &transition(DispatchTableGL &dt, PolygonStipple &current) const
+  {
+    if (!arrayEqual(current.pattern,pattern))
+      dt.call(&dt.glPolygonStipple)(pattern);
+    return *this;
+  }
+
   inline std::string toString(const char *delim = "\n") const
   {
     string_list tmp;
@@ -2710,6 +3126,69 @@ struct ColorBuffer
     return *this;
   }
 
+  inline const ColorBuffer &transition(DispatchTableGL &dt, ColorBuffer &current, const bool enables = true) const
+  {
+    if (current.clampFragmentColor != clampFragmentColor)
+      dt.call(&dt.glClampColor)(GL_CLAMP_FRAGMENT_COLOR,clampFragmentColor);
+    if (current.clampReadColor != clampReadColor)
+      dt.call(&dt.glClampColor)(GL_CLAMP_READ_COLOR,clampReadColor);
+    if (enables)
+      transitionEnable(dt,GL_ALPHA_TEST,current.alphaTest,alphaTest);
+    if (current.alphaTestFunc != alphaTestFunc || current.alphaTestRef != alphaTestRef)
+      dt.call(&dt.glAlphaFunc)(alphaTestFunc,alphaTestRef);
+    size_t n = array_size( blend );
+    for (GLuint ii=0; ii<static_cast<GLuint>(n); ii++)
+    {
+      RegalAssertArrayIndex( blend, ii );
+      if (enables)
+        transitionEnablei(dt,GL_BLEND,ii,current.blend[ii],blend[ii]);
+    }
+    n = array_size( blendSrcRgb );
+    RegalAssert(array_size( blendSrcAlpha ) == n);
+    RegalAssert(array_size( blendDstRgb ) == n);
+    RegalAssert(array_size( blendDstAlpha ) == n);
+    for (GLuint ii=0; ii<static_cast<GLuint>(n); ii++)
+    {
+      RegalAssertArrayIndex( blendSrcRgb, ii );
+      if (current.blendSrcRgb[ii] != blendSrcRgb[ii] || current.blendSrcAlpha[ii] != blendSrcAlpha[ii] || current.blendDstRgb[ii] != blendDstRgb[ii] || current.blendDstAlpha[ii] != blendDstAlpha[ii])
+        dt.call(&dt.glBlendFuncSeparatei)(ii,blendSrcRgb[ii],blendSrcAlpha[ii],blendDstRgb[ii],blendDstAlpha[ii]);
+    }
+    n = array_size( blendEquationRgb );
+    RegalAssert(array_size( blendEquationAlpha ) == n);
+    for (GLuint ii=0; ii<static_cast<GLuint>(n); ii++)
+    {
+      RegalAssertArrayIndex( blendEquationRgb, ii );
+      if (current.blendEquationRgb[ii] != blendEquationRgb[ii] || current.blendEquationAlpha[ii] != blendEquationAlpha[ii])
+        dt.call(&dt.glBlendEquationSeparatei)(ii,blendEquationRgb[ii],blendEquationAlpha[ii]);
+    }
+    if (!arrayEqual(current.blendColor,blendColor))
+      dt.call(&dt.glBlendColor)(blendColor[0],blendColor[1],blendColor[2],blendColor[3]);
+    if (enables)
+    {
+      transitionEnable(dt,GL_FRAMEBUFFER_SRGB,current.framebufferSRGB,framebufferSRGB);
+      transitionEnable(dt,GL_DITHER,current.dither,dither);
+      transitionEnable(dt,GL_INDEX_LOGIC_OP,current.indexLogicOp,indexLogicOp);
+      transitionEnable(dt,GL_COLOR_LOGIC_OP,current.colorLogicOp,colorLogicOp);
+    }
+    if (current.logicOpMode != logicOpMode)
+      dt.call(&dt.glLogicOp)(logicOpMode);
+    if (current.indexWritemask != indexWritemask)
+      dt.call(&dt.glIndexMask)(indexWritemask);
+    for (GLuint ii=0; ii<REGAL_EMU_MAX_DRAW_BUFFERS; ii++)
+      if (!arrayEqual(current.colorWritemask[ii],colorWritemask[ii]))
+        dt.call(&dt.glColorMaski)(ii, colorWritemask[ii][0], colorWritemask[ii][1], colorWritemask[ii][2], colorWritemask[ii][3]);
+    if (!arrayEqual(current.colorClearValue,colorClearValue))
+      dt.call(&dt.glClearColor)(colorClearValue[0],colorClearValue[1],colorClearValue[2],colorClearValue[3]);
+    if (current.indexClearValue != indexClearValue)
+      dt.call(&dt.glClearIndex)(indexClearValue);
+    if (valid && (!current.valid || !arrayEqual(current.drawBuffers,drawBuffers)))
+    {
+      RegalAssert(array_size( drawBuffers ) >= REGAL_EMU_MAX_DRAW_BUFFERS);
+      dt.call(&dt.glDrawBuffers)(REGAL_EMU_MAX_DRAW_BUFFERS, drawBuffers);
+    }
+    return *this;
+  }
+
   inline std::string toString(const char *delim = "\n") const
   {
     string_list tmp;
@@ -3243,6 +3722,124 @@ struct PixelMode
     return *this;
   }
 
+  inline const PixelMode &transition(DispatchTableGL &dt, PixelMode &current, const bool enables = true) const
+  {
+    if (valid && (!current.valid || current.readBuffer != readBuffer))
+      dt.call(&dt.glReadBuffer)(readBuffer);
+    if (current.mapColor != mapColor)
+      dt.call(&dt.glPixelTransferi)(GL_MAP_COLOR, mapColor);
+    if (current.mapStencil != mapStencil)
+      dt.call(&dt.glPixelTransferi)(GL_MAP_STENCIL,mapStencil);
+    if (current.indexShift != indexShift)
+      dt.call(&dt.glPixelTransferi)(GL_INDEX_SHIFT,indexShift);
+    if (current.indexOffset != indexOffset)
+      dt.call(&dt.glPixelTransferi)(GL_INDEX_OFFSET,indexOffset);
+    if (current.redScale != redScale)
+      dt.call(&dt.glPixelTransferf)(GL_RED_SCALE,redScale);
+    if (current.redBias != redBias)
+      dt.call(&dt.glPixelTransferf)(GL_RED_BIAS,redBias);
+    if (current.greenScale != greenScale)
+      dt.call(&dt.glPixelTransferf)(GL_GREEN_SCALE,greenScale);
+    if (current.greenBias != greenBias)
+      dt.call(&dt.glPixelTransferf)(GL_GREEN_BIAS,greenBias);
+    if (current.blueScale != blueScale)
+      dt.call(&dt.glPixelTransferf)(GL_BLUE_SCALE,blueScale);
+    if (current.blueBias != blueBias)
+      dt.call(&dt.glPixelTransferf)(GL_BLUE_BIAS,blueBias);
+    if (current.alphaScale != alphaScale)
+      dt.call(&dt.glPixelTransferf)(GL_ALPHA_SCALE,alphaScale);
+    if (current.alphaBias != alphaBias)
+      dt.call(&dt.glPixelTransferf)(GL_ALPHA_BIAS,alphaBias);
+    if (enables)
+    {
+      transitionEnable(dt,GL_COLOR_TABLE,current.colorTable,colorTable);
+      transitionEnable(dt,GL_POST_CONVOLUTION_COLOR_TABLE,current.postConvolutionColorTable,postConvolutionColorTable);
+      transitionEnable(dt,GL_POST_COLOR_MATRIX_COLOR_TABLE,current.postColorMatrixColorTable,postColorMatrixColorTable);
+    }
+    if (!arrayEqual(current.colorTableScale[0],colorTableScale[0]))
+      dt.call(&dt.glColorTableParameterfv)(GL_COLOR_TABLE,                   GL_COLOR_TABLE_SCALE, &colorTableScale[0][0]);
+    if (!arrayEqual(current.colorTableBias[0],colorTableBias[0]))
+      dt.call(&dt.glColorTableParameterfv)(GL_COLOR_TABLE,                   GL_COLOR_TABLE_BIAS,  &colorTableBias[0][0]);
+    if (!arrayEqual(current.colorTableScale[1],colorTableScale[1]))
+      dt.call(&dt.glColorTableParameterfv)(GL_POST_CONVOLUTION_COLOR_TABLE,  GL_COLOR_TABLE_SCALE, &colorTableScale[1][0]);
+    if (!arrayEqual(current.colorTableBias[1],colorTableBias[1]))
+      dt.call(&dt.glColorTableParameterfv)(GL_POST_CONVOLUTION_COLOR_TABLE,  GL_COLOR_TABLE_BIAS,  &colorTableBias[1][0]);
+    if (!arrayEqual(current.colorTableScale[2],colorTableScale[2]))
+      dt.call(&dt.glColorTableParameterfv)(GL_POST_COLOR_MATRIX_COLOR_TABLE, GL_COLOR_TABLE_SCALE, &colorTableScale[2][0]);
+    if (!arrayEqual(current.colorTableBias[2],colorTableBias[2]))
+      dt.call(&dt.glColorTableParameterfv)(GL_POST_COLOR_MATRIX_COLOR_TABLE, GL_COLOR_TABLE_BIAS,  &colorTableBias[2][0]);
+    if (enables)
+    {
+      transitionEnable(dt,GL_CONVOLUTION_1D,current.convolution1d,convolution1d);
+      transitionEnable(dt,GL_CONVOLUTION_2D,current.convolution2d,convolution2d);
+      transitionEnable(dt,GL_SEPARABLE_2D,current.separable2d,separable2d);
+    }
+    if (!arrayEqual(current.convolutionBorderColor[0],convolutionBorderColor[0]))
+      dt.call(&dt.glConvolutionParameterfv)(GL_CONVOLUTION_1D, GL_CONVOLUTION_BORDER_COLOR, &convolutionBorderColor[0][0]);
+    if (current.convolutionBorderMode[0] != convolutionBorderMode[0])
+      dt.call(&dt.glConvolutionParameteri) (GL_CONVOLUTION_1D, GL_CONVOLUTION_BORDER_MODE,   convolutionBorderMode [0]);
+    if (!arrayEqual(current.convolutionFilterScale[0],convolutionFilterScale[0]))
+      dt.call(&dt.glConvolutionParameterfv)(GL_CONVOLUTION_1D, GL_CONVOLUTION_FILTER_SCALE, &convolutionFilterScale[0][0]);
+    if (!arrayEqual(current.convolutionFilterBias[0],convolutionFilterBias[0]))
+      dt.call(&dt.glConvolutionParameterfv)(GL_CONVOLUTION_1D, GL_CONVOLUTION_FILTER_BIAS,  &convolutionFilterBias [0][0]);
+    if (!arrayEqual(current.convolutionBorderColor[1],convolutionBorderColor[1]))
+      dt.call(&dt.glConvolutionParameterfv)(GL_CONVOLUTION_2D, GL_CONVOLUTION_BORDER_COLOR, &convolutionBorderColor[1][0]);
+    if (current.convolutionBorderMode[1] != convolutionBorderMode[1])
+      dt.call(&dt.glConvolutionParameteri) (GL_CONVOLUTION_2D, GL_CONVOLUTION_BORDER_MODE,   convolutionBorderMode [1]);
+    if (!arrayEqual(current.convolutionFilterScale[1],convolutionFilterScale[1]))
+      dt.call(&dt.glConvolutionParameterfv)(GL_CONVOLUTION_2D, GL_CONVOLUTION_FILTER_SCALE, &convolutionFilterScale[1][0]);
+    if (!arrayEqual(current.convolutionFilterBias[1],convolutionFilterBias[1]))
+      dt.call(&dt.glConvolutionParameterfv)(GL_CONVOLUTION_2D, GL_CONVOLUTION_FILTER_BIAS,  &convolutionFilterBias [1][0]);
+    if (!arrayEqual(current.convolutionBorderColor[2],convolutionBorderColor[2]))
+      dt.call(&dt.glConvolutionParameterfv)(GL_SEPARABLE_2D,   GL_CONVOLUTION_BORDER_COLOR, &convolutionBorderColor[2][0]);
+    if (current.convolutionBorderMode[2] != convolutionBorderMode[2])
+      dt.call(&dt.glConvolutionParameteri) (GL_SEPARABLE_2D,   GL_CONVOLUTION_BORDER_MODE,   convolutionBorderMode [2]);
+    if (!arrayEqual(current.convolutionFilterScale[2],convolutionFilterScale[2]))
+      dt.call(&dt.glConvolutionParameterfv)(GL_SEPARABLE_2D,   GL_CONVOLUTION_FILTER_SCALE, &convolutionFilterScale[2][0]);
+    if (!arrayEqual(current.convolutionFilterBias[2],convolutionFilterBias[2]))
+      dt.call(&dt.glConvolutionParameterfv)(GL_SEPARABLE_2D,   GL_CONVOLUTION_FILTER_BIAS,  &convolutionFilterBias [2][0]);
+    if (current.postConvolutionRedScale != postConvolutionRedScale)
+      dt.call(&dt.glPixelTransferf)(GL_POST_CONVOLUTION_RED_SCALE,   postConvolutionRedScale);
+    if (current.postConvolutionRedBias != postConvolutionRedBias)
+      dt.call(&dt.glPixelTransferf)(GL_POST_CONVOLUTION_RED_BIAS,    postConvolutionRedBias);
+    if (current.postConvolutionGreenScale != postConvolutionGreenScale)
+      dt.call(&dt.glPixelTransferf)(GL_POST_CONVOLUTION_GREEN_SCALE, postConvolutionGreenScale);
+    if (current.postConvolutionGreenBias != postConvolutionGreenBias)
+      dt.call(&dt.glPixelTransferf)(GL_POST_CONVOLUTION_GREEN_BIAS,  postConvolutionGreenBias);
+    if (current.postConvolutionBlueScale != postConvolutionBlueScale)
+      dt.call(&dt.glPixelTransferf)(GL_POST_CONVOLUTION_BLUE_SCALE,  postConvolutionBlueScale);
+    if (current.postConvolutionBlueBias != postConvolutionBlueBias)
+      dt.call(&dt.glPixelTransferf)(GL_POST_CONVOLUTION_BLUE_BIAS,   postConvolutionBlueBias);
+    if (current.postConvolutionAlphaScale != postConvolutionAlphaScale)
+      dt.call(&dt.glPixelTransferf)(GL_POST_CONVOLUTION_ALPHA_SCALE, postConvolutionAlphaScale);
+    if (current.postConvolutionAlphaBias != postConvolutionAlphaBias)
+      dt.call(&dt.glPixelTransferf)(GL_POST_CONVOLUTION_ALPHA_BIAS,  postConvolutionAlphaBias);
+    if (current.postColorMatrixRedScale != postColorMatrixRedScale)
+      dt.call(&dt.glPixelTransferf)(GL_POST_COLOR_MATRIX_RED_SCALE,  postColorMatrixRedScale);
+    if (current.postColorMatrixRedBias != postColorMatrixRedBias)
+      dt.call(&dt.glPixelTransferf)(GL_POST_COLOR_MATRIX_RED_BIAS,   postColorMatrixRedBias);
+    if (current.postColorMatrixGreenScale != postColorMatrixGreenScale)
+      dt.call(&dt.glPixelTransferf)(GL_POST_COLOR_MATRIX_GREEN_SCALE,postColorMatrixGreenScale);
+    if (current.postColorMatrixGreenBias != postColorMatrixGreenBias)
+      dt.call(&dt.glPixelTransferf)(GL_POST_COLOR_MATRIX_GREEN_BIAS, postColorMatrixGreenBias);
+    if (current.postColorMatrixBlueScale != postColorMatrixBlueScale)
+      dt.call(&dt.glPixelTransferf)(GL_POST_COLOR_MATRIX_BLUE_SCALE, postColorMatrixBlueScale);
+    if (current.postColorMatrixBlueBias != postColorMatrixBlueBias)
+      dt.call(&dt.glPixelTransferf)(GL_POST_COLOR_MATRIX_BLUE_BIAS,  postColorMatrixBlueBias);
+    if (current.postColorMatrixAlphaScale != postColorMatrixAlphaScale)
+      dt.call(&dt.glPixelTransferf)(GL_POST_COLOR_MATRIX_ALPHA_SCALE,postColorMatrixAlphaScale);
+    if (current.postColorMatrixAlphaBias != postColorMatrixAlphaBias)
+      dt.call(&dt.glPixelTransferf)(GL_POST_COLOR_MATRIX_ALPHA_BIAS, postColorMatrixAlphaBias);
+    if (enables)
+    {
+      transitionEnable(dt,GL_HISTOGRAM,current.histogram,histogram);
+      transitionEnable(dt,GL_MINMAX,current.minmax,minmax);
+    }
+    if (current.zoomX != zoomX || current.zoomY != zoomY)
+      dt.call(&dt.glPixelZoom)(zoomX,zoomY);
+    return *this;
+  }
+
   inline std::string toString(const char *delim = "\n") const
   {
     string_list tmp;
@@ -3611,6 +4208,23 @@ struct LightingFace
     return *this;
   }
 
+  inline const LightingFace &transition(DispatchTableGL &dt, GLenum face, LightingFace &current) const
+  {
+    if (!arrayEqual(current.ambient,ambient))
+      dt.call(&dt.glMaterialfv)(face, GL_AMBIENT,       ambient);
+    if (!arrayEqual(current.diffuse,diffuse))
+      dt.call(&dt.glMaterialfv)(face, GL_DIFFUSE,       diffuse);
+    if (!arrayEqual(current.specular,specular))
+      dt.call(&dt.glMaterialfv)(face, GL_SPECULAR,      specular);
+    if (!arrayEqual(current.emission,emission))
+      dt.call(&dt.glMaterialfv)(face, GL_EMISSION,      emission);
+    if (current.shininess != shininess)
+      dt.call(&dt.glMaterialf )(face, GL_SHININESS,     shininess);
+    if (!arrayEqual(current.colorIndexes,colorIndexes))
+      dt.call(&dt.glMaterialfv)(face, GL_COLOR_INDEXES, colorIndexes);
+    return *this;
+  }
+
   inline std::string toString(GLenum face,const char *delim = "\n") const
   {
     string_list tmp;
@@ -3724,6 +4338,33 @@ struct LightingLight
     return *this;
   }
 
+  inline const LightingLight &transition(DispatchTableGL &dt, GLenum light, LightingLight &current, const bool enables = true) const
+  {
+    if (enables)
+      transitionEnable(dt,light,current.enabled,enabled);
+    if (!arrayEqual(current.ambient,ambient))
+      dt.call(&dt.glLightfv)(light, GL_AMBIENT,               ambient);
+    if (!arrayEqual(current.diffuse,diffuse))
+      dt.call(&dt.glLightfv)(light, GL_DIFFUSE,               diffuse);
+    if (!arrayEqual(current.specular,specular))
+      dt.call(&dt.glLightfv)(light, GL_SPECULAR,              specular);
+    if (!arrayEqual(current.position,position))
+      dt.call(&dt.glLightfv)(light, GL_POSITION,              position);
+    if (current.constantAttenuation != constantAttenuation)
+      dt.call(&dt.glLightf )(light, GL_CONSTANT_ATTENUATION,  constantAttenuation);
+    if (current.linearAttenuation != linearAttenuation)
+      dt.call(&dt.glLightf )(light, GL_LINEAR_ATTENUATION,    linearAttenuation);
+    if (current.quadraticAttenuation != quadraticAttenuation)
+      dt.call(&dt.glLightf )(light, GL_QUADRATIC_ATTENUATION, quadraticAttenuation);
+    if (!arrayEqual(current.spotDirection,spotDirection))
+      dt.call(&dt.glLightfv)(light, GL_SPOT_DIRECTION,        spotDirection);
+    if (current.spotExponent != spotExponent)
+      dt.call(&dt.glLightf )(light, GL_SPOT_EXPONENT,         spotExponent);
+    if (current.spotCutoff != spotCutoff)
+      dt.call(&dt.glLightf )(light, GL_SPOT_CUTOFF,           spotCutoff);
+    return *this;
+  }
+
   void toString(string_list &tmp, GLenum light, const char *delim = "\n") const
   {
     tmp << print_string(enabled ? "glEnable(" : "glDisable(",Token::toString(light),");",delim);
@@ -3866,6 +4507,40 @@ struct Lighting
     return *this;
   }
 
+  const Lighting &transition(DispatchTableGL &dt, Lighting &current, const bool enables = true) const
+  {
+    if (current.shadeModel != shadeModel)
+      dt.call(&dt.glShadeModel)(shadeModel);
+    if (current.clampVertexColor != clampVertexColor)
+      dt.call(&dt.glClampColor)(GL_CLAMP_VERTEX_COLOR,clampVertexColor);
+    if (current.provokingVertex != provokingVertex)
+      dt.call(&dt.glProvokingVertex)(provokingVertex);
+    if (enables)
+    {
+      transitionEnable(dt,GL_LIGHTING,current.lighting,lighting);
+      transitionEnable(dt,GL_COLOR_MATERIAL,current.colorMaterial,colorMaterial);
+    }
+    if (current.colorMaterialFace != colorMaterialFace || current.colorMaterialParameter != colorMaterialParameter)
+      dt.call(&dt.glColorMaterial)(colorMaterialFace,colorMaterialParameter);
+    front.transition(dt,GL_FRONT,current.front);
+    back.transition(dt,GL_BACK,current.back);
+    if (!arrayEqual(current.lightModelAmbient,lightModelAmbient))
+      dt.call(&dt.glLightModelfv)(GL_LIGHT_MODEL_AMBIENT,lightModelAmbient);
+    if (current.lightModelLocalViewer != lightModelLocalViewer)
+      dt.call(&dt.glLightModeli)(GL_LIGHT_MODEL_LOCAL_VIEWER,lightModelLocalViewer);
+    if (current.lightModelTwoSide != lightModelTwoSide)
+      dt.call(&dt.glLightModeli)(GL_LIGHT_MODEL_TWO_SIDE,lightModelTwoSide);
+    if (current.lightModelColorControl != lightModelColorControl)
+      dt.call(&dt.glLightModeli)(GL_LIGHT_MODEL_COLOR_CONTROL,lightModelColorControl);
+    size_t n = array_size( lights );
+    for (size_t ii=0; ii<n; ii++)
+    {
+      RegalAssertArrayIndex( lights, ii );
+      lights[ii].transition(dt,static_cast<GLenum>(GL_LIGHT0+ii),current.lights[ii],enables);
+    }
+    return *this;
+  }
+
   std::string toString(const char *delim = "\n") const
   {
     string_list tmp;
@@ -52,10 +52,13 @@ REGAL_GLOBAL_BEGIN
 
 #include <boost/print/interface.hpp>
 #include <boost/print/string_list.hpp>
+#include <boost/print/json.hpp>
 using namespace boost::print;
 
 #include "RegalToken.h"
+#include "RegalConfig.h"
 #include "RegalContext.h"
+#include "RegalCallTiming.h"
 
 REGAL_GLOBAL_END
 
@@ -64,21 +67,31 @@ REGAL_NAMESPACE_BEGIN
 using namespace ::REGAL_NAMESPACE_INTERNAL::Logging;
 using namespace ::REGAL_NAMESPACE_INTERNAL::Token;
 
+namespace Json { struct Output : public ::boost::print::json::output<std::string> {}; }
+
 Statistics::Statistics()
 {
    Internal("Statistics::Statistics","()");
+   timing = NULL;
    reset();
+   if (Config::dispatchTiming)
+     timing = new CallTiming();
 }
 
 Statistics::~Statistics()
 {
    Internal("Statistics::~Statistics","()");
+   delete timing;
 }
 
+// Timing is kept, it is reset per frame instead
+
 void
 Statistics::reset()
 {
+  CallTiming *tmp = timing;
   ::memset(this,0,sizeof(Statistics));
+  timing = tmp;
 }
 
 void
@@ -5262,6 +5275,5282 @@ Statistics::log() const
   log("glDisable(GL_TEXTURE_2D)",disable_GL_TEXTURE_2D);
   log("glDisable(GL_TEXTURE_CUBE_MAP_SEAMLESS)",disable_GL_TEXTURE_CUBE_MAP_SEAMLESS);
 
+  log("IFF_PROGRAM_CACHE_HIT",iff_program_cache_hit);
+  log("IFF_PROGRAM_CACHE_MISS",iff_program_cache_miss);
+  log("IFF_PROGRAM_CACHE_EVICT",iff_program_cache_evict);
+  log("IFF_PROGRAM_BINARY_HIT",iff_program_binary_hit);
+  log("IFF_PROGRAM_BINARY_MISS",iff_program_binary_miss);
+  log("IFF_PROGRAM_BINARY_WRITE",iff_program_binary_write);
+  log("IFF_PROGRAM_ASYNC_COMPILE",iff_program_async_compile);
+  log("IFF_PROGRAM_UBER_DRAW",iff_program_uber_draw);
+  log("IFF_DRAW",iff_draw);
+  log("IFF_UNIFORM_CALL",iff_uniform_call);
+  log("IFF_UNIFORM_BLOCK_UPLOAD",iff_uniform_block_upload);
+  log("IFF_UNIFORM_BLOCK_BIND",iff_uniform_block_bind);
+  log("IFF_IMMEDIATE_FLUSH",iff_immediate_flush);
+  log("IFF_IMMEDIATE_RELAYOUT",iff_immediate_relayout);
+  log("IFF_IMMEDIATE_BATCH",iff_immediate_batch);
+  log("VAO_UPLOAD_CACHE_HIT",vao_upload_cache_hit);
+  log("VAO_UPLOAD_CACHE_MISS",vao_upload_cache_miss);
+
+  log("redundant_glActiveTexture",redundant_glActiveTexture);
+  log("redundant_glBindBuffer",redundant_glBindBuffer);
+  log("redundant_glBindFramebuffer",redundant_glBindFramebuffer);
+  log("redundant_glBindTexture",redundant_glBindTexture);
+  log("redundant_glBindVertexArray",redundant_glBindVertexArray);
+  log("redundant_glBlendEquation",redundant_glBlendEquation);
+  log("redundant_glBlendFunc",redundant_glBlendFunc);
+  log("redundant_glBlendFuncSeparate",redundant_glBlendFuncSeparate);
+  log("redundant_glClearColor",redundant_glClearColor);
+  log("redundant_glColorMask",redundant_glColorMask);
+  log("redundant_glCullFace",redundant_glCullFace);
+  log("redundant_glDepthFunc",redundant_glDepthFunc);
+  log("redundant_glDepthMask",redundant_glDepthMask);
+  log("redundant_glDisable",redundant_glDisable);
+  log("redundant_glEnable",redundant_glEnable);
+  log("redundant_glFrontFace",redundant_glFrontFace);
+  log("redundant_glScissor",redundant_glScissor);
+  log("redundant_glUseProgram",redundant_glUseProgram);
+  log("redundant_glViewport",redundant_glViewport);
+
+}
+
+#if !REGAL_NO_JSON
+static inline void
+jsonCount(Json::Output &jo, const char *name, const GLuint count)
+{
+  if (count)
+    jo.member(name,count);
+}
+#endif
+
+void
+Statistics::writeJSON(Json::Output &jo) const
+{
+#if !REGAL_NO_JSON
+  jo.object("statistics");
+  jsonCount(jo,"GL_VERSION_1_0",gl_version_1_0);
+  jsonCount(jo,"GL_VERSION_1_1",gl_version_1_1);
+  jsonCount(jo,"GL_VERSION_1_2",gl_version_1_2);
+  jsonCount(jo,"GL_VERSION_1_3",gl_version_1_3);
+  jsonCount(jo,"GL_VERSION_1_4",gl_version_1_4);
+  jsonCount(jo,"GL_VERSION_1_5",gl_version_1_5);
+  jsonCount(jo,"GL_VERSION_2_0",gl_version_2_0);
+  jsonCount(jo,"GL_VERSION_2_1",gl_version_2_1);
+  jsonCount(jo,"GL_VERSION_3_0",gl_version_3_0);
+  jsonCount(jo,"GL_VERSION_3_1",gl_version_3_1);
+  jsonCount(jo,"GL_VERSION_3_2",gl_version_3_2);
+  jsonCount(jo,"GL_VERSION_3_3",gl_version_3_3);
+  jsonCount(jo,"GL_VERSION_4_0",gl_version_4_0);
+  jsonCount(jo,"GL_VERSION_4_1",gl_version_4_1);
+  jsonCount(jo,"GL_VERSION_4_2",gl_version_4_2);
+  jsonCount(jo,"GL_VERSION_4_3",gl_version_4_3);
+  jsonCount(jo,"GL_VERSION_4_4",gl_version_4_4);
+  jsonCount(jo,"GL_VERSION_4_5",gl_version_4_5);
+  jsonCount(jo,"GLX_VERSION_1_0",glx_version_1_0);
+  jsonCount(jo,"GLX_VERSION_1_1",glx_version_1_1);
+  jsonCount(jo,"GLX_VERSION_1_2",glx_version_1_2);
+  jsonCount(jo,"GLX_VERSION_1_3",glx_version_1_3);
+  jsonCount(jo,"GLX_VERSION_1_4",glx_version_1_4);
+  jsonCount(jo,"EGL_VERSION_1_0",egl_version_1_0);
+  jsonCount(jo,"EGL_VERSION_1_1",egl_version_1_1);
+  jsonCount(jo,"EGL_VERSION_1_2",egl_version_1_2);
+  jsonCount(jo,"GL_3DFX_MULTISAMPLE",gl_3dfx_multisample);
+  jsonCount(jo,"GL_3DFX_TBUFFER",gl_3dfx_tbuffer);
+  jsonCount(jo,"GL_3DFX_TEXTURE_COMPRESSION_FXT1",gl_3dfx_texture_compression_fxt1);
+  jsonCount(jo,"GL_AMD_BLEND_MINMAX_FACTOR",gl_amd_blend_minmax_factor);
+  jsonCount(jo,"GL_AMD_COMPRESSED_3DC_TEXTURE",gl_amd_compressed_3dc_texture);
+  jsonCount(jo,"GL_AMD_COMPRESSED_ATC_TEXTURE",gl_amd_compressed_atc_texture);
+  jsonCount(jo,"GL_AMD_DEBUG_OUTPUT",gl_amd_debug_output);
+  jsonCount(jo,"GL_AMD_DEPTH_CLAMP_SEPARATE",gl_amd_depth_clamp_separate);
+  jsonCount(jo,"GL_AMD_DRAW_BUFFERS_BLEND",gl_amd_draw_buffers_blend);
+  jsonCount(jo,"GL_AMD_INTERLEAVED_ELEMENTS",gl_amd_interleaved_elements);
+  jsonCount(jo,"GL_AMD_MULTI_DRAW_INDIRECT",gl_amd_multi_draw_indirect);
+  jsonCount(jo,"GL_AMD_NAME_GEN_DELETE",gl_amd_name_gen_delete);
+  jsonCount(jo,"GL_AMD_PERFORMANCE_MONITOR",gl_amd_performance_monitor);
+  jsonCount(jo,"GL_AMD_PINNED_MEMORY",gl_amd_pinned_memory);
+  jsonCount(jo,"GL_AMD_PROGRAM_BINARY_Z400",gl_amd_program_binary_z400);
+  jsonCount(jo,"GL_AMD_QUERY_BUFFER_OBJECT",gl_amd_query_buffer_object);
+  jsonCount(jo,"GL_AMD_SAMPLE_POSITIONS",gl_amd_sample_positions);
+  jsonCount(jo,"GL_AMD_SEAMLESS_CUBEMAP_PER_TEXTURE",gl_amd_seamless_cubemap_per_texture);
+  jsonCount(jo,"GL_AMD_SPARSE_TEXTURE",gl_amd_sparse_texture);
+  jsonCount(jo,"GL_AMD_STENCIL_OPERATION_EXTENDED",gl_amd_stencil_operation_extended);
+  jsonCount(jo,"GL_AMD_VERTEX_SHADER_TESSELLATOR",gl_amd_vertex_shader_tessellator);
+  jsonCount(jo,"GL_ANGLE_FRAMEBUFFER_BLIT",gl_angle_framebuffer_blit);
+  jsonCount(jo,"GL_ANGLE_FRAMEBUFFER_MULTISAMPLE",gl_angle_framebuffer_multisample);
+  jsonCount(jo,"GL_ANGLE_INSTANCED_ARRAYS",gl_angle_instanced_arrays);
+  jsonCount(jo,"GL_ANGLE_PACK_REVERSE_ROW_ORDER",gl_angle_pack_reverse_row_order);
+  jsonCount(jo,"GL_ANGLE_PROGRAM_BINARY",gl_angle_program_binary);
+  jsonCount(jo,"GL_ANGLE_TEXTURE_COMPRESSION_DXT1",gl_angle_texture_compression_dxt1);
+  jsonCount(jo,"GL_ANGLE_TEXTURE_COMPRESSION_DXT3",gl_angle_texture_compression_dxt3);
+  jsonCount(jo,"GL_ANGLE_TEXTURE_COMPRESSION_DXT5",gl_angle_texture_compression_dxt5);
+  jsonCount(jo,"GL_ANGLE_TEXTURE_USAGE",gl_angle_texture_usage);
+  jsonCount(jo,"GL_ANGLE_TIMER_QUERY",gl_angle_timer_query);
+  jsonCount(jo,"GL_ANGLE_TRANSLATED_SHADER_SOURCE",gl_angle_translated_shader_source);
+  jsonCount(jo,"GL_APPLE_AUX_DEPTH_STENCIL",gl_apple_aux_depth_stencil);
+  jsonCount(jo,"GL_APPLE_CLIENT_STORAGE",gl_apple_client_storage);
+  jsonCount(jo,"GL_APPLE_COPY_TEXTURE_LEVELS",gl_apple_copy_texture_levels);
+  jsonCount(jo,"GL_APPLE_ELEMENT_ARRAY",gl_apple_element_array);
+  jsonCount(jo,"GL_APPLE_FENCE",gl_apple_fence);
+  jsonCount(jo,"GL_APPLE_FLOAT_PIXELS",gl_apple_float_pixels);
+  jsonCount(jo,"GL_APPLE_FLUSH_BUFFER_RANGE",gl_apple_flush_buffer_range);
+  jsonCount(jo,"GL_APPLE_FLUSH_RENDER",gl_apple_flush_render);
+  jsonCount(jo,"GL_APPLE_FRAMEBUFFER_MULTISAMPLE",gl_apple_framebuffer_multisample);
+  jsonCount(jo,"GL_APPLE_OBJECT_PURGEABLE",gl_apple_object_purgeable);
+  jsonCount(jo,"GL_APPLE_PIXEL_BUFFER",gl_apple_pixel_buffer);
+  jsonCount(jo,"GL_APPLE_RGB_422",gl_apple_rgb_422);
+  jsonCount(jo,"GL_APPLE_ROW_BYTES",gl_apple_row_bytes);
+  jsonCount(jo,"GL_APPLE_SPECULAR_VECTOR",gl_apple_specular_vector);
+  jsonCount(jo,"GL_APPLE_SYNC",gl_apple_sync);
+  jsonCount(jo,"GL_APPLE_TEXTURE_MAX_LEVEL",gl_apple_texture_max_level);
+  jsonCount(jo,"GL_APPLE_TEXTURE_RANGE",gl_apple_texture_range);
+  jsonCount(jo,"GL_APPLE_TRANSFORM_HINT",gl_apple_transform_hint);
+  jsonCount(jo,"GL_APPLE_VERTEX_ARRAY_OBJECT",gl_apple_vertex_array_object);
+  jsonCount(jo,"GL_APPLE_VERTEX_ARRAY_RANGE",gl_apple_vertex_array_range);
+  jsonCount(jo,"GL_APPLE_VERTEX_PROGRAM_EVALUATORS",gl_apple_vertex_program_evaluators);
+  jsonCount(jo,"GL_APPLE_YCBCR_422",gl_apple_ycbcr_422);
+  jsonCount(jo,"GL_ARB_ES2_COMPATIBILITY",gl_arb_es2_compatibility);
+  jsonCount(jo,"GL_ARB_ES3_1_COMPATIBILITY",gl_arb_es3_1_compatibility);
+  jsonCount(jo,"GL_ARB_ES3_COMPATIBILITY",gl_arb_es3_compatibility);
+  jsonCount(jo,"GL_ARB_BASE_INSTANCE",gl_arb_base_instance);
+  jsonCount(jo,"GL_ARB_BINDLESS_TEXTURE",gl_arb_bindless_texture);
+  jsonCount(jo,"GL_ARB_BLEND_FUNC_EXTENDED",gl_arb_blend_func_extended);
+  jsonCount(jo,"GL_ARB_BUFFER_STORAGE",gl_arb_buffer_storage);
+  jsonCount(jo,"GL_ARB_CL_EVENT",gl_arb_cl_event);
+  jsonCount(jo,"GL_ARB_CLEAR_BUFFER_OBJECT",gl_arb_clear_buffer_object);
+  jsonCount(jo,"GL_ARB_CLEAR_TEXTURE",gl_arb_clear_texture);
+  jsonCount(jo,"GL_ARB_CLIP_CONTROL",gl_arb_clip_control);
+  jsonCount(jo,"GL_ARB_COLOR_BUFFER_FLOAT",gl_arb_color_buffer_float);
+  jsonCount(jo,"GL_ARB_COMPRESSED_TEXTURE_PIXEL_STORAGE",gl_arb_compressed_texture_pixel_storage);
+  jsonCount(jo,"GL_ARB_COMPUTE_SHADER",gl_arb_compute_shader);
+  jsonCount(jo,"GL_ARB_COMPUTE_VARIABLE_GROUP_SIZE",gl_arb_compute_variable_group_size);
+  jsonCount(jo,"GL_ARB_CONDITIONAL_RENDER_INVERTED",gl_arb_conditional_render_inverted);
+  jsonCount(jo,"GL_ARB_COPY_BUFFER",gl_arb_copy_buffer);
+  jsonCount(jo,"GL_ARB_COPY_IMAGE",gl_arb_copy_image);
+  jsonCount(jo,"GL_ARB_CULL_DISTANCE",gl_arb_cull_distance);
+  jsonCount(jo,"GL_ARB_DEBUG_OUTPUT",gl_arb_debug_output);
+  jsonCount(jo,"GL_ARB_DEPTH_BUFFER_FLOAT",gl_arb_depth_buffer_float);
+  jsonCount(jo,"GL_ARB_DEPTH_CLAMP",gl_arb_depth_clamp);
+  jsonCount(jo,"GL_ARB_DEPTH_TEXTURE",gl_arb_depth_texture);
+  jsonCount(jo,"GL_ARB_DIRECT_STATE_ACCESS",gl_arb_direct_state_access);
+  jsonCount(jo,"GL_ARB_DRAW_BUFFERS",gl_arb_draw_buffers);
+  jsonCount(jo,"GL_ARB_DRAW_BUFFERS_BLEND",gl_arb_draw_buffers_blend);
+  jsonCount(jo,"GL_ARB_DRAW_ELEMENTS_BASE_VERTEX",gl_arb_draw_elements_base_vertex);
+  jsonCount(jo,"GL_ARB_DRAW_INDIRECT",gl_arb_draw_indirect);
+  jsonCount(jo,"GL_ARB_DRAW_INSTANCED",gl_arb_draw_instanced);
+  jsonCount(jo,"GL_ARB_ENHANCED_LAYOUTS",gl_arb_enhanced_layouts);
+  jsonCount(jo,"GL_ARB_EXPLICIT_UNIFORM_LOCATION",gl_arb_explicit_uniform_location);
+  jsonCount(jo,"GL_ARB_FRAGMENT_PROGRAM",gl_arb_fragment_program);
+  jsonCount(jo,"GL_ARB_FRAGMENT_SHADER",gl_arb_fragment_shader);
+  jsonCount(jo,"GL_ARB_FRAMEBUFFER_NO_ATTACHMENTS",gl_arb_framebuffer_no_attachments);
+  jsonCount(jo,"GL_ARB_FRAMEBUFFER_OBJECT",gl_arb_framebuffer_object);
+  jsonCount(jo,"GL_ARB_FRAMEBUFFER_SRGB",gl_arb_framebuffer_srgb);
+  jsonCount(jo,"GL_ARB_GEOMETRY_SHADER4",gl_arb_geometry_shader4);
+  jsonCount(jo,"GL_ARB_GET_PROGRAM_BINARY",gl_arb_get_program_binary);
+  jsonCount(jo,"GL_ARB_GET_TEXTURE_SUB_IMAGE",gl_arb_get_texture_sub_image);
+  jsonCount(jo,"GL_ARB_GPU_SHADER5",gl_arb_gpu_shader5);
+  jsonCount(jo,"GL_ARB_GPU_SHADER_FP64",gl_arb_gpu_shader_fp64);
+  jsonCount(jo,"GL_ARB_HALF_FLOAT_PIXEL",gl_arb_half_float_pixel);
+  jsonCount(jo,"GL_ARB_HALF_FLOAT_VERTEX",gl_arb_half_float_vertex);
+  jsonCount(jo,"GL_ARB_IMAGING",gl_arb_imaging);
+  jsonCount(jo,"GL_ARB_INDIRECT_PARAMETERS",gl_arb_indirect_parameters);
+  jsonCount(jo,"GL_ARB_INSTANCED_ARRAYS",gl_arb_instanced_arrays);
+  jsonCount(jo,"GL_ARB_INTERNALFORMAT_QUERY",gl_arb_internalformat_query);
+  jsonCount(jo,"GL_ARB_INTERNALFORMAT_QUERY2",gl_arb_internalformat_query2);
+  jsonCount(jo,"GL_ARB_INVALIDATE_SUBDATA",gl_arb_invalidate_subdata);
+  jsonCount(jo,"GL_ARB_MAP_BUFFER_ALIGNMENT",gl_arb_map_buffer_alignment);
+  jsonCount(jo,"GL_ARB_MAP_BUFFER_RANGE",gl_arb_map_buffer_range);
+  jsonCount(jo,"GL_ARB_MATRIX_PALETTE",gl_arb_matrix_palette);
+  jsonCount(jo,"GL_ARB_MULTI_BIND",gl_arb_multi_bind);
+  jsonCount(jo,"GL_ARB_MULTI_DRAW_INDIRECT",gl_arb_multi_draw_indirect);
+  jsonCount(jo,"GL_ARB_MULTISAMPLE",gl_arb_multisample);
+  jsonCount(jo,"GL_ARB_MULTITEXTURE",gl_arb_multitexture);
+  jsonCount(jo,"GL_ARB_OCCLUSION_QUERY",gl_arb_occlusion_query);
+  jsonCount(jo,"GL_ARB_OCCLUSION_QUERY2",gl_arb_occlusion_query2);
+  jsonCount(jo,"GL_ARB_PIPELINE_STATISTICS_QUERY",gl_arb_pipeline_statistics_query);
+  jsonCount(jo,"GL_ARB_PIXEL_BUFFER_OBJECT",gl_arb_pixel_buffer_object);
+  jsonCount(jo,"GL_ARB_POINT_PARAMETERS",gl_arb_point_parameters);
+  jsonCount(jo,"GL_ARB_POINT_SPRITE",gl_arb_point_sprite);
+  jsonCount(jo,"GL_ARB_PROGRAM_INTERFACE_QUERY",gl_arb_program_interface_query);
+  jsonCount(jo,"GL_ARB_PROVOKING_VERTEX",gl_arb_provoking_vertex);
+  jsonCount(jo,"GL_ARB_QUERY_BUFFER_OBJECT",gl_arb_query_buffer_object);
+  jsonCount(jo,"GL_ARB_ROBUSTNESS",gl_arb_robustness);
+  jsonCount(jo,"GL_ARB_SAMPLE_SHADING",gl_arb_sample_shading);
+  jsonCount(jo,"GL_ARB_SAMPLER_OBJECTS",gl_arb_sampler_objects);
+  jsonCount(jo,"GL_ARB_SEAMLESS_CUBE_MAP",gl_arb_seamless_cube_map);
+  jsonCount(jo,"GL_ARB_SEPARATE_SHADER_OBJECTS",gl_arb_separate_shader_objects);
+  jsonCount(jo,"GL_ARB_SHADER_ATOMIC_COUNTERS",gl_arb_shader_atomic_counters);
+  jsonCount(jo,"GL_ARB_SHADER_IMAGE_LOAD_STORE",gl_arb_shader_image_load_store);
+  jsonCount(jo,"GL_ARB_SHADER_OBJECTS",gl_arb_shader_objects);
+  jsonCount(jo,"GL_ARB_SHADER_STORAGE_BUFFER_OBJECT",gl_arb_shader_storage_buffer_object);
+  jsonCount(jo,"GL_ARB_SHADER_SUBROUTINE",gl_arb_shader_subroutine);
+  jsonCount(jo,"GL_ARB_SHADING_LANGUAGE_100",gl_arb_shading_language_100);
+  jsonCount(jo,"GL_ARB_SHADING_LANGUAGE_INCLUDE",gl_arb_shading_language_include);
+  jsonCount(jo,"GL_ARB_SHADOW",gl_arb_shadow);
+  jsonCount(jo,"GL_ARB_SHADOW_AMBIENT",gl_arb_shadow_ambient);
+  jsonCount(jo,"GL_ARB_SPARSE_BUFFER",gl_arb_sparse_buffer);
+  jsonCount(jo,"GL_ARB_SPARSE_TEXTURE",gl_arb_sparse_texture);
+  jsonCount(jo,"GL_ARB_STENCIL_TEXTURING",gl_arb_stencil_texturing);
+  jsonCount(jo,"GL_ARB_SYNC",gl_arb_sync);
+  jsonCount(jo,"GL_ARB_TESSELLATION_SHADER",gl_arb_tessellation_shader);
+  jsonCount(jo,"GL_ARB_TEXTURE_BARRIER",gl_arb_texture_barrier);
+  jsonCount(jo,"GL_ARB_TEXTURE_BORDER_CLAMP",gl_arb_texture_border_clamp);
+  jsonCount(jo,"GL_ARB_TEXTURE_BUFFER_OBJECT",gl_arb_texture_buffer_object);
+  jsonCount(jo,"GL_ARB_TEXTURE_BUFFER_RANGE",gl_arb_texture_buffer_range);
+  jsonCount(jo,"GL_ARB_TEXTURE_COMPRESSION",gl_arb_texture_compression);
+  jsonCount(jo,"GL_ARB_TEXTURE_COMPRESSION_BPTC",gl_arb_texture_compression_bptc);
+  jsonCount(jo,"GL_ARB_TEXTURE_COMPRESSION_RGTC",gl_arb_texture_compression_rgtc);
+  jsonCount(jo,"GL_ARB_TEXTURE_CUBE_MAP",gl_arb_texture_cube_map);
+  jsonCount(jo,"GL_ARB_TEXTURE_CUBE_MAP_ARRAY",gl_arb_texture_cube_map_array);
+  jsonCount(jo,"GL_ARB_TEXTURE_ENV_COMBINE",gl_arb_texture_env_combine);
+  jsonCount(jo,"GL_ARB_TEXTURE_ENV_DOT3",gl_arb_texture_env_dot3);
+  jsonCount(jo,"GL_ARB_TEXTURE_FLOAT",gl_arb_texture_float);
+  jsonCount(jo,"GL_ARB_TEXTURE_GATHER",gl_arb_texture_gather);
+  jsonCount(jo,"GL_ARB_TEXTURE_MIRROR_CLAMP_TO_EDGE",gl_arb_texture_mirror_clamp_to_edge);
+  jsonCount(jo,"GL_ARB_TEXTURE_MIRRORED_REPEAT",gl_arb_texture_mirrored_repeat);
+  jsonCount(jo,"GL_ARB_TEXTURE_MULTISAMPLE",gl_arb_texture_multisample);
+  jsonCount(jo,"GL_ARB_TEXTURE_RECTANGLE",gl_arb_texture_rectangle);
+  jsonCount(jo,"GL_ARB_TEXTURE_RG",gl_arb_texture_rg);
+  jsonCount(jo,"GL_ARB_TEXTURE_RGB10_A2UI",gl_arb_texture_rgb10_a2ui);
+  jsonCount(jo,"GL_ARB_TEXTURE_STORAGE",gl_arb_texture_storage);
+  jsonCount(jo,"GL_ARB_TEXTURE_STORAGE_MULTISAMPLE",gl_arb_texture_storage_multisample);
+  jsonCount(jo,"GL_ARB_TEXTURE_SWIZZLE",gl_arb_texture_swizzle);
+  jsonCount(jo,"GL_ARB_TEXTURE_VIEW",gl_arb_texture_view);
+  jsonCount(jo,"GL_ARB_TIMER_QUERY",gl_arb_timer_query);
+  jsonCount(jo,"GL_ARB_TRANSFORM_FEEDBACK2",gl_arb_transform_feedback2);
+  jsonCount(jo,"GL_ARB_TRANSFORM_FEEDBACK3",gl_arb_transform_feedback3);
+  jsonCount(jo,"GL_ARB_TRANSFORM_FEEDBACK_INSTANCED",gl_arb_transform_feedback_instanced);
+  jsonCount(jo,"GL_ARB_TRANSFORM_FEEDBACK_OVERFLOW_QUERY",gl_arb_transform_feedback_overflow_query);
+  jsonCount(jo,"GL_ARB_TRANSPOSE_MATRIX",gl_arb_transpose_matrix);
+  jsonCount(jo,"GL_ARB_UNIFORM_BUFFER_OBJECT",gl_arb_uniform_buffer_object);
+  jsonCount(jo,"GL_ARB_VERTEX_ARRAY_OBJECT",gl_arb_vertex_array_object);
+  jsonCount(jo,"GL_ARB_VERTEX_ATTRIB_64BIT",gl_arb_vertex_attrib_64bit);
+  jsonCount(jo,"GL_ARB_VERTEX_ATTRIB_BINDING",gl_arb_vertex_attrib_binding);
+  jsonCount(jo,"GL_ARB_VERTEX_BLEND",gl_arb_vertex_blend);
+  jsonCount(jo,"GL_ARB_VERTEX_BUFFER_OBJECT",gl_arb_vertex_buffer_object);
+  jsonCount(jo,"GL_ARB_VERTEX_PROGRAM",gl_arb_vertex_program);
+  jsonCount(jo,"GL_ARB_VERTEX_SHADER",gl_arb_vertex_shader);
+  jsonCount(jo,"GL_ARB_VERTEX_TYPE_2_10_10_10_REV",gl_arb_vertex_type_2_10_10_10_rev);
+  jsonCount(jo,"GL_ARB_VIEWPORT_ARRAY",gl_arb_viewport_array);
+  jsonCount(jo,"GL_ARB_WINDOW_POS",gl_arb_window_pos);
+  jsonCount(jo,"GL_ARM_MALI_PROGRAM_BINARY",gl_arm_mali_program_binary);
+  jsonCount(jo,"GL_ARM_MALI_SHADER_BINARY",gl_arm_mali_shader_binary);
+  jsonCount(jo,"GL_ATI_DRAW_BUFFERS",gl_ati_draw_buffers);
+  jsonCount(jo,"GL_ATI_ELEMENT_ARRAY",gl_ati_element_array);
+  jsonCount(jo,"GL_ATI_ENVMAP_BUMPMAP",gl_ati_envmap_bumpmap);
+  jsonCount(jo,"GL_ATI_FRAGMENT_SHADER",gl_ati_fragment_shader);
+  jsonCount(jo,"GL_ATI_MAP_OBJECT_BUFFER",gl_ati_map_object_buffer);
+  jsonCount(jo,"GL_ATI_MEMINFO",gl_ati_meminfo);
+  jsonCount(jo,"GL_ATI_PN_TRIANGLES",gl_ati_pn_triangles);
+  jsonCount(jo,"GL_ATI_SEPARATE_STENCIL",gl_ati_separate_stencil);
+  jsonCount(jo,"GL_ATI_TEXT_FRAGMENT_SHADER",gl_ati_text_fragment_shader);
+  jsonCount(jo,"GL_ATI_TEXTURE_COMPRESSION_3DC",gl_ati_texture_compression_3dc);
+  jsonCount(jo,"GL_ATI_TEXTURE_ENV_COMBINE3",gl_ati_texture_env_combine3);
+  jsonCount(jo,"GL_ATI_TEXTURE_FLOAT",gl_ati_texture_float);
+  jsonCount(jo,"GL_ATI_TEXTURE_MIRROR_ONCE",gl_ati_texture_mirror_once);
+  jsonCount(jo,"GL_ATI_VERTEX_ARRAY_OBJECT",gl_ati_vertex_array_object);
+  jsonCount(jo,"GL_ATI_VERTEX_ATTRIB_ARRAY_OBJECT",gl_ati_vertex_attrib_array_object);
+  jsonCount(jo,"GL_ATI_VERTEX_STREAMS",gl_ati_vertex_streams);
+  jsonCount(jo,"GL_DMP_SHADER_BINARY",gl_dmp_shader_binary);
+  jsonCount(jo,"GL_EXT_422_PIXELS",gl_ext_422_pixels);
+  jsonCount(jo,"GL_EXT_CG_SHADER",gl_ext_cg_shader);
+  jsonCount(jo,"GL_EXT_ABGR",gl_ext_abgr);
+  jsonCount(jo,"GL_EXT_BGRA",gl_ext_bgra);
+  jsonCount(jo,"GL_EXT_BINDABLE_UNIFORM",gl_ext_bindable_uniform);
+  jsonCount(jo,"GL_EXT_BLEND_COLOR",gl_ext_blend_color);
+  jsonCount(jo,"GL_EXT_BLEND_EQUATION_SEPARATE",gl_ext_blend_equation_separate);
+  jsonCount(jo,"GL_EXT_BLEND_FUNC_SEPARATE",gl_ext_blend_func_separate);
+  jsonCount(jo,"GL_EXT_BLEND_MINMAX",gl_ext_blend_minmax);
+  jsonCount(jo,"GL_EXT_BLEND_SUBTRACT",gl_ext_blend_subtract);
+  jsonCount(jo,"GL_EXT_CLIP_VOLUME_HINT",gl_ext_clip_volume_hint);
+  jsonCount(jo,"GL_EXT_CMYKA",gl_ext_cmyka);
+  jsonCount(jo,"GL_EXT_COLOR_BUFFER_HALF_FLOAT",gl_ext_color_buffer_half_float);
+  jsonCount(jo,"GL_EXT_COLOR_SUBTABLE",gl_ext_color_subtable);
+  jsonCount(jo,"GL_EXT_COMPILED_VERTEX_ARRAY",gl_ext_compiled_vertex_array);
+  jsonCount(jo,"GL_EXT_CONVOLUTION",gl_ext_convolution);
+  jsonCount(jo,"GL_EXT_COORDINATE_FRAME",gl_ext_coordinate_frame);
+  jsonCount(jo,"GL_EXT_COPY_TEXTURE",gl_ext_copy_texture);
+  jsonCount(jo,"GL_EXT_CULL_VERTEX",gl_ext_cull_vertex);
+  jsonCount(jo,"GL_EXT_DEBUG_LABEL",gl_ext_debug_label);
+  jsonCount(jo,"GL_EXT_DEBUG_MARKER",gl_ext_debug_marker);
+  jsonCount(jo,"GL_EXT_DEPTH_BOUNDS_TEST",gl_ext_depth_bounds_test);
+  jsonCount(jo,"GL_EXT_DIRECT_STATE_ACCESS",gl_ext_direct_state_access);
+  jsonCount(jo,"GL_EXT_DISCARD_FRAMEBUFFER",gl_ext_discard_framebuffer);
+  jsonCount(jo,"GL_EXT_DISJOINT_TIMER_QUERY",gl_ext_disjoint_timer_query);
+  jsonCount(jo,"GL_EXT_DRAW_BUFFERS2",gl_ext_draw_buffers2);
+  jsonCount(jo,"GL_EXT_DRAW_INSTANCED",gl_ext_draw_instanced);
+  jsonCount(jo,"GL_EXT_DRAW_RANGE_ELEMENTS",gl_ext_draw_range_elements);
+  jsonCount(jo,"GL_EXT_FOG_COORD",gl_ext_fog_coord);
+  jsonCount(jo,"GL_EXT_FRAGMENT_LIGHTING",gl_ext_fragment_lighting);
+  jsonCount(jo,"GL_EXT_FRAMEBUFFER_BLIT",gl_ext_framebuffer_blit);
+  jsonCount(jo,"GL_EXT_FRAMEBUFFER_MULTISAMPLE",gl_ext_framebuffer_multisample);
+  jsonCount(jo,"GL_EXT_FRAMEBUFFER_MULTISAMPLE_BLIT_SCALED",gl_ext_framebuffer_multisample_blit_scaled);
+  jsonCount(jo,"GL_EXT_FRAMEBUFFER_OBJECT",gl_ext_framebuffer_object);
+  jsonCount(jo,"GL_EXT_FRAMEBUFFER_SRGB",gl_ext_framebuffer_srgb);
+  jsonCount(jo,"GL_EXT_GEOMETRY_SHADER4",gl_ext_geometry_shader4);
+  jsonCount(jo,"GL_EXT_GPU_PROGRAM_PARAMETERS",gl_ext_gpu_program_parameters);
+  jsonCount(jo,"GL_EXT_GPU_SHADER4",gl_ext_gpu_shader4);
+  jsonCount(jo,"GL_EXT_HISTOGRAM",gl_ext_histogram);
+  jsonCount(jo,"GL_EXT_INDEX_FUNC",gl_ext_index_func);
+  jsonCount(jo,"GL_EXT_INDEX_MATERIAL",gl_ext_index_material);
+  jsonCount(jo,"GL_EXT_LIGHT_TEXTURE",gl_ext_light_texture);
+  jsonCount(jo,"GL_EXT_MAP_BUFFER_RANGE",gl_ext_map_buffer_range);
+  jsonCount(jo,"GL_EXT_MULTI_DRAW_ARRAYS",gl_ext_multi_draw_arrays);
+  jsonCount(jo,"GL_EXT_MULTISAMPLE",gl_ext_multisample);
+  jsonCount(jo,"GL_EXT_MULTISAMPLED_RENDER_TO_TEXTURE",gl_ext_multisampled_render_to_texture);
+  jsonCount(jo,"GL_EXT_MULTIVIEW_DRAW_BUFFERS",gl_ext_multiview_draw_buffers);
+  jsonCount(jo,"GL_EXT_OCCLUSION_QUERY_BOOLEAN",gl_ext_occlusion_query_boolean);
+  jsonCount(jo,"GL_EXT_PACKED_DEPTH_STENCIL",gl_ext_packed_depth_stencil);
+  jsonCount(jo,"GL_EXT_PACKED_FLOAT",gl_ext_packed_float);
+  jsonCount(jo,"GL_EXT_PACKED_PIXELS",gl_ext_packed_pixels);
+  jsonCount(jo,"GL_EXT_PALETTED_TEXTURE",gl_ext_paletted_texture);
+  jsonCount(jo,"GL_EXT_PIXEL_BUFFER_OBJECT",gl_ext_pixel_buffer_object);
+  jsonCount(jo,"GL_EXT_PIXEL_TRANSFORM",gl_ext_pixel_transform);
+  jsonCount(jo,"GL_EXT_POINT_PARAMETERS",gl_ext_point_parameters);
+  jsonCount(jo,"GL_EXT_POLYGON_OFFSET",gl_ext_polygon_offset);
+  jsonCount(jo,"GL_EXT_PROVOKING_VERTEX",gl_ext_provoking_vertex);
+  jsonCount(jo,"GL_EXT_READ_FORMAT_BGRA",gl_ext_read_format_bgra);
+  jsonCount(jo,"GL_EXT_RESCALE_NORMAL",gl_ext_rescale_normal);
+  jsonCount(jo,"GL_EXT_ROBUSTNESS",gl_ext_robustness);
+  jsonCount(jo,"GL_EXT_SRGB",gl_ext_srgb);
+  jsonCount(jo,"GL_EXT_SCENE_MARKER",gl_ext_scene_marker);
+  jsonCount(jo,"GL_EXT_SECONDARY_COLOR",gl_ext_secondary_color);
+  jsonCount(jo,"GL_EXT_SEPARATE_SHADER_OBJECTS",gl_ext_separate_shader_objects);
+  jsonCount(jo,"GL_EXT_SEPARATE_SPECULAR_COLOR",gl_ext_separate_specular_color);
+  jsonCount(jo,"GL_EXT_SHADER_FRAMEBUFFER_FETCH",gl_ext_shader_framebuffer_fetch);
+  jsonCount(jo,"GL_EXT_SHADER_IMAGE_LOAD_STORE",gl_ext_shader_image_load_store);
+  jsonCount(jo,"GL_EXT_SHADOW_SAMPLERS",gl_ext_shadow_samplers);
+  jsonCount(jo,"GL_EXT_SHARED_TEXTURE_PALETTE",gl_ext_shared_texture_palette);
+  jsonCount(jo,"GL_EXT_STENCIL_CLEAR_TAG",gl_ext_stencil_clear_tag);
+  jsonCount(jo,"GL_EXT_STENCIL_TWO_SIDE",gl_ext_stencil_two_side);
+  jsonCount(jo,"GL_EXT_STENCIL_WRAP",gl_ext_stencil_wrap);
+  jsonCount(jo,"GL_EXT_SUBTEXTURE",gl_ext_subtexture);
+  jsonCount(jo,"GL_EXT_TEXTURE",gl_ext_texture);
+  jsonCount(jo,"GL_EXT_TEXTURE3D",gl_ext_texture3d);
+  jsonCount(jo,"GL_EXT_TEXTURE_ARRAY",gl_ext_texture_array);
+  jsonCount(jo,"GL_EXT_TEXTURE_BUFFER_OBJECT",gl_ext_texture_buffer_object);
+  jsonCount(jo,"GL_EXT_TEXTURE_COMPRESSION_LATC",gl_ext_texture_compression_latc);
+  jsonCount(jo,"GL_EXT_TEXTURE_COMPRESSION_RGTC",gl_ext_texture_compression_rgtc);
+  jsonCount(jo,"GL_EXT_TEXTURE_COMPRESSION_S3TC",gl_ext_texture_compression_s3tc);
+  jsonCount(jo,"GL_EXT_TEXTURE_CUBE_MAP",gl_ext_texture_cube_map);
+  jsonCount(jo,"GL_EXT_TEXTURE_EDGE_CLAMP",gl_ext_texture_edge_clamp);
+  jsonCount(jo,"GL_EXT_TEXTURE_ENV_COMBINE",gl_ext_texture_env_combine);
+  jsonCount(jo,"GL_EXT_TEXTURE_ENV_DOT3",gl_ext_texture_env_dot3);
+  jsonCount(jo,"GL_EXT_TEXTURE_FILTER_ANISOTROPIC",gl_ext_texture_filter_anisotropic);
+  jsonCount(jo,"GL_EXT_TEXTURE_FORMAT_BGRA8888",gl_ext_texture_format_bgra8888);
+  jsonCount(jo,"GL_EXT_TEXTURE_INTEGER",gl_ext_texture_integer);
+  jsonCount(jo,"GL_EXT_TEXTURE_LOD_BIAS",gl_ext_texture_lod_bias);
+  jsonCount(jo,"GL_EXT_TEXTURE_MIRROR_CLAMP",gl_ext_texture_mirror_clamp);
+  jsonCount(jo,"GL_EXT_TEXTURE_OBJECT",gl_ext_texture_object);
+  jsonCount(jo,"GL_EXT_TEXTURE_PERTURB_NORMAL",gl_ext_texture_perturb_normal);
+  jsonCount(jo,"GL_EXT_TEXTURE_RECTANGLE",gl_ext_texture_rectangle);
+  jsonCount(jo,"GL_EXT_TEXTURE_RG",gl_ext_texture_rg);
+  jsonCount(jo,"GL_EXT_TEXTURE_SRGB",gl_ext_texture_srgb);
+  jsonCount(jo,"GL_EXT_TEXTURE_SRGB_DECODE",gl_ext_texture_srgb_decode);
+  jsonCount(jo,"GL_EXT_TEXTURE_SHARED_EXPONENT",gl_ext_texture_shared_exponent);
+  jsonCount(jo,"GL_EXT_TEXTURE_SNORM",gl_ext_texture_snorm);
+  jsonCount(jo,"GL_EXT_TEXTURE_STORAGE",gl_ext_texture_storage);
+  jsonCount(jo,"GL_EXT_TEXTURE_SWIZZLE",gl_ext_texture_swizzle);
+  jsonCount(jo,"GL_EXT_TEXTURE_TYPE_2_10_10_10_REV",gl_ext_texture_type_2_10_10_10_rev);
+  jsonCount(jo,"GL_EXT_TIMER_QUERY",gl_ext_timer_query);
+  jsonCount(jo,"GL_EXT_TRANSFORM_FEEDBACK",gl_ext_transform_feedback);
+  jsonCount(jo,"GL_EXT_UNPACK_SUBIMAGE",gl_ext_unpack_subimage);
+  jsonCount(jo,"GL_EXT_VERTEX_ARRAY",gl_ext_vertex_array);
+  jsonCount(jo,"GL_EXT_VERTEX_ATTRIB_64BIT",gl_ext_vertex_attrib_64bit);
+  jsonCount(jo,"GL_EXT_VERTEX_SHADER",gl_ext_vertex_shader);
+  jsonCount(jo,"GL_EXT_VERTEX_WEIGHTING",gl_ext_vertex_weighting);
+  jsonCount(jo,"GL_EXT_X11_SYNC_OBJECT",gl_ext_x11_sync_object);
+  jsonCount(jo,"GL_FJ_SHADER_BINARY_GCCSO",gl_fj_shader_binary_gccso);
+  jsonCount(jo,"GL_GREMEDY_FRAME_TERMINATOR",gl_gremedy_frame_terminator);
+  jsonCount(jo,"GL_GREMEDY_STRING_MARKER",gl_gremedy_string_marker);
+  jsonCount(jo,"GL_HP_IMAGE_TRANSFORM",gl_hp_image_transform);
+  jsonCount(jo,"GL_HP_OCCLUSION_TEST",gl_hp_occlusion_test);
+  jsonCount(jo,"GL_IBM_CULL_VERTEX",gl_ibm_cull_vertex);
+  jsonCount(jo,"GL_IBM_MULTIMODE_DRAW_ARRAYS",gl_ibm_multimode_draw_arrays);
+  jsonCount(jo,"GL_IBM_RASTERPOS_CLIP",gl_ibm_rasterpos_clip);
+  jsonCount(jo,"GL_IBM_STATIC_DATA",gl_ibm_static_data);
+  jsonCount(jo,"GL_IBM_TEXTURE_MIRRORED_REPEAT",gl_ibm_texture_mirrored_repeat);
+  jsonCount(jo,"GL_IBM_VERTEX_ARRAY_LISTS",gl_ibm_vertex_array_lists);
+  jsonCount(jo,"GL_IMG_MULTISAMPLED_RENDER_TO_TEXTURE",gl_img_multisampled_render_to_texture);
+  jsonCount(jo,"GL_IMG_PROGRAM_BINARY",gl_img_program_binary);
+  jsonCount(jo,"GL_IMG_READ_FORMAT",gl_img_read_format);
+  jsonCount(jo,"GL_IMG_SHADER_BINARY",gl_img_shader_binary);
+  jsonCount(jo,"GL_IMG_TEXTURE_COMPRESSION_PVRTC",gl_img_texture_compression_pvrtc);
+  jsonCount(jo,"GL_IMG_TEXTURE_COMPRESSION_PVRTC2",gl_img_texture_compression_pvrtc2);
+  jsonCount(jo,"GL_IMG_TEXTURE_ENV_ENHANCED_FIXED_FUNCTION",gl_img_texture_env_enhanced_fixed_function);
+  jsonCount(jo,"GL_IMG_USER_CLIP_PLANE",gl_img_user_clip_plane);
+  jsonCount(jo,"GL_INGR_BLEND_FUNC_SEPARATE",gl_ingr_blend_func_separate);
+  jsonCount(jo,"GL_INGR_COLOR_CLAMP",gl_ingr_color_clamp);
+  jsonCount(jo,"GL_INGR_INTERLACE_READ",gl_ingr_interlace_read);
+  jsonCount(jo,"GL_INTEL_MAP_TEXTURE",gl_intel_map_texture);
+  jsonCount(jo,"GL_INTEL_PARALLEL_ARRAYS",gl_intel_parallel_arrays);
+  jsonCount(jo,"GL_INTEL_TEXTURE_SCISSOR",gl_intel_texture_scissor);
+  jsonCount(jo,"GL_KHR_BLEND_EQUATION_ADVANCED",gl_khr_blend_equation_advanced);
+  jsonCount(jo,"GL_KHR_DEBUG",gl_khr_debug);
+  jsonCount(jo,"GL_KHR_ROBUSTNESS",gl_khr_robustness);
+  jsonCount(jo,"GL_KHR_TEXTURE_COMPRESSION_ASTC_LDR",gl_khr_texture_compression_astc_ldr);
+  jsonCount(jo,"GL_KTX_BUFFER_REGION",gl_ktx_buffer_region);
+  jsonCount(jo,"GL_MESAX_TEXTURE_STACK",gl_mesax_texture_stack);
+  jsonCount(jo,"GL_MESA_PACK_INVERT",gl_mesa_pack_invert);
+  jsonCount(jo,"GL_MESA_RESIZE_BUFFERS",gl_mesa_resize_buffers);
+  jsonCount(jo,"GL_MESA_WINDOW_POS",gl_mesa_window_pos);
+  jsonCount(jo,"GL_MESA_YCBCR_TEXTURE",gl_mesa_ycbcr_texture);
+  jsonCount(jo,"GL_NVX_CONDITIONAL_RENDER",gl_nvx_conditional_render);
+  jsonCount(jo,"GL_NVX_GPU_MEMORY_INFO",gl_nvx_gpu_memory_info);
+  jsonCount(jo,"GL_NV_3DVISION_SETTINGS",gl_nv_3dvision_settings);
+  jsonCount(jo,"GL_NV_BGR",gl_nv_bgr);
+  jsonCount(jo,"GL_NV_BINDLESS_TEXTURE",gl_nv_bindless_texture);
+  jsonCount(jo,"GL_NV_BLEND_EQUATION_ADVANCED",gl_nv_blend_equation_advanced);
+  jsonCount(jo,"GL_NV_BLEND_SQUARE",gl_nv_blend_square);
+  jsonCount(jo,"GL_NV_COMPUTE_PROGRAM5",gl_nv_compute_program5);
+  jsonCount(jo,"GL_NV_CONDITIONAL_RENDER",gl_nv_conditional_render);
+  jsonCount(jo,"GL_NV_COPY_BUFFER",gl_nv_copy_buffer);
+  jsonCount(jo,"GL_NV_COPY_DEPTH_TO_COLOR",gl_nv_copy_depth_to_color);
+  jsonCount(jo,"GL_NV_COPY_IMAGE",gl_nv_copy_image);
+  jsonCount(jo,"GL_NV_COVERAGE_SAMPLE",gl_nv_coverage_sample);
+  jsonCount(jo,"GL_NV_DEEP_TEXTURE3D",gl_nv_deep_texture3d);
+  jsonCount(jo,"GL_NV_DEPTH_BUFFER_FLOAT",gl_nv_depth_buffer_float);
+  jsonCount(jo,"GL_NV_DEPTH_CLAMP",gl_nv_depth_clamp);
+  jsonCount(jo,"GL_NV_DEPTH_NONLINEAR",gl_nv_depth_nonlinear);
+  jsonCount(jo,"GL_NV_DEPTH_RANGE_UNCLAMPED",gl_nv_depth_range_unclamped);
+  jsonCount(jo,"GL_NV_DRAW_BUFFERS",gl_nv_draw_buffers);
+  jsonCount(jo,"GL_NV_DRAW_TEXTURE",gl_nv_draw_texture);
+  jsonCount(jo,"GL_NV_EVALUATORS",gl_nv_evaluators);
+  jsonCount(jo,"GL_NV_EXPLICIT_MULTISAMPLE",gl_nv_explicit_multisample);
+  jsonCount(jo,"GL_NV_FBO_COLOR_ATTACHMENTS",gl_nv_fbo_color_attachments);
+  jsonCount(jo,"GL_NV_FENCE",gl_nv_fence);
+  jsonCount(jo,"GL_NV_FLOAT_BUFFER",gl_nv_float_buffer);
+  jsonCount(jo,"GL_NV_FOG_DISTANCE",gl_nv_fog_distance);
+  jsonCount(jo,"GL_NV_FRAGMENT_PROGRAM",gl_nv_fragment_program);
+  jsonCount(jo,"GL_NV_FRAGMENT_PROGRAM2",gl_nv_fragment_program2);
+  jsonCount(jo,"GL_NV_FRAMEBUFFER_BLIT",gl_nv_framebuffer_blit);
+  jsonCount(jo,"GL_NV_FRAMEBUFFER_MULTISAMPLE",gl_nv_framebuffer_multisample);
+  jsonCount(jo,"GL_NV_FRAMEBUFFER_MULTISAMPLE_COVERAGE",gl_nv_framebuffer_multisample_coverage);
+  jsonCount(jo,"GL_NV_GEOMETRY_PROGRAM4",gl_nv_geometry_program4);
+  jsonCount(jo,"GL_NV_GPU_PROGRAM4",gl_nv_gpu_program4);
+  jsonCount(jo,"GL_NV_GPU_PROGRAM5",gl_nv_gpu_program5);
+  jsonCount(jo,"GL_NV_GPU_SHADER5",gl_nv_gpu_shader5);
+  jsonCount(jo,"GL_NV_HALF_FLOAT",gl_nv_half_float);
+  jsonCount(jo,"GL_NV_INSTANCED_ARRAYS",gl_nv_instanced_arrays);
+  jsonCount(jo,"GL_NV_LIGHT_MAX_EXPONENT",gl_nv_light_max_exponent);
+  jsonCount(jo,"GL_NV_MULTISAMPLE_COVERAGE",gl_nv_multisample_coverage);
+  jsonCount(jo,"GL_NV_MULTISAMPLE_FILTER_HINT",gl_nv_multisample_filter_hint);
+  jsonCount(jo,"GL_NV_NON_SQUARE_MATRICES",gl_nv_non_square_matrices);
+  jsonCount(jo,"GL_NV_OCCLUSION_QUERY",gl_nv_occlusion_query);
+  jsonCount(jo,"GL_NV_PACK_SUBIMAGE",gl_nv_pack_subimage);
+  jsonCount(jo,"GL_NV_PACKED_DEPTH_STENCIL",gl_nv_packed_depth_stencil);
+  jsonCount(jo,"GL_NV_PACKED_FLOAT_LINEAR",gl_nv_packed_float_linear);
+  jsonCount(jo,"GL_NV_PARAMETER_BUFFER_OBJECT",gl_nv_parameter_buffer_object);
+  jsonCount(jo,"GL_NV_PATH_RENDERING",gl_nv_path_rendering);
+  jsonCount(jo,"GL_NV_PIXEL_BUFFER_OBJECT",gl_nv_pixel_buffer_object);
+  jsonCount(jo,"GL_NV_PIXEL_DATA_RANGE",gl_nv_pixel_data_range);
+  jsonCount(jo,"GL_NV_PLATFORM_BINARY",gl_nv_platform_binary);
+  jsonCount(jo,"GL_NV_POINT_SPRITE",gl_nv_point_sprite);
+  jsonCount(jo,"GL_NV_PRESENT_VIDEO",gl_nv_present_video);
+  jsonCount(jo,"GL_NV_PRIMITIVE_RESTART",gl_nv_primitive_restart);
+  jsonCount(jo,"GL_NV_READ_BUFFER",gl_nv_read_buffer);
+  jsonCount(jo,"GL_NV_READ_BUFFER_FRONT",gl_nv_read_buffer_front);
+  jsonCount(jo,"GL_NV_REGISTER_COMBINERS",gl_nv_register_combiners);
+  jsonCount(jo,"GL_NV_REGISTER_COMBINERS2",gl_nv_register_combiners2);
+  jsonCount(jo,"GL_NV_SRGB_FORMATS",gl_nv_srgb_formats);
+  jsonCount(jo,"GL_NV_SHADER_BUFFER_LOAD",gl_nv_shader_buffer_load);
+  jsonCount(jo,"GL_NV_SHADOW_SAMPLERS_ARRAY",gl_nv_shadow_samplers_array);
+  jsonCount(jo,"GL_NV_SHADOW_SAMPLERS_CUBE",gl_nv_shadow_samplers_cube);
+  jsonCount(jo,"GL_NV_TESSELLATION_PROGRAM5",gl_nv_tessellation_program5);
+  jsonCount(jo,"GL_NV_TEXGEN_EMBOSS",gl_nv_texgen_emboss);
+  jsonCount(jo,"GL_NV_TEXGEN_REFLECTION",gl_nv_texgen_reflection);
+  jsonCount(jo,"GL_NV_TEXTURE_ARRAY",gl_nv_texture_array);
+  jsonCount(jo,"GL_NV_TEXTURE_BARRIER",gl_nv_texture_barrier);
+  jsonCount(jo,"GL_NV_TEXTURE_BORDER_CLAMP",gl_nv_texture_border_clamp);
+  jsonCount(jo,"GL_NV_TEXTURE_COMPRESSION_LATC",gl_nv_texture_compression_latc);
+  jsonCount(jo,"GL_NV_TEXTURE_COMPRESSION_S3TC",gl_nv_texture_compression_s3tc);
+  jsonCount(jo,"GL_NV_TEXTURE_ENV_COMBINE4",gl_nv_texture_env_combine4);
+  jsonCount(jo,"GL_NV_TEXTURE_EXPAND_NORMAL",gl_nv_texture_expand_normal);
+  jsonCount(jo,"GL_NV_TEXTURE_MULTISAMPLE",gl_nv_texture_multisample);
+  jsonCount(jo,"GL_NV_TEXTURE_RECTANGLE",gl_nv_texture_rectangle);
+  jsonCount(jo,"GL_NV_TEXTURE_SHADER",gl_nv_texture_shader);
+  jsonCount(jo,"GL_NV_TEXTURE_SHADER2",gl_nv_texture_shader2);
+  jsonCount(jo,"GL_NV_TEXTURE_SHADER3",gl_nv_texture_shader3);
+  jsonCount(jo,"GL_NV_TRANSFORM_FEEDBACK",gl_nv_transform_feedback);
+  jsonCount(jo,"GL_NV_TRANSFORM_FEEDBACK2",gl_nv_transform_feedback2);
+  jsonCount(jo,"GL_NV_VDPAU_INTEROP",gl_nv_vdpau_interop);
+  jsonCount(jo,"GL_NV_VERTEX_ARRAY_RANGE",gl_nv_vertex_array_range);
+  jsonCount(jo,"GL_NV_VERTEX_ARRAY_RANGE2",gl_nv_vertex_array_range2);
+  jsonCount(jo,"GL_NV_VERTEX_ATTRIB_INTEGER_64BIT",gl_nv_vertex_attrib_integer_64bit);
+  jsonCount(jo,"GL_NV_VERTEX_BUFFER_UNIFIED_MEMORY",gl_nv_vertex_buffer_unified_memory);
+  jsonCount(jo,"GL_NV_VERTEX_PROGRAM",gl_nv_vertex_program);
+  jsonCount(jo,"GL_NV_VERTEX_PROGRAM2_OPTION",gl_nv_vertex_program2_option);
+  jsonCount(jo,"GL_NV_VERTEX_PROGRAM3",gl_nv_vertex_program3);
+  jsonCount(jo,"GL_NV_VERTEX_PROGRAM4",gl_nv_vertex_program4);
+  jsonCount(jo,"GL_NV_VIDEO_CAPTURE",gl_nv_video_capture);
+  jsonCount(jo,"GL_OES_EGL_IMAGE_EXTERNAL",gl_oes_egl_image_external);
+  jsonCount(jo,"GL_OES_BLEND_EQUATION_SEPARATE",gl_oes_blend_equation_separate);
+  jsonCount(jo,"GL_OES_BLEND_FUNC_SEPARATE",gl_oes_blend_func_separate);
+  jsonCount(jo,"GL_OES_BLEND_SUBTRACT",gl_oes_blend_subtract);
+  jsonCount(jo,"GL_OES_COMPRESSED_ETC1_RGB8_TEXTURE",gl_oes_compressed_etc1_rgb8_texture);
+  jsonCount(jo,"GL_OES_COMPRESSED_PALETTED_TEXTURE",gl_oes_compressed_paletted_texture);
+  jsonCount(jo,"GL_OES_DEPTH_TEXTURE",gl_oes_depth_texture);
+  jsonCount(jo,"GL_OES_DRAW_TEXTURE",gl_oes_draw_texture);
+  jsonCount(jo,"GL_OES_ELEMENT_INDEX_UINT",gl_oes_element_index_uint);
+  jsonCount(jo,"GL_OES_FBO_RENDER_MIPMAP",gl_oes_fbo_render_mipmap);
+  jsonCount(jo,"GL_OES_FRAMEBUFFER_OBJECT",gl_oes_framebuffer_object);
+  jsonCount(jo,"GL_OES_GET_PROGRAM_BINARY",gl_oes_get_program_binary);
+  jsonCount(jo,"GL_OES_MAPBUFFER",gl_oes_mapbuffer);
+  jsonCount(jo,"GL_OES_MATRIX_GET",gl_oes_matrix_get);
+  jsonCount(jo,"GL_OES_MATRIX_PALETTE",gl_oes_matrix_palette);
+  jsonCount(jo,"GL_OES_PACKED_DEPTH_STENCIL",gl_oes_packed_depth_stencil);
+  jsonCount(jo,"GL_OES_POINT_SIZE_ARRAY",gl_oes_point_size_array);
+  jsonCount(jo,"GL_OES_POINT_SPRITE",gl_oes_point_sprite);
+  jsonCount(jo,"GL_OES_READ_FORMAT",gl_oes_read_format);
+  jsonCount(jo,"GL_OES_REQUIRED_INTERNALFORMAT",gl_oes_required_internalformat);
+  jsonCount(jo,"GL_OES_RGB8_RGBA8",gl_oes_rgb8_rgba8);
+  jsonCount(jo,"GL_OES_SINGLE_PRECISION",gl_oes_single_precision);
+  jsonCount(jo,"GL_OES_STANDARD_DERIVATIVES",gl_oes_standard_derivatives);
+  jsonCount(jo,"GL_OES_STENCIL1",gl_oes_stencil1);
+  jsonCount(jo,"GL_OES_STENCIL4",gl_oes_stencil4);
+  jsonCount(jo,"GL_OES_STENCIL8",gl_oes_stencil8);
+  jsonCount(jo,"GL_OES_SURFACELESS_CONTEXT",gl_oes_surfaceless_context);
+  jsonCount(jo,"GL_OES_TEXTURE_3D",gl_oes_texture_3d);
+  jsonCount(jo,"GL_OES_TEXTURE_CUBE_MAP",gl_oes_texture_cube_map);
+  jsonCount(jo,"GL_OES_TEXTURE_MIRRORED_REPEAT",gl_oes_texture_mirrored_repeat);
+  jsonCount(jo,"GL_OES_VERTEX_ARRAY_OBJECT",gl_oes_vertex_array_object);
+  jsonCount(jo,"GL_OES_VERTEX_HALF_FLOAT",gl_oes_vertex_half_float);
+  jsonCount(jo,"GL_OES_VERTEX_TYPE_10_10_10_2",gl_oes_vertex_type_10_10_10_2);
+  jsonCount(jo,"GL_OML_INTERLACE",gl_oml_interlace);
+  jsonCount(jo,"GL_OML_RESAMPLE",gl_oml_resample);
+  jsonCount(jo,"GL_OML_SUBSAMPLE",gl_oml_subsample);
+  jsonCount(jo,"GL_PGI_MISC_HINTS",gl_pgi_misc_hints);
+  jsonCount(jo,"GL_PGI_VERTEX_HINTS",gl_pgi_vertex_hints);
+  jsonCount(jo,"GL_QCOM_ALPHA_TEST",gl_qcom_alpha_test);
+  jsonCount(jo,"GL_QCOM_BINNING_CONTROL",gl_qcom_binning_control);
+  jsonCount(jo,"GL_QCOM_DRIVER_CONTROL",gl_qcom_driver_control);
+  jsonCount(jo,"GL_QCOM_EXTENDED_GET",gl_qcom_extended_get);
+  jsonCount(jo,"GL_QCOM_EXTENDED_GET2",gl_qcom_extended_get2);
+  jsonCount(jo,"GL_QCOM_PERFMON_GLOBAL_MODE",gl_qcom_perfmon_global_mode);
+  jsonCount(jo,"GL_QCOM_TILED_RENDERING",gl_qcom_tiled_rendering);
+  jsonCount(jo,"GL_QCOM_WRITEONLY_RENDERING",gl_qcom_writeonly_rendering);
+  jsonCount(jo,"GL_REGAL_ES1_0_COMPATIBILITY",gl_regal_es1_0_compatibility);
+  jsonCount(jo,"GL_REGAL_ES1_1_COMPATIBILITY",gl_regal_es1_1_compatibility);
+  jsonCount(jo,"GL_REGAL_ENABLE",gl_regal_enable);
+  jsonCount(jo,"GL_REGAL_ERROR_STRING",gl_regal_error_string);
+  jsonCount(jo,"GL_REGAL_EXTENSION_QUERY",gl_regal_extension_query);
+  jsonCount(jo,"GL_REGAL_LOG",gl_regal_log);
+  jsonCount(jo,"GL_REGAL_PROC_ADDRESS",gl_regal_proc_address);
+  jsonCount(jo,"GL_REND_SCREEN_COORDINATES",gl_rend_screen_coordinates);
+  jsonCount(jo,"GL_S3_S3TC",gl_s3_s3tc);
+  jsonCount(jo,"GL_SGIS_COLOR_RANGE",gl_sgis_color_range);
+  jsonCount(jo,"GL_SGIS_DETAIL_TEXTURE",gl_sgis_detail_texture);
+  jsonCount(jo,"GL_SGIS_FOG_FUNCTION",gl_sgis_fog_function);
+  jsonCount(jo,"GL_SGIS_GENERATE_MIPMAP",gl_sgis_generate_mipmap);
+  jsonCount(jo,"GL_SGIS_MULTISAMPLE",gl_sgis_multisample);
+  jsonCount(jo,"GL_SGIS_PIXEL_TEXTURE",gl_sgis_pixel_texture);
+  jsonCount(jo,"GL_SGIS_POINT_LINE_TEXGEN",gl_sgis_point_line_texgen);
+  jsonCount(jo,"GL_SGIS_POINT_PARAMETERS",gl_sgis_point_parameters);
+  jsonCount(jo,"GL_SGIS_SHARPEN_TEXTURE",gl_sgis_sharpen_texture);
+  jsonCount(jo,"GL_SGIS_TEXTURE4D",gl_sgis_texture4d);
+  jsonCount(jo,"GL_SGIS_TEXTURE_BORDER_CLAMP",gl_sgis_texture_border_clamp);
+  jsonCount(jo,"GL_SGIS_TEXTURE_COLOR_MASK",gl_sgis_texture_color_mask);
+  jsonCount(jo,"GL_SGIS_TEXTURE_EDGE_CLAMP",gl_sgis_texture_edge_clamp);
+  jsonCount(jo,"GL_SGIS_TEXTURE_FILTER4",gl_sgis_texture_filter4);
+  jsonCount(jo,"GL_SGIS_TEXTURE_LOD",gl_sgis_texture_lod);
+  jsonCount(jo,"GL_SGIX_ASYNC",gl_sgix_async);
+  jsonCount(jo,"GL_SGIX_ASYNC_HISTOGRAM",gl_sgix_async_histogram);
+  jsonCount(jo,"GL_SGIX_ASYNC_PIXEL",gl_sgix_async_pixel);
+  jsonCount(jo,"GL_SGIX_BLEND_ALPHA_MINMAX",gl_sgix_blend_alpha_minmax);
+  jsonCount(jo,"GL_SGIX_CONVOLUTION_ACCURACY",gl_sgix_convolution_accuracy);
+  jsonCount(jo,"GL_SGIX_DEPTH_TEXTURE",gl_sgix_depth_texture);
+  jsonCount(jo,"GL_SGIX_FLUSH_RASTER",gl_sgix_flush_raster);
+  jsonCount(jo,"GL_SGIX_FOG_OFFSET",gl_sgix_fog_offset);
+  jsonCount(jo,"GL_SGIX_FOG_TEXTURE",gl_sgix_fog_texture);
+  jsonCount(jo,"GL_SGIX_FRAGMENT_LIGHTING",gl_sgix_fragment_lighting);
+  jsonCount(jo,"GL_SGIX_FRAMEZOOM",gl_sgix_framezoom);
+  jsonCount(jo,"GL_SGIX_IGLOO_INTERFACE",gl_sgix_igloo_interface);
+  jsonCount(jo,"GL_SGIX_INSTRUMENTS",gl_sgix_instruments);
+  jsonCount(jo,"GL_SGIX_INTERLACE",gl_sgix_interlace);
+  jsonCount(jo,"GL_SGIX_LIST_PRIORITY",gl_sgix_list_priority);
+  jsonCount(jo,"GL_SGIX_PIXEL_TEXTURE",gl_sgix_pixel_texture);
+  jsonCount(jo,"GL_SGIX_POLYNOMIAL_FFD",gl_sgix_polynomial_ffd);
+  jsonCount(jo,"GL_SGIX_REFERENCE_PLANE",gl_sgix_reference_plane);
+  jsonCount(jo,"GL_SGIX_RESAMPLE",gl_sgix_resample);
+  jsonCount(jo,"GL_SGIX_SHADOW",gl_sgix_shadow);
+  jsonCount(jo,"GL_SGIX_SHADOW_AMBIENT",gl_sgix_shadow_ambient);
+  jsonCount(jo,"GL_SGIX_SPRITE",gl_sgix_sprite);
+  jsonCount(jo,"GL_SGIX_TAG_SAMPLE_BUFFER",gl_sgix_tag_sample_buffer);
+  jsonCount(jo,"GL_SGIX_TEXTURE_COORDINATE_CLAMP",gl_sgix_texture_coordinate_clamp);
+  jsonCount(jo,"GL_SGIX_TEXTURE_MULTI_BUFFER",gl_sgix_texture_multi_buffer);
+  jsonCount(jo,"GL_SGIX_TEXTURE_RANGE",gl_sgix_texture_range);
+  jsonCount(jo,"GL_SGIX_TEXTURE_SCALE_BIAS",gl_sgix_texture_scale_bias);
+  jsonCount(jo,"GL_SGIX_VERTEX_PRECLIP",gl_sgix_vertex_preclip);
+  jsonCount(jo,"GL_SGIX_YCRCB",gl_sgix_ycrcb);
+  jsonCount(jo,"GL_SGI_COLOR_MATRIX",gl_sgi_color_matrix);
+  jsonCount(jo,"GL_SGI_COLOR_TABLE",gl_sgi_color_table);
+  jsonCount(jo,"GL_SGI_TEXTURE_COLOR_TABLE",gl_sgi_texture_color_table);
+  jsonCount(jo,"GL_SUNX_CONSTANT_DATA",gl_sunx_constant_data);
+  jsonCount(jo,"GL_SUN_CONVOLUTION_BORDER_MODES",gl_sun_convolution_border_modes);
+  jsonCount(jo,"GL_SUN_GLOBAL_ALPHA",gl_sun_global_alpha);
+  jsonCount(jo,"GL_SUN_MESH_ARRAY",gl_sun_mesh_array);
+  jsonCount(jo,"GL_SUN_READ_VIDEO_PIXELS",gl_sun_read_video_pixels);
+  jsonCount(jo,"GL_SUN_SLICE_ACCUM",gl_sun_slice_accum);
+  jsonCount(jo,"GL_SUN_TRIANGLE_LIST",gl_sun_triangle_list);
+  jsonCount(jo,"GL_SUN_VERTEX",gl_sun_vertex);
+  jsonCount(jo,"GL_VIV_SHADER_BINARY",gl_viv_shader_binary);
+  jsonCount(jo,"GL_WIN_PHONG_SHADING",gl_win_phong_shading);
+  jsonCount(jo,"GL_WIN_SPECULAR_FOG",gl_win_specular_fog);
+  jsonCount(jo,"GL_WIN_SWAP_HINT",gl_win_swap_hint);
+#if REGAL_SYS_WGL
+  jsonCount(jo,"WGL_3DL_STEREO_CONTROL",wgl_3dl_stereo_control);
+  jsonCount(jo,"WGL_AMD_GPU_ASSOCIATION",wgl_amd_gpu_association);
+  jsonCount(jo,"WGL_ARB_BUFFER_REGION",wgl_arb_buffer_region);
+  jsonCount(jo,"WGL_ARB_CREATE_CONTEXT",wgl_arb_create_context);
+  jsonCount(jo,"WGL_ARB_CREATE_CONTEXT_PROFILE",wgl_arb_create_context_profile);
+  jsonCount(jo,"WGL_ARB_CREATE_CONTEXT_ROBUSTNESS",wgl_arb_create_context_robustness);
+  jsonCount(jo,"WGL_ARB_EXTENSIONS_STRING",wgl_arb_extensions_string);
+  jsonCount(jo,"WGL_ARB_FRAMEBUFFER_SRGB",wgl_arb_framebuffer_srgb);
+  jsonCount(jo,"WGL_ARB_MAKE_CURRENT_READ",wgl_arb_make_current_read);
+  jsonCount(jo,"WGL_ARB_MULTISAMPLE",wgl_arb_multisample);
+  jsonCount(jo,"WGL_ARB_PBUFFER",wgl_arb_pbuffer);
+  jsonCount(jo,"WGL_ARB_PIXEL_FORMAT",wgl_arb_pixel_format);
+  jsonCount(jo,"WGL_ARB_PIXEL_FORMAT_FLOAT",wgl_arb_pixel_format_float);
+  jsonCount(jo,"WGL_ARB_RENDER_TEXTURE",wgl_arb_render_texture);
+  jsonCount(jo,"WGL_ARB_ROBUSTNESS_SHARE_GROUP_ISOLATION",wgl_arb_robustness_share_group_isolation);
+  jsonCount(jo,"WGL_ATI_PIXEL_FORMAT_FLOAT",wgl_ati_pixel_format_float);
+  jsonCount(jo,"WGL_ATI_RENDER_TEXTURE_RECTANGLE",wgl_ati_render_texture_rectangle);
+  jsonCount(jo,"WGL_EXT_CREATE_CONTEXT_ES2_PROFILE",wgl_ext_create_context_es2_profile);
+  jsonCount(jo,"WGL_EXT_CREATE_CONTEXT_ES_PROFILE",wgl_ext_create_context_es_profile);
+  jsonCount(jo,"WGL_EXT_DEPTH_FLOAT",wgl_ext_depth_float);
+  jsonCount(jo,"WGL_EXT_DISPLAY_COLOR_TABLE",wgl_ext_display_color_table);
+  jsonCount(jo,"WGL_EXT_EXTENSIONS_STRING",wgl_ext_extensions_string);
+  jsonCount(jo,"WGL_EXT_FRAMEBUFFER_SRGB",wgl_ext_framebuffer_srgb);
+  jsonCount(jo,"WGL_EXT_MAKE_CURRENT_READ",wgl_ext_make_current_read);
+  jsonCount(jo,"WGL_EXT_MULTISAMPLE",wgl_ext_multisample);
+  jsonCount(jo,"WGL_EXT_PBUFFER",wgl_ext_pbuffer);
+  jsonCount(jo,"WGL_EXT_PIXEL_FORMAT",wgl_ext_pixel_format);
+  jsonCount(jo,"WGL_EXT_PIXEL_FORMAT_PACKED_FLOAT",wgl_ext_pixel_format_packed_float);
+  jsonCount(jo,"WGL_EXT_SWAP_CONTROL",wgl_ext_swap_control);
+  jsonCount(jo,"WGL_GDI",wgl_gdi);
+  jsonCount(jo,"WGL_I3D_DIGITAL_VIDEO_CONTROL",wgl_i3d_digital_video_control);
+  jsonCount(jo,"WGL_I3D_GAMMA",wgl_i3d_gamma);
+  jsonCount(jo,"WGL_I3D_GENLOCK",wgl_i3d_genlock);
+  jsonCount(jo,"WGL_I3D_IMAGE_BUFFER",wgl_i3d_image_buffer);
+  jsonCount(jo,"WGL_I3D_SWAP_FRAME_LOCK",wgl_i3d_swap_frame_lock);
+  jsonCount(jo,"WGL_I3D_SWAP_FRAME_USAGE",wgl_i3d_swap_frame_usage);
+  jsonCount(jo,"WGL_NV_DX_INTEROP",wgl_nv_dx_interop);
+  jsonCount(jo,"WGL_NV_COPY_IMAGE",wgl_nv_copy_image);
+  jsonCount(jo,"WGL_NV_DELAY_BEFORE_SWAP",wgl_nv_delay_before_swap);
+  jsonCount(jo,"WGL_NV_FLOAT_BUFFER",wgl_nv_float_buffer);
+  jsonCount(jo,"WGL_NV_GPU_AFFINITY",wgl_nv_gpu_affinity);
+  jsonCount(jo,"WGL_NV_MULTISAMPLE_COVERAGE",wgl_nv_multisample_coverage);
+  jsonCount(jo,"WGL_NV_PRESENT_VIDEO",wgl_nv_present_video);
+  jsonCount(jo,"WGL_NV_RENDER_DEPTH_TEXTURE",wgl_nv_render_depth_texture);
+  jsonCount(jo,"WGL_NV_RENDER_TEXTURE_RECTANGLE",wgl_nv_render_texture_rectangle);
+  jsonCount(jo,"WGL_NV_SWAP_GROUP",wgl_nv_swap_group);
+  jsonCount(jo,"WGL_NV_VERTEX_ARRAY_RANGE",wgl_nv_vertex_array_range);
+  jsonCount(jo,"WGL_NV_VIDEO_CAPTURE",wgl_nv_video_capture);
+  jsonCount(jo,"WGL_NV_VIDEO_OUTPUT",wgl_nv_video_output);
+  jsonCount(jo,"WGL_OML_SYNC_CONTROL",wgl_oml_sync_control);
+#endif
+#if REGAL_SYS_GLX
+  jsonCount(jo,"GLX_3DFX_MULTISAMPLE",glx_3dfx_multisample);
+  jsonCount(jo,"GLX_AMD_GPU_ASSOCIATION",glx_amd_gpu_association);
+  jsonCount(jo,"GLX_ARB_CREATE_CONTEXT",glx_arb_create_context);
+  jsonCount(jo,"GLX_ARB_CREATE_CONTEXT_PROFILE",glx_arb_create_context_profile);
+  jsonCount(jo,"GLX_ARB_CREATE_CONTEXT_ROBUSTNESS",glx_arb_create_context_robustness);
+  jsonCount(jo,"GLX_ARB_FBCONFIG_FLOAT",glx_arb_fbconfig_float);
+  jsonCount(jo,"GLX_ARB_FRAMEBUFFER_SRGB",glx_arb_framebuffer_srgb);
+  jsonCount(jo,"GLX_ARB_GET_PROC_ADDRESS",glx_arb_get_proc_address);
+  jsonCount(jo,"GLX_ARB_MULTISAMPLE",glx_arb_multisample);
+  jsonCount(jo,"GLX_ARB_ROBUSTNESS_SHARE_GROUP_ISOLATION",glx_arb_robustness_share_group_isolation);
+  jsonCount(jo,"GLX_ARB_VERTEX_BUFFER_OBJECT",glx_arb_vertex_buffer_object);
+  jsonCount(jo,"GLX_ATI_PIXEL_FORMAT_FLOAT",glx_ati_pixel_format_float);
+  jsonCount(jo,"GLX_ATI_RENDER_TEXTURE",glx_ati_render_texture);
+  jsonCount(jo,"GLX_EXT_BUFFER_AGE",glx_ext_buffer_age);
+  jsonCount(jo,"GLX_EXT_CREATE_CONTEXT_ES2_PROFILE",glx_ext_create_context_es2_profile);
+  jsonCount(jo,"GLX_EXT_CREATE_CONTEXT_ES_PROFILE",glx_ext_create_context_es_profile);
+  jsonCount(jo,"GLX_EXT_FBCONFIG_PACKED_FLOAT",glx_ext_fbconfig_packed_float);
+  jsonCount(jo,"GLX_EXT_FRAMEBUFFER_SRGB",glx_ext_framebuffer_srgb);
+  jsonCount(jo,"GLX_EXT_IMPORT_CONTEXT",glx_ext_import_context);
+  jsonCount(jo,"GLX_EXT_STEREO_TREE",glx_ext_stereo_tree);
+  jsonCount(jo,"GLX_EXT_SWAP_CONTROL",glx_ext_swap_control);
+  jsonCount(jo,"GLX_EXT_SWAP_CONTROL_TEAR",glx_ext_swap_control_tear);
+  jsonCount(jo,"GLX_EXT_TEXTURE_FROM_PIXMAP",glx_ext_texture_from_pixmap);
+  jsonCount(jo,"GLX_EXT_VISUAL_INFO",glx_ext_visual_info);
+  jsonCount(jo,"GLX_EXT_VISUAL_RATING",glx_ext_visual_rating);
+  jsonCount(jo,"GLX_INTEL_SWAP_EVENT",glx_intel_swap_event);
+  jsonCount(jo,"GLX_MESA_AGP_OFFSET",glx_mesa_agp_offset);
+  jsonCount(jo,"GLX_MESA_COPY_SUB_BUFFER",glx_mesa_copy_sub_buffer);
+  jsonCount(jo,"GLX_MESA_PIXMAP_COLORMAP",glx_mesa_pixmap_colormap);
+  jsonCount(jo,"GLX_MESA_QUERY_RENDERER",glx_mesa_query_renderer);
+  jsonCount(jo,"GLX_MESA_RELEASE_BUFFERS",glx_mesa_release_buffers);
+  jsonCount(jo,"GLX_MESA_SET_3DFX_MODE",glx_mesa_set_3dfx_mode);
+  jsonCount(jo,"GLX_MESA_SWAP_CONTROL",glx_mesa_swap_control);
+  jsonCount(jo,"GLX_NV_COPY_BUFFER",glx_nv_copy_buffer);
+  jsonCount(jo,"GLX_NV_COPY_IMAGE",glx_nv_copy_image);
+  jsonCount(jo,"GLX_NV_DELAY_BEFORE_SWAP",glx_nv_delay_before_swap);
+  jsonCount(jo,"GLX_NV_FLOAT_BUFFER",glx_nv_float_buffer);
+  jsonCount(jo,"GLX_NV_MULTISAMPLE_COVERAGE",glx_nv_multisample_coverage);
+  jsonCount(jo,"GLX_NV_PRESENT_VIDEO",glx_nv_present_video);
+  jsonCount(jo,"GLX_NV_SWAP_GROUP",glx_nv_swap_group);
+  jsonCount(jo,"GLX_NV_VERTEX_ARRAY_RANGE",glx_nv_vertex_array_range);
+  jsonCount(jo,"GLX_NV_VIDEO_CAPTURE",glx_nv_video_capture);
+  jsonCount(jo,"GLX_NV_VIDEO_OUTPUT",glx_nv_video_output);
+  jsonCount(jo,"GLX_OML_SWAP_METHOD",glx_oml_swap_method);
+  jsonCount(jo,"GLX_OML_SYNC_CONTROL",glx_oml_sync_control);
+  jsonCount(jo,"GLX_SGIS_BLENDED_OVERLAY",glx_sgis_blended_overlay);
+  jsonCount(jo,"GLX_SGIS_COLOR_RANGE",glx_sgis_color_range);
+  jsonCount(jo,"GLX_SGIS_MULTISAMPLE",glx_sgis_multisample);
+  jsonCount(jo,"GLX_SGIS_SHARED_MULTISAMPLE",glx_sgis_shared_multisample);
+  jsonCount(jo,"GLX_SGIX_FBCONFIG",glx_sgix_fbconfig);
+  jsonCount(jo,"GLX_SGIX_HYPERPIPE",glx_sgix_hyperpipe);
+  jsonCount(jo,"GLX_SGIX_PBUFFER",glx_sgix_pbuffer);
+  jsonCount(jo,"GLX_SGIX_SWAP_BARRIER",glx_sgix_swap_barrier);
+  jsonCount(jo,"GLX_SGIX_SWAP_GROUP",glx_sgix_swap_group);
+  jsonCount(jo,"GLX_SGIX_VIDEO_RESIZE",glx_sgix_video_resize);
+  jsonCount(jo,"GLX_SGIX_VISUAL_SELECT_GROUP",glx_sgix_visual_select_group);
+  jsonCount(jo,"GLX_SGI_CUSHION",glx_sgi_cushion);
+  jsonCount(jo,"GLX_SGI_MAKE_CURRENT_READ",glx_sgi_make_current_read);
+  jsonCount(jo,"GLX_SGI_SWAP_CONTROL",glx_sgi_swap_control);
+  jsonCount(jo,"GLX_SGI_VIDEO_SYNC",glx_sgi_video_sync);
+  jsonCount(jo,"GLX_SUN_GET_TRANSPARENT_INDEX",glx_sun_get_transparent_index);
+  jsonCount(jo,"GLX_SUN_VIDEO_RESIZE",glx_sun_video_resize);
+#endif
+#if REGAL_SYS_EGL
+  jsonCount(jo,"EGL_ANGLE_QUERY_SURFACE_POINTER",egl_angle_query_surface_pointer);
+  jsonCount(jo,"EGL_ANGLE_SURFACE_D3D_TEXTURE_2D_SHARE_HANDLE",egl_angle_surface_d3d_texture_2d_share_handle);
+  jsonCount(jo,"EGL_EXT_CREATE_CONTEXT_ROBUSTNESS",egl_ext_create_context_robustness);
+  jsonCount(jo,"EGL_EXT_MULTIVIEW_WINDOW",egl_ext_multiview_window);
+  jsonCount(jo,"EGL_HI_COLORFORMATS",egl_hi_colorformats);
+  jsonCount(jo,"EGL_IMG_CONTEXT_PRIORITY",egl_img_context_priority);
+  jsonCount(jo,"EGL_KHR_CONFIG_ATTRIBS",egl_khr_config_attribs);
+  jsonCount(jo,"EGL_KHR_CREATE_CONTEXT",egl_khr_create_context);
+  jsonCount(jo,"EGL_KHR_FENCE_SYNC",egl_khr_fence_sync);
+  jsonCount(jo,"EGL_KHR_GL_TEXTURE_CUBEMAP_IMAGE",egl_khr_gl_texture_cubemap_image);
+  jsonCount(jo,"EGL_KHR_IMAGE_BASE",egl_khr_image_base);
+  jsonCount(jo,"EGL_KHR_IMAGE_PIXMAP",egl_khr_image_pixmap);
+  jsonCount(jo,"EGL_KHR_LOCK_SURFACE",egl_khr_lock_surface);
+  jsonCount(jo,"EGL_KHR_LOCK_SURFACE2",egl_khr_lock_surface2);
+  jsonCount(jo,"EGL_KHR_REUSABLE_SYNC",egl_khr_reusable_sync);
+  jsonCount(jo,"EGL_KHR_STREAM",egl_khr_stream);
+  jsonCount(jo,"EGL_KHR_STREAM_CONSUMER_GLTEXTURE",egl_khr_stream_consumer_gltexture);
+  jsonCount(jo,"EGL_KHR_STREAM_CROSS_PROCESS_FD",egl_khr_stream_cross_process_fd);
+  jsonCount(jo,"EGL_KHR_STREAM_FIFO",egl_khr_stream_fifo);
+  jsonCount(jo,"EGL_KHR_STREAM_PRODUCER_EGLSURFACE",egl_khr_stream_producer_eglsurface);
+  jsonCount(jo,"EGL_KHR_VG_PARENT_IMAGE",egl_khr_vg_parent_image);
+  jsonCount(jo,"EGL_KHR_WAIT_SYNC",egl_khr_wait_sync);
+  jsonCount(jo,"EGL_MESA_DRM_IMAGE",egl_mesa_drm_image);
+  jsonCount(jo,"EGL_NV_COVERAGE_SAMPLE",egl_nv_coverage_sample);
+  jsonCount(jo,"EGL_NV_COVERAGE_SAMPLE_RESOLVE",egl_nv_coverage_sample_resolve);
+  jsonCount(jo,"EGL_NV_POST_SUB_BUFFER",egl_nv_post_sub_buffer);
+  jsonCount(jo,"EGL_NV_SYNC",egl_nv_sync);
+  jsonCount(jo,"EGL_NV_SYSTEM_TIME",egl_nv_system_time);
+#endif
+
+/* GL_VERSION_1_0 */
+
+  jsonCount(jo,"glAccum",glAccum);
+  jsonCount(jo,"glAlphaFunc",glAlphaFunc);
+  jsonCount(jo,"glBegin",glBegin);
+  jsonCount(jo,"glBitmap",glBitmap);
+  jsonCount(jo,"glBlendFunc",glBlendFunc);
+  jsonCount(jo,"glCallList",glCallList);
+  jsonCount(jo,"glCallLists",glCallLists);
+  jsonCount(jo,"glClear",glClear);
+  jsonCount(jo,"glClearAccum",glClearAccum);
+  jsonCount(jo,"glClearColor",glClearColor);
+  jsonCount(jo,"glClearDepth",glClearDepth);
+  jsonCount(jo,"glClearIndex",glClearIndex);
+  jsonCount(jo,"glClearStencil",glClearStencil);
+  jsonCount(jo,"glClipPlane",glClipPlane);
+  jsonCount(jo,"glColor3b",glColor3b);
+  jsonCount(jo,"glColor3bv",glColor3bv);
+  jsonCount(jo,"glColor3d",glColor3d);
+  jsonCount(jo,"glColor3dv",glColor3dv);
+  jsonCount(jo,"glColor3f",glColor3f);
+  jsonCount(jo,"glColor3fv",glColor3fv);
+  jsonCount(jo,"glColor3i",glColor3i);
+  jsonCount(jo,"glColor3iv",glColor3iv);
+  jsonCount(jo,"glColor3s",glColor3s);
+  jsonCount(jo,"glColor3sv",glColor3sv);
+  jsonCount(jo,"glColor3ub",glColor3ub);
+  jsonCount(jo,"glColor3ubv",glColor3ubv);
+  jsonCount(jo,"glColor3ui",glColor3ui);
+  jsonCount(jo,"glColor3uiv",glColor3uiv);
+  jsonCount(jo,"glColor3us",glColor3us);
+  jsonCount(jo,"glColor3usv",glColor3usv);
+  jsonCount(jo,"glColor4b",glColor4b);
+  jsonCount(jo,"glColor4bv",glColor4bv);
+  jsonCount(jo,"glColor4d",glColor4d);
+  jsonCount(jo,"glColor4dv",glColor4dv);
+  jsonCount(jo,"glColor4f",glColor4f);
+  jsonCount(jo,"glColor4fv",glColor4fv);
+  jsonCount(jo,"glColor4i",glColor4i);
+  jsonCount(jo,"glColor4iv",glColor4iv);
+  jsonCount(jo,"glColor4s",glColor4s);
+  jsonCount(jo,"glColor4sv",glColor4sv);
+  jsonCount(jo,"glColor4ub",glColor4ub);
+  jsonCount(jo,"glColor4ubv",glColor4ubv);
+  jsonCount(jo,"glColor4ui",glColor4ui);
+  jsonCount(jo,"glColor4uiv",glColor4uiv);
+  jsonCount(jo,"glColor4us",glColor4us);
+  jsonCount(jo,"glColor4usv",glColor4usv);
+  jsonCount(jo,"glColorMask",glColorMask);
+  jsonCount(jo,"glColorMaterial",glColorMaterial);
+  jsonCount(jo,"glCopyPixels",glCopyPixels);
+  jsonCount(jo,"glCullFace",glCullFace);
+  jsonCount(jo,"glDeleteLists",glDeleteLists);
+  jsonCount(jo,"glDepthFunc",glDepthFunc);
+  jsonCount(jo,"glDepthMask",glDepthMask);
+  jsonCount(jo,"glDepthRange",glDepthRange);
+  jsonCount(jo,"glDisable",glDisable);
+  jsonCount(jo,"glDrawBuffer",glDrawBuffer);
+  jsonCount(jo,"glDrawPixels",glDrawPixels);
+  jsonCount(jo,"glEdgeFlag",glEdgeFlag);
+  jsonCount(jo,"glEdgeFlagv",glEdgeFlagv);
+  jsonCount(jo,"glEnable",glEnable);
+  jsonCount(jo,"glEnd",glEnd);
+  jsonCount(jo,"glEndList",glEndList);
+  jsonCount(jo,"glEvalCoord1d",glEvalCoord1d);
+  jsonCount(jo,"glEvalCoord1dv",glEvalCoord1dv);
+  jsonCount(jo,"glEvalCoord1f",glEvalCoord1f);
+  jsonCount(jo,"glEvalCoord1fv",glEvalCoord1fv);
+  jsonCount(jo,"glEvalCoord2d",glEvalCoord2d);
+  jsonCount(jo,"glEvalCoord2dv",glEvalCoord2dv);
+  jsonCount(jo,"glEvalCoord2f",glEvalCoord2f);
+  jsonCount(jo,"glEvalCoord2fv",glEvalCoord2fv);
+  jsonCount(jo,"glEvalMesh1",glEvalMesh1);
+  jsonCount(jo,"glEvalMesh2",glEvalMesh2);
+  jsonCount(jo,"glEvalPoint1",glEvalPoint1);
+  jsonCount(jo,"glEvalPoint2",glEvalPoint2);
+  jsonCount(jo,"glFeedbackBuffer",glFeedbackBuffer);
+  jsonCount(jo,"glFinish",glFinish);
+  jsonCount(jo,"glFlush",glFlush);
+  jsonCount(jo,"glFogf",glFogf);
+  jsonCount(jo,"glFogfv",glFogfv);
+  jsonCount(jo,"glFogi",glFogi);
+  jsonCount(jo,"glFogiv",glFogiv);
+  jsonCount(jo,"glFrontFace",glFrontFace);
+  jsonCount(jo,"glFrustum",glFrustum);
+  jsonCount(jo,"glGenLists",glGenLists);
+  jsonCount(jo,"glGetBooleanv",glGetBooleanv);
+  jsonCount(jo,"glGetClipPlane",glGetClipPlane);
+  jsonCount(jo,"glGetDoublev",glGetDoublev);
+  jsonCount(jo,"glGetError",glGetError);
+  jsonCount(jo,"glGetFloatv",glGetFloatv);
+  jsonCount(jo,"glGetIntegerv",glGetIntegerv);
+  jsonCount(jo,"glGetLightfv",glGetLightfv);
+  jsonCount(jo,"glGetLightiv",glGetLightiv);
+  jsonCount(jo,"glGetMapdv",glGetMapdv);
+  jsonCount(jo,"glGetMapfv",glGetMapfv);
+  jsonCount(jo,"glGetMapiv",glGetMapiv);
+  jsonCount(jo,"glGetMaterialfv",glGetMaterialfv);
+  jsonCount(jo,"glGetMaterialiv",glGetMaterialiv);
+  jsonCount(jo,"glGetPixelMapfv",glGetPixelMapfv);
+  jsonCount(jo,"glGetPixelMapuiv",glGetPixelMapuiv);
+  jsonCount(jo,"glGetPixelMapusv",glGetPixelMapusv);
+  jsonCount(jo,"glGetPolygonStipple",glGetPolygonStipple);
+  jsonCount(jo,"glGetString",glGetString);
+  jsonCount(jo,"glGetTexEnvfv",glGetTexEnvfv);
+  jsonCount(jo,"glGetTexEnviv",glGetTexEnviv);
+  jsonCount(jo,"glGetTexGendv",glGetTexGendv);
+  jsonCount(jo,"glGetTexGenfv",glGetTexGenfv);
+  jsonCount(jo,"glGetTexGeniv",glGetTexGeniv);
+  jsonCount(jo,"glGetTexImage",glGetTexImage);
+  jsonCount(jo,"glGetTexLevelParameterfv",glGetTexLevelParameterfv);
+  jsonCount(jo,"glGetTexLevelParameteriv",glGetTexLevelParameteriv);
+  jsonCount(jo,"glGetTexParameterfv",glGetTexParameterfv);
+  jsonCount(jo,"glGetTexParameteriv",glGetTexParameteriv);
+  jsonCount(jo,"glHint",glHint);
+  jsonCount(jo,"glIndexMask",glIndexMask);
+  jsonCount(jo,"glIndexd",glIndexd);
+  jsonCount(jo,"glIndexdv",glIndexdv);
+  jsonCount(jo,"glIndexf",glIndexf);
+  jsonCount(jo,"glIndexfv",glIndexfv);
+  jsonCount(jo,"glIndexi",glIndexi);
+  jsonCount(jo,"glIndexiv",glIndexiv);
+  jsonCount(jo,"glIndexs",glIndexs);
+  jsonCount(jo,"glIndexsv",glIndexsv);
+  jsonCount(jo,"glInitNames",glInitNames);
+  jsonCount(jo,"glIsEnabled",glIsEnabled);
+  jsonCount(jo,"glIsList",glIsList);
+  jsonCount(jo,"glLightModelf",glLightModelf);
+  jsonCount(jo,"glLightModelfv",glLightModelfv);
+  jsonCount(jo,"glLightModeli",glLightModeli);
+  jsonCount(jo,"glLightModeliv",glLightModeliv);
+  jsonCount(jo,"glLightf",glLightf);
+  jsonCount(jo,"glLightfv",glLightfv);
+  jsonCount(jo,"glLighti",glLighti);
+  jsonCount(jo,"glLightiv",glLightiv);
+  jsonCount(jo,"glLineStipple",glLineStipple);
+  jsonCount(jo,"glLineWidth",glLineWidth);
+  jsonCount(jo,"glListBase",glListBase);
+  jsonCount(jo,"glLoadIdentity",glLoadIdentity);
+  jsonCount(jo,"glLoadMatrixd",glLoadMatrixd);
+  jsonCount(jo,"glLoadMatrixf",glLoadMatrixf);
+  jsonCount(jo,"glLoadName",glLoadName);
+  jsonCount(jo,"glLogicOp",glLogicOp);
+  jsonCount(jo,"glMap1d",glMap1d);
+  jsonCount(jo,"glMap1f",glMap1f);
+  jsonCount(jo,"glMap2d",glMap2d);
+  jsonCount(jo,"glMap2f",glMap2f);
+  jsonCount(jo,"glMapGrid1d",glMapGrid1d);
+  jsonCount(jo,"glMapGrid1f",glMapGrid1f);
+  jsonCount(jo,"glMapGrid2d",glMapGrid2d);
+  jsonCount(jo,"glMapGrid2f",glMapGrid2f);
+  jsonCount(jo,"glMaterialf",glMaterialf);
+  jsonCount(jo,"glMaterialfv",glMaterialfv);
+  jsonCount(jo,"glMateriali",glMateriali);
+  jsonCount(jo,"glMaterialiv",glMaterialiv);
+  jsonCount(jo,"glMatrixMode",glMatrixMode);
+  jsonCount(jo,"glMultMatrixd",glMultMatrixd);
+  jsonCount(jo,"glMultMatrixf",glMultMatrixf);
+  jsonCount(jo,"glNewList",glNewList);
+  jsonCount(jo,"glNormal3b",glNormal3b);
+  jsonCount(jo,"glNormal3bv",glNormal3bv);
+  jsonCount(jo,"glNormal3d",glNormal3d);
+  jsonCount(jo,"glNormal3dv",glNormal3dv);
+  jsonCount(jo,"glNormal3f",glNormal3f);
+  jsonCount(jo,"glNormal3fv",glNormal3fv);
+  jsonCount(jo,"glNormal3i",glNormal3i);
+  jsonCount(jo,"glNormal3iv",glNormal3iv);
+  jsonCount(jo,"glNormal3s",glNormal3s);
+  jsonCount(jo,"glNormal3sv",glNormal3sv);
+  jsonCount(jo,"glOrtho",glOrtho);
+  jsonCount(jo,"glPassThrough",glPassThrough);
+  jsonCount(jo,"glPixelMapfv",glPixelMapfv);
+  jsonCount(jo,"glPixelMapuiv",glPixelMapuiv);
+  jsonCount(jo,"glPixelMapusv",glPixelMapusv);
+  jsonCount(jo,"glPixelStoref",glPixelStoref);
+  jsonCount(jo,"glPixelStorei",glPixelStorei);
+  jsonCount(jo,"glPixelTransferf",glPixelTransferf);
+  jsonCount(jo,"glPixelTransferi",glPixelTransferi);
+  jsonCount(jo,"glPixelZoom",glPixelZoom);
+  jsonCount(jo,"glPointSize",glPointSize);
+  jsonCount(jo,"glPolygonMode",glPolygonMode);
+  jsonCount(jo,"glPolygonStipple",glPolygonStipple);
+  jsonCount(jo,"glPopAttrib",glPopAttrib);
+  jsonCount(jo,"glPopMatrix",glPopMatrix);
+  jsonCount(jo,"glPopName",glPopName);
+  jsonCount(jo,"glPushAttrib",glPushAttrib);
+  jsonCount(jo,"glPushMatrix",glPushMatrix);
+  jsonCount(jo,"glPushName",glPushName);
+  jsonCount(jo,"glRasterPos2d",glRasterPos2d);
+  jsonCount(jo,"glRasterPos2dv",glRasterPos2dv);
+  jsonCount(jo,"glRasterPos2f",glRasterPos2f);
+  jsonCount(jo,"glRasterPos2fv",glRasterPos2fv);
+  jsonCount(jo,"glRasterPos2i",glRasterPos2i);
+  jsonCount(jo,"glRasterPos2iv",glRasterPos2iv);
+  jsonCount(jo,"glRasterPos2s",glRasterPos2s);
+  jsonCount(jo,"glRasterPos2sv",glRasterPos2sv);
+  jsonCount(jo,"glRasterPos3d",glRasterPos3d);
+  jsonCount(jo,"glRasterPos3dv",glRasterPos3dv);
+  jsonCount(jo,"glRasterPos3f",glRasterPos3f);
+  jsonCount(jo,"glRasterPos3fv",glRasterPos3fv);
+  jsonCount(jo,"glRasterPos3i",glRasterPos3i);
+  jsonCount(jo,"glRasterPos3iv",glRasterPos3iv);
+  jsonCount(jo,"glRasterPos3s",glRasterPos3s);
+  jsonCount(jo,"glRasterPos3sv",glRasterPos3sv);
+  jsonCount(jo,"glRasterPos4d",glRasterPos4d);
+  jsonCount(jo,"glRasterPos4dv",glRasterPos4dv);
+  jsonCount(jo,"glRasterPos4f",glRasterPos4f);
+  jsonCount(jo,"glRasterPos4fv",glRasterPos4fv);
+  jsonCount(jo,"glRasterPos4i",glRasterPos4i);
+  jsonCount(jo,"glRasterPos4iv",glRasterPos4iv);
+  jsonCount(jo,"glRasterPos4s",glRasterPos4s);
+  jsonCount(jo,"glRasterPos4sv",glRasterPos4sv);
+  jsonCount(jo,"glReadBuffer",glReadBuffer);
+  jsonCount(jo,"glReadPixels",glReadPixels);
+  jsonCount(jo,"glRectd",glRectd);
+  jsonCount(jo,"glRectdv",glRectdv);
+  jsonCount(jo,"glRectf",glRectf);
+  jsonCount(jo,"glRectfv",glRectfv);
+  jsonCount(jo,"glRecti",glRecti);
+  jsonCount(jo,"glRectiv",glRectiv);
+  jsonCount(jo,"glRects",glRects);
+  jsonCount(jo,"glRectsv",glRectsv);
+  jsonCount(jo,"glRenderMode",glRenderMode);
+  jsonCount(jo,"glRotated",glRotated);
+  jsonCount(jo,"glRotatef",glRotatef);
+  jsonCount(jo,"glScaled",glScaled);
+  jsonCount(jo,"glScalef",glScalef);
+  jsonCount(jo,"glScissor",glScissor);
+  jsonCount(jo,"glSelectBuffer",glSelectBuffer);
+  jsonCount(jo,"glShadeModel",glShadeModel);
+  jsonCount(jo,"glStencilFunc",glStencilFunc);
+  jsonCount(jo,"glStencilMask",glStencilMask);
+  jsonCount(jo,"glStencilOp",glStencilOp);
+  jsonCount(jo,"glTexCoord1d",glTexCoord1d);
+  jsonCount(jo,"glTexCoord1dv",glTexCoord1dv);
+  jsonCount(jo,"glTexCoord1f",glTexCoord1f);
+  jsonCount(jo,"glTexCoord1fv",glTexCoord1fv);
+  jsonCount(jo,"glTexCoord1i",glTexCoord1i);
+  jsonCount(jo,"glTexCoord1iv",glTexCoord1iv);
+  jsonCount(jo,"glTexCoord1s",glTexCoord1s);
+  jsonCount(jo,"glTexCoord1sv",glTexCoord1sv);
+  jsonCount(jo,"glTexCoord2d",glTexCoord2d);
+  jsonCount(jo,"glTexCoord2dv",glTexCoord2dv);
+  jsonCount(jo,"glTexCoord2f",glTexCoord2f);
+  jsonCount(jo,"glTexCoord2fv",glTexCoord2fv);
+  jsonCount(jo,"glTexCoord2i",glTexCoord2i);
+  jsonCount(jo,"glTexCoord2iv",glTexCoord2iv);
+  jsonCount(jo,"glTexCoord2s",glTexCoord2s);
+  jsonCount(jo,"glTexCoord2sv",glTexCoord2sv);
+  jsonCount(jo,"glTexCoord3d",glTexCoord3d);
+  jsonCount(jo,"glTexCoord3dv",glTexCoord3dv);
+  jsonCount(jo,"glTexCoord3f",glTexCoord3f);
+  jsonCount(jo,"glTexCoord3fv",glTexCoord3fv);
+  jsonCount(jo,"glTexCoord3i",glTexCoord3i);
+  jsonCount(jo,"glTexCoord3iv",glTexCoord3iv);
+  jsonCount(jo,"glTexCoord3s",glTexCoord3s);
+  jsonCount(jo,"glTexCoord3sv",glTexCoord3sv);
+  jsonCount(jo,"glTexCoord4d",glTexCoord4d);
+  jsonCount(jo,"glTexCoord4dv",glTexCoord4dv);
+  jsonCount(jo,"glTexCoord4f",glTexCoord4f);
+  jsonCount(jo,"glTexCoord4fv",glTexCoord4fv);
+  jsonCount(jo,"glTexCoord4i",glTexCoord4i);
+  jsonCount(jo,"glTexCoord4iv",glTexCoord4iv);
+  jsonCount(jo,"glTexCoord4s",glTexCoord4s);
+  jsonCount(jo,"glTexCoord4sv",glTexCoord4sv);
+  jsonCount(jo,"glTexEnvf",glTexEnvf);
+  jsonCount(jo,"glTexEnvfv",glTexEnvfv);
+  jsonCount(jo,"glTexEnvi",glTexEnvi);
+  jsonCount(jo,"glTexEnviv",glTexEnviv);
+  jsonCount(jo,"glTexGend",glTexGend);
+  jsonCount(jo,"glTexGendv",glTexGendv);
+  jsonCount(jo,"glTexGenf",glTexGenf);
+  jsonCount(jo,"glTexGenfv",glTexGenfv);
+  jsonCount(jo,"glTexGeni",glTexGeni);
+  jsonCount(jo,"glTexGeniv",glTexGeniv);
+  jsonCount(jo,"glTexImage1D",glTexImage1D);
+  jsonCount(jo,"glTexImage2D",glTexImage2D);
+  jsonCount(jo,"glTexParameterf",glTexParameterf);
+  jsonCount(jo,"glTexParameterfv",glTexParameterfv);
+  jsonCount(jo,"glTexParameteri",glTexParameteri);
+  jsonCount(jo,"glTexParameteriv",glTexParameteriv);
+  jsonCount(jo,"glTranslated",glTranslated);
+  jsonCount(jo,"glTranslatef",glTranslatef);
+  jsonCount(jo,"glVertex2d",glVertex2d);
+  jsonCount(jo,"glVertex2dv",glVertex2dv);
+  jsonCount(jo,"glVertex2f",glVertex2f);
+  jsonCount(jo,"glVertex2fv",glVertex2fv);
+  jsonCount(jo,"glVertex2i",glVertex2i);
+  jsonCount(jo,"glVertex2iv",glVertex2iv);
+  jsonCount(jo,"glVertex2s",glVertex2s);
+  jsonCount(jo,"glVertex2sv",glVertex2sv);
+  jsonCount(jo,"glVertex3d",glVertex3d);
+  jsonCount(jo,"glVertex3dv",glVertex3dv);
+  jsonCount(jo,"glVertex3f",glVertex3f);
+  jsonCount(jo,"glVertex3fv",glVertex3fv);
+  jsonCount(jo,"glVertex3i",glVertex3i);
+  jsonCount(jo,"glVertex3iv",glVertex3iv);
+  jsonCount(jo,"glVertex3s",glVertex3s);
+  jsonCount(jo,"glVertex3sv",glVertex3sv);
+  jsonCount(jo,"glVertex4d",glVertex4d);
+  jsonCount(jo,"glVertex4dv",glVertex4dv);
+  jsonCount(jo,"glVertex4f",glVertex4f);
+  jsonCount(jo,"glVertex4fv",glVertex4fv);
+  jsonCount(jo,"glVertex4i",glVertex4i);
+  jsonCount(jo,"glVertex4iv",glVertex4iv);
+  jsonCount(jo,"glVertex4s",glVertex4s);
+  jsonCount(jo,"glVertex4sv",glVertex4sv);
+  jsonCount(jo,"glViewport",glViewport);
+
+/* GL_VERSION_1_1 */
+
+  jsonCount(jo,"glAreTexturesResident",glAreTexturesResident);
+  jsonCount(jo,"glArrayElement",glArrayElement);
+  jsonCount(jo,"glBindTexture",glBindTexture);
+  jsonCount(jo,"glColorPointer",glColorPointer);
+  jsonCount(jo,"glCopyTexImage1D",glCopyTexImage1D);
+  jsonCount(jo,"glCopyTexImage2D",glCopyTexImage2D);
+  jsonCount(jo,"glCopyTexSubImage1D",glCopyTexSubImage1D);
+  jsonCount(jo,"glCopyTexSubImage2D",glCopyTexSubImage2D);
+  jsonCount(jo,"glDeleteTextures",glDeleteTextures);
+  jsonCount(jo,"glDisableClientState",glDisableClientState);
+  jsonCount(jo,"glDrawArrays",glDrawArrays);
+  jsonCount(jo,"glDrawElements",glDrawElements);
+  jsonCount(jo,"glEdgeFlagPointer",glEdgeFlagPointer);
+  jsonCount(jo,"glEnableClientState",glEnableClientState);
+  jsonCount(jo,"glGenTextures",glGenTextures);
+  jsonCount(jo,"glGetPointerv",glGetPointerv);
+  jsonCount(jo,"glIndexPointer",glIndexPointer);
+  jsonCount(jo,"glIndexub",glIndexub);
+  jsonCount(jo,"glIndexubv",glIndexubv);
+  jsonCount(jo,"glInterleavedArrays",glInterleavedArrays);
+  jsonCount(jo,"glIsTexture",glIsTexture);
+  jsonCount(jo,"glNormalPointer",glNormalPointer);
+  jsonCount(jo,"glPolygonOffset",glPolygonOffset);
+  jsonCount(jo,"glPopClientAttrib",glPopClientAttrib);
+  jsonCount(jo,"glPrioritizeTextures",glPrioritizeTextures);
+  jsonCount(jo,"glPushClientAttrib",glPushClientAttrib);
+  jsonCount(jo,"glTexCoordPointer",glTexCoordPointer);
+  jsonCount(jo,"glTexSubImage1D",glTexSubImage1D);
+  jsonCount(jo,"glTexSubImage2D",glTexSubImage2D);
+  jsonCount(jo,"glVertexPointer",glVertexPointer);
+
+/* GL_VERSION_1_2 */
+
+  jsonCount(jo,"glCopyTexSubImage3D",glCopyTexSubImage3D);
+  jsonCount(jo,"glDrawRangeElements",glDrawRangeElements);
+  jsonCount(jo,"glTexImage3D",glTexImage3D);
+  jsonCount(jo,"glTexSubImage3D",glTexSubImage3D);
+
+/* GL_VERSION_1_3 */
+
+  jsonCount(jo,"glActiveTexture",glActiveTexture);
+  jsonCount(jo,"glClientActiveTexture",glClientActiveTexture);
+  jsonCount(jo,"glCompressedTexImage1D",glCompressedTexImage1D);
+  jsonCount(jo,"glCompressedTexImage2D",glCompressedTexImage2D);
+  jsonCount(jo,"glCompressedTexImage3D",glCompressedTexImage3D);
+  jsonCount(jo,"glCompressedTexSubImage1D",glCompressedTexSubImage1D);
+  jsonCount(jo,"glCompressedTexSubImage2D",glCompressedTexSubImage2D);
+  jsonCount(jo,"glCompressedTexSubImage3D",glCompressedTexSubImage3D);
+  jsonCount(jo,"glGetCompressedTexImage",glGetCompressedTexImage);
+  jsonCount(jo,"glLoadTransposeMatrixd",glLoadTransposeMatrixd);
+  jsonCount(jo,"glLoadTransposeMatrixf",glLoadTransposeMatrixf);
+  jsonCount(jo,"glMultTransposeMatrixd",glMultTransposeMatrixd);
+  jsonCount(jo,"glMultTransposeMatrixf",glMultTransposeMatrixf);
+  jsonCount(jo,"glMultiTexCoord1d",glMultiTexCoord1d);
+  jsonCount(jo,"glMultiTexCoord1dv",glMultiTexCoord1dv);
+  jsonCount(jo,"glMultiTexCoord1f",glMultiTexCoord1f);
+  jsonCount(jo,"glMultiTexCoord1fv",glMultiTexCoord1fv);
+  jsonCount(jo,"glMultiTexCoord1i",glMultiTexCoord1i);
+  jsonCount(jo,"glMultiTexCoord1iv",glMultiTexCoord1iv);
+  jsonCount(jo,"glMultiTexCoord1s",glMultiTexCoord1s);
+  jsonCount(jo,"glMultiTexCoord1sv",glMultiTexCoord1sv);
+  jsonCount(jo,"glMultiTexCoord2d",glMultiTexCoord2d);
+  jsonCount(jo,"glMultiTexCoord2dv",glMultiTexCoord2dv);
+  jsonCount(jo,"glMultiTexCoord2f",glMultiTexCoord2f);
+  jsonCount(jo,"glMultiTexCoord2fv",glMultiTexCoord2fv);
+  jsonCount(jo,"glMultiTexCoord2i",glMultiTexCoord2i);
+  jsonCount(jo,"glMultiTexCoord2iv",glMultiTexCoord2iv);
+  jsonCount(jo,"glMultiTexCoord2s",glMultiTexCoord2s);
+  jsonCount(jo,"glMultiTexCoord2sv",glMultiTexCoord2sv);
+  jsonCount(jo,"glMultiTexCoord3d",glMultiTexCoord3d);
+  jsonCount(jo,"glMultiTexCoord3dv",glMultiTexCoord3dv);
+  jsonCount(jo,"glMultiTexCoord3f",glMultiTexCoord3f);
+  jsonCount(jo,"glMultiTexCoord3fv",glMultiTexCoord3fv);
+  jsonCount(jo,"glMultiTexCoord3i",glMultiTexCoord3i);
+  jsonCount(jo,"glMultiTexCoord3iv",glMultiTexCoord3iv);
+  jsonCount(jo,"glMultiTexCoord3s",glMultiTexCoord3s);
+  jsonCount(jo,"glMultiTexCoord3sv",glMultiTexCoord3sv);
+  jsonCount(jo,"glMultiTexCoord4d",glMultiTexCoord4d);
+  jsonCount(jo,"glMultiTexCoord4dv",glMultiTexCoord4dv);
+  jsonCount(jo,"glMultiTexCoord4f",glMultiTexCoord4f);
+  jsonCount(jo,"glMultiTexCoord4fv",glMultiTexCoord4fv);
+  jsonCount(jo,"glMultiTexCoord4i",glMultiTexCoord4i);
+  jsonCount(jo,"glMultiTexCoord4iv",glMultiTexCoord4iv);
+  jsonCount(jo,"glMultiTexCoord4s",glMultiTexCoord4s);
+  jsonCount(jo,"glMultiTexCoord4sv",glMultiTexCoord4sv);
+  jsonCount(jo,"glSampleCoverage",glSampleCoverage);
+
+/* GL_VERSION_1_4 */
+
+  jsonCount(jo,"glBlendColor",glBlendColor);
+  jsonCount(jo,"glBlendEquation",glBlendEquation);
+  jsonCount(jo,"glBlendFuncSeparate",glBlendFuncSeparate);
+  jsonCount(jo,"glFogCoordPointer",glFogCoordPointer);
+  jsonCount(jo,"glFogCoordd",glFogCoordd);
+  jsonCount(jo,"glFogCoorddv",glFogCoorddv);
+  jsonCount(jo,"glFogCoordf",glFogCoordf);
+  jsonCount(jo,"glFogCoordfv",glFogCoordfv);
+  jsonCount(jo,"glMultiDrawArrays",glMultiDrawArrays);
+  jsonCount(jo,"glMultiDrawElements",glMultiDrawElements);
+  jsonCount(jo,"glPointParameterf",glPointParameterf);
+  jsonCount(jo,"glPointParameterfv",glPointParameterfv);
+  jsonCount(jo,"glPointParameteri",glPointParameteri);
+  jsonCount(jo,"glPointParameteriv",glPointParameteriv);
+  jsonCount(jo,"glSecondaryColor3b",glSecondaryColor3b);
+  jsonCount(jo,"glSecondaryColor3bv",glSecondaryColor3bv);
+  jsonCount(jo,"glSecondaryColor3d",glSecondaryColor3d);
+  jsonCount(jo,"glSecondaryColor3dv",glSecondaryColor3dv);
+  jsonCount(jo,"glSecondaryColor3f",glSecondaryColor3f);
+  jsonCount(jo,"glSecondaryColor3fv",glSecondaryColor3fv);
+  jsonCount(jo,"glSecondaryColor3i",glSecondaryColor3i);
+  jsonCount(jo,"glSecondaryColor3iv",glSecondaryColor3iv);
+  jsonCount(jo,"glSecondaryColor3s",glSecondaryColor3s);
+  jsonCount(jo,"glSecondaryColor3sv",glSecondaryColor3sv);
+  jsonCount(jo,"glSecondaryColor3ub",glSecondaryColor3ub);
+  jsonCount(jo,"glSecondaryColor3ubv",glSecondaryColor3ubv);
+  jsonCount(jo,"glSecondaryColor3ui",glSecondaryColor3ui);
+  jsonCount(jo,"glSecondaryColor3uiv",glSecondaryColor3uiv);
+  jsonCount(jo,"glSecondaryColor3us",glSecondaryColor3us);
+  jsonCount(jo,"glSecondaryColor3usv",glSecondaryColor3usv);
+  jsonCount(jo,"glSecondaryColorPointer",glSecondaryColorPointer);
+  jsonCount(jo,"glWindowPos2d",glWindowPos2d);
+  jsonCount(jo,"glWindowPos2dv",glWindowPos2dv);
+  jsonCount(jo,"glWindowPos2f",glWindowPos2f);
+  jsonCount(jo,"glWindowPos2fv",glWindowPos2fv);
+  jsonCount(jo,"glWindowPos2i",glWindowPos2i);
+  jsonCount(jo,"glWindowPos2iv",glWindowPos2iv);
+  jsonCount(jo,"glWindowPos2s",glWindowPos2s);
+  jsonCount(jo,"glWindowPos2sv",glWindowPos2sv);
+  jsonCount(jo,"glWindowPos3d",glWindowPos3d);
+  jsonCount(jo,"glWindowPos3dv",glWindowPos3dv);
+  jsonCount(jo,"glWindowPos3f",glWindowPos3f);
+  jsonCount(jo,"glWindowPos3fv",glWindowPos3fv);
+  jsonCount(jo,"glWindowPos3i",glWindowPos3i);
+  jsonCount(jo,"glWindowPos3iv",glWindowPos3iv);
+  jsonCount(jo,"glWindowPos3s",glWindowPos3s);
+  jsonCount(jo,"glWindowPos3sv",glWindowPos3sv);
+
+/* GL_VERSION_1_5 */
+
+  jsonCount(jo,"glBeginQuery",glBeginQuery);
+  jsonCount(jo,"glBindBuffer",glBindBuffer);
+  jsonCount(jo,"glBufferData",glBufferData);
+  jsonCount(jo,"glBufferSubData",glBufferSubData);
+  jsonCount(jo,"glDeleteBuffers",glDeleteBuffers);
+  jsonCount(jo,"glDeleteQueries",glDeleteQueries);
+  jsonCount(jo,"glEndQuery",glEndQuery);
+  jsonCount(jo,"glGenBuffers",glGenBuffers);
+  jsonCount(jo,"glGenQueries",glGenQueries);
+  jsonCount(jo,"glGetBufferParameteriv",glGetBufferParameteriv);
+  jsonCount(jo,"glGetBufferPointerv",glGetBufferPointerv);
+  jsonCount(jo,"glGetBufferSubData",glGetBufferSubData);
+  jsonCount(jo,"glGetQueryObjectiv",glGetQueryObjectiv);
+  jsonCount(jo,"glGetQueryObjectuiv",glGetQueryObjectuiv);
+  jsonCount(jo,"glGetQueryiv",glGetQueryiv);
+  jsonCount(jo,"glIsBuffer",glIsBuffer);
+  jsonCount(jo,"glIsQuery",glIsQuery);
+  jsonCount(jo,"glMapBuffer",glMapBuffer);
+  jsonCount(jo,"glUnmapBuffer",glUnmapBuffer);
+
+/* GL_VERSION_2_0 */
+
+  jsonCount(jo,"glAttachShader",glAttachShader);
+  jsonCount(jo,"glBindAttribLocation",glBindAttribLocation);
+  jsonCount(jo,"glBlendEquationSeparate",glBlendEquationSeparate);
+  jsonCount(jo,"glCompileShader",glCompileShader);
+  jsonCount(jo,"glCreateProgram",glCreateProgram);
+  jsonCount(jo,"glCreateShader",glCreateShader);
+  jsonCount(jo,"glDeleteProgram",glDeleteProgram);
+  jsonCount(jo,"glDeleteShader",glDeleteShader);
+  jsonCount(jo,"glDetachShader",glDetachShader);
+  jsonCount(jo,"glDisableVertexAttribArray",glDisableVertexAttribArray);
+  jsonCount(jo,"glDrawBuffers",glDrawBuffers);
+  jsonCount(jo,"glEnableVertexAttribArray",glEnableVertexAttribArray);
+  jsonCount(jo,"glGetActiveAttrib",glGetActiveAttrib);
+  jsonCount(jo,"glGetActiveUniform",glGetActiveUniform);
+  jsonCount(jo,"glGetAttachedShaders",glGetAttachedShaders);
+  jsonCount(jo,"glGetAttribLocation",glGetAttribLocation);
+  jsonCount(jo,"glGetProgramInfoLog",glGetProgramInfoLog);
+  jsonCount(jo,"glGetProgramiv",glGetProgramiv);
+  jsonCount(jo,"glGetShaderInfoLog",glGetShaderInfoLog);
+  jsonCount(jo,"glGetShaderSource",glGetShaderSource);
+  jsonCount(jo,"glGetShaderiv",glGetShaderiv);
+  jsonCount(jo,"glGetUniformLocation",glGetUniformLocation);
+  jsonCount(jo,"glGetUniformfv",glGetUniformfv);
+  jsonCount(jo,"glGetUniformiv",glGetUniformiv);
+  jsonCount(jo,"glGetVertexAttribPointerv",glGetVertexAttribPointerv);
+  jsonCount(jo,"glGetVertexAttribdv",glGetVertexAttribdv);
+  jsonCount(jo,"glGetVertexAttribfv",glGetVertexAttribfv);
+  jsonCount(jo,"glGetVertexAttribiv",glGetVertexAttribiv);
+  jsonCount(jo,"glIsProgram",glIsProgram);
+  jsonCount(jo,"glIsShader",glIsShader);
+  jsonCount(jo,"glLinkProgram",glLinkProgram);
+  jsonCount(jo,"glShaderSource",glShaderSource);
+  jsonCount(jo,"glStencilFuncSeparate",glStencilFuncSeparate);
+  jsonCount(jo,"glStencilMaskSeparate",glStencilMaskSeparate);
+  jsonCount(jo,"glStencilOpSeparate",glStencilOpSeparate);
+  jsonCount(jo,"glUniform1f",glUniform1f);
+  jsonCount(jo,"glUniform1fv",glUniform1fv);
+  jsonCount(jo,"glUniform1i",glUniform1i);
+  jsonCount(jo,"glUniform1iv",glUniform1iv);
+  jsonCount(jo,"glUniform2f",glUniform2f);
+  jsonCount(jo,"glUniform2fv",glUniform2fv);
+  jsonCount(jo,"glUniform2i",glUniform2i);
+  jsonCount(jo,"glUniform2iv",glUniform2iv);
+  jsonCount(jo,"glUniform3f",glUniform3f);
+  jsonCount(jo,"glUniform3fv",glUniform3fv);
+  jsonCount(jo,"glUniform3i",glUniform3i);
+  jsonCount(jo,"glUniform3iv",glUniform3iv);
+  jsonCount(jo,"glUniform4f",glUniform4f);
+  jsonCount(jo,"glUniform4fv",glUniform4fv);
+  jsonCount(jo,"glUniform4i",glUniform4i);
+  jsonCount(jo,"glUniform4iv",glUniform4iv);
+  jsonCount(jo,"glUniformMatrix2fv",glUniformMatrix2fv);
+  jsonCount(jo,"glUniformMatrix3fv",glUniformMatrix3fv);
+  jsonCount(jo,"glUniformMatrix4fv",glUniformMatrix4fv);
+  jsonCount(jo,"glUseProgram",glUseProgram);
+  jsonCount(jo,"glValidateProgram",glValidateProgram);
+  jsonCount(jo,"glVertexAttrib1d",glVertexAttrib1d);
+  jsonCount(jo,"glVertexAttrib1dv",glVertexAttrib1dv);
+  jsonCount(jo,"glVertexAttrib1f",glVertexAttrib1f);
+  jsonCount(jo,"glVertexAttrib1fv",glVertexAttrib1fv);
+  jsonCount(jo,"glVertexAttrib1s",glVertexAttrib1s);
+  jsonCount(jo,"glVertexAttrib1sv",glVertexAttrib1sv);
+  jsonCount(jo,"glVertexAttrib2d",glVertexAttrib2d);
+  jsonCount(jo,"glVertexAttrib2dv",glVertexAttrib2dv);
+  jsonCount(jo,"glVertexAttrib2f",glVertexAttrib2f);
+  jsonCount(jo,"glVertexAttrib2fv",glVertexAttrib2fv);
+  jsonCount(jo,"glVertexAttrib2s",glVertexAttrib2s);
+  jsonCount(jo,"glVertexAttrib2sv",glVertexAttrib2sv);
+  jsonCount(jo,"glVertexAttrib3d",glVertexAttrib3d);
+  jsonCount(jo,"glVertexAttrib3dv",glVertexAttrib3dv);
+  jsonCount(jo,"glVertexAttrib3f",glVertexAttrib3f);
+  jsonCount(jo,"glVertexAttrib3fv",glVertexAttrib3fv);
+  jsonCount(jo,"glVertexAttrib3s",glVertexAttrib3s);
+  jsonCount(jo,"glVertexAttrib3sv",glVertexAttrib3sv);
+  jsonCount(jo,"glVertexAttrib4Nbv",glVertexAttrib4Nbv);
+  jsonCount(jo,"glVertexAttrib4Niv",glVertexAttrib4Niv);
+  jsonCount(jo,"glVertexAttrib4Nsv",glVertexAttrib4Nsv);
+  jsonCount(jo,"glVertexAttrib4Nub",glVertexAttrib4Nub);
+  jsonCount(jo,"glVertexAttrib4Nubv",glVertexAttrib4Nubv);
+  jsonCount(jo,"glVertexAttrib4Nuiv",glVertexAttrib4Nuiv);
+  jsonCount(jo,"glVertexAttrib4Nusv",glVertexAttrib4Nusv);
+  jsonCount(jo,"glVertexAttrib4bv",glVertexAttrib4bv);
+  jsonCount(jo,"glVertexAttrib4d",glVertexAttrib4d);
+  jsonCount(jo,"glVertexAttrib4dv",glVertexAttrib4dv);
+  jsonCount(jo,"glVertexAttrib4f",glVertexAttrib4f);
+  jsonCount(jo,"glVertexAttrib4fv",glVertexAttrib4fv);
+  jsonCount(jo,"glVertexAttrib4iv",glVertexAttrib4iv);
+  jsonCount(jo,"glVertexAttrib4s",glVertexAttrib4s);
+  jsonCount(jo,"glVertexAttrib4sv",glVertexAttrib4sv);
+  jsonCount(jo,"glVertexAttrib4ubv",glVertexAttrib4ubv);
+  jsonCount(jo,"glVertexAttrib4uiv",glVertexAttrib4uiv);
+  jsonCount(jo,"glVertexAttrib4usv",glVertexAttrib4usv);
+  jsonCount(jo,"glVertexAttribPointer",glVertexAttribPointer);
+
+/* GL_VERSION_2_1 */
+
+  jsonCount(jo,"glUniformMatrix2x3fv",glUniformMatrix2x3fv);
+  jsonCount(jo,"glUniformMatrix2x4fv",glUniformMatrix2x4fv);
+  jsonCount(jo,"glUniformMatrix3x2fv",glUniformMatrix3x2fv);
+  jsonCount(jo,"glUniformMatrix3x4fv",glUniformMatrix3x4fv);
+  jsonCount(jo,"glUniformMatrix4x2fv",glUniformMatrix4x2fv);
+  jsonCount(jo,"glUniformMatrix4x3fv",glUniformMatrix4x3fv);
+
+/* GL_VERSION_3_0 */
+
+  jsonCount(jo,"glBeginConditionalRender",glBeginConditionalRender);
+  jsonCount(jo,"glBeginTransformFeedback",glBeginTransformFeedback);
+  jsonCount(jo,"glBindFragDataLocation",glBindFragDataLocation);
+  jsonCount(jo,"glClampColor",glClampColor);
+  jsonCount(jo,"glClearBufferfi",glClearBufferfi);
+  jsonCount(jo,"glClearBufferfv",glClearBufferfv);
+  jsonCount(jo,"glClearBufferiv",glClearBufferiv);
+  jsonCount(jo,"glClearBufferuiv",glClearBufferuiv);
+  jsonCount(jo,"glColorMaski",glColorMaski);
+  jsonCount(jo,"glDisablei",glDisablei);
+  jsonCount(jo,"glEnablei",glEnablei);
+  jsonCount(jo,"glEndConditionalRender",glEndConditionalRender);
+  jsonCount(jo,"glEndTransformFeedback",glEndTransformFeedback);
+  jsonCount(jo,"glGetBooleani_v",glGetBooleani_v);
+  jsonCount(jo,"glGetFragDataLocation",glGetFragDataLocation);
+  jsonCount(jo,"glGetStringi",glGetStringi);
+  jsonCount(jo,"glGetTexParameterIiv",glGetTexParameterIiv);
+  jsonCount(jo,"glGetTexParameterIuiv",glGetTexParameterIuiv);
+  jsonCount(jo,"glGetTransformFeedbackVarying",glGetTransformFeedbackVarying);
+  jsonCount(jo,"glGetUniformuiv",glGetUniformuiv);
+  jsonCount(jo,"glGetVertexAttribIiv",glGetVertexAttribIiv);
+  jsonCount(jo,"glGetVertexAttribIuiv",glGetVertexAttribIuiv);
+  jsonCount(jo,"glIsEnabledi",glIsEnabledi);
+  jsonCount(jo,"glTexParameterIiv",glTexParameterIiv);
+  jsonCount(jo,"glTexParameterIuiv",glTexParameterIuiv);
+  jsonCount(jo,"glTransformFeedbackVaryings",glTransformFeedbackVaryings);
+  jsonCount(jo,"glUniform1ui",glUniform1ui);
+  jsonCount(jo,"glUniform1uiv",glUniform1uiv);
+  jsonCount(jo,"glUniform2ui",glUniform2ui);
+  jsonCount(jo,"glUniform2uiv",glUniform2uiv);
+  jsonCount(jo,"glUniform3ui",glUniform3ui);
+  jsonCount(jo,"glUniform3uiv",glUniform3uiv);
+  jsonCount(jo,"glUniform4ui",glUniform4ui);
+  jsonCount(jo,"glUniform4uiv",glUniform4uiv);
+  jsonCount(jo,"glVertexAttribI1i",glVertexAttribI1i);
+  jsonCount(jo,"glVertexAttribI1iv",glVertexAttribI1iv);
+  jsonCount(jo,"glVertexAttribI1ui",glVertexAttribI1ui);
+  jsonCount(jo,"glVertexAttribI1uiv",glVertexAttribI1uiv);
+  jsonCount(jo,"glVertexAttribI2i",glVertexAttribI2i);
+  jsonCount(jo,"glVertexAttribI2iv",glVertexAttribI2iv);
+  jsonCount(jo,"glVertexAttribI2ui",glVertexAttribI2ui);
+  jsonCount(jo,"glVertexAttribI2uiv",glVertexAttribI2uiv);
+  jsonCount(jo,"glVertexAttribI3i",glVertexAttribI3i);
+  jsonCount(jo,"glVertexAttribI3iv",glVertexAttribI3iv);
+  jsonCount(jo,"glVertexAttribI3ui",glVertexAttribI3ui);
+  jsonCount(jo,"glVertexAttribI3uiv",glVertexAttribI3uiv);
+  jsonCount(jo,"glVertexAttribI4bv",glVertexAttribI4bv);
+  jsonCount(jo,"glVertexAttribI4i",glVertexAttribI4i);
+  jsonCount(jo,"glVertexAttribI4iv",glVertexAttribI4iv);
+  jsonCount(jo,"glVertexAttribI4sv",glVertexAttribI4sv);
+  jsonCount(jo,"glVertexAttribI4ubv",glVertexAttribI4ubv);
+  jsonCount(jo,"glVertexAttribI4ui",glVertexAttribI4ui);
+  jsonCount(jo,"glVertexAttribI4uiv",glVertexAttribI4uiv);
+  jsonCount(jo,"glVertexAttribI4usv",glVertexAttribI4usv);
+  jsonCount(jo,"glVertexAttribIPointer",glVertexAttribIPointer);
+
+/* GL_VERSION_3_1 */
+
+  jsonCount(jo,"glDrawArraysInstanced",glDrawArraysInstanced);
+  jsonCount(jo,"glDrawElementsInstanced",glDrawElementsInstanced);
+  jsonCount(jo,"glPrimitiveRestartIndex",glPrimitiveRestartIndex);
+  jsonCount(jo,"glTexBuffer",glTexBuffer);
+
+/* GL_VERSION_3_2 */
+
+  jsonCount(jo,"glFramebufferTexture",glFramebufferTexture);
+  jsonCount(jo,"glGetBufferParameteri64v",glGetBufferParameteri64v);
+  jsonCount(jo,"glGetInteger64i_v",glGetInteger64i_v);
+
+/* GL_VERSION_3_3 */
+
+  jsonCount(jo,"glVertexAttribDivisor",glVertexAttribDivisor);
+
+/* GL_VERSION_4_0 */
+
+  jsonCount(jo,"glBlendEquationSeparatei",glBlendEquationSeparatei);
+  jsonCount(jo,"glBlendEquationi",glBlendEquationi);
+  jsonCount(jo,"glBlendFuncSeparatei",glBlendFuncSeparatei);
+  jsonCount(jo,"glBlendFunci",glBlendFunci);
+  jsonCount(jo,"glDrawArraysIndirect",glDrawArraysIndirect);
+  jsonCount(jo,"glDrawElementsIndirect",glDrawElementsIndirect);
+  jsonCount(jo,"glMinSampleShading",glMinSampleShading);
+
+/* GL_3DFX_tbuffer */
+
+  jsonCount(jo,"glTbufferMask3DFX",glTbufferMask3DFX);
+
+/* GL_AMD_debug_output */
+
+  jsonCount(jo,"glDebugMessageCallbackAMD",glDebugMessageCallbackAMD);
+  jsonCount(jo,"glDebugMessageEnableAMD",glDebugMessageEnableAMD);
+  jsonCount(jo,"glDebugMessageInsertAMD",glDebugMessageInsertAMD);
+  jsonCount(jo,"glGetDebugMessageLogAMD",glGetDebugMessageLogAMD);
+
+/* GL_AMD_draw_buffers_blend */
+
+  jsonCount(jo,"glBlendEquationIndexedAMD",glBlendEquationIndexedAMD);
+  jsonCount(jo,"glBlendEquationSeparateIndexedAMD",glBlendEquationSeparateIndexedAMD);
+  jsonCount(jo,"glBlendFuncIndexedAMD",glBlendFuncIndexedAMD);
+  jsonCount(jo,"glBlendFuncSeparateIndexedAMD",glBlendFuncSeparateIndexedAMD);
+
+/* GL_AMD_interleaved_elements */
+
+  jsonCount(jo,"glVertexAttribParameteriAMD",glVertexAttribParameteriAMD);
+
+/* GL_AMD_multi_draw_indirect */
+
+  jsonCount(jo,"glMultiDrawArraysIndirectAMD",glMultiDrawArraysIndirectAMD);
+  jsonCount(jo,"glMultiDrawElementsIndirectAMD",glMultiDrawElementsIndirectAMD);
+
+/* GL_AMD_name_gen_delete */
+
+  jsonCount(jo,"glDeleteNamesAMD",glDeleteNamesAMD);
+  jsonCount(jo,"glGenNamesAMD",glGenNamesAMD);
+  jsonCount(jo,"glIsNameAMD",glIsNameAMD);
+
+/* GL_AMD_performance_monitor */
+
+  jsonCount(jo,"glBeginPerfMonitorAMD",glBeginPerfMonitorAMD);
+  jsonCount(jo,"glDeletePerfMonitorsAMD",glDeletePerfMonitorsAMD);
+  jsonCount(jo,"glEndPerfMonitorAMD",glEndPerfMonitorAMD);
+  jsonCount(jo,"glGenPerfMonitorsAMD",glGenPerfMonitorsAMD);
+  jsonCount(jo,"glGetPerfMonitorCounterDataAMD",glGetPerfMonitorCounterDataAMD);
+  jsonCount(jo,"glGetPerfMonitorCounterInfoAMD",glGetPerfMonitorCounterInfoAMD);
+  jsonCount(jo,"glGetPerfMonitorCounterStringAMD",glGetPerfMonitorCounterStringAMD);
+  jsonCount(jo,"glGetPerfMonitorCountersAMD",glGetPerfMonitorCountersAMD);
+  jsonCount(jo,"glGetPerfMonitorGroupStringAMD",glGetPerfMonitorGroupStringAMD);
+  jsonCount(jo,"glGetPerfMonitorGroupsAMD",glGetPerfMonitorGroupsAMD);
+  jsonCount(jo,"glSelectPerfMonitorCountersAMD",glSelectPerfMonitorCountersAMD);
+
+/* GL_AMD_sample_positions */
+
+  jsonCount(jo,"glSetMultisamplefvAMD",glSetMultisamplefvAMD);
+
+/* GL_AMD_sparse_texture */
+
+  jsonCount(jo,"glTexStorageSparseAMD",glTexStorageSparseAMD);
+  jsonCount(jo,"glTextureStorageSparseAMD",glTextureStorageSparseAMD);
+
+/* GL_AMD_stencil_operation_extended */
+
+  jsonCount(jo,"glStencilOpValueAMD",glStencilOpValueAMD);
+
+/* GL_AMD_vertex_shader_tessellator */
+
+  jsonCount(jo,"glTessellationFactorAMD",glTessellationFactorAMD);
+  jsonCount(jo,"glTessellationModeAMD",glTessellationModeAMD);
+
+/* GL_ANGLE_framebuffer_blit */
+
+  jsonCount(jo,"glBlitFramebufferANGLE",glBlitFramebufferANGLE);
+
+/* GL_ANGLE_framebuffer_multisample */
+
+  jsonCount(jo,"glRenderbufferStorageMultisampleANGLE",glRenderbufferStorageMultisampleANGLE);
+
+/* GL_ANGLE_instanced_arrays */
+
+  jsonCount(jo,"glDrawArraysInstancedANGLE",glDrawArraysInstancedANGLE);
+  jsonCount(jo,"glDrawElementsInstancedANGLE",glDrawElementsInstancedANGLE);
+  jsonCount(jo,"glVertexAttribDivisorANGLE",glVertexAttribDivisorANGLE);
+
+/* GL_ANGLE_timer_query */
+
+  jsonCount(jo,"glBeginQueryANGLE",glBeginQueryANGLE);
+  jsonCount(jo,"glDeleteQueriesANGLE",glDeleteQueriesANGLE);
+  jsonCount(jo,"glEndQueryANGLE",glEndQueryANGLE);
+  jsonCount(jo,"glGenQueriesANGLE",glGenQueriesANGLE);
+  jsonCount(jo,"glGetQueryObjecti64vANGLE",glGetQueryObjecti64vANGLE);
+  jsonCount(jo,"glGetQueryObjectivANGLE",glGetQueryObjectivANGLE);
+  jsonCount(jo,"glGetQueryObjectui64vANGLE",glGetQueryObjectui64vANGLE);
+  jsonCount(jo,"glGetQueryObjectuivANGLE",glGetQueryObjectuivANGLE);
+  jsonCount(jo,"glGetQueryivANGLE",glGetQueryivANGLE);
+  jsonCount(jo,"glIsQueryANGLE",glIsQueryANGLE);
+  jsonCount(jo,"glQueryCounterANGLE",glQueryCounterANGLE);
+
+/* GL_ANGLE_translated_shader_source */
+
+  jsonCount(jo,"glGetTranslatedShaderSourceANGLE",glGetTranslatedShaderSourceANGLE);
+
+/* GL_APPLE_copy_texture_levels */
+
+  jsonCount(jo,"glCopyTextureLevelsAPPLE",glCopyTextureLevelsAPPLE);
+
+/* GL_APPLE_element_array */
+
+  jsonCount(jo,"glDrawElementArrayAPPLE",glDrawElementArrayAPPLE);
+  jsonCount(jo,"glDrawRangeElementArrayAPPLE",glDrawRangeElementArrayAPPLE);
+  jsonCount(jo,"glElementPointerAPPLE",glElementPointerAPPLE);
+  jsonCount(jo,"glMultiDrawElementArrayAPPLE",glMultiDrawElementArrayAPPLE);
+  jsonCount(jo,"glMultiDrawRangeElementArrayAPPLE",glMultiDrawRangeElementArrayAPPLE);
+
+/* GL_APPLE_fence */
+
+  jsonCount(jo,"glDeleteFencesAPPLE",glDeleteFencesAPPLE);
+  jsonCount(jo,"glFinishFenceAPPLE",glFinishFenceAPPLE);
+  jsonCount(jo,"glFinishObjectAPPLE",glFinishObjectAPPLE);
+  jsonCount(jo,"glGenFencesAPPLE",glGenFencesAPPLE);
+  jsonCount(jo,"glIsFenceAPPLE",glIsFenceAPPLE);
+  jsonCount(jo,"glSetFenceAPPLE",glSetFenceAPPLE);
+  jsonCount(jo,"glTestFenceAPPLE",glTestFenceAPPLE);
+  jsonCount(jo,"glTestObjectAPPLE",glTestObjectAPPLE);
+
+/* GL_APPLE_flush_buffer_range */
+
+  jsonCount(jo,"glBufferParameteriAPPLE",glBufferParameteriAPPLE);
+  jsonCount(jo,"glFlushMappedBufferRangeAPPLE",glFlushMappedBufferRangeAPPLE);
+
+/* GL_APPLE_flush_render */
+
+  jsonCount(jo,"glFinishRenderAPPLE",glFinishRenderAPPLE);
+  jsonCount(jo,"glFlushRenderAPPLE",glFlushRenderAPPLE);
+  jsonCount(jo,"glSwapAPPLE",glSwapAPPLE);
+
+/* GL_APPLE_framebuffer_multisample */
+
+  jsonCount(jo,"glRenderbufferStorageMultisampleAPPLE",glRenderbufferStorageMultisampleAPPLE);
+  jsonCount(jo,"glResolveMultisampleFramebufferAPPLE",glResolveMultisampleFramebufferAPPLE);
+
+/* GL_APPLE_object_purgeable */
+
+  jsonCount(jo,"glGetObjectParameterivAPPLE",glGetObjectParameterivAPPLE);
+  jsonCount(jo,"glObjectPurgeableAPPLE",glObjectPurgeableAPPLE);
+  jsonCount(jo,"glObjectUnpurgeableAPPLE",glObjectUnpurgeableAPPLE);
+
+/* GL_APPLE_sync */
+
+  jsonCount(jo,"glClientWaitSyncAPPLE",glClientWaitSyncAPPLE);
+  jsonCount(jo,"glDeleteSyncAPPLE",glDeleteSyncAPPLE);
+  jsonCount(jo,"glFenceSyncAPPLE",glFenceSyncAPPLE);
+  jsonCount(jo,"glGetInteger64vAPPLE",glGetInteger64vAPPLE);
+  jsonCount(jo,"glGetSyncivAPPLE",glGetSyncivAPPLE);
+  jsonCount(jo,"glIsSyncAPPLE",glIsSyncAPPLE);
+  jsonCount(jo,"glWaitSyncAPPLE",glWaitSyncAPPLE);
+
+/* GL_APPLE_texture_range */
+
+  jsonCount(jo,"glGetTexParameterPointervAPPLE",glGetTexParameterPointervAPPLE);
+  jsonCount(jo,"glTextureRangeAPPLE",glTextureRangeAPPLE);
+
+/* GL_APPLE_vertex_array_object */
+
+  jsonCount(jo,"glBindVertexArrayAPPLE",glBindVertexArrayAPPLE);
+  jsonCount(jo,"glDeleteVertexArraysAPPLE",glDeleteVertexArraysAPPLE);
+  jsonCount(jo,"glGenVertexArraysAPPLE",glGenVertexArraysAPPLE);
+  jsonCount(jo,"glIsVertexArrayAPPLE",glIsVertexArrayAPPLE);
+
+/* GL_APPLE_vertex_array_range */
+
+  jsonCount(jo,"glFlushVertexArrayRangeAPPLE",glFlushVertexArrayRangeAPPLE);
+  jsonCount(jo,"glVertexArrayParameteriAPPLE",glVertexArrayParameteriAPPLE);
+  jsonCount(jo,"glVertexArrayRangeAPPLE",glVertexArrayRangeAPPLE);
+
+/* GL_APPLE_vertex_program_evaluators */
+
+  jsonCount(jo,"glDisableVertexAttribAPPLE",glDisableVertexAttribAPPLE);
+  jsonCount(jo,"glEnableVertexAttribAPPLE",glEnableVertexAttribAPPLE);
+  jsonCount(jo,"glIsVertexAttribEnabledAPPLE",glIsVertexAttribEnabledAPPLE);
+  jsonCount(jo,"glMapVertexAttrib1dAPPLE",glMapVertexAttrib1dAPPLE);
+  jsonCount(jo,"glMapVertexAttrib1fAPPLE",glMapVertexAttrib1fAPPLE);
+  jsonCount(jo,"glMapVertexAttrib2dAPPLE",glMapVertexAttrib2dAPPLE);
+  jsonCount(jo,"glMapVertexAttrib2fAPPLE",glMapVertexAttrib2fAPPLE);
+
+/* GL_ARB_ES2_compatibility */
+
+  jsonCount(jo,"glClearDepthf",glClearDepthf);
+  jsonCount(jo,"glDepthRangef",glDepthRangef);
+  jsonCount(jo,"glGetShaderPrecisionFormat",glGetShaderPrecisionFormat);
+  jsonCount(jo,"glReleaseShaderCompiler",glReleaseShaderCompiler);
+  jsonCount(jo,"glShaderBinary",glShaderBinary);
+
+/* GL_ARB_ES3_1_compatibility */
+
+  jsonCount(jo,"glMemoryBarrierByRegion",glMemoryBarrierByRegion);
+
+/* GL_ARB_base_instance */
+
+  jsonCount(jo,"glDrawArraysInstancedBaseInstance",glDrawArraysInstancedBaseInstance);
+  jsonCount(jo,"glDrawElementsInstancedBaseInstance",glDrawElementsInstancedBaseInstance);
+  jsonCount(jo,"glDrawElementsInstancedBaseVertexBaseInstance",glDrawElementsInstancedBaseVertexBaseInstance);
+
+/* GL_ARB_bindless_texture */
+
+  jsonCount(jo,"glGetImageHandleARB",glGetImageHandleARB);
+  jsonCount(jo,"glGetTextureHandleARB",glGetTextureHandleARB);
+  jsonCount(jo,"glGetTextureSamplerHandleARB",glGetTextureSamplerHandleARB);
+  jsonCount(jo,"glGetVertexAttribLui64vARB",glGetVertexAttribLui64vARB);
+  jsonCount(jo,"glIsImageHandleResidentARB",glIsImageHandleResidentARB);
+  jsonCount(jo,"glIsTextureHandleResidentARB",glIsTextureHandleResidentARB);
+  jsonCount(jo,"glMakeImageHandleNonResidentARB",glMakeImageHandleNonResidentARB);
+  jsonCount(jo,"glMakeImageHandleResidentARB",glMakeImageHandleResidentARB);
+  jsonCount(jo,"glMakeTextureHandleNonResidentARB",glMakeTextureHandleNonResidentARB);
+  jsonCount(jo,"glMakeTextureHandleResidentARB",glMakeTextureHandleResidentARB);
+  jsonCount(jo,"glProgramUniformHandleui64ARB",glProgramUniformHandleui64ARB);
+  jsonCount(jo,"glProgramUniformHandleui64vARB",glProgramUniformHandleui64vARB);
+  jsonCount(jo,"glUniformHandleui64ARB",glUniformHandleui64ARB);
+  jsonCount(jo,"glUniformHandleui64vARB",glUniformHandleui64vARB);
+  jsonCount(jo,"glVertexAttribL1ui64ARB",glVertexAttribL1ui64ARB);
+  jsonCount(jo,"glVertexAttribL1ui64vARB",glVertexAttribL1ui64vARB);
+
+/* GL_ARB_blend_func_extended */
+
+  jsonCount(jo,"glBindFragDataLocationIndexed",glBindFragDataLocationIndexed);
+  jsonCount(jo,"glGetFragDataIndex",glGetFragDataIndex);
+
+/* GL_ARB_buffer_storage */
+
+  jsonCount(jo,"glBufferStorage",glBufferStorage);
+  jsonCount(jo,"glNamedBufferStorageEXT",glNamedBufferStorageEXT);
+
+/* GL_ARB_cl_event */
+
+  jsonCount(jo,"glCreateSyncFromCLeventARB",glCreateSyncFromCLeventARB);
+
+/* GL_ARB_clear_buffer_object */
+
+  jsonCount(jo,"glClearBufferData",glClearBufferData);
+  jsonCount(jo,"glClearBufferSubData",glClearBufferSubData);
+  jsonCount(jo,"glClearNamedBufferDataEXT",glClearNamedBufferDataEXT);
+  jsonCount(jo,"glClearNamedBufferSubDataEXT",glClearNamedBufferSubDataEXT);
+
+/* GL_ARB_clear_texture */
+
+  jsonCount(jo,"glClearTexImage",glClearTexImage);
+  jsonCount(jo,"glClearTexSubImage",glClearTexSubImage);
+
+/* GL_ARB_clip_control */
+
+  jsonCount(jo,"glClipControl",glClipControl);
+
+/* GL_ARB_color_buffer_float */
+
+  jsonCount(jo,"glClampColorARB",glClampColorARB);
+
+/* GL_ARB_compute_shader */
+
+  jsonCount(jo,"glDispatchCompute",glDispatchCompute);
+  jsonCount(jo,"glDispatchComputeIndirect",glDispatchComputeIndirect);
+
+/* GL_ARB_compute_variable_group_size */
+
+  jsonCount(jo,"glDispatchComputeGroupSizeARB",glDispatchComputeGroupSizeARB);
+
+/* GL_ARB_copy_buffer */
+
+  jsonCount(jo,"glCopyBufferSubData",glCopyBufferSubData);
+
+/* GL_ARB_copy_image */
+
+  jsonCount(jo,"glCopyImageSubData",glCopyImageSubData);
+
+/* GL_ARB_debug_output */
+
+  jsonCount(jo,"glDebugMessageCallbackARB",glDebugMessageCallbackARB);
+  jsonCount(jo,"glDebugMessageControlARB",glDebugMessageControlARB);
+  jsonCount(jo,"glDebugMessageInsertARB",glDebugMessageInsertARB);
+  jsonCount(jo,"glGetDebugMessageLogARB",glGetDebugMessageLogARB);
+
+/* GL_ARB_direct_state_access */
+
+  jsonCount(jo,"glBindTextureUnit",glBindTextureUnit);
+  jsonCount(jo,"glBlitNamedFramebuffer",glBlitNamedFramebuffer);
+  jsonCount(jo,"glCheckNamedFramebufferStatus",glCheckNamedFramebufferStatus);
+  jsonCount(jo,"glClearNamedBufferData",glClearNamedBufferData);
+  jsonCount(jo,"glClearNamedBufferSubData",glClearNamedBufferSubData);
+  jsonCount(jo,"glClearNamedFramebufferfi",glClearNamedFramebufferfi);
+  jsonCount(jo,"glClearNamedFramebufferfv",glClearNamedFramebufferfv);
+  jsonCount(jo,"glClearNamedFramebufferiv",glClearNamedFramebufferiv);
+  jsonCount(jo,"glClearNamedFramebufferuiv",glClearNamedFramebufferuiv);
+  jsonCount(jo,"glCompressedTextureSubImage1D",glCompressedTextureSubImage1D);
+  jsonCount(jo,"glCompressedTextureSubImage2D",glCompressedTextureSubImage2D);
+  jsonCount(jo,"glCompressedTextureSubImage3D",glCompressedTextureSubImage3D);
+  jsonCount(jo,"glCopyNamedBufferSubData",glCopyNamedBufferSubData);
+  jsonCount(jo,"glCopyTextureSubImage1D",glCopyTextureSubImage1D);
+  jsonCount(jo,"glCopyTextureSubImage2D",glCopyTextureSubImage2D);
+  jsonCount(jo,"glCopyTextureSubImage3D",glCopyTextureSubImage3D);
+  jsonCount(jo,"glCreateBuffers",glCreateBuffers);
+  jsonCount(jo,"glCreateFramebuffers",glCreateFramebuffers);
+  jsonCount(jo,"glCreateProgramPipelines",glCreateProgramPipelines);
+  jsonCount(jo,"glCreateQueries",glCreateQueries);
+  jsonCount(jo,"glCreateRenderbuffers",glCreateRenderbuffers);
+  jsonCount(jo,"glCreateSamplers",glCreateSamplers);
+  jsonCount(jo,"glCreateTextures",glCreateTextures);
+  jsonCount(jo,"glCreateTransformFeedbacks",glCreateTransformFeedbacks);
+  jsonCount(jo,"glCreateVertexArrays",glCreateVertexArrays);
+  jsonCount(jo,"glDisableVertexArrayAttrib",glDisableVertexArrayAttrib);
+  jsonCount(jo,"glEnableVertexArrayAttrib",glEnableVertexArrayAttrib);
+  jsonCount(jo,"glFlushMappedNamedBufferRange",glFlushMappedNamedBufferRange);
+  jsonCount(jo,"glGenerateTextureMipmap",glGenerateTextureMipmap);
+  jsonCount(jo,"glGetCompressedTextureImage",glGetCompressedTextureImage);
+  jsonCount(jo,"glGetNamedBufferParameteri64v",glGetNamedBufferParameteri64v);
+  jsonCount(jo,"glGetNamedBufferParameteriv",glGetNamedBufferParameteriv);
+  jsonCount(jo,"glGetNamedBufferPointerv",glGetNamedBufferPointerv);
+  jsonCount(jo,"glGetNamedBufferSubData",glGetNamedBufferSubData);
+  jsonCount(jo,"glGetNamedFramebufferAttachmentParameteriv",glGetNamedFramebufferAttachmentParameteriv);
+  jsonCount(jo,"glGetNamedFramebufferParameteriv",glGetNamedFramebufferParameteriv);
+  jsonCount(jo,"glGetNamedRenderbufferParameteriv",glGetNamedRenderbufferParameteriv);
+  jsonCount(jo,"glGetTextureImage",glGetTextureImage);
+  jsonCount(jo,"glGetTextureLevelParameterfv",glGetTextureLevelParameterfv);
+  jsonCount(jo,"glGetTextureLevelParameteriv",glGetTextureLevelParameteriv);
+  jsonCount(jo,"glGetTextureParameterIiv",glGetTextureParameterIiv);
+  jsonCount(jo,"glGetTextureParameterIuiv",glGetTextureParameterIuiv);
+  jsonCount(jo,"glGetTextureParameterfv",glGetTextureParameterfv);
+  jsonCount(jo,"glGetTextureParameteriv",glGetTextureParameteriv);
+  jsonCount(jo,"glGetTransformFeedbacki64_v",glGetTransformFeedbacki64_v);
+  jsonCount(jo,"glGetTransformFeedbacki_v",glGetTransformFeedbacki_v);
+  jsonCount(jo,"glGetTransformFeedbackiv",glGetTransformFeedbackiv);
+  jsonCount(jo,"glGetVertexArrayIndexed64iv",glGetVertexArrayIndexed64iv);
+  jsonCount(jo,"glGetVertexArrayIndexediv",glGetVertexArrayIndexediv);
+  jsonCount(jo,"glGetVertexArrayiv",glGetVertexArrayiv);
+  jsonCount(jo,"glInvalidateNamedFramebufferData",glInvalidateNamedFramebufferData);
+  jsonCount(jo,"glInvalidateNamedFramebufferSubData",glInvalidateNamedFramebufferSubData);
+  jsonCount(jo,"glMapNamedBuffer",glMapNamedBuffer);
+  jsonCount(jo,"glMapNamedBufferRange",glMapNamedBufferRange);
+  jsonCount(jo,"glNamedBufferData",glNamedBufferData);
+  jsonCount(jo,"glNamedBufferStorage",glNamedBufferStorage);
+  jsonCount(jo,"glNamedBufferSubData",glNamedBufferSubData);
+  jsonCount(jo,"glNamedFramebufferDrawBuffer",glNamedFramebufferDrawBuffer);
+  jsonCount(jo,"glNamedFramebufferDrawBuffers",glNamedFramebufferDrawBuffers);
+  jsonCount(jo,"glNamedFramebufferParameteri",glNamedFramebufferParameteri);
+  jsonCount(jo,"glNamedFramebufferReadBuffer",glNamedFramebufferReadBuffer);
+  jsonCount(jo,"glNamedFramebufferRenderbuffer",glNamedFramebufferRenderbuffer);
+  jsonCount(jo,"glNamedFramebufferTexture",glNamedFramebufferTexture);
+  jsonCount(jo,"glNamedFramebufferTextureLayer",glNamedFramebufferTextureLayer);
+  jsonCount(jo,"glNamedRenderbufferStorage",glNamedRenderbufferStorage);
+  jsonCount(jo,"glNamedRenderbufferStorageMultisample",glNamedRenderbufferStorageMultisample);
+  jsonCount(jo,"glTextureBuffer",glTextureBuffer);
+  jsonCount(jo,"glTextureBufferRange",glTextureBufferRange);
+  jsonCount(jo,"glTextureParameterIiv",glTextureParameterIiv);
+  jsonCount(jo,"glTextureParameterIuiv",glTextureParameterIuiv);
+  jsonCount(jo,"glTextureParameterf",glTextureParameterf);
+  jsonCount(jo,"glTextureParameterfv",glTextureParameterfv);
+  jsonCount(jo,"glTextureParameteri",glTextureParameteri);
+  jsonCount(jo,"glTextureParameteriv",glTextureParameteriv);
+  jsonCount(jo,"glTextureStorage1D",glTextureStorage1D);
+  jsonCount(jo,"glTextureStorage2D",glTextureStorage2D);
+  jsonCount(jo,"glTextureStorage2DMultisample",glTextureStorage2DMultisample);
+  jsonCount(jo,"glTextureStorage3D",glTextureStorage3D);
+  jsonCount(jo,"glTextureStorage3DMultisample",glTextureStorage3DMultisample);
+  jsonCount(jo,"glTextureSubImage1D",glTextureSubImage1D);
+  jsonCount(jo,"glTextureSubImage2D",glTextureSubImage2D);
+  jsonCount(jo,"glTextureSubImage3D",glTextureSubImage3D);
+  jsonCount(jo,"glTransformFeedbackBufferBase",glTransformFeedbackBufferBase);
+  jsonCount(jo,"glTransformFeedbackBufferRange",glTransformFeedbackBufferRange);
+  jsonCount(jo,"glUnmapNamedBuffer",glUnmapNamedBuffer);
+  jsonCount(jo,"glVertexArrayAttribBinding",glVertexArrayAttribBinding);
+  jsonCount(jo,"glVertexArrayAttribFormat",glVertexArrayAttribFormat);
+  jsonCount(jo,"glVertexArrayAttribIFormat",glVertexArrayAttribIFormat);
+  jsonCount(jo,"glVertexArrayAttribLFormat",glVertexArrayAttribLFormat);
+  jsonCount(jo,"glVertexArrayBindingDivisor",glVertexArrayBindingDivisor);
+  jsonCount(jo,"glVertexArrayElementBuffer",glVertexArrayElementBuffer);
+  jsonCount(jo,"glVertexArrayVertexBuffer",glVertexArrayVertexBuffer);
+  jsonCount(jo,"glVertexArrayVertexBuffers",glVertexArrayVertexBuffers);
+
+/* GL_ARB_draw_buffers */
+
+  jsonCount(jo,"glDrawBuffersARB",glDrawBuffersARB);
+
+/* GL_ARB_draw_buffers_blend */
+
+  jsonCount(jo,"glBlendEquationSeparateiARB",glBlendEquationSeparateiARB);
+  jsonCount(jo,"glBlendEquationiARB",glBlendEquationiARB);
+  jsonCount(jo,"glBlendFuncSeparateiARB",glBlendFuncSeparateiARB);
+  jsonCount(jo,"glBlendFunciARB",glBlendFunciARB);
+
+/* GL_ARB_draw_elements_base_vertex */
+
+  jsonCount(jo,"glDrawElementsBaseVertex",glDrawElementsBaseVertex);
+  jsonCount(jo,"glDrawElementsInstancedBaseVertex",glDrawElementsInstancedBaseVertex);
+  jsonCount(jo,"glDrawRangeElementsBaseVertex",glDrawRangeElementsBaseVertex);
+  jsonCount(jo,"glMultiDrawElementsBaseVertex",glMultiDrawElementsBaseVertex);
+
+/* GL_ARB_draw_instanced */
+
+  jsonCount(jo,"glDrawArraysInstancedARB",glDrawArraysInstancedARB);
+  jsonCount(jo,"glDrawElementsInstancedARB",glDrawElementsInstancedARB);
+
+/* GL_ARB_framebuffer_no_attachments */
+
+  jsonCount(jo,"glFramebufferParameteri",glFramebufferParameteri);
+  jsonCount(jo,"glGetFramebufferParameteriv",glGetFramebufferParameteriv);
+  jsonCount(jo,"glGetNamedFramebufferParameterivEXT",glGetNamedFramebufferParameterivEXT);
+  jsonCount(jo,"glNamedFramebufferParameteriEXT",glNamedFramebufferParameteriEXT);
+
+/* GL_ARB_framebuffer_object */
+
+  jsonCount(jo,"glBindFramebuffer",glBindFramebuffer);
+  jsonCount(jo,"glBindRenderbuffer",glBindRenderbuffer);
+  jsonCount(jo,"glBlitFramebuffer",glBlitFramebuffer);
+  jsonCount(jo,"glCheckFramebufferStatus",glCheckFramebufferStatus);
+  jsonCount(jo,"glDeleteFramebuffers",glDeleteFramebuffers);
+  jsonCount(jo,"glDeleteRenderbuffers",glDeleteRenderbuffers);
+  jsonCount(jo,"glFramebufferRenderbuffer",glFramebufferRenderbuffer);
+  jsonCount(jo,"glFramebufferTexture1D",glFramebufferTexture1D);
+  jsonCount(jo,"glFramebufferTexture2D",glFramebufferTexture2D);
+  jsonCount(jo,"glFramebufferTexture3D",glFramebufferTexture3D);
+  jsonCount(jo,"glFramebufferTextureLayer",glFramebufferTextureLayer);
+  jsonCount(jo,"glGenFramebuffers",glGenFramebuffers);
+  jsonCount(jo,"glGenRenderbuffers",glGenRenderbuffers);
+  jsonCount(jo,"glGenerateMipmap",glGenerateMipmap);
+  jsonCount(jo,"glGetFramebufferAttachmentParameteriv",glGetFramebufferAttachmentParameteriv);
+  jsonCount(jo,"glGetRenderbufferParameteriv",glGetRenderbufferParameteriv);
+  jsonCount(jo,"glIsFramebuffer",glIsFramebuffer);
+  jsonCount(jo,"glIsRenderbuffer",glIsRenderbuffer);
+  jsonCount(jo,"glRenderbufferStorage",glRenderbufferStorage);
+  jsonCount(jo,"glRenderbufferStorageMultisample",glRenderbufferStorageMultisample);
+
+/* GL_ARB_geometry_shader4 */
+
+  jsonCount(jo,"glFramebufferTextureARB",glFramebufferTextureARB);
+  jsonCount(jo,"glFramebufferTextureFaceARB",glFramebufferTextureFaceARB);
+  jsonCount(jo,"glFramebufferTextureLayerARB",glFramebufferTextureLayerARB);
+  jsonCount(jo,"glProgramParameteriARB",glProgramParameteriARB);
+
+/* GL_ARB_get_program_binary */
+
+  jsonCount(jo,"glGetProgramBinary",glGetProgramBinary);
+  jsonCount(jo,"glProgramBinary",glProgramBinary);
+  jsonCount(jo,"glProgramParameteri",glProgramParameteri);
+
+/* GL_ARB_get_texture_sub_image */
+
+  jsonCount(jo,"glGetCompressedTextureSubImage",glGetCompressedTextureSubImage);
+  jsonCount(jo,"glGetTextureSubImage",glGetTextureSubImage);
+
+/* GL_ARB_gpu_shader_fp64 */
+
+  jsonCount(jo,"glGetUniformdv",glGetUniformdv);
+  jsonCount(jo,"glUniform1d",glUniform1d);
+  jsonCount(jo,"glUniform1dv",glUniform1dv);
+  jsonCount(jo,"glUniform2d",glUniform2d);
+  jsonCount(jo,"glUniform2dv",glUniform2dv);
+  jsonCount(jo,"glUniform3d",glUniform3d);
+  jsonCount(jo,"glUniform3dv",glUniform3dv);
+  jsonCount(jo,"glUniform4d",glUniform4d);
+  jsonCount(jo,"glUniform4dv",glUniform4dv);
+  jsonCount(jo,"glUniformMatrix2dv",glUniformMatrix2dv);
+  jsonCount(jo,"glUniformMatrix2x3dv",glUniformMatrix2x3dv);
+  jsonCount(jo,"glUniformMatrix2x4dv",glUniformMatrix2x4dv);
+  jsonCount(jo,"glUniformMatrix3dv",glUniformMatrix3dv);
+  jsonCount(jo,"glUniformMatrix3x2dv",glUniformMatrix3x2dv);
+  jsonCount(jo,"glUniformMatrix3x4dv",glUniformMatrix3x4dv);
+  jsonCount(jo,"glUniformMatrix4dv",glUniformMatrix4dv);
+  jsonCount(jo,"glUniformMatrix4x2dv",glUniformMatrix4x2dv);
+  jsonCount(jo,"glUniformMatrix4x3dv",glUniformMatrix4x3dv);
+
+/* GL_ARB_imaging */
+
+  jsonCount(jo,"glColorSubTable",glColorSubTable);
+  jsonCount(jo,"glColorTable",glColorTable);
+  jsonCount(jo,"glColorTableParameterfv",glColorTableParameterfv);
+  jsonCount(jo,"glColorTableParameteriv",glColorTableParameteriv);
+  jsonCount(jo,"glConvolutionFilter1D",glConvolutionFilter1D);
+  jsonCount(jo,"glConvolutionFilter2D",glConvolutionFilter2D);
+  jsonCount(jo,"glConvolutionParameterf",glConvolutionParameterf);
+  jsonCount(jo,"glConvolutionParameterfv",glConvolutionParameterfv);
+  jsonCount(jo,"glConvolutionParameteri",glConvolutionParameteri);
+  jsonCount(jo,"glConvolutionParameteriv",glConvolutionParameteriv);
+  jsonCount(jo,"glCopyColorSubTable",glCopyColorSubTable);
+  jsonCount(jo,"glCopyColorTable",glCopyColorTable);
+  jsonCount(jo,"glCopyConvolutionFilter1D",glCopyConvolutionFilter1D);
+  jsonCount(jo,"glCopyConvolutionFilter2D",glCopyConvolutionFilter2D);
+  jsonCount(jo,"glGetColorTable",glGetColorTable);
+  jsonCount(jo,"glGetColorTableParameterfv",glGetColorTableParameterfv);
+  jsonCount(jo,"glGetColorTableParameteriv",glGetColorTableParameteriv);
+  jsonCount(jo,"glGetConvolutionFilter",glGetConvolutionFilter);
+  jsonCount(jo,"glGetConvolutionParameterfv",glGetConvolutionParameterfv);
+  jsonCount(jo,"glGetConvolutionParameteriv",glGetConvolutionParameteriv);
+  jsonCount(jo,"glGetHistogram",glGetHistogram);
+  jsonCount(jo,"glGetHistogramParameterfv",glGetHistogramParameterfv);
+  jsonCount(jo,"glGetHistogramParameteriv",glGetHistogramParameteriv);
+  jsonCount(jo,"glGetMinmax",glGetMinmax);
+  jsonCount(jo,"glGetMinmaxParameterfv",glGetMinmaxParameterfv);
+  jsonCount(jo,"glGetMinmaxParameteriv",glGetMinmaxParameteriv);
+  jsonCount(jo,"glGetSeparableFilter",glGetSeparableFilter);
+  jsonCount(jo,"glHistogram",glHistogram);
+  jsonCount(jo,"glMinmax",glMinmax);
+  jsonCount(jo,"glResetHistogram",glResetHistogram);
+  jsonCount(jo,"glResetMinmax",glResetMinmax);
+  jsonCount(jo,"glSeparableFilter2D",glSeparableFilter2D);
+
+/* GL_ARB_indirect_parameters */
+
+  jsonCount(jo,"glMultiDrawArraysIndirectCountARB",glMultiDrawArraysIndirectCountARB);
+  jsonCount(jo,"glMultiDrawElementsIndirectCountARB",glMultiDrawElementsIndirectCountARB);
+
+/* GL_ARB_instanced_arrays */
+
+  jsonCount(jo,"glVertexAttribDivisorARB",glVertexAttribDivisorARB);
+
+/* GL_ARB_internalformat_query */
+
+  jsonCount(jo,"glGetInternalformativ",glGetInternalformativ);
+
+/* GL_ARB_internalformat_query2 */
+
+  jsonCount(jo,"glGetInternalformati64v",glGetInternalformati64v);
+
+/* GL_ARB_invalidate_subdata */
+
+  jsonCount(jo,"glInvalidateBufferData",glInvalidateBufferData);
+  jsonCount(jo,"glInvalidateBufferSubData",glInvalidateBufferSubData);
+  jsonCount(jo,"glInvalidateFramebuffer",glInvalidateFramebuffer);
+  jsonCount(jo,"glInvalidateSubFramebuffer",glInvalidateSubFramebuffer);
+  jsonCount(jo,"glInvalidateTexImage",glInvalidateTexImage);
+  jsonCount(jo,"glInvalidateTexSubImage",glInvalidateTexSubImage);
+
+/* GL_ARB_map_buffer_range */
+
+  jsonCount(jo,"glFlushMappedBufferRange",glFlushMappedBufferRange);
+  jsonCount(jo,"glMapBufferRange",glMapBufferRange);
+
+/* GL_ARB_matrix_palette */
+
+  jsonCount(jo,"glCurrentPaletteMatrixARB",glCurrentPaletteMatrixARB);
+  jsonCount(jo,"glMatrixIndexPointerARB",glMatrixIndexPointerARB);
+  jsonCount(jo,"glMatrixIndexubvARB",glMatrixIndexubvARB);
+  jsonCount(jo,"glMatrixIndexuivARB",glMatrixIndexuivARB);
+  jsonCount(jo,"glMatrixIndexusvARB",glMatrixIndexusvARB);
+
+/* GL_ARB_multi_bind */
+
+  jsonCount(jo,"glBindBuffersBase",glBindBuffersBase);
+  jsonCount(jo,"glBindBuffersRange",glBindBuffersRange);
+  jsonCount(jo,"glBindImageTextures",glBindImageTextures);
+  jsonCount(jo,"glBindSamplers",glBindSamplers);
+  jsonCount(jo,"glBindTextures",glBindTextures);
+  jsonCount(jo,"glBindVertexBuffers",glBindVertexBuffers);
+
+/* GL_ARB_multi_draw_indirect */
+
+  jsonCount(jo,"glMultiDrawArraysIndirect",glMultiDrawArraysIndirect);
+  jsonCount(jo,"glMultiDrawElementsIndirect",glMultiDrawElementsIndirect);
+
+/* GL_ARB_multisample */
+
+  jsonCount(jo,"glSampleCoverageARB",glSampleCoverageARB);
+
+/* GL_ARB_multitexture */
+
+  jsonCount(jo,"glActiveTextureARB",glActiveTextureARB);
+  jsonCount(jo,"glClientActiveTextureARB",glClientActiveTextureARB);
+  jsonCount(jo,"glMultiTexCoord1dARB",glMultiTexCoord1dARB);
+  jsonCount(jo,"glMultiTexCoord1dvARB",glMultiTexCoord1dvARB);
+  jsonCount(jo,"glMultiTexCoord1fARB",glMultiTexCoord1fARB);
+  jsonCount(jo,"glMultiTexCoord1fvARB",glMultiTexCoord1fvARB);
+  jsonCount(jo,"glMultiTexCoord1iARB",glMultiTexCoord1iARB);
+  jsonCount(jo,"glMultiTexCoord1ivARB",glMultiTexCoord1ivARB);
+  jsonCount(jo,"glMultiTexCoord1sARB",glMultiTexCoord1sARB);
+  jsonCount(jo,"glMultiTexCoord1svARB",glMultiTexCoord1svARB);
+  jsonCount(jo,"glMultiTexCoord2dARB",glMultiTexCoord2dARB);
+  jsonCount(jo,"glMultiTexCoord2dvARB",glMultiTexCoord2dvARB);
+  jsonCount(jo,"glMultiTexCoord2fARB",glMultiTexCoord2fARB);
+  jsonCount(jo,"glMultiTexCoord2fvARB",glMultiTexCoord2fvARB);
+  jsonCount(jo,"glMultiTexCoord2iARB",glMultiTexCoord2iARB);
+  jsonCount(jo,"glMultiTexCoord2ivARB",glMultiTexCoord2ivARB);
+  jsonCount(jo,"glMultiTexCoord2sARB",glMultiTexCoord2sARB);
+  jsonCount(jo,"glMultiTexCoord2svARB",glMultiTexCoord2svARB);
+  jsonCount(jo,"glMultiTexCoord3dARB",glMultiTexCoord3dARB);
+  jsonCount(jo,"glMultiTexCoord3dvARB",glMultiTexCoord3dvARB);
+  jsonCount(jo,"glMultiTexCoord3fARB",glMultiTexCoord3fARB);
+  jsonCount(jo,"glMultiTexCoord3fvARB",glMultiTexCoord3fvARB);
+  jsonCount(jo,"glMultiTexCoord3iARB",glMultiTexCoord3iARB);
+  jsonCount(jo,"glMultiTexCoord3ivARB",glMultiTexCoord3ivARB);
+  jsonCount(jo,"glMultiTexCoord3sARB",glMultiTexCoord3sARB);
+  jsonCount(jo,"glMultiTexCoord3svARB",glMultiTexCoord3svARB);
+  jsonCount(jo,"glMultiTexCoord4dARB",glMultiTexCoord4dARB);
+  jsonCount(jo,"glMultiTexCoord4dvARB",glMultiTexCoord4dvARB);
+  jsonCount(jo,"glMultiTexCoord4fARB",glMultiTexCoord4fARB);
+  jsonCount(jo,"glMultiTexCoord4fvARB",glMultiTexCoord4fvARB);
+  jsonCount(jo,"glMultiTexCoord4iARB",glMultiTexCoord4iARB);
+  jsonCount(jo,"glMultiTexCoord4ivARB",glMultiTexCoord4ivARB);
+  jsonCount(jo,"glMultiTexCoord4sARB",glMultiTexCoord4sARB);
+  jsonCount(jo,"glMultiTexCoord4svARB",glMultiTexCoord4svARB);
+
+/* GL_ARB_occlusion_query */
+
+  jsonCount(jo,"glBeginQueryARB",glBeginQueryARB);
+  jsonCount(jo,"glDeleteQueriesARB",glDeleteQueriesARB);
+  jsonCount(jo,"glEndQueryARB",glEndQueryARB);
+  jsonCount(jo,"glGenQueriesARB",glGenQueriesARB);
+  jsonCount(jo,"glGetQueryObjectivARB",glGetQueryObjectivARB);
+  jsonCount(jo,"glGetQueryObjectuivARB",glGetQueryObjectuivARB);
+  jsonCount(jo,"glGetQueryivARB",glGetQueryivARB);
+  jsonCount(jo,"glIsQueryARB",glIsQueryARB);
+
+/* GL_ARB_point_parameters */
+
+  jsonCount(jo,"glPointParameterfARB",glPointParameterfARB);
+  jsonCount(jo,"glPointParameterfvARB",glPointParameterfvARB);
+
+/* GL_ARB_program_interface_query */
+
+  jsonCount(jo,"glGetProgramInterfaceiv",glGetProgramInterfaceiv);
+  jsonCount(jo,"glGetProgramResourceIndex",glGetProgramResourceIndex);
+  jsonCount(jo,"glGetProgramResourceLocation",glGetProgramResourceLocation);
+  jsonCount(jo,"glGetProgramResourceLocationIndex",glGetProgramResourceLocationIndex);
+  jsonCount(jo,"glGetProgramResourceName",glGetProgramResourceName);
+  jsonCount(jo,"glGetProgramResourceiv",glGetProgramResourceiv);
+
+/* GL_ARB_provoking_vertex */
+
+  jsonCount(jo,"glProvokingVertex",glProvokingVertex);
+
+/* GL_ARB_robustness */
+
+  jsonCount(jo,"glGetGraphicsResetStatusARB",glGetGraphicsResetStatusARB);
+  jsonCount(jo,"glGetnColorTableARB",glGetnColorTableARB);
+  jsonCount(jo,"glGetnCompressedTexImageARB",glGetnCompressedTexImageARB);
+  jsonCount(jo,"glGetnConvolutionFilterARB",glGetnConvolutionFilterARB);
+  jsonCount(jo,"glGetnHistogramARB",glGetnHistogramARB);
+  jsonCount(jo,"glGetnMapdvARB",glGetnMapdvARB);
+  jsonCount(jo,"glGetnMapfvARB",glGetnMapfvARB);
+  jsonCount(jo,"glGetnMapivARB",glGetnMapivARB);
+  jsonCount(jo,"glGetnMinmaxARB",glGetnMinmaxARB);
+  jsonCount(jo,"glGetnPixelMapfvARB",glGetnPixelMapfvARB);
+  jsonCount(jo,"glGetnPixelMapuivARB",glGetnPixelMapuivARB);
+  jsonCount(jo,"glGetnPixelMapusvARB",glGetnPixelMapusvARB);
+  jsonCount(jo,"glGetnPolygonStippleARB",glGetnPolygonStippleARB);
+  jsonCount(jo,"glGetnSeparableFilterARB",glGetnSeparableFilterARB);
+  jsonCount(jo,"glGetnTexImageARB",glGetnTexImageARB);
+  jsonCount(jo,"glGetnUniformdvARB",glGetnUniformdvARB);
+  jsonCount(jo,"glGetnUniformfvARB",glGetnUniformfvARB);
+  jsonCount(jo,"glGetnUniformivARB",glGetnUniformivARB);
+  jsonCount(jo,"glGetnUniformuivARB",glGetnUniformuivARB);
+  jsonCount(jo,"glReadnPixelsARB",glReadnPixelsARB);
+
+/* GL_ARB_sample_shading */
+
+  jsonCount(jo,"glMinSampleShadingARB",glMinSampleShadingARB);
+
+/* GL_ARB_sampler_objects */
+
+  jsonCount(jo,"glBindSampler",glBindSampler);
+  jsonCount(jo,"glDeleteSamplers",glDeleteSamplers);
+  jsonCount(jo,"glGenSamplers",glGenSamplers);
+  jsonCount(jo,"glGetSamplerParameterIiv",glGetSamplerParameterIiv);
+  jsonCount(jo,"glGetSamplerParameterIuiv",glGetSamplerParameterIuiv);
+  jsonCount(jo,"glGetSamplerParameterfv",glGetSamplerParameterfv);
+  jsonCount(jo,"glGetSamplerParameteriv",glGetSamplerParameteriv);
+  jsonCount(jo,"glIsSampler",glIsSampler);
+  jsonCount(jo,"glSamplerParameterIiv",glSamplerParameterIiv);
+  jsonCount(jo,"glSamplerParameterIuiv",glSamplerParameterIuiv);
+  jsonCount(jo,"glSamplerParameterf",glSamplerParameterf);
+  jsonCount(jo,"glSamplerParameterfv",glSamplerParameterfv);
+  jsonCount(jo,"glSamplerParameteri",glSamplerParameteri);
+  jsonCount(jo,"glSamplerParameteriv",glSamplerParameteriv);
+
+/* GL_ARB_separate_shader_objects */
+
+  jsonCount(jo,"glActiveShaderProgram",glActiveShaderProgram);
+  jsonCount(jo,"glBindProgramPipeline",glBindProgramPipeline);
+  jsonCount(jo,"glCreateShaderProgramv",glCreateShaderProgramv);
+  jsonCount(jo,"glDeleteProgramPipelines",glDeleteProgramPipelines);
+  jsonCount(jo,"glGenProgramPipelines",glGenProgramPipelines);
+  jsonCount(jo,"glGetProgramPipelineInfoLog",glGetProgramPipelineInfoLog);
+  jsonCount(jo,"glGetProgramPipelineiv",glGetProgramPipelineiv);
+  jsonCount(jo,"glIsProgramPipeline",glIsProgramPipeline);
+  jsonCount(jo,"glProgramUniform1d",glProgramUniform1d);
+  jsonCount(jo,"glProgramUniform1dv",glProgramUniform1dv);
+  jsonCount(jo,"glProgramUniform1f",glProgramUniform1f);
+  jsonCount(jo,"glProgramUniform1fv",glProgramUniform1fv);
+  jsonCount(jo,"glProgramUniform1i",glProgramUniform1i);
+  jsonCount(jo,"glProgramUniform1iv",glProgramUniform1iv);
+  jsonCount(jo,"glProgramUniform1ui",glProgramUniform1ui);
+  jsonCount(jo,"glProgramUniform1uiv",glProgramUniform1uiv);
+  jsonCount(jo,"glProgramUniform2d",glProgramUniform2d);
+  jsonCount(jo,"glProgramUniform2dv",glProgramUniform2dv);
+  jsonCount(jo,"glProgramUniform2f",glProgramUniform2f);
+  jsonCount(jo,"glProgramUniform2fv",glProgramUniform2fv);
+  jsonCount(jo,"glProgramUniform2i",glProgramUniform2i);
+  jsonCount(jo,"glProgramUniform2iv",glProgramUniform2iv);
+  jsonCount(jo,"glProgramUniform2ui",glProgramUniform2ui);
+  jsonCount(jo,"glProgramUniform2uiv",glProgramUniform2uiv);
+  jsonCount(jo,"glProgramUniform3d",glProgramUniform3d);
+  jsonCount(jo,"glProgramUniform3dv",glProgramUniform3dv);
+  jsonCount(jo,"glProgramUniform3f",glProgramUniform3f);
+  jsonCount(jo,"glProgramUniform3fv",glProgramUniform3fv);
+  jsonCount(jo,"glProgramUniform3i",glProgramUniform3i);
+  jsonCount(jo,"glProgramUniform3iv",glProgramUniform3iv);
+  jsonCount(jo,"glProgramUniform3ui",glProgramUniform3ui);
+  jsonCount(jo,"glProgramUniform3uiv",glProgramUniform3uiv);
+  jsonCount(jo,"glProgramUniform4d",glProgramUniform4d);
+  jsonCount(jo,"glProgramUniform4dv",glProgramUniform4dv);
+  jsonCount(jo,"glProgramUniform4f",glProgramUniform4f);
+  jsonCount(jo,"glProgramUniform4fv",glProgramUniform4fv);
+  jsonCount(jo,"glProgramUniform4i",glProgramUniform4i);
+  jsonCount(jo,"glProgramUniform4iv",glProgramUniform4iv);
+  jsonCount(jo,"glProgramUniform4ui",glProgramUniform4ui);
+  jsonCount(jo,"glProgramUniform4uiv",glProgramUniform4uiv);
+  jsonCount(jo,"glProgramUniformMatrix2dv",glProgramUniformMatrix2dv);
+  jsonCount(jo,"glProgramUniformMatrix2fv",glProgramUniformMatrix2fv);
+  jsonCount(jo,"glProgramUniformMatrix2x3dv",glProgramUniformMatrix2x3dv);
+  jsonCount(jo,"glProgramUniformMatrix2x3fv",glProgramUniformMatrix2x3fv);
+  jsonCount(jo,"glProgramUniformMatrix2x4dv",glProgramUniformMatrix2x4dv);
+  jsonCount(jo,"glProgramUniformMatrix2x4fv",glProgramUniformMatrix2x4fv);
+  jsonCount(jo,"glProgramUniformMatrix3dv",glProgramUniformMatrix3dv);
+  jsonCount(jo,"glProgramUniformMatrix3fv",glProgramUniformMatrix3fv);
+  jsonCount(jo,"glProgramUniformMatrix3x2dv",glProgramUniformMatrix3x2dv);
+  jsonCount(jo,"glProgramUniformMatrix3x2fv",glProgramUniformMatrix3x2fv);
+  jsonCount(jo,"glProgramUniformMatrix3x4dv",glProgramUniformMatrix3x4dv);
+  jsonCount(jo,"glProgramUniformMatrix3x4fv",glProgramUniformMatrix3x4fv);
+  jsonCount(jo,"glProgramUniformMatrix4dv",glProgramUniformMatrix4dv);
+  jsonCount(jo,"glProgramUniformMatrix4fv",glProgramUniformMatrix4fv);
+  jsonCount(jo,"glProgramUniformMatrix4x2dv",glProgramUniformMatrix4x2dv);
+  jsonCount(jo,"glProgramUniformMatrix4x2fv",glProgramUniformMatrix4x2fv);
+  jsonCount(jo,"glProgramUniformMatrix4x3dv",glProgramUniformMatrix4x3dv);
+  jsonCount(jo,"glProgramUniformMatrix4x3fv",glProgramUniformMatrix4x3fv);
+  jsonCount(jo,"glUseProgramStages",glUseProgramStages);
+  jsonCount(jo,"glValidateProgramPipeline",glValidateProgramPipeline);
+
+/* GL_ARB_shader_atomic_counters */
+
+  jsonCount(jo,"glGetActiveAtomicCounterBufferiv",glGetActiveAtomicCounterBufferiv);
+
+/* GL_ARB_shader_image_load_store */
+
+  jsonCount(jo,"glBindImageTexture",glBindImageTexture);
+  jsonCount(jo,"glMemoryBarrier",glMemoryBarrier);
+
+/* GL_ARB_shader_objects */
+
+  jsonCount(jo,"glAttachObjectARB",glAttachObjectARB);
+  jsonCount(jo,"glCompileShaderARB",glCompileShaderARB);
+  jsonCount(jo,"glCreateProgramObjectARB",glCreateProgramObjectARB);
+  jsonCount(jo,"glCreateShaderObjectARB",glCreateShaderObjectARB);
+  jsonCount(jo,"glDeleteObjectARB",glDeleteObjectARB);
+  jsonCount(jo,"glDetachObjectARB",glDetachObjectARB);
+  jsonCount(jo,"glGetActiveUniformARB",glGetActiveUniformARB);
+  jsonCount(jo,"glGetAttachedObjectsARB",glGetAttachedObjectsARB);
+  jsonCount(jo,"glGetHandleARB",glGetHandleARB);
+  jsonCount(jo,"glGetInfoLogARB",glGetInfoLogARB);
+  jsonCount(jo,"glGetObjectParameterfvARB",glGetObjectParameterfvARB);
+  jsonCount(jo,"glGetObjectParameterivARB",glGetObjectParameterivARB);
+  jsonCount(jo,"glGetShaderSourceARB",glGetShaderSourceARB);
+  jsonCount(jo,"glGetUniformLocationARB",glGetUniformLocationARB);
+  jsonCount(jo,"glGetUniformfvARB",glGetUniformfvARB);
+  jsonCount(jo,"glGetUniformivARB",glGetUniformivARB);
+  jsonCount(jo,"glLinkProgramARB",glLinkProgramARB);
+  jsonCount(jo,"glShaderSourceARB",glShaderSourceARB);
+  jsonCount(jo,"glUniform1fARB",glUniform1fARB);
+  jsonCount(jo,"glUniform1fvARB",glUniform1fvARB);
+  jsonCount(jo,"glUniform1iARB",glUniform1iARB);
+  jsonCount(jo,"glUniform1ivARB",glUniform1ivARB);
+  jsonCount(jo,"glUniform2fARB",glUniform2fARB);
+  jsonCount(jo,"glUniform2fvARB",glUniform2fvARB);
+  jsonCount(jo,"glUniform2iARB",glUniform2iARB);
+  jsonCount(jo,"glUniform2ivARB",glUniform2ivARB);
+  jsonCount(jo,"glUniform3fARB",glUniform3fARB);
+  jsonCount(jo,"glUniform3fvARB",glUniform3fvARB);
+  jsonCount(jo,"glUniform3iARB",glUniform3iARB);
+  jsonCount(jo,"glUniform3ivARB",glUniform3ivARB);
+  jsonCount(jo,"glUniform4fARB",glUniform4fARB);
+  jsonCount(jo,"glUniform4fvARB",glUniform4fvARB);
+  jsonCount(jo,"glUniform4iARB",glUniform4iARB);
+  jsonCount(jo,"glUniform4ivARB",glUniform4ivARB);
+  jsonCount(jo,"glUniformMatrix2fvARB",glUniformMatrix2fvARB);
+  jsonCount(jo,"glUniformMatrix3fvARB",glUniformMatrix3fvARB);
+  jsonCount(jo,"glUniformMatrix4fvARB",glUniformMatrix4fvARB);
+  jsonCount(jo,"glUseProgramObjectARB",glUseProgramObjectARB);
+  jsonCount(jo,"glValidateProgramARB",glValidateProgramARB);
+
+/* GL_ARB_shader_storage_buffer_object */
+
+  jsonCount(jo,"glShaderStorageBlockBinding",glShaderStorageBlockBinding);
+
+/* GL_ARB_shader_subroutine */
+
+  jsonCount(jo,"glGetActiveSubroutineName",glGetActiveSubroutineName);
+  jsonCount(jo,"glGetActiveSubroutineUniformName",glGetActiveSubroutineUniformName);
+  jsonCount(jo,"glGetActiveSubroutineUniformiv",glGetActiveSubroutineUniformiv);
+  jsonCount(jo,"glGetProgramStageiv",glGetProgramStageiv);
+  jsonCount(jo,"glGetProgramSubroutineParameteruivNV",glGetProgramSubroutineParameteruivNV);
+  jsonCount(jo,"glGetSubroutineIndex",glGetSubroutineIndex);
+  jsonCount(jo,"glGetSubroutineUniformLocation",glGetSubroutineUniformLocation);
+  jsonCount(jo,"glGetUniformSubroutineuiv",glGetUniformSubroutineuiv);
+  jsonCount(jo,"glProgramSubroutineParametersuivNV",glProgramSubroutineParametersuivNV);
+  jsonCount(jo,"glUniformSubroutinesuiv",glUniformSubroutinesuiv);
+
+/* GL_ARB_shading_language_include */
+
+  jsonCount(jo,"glCompileShaderIncludeARB",glCompileShaderIncludeARB);
+  jsonCount(jo,"glDeleteNamedStringARB",glDeleteNamedStringARB);
+  jsonCount(jo,"glGetNamedStringARB",glGetNamedStringARB);
+  jsonCount(jo,"glGetNamedStringivARB",glGetNamedStringivARB);
+  jsonCount(jo,"glIsNamedStringARB",glIsNamedStringARB);
+  jsonCount(jo,"glNamedStringARB",glNamedStringARB);
+
+/* GL_ARB_sparse_buffer */
+
+  jsonCount(jo,"glBufferPageCommitmentARB",glBufferPageCommitmentARB);
+
+/* GL_ARB_sparse_texture */
+
+  jsonCount(jo,"glTexPageCommitmentARB",glTexPageCommitmentARB);
+  jsonCount(jo,"glTexturePageCommitmentEXT",glTexturePageCommitmentEXT);
+
+/* GL_ARB_sync */
+
+  jsonCount(jo,"glClientWaitSync",glClientWaitSync);
+  jsonCount(jo,"glDeleteSync",glDeleteSync);
+  jsonCount(jo,"glFenceSync",glFenceSync);
+  jsonCount(jo,"glGetInteger64v",glGetInteger64v);
+  jsonCount(jo,"glGetSynciv",glGetSynciv);
+  jsonCount(jo,"glIsSync",glIsSync);
+  jsonCount(jo,"glWaitSync",glWaitSync);
+
+/* GL_ARB_tessellation_shader */
+
+  jsonCount(jo,"glPatchParameterfv",glPatchParameterfv);
+  jsonCount(jo,"glPatchParameteri",glPatchParameteri);
+
+/* GL_ARB_texture_barrier */
+
+  jsonCount(jo,"glTextureBarrier",glTextureBarrier);
+
+/* GL_ARB_texture_buffer_object */
+
+  jsonCount(jo,"glTexBufferARB",glTexBufferARB);
+
+/* GL_ARB_texture_buffer_range */
+
+  jsonCount(jo,"glTexBufferRange",glTexBufferRange);
+  jsonCount(jo,"glTextureBufferRangeEXT",glTextureBufferRangeEXT);
+
+/* GL_ARB_texture_compression */
+
+  jsonCount(jo,"glCompressedTexImage1DARB",glCompressedTexImage1DARB);
+  jsonCount(jo,"glCompressedTexImage2DARB",glCompressedTexImage2DARB);
+  jsonCount(jo,"glCompressedTexImage3DARB",glCompressedTexImage3DARB);
+  jsonCount(jo,"glCompressedTexSubImage1DARB",glCompressedTexSubImage1DARB);
+  jsonCount(jo,"glCompressedTexSubImage2DARB",glCompressedTexSubImage2DARB);
+  jsonCount(jo,"glCompressedTexSubImage3DARB",glCompressedTexSubImage3DARB);
+  jsonCount(jo,"glGetCompressedTexImageARB",glGetCompressedTexImageARB);
+
+/* GL_ARB_texture_multisample */
+
+  jsonCount(jo,"glGetMultisamplefv",glGetMultisamplefv);
+  jsonCount(jo,"glSampleMaski",glSampleMaski);
+  jsonCount(jo,"glTexImage2DMultisample",glTexImage2DMultisample);
+  jsonCount(jo,"glTexImage3DMultisample",glTexImage3DMultisample);
+
+/* GL_ARB_texture_storage */
+
+  jsonCount(jo,"glTexStorage1D",glTexStorage1D);
+  jsonCount(jo,"glTexStorage2D",glTexStorage2D);
+  jsonCount(jo,"glTexStorage3D",glTexStorage3D);
+  jsonCount(jo,"glTextureStorage1DEXT",glTextureStorage1DEXT);
+  jsonCount(jo,"glTextureStorage2DEXT",glTextureStorage2DEXT);
+  jsonCount(jo,"glTextureStorage3DEXT",glTextureStorage3DEXT);
+
+/* GL_ARB_texture_storage_multisample */
+
+  jsonCount(jo,"glTexStorage2DMultisample",glTexStorage2DMultisample);
+  jsonCount(jo,"glTexStorage3DMultisample",glTexStorage3DMultisample);
+  jsonCount(jo,"glTextureStorage2DMultisampleEXT",glTextureStorage2DMultisampleEXT);
+  jsonCount(jo,"glTextureStorage3DMultisampleEXT",glTextureStorage3DMultisampleEXT);
+
+/* GL_ARB_texture_view */
+
+  jsonCount(jo,"glTextureView",glTextureView);
+
+/* GL_ARB_timer_query */
+
+  jsonCount(jo,"glGetQueryObjecti64v",glGetQueryObjecti64v);
+  jsonCount(jo,"glGetQueryObjectui64v",glGetQueryObjectui64v);
+  jsonCount(jo,"glQueryCounter",glQueryCounter);
+
+/* GL_ARB_transform_feedback2 */
+
+  jsonCount(jo,"glBindTransformFeedback",glBindTransformFeedback);
+  jsonCount(jo,"glDeleteTransformFeedbacks",glDeleteTransformFeedbacks);
+  jsonCount(jo,"glDrawTransformFeedback",glDrawTransformFeedback);
+  jsonCount(jo,"glGenTransformFeedbacks",glGenTransformFeedbacks);
+  jsonCount(jo,"glIsTransformFeedback",glIsTransformFeedback);
+  jsonCount(jo,"glPauseTransformFeedback",glPauseTransformFeedback);
+  jsonCount(jo,"glResumeTransformFeedback",glResumeTransformFeedback);
+
+/* GL_ARB_transform_feedback3 */
+
+  jsonCount(jo,"glBeginQueryIndexed",glBeginQueryIndexed);
+  jsonCount(jo,"glDrawTransformFeedbackStream",glDrawTransformFeedbackStream);
+  jsonCount(jo,"glEndQueryIndexed",glEndQueryIndexed);
+  jsonCount(jo,"glGetQueryIndexediv",glGetQueryIndexediv);
+
+/* GL_ARB_transform_feedback_instanced */
+
+  jsonCount(jo,"glDrawTransformFeedbackInstanced",glDrawTransformFeedbackInstanced);
+  jsonCount(jo,"glDrawTransformFeedbackStreamInstanced",glDrawTransformFeedbackStreamInstanced);
+
+/* GL_ARB_transpose_matrix */
+
+  jsonCount(jo,"glLoadTransposeMatrixdARB",glLoadTransposeMatrixdARB);
+  jsonCount(jo,"glLoadTransposeMatrixfARB",glLoadTransposeMatrixfARB);
+  jsonCount(jo,"glMultTransposeMatrixdARB",glMultTransposeMatrixdARB);
+  jsonCount(jo,"glMultTransposeMatrixfARB",glMultTransposeMatrixfARB);
+
+/* GL_ARB_uniform_buffer_object */
+
+  jsonCount(jo,"glBindBufferBase",glBindBufferBase);
+  jsonCount(jo,"glBindBufferRange",glBindBufferRange);
+  jsonCount(jo,"glGetActiveUniformBlockName",glGetActiveUniformBlockName);
+  jsonCount(jo,"glGetActiveUniformBlockiv",glGetActiveUniformBlockiv);
+  jsonCount(jo,"glGetActiveUniformName",glGetActiveUniformName);
+  jsonCount(jo,"glGetActiveUniformsiv",glGetActiveUniformsiv);
+  jsonCount(jo,"glGetIntegeri_v",glGetIntegeri_v);
+  jsonCount(jo,"glGetUniformBlockIndex",glGetUniformBlockIndex);
+  jsonCount(jo,"glGetUniformIndices",glGetUniformIndices);
+  jsonCount(jo,"glUniformBlockBinding",glUniformBlockBinding);
+
+/* GL_ARB_vertex_array_object */
+
+  jsonCount(jo,"glBindVertexArray",glBindVertexArray);
+  jsonCount(jo,"glDeleteVertexArrays",glDeleteVertexArrays);
+  jsonCount(jo,"glGenVertexArrays",glGenVertexArrays);
+  jsonCount(jo,"glIsVertexArray",glIsVertexArray);
+
+/* GL_ARB_vertex_attrib_64bit */
+
+  jsonCount(jo,"glGetVertexAttribLdv",glGetVertexAttribLdv);
+  jsonCount(jo,"glVertexAttribL1d",glVertexAttribL1d);
+  jsonCount(jo,"glVertexAttribL1dv",glVertexAttribL1dv);
+  jsonCount(jo,"glVertexAttribL2d",glVertexAttribL2d);
+  jsonCount(jo,"glVertexAttribL2dv",glVertexAttribL2dv);
+  jsonCount(jo,"glVertexAttribL3d",glVertexAttribL3d);
+  jsonCount(jo,"glVertexAttribL3dv",glVertexAttribL3dv);
+  jsonCount(jo,"glVertexAttribL4d",glVertexAttribL4d);
+  jsonCount(jo,"glVertexAttribL4dv",glVertexAttribL4dv);
+  jsonCount(jo,"glVertexAttribLPointer",glVertexAttribLPointer);
+
+/* GL_ARB_vertex_attrib_binding */
+
+  jsonCount(jo,"glBindVertexBuffer",glBindVertexBuffer);
+  jsonCount(jo,"glVertexArrayBindVertexBufferEXT",glVertexArrayBindVertexBufferEXT);
+  jsonCount(jo,"glVertexArrayVertexAttribBindingEXT",glVertexArrayVertexAttribBindingEXT);
+  jsonCount(jo,"glVertexArrayVertexAttribFormatEXT",glVertexArrayVertexAttribFormatEXT);
+  jsonCount(jo,"glVertexArrayVertexAttribIFormatEXT",glVertexArrayVertexAttribIFormatEXT);
+  jsonCount(jo,"glVertexArrayVertexAttribLFormatEXT",glVertexArrayVertexAttribLFormatEXT);
+  jsonCount(jo,"glVertexArrayVertexBindingDivisorEXT",glVertexArrayVertexBindingDivisorEXT);
+  jsonCount(jo,"glVertexAttribBinding",glVertexAttribBinding);
+  jsonCount(jo,"glVertexAttribFormat",glVertexAttribFormat);
+  jsonCount(jo,"glVertexAttribIFormat",glVertexAttribIFormat);
+  jsonCount(jo,"glVertexAttribLFormat",glVertexAttribLFormat);
+  jsonCount(jo,"glVertexBindingDivisor",glVertexBindingDivisor);
+
+/* GL_ARB_vertex_blend */
+
+  jsonCount(jo,"glVertexBlendARB",glVertexBlendARB);
+  jsonCount(jo,"glWeightPointerARB",glWeightPointerARB);
+  jsonCount(jo,"glWeightbvARB",glWeightbvARB);
+  jsonCount(jo,"glWeightdvARB",glWeightdvARB);
+  jsonCount(jo,"glWeightfvARB",glWeightfvARB);
+  jsonCount(jo,"glWeightivARB",glWeightivARB);
+  jsonCount(jo,"glWeightsvARB",glWeightsvARB);
+  jsonCount(jo,"glWeightubvARB",glWeightubvARB);
+  jsonCount(jo,"glWeightuivARB",glWeightuivARB);
+  jsonCount(jo,"glWeightusvARB",glWeightusvARB);
+
+/* GL_ARB_vertex_buffer_object */
+
+  jsonCount(jo,"glBindBufferARB",glBindBufferARB);
+  jsonCount(jo,"glBufferDataARB",glBufferDataARB);
+  jsonCount(jo,"glBufferSubDataARB",glBufferSubDataARB);
+  jsonCount(jo,"glDeleteBuffersARB",glDeleteBuffersARB);
+  jsonCount(jo,"glGenBuffersARB",glGenBuffersARB);
+  jsonCount(jo,"glGetBufferParameterivARB",glGetBufferParameterivARB);
+  jsonCount(jo,"glGetBufferPointervARB",glGetBufferPointervARB);
+  jsonCount(jo,"glGetBufferSubDataARB",glGetBufferSubDataARB);
+  jsonCount(jo,"glIsBufferARB",glIsBufferARB);
+  jsonCount(jo,"glMapBufferARB",glMapBufferARB);
+  jsonCount(jo,"glUnmapBufferARB",glUnmapBufferARB);
+
+/* GL_ARB_vertex_program */
+
+  jsonCount(jo,"glBindProgramARB",glBindProgramARB);
+  jsonCount(jo,"glDeleteProgramsARB",glDeleteProgramsARB);
+  jsonCount(jo,"glDisableVertexAttribArrayARB",glDisableVertexAttribArrayARB);
+  jsonCount(jo,"glEnableVertexAttribArrayARB",glEnableVertexAttribArrayARB);
+  jsonCount(jo,"glGenProgramsARB",glGenProgramsARB);
+  jsonCount(jo,"glGetProgramEnvParameterdvARB",glGetProgramEnvParameterdvARB);
+  jsonCount(jo,"glGetProgramEnvParameterfvARB",glGetProgramEnvParameterfvARB);
+  jsonCount(jo,"glGetProgramLocalParameterdvARB",glGetProgramLocalParameterdvARB);
+  jsonCount(jo,"glGetProgramLocalParameterfvARB",glGetProgramLocalParameterfvARB);
+  jsonCount(jo,"glGetProgramStringARB",glGetProgramStringARB);
+  jsonCount(jo,"glGetProgramivARB",glGetProgramivARB);
+  jsonCount(jo,"glGetVertexAttribPointervARB",glGetVertexAttribPointervARB);
+  jsonCount(jo,"glGetVertexAttribdvARB",glGetVertexAttribdvARB);
+  jsonCount(jo,"glGetVertexAttribfvARB",glGetVertexAttribfvARB);
+  jsonCount(jo,"glGetVertexAttribivARB",glGetVertexAttribivARB);
+  jsonCount(jo,"glIsProgramARB",glIsProgramARB);
+  jsonCount(jo,"glProgramEnvParameter4dARB",glProgramEnvParameter4dARB);
+  jsonCount(jo,"glProgramEnvParameter4dvARB",glProgramEnvParameter4dvARB);
+  jsonCount(jo,"glProgramEnvParameter4fARB",glProgramEnvParameter4fARB);
+  jsonCount(jo,"glProgramEnvParameter4fvARB",glProgramEnvParameter4fvARB);
+  jsonCount(jo,"glProgramLocalParameter4dARB",glProgramLocalParameter4dARB);
+  jsonCount(jo,"glProgramLocalParameter4dvARB",glProgramLocalParameter4dvARB);
+  jsonCount(jo,"glProgramLocalParameter4fARB",glProgramLocalParameter4fARB);
+  jsonCount(jo,"glProgramLocalParameter4fvARB",glProgramLocalParameter4fvARB);
+  jsonCount(jo,"glProgramStringARB",glProgramStringARB);
+  jsonCount(jo,"glVertexAttrib1dARB",glVertexAttrib1dARB);
+  jsonCount(jo,"glVertexAttrib1dvARB",glVertexAttrib1dvARB);
+  jsonCount(jo,"glVertexAttrib1fARB",glVertexAttrib1fARB);
+  jsonCount(jo,"glVertexAttrib1fvARB",glVertexAttrib1fvARB);
+  jsonCount(jo,"glVertexAttrib1sARB",glVertexAttrib1sARB);
+  jsonCount(jo,"glVertexAttrib1svARB",glVertexAttrib1svARB);
+  jsonCount(jo,"glVertexAttrib2dARB",glVertexAttrib2dARB);
+  jsonCount(jo,"glVertexAttrib2dvARB",glVertexAttrib2dvARB);
+  jsonCount(jo,"glVertexAttrib2fARB",glVertexAttrib2fARB);
+  jsonCount(jo,"glVertexAttrib2fvARB",glVertexAttrib2fvARB);
+  jsonCount(jo,"glVertexAttrib2sARB",glVertexAttrib2sARB);
+  jsonCount(jo,"glVertexAttrib2svARB",glVertexAttrib2svARB);
+  jsonCount(jo,"glVertexAttrib3dARB",glVertexAttrib3dARB);
+  jsonCount(jo,"glVertexAttrib3dvARB",glVertexAttrib3dvARB);
+  jsonCount(jo,"glVertexAttrib3fARB",glVertexAttrib3fARB);
+  jsonCount(jo,"glVertexAttrib3fvARB",glVertexAttrib3fvARB);
+  jsonCount(jo,"glVertexAttrib3sARB",glVertexAttrib3sARB);
+  jsonCount(jo,"glVertexAttrib3svARB",glVertexAttrib3svARB);
+  jsonCount(jo,"glVertexAttrib4NbvARB",glVertexAttrib4NbvARB);
+  jsonCount(jo,"glVertexAttrib4NivARB",glVertexAttrib4NivARB);
+  jsonCount(jo,"glVertexAttrib4NsvARB",glVertexAttrib4NsvARB);
+  jsonCount(jo,"glVertexAttrib4NubARB",glVertexAttrib4NubARB);
+  jsonCount(jo,"glVertexAttrib4NubvARB",glVertexAttrib4NubvARB);
+  jsonCount(jo,"glVertexAttrib4NuivARB",glVertexAttrib4NuivARB);
+  jsonCount(jo,"glVertexAttrib4NusvARB",glVertexAttrib4NusvARB);
+  jsonCount(jo,"glVertexAttrib4bvARB",glVertexAttrib4bvARB);
+  jsonCount(jo,"glVertexAttrib4dARB",glVertexAttrib4dARB);
+  jsonCount(jo,"glVertexAttrib4dvARB",glVertexAttrib4dvARB);
+  jsonCount(jo,"glVertexAttrib4fARB",glVertexAttrib4fARB);
+  jsonCount(jo,"glVertexAttrib4fvARB",glVertexAttrib4fvARB);
+  jsonCount(jo,"glVertexAttrib4ivARB",glVertexAttrib4ivARB);
+  jsonCount(jo,"glVertexAttrib4sARB",glVertexAttrib4sARB);
+  jsonCount(jo,"glVertexAttrib4svARB",glVertexAttrib4svARB);
+  jsonCount(jo,"glVertexAttrib4ubvARB",glVertexAttrib4ubvARB);
+  jsonCount(jo,"glVertexAttrib4uivARB",glVertexAttrib4uivARB);
+  jsonCount(jo,"glVertexAttrib4usvARB",glVertexAttrib4usvARB);
+  jsonCount(jo,"glVertexAttribPointerARB",glVertexAttribPointerARB);
+
+/* GL_ARB_vertex_shader */
+
+  jsonCount(jo,"glBindAttribLocationARB",glBindAttribLocationARB);
+  jsonCount(jo,"glGetActiveAttribARB",glGetActiveAttribARB);
+  jsonCount(jo,"glGetAttribLocationARB",glGetAttribLocationARB);
+
+/* GL_ARB_vertex_type_2_10_10_10_rev */
+
+  jsonCount(jo,"glColorP3ui",glColorP3ui);
+  jsonCount(jo,"glColorP3uiv",glColorP3uiv);
+  jsonCount(jo,"glColorP4ui",glColorP4ui);
+  jsonCount(jo,"glColorP4uiv",glColorP4uiv);
+  jsonCount(jo,"glMultiTexCoordP1ui",glMultiTexCoordP1ui);
+  jsonCount(jo,"glMultiTexCoordP1uiv",glMultiTexCoordP1uiv);
+  jsonCount(jo,"glMultiTexCoordP2ui",glMultiTexCoordP2ui);
+  jsonCount(jo,"glMultiTexCoordP2uiv",glMultiTexCoordP2uiv);
+  jsonCount(jo,"glMultiTexCoordP3ui",glMultiTexCoordP3ui);
+  jsonCount(jo,"glMultiTexCoordP3uiv",glMultiTexCoordP3uiv);
+  jsonCount(jo,"glMultiTexCoordP4ui",glMultiTexCoordP4ui);
+  jsonCount(jo,"glMultiTexCoordP4uiv",glMultiTexCoordP4uiv);
+  jsonCount(jo,"glNormalP3ui",glNormalP3ui);
+  jsonCount(jo,"glNormalP3uiv",glNormalP3uiv);
+  jsonCount(jo,"glSecondaryColorP3ui",glSecondaryColorP3ui);
+  jsonCount(jo,"glSecondaryColorP3uiv",glSecondaryColorP3uiv);
+  jsonCount(jo,"glTexCoordP1ui",glTexCoordP1ui);
+  jsonCount(jo,"glTexCoordP1uiv",glTexCoordP1uiv);
+  jsonCount(jo,"glTexCoordP2ui",glTexCoordP2ui);
+  jsonCount(jo,"glTexCoordP2uiv",glTexCoordP2uiv);
+  jsonCount(jo,"glTexCoordP3ui",glTexCoordP3ui);
+  jsonCount(jo,"glTexCoordP3uiv",glTexCoordP3uiv);
+  jsonCount(jo,"glTexCoordP4ui",glTexCoordP4ui);
+  jsonCount(jo,"glTexCoordP4uiv",glTexCoordP4uiv);
+  jsonCount(jo,"glVertexAttribP1ui",glVertexAttribP1ui);
+  jsonCount(jo,"glVertexAttribP1uiv",glVertexAttribP1uiv);
+  jsonCount(jo,"glVertexAttribP2ui",glVertexAttribP2ui);
+  jsonCount(jo,"glVertexAttribP2uiv",glVertexAttribP2uiv);
+  jsonCount(jo,"glVertexAttribP3ui",glVertexAttribP3ui);
+  jsonCount(jo,"glVertexAttribP3uiv",glVertexAttribP3uiv);
+  jsonCount(jo,"glVertexAttribP4ui",glVertexAttribP4ui);
+  jsonCount(jo,"glVertexAttribP4uiv",glVertexAttribP4uiv);
+  jsonCount(jo,"glVertexP2ui",glVertexP2ui);
+  jsonCount(jo,"glVertexP2uiv",glVertexP2uiv);
+  jsonCount(jo,"glVertexP3ui",glVertexP3ui);
+  jsonCount(jo,"glVertexP3uiv",glVertexP3uiv);
+  jsonCount(jo,"glVertexP4ui",glVertexP4ui);
+  jsonCount(jo,"glVertexP4uiv",glVertexP4uiv);
+
+/* GL_ARB_viewport_array */
+
+  jsonCount(jo,"glDepthRangeArrayv",glDepthRangeArrayv);
+  jsonCount(jo,"glDepthRangeIndexed",glDepthRangeIndexed);
+  jsonCount(jo,"glGetDoublei_v",glGetDoublei_v);
+  jsonCount(jo,"glGetFloati_v",glGetFloati_v);
+  jsonCount(jo,"glScissorArrayv",glScissorArrayv);
+  jsonCount(jo,"glScissorIndexed",glScissorIndexed);
+  jsonCount(jo,"glScissorIndexedv",glScissorIndexedv);
+  jsonCount(jo,"glViewportArrayv",glViewportArrayv);
+  jsonCount(jo,"glViewportIndexedf",glViewportIndexedf);
+  jsonCount(jo,"glViewportIndexedfv",glViewportIndexedfv);
+
+/* GL_ARB_window_pos */
+
+  jsonCount(jo,"glWindowPos2dARB",glWindowPos2dARB);
+  jsonCount(jo,"glWindowPos2dvARB",glWindowPos2dvARB);
+  jsonCount(jo,"glWindowPos2fARB",glWindowPos2fARB);
+  jsonCount(jo,"glWindowPos2fvARB",glWindowPos2fvARB);
+  jsonCount(jo,"glWindowPos2iARB",glWindowPos2iARB);
+  jsonCount(jo,"glWindowPos2ivARB",glWindowPos2ivARB);
+  jsonCount(jo,"glWindowPos2sARB",glWindowPos2sARB);
+  jsonCount(jo,"glWindowPos2svARB",glWindowPos2svARB);
+  jsonCount(jo,"glWindowPos3dARB",glWindowPos3dARB);
+  jsonCount(jo,"glWindowPos3dvARB",glWindowPos3dvARB);
+  jsonCount(jo,"glWindowPos3fARB",glWindowPos3fARB);
+  jsonCount(jo,"glWindowPos3fvARB",glWindowPos3fvARB);
+  jsonCount(jo,"glWindowPos3iARB",glWindowPos3iARB);
+  jsonCount(jo,"glWindowPos3ivARB",glWindowPos3ivARB);
+  jsonCount(jo,"glWindowPos3sARB",glWindowPos3sARB);
+  jsonCount(jo,"glWindowPos3svARB",glWindowPos3svARB);
+
+/* GL_ATI_draw_buffers */
+
+  jsonCount(jo,"glDrawBuffersATI",glDrawBuffersATI);
+
+/* GL_ATI_element_array */
+
+  jsonCount(jo,"glDrawElementArrayATI",glDrawElementArrayATI);
+  jsonCount(jo,"glDrawRangeElementArrayATI",glDrawRangeElementArrayATI);
+  jsonCount(jo,"glElementPointerATI",glElementPointerATI);
+
+/* GL_ATI_envmap_bumpmap */
+
+  jsonCount(jo,"glGetTexBumpParameterfvATI",glGetTexBumpParameterfvATI);
+  jsonCount(jo,"glGetTexBumpParameterivATI",glGetTexBumpParameterivATI);
+  jsonCount(jo,"glTexBumpParameterfvATI",glTexBumpParameterfvATI);
+  jsonCount(jo,"glTexBumpParameterivATI",glTexBumpParameterivATI);
+
+/* GL_ATI_fragment_shader */
+
+  jsonCount(jo,"glAlphaFragmentOp1ATI",glAlphaFragmentOp1ATI);
+  jsonCount(jo,"glAlphaFragmentOp2ATI",glAlphaFragmentOp2ATI);
+  jsonCount(jo,"glAlphaFragmentOp3ATI",glAlphaFragmentOp3ATI);
+  jsonCount(jo,"glBeginFragmentShaderATI",glBeginFragmentShaderATI);
+  jsonCount(jo,"glBindFragmentShaderATI",glBindFragmentShaderATI);
+  jsonCount(jo,"glColorFragmentOp1ATI",glColorFragmentOp1ATI);
+  jsonCount(jo,"glColorFragmentOp2ATI",glColorFragmentOp2ATI);
+  jsonCount(jo,"glColorFragmentOp3ATI",glColorFragmentOp3ATI);
+  jsonCount(jo,"glDeleteFragmentShaderATI",glDeleteFragmentShaderATI);
+  jsonCount(jo,"glEndFragmentShaderATI",glEndFragmentShaderATI);
+  jsonCount(jo,"glGenFragmentShadersATI",glGenFragmentShadersATI);
+  jsonCount(jo,"glPassTexCoordATI",glPassTexCoordATI);
+  jsonCount(jo,"glSampleMapATI",glSampleMapATI);
+  jsonCount(jo,"glSetFragmentShaderConstantATI",glSetFragmentShaderConstantATI);
+
+/* GL_ATI_map_object_buffer */
+
+  jsonCount(jo,"glMapObjectBufferATI",glMapObjectBufferATI);
+  jsonCount(jo,"glUnmapObjectBufferATI",glUnmapObjectBufferATI);
+
+/* GL_ATI_pn_triangles */
+
+  jsonCount(jo,"glPNTrianglesfATI",glPNTrianglesfATI);
+  jsonCount(jo,"glPNTrianglesiATI",glPNTrianglesiATI);
+
+/* GL_ATI_separate_stencil */
+
+  jsonCount(jo,"glStencilFuncSeparateATI",glStencilFuncSeparateATI);
+  jsonCount(jo,"glStencilOpSeparateATI",glStencilOpSeparateATI);
+
+/* GL_ATI_vertex_array_object */
+
+  jsonCount(jo,"glArrayObjectATI",glArrayObjectATI);
+  jsonCount(jo,"glFreeObjectBufferATI",glFreeObjectBufferATI);
+  jsonCount(jo,"glGetArrayObjectfvATI",glGetArrayObjectfvATI);
+  jsonCount(jo,"glGetArrayObjectivATI",glGetArrayObjectivATI);
+  jsonCount(jo,"glGetObjectBufferfvATI",glGetObjectBufferfvATI);
+  jsonCount(jo,"glGetObjectBufferivATI",glGetObjectBufferivATI);
+  jsonCount(jo,"glGetVariantArrayObjectfvATI",glGetVariantArrayObjectfvATI);
+  jsonCount(jo,"glGetVariantArrayObjectivATI",glGetVariantArrayObjectivATI);
+  jsonCount(jo,"glIsObjectBufferATI",glIsObjectBufferATI);
+  jsonCount(jo,"glNewObjectBufferATI",glNewObjectBufferATI);
+  jsonCount(jo,"glUpdateObjectBufferATI",glUpdateObjectBufferATI);
+  jsonCount(jo,"glVariantArrayObjectATI",glVariantArrayObjectATI);
+
+/* GL_ATI_vertex_attrib_array_object */
+
+  jsonCount(jo,"glGetVertexAttribArrayObjectfvATI",glGetVertexAttribArrayObjectfvATI);
+  jsonCount(jo,"glGetVertexAttribArrayObjectivATI",glGetVertexAttribArrayObjectivATI);
+  jsonCount(jo,"glVertexAttribArrayObjectATI",glVertexAttribArrayObjectATI);
+
+/* GL_ATI_vertex_streams */
+
+  jsonCount(jo,"glClientActiveVertexStreamATI",glClientActiveVertexStreamATI);
+  jsonCount(jo,"glNormalStream3bATI",glNormalStream3bATI);
+  jsonCount(jo,"glNormalStream3bvATI",glNormalStream3bvATI);
+  jsonCount(jo,"glNormalStream3dATI",glNormalStream3dATI);
+  jsonCount(jo,"glNormalStream3dvATI",glNormalStream3dvATI);
+  jsonCount(jo,"glNormalStream3fATI",glNormalStream3fATI);
+  jsonCount(jo,"glNormalStream3fvATI",glNormalStream3fvATI);
+  jsonCount(jo,"glNormalStream3iATI",glNormalStream3iATI);
+  jsonCount(jo,"glNormalStream3ivATI",glNormalStream3ivATI);
+  jsonCount(jo,"glNormalStream3sATI",glNormalStream3sATI);
+  jsonCount(jo,"glNormalStream3svATI",glNormalStream3svATI);
+  jsonCount(jo,"glVertexBlendEnvfATI",glVertexBlendEnvfATI);
+  jsonCount(jo,"glVertexBlendEnviATI",glVertexBlendEnviATI);
+  jsonCount(jo,"glVertexStream1dATI",glVertexStream1dATI);
+  jsonCount(jo,"glVertexStream1dvATI",glVertexStream1dvATI);
+  jsonCount(jo,"glVertexStream1fATI",glVertexStream1fATI);
+  jsonCount(jo,"glVertexStream1fvATI",glVertexStream1fvATI);
+  jsonCount(jo,"glVertexStream1iATI",glVertexStream1iATI);
+  jsonCount(jo,"glVertexStream1ivATI",glVertexStream1ivATI);
+  jsonCount(jo,"glVertexStream1sATI",glVertexStream1sATI);
+  jsonCount(jo,"glVertexStream1svATI",glVertexStream1svATI);
+  jsonCount(jo,"glVertexStream2dATI",glVertexStream2dATI);
+  jsonCount(jo,"glVertexStream2dvATI",glVertexStream2dvATI);
+  jsonCount(jo,"glVertexStream2fATI",glVertexStream2fATI);
+  jsonCount(jo,"glVertexStream2fvATI",glVertexStream2fvATI);
+  jsonCount(jo,"glVertexStream2iATI",glVertexStream2iATI);
+  jsonCount(jo,"glVertexStream2ivATI",glVertexStream2ivATI);
+  jsonCount(jo,"glVertexStream2sATI",glVertexStream2sATI);
+  jsonCount(jo,"glVertexStream2svATI",glVertexStream2svATI);
+  jsonCount(jo,"glVertexStream3dATI",glVertexStream3dATI);
+  jsonCount(jo,"glVertexStream3dvATI",glVertexStream3dvATI);
+  jsonCount(jo,"glVertexStream3fATI",glVertexStream3fATI);
+  jsonCount(jo,"glVertexStream3fvATI",glVertexStream3fvATI);
+  jsonCount(jo,"glVertexStream3iATI",glVertexStream3iATI);
+  jsonCount(jo,"glVertexStream3ivATI",glVertexStream3ivATI);
+  jsonCount(jo,"glVertexStream3sATI",glVertexStream3sATI);
+  jsonCount(jo,"glVertexStream3svATI",glVertexStream3svATI);
+  jsonCount(jo,"glVertexStream4dATI",glVertexStream4dATI);
+  jsonCount(jo,"glVertexStream4dvATI",glVertexStream4dvATI);
+  jsonCount(jo,"glVertexStream4fATI",glVertexStream4fATI);
+  jsonCount(jo,"glVertexStream4fvATI",glVertexStream4fvATI);
+  jsonCount(jo,"glVertexStream4iATI",glVertexStream4iATI);
+  jsonCount(jo,"glVertexStream4ivATI",glVertexStream4ivATI);
+  jsonCount(jo,"glVertexStream4sATI",glVertexStream4sATI);
+  jsonCount(jo,"glVertexStream4svATI",glVertexStream4svATI);
+
+/* GL_EXT_bindable_uniform */
+
+  jsonCount(jo,"glGetUniformBufferSizeEXT",glGetUniformBufferSizeEXT);
+  jsonCount(jo,"glGetUniformOffsetEXT",glGetUniformOffsetEXT);
+  jsonCount(jo,"glUniformBufferEXT",glUniformBufferEXT);
+
+/* GL_EXT_blend_color */
+
+  jsonCount(jo,"glBlendColorEXT",glBlendColorEXT);
+
+/* GL_EXT_blend_equation_separate */
+
+  jsonCount(jo,"glBlendEquationSeparateEXT",glBlendEquationSeparateEXT);
+
+/* GL_EXT_blend_func_separate */
+
+  jsonCount(jo,"glBlendFuncSeparateEXT",glBlendFuncSeparateEXT);
+
+/* GL_EXT_blend_minmax */
+
+  jsonCount(jo,"glBlendEquationEXT",glBlendEquationEXT);
+
+/* GL_EXT_color_subtable */
+
+  jsonCount(jo,"glColorSubTableEXT",glColorSubTableEXT);
+  jsonCount(jo,"glCopyColorSubTableEXT",glCopyColorSubTableEXT);
+
+/* GL_EXT_compiled_vertex_array */
+
+  jsonCount(jo,"glLockArraysEXT",glLockArraysEXT);
+  jsonCount(jo,"glUnlockArraysEXT",glUnlockArraysEXT);
+
+/* GL_EXT_convolution */
+
+  jsonCount(jo,"glConvolutionFilter1DEXT",glConvolutionFilter1DEXT);
+  jsonCount(jo,"glConvolutionFilter2DEXT",glConvolutionFilter2DEXT);
+  jsonCount(jo,"glConvolutionParameterfEXT",glConvolutionParameterfEXT);
+  jsonCount(jo,"glConvolutionParameterfvEXT",glConvolutionParameterfvEXT);
+  jsonCount(jo,"glConvolutionParameteriEXT",glConvolutionParameteriEXT);
+  jsonCount(jo,"glConvolutionParameterivEXT",glConvolutionParameterivEXT);
+  jsonCount(jo,"glCopyConvolutionFilter1DEXT",glCopyConvolutionFilter1DEXT);
+  jsonCount(jo,"glCopyConvolutionFilter2DEXT",glCopyConvolutionFilter2DEXT);
+  jsonCount(jo,"glGetConvolutionFilterEXT",glGetConvolutionFilterEXT);
+  jsonCount(jo,"glGetConvolutionParameterfvEXT",glGetConvolutionParameterfvEXT);
+  jsonCount(jo,"glGetConvolutionParameterivEXT",glGetConvolutionParameterivEXT);
+  jsonCount(jo,"glGetSeparableFilterEXT",glGetSeparableFilterEXT);
+  jsonCount(jo,"glSeparableFilter2DEXT",glSeparableFilter2DEXT);
+
+/* GL_EXT_coordinate_frame */
+
+  jsonCount(jo,"glBinormal3bEXT",glBinormal3bEXT);
+  jsonCount(jo,"glBinormal3bvEXT",glBinormal3bvEXT);
+  jsonCount(jo,"glBinormal3dEXT",glBinormal3dEXT);
+  jsonCount(jo,"glBinormal3dvEXT",glBinormal3dvEXT);
+  jsonCount(jo,"glBinormal3fEXT",glBinormal3fEXT);
+  jsonCount(jo,"glBinormal3fvEXT",glBinormal3fvEXT);
+  jsonCount(jo,"glBinormal3iEXT",glBinormal3iEXT);
+  jsonCount(jo,"glBinormal3ivEXT",glBinormal3ivEXT);
+  jsonCount(jo,"glBinormal3sEXT",glBinormal3sEXT);
+  jsonCount(jo,"glBinormal3svEXT",glBinormal3svEXT);
+  jsonCount(jo,"glBinormalPointerEXT",glBinormalPointerEXT);
+  jsonCount(jo,"glTangent3bEXT",glTangent3bEXT);
+  jsonCount(jo,"glTangent3bvEXT",glTangent3bvEXT);
+  jsonCount(jo,"glTangent3dEXT",glTangent3dEXT);
+  jsonCount(jo,"glTangent3dvEXT",glTangent3dvEXT);
+  jsonCount(jo,"glTangent3fEXT",glTangent3fEXT);
+  jsonCount(jo,"glTangent3fvEXT",glTangent3fvEXT);
+  jsonCount(jo,"glTangent3iEXT",glTangent3iEXT);
+  jsonCount(jo,"glTangent3ivEXT",glTangent3ivEXT);
+  jsonCount(jo,"glTangent3sEXT",glTangent3sEXT);
+  jsonCount(jo,"glTangent3svEXT",glTangent3svEXT);
+  jsonCount(jo,"glTangentPointerEXT",glTangentPointerEXT);
+
+/* GL_EXT_copy_texture */
+
+  jsonCount(jo,"glCopyTexImage1DEXT",glCopyTexImage1DEXT);
+  jsonCount(jo,"glCopyTexImage2DEXT",glCopyTexImage2DEXT);
+  jsonCount(jo,"glCopyTexSubImage1DEXT",glCopyTexSubImage1DEXT);
+  jsonCount(jo,"glCopyTexSubImage2DEXT",glCopyTexSubImage2DEXT);
+  jsonCount(jo,"glCopyTexSubImage3DEXT",glCopyTexSubImage3DEXT);
+
+/* GL_EXT_cull_vertex */
+
+  jsonCount(jo,"glCullParameterdvEXT",glCullParameterdvEXT);
+  jsonCount(jo,"glCullParameterfvEXT",glCullParameterfvEXT);
+
+/* GL_EXT_debug_label */
+
+  jsonCount(jo,"glGetObjectLabelEXT",glGetObjectLabelEXT);
+  jsonCount(jo,"glLabelObjectEXT",glLabelObjectEXT);
+
+/* GL_EXT_debug_marker */
+
+  jsonCount(jo,"glInsertEventMarkerEXT",glInsertEventMarkerEXT);
+  jsonCount(jo,"glPopGroupMarkerEXT",glPopGroupMarkerEXT);
+  jsonCount(jo,"glPushGroupMarkerEXT",glPushGroupMarkerEXT);
+
+/* GL_EXT_depth_bounds_test */
+
+  jsonCount(jo,"glDepthBoundsEXT",glDepthBoundsEXT);
+
+/* GL_EXT_direct_state_access */
+
+  jsonCount(jo,"glBindMultiTextureEXT",glBindMultiTextureEXT);
+  jsonCount(jo,"glCheckNamedFramebufferStatusEXT",glCheckNamedFramebufferStatusEXT);
+  jsonCount(jo,"glClientAttribDefaultEXT",glClientAttribDefaultEXT);
+  jsonCount(jo,"glCompressedMultiTexImage1DEXT",glCompressedMultiTexImage1DEXT);
+  jsonCount(jo,"glCompressedMultiTexImage2DEXT",glCompressedMultiTexImage2DEXT);
+  jsonCount(jo,"glCompressedMultiTexImage3DEXT",glCompressedMultiTexImage3DEXT);
+  jsonCount(jo,"glCompressedMultiTexSubImage1DEXT",glCompressedMultiTexSubImage1DEXT);
+  jsonCount(jo,"glCompressedMultiTexSubImage2DEXT",glCompressedMultiTexSubImage2DEXT);
+  jsonCount(jo,"glCompressedMultiTexSubImage3DEXT",glCompressedMultiTexSubImage3DEXT);
+  jsonCount(jo,"glCompressedTextureImage1DEXT",glCompressedTextureImage1DEXT);
+  jsonCount(jo,"glCompressedTextureImage2DEXT",glCompressedTextureImage2DEXT);
+  jsonCount(jo,"glCompressedTextureImage3DEXT",glCompressedTextureImage3DEXT);
+  jsonCount(jo,"glCompressedTextureSubImage1DEXT",glCompressedTextureSubImage1DEXT);
+  jsonCount(jo,"glCompressedTextureSubImage2DEXT",glCompressedTextureSubImage2DEXT);
+  jsonCount(jo,"glCompressedTextureSubImage3DEXT",glCompressedTextureSubImage3DEXT);
+  jsonCount(jo,"glCopyMultiTexImage1DEXT",glCopyMultiTexImage1DEXT);
+  jsonCount(jo,"glCopyMultiTexImage2DEXT",glCopyMultiTexImage2DEXT);
+  jsonCount(jo,"glCopyMultiTexSubImage1DEXT",glCopyMultiTexSubImage1DEXT);
+  jsonCount(jo,"glCopyMultiTexSubImage2DEXT",glCopyMultiTexSubImage2DEXT);
+  jsonCount(jo,"glCopyMultiTexSubImage3DEXT",glCopyMultiTexSubImage3DEXT);
+  jsonCount(jo,"glCopyTextureImage1DEXT",glCopyTextureImage1DEXT);
+  jsonCount(jo,"glCopyTextureImage2DEXT",glCopyTextureImage2DEXT);
+  jsonCount(jo,"glCopyTextureSubImage1DEXT",glCopyTextureSubImage1DEXT);
+  jsonCount(jo,"glCopyTextureSubImage2DEXT",glCopyTextureSubImage2DEXT);
+  jsonCount(jo,"glCopyTextureSubImage3DEXT",glCopyTextureSubImage3DEXT);
+  jsonCount(jo,"glDisableClientStateIndexedEXT",glDisableClientStateIndexedEXT);
+  jsonCount(jo,"glDisableClientStateiEXT",glDisableClientStateiEXT);
+  jsonCount(jo,"glDisableVertexArrayAttribEXT",glDisableVertexArrayAttribEXT);
+  jsonCount(jo,"glDisableVertexArrayEXT",glDisableVertexArrayEXT);
+  jsonCount(jo,"glEnableClientStateIndexedEXT",glEnableClientStateIndexedEXT);
+  jsonCount(jo,"glEnableClientStateiEXT",glEnableClientStateiEXT);
+  jsonCount(jo,"glEnableVertexArrayAttribEXT",glEnableVertexArrayAttribEXT);
+  jsonCount(jo,"glEnableVertexArrayEXT",glEnableVertexArrayEXT);
+  jsonCount(jo,"glFlushMappedNamedBufferRangeEXT",glFlushMappedNamedBufferRangeEXT);
+  jsonCount(jo,"glFramebufferDrawBufferEXT",glFramebufferDrawBufferEXT);
+  jsonCount(jo,"glFramebufferDrawBuffersEXT",glFramebufferDrawBuffersEXT);
+  jsonCount(jo,"glFramebufferReadBufferEXT",glFramebufferReadBufferEXT);
+  jsonCount(jo,"glGenerateMultiTexMipmapEXT",glGenerateMultiTexMipmapEXT);
+  jsonCount(jo,"glGenerateTextureMipmapEXT",glGenerateTextureMipmapEXT);
+  jsonCount(jo,"glGetCompressedMultiTexImageEXT",glGetCompressedMultiTexImageEXT);
+  jsonCount(jo,"glGetCompressedTextureImageEXT",glGetCompressedTextureImageEXT);
+  jsonCount(jo,"glGetDoubleIndexedvEXT",glGetDoubleIndexedvEXT);
+  jsonCount(jo,"glGetDoublei_vEXT",glGetDoublei_vEXT);
+  jsonCount(jo,"glGetFloatIndexedvEXT",glGetFloatIndexedvEXT);
+  jsonCount(jo,"glGetFloati_vEXT",glGetFloati_vEXT);
+  jsonCount(jo,"glGetFramebufferParameterivEXT",glGetFramebufferParameterivEXT);
+  jsonCount(jo,"glGetMultiTexEnvfvEXT",glGetMultiTexEnvfvEXT);
+  jsonCount(jo,"glGetMultiTexEnvivEXT",glGetMultiTexEnvivEXT);
+  jsonCount(jo,"glGetMultiTexGendvEXT",glGetMultiTexGendvEXT);
+  jsonCount(jo,"glGetMultiTexGenfvEXT",glGetMultiTexGenfvEXT);
+  jsonCount(jo,"glGetMultiTexGenivEXT",glGetMultiTexGenivEXT);
+  jsonCount(jo,"glGetMultiTexImageEXT",glGetMultiTexImageEXT);
+  jsonCount(jo,"glGetMultiTexLevelParameterfvEXT",glGetMultiTexLevelParameterfvEXT);
+  jsonCount(jo,"glGetMultiTexLevelParameterivEXT",glGetMultiTexLevelParameterivEXT);
+  jsonCount(jo,"glGetMultiTexParameterIivEXT",glGetMultiTexParameterIivEXT);
+  jsonCount(jo,"glGetMultiTexParameterIuivEXT",glGetMultiTexParameterIuivEXT);
+  jsonCount(jo,"glGetMultiTexParameterfvEXT",glGetMultiTexParameterfvEXT);
+  jsonCount(jo,"glGetMultiTexParameterivEXT",glGetMultiTexParameterivEXT);
+  jsonCount(jo,"glGetNamedBufferParameterivEXT",glGetNamedBufferParameterivEXT);
+  jsonCount(jo,"glGetNamedBufferPointervEXT",glGetNamedBufferPointervEXT);
+  jsonCount(jo,"glGetNamedBufferSubDataEXT",glGetNamedBufferSubDataEXT);
+  jsonCount(jo,"glGetNamedFramebufferAttachmentParameterivEXT",glGetNamedFramebufferAttachmentParameterivEXT);
+  jsonCount(jo,"glGetNamedProgramLocalParameterIivEXT",glGetNamedProgramLocalParameterIivEXT);
+  jsonCount(jo,"glGetNamedProgramLocalParameterIuivEXT",glGetNamedProgramLocalParameterIuivEXT);
+  jsonCount(jo,"glGetNamedProgramLocalParameterdvEXT",glGetNamedProgramLocalParameterdvEXT);
+  jsonCount(jo,"glGetNamedProgramLocalParameterfvEXT",glGetNamedProgramLocalParameterfvEXT);
+  jsonCount(jo,"glGetNamedProgramStringEXT",glGetNamedProgramStringEXT);
+  jsonCount(jo,"glGetNamedProgramivEXT",glGetNamedProgramivEXT);
+  jsonCount(jo,"glGetNamedRenderbufferParameterivEXT",glGetNamedRenderbufferParameterivEXT);
+  jsonCount(jo,"glGetPointerIndexedvEXT",glGetPointerIndexedvEXT);
+  jsonCount(jo,"glGetPointeri_vEXT",glGetPointeri_vEXT);
+  jsonCount(jo,"glGetTextureImageEXT",glGetTextureImageEXT);
+  jsonCount(jo,"glGetTextureLevelParameterfvEXT",glGetTextureLevelParameterfvEXT);
+  jsonCount(jo,"glGetTextureLevelParameterivEXT",glGetTextureLevelParameterivEXT);
+  jsonCount(jo,"glGetTextureParameterIivEXT",glGetTextureParameterIivEXT);
+  jsonCount(jo,"glGetTextureParameterIuivEXT",glGetTextureParameterIuivEXT);
+  jsonCount(jo,"glGetTextureParameterfvEXT",glGetTextureParameterfvEXT);
+  jsonCount(jo,"glGetTextureParameterivEXT",glGetTextureParameterivEXT);
+  jsonCount(jo,"glGetVertexArrayIntegeri_vEXT",glGetVertexArrayIntegeri_vEXT);
+  jsonCount(jo,"glGetVertexArrayIntegervEXT",glGetVertexArrayIntegervEXT);
+  jsonCount(jo,"glGetVertexArrayPointeri_vEXT",glGetVertexArrayPointeri_vEXT);
+  jsonCount(jo,"glGetVertexArrayPointervEXT",glGetVertexArrayPointervEXT);
+  jsonCount(jo,"glMapNamedBufferEXT",glMapNamedBufferEXT);
+  jsonCount(jo,"glMapNamedBufferRangeEXT",glMapNamedBufferRangeEXT);
+  jsonCount(jo,"glMatrixFrustumEXT",glMatrixFrustumEXT);
+  jsonCount(jo,"glMatrixLoadIdentityEXT",glMatrixLoadIdentityEXT);
+  jsonCount(jo,"glMatrixLoadTransposedEXT",glMatrixLoadTransposedEXT);
+  jsonCount(jo,"glMatrixLoadTransposefEXT",glMatrixLoadTransposefEXT);
+  jsonCount(jo,"glMatrixLoaddEXT",glMatrixLoaddEXT);
+  jsonCount(jo,"glMatrixLoadfEXT",glMatrixLoadfEXT);
+  jsonCount(jo,"glMatrixMultTransposedEXT",glMatrixMultTransposedEXT);
+  jsonCount(jo,"glMatrixMultTransposefEXT",glMatrixMultTransposefEXT);
+  jsonCount(jo,"glMatrixMultdEXT",glMatrixMultdEXT);
+  jsonCount(jo,"glMatrixMultfEXT",glMatrixMultfEXT);
+  jsonCount(jo,"glMatrixOrthoEXT",glMatrixOrthoEXT);
+  jsonCount(jo,"glMatrixPopEXT",glMatrixPopEXT);
+  jsonCount(jo,"glMatrixPushEXT",glMatrixPushEXT);
+  jsonCount(jo,"glMatrixRotatedEXT",glMatrixRotatedEXT);
+  jsonCount(jo,"glMatrixRotatefEXT",glMatrixRotatefEXT);
+  jsonCount(jo,"glMatrixScaledEXT",glMatrixScaledEXT);
+  jsonCount(jo,"glMatrixScalefEXT",glMatrixScalefEXT);
+  jsonCount(jo,"glMatrixTranslatedEXT",glMatrixTranslatedEXT);
+  jsonCount(jo,"glMatrixTranslatefEXT",glMatrixTranslatefEXT);
+  jsonCount(jo,"glMultiTexBufferEXT",glMultiTexBufferEXT);
+  jsonCount(jo,"glMultiTexCoordPointerEXT",glMultiTexCoordPointerEXT);
+  jsonCount(jo,"glMultiTexEnvfEXT",glMultiTexEnvfEXT);
+  jsonCount(jo,"glMultiTexEnvfvEXT",glMultiTexEnvfvEXT);
+  jsonCount(jo,"glMultiTexEnviEXT",glMultiTexEnviEXT);
+  jsonCount(jo,"glMultiTexEnvivEXT",glMultiTexEnvivEXT);
+  jsonCount(jo,"glMultiTexGendEXT",glMultiTexGendEXT);
+  jsonCount(jo,"glMultiTexGendvEXT",glMultiTexGendvEXT);
+  jsonCount(jo,"glMultiTexGenfEXT",glMultiTexGenfEXT);
+  jsonCount(jo,"glMultiTexGenfvEXT",glMultiTexGenfvEXT);
+  jsonCount(jo,"glMultiTexGeniEXT",glMultiTexGeniEXT);
+  jsonCount(jo,"glMultiTexGenivEXT",glMultiTexGenivEXT);
+  jsonCount(jo,"glMultiTexImage1DEXT",glMultiTexImage1DEXT);
+  jsonCount(jo,"glMultiTexImage2DEXT",glMultiTexImage2DEXT);
+  jsonCount(jo,"glMultiTexImage3DEXT",glMultiTexImage3DEXT);
+  jsonCount(jo,"glMultiTexParameterIivEXT",glMultiTexParameterIivEXT);
+  jsonCount(jo,"glMultiTexParameterIuivEXT",glMultiTexParameterIuivEXT);
+  jsonCount(jo,"glMultiTexParameterfEXT",glMultiTexParameterfEXT);
+  jsonCount(jo,"glMultiTexParameterfvEXT",glMultiTexParameterfvEXT);
+  jsonCount(jo,"glMultiTexParameteriEXT",glMultiTexParameteriEXT);
+  jsonCount(jo,"glMultiTexParameterivEXT",glMultiTexParameterivEXT);
+  jsonCount(jo,"glMultiTexRenderbufferEXT",glMultiTexRenderbufferEXT);
+  jsonCount(jo,"glMultiTexSubImage1DEXT",glMultiTexSubImage1DEXT);
+  jsonCount(jo,"glMultiTexSubImage2DEXT",glMultiTexSubImage2DEXT);
+  jsonCount(jo,"glMultiTexSubImage3DEXT",glMultiTexSubImage3DEXT);
+  jsonCount(jo,"glNamedBufferDataEXT",glNamedBufferDataEXT);
+  jsonCount(jo,"glNamedBufferSubDataEXT",glNamedBufferSubDataEXT);
+  jsonCount(jo,"glNamedCopyBufferSubDataEXT",glNamedCopyBufferSubDataEXT);
+  jsonCount(jo,"glNamedFramebufferRenderbufferEXT",glNamedFramebufferRenderbufferEXT);
+  jsonCount(jo,"glNamedFramebufferTexture1DEXT",glNamedFramebufferTexture1DEXT);
+  jsonCount(jo,"glNamedFramebufferTexture2DEXT",glNamedFramebufferTexture2DEXT);
+  jsonCount(jo,"glNamedFramebufferTexture3DEXT",glNamedFramebufferTexture3DEXT);
+  jsonCount(jo,"glNamedFramebufferTextureEXT",glNamedFramebufferTextureEXT);
+  jsonCount(jo,"glNamedFramebufferTextureFaceEXT",glNamedFramebufferTextureFaceEXT);
+  jsonCount(jo,"glNamedFramebufferTextureLayerEXT",glNamedFramebufferTextureLayerEXT);
+  jsonCount(jo,"glNamedProgramLocalParameter4dEXT",glNamedProgramLocalParameter4dEXT);
+  jsonCount(jo,"glNamedProgramLocalParameter4dvEXT",glNamedProgramLocalParameter4dvEXT);
+  jsonCount(jo,"glNamedProgramLocalParameter4fEXT",glNamedProgramLocalParameter4fEXT);
+  jsonCount(jo,"glNamedProgramLocalParameter4fvEXT",glNamedProgramLocalParameter4fvEXT);
+  jsonCount(jo,"glNamedProgramLocalParameterI4iEXT",glNamedProgramLocalParameterI4iEXT);
+  jsonCount(jo,"glNamedProgramLocalParameterI4ivEXT",glNamedProgramLocalParameterI4ivEXT);
+  jsonCount(jo,"glNamedProgramLocalParameterI4uiEXT",glNamedProgramLocalParameterI4uiEXT);
+  jsonCount(jo,"glNamedProgramLocalParameterI4uivEXT",glNamedProgramLocalParameterI4uivEXT);
+  jsonCount(jo,"glNamedProgramLocalParameters4fvEXT",glNamedProgramLocalParameters4fvEXT);
+  jsonCount(jo,"glNamedProgramLocalParametersI4ivEXT",glNamedProgramLocalParametersI4ivEXT);
+  jsonCount(jo,"glNamedProgramLocalParametersI4uivEXT",glNamedProgramLocalParametersI4uivEXT);
+  jsonCount(jo,"glNamedProgramStringEXT",glNamedProgramStringEXT);
+  jsonCount(jo,"glNamedRenderbufferStorageEXT",glNamedRenderbufferStorageEXT);
+  jsonCount(jo,"glNamedRenderbufferStorageMultisampleCoverageEXT",glNamedRenderbufferStorageMultisampleCoverageEXT);
+  jsonCount(jo,"glNamedRenderbufferStorageMultisampleEXT",glNamedRenderbufferStorageMultisampleEXT);
+  jsonCount(jo,"glProgramUniform1dEXT",glProgramUniform1dEXT);
+  jsonCount(jo,"glProgramUniform1dvEXT",glProgramUniform1dvEXT);
+  jsonCount(jo,"glProgramUniform1fEXT",glProgramUniform1fEXT);
+  jsonCount(jo,"glProgramUniform1fvEXT",glProgramUniform1fvEXT);
+  jsonCount(jo,"glProgramUniform1iEXT",glProgramUniform1iEXT);
+  jsonCount(jo,"glProgramUniform1ivEXT",glProgramUniform1ivEXT);
+  jsonCount(jo,"glProgramUniform1uiEXT",glProgramUniform1uiEXT);
+  jsonCount(jo,"glProgramUniform1uivEXT",glProgramUniform1uivEXT);
+  jsonCount(jo,"glProgramUniform2dEXT",glProgramUniform2dEXT);
+  jsonCount(jo,"glProgramUniform2dvEXT",glProgramUniform2dvEXT);
+  jsonCount(jo,"glProgramUniform2fEXT",glProgramUniform2fEXT);
+  jsonCount(jo,"glProgramUniform2fvEXT",glProgramUniform2fvEXT);
+  jsonCount(jo,"glProgramUniform2iEXT",glProgramUniform2iEXT);
+  jsonCount(jo,"glProgramUniform2ivEXT",glProgramUniform2ivEXT);
+  jsonCount(jo,"glProgramUniform2uiEXT",glProgramUniform2uiEXT);
+  jsonCount(jo,"glProgramUniform2uivEXT",glProgramUniform2uivEXT);
+  jsonCount(jo,"glProgramUniform3dEXT",glProgramUniform3dEXT);
+  jsonCount(jo,"glProgramUniform3dvEXT",glProgramUniform3dvEXT);
+  jsonCount(jo,"glProgramUniform3fEXT",glProgramUniform3fEXT);
+  jsonCount(jo,"glProgramUniform3fvEXT",glProgramUniform3fvEXT);
+  jsonCount(jo,"glProgramUniform3iEXT",glProgramUniform3iEXT);
+  jsonCount(jo,"glProgramUniform3ivEXT",glProgramUniform3ivEXT);
+  jsonCount(jo,"glProgramUniform3uiEXT",glProgramUniform3uiEXT);
+  jsonCount(jo,"glProgramUniform3uivEXT",glProgramUniform3uivEXT);
+  jsonCount(jo,"glProgramUniform4dEXT",glProgramUniform4dEXT);
+  jsonCount(jo,"glProgramUniform4dvEXT",glProgramUniform4dvEXT);
+  jsonCount(jo,"glProgramUniform4fEXT",glProgramUniform4fEXT);
+  jsonCount(jo,"glProgramUniform4fvEXT",glProgramUniform4fvEXT);
+  jsonCount(jo,"glProgramUniform4iEXT",glProgramUniform4iEXT);
+  jsonCount(jo,"glProgramUniform4ivEXT",glProgramUniform4ivEXT);
+  jsonCount(jo,"glProgramUniform4uiEXT",glProgramUniform4uiEXT);
+  jsonCount(jo,"glProgramUniform4uivEXT",glProgramUniform4uivEXT);
+  jsonCount(jo,"glProgramUniformMatrix2dvEXT",glProgramUniformMatrix2dvEXT);
+  jsonCount(jo,"glProgramUniformMatrix2fvEXT",glProgramUniformMatrix2fvEXT);
+  jsonCount(jo,"glProgramUniformMatrix2x3dvEXT",glProgramUniformMatrix2x3dvEXT);
+  jsonCount(jo,"glProgramUniformMatrix2x3fvEXT",glProgramUniformMatrix2x3fvEXT);
+  jsonCount(jo,"glProgramUniformMatrix2x4dvEXT",glProgramUniformMatrix2x4dvEXT);
+  jsonCount(jo,"glProgramUniformMatrix2x4fvEXT",glProgramUniformMatrix2x4fvEXT);
+  jsonCount(jo,"glProgramUniformMatrix3dvEXT",glProgramUniformMatrix3dvEXT);
+  jsonCount(jo,"glProgramUniformMatrix3fvEXT",glProgramUniformMatrix3fvEXT);
+  jsonCount(jo,"glProgramUniformMatrix3x2dvEXT",glProgramUniformMatrix3x2dvEXT);
+  jsonCount(jo,"glProgramUniformMatrix3x2fvEXT",glProgramUniformMatrix3x2fvEXT);
+  jsonCount(jo,"glProgramUniformMatrix3x4dvEXT",glProgramUniformMatrix3x4dvEXT);
+  jsonCount(jo,"glProgramUniformMatrix3x4fvEXT",glProgramUniformMatrix3x4fvEXT);
+  jsonCount(jo,"glProgramUniformMatrix4dvEXT",glProgramUniformMatrix4dvEXT);
+  jsonCount(jo,"glProgramUniformMatrix4fvEXT",glProgramUniformMatrix4fvEXT);
+  jsonCount(jo,"glProgramUniformMatrix4x2dvEXT",glProgramUniformMatrix4x2dvEXT);
+  jsonCount(jo,"glProgramUniformMatrix4x2fvEXT",glProgramUniformMatrix4x2fvEXT);
+  jsonCount(jo,"glProgramUniformMatrix4x3dvEXT",glProgramUniformMatrix4x3dvEXT);
+  jsonCount(jo,"glProgramUniformMatrix4x3fvEXT",glProgramUniformMatrix4x3fvEXT);
+  jsonCount(jo,"glPushClientAttribDefaultEXT",glPushClientAttribDefaultEXT);
+  jsonCount(jo,"glTextureBufferEXT",glTextureBufferEXT);
+  jsonCount(jo,"glTextureImage1DEXT",glTextureImage1DEXT);
+  jsonCount(jo,"glTextureImage2DEXT",glTextureImage2DEXT);
+  jsonCount(jo,"glTextureImage3DEXT",glTextureImage3DEXT);
+  jsonCount(jo,"glTextureParameterIivEXT",glTextureParameterIivEXT);
+  jsonCount(jo,"glTextureParameterIuivEXT",glTextureParameterIuivEXT);
+  jsonCount(jo,"glTextureParameterfEXT",glTextureParameterfEXT);
+  jsonCount(jo,"glTextureParameterfvEXT",glTextureParameterfvEXT);
+  jsonCount(jo,"glTextureParameteriEXT",glTextureParameteriEXT);
+  jsonCount(jo,"glTextureParameterivEXT",glTextureParameterivEXT);
+  jsonCount(jo,"glTextureRenderbufferEXT",glTextureRenderbufferEXT);
+  jsonCount(jo,"glTextureSubImage1DEXT",glTextureSubImage1DEXT);
+  jsonCount(jo,"glTextureSubImage2DEXT",glTextureSubImage2DEXT);
+  jsonCount(jo,"glTextureSubImage3DEXT",glTextureSubImage3DEXT);
+  jsonCount(jo,"glUnmapNamedBufferEXT",glUnmapNamedBufferEXT);
+  jsonCount(jo,"glVertexArrayColorOffsetEXT",glVertexArrayColorOffsetEXT);
+  jsonCount(jo,"glVertexArrayEdgeFlagOffsetEXT",glVertexArrayEdgeFlagOffsetEXT);
+  jsonCount(jo,"glVertexArrayFogCoordOffsetEXT",glVertexArrayFogCoordOffsetEXT);
+  jsonCount(jo,"glVertexArrayIndexOffsetEXT",glVertexArrayIndexOffsetEXT);
+  jsonCount(jo,"glVertexArrayMultiTexCoordOffsetEXT",glVertexArrayMultiTexCoordOffsetEXT);
+  jsonCount(jo,"glVertexArrayNormalOffsetEXT",glVertexArrayNormalOffsetEXT);
+  jsonCount(jo,"glVertexArraySecondaryColorOffsetEXT",glVertexArraySecondaryColorOffsetEXT);
+  jsonCount(jo,"glVertexArrayTexCoordOffsetEXT",glVertexArrayTexCoordOffsetEXT);
+  jsonCount(jo,"glVertexArrayVertexAttribIOffsetEXT",glVertexArrayVertexAttribIOffsetEXT);
+  jsonCount(jo,"glVertexArrayVertexAttribOffsetEXT",glVertexArrayVertexAttribOffsetEXT);
+  jsonCount(jo,"glVertexArrayVertexOffsetEXT",glVertexArrayVertexOffsetEXT);
+
+/* GL_EXT_discard_framebuffer */
+
+  jsonCount(jo,"glDiscardFramebufferEXT",glDiscardFramebufferEXT);
+
+/* GL_EXT_disjoint_timer_query */
+
+  jsonCount(jo,"glGetQueryObjectivEXT",glGetQueryObjectivEXT);
+  jsonCount(jo,"glQueryCounterEXT",glQueryCounterEXT);
+
+/* GL_EXT_draw_buffers2 */
+
+  jsonCount(jo,"glColorMaskIndexedEXT",glColorMaskIndexedEXT);
+  jsonCount(jo,"glDisableIndexedEXT",glDisableIndexedEXT);
+  jsonCount(jo,"glEnableIndexedEXT",glEnableIndexedEXT);
+  jsonCount(jo,"glGetBooleanIndexedvEXT",glGetBooleanIndexedvEXT);
+  jsonCount(jo,"glGetIntegerIndexedvEXT",glGetIntegerIndexedvEXT);
+  jsonCount(jo,"glIsEnabledIndexedEXT",glIsEnabledIndexedEXT);
+
+/* GL_EXT_draw_instanced */
+
+  jsonCount(jo,"glDrawArraysInstancedEXT",glDrawArraysInstancedEXT);
+  jsonCount(jo,"glDrawElementsInstancedEXT",glDrawElementsInstancedEXT);
+
+/* GL_EXT_draw_range_elements */
+
+  jsonCount(jo,"glDrawRangeElementsEXT",glDrawRangeElementsEXT);
+
+/* GL_EXT_fog_coord */
+
+  jsonCount(jo,"glFogCoordPointerEXT",glFogCoordPointerEXT);
+  jsonCount(jo,"glFogCoorddEXT",glFogCoorddEXT);
+  jsonCount(jo,"glFogCoorddvEXT",glFogCoorddvEXT);
+  jsonCount(jo,"glFogCoordfEXT",glFogCoordfEXT);
+  jsonCount(jo,"glFogCoordfvEXT",glFogCoordfvEXT);
+
+/* GL_EXT_fragment_lighting */
+
+  jsonCount(jo,"glFragmentColorMaterialEXT",glFragmentColorMaterialEXT);
+  jsonCount(jo,"glFragmentLightModelfEXT",glFragmentLightModelfEXT);
+  jsonCount(jo,"glFragmentLightModelfvEXT",glFragmentLightModelfvEXT);
+  jsonCount(jo,"glFragmentLightModeliEXT",glFragmentLightModeliEXT);
+  jsonCount(jo,"glFragmentLightModelivEXT",glFragmentLightModelivEXT);
+  jsonCount(jo,"glFragmentLightfEXT",glFragmentLightfEXT);
+  jsonCount(jo,"glFragmentLightfvEXT",glFragmentLightfvEXT);
+  jsonCount(jo,"glFragmentLightiEXT",glFragmentLightiEXT);
+  jsonCount(jo,"glFragmentLightivEXT",glFragmentLightivEXT);
+  jsonCount(jo,"glFragmentMaterialfEXT",glFragmentMaterialfEXT);
+  jsonCount(jo,"glFragmentMaterialfvEXT",glFragmentMaterialfvEXT);
+  jsonCount(jo,"glFragmentMaterialiEXT",glFragmentMaterialiEXT);
+  jsonCount(jo,"glFragmentMaterialivEXT",glFragmentMaterialivEXT);
+  jsonCount(jo,"glGetFragmentLightfvEXT",glGetFragmentLightfvEXT);
+  jsonCount(jo,"glGetFragmentLightivEXT",glGetFragmentLightivEXT);
+  jsonCount(jo,"glGetFragmentMaterialfvEXT",glGetFragmentMaterialfvEXT);
+  jsonCount(jo,"glGetFragmentMaterialivEXT",glGetFragmentMaterialivEXT);
+  jsonCount(jo,"glLightEnviEXT",glLightEnviEXT);
+
+/* GL_EXT_framebuffer_blit */
+
+  jsonCount(jo,"glBlitFramebufferEXT",glBlitFramebufferEXT);
+
+/* GL_EXT_framebuffer_multisample */
+
+  jsonCount(jo,"glRenderbufferStorageMultisampleEXT",glRenderbufferStorageMultisampleEXT);
+
+/* GL_EXT_framebuffer_object */
+
+  jsonCount(jo,"glBindFramebufferEXT",glBindFramebufferEXT);
+  jsonCount(jo,"glBindRenderbufferEXT",glBindRenderbufferEXT);
+  jsonCount(jo,"glCheckFramebufferStatusEXT",glCheckFramebufferStatusEXT);
+  jsonCount(jo,"glDeleteFramebuffersEXT",glDeleteFramebuffersEXT);
+  jsonCount(jo,"glDeleteRenderbuffersEXT",glDeleteRenderbuffersEXT);
+  jsonCount(jo,"glFramebufferRenderbufferEXT",glFramebufferRenderbufferEXT);
+  jsonCount(jo,"glFramebufferTexture1DEXT",glFramebufferTexture1DEXT);
+  jsonCount(jo,"glFramebufferTexture2DEXT",glFramebufferTexture2DEXT);
+  jsonCount(jo,"glFramebufferTexture3DEXT",glFramebufferTexture3DEXT);
+  jsonCount(jo,"glGenFramebuffersEXT",glGenFramebuffersEXT);
+  jsonCount(jo,"glGenRenderbuffersEXT",glGenRenderbuffersEXT);
+  jsonCount(jo,"glGenerateMipmapEXT",glGenerateMipmapEXT);
+  jsonCount(jo,"glGetFramebufferAttachmentParameterivEXT",glGetFramebufferAttachmentParameterivEXT);
+  jsonCount(jo,"glGetRenderbufferParameterivEXT",glGetRenderbufferParameterivEXT);
+  jsonCount(jo,"glIsFramebufferEXT",glIsFramebufferEXT);
+  jsonCount(jo,"glIsRenderbufferEXT",glIsRenderbufferEXT);
+  jsonCount(jo,"glRenderbufferStorageEXT",glRenderbufferStorageEXT);
+
+/* GL_EXT_geometry_shader4 */
+
+  jsonCount(jo,"glFramebufferTextureEXT",glFramebufferTextureEXT);
+  jsonCount(jo,"glFramebufferTextureFaceEXT",glFramebufferTextureFaceEXT);
+  jsonCount(jo,"glProgramParameteriEXT",glProgramParameteriEXT);
+
+/* GL_EXT_gpu_program_parameters */
+
+  jsonCount(jo,"glProgramEnvParameters4fvEXT",glProgramEnvParameters4fvEXT);
+  jsonCount(jo,"glProgramLocalParameters4fvEXT",glProgramLocalParameters4fvEXT);
+
+/* GL_EXT_gpu_shader4 */
+
+  jsonCount(jo,"glBindFragDataLocationEXT",glBindFragDataLocationEXT);
+  jsonCount(jo,"glGetFragDataLocationEXT",glGetFragDataLocationEXT);
+  jsonCount(jo,"glGetUniformuivEXT",glGetUniformuivEXT);
+  jsonCount(jo,"glGetVertexAttribIivEXT",glGetVertexAttribIivEXT);
+  jsonCount(jo,"glGetVertexAttribIuivEXT",glGetVertexAttribIuivEXT);
+  jsonCount(jo,"glUniform1uiEXT",glUniform1uiEXT);
+  jsonCount(jo,"glUniform1uivEXT",glUniform1uivEXT);
+  jsonCount(jo,"glUniform2uiEXT",glUniform2uiEXT);
+  jsonCount(jo,"glUniform2uivEXT",glUniform2uivEXT);
+  jsonCount(jo,"glUniform3uiEXT",glUniform3uiEXT);
+  jsonCount(jo,"glUniform3uivEXT",glUniform3uivEXT);
+  jsonCount(jo,"glUniform4uiEXT",glUniform4uiEXT);
+  jsonCount(jo,"glUniform4uivEXT",glUniform4uivEXT);
+  jsonCount(jo,"glVertexAttribI1iEXT",glVertexAttribI1iEXT);
+  jsonCount(jo,"glVertexAttribI1ivEXT",glVertexAttribI1ivEXT);
+  jsonCount(jo,"glVertexAttribI1uiEXT",glVertexAttribI1uiEXT);
+  jsonCount(jo,"glVertexAttribI1uivEXT",glVertexAttribI1uivEXT);
+  jsonCount(jo,"glVertexAttribI2iEXT",glVertexAttribI2iEXT);
+  jsonCount(jo,"glVertexAttribI2ivEXT",glVertexAttribI2ivEXT);
+  jsonCount(jo,"glVertexAttribI2uiEXT",glVertexAttribI2uiEXT);
+  jsonCount(jo,"glVertexAttribI2uivEXT",glVertexAttribI2uivEXT);
+  jsonCount(jo,"glVertexAttribI3iEXT",glVertexAttribI3iEXT);
+  jsonCount(jo,"glVertexAttribI3ivEXT",glVertexAttribI3ivEXT);
+  jsonCount(jo,"glVertexAttribI3uiEXT",glVertexAttribI3uiEXT);
+  jsonCount(jo,"glVertexAttribI3uivEXT",glVertexAttribI3uivEXT);
+  jsonCount(jo,"glVertexAttribI4bvEXT",glVertexAttribI4bvEXT);
+  jsonCount(jo,"glVertexAttribI4iEXT",glVertexAttribI4iEXT);
+  jsonCount(jo,"glVertexAttribI4ivEXT",glVertexAttribI4ivEXT);
+  jsonCount(jo,"glVertexAttribI4svEXT",glVertexAttribI4svEXT);
+  jsonCount(jo,"glVertexAttribI4ubvEXT",glVertexAttribI4ubvEXT);
+  jsonCount(jo,"glVertexAttribI4uiEXT",glVertexAttribI4uiEXT);
+  jsonCount(jo,"glVertexAttribI4uivEXT",glVertexAttribI4uivEXT);
+  jsonCount(jo,"glVertexAttribI4usvEXT",glVertexAttribI4usvEXT);
+  jsonCount(jo,"glVertexAttribIPointerEXT",glVertexAttribIPointerEXT);
+
+/* GL_EXT_histogram */
+
+  jsonCount(jo,"glGetHistogramEXT",glGetHistogramEXT);
+  jsonCount(jo,"glGetHistogramParameterfvEXT",glGetHistogramParameterfvEXT);
+  jsonCount(jo,"glGetHistogramParameterivEXT",glGetHistogramParameterivEXT);
+  jsonCount(jo,"glGetMinmaxEXT",glGetMinmaxEXT);
+  jsonCount(jo,"glGetMinmaxParameterfvEXT",glGetMinmaxParameterfvEXT);
+  jsonCount(jo,"glGetMinmaxParameterivEXT",glGetMinmaxParameterivEXT);
+  jsonCount(jo,"glHistogramEXT",glHistogramEXT);
+  jsonCount(jo,"glMinmaxEXT",glMinmaxEXT);
+  jsonCount(jo,"glResetHistogramEXT",glResetHistogramEXT);
+  jsonCount(jo,"glResetMinmaxEXT",glResetMinmaxEXT);
+
+/* GL_EXT_index_func */
+
+  jsonCount(jo,"glIndexFuncEXT",glIndexFuncEXT);
+
+/* GL_EXT_index_material */
+
+  jsonCount(jo,"glIndexMaterialEXT",glIndexMaterialEXT);
+
+/* GL_EXT_light_texture */
+
+  jsonCount(jo,"glApplyTextureEXT",glApplyTextureEXT);
+  jsonCount(jo,"glTextureLightEXT",glTextureLightEXT);
+  jsonCount(jo,"glTextureMaterialEXT",glTextureMaterialEXT);
+
+/* GL_EXT_map_buffer_range */
+
+  jsonCount(jo,"glFlushMappedBufferRangeEXT",glFlushMappedBufferRangeEXT);
+  jsonCount(jo,"glMapBufferRangeEXT",glMapBufferRangeEXT);
+
+/* GL_EXT_multi_draw_arrays */
+
+  jsonCount(jo,"glMultiDrawArraysEXT",glMultiDrawArraysEXT);
+  jsonCount(jo,"glMultiDrawElementsEXT",glMultiDrawElementsEXT);
+
+/* GL_EXT_multisample */
+
+  jsonCount(jo,"glSampleMaskEXT",glSampleMaskEXT);
+  jsonCount(jo,"glSamplePatternEXT",glSamplePatternEXT);
+
+/* GL_EXT_multisampled_render_to_texture */
+
+  jsonCount(jo,"glFramebufferTexture2DMultisampleEXT",glFramebufferTexture2DMultisampleEXT);
+
+/* GL_EXT_multiview_draw_buffers */
+
+  jsonCount(jo,"glDrawBuffersIndexedEXT",glDrawBuffersIndexedEXT);
+  jsonCount(jo,"glGetIntegeri_vEXT",glGetIntegeri_vEXT);
+  jsonCount(jo,"glReadBufferIndexedEXT",glReadBufferIndexedEXT);
+
+/* GL_EXT_occlusion_query_boolean */
+
+  jsonCount(jo,"glBeginQueryEXT",glBeginQueryEXT);
+  jsonCount(jo,"glDeleteQueriesEXT",glDeleteQueriesEXT);
+  jsonCount(jo,"glEndQueryEXT",glEndQueryEXT);
+  jsonCount(jo,"glGenQueriesEXT",glGenQueriesEXT);
+  jsonCount(jo,"glGetQueryObjectuivEXT",glGetQueryObjectuivEXT);
+  jsonCount(jo,"glGetQueryivEXT",glGetQueryivEXT);
+  jsonCount(jo,"glIsQueryEXT",glIsQueryEXT);
+
+/* GL_EXT_paletted_texture */
+
+  jsonCount(jo,"glColorTableEXT",glColorTableEXT);
+  jsonCount(jo,"glGetColorTableEXT",glGetColorTableEXT);
+  jsonCount(jo,"glGetColorTableParameterfvEXT",glGetColorTableParameterfvEXT);
+  jsonCount(jo,"glGetColorTableParameterivEXT",glGetColorTableParameterivEXT);
+
+/* GL_EXT_pixel_transform */
+
+  jsonCount(jo,"glGetPixelTransformParameterfvEXT",glGetPixelTransformParameterfvEXT);
+  jsonCount(jo,"glGetPixelTransformParameterivEXT",glGetPixelTransformParameterivEXT);
+  jsonCount(jo,"glPixelTransformParameterfEXT",glPixelTransformParameterfEXT);
+  jsonCount(jo,"glPixelTransformParameterfvEXT",glPixelTransformParameterfvEXT);
+  jsonCount(jo,"glPixelTransformParameteriEXT",glPixelTransformParameteriEXT);
+  jsonCount(jo,"glPixelTransformParameterivEXT",glPixelTransformParameterivEXT);
+
+/* GL_EXT_point_parameters */
+
+  jsonCount(jo,"glPointParameterfEXT",glPointParameterfEXT);
+  jsonCount(jo,"glPointParameterfvEXT",glPointParameterfvEXT);
+
+/* GL_EXT_polygon_offset */
+
+  jsonCount(jo,"glPolygonOffsetEXT",glPolygonOffsetEXT);
+
+/* GL_EXT_provoking_vertex */
+
+  jsonCount(jo,"glProvokingVertexEXT",glProvokingVertexEXT);
+
+/* GL_EXT_robustness */
+
+  jsonCount(jo,"glGetnUniformfvEXT",glGetnUniformfvEXT);
+  jsonCount(jo,"glGetnUniformivEXT",glGetnUniformivEXT);
+  jsonCount(jo,"glReadnPixelsEXT",glReadnPixelsEXT);
+
+/* GL_EXT_scene_marker */
+
+  jsonCount(jo,"glBeginSceneEXT",glBeginSceneEXT);
+  jsonCount(jo,"glEndSceneEXT",glEndSceneEXT);
+
+/* GL_EXT_secondary_color */
+
+  jsonCount(jo,"glSecondaryColor3bEXT",glSecondaryColor3bEXT);
+  jsonCount(jo,"glSecondaryColor3bvEXT",glSecondaryColor3bvEXT);
+  jsonCount(jo,"glSecondaryColor3dEXT",glSecondaryColor3dEXT);
+  jsonCount(jo,"glSecondaryColor3dvEXT",glSecondaryColor3dvEXT);
+  jsonCount(jo,"glSecondaryColor3fEXT",glSecondaryColor3fEXT);
+  jsonCount(jo,"glSecondaryColor3fvEXT",glSecondaryColor3fvEXT);
+  jsonCount(jo,"glSecondaryColor3iEXT",glSecondaryColor3iEXT);
+  jsonCount(jo,"glSecondaryColor3ivEXT",glSecondaryColor3ivEXT);
+  jsonCount(jo,"glSecondaryColor3sEXT",glSecondaryColor3sEXT);
+  jsonCount(jo,"glSecondaryColor3svEXT",glSecondaryColor3svEXT);
+  jsonCount(jo,"glSecondaryColor3ubEXT",glSecondaryColor3ubEXT);
+  jsonCount(jo,"glSecondaryColor3ubvEXT",glSecondaryColor3ubvEXT);
+  jsonCount(jo,"glSecondaryColor3uiEXT",glSecondaryColor3uiEXT);
+  jsonCount(jo,"glSecondaryColor3uivEXT",glSecondaryColor3uivEXT);
+  jsonCount(jo,"glSecondaryColor3usEXT",glSecondaryColor3usEXT);
+  jsonCount(jo,"glSecondaryColor3usvEXT",glSecondaryColor3usvEXT);
+  jsonCount(jo,"glSecondaryColorPointerEXT",glSecondaryColorPointerEXT);
+
+/* GL_EXT_separate_shader_objects */
+
+  jsonCount(jo,"glActiveProgramEXT",glActiveProgramEXT);
+  jsonCount(jo,"glCreateShaderProgramEXT",glCreateShaderProgramEXT);
+  jsonCount(jo,"glUseShaderProgramEXT",glUseShaderProgramEXT);
+
+/* GL_EXT_shader_image_load_store */
+
+  jsonCount(jo,"glBindImageTextureEXT",glBindImageTextureEXT);
+  jsonCount(jo,"glMemoryBarrierEXT",glMemoryBarrierEXT);
+
+/* GL_EXT_stencil_clear_tag */
+
+  jsonCount(jo,"glStencilClearTagEXT",glStencilClearTagEXT);
+
+/* GL_EXT_stencil_two_side */
+
+  jsonCount(jo,"glActiveStencilFaceEXT",glActiveStencilFaceEXT);
+
+/* GL_EXT_subtexture */
+
+  jsonCount(jo,"glTexSubImage1DEXT",glTexSubImage1DEXT);
+  jsonCount(jo,"glTexSubImage2DEXT",glTexSubImage2DEXT);
+  jsonCount(jo,"glTexSubImage3DEXT",glTexSubImage3DEXT);
+
+/* GL_EXT_texture3D */
+
+  jsonCount(jo,"glTexImage3DEXT",glTexImage3DEXT);
+
+/* GL_EXT_texture_array */
+
+  jsonCount(jo,"glFramebufferTextureLayerEXT",glFramebufferTextureLayerEXT);
+
+/* GL_EXT_texture_buffer_object */
+
+  jsonCount(jo,"glTexBufferEXT",glTexBufferEXT);
+
+/* GL_EXT_texture_integer */
+
+  jsonCount(jo,"glClearColorIiEXT",glClearColorIiEXT);
+  jsonCount(jo,"glClearColorIuiEXT",glClearColorIuiEXT);
+  jsonCount(jo,"glGetTexParameterIivEXT",glGetTexParameterIivEXT);
+  jsonCount(jo,"glGetTexParameterIuivEXT",glGetTexParameterIuivEXT);
+  jsonCount(jo,"glTexParameterIivEXT",glTexParameterIivEXT);
+  jsonCount(jo,"glTexParameterIuivEXT",glTexParameterIuivEXT);
+
+/* GL_EXT_texture_object */
+
+  jsonCount(jo,"glAreTexturesResidentEXT",glAreTexturesResidentEXT);
+  jsonCount(jo,"glBindTextureEXT",glBindTextureEXT);
+  jsonCount(jo,"glDeleteTexturesEXT",glDeleteTexturesEXT);
+  jsonCount(jo,"glGenTexturesEXT",glGenTexturesEXT);
+  jsonCount(jo,"glIsTextureEXT",glIsTextureEXT);
+  jsonCount(jo,"glPrioritizeTexturesEXT",glPrioritizeTexturesEXT);
+
+/* GL_EXT_texture_perturb_normal */
+
+  jsonCount(jo,"glTextureNormalEXT",glTextureNormalEXT);
+
+/* GL_EXT_texture_storage */
+
+  jsonCount(jo,"glTexStorage1DEXT",glTexStorage1DEXT);
+  jsonCount(jo,"glTexStorage2DEXT",glTexStorage2DEXT);
+  jsonCount(jo,"glTexStorage3DEXT",glTexStorage3DEXT);
+
+/* GL_EXT_timer_query */
+
+  jsonCount(jo,"glGetQueryObjecti64vEXT",glGetQueryObjecti64vEXT);
+  jsonCount(jo,"glGetQueryObjectui64vEXT",glGetQueryObjectui64vEXT);
+
+/* GL_EXT_transform_feedback */
+
+  jsonCount(jo,"glBeginTransformFeedbackEXT",glBeginTransformFeedbackEXT);
+  jsonCount(jo,"glBindBufferBaseEXT",glBindBufferBaseEXT);
+  jsonCount(jo,"glBindBufferOffsetEXT",glBindBufferOffsetEXT);
+  jsonCount(jo,"glBindBufferRangeEXT",glBindBufferRangeEXT);
+  jsonCount(jo,"glEndTransformFeedbackEXT",glEndTransformFeedbackEXT);
+  jsonCount(jo,"glGetTransformFeedbackVaryingEXT",glGetTransformFeedbackVaryingEXT);
+  jsonCount(jo,"glTransformFeedbackVaryingsEXT",glTransformFeedbackVaryingsEXT);
+
+/* GL_EXT_vertex_array */
+
+  jsonCount(jo,"glArrayElementEXT",glArrayElementEXT);
+  jsonCount(jo,"glColorPointerEXT",glColorPointerEXT);
+  jsonCount(jo,"glDrawArraysEXT",glDrawArraysEXT);
+  jsonCount(jo,"glEdgeFlagPointerEXT",glEdgeFlagPointerEXT);
+  jsonCount(jo,"glGetPointervEXT",glGetPointervEXT);
+  jsonCount(jo,"glIndexPointerEXT",glIndexPointerEXT);
+  jsonCount(jo,"glNormalPointerEXT",glNormalPointerEXT);
+  jsonCount(jo,"glTexCoordPointerEXT",glTexCoordPointerEXT);
+  jsonCount(jo,"glVertexPointerEXT",glVertexPointerEXT);
+
+/* GL_EXT_vertex_attrib_64bit */
+
+  jsonCount(jo,"glGetVertexAttribLdvEXT",glGetVertexAttribLdvEXT);
+  jsonCount(jo,"glVertexArrayVertexAttribLOffsetEXT",glVertexArrayVertexAttribLOffsetEXT);
+  jsonCount(jo,"glVertexAttribL1dEXT",glVertexAttribL1dEXT);
+  jsonCount(jo,"glVertexAttribL1dvEXT",glVertexAttribL1dvEXT);
+  jsonCount(jo,"glVertexAttribL2dEXT",glVertexAttribL2dEXT);
+  jsonCount(jo,"glVertexAttribL2dvEXT",glVertexAttribL2dvEXT);
+  jsonCount(jo,"glVertexAttribL3dEXT",glVertexAttribL3dEXT);
+  jsonCount(jo,"glVertexAttribL3dvEXT",glVertexAttribL3dvEXT);
+  jsonCount(jo,"glVertexAttribL4dEXT",glVertexAttribL4dEXT);
+  jsonCount(jo,"glVertexAttribL4dvEXT",glVertexAttribL4dvEXT);
+  jsonCount(jo,"glVertexAttribLPointerEXT",glVertexAttribLPointerEXT);
+
+/* GL_EXT_vertex_shader */
+
+  jsonCount(jo,"glBeginVertexShaderEXT",glBeginVertexShaderEXT);
+  jsonCount(jo,"glBindLightParameterEXT",glBindLightParameterEXT);
+  jsonCount(jo,"glBindMaterialParameterEXT",glBindMaterialParameterEXT);
+  jsonCount(jo,"glBindParameterEXT",glBindParameterEXT);
+  jsonCount(jo,"glBindTexGenParameterEXT",glBindTexGenParameterEXT);
+  jsonCount(jo,"glBindTextureUnitParameterEXT",glBindTextureUnitParameterEXT);
+  jsonCount(jo,"glBindVertexShaderEXT",glBindVertexShaderEXT);
+  jsonCount(jo,"glDeleteVertexShaderEXT",glDeleteVertexShaderEXT);
+  jsonCount(jo,"glDisableVariantClientStateEXT",glDisableVariantClientStateEXT);
+  jsonCount(jo,"glEnableVariantClientStateEXT",glEnableVariantClientStateEXT);
+  jsonCount(jo,"glEndVertexShaderEXT",glEndVertexShaderEXT);
+  jsonCount(jo,"glExtractComponentEXT",glExtractComponentEXT);
+  jsonCount(jo,"glGenSymbolsEXT",glGenSymbolsEXT);
+  jsonCount(jo,"glGenVertexShadersEXT",glGenVertexShadersEXT);
+  jsonCount(jo,"glGetInvariantBooleanvEXT",glGetInvariantBooleanvEXT);
+  jsonCount(jo,"glGetInvariantFloatvEXT",glGetInvariantFloatvEXT);
+  jsonCount(jo,"glGetInvariantIntegervEXT",glGetInvariantIntegervEXT);
+  jsonCount(jo,"glGetLocalConstantBooleanvEXT",glGetLocalConstantBooleanvEXT);
+  jsonCount(jo,"glGetLocalConstantFloatvEXT",glGetLocalConstantFloatvEXT);
+  jsonCount(jo,"glGetLocalConstantIntegervEXT",glGetLocalConstantIntegervEXT);
+  jsonCount(jo,"glGetVariantBooleanvEXT",glGetVariantBooleanvEXT);
+  jsonCount(jo,"glGetVariantFloatvEXT",glGetVariantFloatvEXT);
+  jsonCount(jo,"glGetVariantIntegervEXT",glGetVariantIntegervEXT);
+  jsonCount(jo,"glGetVariantPointervEXT",glGetVariantPointervEXT);
+  jsonCount(jo,"glInsertComponentEXT",glInsertComponentEXT);
+  jsonCount(jo,"glIsVariantEnabledEXT",glIsVariantEnabledEXT);
+  jsonCount(jo,"glSetInvariantEXT",glSetInvariantEXT);
+  jsonCount(jo,"glSetLocalConstantEXT",glSetLocalConstantEXT);
+  jsonCount(jo,"glShaderOp1EXT",glShaderOp1EXT);
+  jsonCount(jo,"glShaderOp2EXT",glShaderOp2EXT);
+  jsonCount(jo,"glShaderOp3EXT",glShaderOp3EXT);
+  jsonCount(jo,"glSwizzleEXT",glSwizzleEXT);
+  jsonCount(jo,"glVariantPointerEXT",glVariantPointerEXT);
+  jsonCount(jo,"glVariantbvEXT",glVariantbvEXT);
+  jsonCount(jo,"glVariantdvEXT",glVariantdvEXT);
+  jsonCount(jo,"glVariantfvEXT",glVariantfvEXT);
+  jsonCount(jo,"glVariantivEXT",glVariantivEXT);
+  jsonCount(jo,"glVariantsvEXT",glVariantsvEXT);
+  jsonCount(jo,"glVariantubvEXT",glVariantubvEXT);
+  jsonCount(jo,"glVariantuivEXT",glVariantuivEXT);
+  jsonCount(jo,"glVariantusvEXT",glVariantusvEXT);
+  jsonCount(jo,"glWriteMaskEXT",glWriteMaskEXT);
+
+/* GL_EXT_vertex_weighting */
+
+  jsonCount(jo,"glVertexWeightPointerEXT",glVertexWeightPointerEXT);
+  jsonCount(jo,"glVertexWeightfEXT",glVertexWeightfEXT);
+  jsonCount(jo,"glVertexWeightfvEXT",glVertexWeightfvEXT);
+
+/* GL_EXT_x11_sync_object */
+
+  jsonCount(jo,"glImportSyncEXT",glImportSyncEXT);
+
+/* GL_GREMEDY_frame_terminator */
+
+  jsonCount(jo,"glFrameTerminatorGREMEDY",glFrameTerminatorGREMEDY);
+
+/* GL_GREMEDY_string_marker */
+
+  jsonCount(jo,"glStringMarkerGREMEDY",glStringMarkerGREMEDY);
+
+/* GL_HP_image_transform */
+
+  jsonCount(jo,"glGetImageTransformParameterfvHP",glGetImageTransformParameterfvHP);
+  jsonCount(jo,"glGetImageTransformParameterivHP",glGetImageTransformParameterivHP);
+  jsonCount(jo,"glImageTransformParameterfHP",glImageTransformParameterfHP);
+  jsonCount(jo,"glImageTransformParameterfvHP",glImageTransformParameterfvHP);
+  jsonCount(jo,"glImageTransformParameteriHP",glImageTransformParameteriHP);
+  jsonCount(jo,"glImageTransformParameterivHP",glImageTransformParameterivHP);
+
+/* GL_IBM_multimode_draw_arrays */
+
+  jsonCount(jo,"glMultiModeDrawArraysIBM",glMultiModeDrawArraysIBM);
+  jsonCount(jo,"glMultiModeDrawElementsIBM",glMultiModeDrawElementsIBM);
+
+/* GL_IBM_vertex_array_lists */
+
+  jsonCount(jo,"glColorPointerListIBM",glColorPointerListIBM);
+  jsonCount(jo,"glEdgeFlagPointerListIBM",glEdgeFlagPointerListIBM);
+  jsonCount(jo,"glFogCoordPointerListIBM",glFogCoordPointerListIBM);
+  jsonCount(jo,"glIndexPointerListIBM",glIndexPointerListIBM);
+  jsonCount(jo,"glNormalPointerListIBM",glNormalPointerListIBM);
+  jsonCount(jo,"glSecondaryColorPointerListIBM",glSecondaryColorPointerListIBM);
+  jsonCount(jo,"glTexCoordPointerListIBM",glTexCoordPointerListIBM);
+  jsonCount(jo,"glVertexPointerListIBM",glVertexPointerListIBM);
+
+/* GL_IMG_multisampled_render_to_texture */
+
+  jsonCount(jo,"glFramebufferTexture2DMultisampleIMG",glFramebufferTexture2DMultisampleIMG);
+  jsonCount(jo,"glRenderbufferStorageMultisampleIMG",glRenderbufferStorageMultisampleIMG);
+
+/* GL_INGR_blend_func_separate */
+
+  jsonCount(jo,"glBlendFuncSeparateINGR",glBlendFuncSeparateINGR);
+
+/* GL_INTEL_map_texture */
+
+  jsonCount(jo,"glMapTexture2DINTEL",glMapTexture2DINTEL);
+  jsonCount(jo,"glSyncTextureINTEL",glSyncTextureINTEL);
+  jsonCount(jo,"glUnmapTexture2DINTEL",glUnmapTexture2DINTEL);
+
+/* GL_INTEL_parallel_arrays */
+
+  jsonCount(jo,"glColorPointervINTEL",glColorPointervINTEL);
+  jsonCount(jo,"glNormalPointervINTEL",glNormalPointervINTEL);
+  jsonCount(jo,"glTexCoordPointervINTEL",glTexCoordPointervINTEL);
+  jsonCount(jo,"glVertexPointervINTEL",glVertexPointervINTEL);
+
+/* GL_INTEL_texture_scissor */
+
+  jsonCount(jo,"glTexScissorFuncINTEL",glTexScissorFuncINTEL);
+  jsonCount(jo,"glTexScissorINTEL",glTexScissorINTEL);
+
+/* GL_KHR_blend_equation_advanced */
+
+  jsonCount(jo,"glBlendBarrierKHR",glBlendBarrierKHR);
+
+/* GL_KHR_debug */
+
+  jsonCount(jo,"glDebugMessageCallback",glDebugMessageCallback);
+  jsonCount(jo,"glDebugMessageControl",glDebugMessageControl);
+  jsonCount(jo,"glDebugMessageInsert",glDebugMessageInsert);
+  jsonCount(jo,"glGetDebugMessageLog",glGetDebugMessageLog);
+  jsonCount(jo,"glGetObjectLabel",glGetObjectLabel);
+  jsonCount(jo,"glGetObjectPtrLabel",glGetObjectPtrLabel);
+  jsonCount(jo,"glObjectLabel",glObjectLabel);
+  jsonCount(jo,"glObjectPtrLabel",glObjectPtrLabel);
+  jsonCount(jo,"glPopDebugGroup",glPopDebugGroup);
+  jsonCount(jo,"glPushDebugGroup",glPushDebugGroup);
+
+/* GL_KHR_robustness */
+
+  jsonCount(jo,"glGetnUniformfv",glGetnUniformfv);
+  jsonCount(jo,"glGetnUniformiv",glGetnUniformiv);
+  jsonCount(jo,"glGetnUniformuiv",glGetnUniformuiv);
+  jsonCount(jo,"glReadnPixels",glReadnPixels);
+
+/* GL_KTX_buffer_region */
+
+  jsonCount(jo,"glBufferRegionEnabled",glBufferRegionEnabled);
+  jsonCount(jo,"glDeleteBufferRegion",glDeleteBufferRegion);
+  jsonCount(jo,"glDrawBufferRegion",glDrawBufferRegion);
+  jsonCount(jo,"glNewBufferRegion",glNewBufferRegion);
+  jsonCount(jo,"glReadBufferRegion",glReadBufferRegion);
+
+/* GL_MESA_resize_buffers */
+
+  jsonCount(jo,"glResizeBuffersMESA",glResizeBuffersMESA);
+
+/* GL_MESA_window_pos */
+
+  jsonCount(jo,"glWindowPos2dMESA",glWindowPos2dMESA);
+  jsonCount(jo,"glWindowPos2dvMESA",glWindowPos2dvMESA);
+  jsonCount(jo,"glWindowPos2fMESA",glWindowPos2fMESA);
+  jsonCount(jo,"glWindowPos2fvMESA",glWindowPos2fvMESA);
+  jsonCount(jo,"glWindowPos2iMESA",glWindowPos2iMESA);
+  jsonCount(jo,"glWindowPos2ivMESA",glWindowPos2ivMESA);
+  jsonCount(jo,"glWindowPos2sMESA",glWindowPos2sMESA);
+  jsonCount(jo,"glWindowPos2svMESA",glWindowPos2svMESA);
+  jsonCount(jo,"glWindowPos3dMESA",glWindowPos3dMESA);
+  jsonCount(jo,"glWindowPos3dvMESA",glWindowPos3dvMESA);
+  jsonCount(jo,"glWindowPos3fMESA",glWindowPos3fMESA);
+  jsonCount(jo,"glWindowPos3fvMESA",glWindowPos3fvMESA);
+  jsonCount(jo,"glWindowPos3iMESA",glWindowPos3iMESA);
+  jsonCount(jo,"glWindowPos3ivMESA",glWindowPos3ivMESA);
+  jsonCount(jo,"glWindowPos3sMESA",glWindowPos3sMESA);
+  jsonCount(jo,"glWindowPos3svMESA",glWindowPos3svMESA);
+  jsonCount(jo,"glWindowPos4dMESA",glWindowPos4dMESA);
+  jsonCount(jo,"glWindowPos4dvMESA",glWindowPos4dvMESA);
+  jsonCount(jo,"glWindowPos4fMESA",glWindowPos4fMESA);
+  jsonCount(jo,"glWindowPos4fvMESA",glWindowPos4fvMESA);
+  jsonCount(jo,"glWindowPos4iMESA",glWindowPos4iMESA);
+  jsonCount(jo,"glWindowPos4ivMESA",glWindowPos4ivMESA);
+  jsonCount(jo,"glWindowPos4sMESA",glWindowPos4sMESA);
+  jsonCount(jo,"glWindowPos4svMESA",glWindowPos4svMESA);
+
+/* GL_NVX_conditional_render */
+
+  jsonCount(jo,"glBeginConditionalRenderNVX",glBeginConditionalRenderNVX);
+  jsonCount(jo,"glEndConditionalRenderNVX",glEndConditionalRenderNVX);
+
+/* GL_NV_bindless_texture */
+
+  jsonCount(jo,"glGetImageHandleNV",glGetImageHandleNV);
+  jsonCount(jo,"glGetTextureHandleNV",glGetTextureHandleNV);
+  jsonCount(jo,"glGetTextureSamplerHandleNV",glGetTextureSamplerHandleNV);
+  jsonCount(jo,"glIsImageHandleResidentNV",glIsImageHandleResidentNV);
+  jsonCount(jo,"glIsTextureHandleResidentNV",glIsTextureHandleResidentNV);
+  jsonCount(jo,"glMakeImageHandleNonResidentNV",glMakeImageHandleNonResidentNV);
+  jsonCount(jo,"glMakeImageHandleResidentNV",glMakeImageHandleResidentNV);
+  jsonCount(jo,"glMakeTextureHandleNonResidentNV",glMakeTextureHandleNonResidentNV);
+  jsonCount(jo,"glMakeTextureHandleResidentNV",glMakeTextureHandleResidentNV);
+  jsonCount(jo,"glProgramUniformHandleui64NV",glProgramUniformHandleui64NV);
+  jsonCount(jo,"glProgramUniformHandleui64vNV",glProgramUniformHandleui64vNV);
+  jsonCount(jo,"glUniformHandleui64NV",glUniformHandleui64NV);
+  jsonCount(jo,"glUniformHandleui64vNV",glUniformHandleui64vNV);
+
+/* GL_NV_blend_equation_advanced */
+
+  jsonCount(jo,"glBlendBarrierNV",glBlendBarrierNV);
+  jsonCount(jo,"glBlendParameteriNV",glBlendParameteriNV);
+
+/* GL_NV_conditional_render */
+
+  jsonCount(jo,"glBeginConditionalRenderNV",glBeginConditionalRenderNV);
+  jsonCount(jo,"glEndConditionalRenderNV",glEndConditionalRenderNV);
+
+/* GL_NV_copy_buffer */
+
+  jsonCount(jo,"glCopyBufferSubDataNV",glCopyBufferSubDataNV);
+
+/* GL_NV_copy_image */
+
+  jsonCount(jo,"glCopyImageSubDataNV",glCopyImageSubDataNV);
+
+/* GL_NV_coverage_sample */
+
+  jsonCount(jo,"glCoverageMaskNV",glCoverageMaskNV);
+  jsonCount(jo,"glCoverageOperationNV",glCoverageOperationNV);
+
+/* GL_NV_depth_buffer_float */
+
+  jsonCount(jo,"glClearDepthdNV",glClearDepthdNV);
+  jsonCount(jo,"glDepthBoundsdNV",glDepthBoundsdNV);
+  jsonCount(jo,"glDepthRangedNV",glDepthRangedNV);
+
+/* GL_NV_draw_buffers */
+
+  jsonCount(jo,"glDrawBuffersNV",glDrawBuffersNV);
+
+/* GL_NV_draw_texture */
+
+  jsonCount(jo,"glDrawTextureNV",glDrawTextureNV);
+
+/* GL_NV_evaluators */
+
+  jsonCount(jo,"glEvalMapsNV",glEvalMapsNV);
+  jsonCount(jo,"glGetMapAttribParameterfvNV",glGetMapAttribParameterfvNV);
+  jsonCount(jo,"glGetMapAttribParameterivNV",glGetMapAttribParameterivNV);
+  jsonCount(jo,"glGetMapControlPointsNV",glGetMapControlPointsNV);
+  jsonCount(jo,"glGetMapParameterfvNV",glGetMapParameterfvNV);
+  jsonCount(jo,"glGetMapParameterivNV",glGetMapParameterivNV);
+  jsonCount(jo,"glMapControlPointsNV",glMapControlPointsNV);
+  jsonCount(jo,"glMapParameterfvNV",glMapParameterfvNV);
+  jsonCount(jo,"glMapParameterivNV",glMapParameterivNV);
+
+/* GL_NV_explicit_multisample */
+
+  jsonCount(jo,"glGetMultisamplefvNV",glGetMultisamplefvNV);
+  jsonCount(jo,"glSampleMaskIndexedNV",glSampleMaskIndexedNV);
+  jsonCount(jo,"glTexRenderbufferNV",glTexRenderbufferNV);
+
+/* GL_NV_fence */
+
+  jsonCount(jo,"glDeleteFencesNV",glDeleteFencesNV);
+  jsonCount(jo,"glFinishFenceNV",glFinishFenceNV);
+  jsonCount(jo,"glGenFencesNV",glGenFencesNV);
+  jsonCount(jo,"glGetFenceivNV",glGetFenceivNV);
+  jsonCount(jo,"glIsFenceNV",glIsFenceNV);
+  jsonCount(jo,"glSetFenceNV",glSetFenceNV);
+  jsonCount(jo,"glTestFenceNV",glTestFenceNV);
+
+/* GL_NV_fragment_program */
+
+  jsonCount(jo,"glGetProgramNamedParameterdvNV",glGetProgramNamedParameterdvNV);
+  jsonCount(jo,"glGetProgramNamedParameterfvNV",glGetProgramNamedParameterfvNV);
+  jsonCount(jo,"glProgramNamedParameter4dNV",glProgramNamedParameter4dNV);
+  jsonCount(jo,"glProgramNamedParameter4dvNV",glProgramNamedParameter4dvNV);
+  jsonCount(jo,"glProgramNamedParameter4fNV",glProgramNamedParameter4fNV);
+  jsonCount(jo,"glProgramNamedParameter4fvNV",glProgramNamedParameter4fvNV);
+
+/* GL_NV_framebuffer_blit */
+
+  jsonCount(jo,"glBlitFramebufferNV",glBlitFramebufferNV);
+
+/* GL_NV_framebuffer_multisample_coverage */
+
+  jsonCount(jo,"glRenderbufferStorageMultisampleCoverageNV",glRenderbufferStorageMultisampleCoverageNV);
+
+/* GL_NV_geometry_program4 */
+
+  jsonCount(jo,"glProgramVertexLimitNV",glProgramVertexLimitNV);
+
+/* GL_NV_gpu_program4 */
+
+  jsonCount(jo,"glGetProgramEnvParameterIivNV",glGetProgramEnvParameterIivNV);
+  jsonCount(jo,"glGetProgramEnvParameterIuivNV",glGetProgramEnvParameterIuivNV);
+  jsonCount(jo,"glGetProgramLocalParameterIivNV",glGetProgramLocalParameterIivNV);
+  jsonCount(jo,"glGetProgramLocalParameterIuivNV",glGetProgramLocalParameterIuivNV);
+  jsonCount(jo,"glProgramEnvParameterI4iNV",glProgramEnvParameterI4iNV);
+  jsonCount(jo,"glProgramEnvParameterI4ivNV",glProgramEnvParameterI4ivNV);
+  jsonCount(jo,"glProgramEnvParameterI4uiNV",glProgramEnvParameterI4uiNV);
+  jsonCount(jo,"glProgramEnvParameterI4uivNV",glProgramEnvParameterI4uivNV);
+  jsonCount(jo,"glProgramEnvParametersI4ivNV",glProgramEnvParametersI4ivNV);
+  jsonCount(jo,"glProgramEnvParametersI4uivNV",glProgramEnvParametersI4uivNV);
+  jsonCount(jo,"glProgramLocalParameterI4iNV",glProgramLocalParameterI4iNV);
+  jsonCount(jo,"glProgramLocalParameterI4ivNV",glProgramLocalParameterI4ivNV);
+  jsonCount(jo,"glProgramLocalParameterI4uiNV",glProgramLocalParameterI4uiNV);
+  jsonCount(jo,"glProgramLocalParameterI4uivNV",glProgramLocalParameterI4uivNV);
+  jsonCount(jo,"glProgramLocalParametersI4ivNV",glProgramLocalParametersI4ivNV);
+  jsonCount(jo,"glProgramLocalParametersI4uivNV",glProgramLocalParametersI4uivNV);
+
+/* GL_NV_gpu_shader5 */
+
+  jsonCount(jo,"glGetUniformi64vNV",glGetUniformi64vNV);
+  jsonCount(jo,"glProgramUniform1i64NV",glProgramUniform1i64NV);
+  jsonCount(jo,"glProgramUniform1i64vNV",glProgramUniform1i64vNV);
+  jsonCount(jo,"glProgramUniform1ui64NV",glProgramUniform1ui64NV);
+  jsonCount(jo,"glProgramUniform1ui64vNV",glProgramUniform1ui64vNV);
+  jsonCount(jo,"glProgramUniform2i64NV",glProgramUniform2i64NV);
+  jsonCount(jo,"glProgramUniform2i64vNV",glProgramUniform2i64vNV);
+  jsonCount(jo,"glProgramUniform2ui64NV",glProgramUniform2ui64NV);
+  jsonCount(jo,"glProgramUniform2ui64vNV",glProgramUniform2ui64vNV);
+  jsonCount(jo,"glProgramUniform3i64NV",glProgramUniform3i64NV);
+  jsonCount(jo,"glProgramUniform3i64vNV",glProgramUniform3i64vNV);
+  jsonCount(jo,"glProgramUniform3ui64NV",glProgramUniform3ui64NV);
+  jsonCount(jo,"glProgramUniform3ui64vNV",glProgramUniform3ui64vNV);
+  jsonCount(jo,"glProgramUniform4i64NV",glProgramUniform4i64NV);
+  jsonCount(jo,"glProgramUniform4i64vNV",glProgramUniform4i64vNV);
+  jsonCount(jo,"glProgramUniform4ui64NV",glProgramUniform4ui64NV);
+  jsonCount(jo,"glProgramUniform4ui64vNV",glProgramUniform4ui64vNV);
+  jsonCount(jo,"glUniform1i64NV",glUniform1i64NV);
+  jsonCount(jo,"glUniform1i64vNV",glUniform1i64vNV);
+  jsonCount(jo,"glUniform1ui64NV",glUniform1ui64NV);
+  jsonCount(jo,"glUniform1ui64vNV",glUniform1ui64vNV);
+  jsonCount(jo,"glUniform2i64NV",glUniform2i64NV);
+  jsonCount(jo,"glUniform2i64vNV",glUniform2i64vNV);
+  jsonCount(jo,"glUniform2ui64NV",glUniform2ui64NV);
+  jsonCount(jo,"glUniform2ui64vNV",glUniform2ui64vNV);
+  jsonCount(jo,"glUniform3i64NV",glUniform3i64NV);
+  jsonCount(jo,"glUniform3i64vNV",glUniform3i64vNV);
+  jsonCount(jo,"glUniform3ui64NV",glUniform3ui64NV);
+  jsonCount(jo,"glUniform3ui64vNV",glUniform3ui64vNV);
+  jsonCount(jo,"glUniform4i64NV",glUniform4i64NV);
+  jsonCount(jo,"glUniform4i64vNV",glUniform4i64vNV);
+  jsonCount(jo,"glUniform4ui64NV",glUniform4ui64NV);
+  jsonCount(jo,"glUniform4ui64vNV",glUniform4ui64vNV);
+
+/* GL_NV_half_float */
+
+  jsonCount(jo,"glColor3hNV",glColor3hNV);
+  jsonCount(jo,"glColor3hvNV",glColor3hvNV);
+  jsonCount(jo,"glColor4hNV",glColor4hNV);
+  jsonCount(jo,"glColor4hvNV",glColor4hvNV);
+  jsonCount(jo,"glFogCoordhNV",glFogCoordhNV);
+  jsonCount(jo,"glFogCoordhvNV",glFogCoordhvNV);
+  jsonCount(jo,"glMultiTexCoord1hNV",glMultiTexCoord1hNV);
+  jsonCount(jo,"glMultiTexCoord1hvNV",glMultiTexCoord1hvNV);
+  jsonCount(jo,"glMultiTexCoord2hNV",glMultiTexCoord2hNV);
+  jsonCount(jo,"glMultiTexCoord2hvNV",glMultiTexCoord2hvNV);
+  jsonCount(jo,"glMultiTexCoord3hNV",glMultiTexCoord3hNV);
+  jsonCount(jo,"glMultiTexCoord3hvNV",glMultiTexCoord3hvNV);
+  jsonCount(jo,"glMultiTexCoord4hNV",glMultiTexCoord4hNV);
+  jsonCount(jo,"glMultiTexCoord4hvNV",glMultiTexCoord4hvNV);
+  jsonCount(jo,"glNormal3hNV",glNormal3hNV);
+  jsonCount(jo,"glNormal3hvNV",glNormal3hvNV);
+  jsonCount(jo,"glSecondaryColor3hNV",glSecondaryColor3hNV);
+  jsonCount(jo,"glSecondaryColor3hvNV",glSecondaryColor3hvNV);
+  jsonCount(jo,"glTexCoord1hNV",glTexCoord1hNV);
+  jsonCount(jo,"glTexCoord1hvNV",glTexCoord1hvNV);
+  jsonCount(jo,"glTexCoord2hNV",glTexCoord2hNV);
+  jsonCount(jo,"glTexCoord2hvNV",glTexCoord2hvNV);
+  jsonCount(jo,"glTexCoord3hNV",glTexCoord3hNV);
+  jsonCount(jo,"glTexCoord3hvNV",glTexCoord3hvNV);
+  jsonCount(jo,"glTexCoord4hNV",glTexCoord4hNV);
+  jsonCount(jo,"glTexCoord4hvNV",glTexCoord4hvNV);
+  jsonCount(jo,"glVertex2hNV",glVertex2hNV);
+  jsonCount(jo,"glVertex2hvNV",glVertex2hvNV);
+  jsonCount(jo,"glVertex3hNV",glVertex3hNV);
+  jsonCount(jo,"glVertex3hvNV",glVertex3hvNV);
+  jsonCount(jo,"glVertex4hNV",glVertex4hNV);
+  jsonCount(jo,"glVertex4hvNV",glVertex4hvNV);
+  jsonCount(jo,"glVertexAttrib1hNV",glVertexAttrib1hNV);
+  jsonCount(jo,"glVertexAttrib1hvNV",glVertexAttrib1hvNV);
+  jsonCount(jo,"glVertexAttrib2hNV",glVertexAttrib2hNV);
+  jsonCount(jo,"glVertexAttrib2hvNV",glVertexAttrib2hvNV);
+  jsonCount(jo,"glVertexAttrib3hNV",glVertexAttrib3hNV);
+  jsonCount(jo,"glVertexAttrib3hvNV",glVertexAttrib3hvNV);
+  jsonCount(jo,"glVertexAttrib4hNV",glVertexAttrib4hNV);
+  jsonCount(jo,"glVertexAttrib4hvNV",glVertexAttrib4hvNV);
+  jsonCount(jo,"glVertexAttribs1hvNV",glVertexAttribs1hvNV);
+  jsonCount(jo,"glVertexAttribs2hvNV",glVertexAttribs2hvNV);
+  jsonCount(jo,"glVertexAttribs3hvNV",glVertexAttribs3hvNV);
+  jsonCount(jo,"glVertexAttribs4hvNV",glVertexAttribs4hvNV);
+  jsonCount(jo,"glVertexWeighthNV",glVertexWeighthNV);
+  jsonCount(jo,"glVertexWeighthvNV",glVertexWeighthvNV);
+
+/* GL_NV_non_square_matrices */
+
+  jsonCount(jo,"glUniformMatrix2x3fvNV",glUniformMatrix2x3fvNV);
+  jsonCount(jo,"glUniformMatrix2x4fvNV",glUniformMatrix2x4fvNV);
+  jsonCount(jo,"glUniformMatrix3x2fvNV",glUniformMatrix3x2fvNV);
+  jsonCount(jo,"glUniformMatrix3x4fvNV",glUniformMatrix3x4fvNV);
+  jsonCount(jo,"glUniformMatrix4x2fvNV",glUniformMatrix4x2fvNV);
+  jsonCount(jo,"glUniformMatrix4x3fvNV",glUniformMatrix4x3fvNV);
+
+/* GL_NV_occlusion_query */
+
+  jsonCount(jo,"glBeginOcclusionQueryNV",glBeginOcclusionQueryNV);
+  jsonCount(jo,"glDeleteOcclusionQueriesNV",glDeleteOcclusionQueriesNV);
+  jsonCount(jo,"glEndOcclusionQueryNV",glEndOcclusionQueryNV);
+  jsonCount(jo,"glGenOcclusionQueriesNV",glGenOcclusionQueriesNV);
+  jsonCount(jo,"glGetOcclusionQueryivNV",glGetOcclusionQueryivNV);
+  jsonCount(jo,"glGetOcclusionQueryuivNV",glGetOcclusionQueryuivNV);
+  jsonCount(jo,"glIsOcclusionQueryNV",glIsOcclusionQueryNV);
+
+/* GL_NV_parameter_buffer_object */
+
+  jsonCount(jo,"glProgramBufferParametersIivNV",glProgramBufferParametersIivNV);
+  jsonCount(jo,"glProgramBufferParametersIuivNV",glProgramBufferParametersIuivNV);
+  jsonCount(jo,"glProgramBufferParametersfvNV",glProgramBufferParametersfvNV);
+
+/* GL_NV_path_rendering */
+
+  jsonCount(jo,"glCopyPathNV",glCopyPathNV);
+  jsonCount(jo,"glCoverFillPathInstancedNV",glCoverFillPathInstancedNV);
+  jsonCount(jo,"glCoverFillPathNV",glCoverFillPathNV);
+  jsonCount(jo,"glCoverStrokePathInstancedNV",glCoverStrokePathInstancedNV);
+  jsonCount(jo,"glCoverStrokePathNV",glCoverStrokePathNV);
+  jsonCount(jo,"glDeletePathsNV",glDeletePathsNV);
+  jsonCount(jo,"glGenPathsNV",glGenPathsNV);
+  jsonCount(jo,"glGetPathColorGenfvNV",glGetPathColorGenfvNV);
+  jsonCount(jo,"glGetPathColorGenivNV",glGetPathColorGenivNV);
+  jsonCount(jo,"glGetPathCommandsNV",glGetPathCommandsNV);
+  jsonCount(jo,"glGetPathCoordsNV",glGetPathCoordsNV);
+  jsonCount(jo,"glGetPathDashArrayNV",glGetPathDashArrayNV);
+  jsonCount(jo,"glGetPathLengthNV",glGetPathLengthNV);
+  jsonCount(jo,"glGetPathMetricRangeNV",glGetPathMetricRangeNV);
+  jsonCount(jo,"glGetPathMetricsNV",glGetPathMetricsNV);
+  jsonCount(jo,"glGetPathParameterfvNV",glGetPathParameterfvNV);
+  jsonCount(jo,"glGetPathParameterivNV",glGetPathParameterivNV);
+  jsonCount(jo,"glGetPathSpacingNV",glGetPathSpacingNV);
+  jsonCount(jo,"glGetPathTexGenfvNV",glGetPathTexGenfvNV);
+  jsonCount(jo,"glGetPathTexGenivNV",glGetPathTexGenivNV);
+  jsonCount(jo,"glInterpolatePathsNV",glInterpolatePathsNV);
+  jsonCount(jo,"glIsPathNV",glIsPathNV);
+  jsonCount(jo,"glIsPointInFillPathNV",glIsPointInFillPathNV);
+  jsonCount(jo,"glIsPointInStrokePathNV",glIsPointInStrokePathNV);
+  jsonCount(jo,"glPathColorGenNV",glPathColorGenNV);
+  jsonCount(jo,"glPathCommandsNV",glPathCommandsNV);
+  jsonCount(jo,"glPathCoordsNV",glPathCoordsNV);
+  jsonCount(jo,"glPathCoverDepthFuncNV",glPathCoverDepthFuncNV);
+  jsonCount(jo,"glPathDashArrayNV",glPathDashArrayNV);
+  jsonCount(jo,"glPathFogGenNV",glPathFogGenNV);
+  jsonCount(jo,"glPathGlyphRangeNV",glPathGlyphRangeNV);
+  jsonCount(jo,"glPathGlyphsNV",glPathGlyphsNV);
+  jsonCount(jo,"glPathParameterfNV",glPathParameterfNV);
+  jsonCount(jo,"glPathParameterfvNV",glPathParameterfvNV);
+  jsonCount(jo,"glPathParameteriNV",glPathParameteriNV);
+  jsonCount(jo,"glPathParameterivNV",glPathParameterivNV);
+  jsonCount(jo,"glPathStencilDepthOffsetNV",glPathStencilDepthOffsetNV);
+  jsonCount(jo,"glPathStencilFuncNV",glPathStencilFuncNV);
+  jsonCount(jo,"glPathStringNV",glPathStringNV);
+  jsonCount(jo,"glPathSubCommandsNV",glPathSubCommandsNV);
+  jsonCount(jo,"glPathSubCoordsNV",glPathSubCoordsNV);
+  jsonCount(jo,"glPathTexGenNV",glPathTexGenNV);
+  jsonCount(jo,"glPointAlongPathNV",glPointAlongPathNV);
+  jsonCount(jo,"glStencilFillPathInstancedNV",glStencilFillPathInstancedNV);
+  jsonCount(jo,"glStencilFillPathNV",glStencilFillPathNV);
+  jsonCount(jo,"glStencilStrokePathInstancedNV",glStencilStrokePathInstancedNV);
+  jsonCount(jo,"glStencilStrokePathNV",glStencilStrokePathNV);
+  jsonCount(jo,"glTransformPathNV",glTransformPathNV);
+  jsonCount(jo,"glWeightPathsNV",glWeightPathsNV);
+
+/* GL_NV_pixel_data_range */
+
+  jsonCount(jo,"glFlushPixelDataRangeNV",glFlushPixelDataRangeNV);
+  jsonCount(jo,"glPixelDataRangeNV",glPixelDataRangeNV);
+
+/* GL_NV_point_sprite */
+
+  jsonCount(jo,"glPointParameteriNV",glPointParameteriNV);
+  jsonCount(jo,"glPointParameterivNV",glPointParameterivNV);
+
+/* GL_NV_present_video */
+
+  jsonCount(jo,"glGetVideoi64vNV",glGetVideoi64vNV);
+  jsonCount(jo,"glGetVideoivNV",glGetVideoivNV);
+  jsonCount(jo,"glGetVideoui64vNV",glGetVideoui64vNV);
+  jsonCount(jo,"glGetVideouivNV",glGetVideouivNV);
+  jsonCount(jo,"glPresentFrameDualFillNV",glPresentFrameDualFillNV);
+  jsonCount(jo,"glPresentFrameKeyedNV",glPresentFrameKeyedNV);
+
+/* GL_NV_primitive_restart */
+
+  jsonCount(jo,"glPrimitiveRestartIndexNV",glPrimitiveRestartIndexNV);
+  jsonCount(jo,"glPrimitiveRestartNV",glPrimitiveRestartNV);
+
+/* GL_NV_read_buffer */
+
+  jsonCount(jo,"glReadBufferNV",glReadBufferNV);
+
+/* GL_NV_register_combiners */
+
+  jsonCount(jo,"glCombinerInputNV",glCombinerInputNV);
+  jsonCount(jo,"glCombinerOutputNV",glCombinerOutputNV);
+  jsonCount(jo,"glCombinerParameterfNV",glCombinerParameterfNV);
+  jsonCount(jo,"glCombinerParameterfvNV",glCombinerParameterfvNV);
+  jsonCount(jo,"glCombinerParameteriNV",glCombinerParameteriNV);
+  jsonCount(jo,"glCombinerParameterivNV",glCombinerParameterivNV);
+  jsonCount(jo,"glFinalCombinerInputNV",glFinalCombinerInputNV);
+  jsonCount(jo,"glGetCombinerInputParameterfvNV",glGetCombinerInputParameterfvNV);
+  jsonCount(jo,"glGetCombinerInputParameterivNV",glGetCombinerInputParameterivNV);
+  jsonCount(jo,"glGetCombinerOutputParameterfvNV",glGetCombinerOutputParameterfvNV);
+  jsonCount(jo,"glGetCombinerOutputParameterivNV",glGetCombinerOutputParameterivNV);
+  jsonCount(jo,"glGetFinalCombinerInputParameterfvNV",glGetFinalCombinerInputParameterfvNV);
+  jsonCount(jo,"glGetFinalCombinerInputParameterivNV",glGetFinalCombinerInputParameterivNV);
+
+/* GL_NV_register_combiners2 */
+
+  jsonCount(jo,"glCombinerStageParameterfvNV",glCombinerStageParameterfvNV);
+  jsonCount(jo,"glGetCombinerStageParameterfvNV",glGetCombinerStageParameterfvNV);
+
+/* GL_NV_shader_buffer_load */
+
+  jsonCount(jo,"glGetBufferParameterui64vNV",glGetBufferParameterui64vNV);
+  jsonCount(jo,"glGetIntegerui64vNV",glGetIntegerui64vNV);
+  jsonCount(jo,"glGetNamedBufferParameterui64vNV",glGetNamedBufferParameterui64vNV);
+  jsonCount(jo,"glGetUniformui64vNV",glGetUniformui64vNV);
+  jsonCount(jo,"glIsBufferResidentNV",glIsBufferResidentNV);
+  jsonCount(jo,"glIsNamedBufferResidentNV",glIsNamedBufferResidentNV);
+  jsonCount(jo,"glMakeBufferNonResidentNV",glMakeBufferNonResidentNV);
+  jsonCount(jo,"glMakeBufferResidentNV",glMakeBufferResidentNV);
+  jsonCount(jo,"glMakeNamedBufferNonResidentNV",glMakeNamedBufferNonResidentNV);
+  jsonCount(jo,"glMakeNamedBufferResidentNV",glMakeNamedBufferResidentNV);
+  jsonCount(jo,"glProgramUniformui64NV",glProgramUniformui64NV);
+  jsonCount(jo,"glProgramUniformui64vNV",glProgramUniformui64vNV);
+  jsonCount(jo,"glUniformui64NV",glUniformui64NV);
+  jsonCount(jo,"glUniformui64vNV",glUniformui64vNV);
+
+/* GL_NV_texture_barrier */
+
+  jsonCount(jo,"glTextureBarrierNV",glTextureBarrierNV);
+
+/* GL_NV_texture_multisample */
+
+  jsonCount(jo,"glTexImage2DMultisampleCoverageNV",glTexImage2DMultisampleCoverageNV);
+  jsonCount(jo,"glTexImage3DMultisampleCoverageNV",glTexImage3DMultisampleCoverageNV);
+  jsonCount(jo,"glTextureImage2DMultisampleCoverageNV",glTextureImage2DMultisampleCoverageNV);
+  jsonCount(jo,"glTextureImage2DMultisampleNV",glTextureImage2DMultisampleNV);
+  jsonCount(jo,"glTextureImage3DMultisampleCoverageNV",glTextureImage3DMultisampleCoverageNV);
+  jsonCount(jo,"glTextureImage3DMultisampleNV",glTextureImage3DMultisampleNV);
+
+/* GL_NV_transform_feedback */
+
+  jsonCount(jo,"glActiveVaryingNV",glActiveVaryingNV);
+  jsonCount(jo,"glBeginTransformFeedbackNV",glBeginTransformFeedbackNV);
+  jsonCount(jo,"glBindBufferBaseNV",glBindBufferBaseNV);
+  jsonCount(jo,"glBindBufferOffsetNV",glBindBufferOffsetNV);
+  jsonCount(jo,"glBindBufferRangeNV",glBindBufferRangeNV);
+  jsonCount(jo,"glEndTransformFeedbackNV",glEndTransformFeedbackNV);
+  jsonCount(jo,"glGetActiveVaryingNV",glGetActiveVaryingNV);
+  jsonCount(jo,"glGetTransformFeedbackVaryingNV",glGetTransformFeedbackVaryingNV);
+  jsonCount(jo,"glGetVaryingLocationNV",glGetVaryingLocationNV);
+  jsonCount(jo,"glTransformFeedbackAttribsNV",glTransformFeedbackAttribsNV);
+  jsonCount(jo,"glTransformFeedbackVaryingsNV",glTransformFeedbackVaryingsNV);
+
+/* GL_NV_transform_feedback2 */
+
+  jsonCount(jo,"glBindTransformFeedbackNV",glBindTransformFeedbackNV);
+  jsonCount(jo,"glDeleteTransformFeedbacksNV",glDeleteTransformFeedbacksNV);
+  jsonCount(jo,"glDrawTransformFeedbackNV",glDrawTransformFeedbackNV);
+  jsonCount(jo,"glGenTransformFeedbacksNV",glGenTransformFeedbacksNV);
+  jsonCount(jo,"glIsTransformFeedbackNV",glIsTransformFeedbackNV);
+  jsonCount(jo,"glPauseTransformFeedbackNV",glPauseTransformFeedbackNV);
+  jsonCount(jo,"glResumeTransformFeedbackNV",glResumeTransformFeedbackNV);
+
+/* GL_NV_vdpau_interop */
+
+  jsonCount(jo,"glVDPAUFiniNV",glVDPAUFiniNV);
+  jsonCount(jo,"glVDPAUGetSurfaceivNV",glVDPAUGetSurfaceivNV);
+  jsonCount(jo,"glVDPAUInitNV",glVDPAUInitNV);
+  jsonCount(jo,"glVDPAUIsSurfaceNV",glVDPAUIsSurfaceNV);
+  jsonCount(jo,"glVDPAUMapSurfacesNV",glVDPAUMapSurfacesNV);
+  jsonCount(jo,"glVDPAURegisterOutputSurfaceNV",glVDPAURegisterOutputSurfaceNV);
+  jsonCount(jo,"glVDPAURegisterVideoSurfaceNV",glVDPAURegisterVideoSurfaceNV);
+  jsonCount(jo,"glVDPAUSurfaceAccessNV",glVDPAUSurfaceAccessNV);
+  jsonCount(jo,"glVDPAUUnmapSurfacesNV",glVDPAUUnmapSurfacesNV);
+  jsonCount(jo,"glVDPAUUnregisterSurfaceNV",glVDPAUUnregisterSurfaceNV);
+
+/* GL_NV_vertex_array_range */
+
+  jsonCount(jo,"glFlushVertexArrayRangeNV",glFlushVertexArrayRangeNV);
+  jsonCount(jo,"glVertexArrayRangeNV",glVertexArrayRangeNV);
+
+/* GL_NV_vertex_attrib_integer_64bit */
+
+  jsonCount(jo,"glGetVertexAttribLi64vNV",glGetVertexAttribLi64vNV);
+  jsonCount(jo,"glGetVertexAttribLui64vNV",glGetVertexAttribLui64vNV);
+  jsonCount(jo,"glVertexAttribL1i64NV",glVertexAttribL1i64NV);
+  jsonCount(jo,"glVertexAttribL1i64vNV",glVertexAttribL1i64vNV);
+  jsonCount(jo,"glVertexAttribL1ui64NV",glVertexAttribL1ui64NV);
+  jsonCount(jo,"glVertexAttribL1ui64vNV",glVertexAttribL1ui64vNV);
+  jsonCount(jo,"glVertexAttribL2i64NV",glVertexAttribL2i64NV);
+  jsonCount(jo,"glVertexAttribL2i64vNV",glVertexAttribL2i64vNV);
+  jsonCount(jo,"glVertexAttribL2ui64NV",glVertexAttribL2ui64NV);
+  jsonCount(jo,"glVertexAttribL2ui64vNV",glVertexAttribL2ui64vNV);
+  jsonCount(jo,"glVertexAttribL3i64NV",glVertexAttribL3i64NV);
+  jsonCount(jo,"glVertexAttribL3i64vNV",glVertexAttribL3i64vNV);
+  jsonCount(jo,"glVertexAttribL3ui64NV",glVertexAttribL3ui64NV);
+  jsonCount(jo,"glVertexAttribL3ui64vNV",glVertexAttribL3ui64vNV);
+  jsonCount(jo,"glVertexAttribL4i64NV",glVertexAttribL4i64NV);
+  jsonCount(jo,"glVertexAttribL4i64vNV",glVertexAttribL4i64vNV);
+  jsonCount(jo,"glVertexAttribL4ui64NV",glVertexAttribL4ui64NV);
+  jsonCount(jo,"glVertexAttribL4ui64vNV",glVertexAttribL4ui64vNV);
+  jsonCount(jo,"glVertexAttribLFormatNV",glVertexAttribLFormatNV);
+
+/* GL_NV_vertex_buffer_unified_memory */
+
+  jsonCount(jo,"glBufferAddressRangeNV",glBufferAddressRangeNV);
+  jsonCount(jo,"glColorFormatNV",glColorFormatNV);
+  jsonCount(jo,"glEdgeFlagFormatNV",glEdgeFlagFormatNV);
+  jsonCount(jo,"glFogCoordFormatNV",glFogCoordFormatNV);
+  jsonCount(jo,"glGetIntegerui64i_vNV",glGetIntegerui64i_vNV);
+  jsonCount(jo,"glIndexFormatNV",glIndexFormatNV);
+  jsonCount(jo,"glNormalFormatNV",glNormalFormatNV);
+  jsonCount(jo,"glSecondaryColorFormatNV",glSecondaryColorFormatNV);
+  jsonCount(jo,"glTexCoordFormatNV",glTexCoordFormatNV);
+  jsonCount(jo,"glVertexAttribFormatNV",glVertexAttribFormatNV);
+  jsonCount(jo,"glVertexAttribIFormatNV",glVertexAttribIFormatNV);
+  jsonCount(jo,"glVertexFormatNV",glVertexFormatNV);
+
+/* GL_NV_vertex_program */
+
+  jsonCount(jo,"glAreProgramsResidentNV",glAreProgramsResidentNV);
+  jsonCount(jo,"glBindProgramNV",glBindProgramNV);
+  jsonCount(jo,"glDeleteProgramsNV",glDeleteProgramsNV);
+  jsonCount(jo,"glExecuteProgramNV",glExecuteProgramNV);
+  jsonCount(jo,"glGenProgramsNV",glGenProgramsNV);
+  jsonCount(jo,"glGetProgramParameterdvNV",glGetProgramParameterdvNV);
+  jsonCount(jo,"glGetProgramParameterfvNV",glGetProgramParameterfvNV);
+  jsonCount(jo,"glGetProgramStringNV",glGetProgramStringNV);
+  jsonCount(jo,"glGetProgramivNV",glGetProgramivNV);
+  jsonCount(jo,"glGetTrackMatrixivNV",glGetTrackMatrixivNV);
+  jsonCount(jo,"glGetVertexAttribPointervNV",glGetVertexAttribPointervNV);
+  jsonCount(jo,"glGetVertexAttribdvNV",glGetVertexAttribdvNV);
+  jsonCount(jo,"glGetVertexAttribfvNV",glGetVertexAttribfvNV);
+  jsonCount(jo,"glGetVertexAttribivNV",glGetVertexAttribivNV);
+  jsonCount(jo,"glIsProgramNV",glIsProgramNV);
+  jsonCount(jo,"glLoadProgramNV",glLoadProgramNV);
+  jsonCount(jo,"glProgramParameter4dNV",glProgramParameter4dNV);
+  jsonCount(jo,"glProgramParameter4dvNV",glProgramParameter4dvNV);
+  jsonCount(jo,"glProgramParameter4fNV",glProgramParameter4fNV);
+  jsonCount(jo,"glProgramParameter4fvNV",glProgramParameter4fvNV);
+  jsonCount(jo,"glProgramParameters4dvNV",glProgramParameters4dvNV);
+  jsonCount(jo,"glProgramParameters4fvNV",glProgramParameters4fvNV);
+  jsonCount(jo,"glRequestResidentProgramsNV",glRequestResidentProgramsNV);
+  jsonCount(jo,"glTrackMatrixNV",glTrackMatrixNV);
+  jsonCount(jo,"glVertexAttrib1dNV",glVertexAttrib1dNV);
+  jsonCount(jo,"glVertexAttrib1dvNV",glVertexAttrib1dvNV);
+  jsonCount(jo,"glVertexAttrib1fNV",glVertexAttrib1fNV);
+  jsonCount(jo,"glVertexAttrib1fvNV",glVertexAttrib1fvNV);
+  jsonCount(jo,"glVertexAttrib1sNV",glVertexAttrib1sNV);
+  jsonCount(jo,"glVertexAttrib1svNV",glVertexAttrib1svNV);
+  jsonCount(jo,"glVertexAttrib2dNV",glVertexAttrib2dNV);
+  jsonCount(jo,"glVertexAttrib2dvNV",glVertexAttrib2dvNV);
+  jsonCount(jo,"glVertexAttrib2fNV",glVertexAttrib2fNV);
+  jsonCount(jo,"glVertexAttrib2fvNV",glVertexAttrib2fvNV);
+  jsonCount(jo,"glVertexAttrib2sNV",glVertexAttrib2sNV);
+  jsonCount(jo,"glVertexAttrib2svNV",glVertexAttrib2svNV);
+  jsonCount(jo,"glVertexAttrib3dNV",glVertexAttrib3dNV);
+  jsonCount(jo,"glVertexAttrib3dvNV",glVertexAttrib3dvNV);
+  jsonCount(jo,"glVertexAttrib3fNV",glVertexAttrib3fNV);
+  jsonCount(jo,"glVertexAttrib3fvNV",glVertexAttrib3fvNV);
+  jsonCount(jo,"glVertexAttrib3sNV",glVertexAttrib3sNV);
+  jsonCount(jo,"glVertexAttrib3svNV",glVertexAttrib3svNV);
+  jsonCount(jo,"glVertexAttrib4dNV",glVertexAttrib4dNV);
+  jsonCount(jo,"glVertexAttrib4dvNV",glVertexAttrib4dvNV);
+  jsonCount(jo,"glVertexAttrib4fNV",glVertexAttrib4fNV);
+  jsonCount(jo,"glVertexAttrib4fvNV",glVertexAttrib4fvNV);
+  jsonCount(jo,"glVertexAttrib4sNV",glVertexAttrib4sNV);
+  jsonCount(jo,"glVertexAttrib4svNV",glVertexAttrib4svNV);
+  jsonCount(jo,"glVertexAttrib4ubNV",glVertexAttrib4ubNV);
+  jsonCount(jo,"glVertexAttrib4ubvNV",glVertexAttrib4ubvNV);
+  jsonCount(jo,"glVertexAttribPointerNV",glVertexAttribPointerNV);
+  jsonCount(jo,"glVertexAttribs1dvNV",glVertexAttribs1dvNV);
+  jsonCount(jo,"glVertexAttribs1fvNV",glVertexAttribs1fvNV);
+  jsonCount(jo,"glVertexAttribs1svNV",glVertexAttribs1svNV);
+  jsonCount(jo,"glVertexAttribs2dvNV",glVertexAttribs2dvNV);
+  jsonCount(jo,"glVertexAttribs2fvNV",glVertexAttribs2fvNV);
+  jsonCount(jo,"glVertexAttribs2svNV",glVertexAttribs2svNV);
+  jsonCount(jo,"glVertexAttribs3dvNV",glVertexAttribs3dvNV);
+  jsonCount(jo,"glVertexAttribs3fvNV",glVertexAttribs3fvNV);
+  jsonCount(jo,"glVertexAttribs3svNV",glVertexAttribs3svNV);
+  jsonCount(jo,"glVertexAttribs4dvNV",glVertexAttribs4dvNV);
+  jsonCount(jo,"glVertexAttribs4fvNV",glVertexAttribs4fvNV);
+  jsonCount(jo,"glVertexAttribs4svNV",glVertexAttribs4svNV);
+  jsonCount(jo,"glVertexAttribs4ubvNV",glVertexAttribs4ubvNV);
+
+/* GL_NV_video_capture */
+
+  jsonCount(jo,"glBeginVideoCaptureNV",glBeginVideoCaptureNV);
+  jsonCount(jo,"glBindVideoCaptureStreamBufferNV",glBindVideoCaptureStreamBufferNV);
+  jsonCount(jo,"glBindVideoCaptureStreamTextureNV",glBindVideoCaptureStreamTextureNV);
+  jsonCount(jo,"glEndVideoCaptureNV",glEndVideoCaptureNV);
+  jsonCount(jo,"glGetVideoCaptureStreamdvNV",glGetVideoCaptureStreamdvNV);
+  jsonCount(jo,"glGetVideoCaptureStreamfvNV",glGetVideoCaptureStreamfvNV);
+  jsonCount(jo,"glGetVideoCaptureStreamivNV",glGetVideoCaptureStreamivNV);
+  jsonCount(jo,"glGetVideoCaptureivNV",glGetVideoCaptureivNV);
+  jsonCount(jo,"glVideoCaptureNV",glVideoCaptureNV);
+  jsonCount(jo,"glVideoCaptureStreamParameterdvNV",glVideoCaptureStreamParameterdvNV);
+  jsonCount(jo,"glVideoCaptureStreamParameterfvNV",glVideoCaptureStreamParameterfvNV);
+  jsonCount(jo,"glVideoCaptureStreamParameterivNV",glVideoCaptureStreamParameterivNV);
+
+/* GL_OES_blend_equation_separate */
+
+  jsonCount(jo,"glBlendEquationSeparateOES",glBlendEquationSeparateOES);
+
+/* GL_OES_blend_func_separate */
+
+  jsonCount(jo,"glBlendFuncSeparateOES",glBlendFuncSeparateOES);
+
+/* GL_OES_blend_subtract */
+
+  jsonCount(jo,"glBlendEquationOES",glBlendEquationOES);
+
+/* GL_OES_framebuffer_object */
+
+  jsonCount(jo,"glBindFramebufferOES",glBindFramebufferOES);
+  jsonCount(jo,"glBindRenderbufferOES",glBindRenderbufferOES);
+  jsonCount(jo,"glCheckFramebufferStatusOES",glCheckFramebufferStatusOES);
+  jsonCount(jo,"glDeleteFramebuffersOES",glDeleteFramebuffersOES);
+  jsonCount(jo,"glDeleteRenderbuffersOES",glDeleteRenderbuffersOES);
+  jsonCount(jo,"glFramebufferRenderbufferOES",glFramebufferRenderbufferOES);
+  jsonCount(jo,"glFramebufferTexture2DOES",glFramebufferTexture2DOES);
+  jsonCount(jo,"glGenFramebuffersOES",glGenFramebuffersOES);
+  jsonCount(jo,"glGenRenderbuffersOES",glGenRenderbuffersOES);
+  jsonCount(jo,"glGenerateMipmapOES",glGenerateMipmapOES);
+  jsonCount(jo,"glGetFramebufferAttachmentParameterivOES",glGetFramebufferAttachmentParameterivOES);
+  jsonCount(jo,"glGetRenderbufferParameterivOES",glGetRenderbufferParameterivOES);
+  jsonCount(jo,"glIsFramebufferOES",glIsFramebufferOES);
+  jsonCount(jo,"glIsRenderbufferOES",glIsRenderbufferOES);
+  jsonCount(jo,"glRenderbufferStorageOES",glRenderbufferStorageOES);
+
+/* GL_OES_get_program_binary */
+
+  jsonCount(jo,"glGetProgramBinaryOES",glGetProgramBinaryOES);
+  jsonCount(jo,"glProgramBinaryOES",glProgramBinaryOES);
+
+/* GL_OES_mapbuffer */
+
+  jsonCount(jo,"glGetBufferPointervOES",glGetBufferPointervOES);
+  jsonCount(jo,"glMapBufferOES",glMapBufferOES);
+  jsonCount(jo,"glUnmapBufferOES",glUnmapBufferOES);
+
+/* GL_OES_matrix_palette */
+
+  jsonCount(jo,"glCurrentPaletteMatrixOES",glCurrentPaletteMatrixOES);
+  jsonCount(jo,"glMatrixIndexPointerOES",glMatrixIndexPointerOES);
+  jsonCount(jo,"glWeightPointerOES",glWeightPointerOES);
+
+/* GL_OES_single_precision */
+
+  jsonCount(jo,"glClearDepthfOES",glClearDepthfOES);
+  jsonCount(jo,"glClipPlanefOES",glClipPlanefOES);
+  jsonCount(jo,"glDepthRangefOES",glDepthRangefOES);
+  jsonCount(jo,"glFrustumfOES",glFrustumfOES);
+  jsonCount(jo,"glGetClipPlanefOES",glGetClipPlanefOES);
+  jsonCount(jo,"glOrthofOES",glOrthofOES);
+
+/* GL_OES_texture_3D */
+
+  jsonCount(jo,"glCompressedTexImage3DOES",glCompressedTexImage3DOES);
+  jsonCount(jo,"glCompressedTexSubImage3DOES",glCompressedTexSubImage3DOES);
+  jsonCount(jo,"glCopyTexSubImage3DOES",glCopyTexSubImage3DOES);
+  jsonCount(jo,"glFramebufferTexture3DOES",glFramebufferTexture3DOES);
+  jsonCount(jo,"glTexImage3DOES",glTexImage3DOES);
+  jsonCount(jo,"glTexSubImage3DOES",glTexSubImage3DOES);
+
+/* GL_OES_texture_cube_map */
+
+  jsonCount(jo,"glGetTexGenfvOES",glGetTexGenfvOES);
+  jsonCount(jo,"glGetTexGenivOES",glGetTexGenivOES);
+  jsonCount(jo,"glGetTexGenxvOES",glGetTexGenxvOES);
+  jsonCount(jo,"glTexGenfOES",glTexGenfOES);
+  jsonCount(jo,"glTexGenfvOES",glTexGenfvOES);
+  jsonCount(jo,"glTexGeniOES",glTexGeniOES);
+  jsonCount(jo,"glTexGenivOES",glTexGenivOES);
+  jsonCount(jo,"glTexGenxOES",glTexGenxOES);
+  jsonCount(jo,"glTexGenxvOES",glTexGenxvOES);
+
+/* GL_OES_vertex_array_object */
+
+  jsonCount(jo,"glBindVertexArrayOES",glBindVertexArrayOES);
+  jsonCount(jo,"glDeleteVertexArraysOES",glDeleteVertexArraysOES);
+  jsonCount(jo,"glGenVertexArraysOES",glGenVertexArraysOES);
+  jsonCount(jo,"glIsVertexArrayOES",glIsVertexArrayOES);
+
+/* GL_PGI_misc_hints */
+
+  jsonCount(jo,"glHintPGI",glHintPGI);
+
+/* GL_QCOM_alpha_test */
+
+  jsonCount(jo,"glAlphaFuncQCOM",glAlphaFuncQCOM);
+
+/* GL_QCOM_driver_control */
+
+  jsonCount(jo,"glDisableDriverControlQCOM",glDisableDriverControlQCOM);
+  jsonCount(jo,"glEnableDriverControlQCOM",glEnableDriverControlQCOM);
+  jsonCount(jo,"glGetDriverControlStringQCOM",glGetDriverControlStringQCOM);
+  jsonCount(jo,"glGetDriverControlsQCOM",glGetDriverControlsQCOM);
+
+/* GL_QCOM_extended_get */
+
+  jsonCount(jo,"glExtGetBufferPointervQCOM",glExtGetBufferPointervQCOM);
+  jsonCount(jo,"glExtGetBuffersQCOM",glExtGetBuffersQCOM);
+  jsonCount(jo,"glExtGetFramebuffersQCOM",glExtGetFramebuffersQCOM);
+  jsonCount(jo,"glExtGetRenderbuffersQCOM",glExtGetRenderbuffersQCOM);
+  jsonCount(jo,"glExtGetTexLevelParameterivQCOM",glExtGetTexLevelParameterivQCOM);
+  jsonCount(jo,"glExtGetTexSubImageQCOM",glExtGetTexSubImageQCOM);
+  jsonCount(jo,"glExtGetTexturesQCOM",glExtGetTexturesQCOM);
+  jsonCount(jo,"glExtTexObjectStateOverrideiQCOM",glExtTexObjectStateOverrideiQCOM);
+
+/* GL_QCOM_extended_get2 */
+
+  jsonCount(jo,"glExtGetProgramBinarySourceQCOM",glExtGetProgramBinarySourceQCOM);
+  jsonCount(jo,"glExtGetProgramsQCOM",glExtGetProgramsQCOM);
+  jsonCount(jo,"glExtGetShadersQCOM",glExtGetShadersQCOM);
+  jsonCount(jo,"glExtIsProgramBinaryQCOM",glExtIsProgramBinaryQCOM);
+
+/* GL_QCOM_tiled_rendering */
+
+  jsonCount(jo,"glEndTilingQCOM",glEndTilingQCOM);
+  jsonCount(jo,"glStartTilingQCOM",glStartTilingQCOM);
+
+/* GL_REGAL_ES1_0_compatibility */
+
+  jsonCount(jo,"glAlphaFuncx",glAlphaFuncx);
+  jsonCount(jo,"glClearColorx",glClearColorx);
+  jsonCount(jo,"glClearDepthx",glClearDepthx);
+  jsonCount(jo,"glColor4x",glColor4x);
+  jsonCount(jo,"glDepthRangex",glDepthRangex);
+  jsonCount(jo,"glFogx",glFogx);
+  jsonCount(jo,"glFogxv",glFogxv);
+  jsonCount(jo,"glFrustumf",glFrustumf);
+  jsonCount(jo,"glFrustumx",glFrustumx);
+  jsonCount(jo,"glLightModelx",glLightModelx);
+  jsonCount(jo,"glLightModelxv",glLightModelxv);
+  jsonCount(jo,"glLightx",glLightx);
+  jsonCount(jo,"glLightxv",glLightxv);
+  jsonCount(jo,"glLineWidthx",glLineWidthx);
+  jsonCount(jo,"glLoadMatrixx",glLoadMatrixx);
+  jsonCount(jo,"glMaterialx",glMaterialx);
+  jsonCount(jo,"glMaterialxv",glMaterialxv);
+  jsonCount(jo,"glMultMatrixx",glMultMatrixx);
+  jsonCount(jo,"glMultiTexCoord4x",glMultiTexCoord4x);
+  jsonCount(jo,"glNormal3x",glNormal3x);
+  jsonCount(jo,"glOrthof",glOrthof);
+  jsonCount(jo,"glOrthox",glOrthox);
+  jsonCount(jo,"glPointSizex",glPointSizex);
+  jsonCount(jo,"glPolygonOffsetx",glPolygonOffsetx);
+  jsonCount(jo,"glRotatex",glRotatex);
+  jsonCount(jo,"glSampleCoveragex",glSampleCoveragex);
+  jsonCount(jo,"glScalex",glScalex);
+  jsonCount(jo,"glTexEnvx",glTexEnvx);
+  jsonCount(jo,"glTexEnvxv",glTexEnvxv);
+  jsonCount(jo,"glTexParameterx",glTexParameterx);
+  jsonCount(jo,"glTranslatex",glTranslatex);
+
+/* GL_REGAL_ES1_1_compatibility */
+
+  jsonCount(jo,"glClipPlanef",glClipPlanef);
+  jsonCount(jo,"glClipPlanex",glClipPlanex);
+  jsonCount(jo,"glGetClipPlanef",glGetClipPlanef);
+  jsonCount(jo,"glGetClipPlanex",glGetClipPlanex);
+  jsonCount(jo,"glGetFixedv",glGetFixedv);
+  jsonCount(jo,"glGetLightxv",glGetLightxv);
+  jsonCount(jo,"glGetMaterialxv",glGetMaterialxv);
+  jsonCount(jo,"glGetTexEnvxv",glGetTexEnvxv);
+  jsonCount(jo,"glGetTexParameterxv",glGetTexParameterxv);
+  jsonCount(jo,"glPointParameterx",glPointParameterx);
+  jsonCount(jo,"glPointParameterxv",glPointParameterxv);
+  jsonCount(jo,"glPointSizePointerOES",glPointSizePointerOES);
+  jsonCount(jo,"glTexParameterxv",glTexParameterxv);
+
+/* GL_REGAL_log */
+
+  jsonCount(jo,"glLogMessageCallbackREGAL",glLogMessageCallbackREGAL);
+
+/* GL_SGIS_detail_texture */
+
+  jsonCount(jo,"glDetailTexFuncSGIS",glDetailTexFuncSGIS);
+  jsonCount(jo,"glGetDetailTexFuncSGIS",glGetDetailTexFuncSGIS);
+
+/* GL_SGIS_fog_function */
+
+  jsonCount(jo,"glFogFuncSGIS",glFogFuncSGIS);
+  jsonCount(jo,"glGetFogFuncSGIS",glGetFogFuncSGIS);
+
+/* GL_SGIS_multisample */
+
+  jsonCount(jo,"glSampleMaskSGIS",glSampleMaskSGIS);
+  jsonCount(jo,"glSamplePatternSGIS",glSamplePatternSGIS);
+
+/* GL_SGIS_pixel_texture */
+
+  jsonCount(jo,"glGetPixelTexGenParameterfvSGIS",glGetPixelTexGenParameterfvSGIS);
+  jsonCount(jo,"glGetPixelTexGenParameterivSGIS",glGetPixelTexGenParameterivSGIS);
+  jsonCount(jo,"glPixelTexGenParameterfSGIS",glPixelTexGenParameterfSGIS);
+  jsonCount(jo,"glPixelTexGenParameterfvSGIS",glPixelTexGenParameterfvSGIS);
+  jsonCount(jo,"glPixelTexGenParameteriSGIS",glPixelTexGenParameteriSGIS);
+  jsonCount(jo,"glPixelTexGenParameterivSGIS",glPixelTexGenParameterivSGIS);
+
+/* GL_SGIS_point_parameters */
+
+  jsonCount(jo,"glPointParameterfSGIS",glPointParameterfSGIS);
+  jsonCount(jo,"glPointParameterfvSGIS",glPointParameterfvSGIS);
+
+/* GL_SGIS_sharpen_texture */
+
+  jsonCount(jo,"glGetSharpenTexFuncSGIS",glGetSharpenTexFuncSGIS);
+  jsonCount(jo,"glSharpenTexFuncSGIS",glSharpenTexFuncSGIS);
+
+/* GL_SGIS_texture4D */
+
+  jsonCount(jo,"glTexImage4DSGIS",glTexImage4DSGIS);
+  jsonCount(jo,"glTexSubImage4DSGIS",glTexSubImage4DSGIS);
+
+/* GL_SGIS_texture_color_mask */
+
+  jsonCount(jo,"glTextureColorMaskSGIS",glTextureColorMaskSGIS);
+
+/* GL_SGIS_texture_filter4 */
+
+  jsonCount(jo,"glGetTexFilterFuncSGIS",glGetTexFilterFuncSGIS);
+  jsonCount(jo,"glTexFilterFuncSGIS",glTexFilterFuncSGIS);
+
+/* GL_SGIX_async */
+
+  jsonCount(jo,"glAsyncMarkerSGIX",glAsyncMarkerSGIX);
+  jsonCount(jo,"glDeleteAsyncMarkersSGIX",glDeleteAsyncMarkersSGIX);
+  jsonCount(jo,"glFinishAsyncSGIX",glFinishAsyncSGIX);
+  jsonCount(jo,"glGenAsyncMarkersSGIX",glGenAsyncMarkersSGIX);
+  jsonCount(jo,"glIsAsyncMarkerSGIX",glIsAsyncMarkerSGIX);
+  jsonCount(jo,"glPollAsyncSGIX",glPollAsyncSGIX);
+
+/* GL_SGIX_flush_raster */
+
+  jsonCount(jo,"glFlushRasterSGIX",glFlushRasterSGIX);
+
+/* GL_SGIX_fog_texture */
+
+  jsonCount(jo,"glTextureFogSGIX",glTextureFogSGIX);
+
+/* GL_SGIX_fragment_lighting */
+
+  jsonCount(jo,"glFragmentColorMaterialSGIX",glFragmentColorMaterialSGIX);
+  jsonCount(jo,"glFragmentLightModelfSGIX",glFragmentLightModelfSGIX);
+  jsonCount(jo,"glFragmentLightModelfvSGIX",glFragmentLightModelfvSGIX);
+  jsonCount(jo,"glFragmentLightModeliSGIX",glFragmentLightModeliSGIX);
+  jsonCount(jo,"glFragmentLightModelivSGIX",glFragmentLightModelivSGIX);
+  jsonCount(jo,"glFragmentLightfSGIX",glFragmentLightfSGIX);
+  jsonCount(jo,"glFragmentLightfvSGIX",glFragmentLightfvSGIX);
+  jsonCount(jo,"glFragmentLightiSGIX",glFragmentLightiSGIX);
+  jsonCount(jo,"glFragmentLightivSGIX",glFragmentLightivSGIX);
+  jsonCount(jo,"glFragmentMaterialfSGIX",glFragmentMaterialfSGIX);
+  jsonCount(jo,"glFragmentMaterialfvSGIX",glFragmentMaterialfvSGIX);
+  jsonCount(jo,"glFragmentMaterialiSGIX",glFragmentMaterialiSGIX);
+  jsonCount(jo,"glFragmentMaterialivSGIX",glFragmentMaterialivSGIX);
+  jsonCount(jo,"glGetFragmentLightfvSGIX",glGetFragmentLightfvSGIX);
+  jsonCount(jo,"glGetFragmentLightivSGIX",glGetFragmentLightivSGIX);
+  jsonCount(jo,"glGetFragmentMaterialfvSGIX",glGetFragmentMaterialfvSGIX);
+  jsonCount(jo,"glGetFragmentMaterialivSGIX",glGetFragmentMaterialivSGIX);
+  jsonCount(jo,"glLightEnviSGIX",glLightEnviSGIX);
+
+/* GL_SGIX_framezoom */
+
+  jsonCount(jo,"glFrameZoomSGIX",glFrameZoomSGIX);
+
+/* GL_SGIX_igloo_interface */
+
+  jsonCount(jo,"glIglooInterfaceSGIX",glIglooInterfaceSGIX);
+
+/* GL_SGIX_instruments */
+
+  jsonCount(jo,"glGetInstrumentsSGIX",glGetInstrumentsSGIX);
+  jsonCount(jo,"glInstrumentsBufferSGIX",glInstrumentsBufferSGIX);
+  jsonCount(jo,"glPollInstrumentsSGIX",glPollInstrumentsSGIX);
+  jsonCount(jo,"glReadInstrumentsSGIX",glReadInstrumentsSGIX);
+  jsonCount(jo,"glStartInstrumentsSGIX",glStartInstrumentsSGIX);
+  jsonCount(jo,"glStopInstrumentsSGIX",glStopInstrumentsSGIX);
+
+/* GL_SGIX_list_priority */
+
+  jsonCount(jo,"glGetListParameterfvSGIX",glGetListParameterfvSGIX);
+  jsonCount(jo,"glGetListParameterivSGIX",glGetListParameterivSGIX);
+  jsonCount(jo,"glListParameterfSGIX",glListParameterfSGIX);
+  jsonCount(jo,"glListParameterfvSGIX",glListParameterfvSGIX);
+  jsonCount(jo,"glListParameteriSGIX",glListParameteriSGIX);
+  jsonCount(jo,"glListParameterivSGIX",glListParameterivSGIX);
+
+/* GL_SGIX_pixel_texture */
+
+  jsonCount(jo,"glPixelTexGenSGIX",glPixelTexGenSGIX);
+
+/* GL_SGIX_polynomial_ffd */
+
+  jsonCount(jo,"glDeformSGIX",glDeformSGIX);
+  jsonCount(jo,"glDeformationMap3dSGIX",glDeformationMap3dSGIX);
+  jsonCount(jo,"glDeformationMap3fSGIX",glDeformationMap3fSGIX);
+  jsonCount(jo,"glLoadIdentityDeformationMapSGIX",glLoadIdentityDeformationMapSGIX);
+
+/* GL_SGIX_reference_plane */
+
+  jsonCount(jo,"glReferencePlaneSGIX",glReferencePlaneSGIX);
+
+/* GL_SGIX_sprite */
+
+  jsonCount(jo,"glSpriteParameterfSGIX",glSpriteParameterfSGIX);
+  jsonCount(jo,"glSpriteParameterfvSGIX",glSpriteParameterfvSGIX);
+  jsonCount(jo,"glSpriteParameteriSGIX",glSpriteParameteriSGIX);
+  jsonCount(jo,"glSpriteParameterivSGIX",glSpriteParameterivSGIX);
+
+/* GL_SGIX_tag_sample_buffer */
+
+  jsonCount(jo,"glTagSampleBufferSGIX",glTagSampleBufferSGIX);
+
+/* GL_SGI_color_table */
+
+  jsonCount(jo,"glColorTableParameterfvSGI",glColorTableParameterfvSGI);
+  jsonCount(jo,"glColorTableParameterivSGI",glColorTableParameterivSGI);
+  jsonCount(jo,"glColorTableSGI",glColorTableSGI);
+  jsonCount(jo,"glCopyColorTableSGI",glCopyColorTableSGI);
+  jsonCount(jo,"glGetColorTableParameterfvSGI",glGetColorTableParameterfvSGI);
+  jsonCount(jo,"glGetColorTableParameterivSGI",glGetColorTableParameterivSGI);
+  jsonCount(jo,"glGetColorTableSGI",glGetColorTableSGI);
+
+/* GL_SUNX_constant_data */
+
+  jsonCount(jo,"glFinishTextureSUNX",glFinishTextureSUNX);
+
+/* GL_SUN_global_alpha */
+
+  jsonCount(jo,"glGlobalAlphaFactorbSUN",glGlobalAlphaFactorbSUN);
+  jsonCount(jo,"glGlobalAlphaFactordSUN",glGlobalAlphaFactordSUN);
+  jsonCount(jo,"glGlobalAlphaFactorfSUN",glGlobalAlphaFactorfSUN);
+  jsonCount(jo,"glGlobalAlphaFactoriSUN",glGlobalAlphaFactoriSUN);
+  jsonCount(jo,"glGlobalAlphaFactorsSUN",glGlobalAlphaFactorsSUN);
+  jsonCount(jo,"glGlobalAlphaFactorubSUN",glGlobalAlphaFactorubSUN);
+  jsonCount(jo,"glGlobalAlphaFactoruiSUN",glGlobalAlphaFactoruiSUN);
+  jsonCount(jo,"glGlobalAlphaFactorusSUN",glGlobalAlphaFactorusSUN);
+
+/* GL_SUN_mesh_array */
+
+  jsonCount(jo,"glDrawMeshArraysSUN",glDrawMeshArraysSUN);
+
+/* GL_SUN_read_video_pixels */
+
+  jsonCount(jo,"glReadVideoPixelsSUN",glReadVideoPixelsSUN);
+
+/* GL_SUN_triangle_list */
+
+  jsonCount(jo,"glReplacementCodePointerSUN",glReplacementCodePointerSUN);
+  jsonCount(jo,"glReplacementCodeubSUN",glReplacementCodeubSUN);
+  jsonCount(jo,"glReplacementCodeubvSUN",glReplacementCodeubvSUN);
+  jsonCount(jo,"glReplacementCodeuiSUN",glReplacementCodeuiSUN);
+  jsonCount(jo,"glReplacementCodeuivSUN",glReplacementCodeuivSUN);
+  jsonCount(jo,"glReplacementCodeusSUN",glReplacementCodeusSUN);
+  jsonCount(jo,"glReplacementCodeusvSUN",glReplacementCodeusvSUN);
+
+/* GL_SUN_vertex */
+
+  jsonCount(jo,"glColor3fVertex3fSUN",glColor3fVertex3fSUN);
+  jsonCount(jo,"glColor3fVertex3fvSUN",glColor3fVertex3fvSUN);
+  jsonCount(jo,"glColor4fNormal3fVertex3fSUN",glColor4fNormal3fVertex3fSUN);
+  jsonCount(jo,"glColor4fNormal3fVertex3fvSUN",glColor4fNormal3fVertex3fvSUN);
+  jsonCount(jo,"glColor4ubVertex2fSUN",glColor4ubVertex2fSUN);
+  jsonCount(jo,"glColor4ubVertex2fvSUN",glColor4ubVertex2fvSUN);
+  jsonCount(jo,"glColor4ubVertex3fSUN",glColor4ubVertex3fSUN);
+  jsonCount(jo,"glColor4ubVertex3fvSUN",glColor4ubVertex3fvSUN);
+  jsonCount(jo,"glNormal3fVertex3fSUN",glNormal3fVertex3fSUN);
+  jsonCount(jo,"glNormal3fVertex3fvSUN",glNormal3fVertex3fvSUN);
+  jsonCount(jo,"glReplacementCodeuiColor3fVertex3fSUN",glReplacementCodeuiColor3fVertex3fSUN);
+  jsonCount(jo,"glReplacementCodeuiColor3fVertex3fvSUN",glReplacementCodeuiColor3fVertex3fvSUN);
+  jsonCount(jo,"glReplacementCodeuiColor4fNormal3fVertex3fSUN",glReplacementCodeuiColor4fNormal3fVertex3fSUN);
+  jsonCount(jo,"glReplacementCodeuiColor4fNormal3fVertex3fvSUN",glReplacementCodeuiColor4fNormal3fVertex3fvSUN);
+  jsonCount(jo,"glReplacementCodeuiColor4ubVertex3fSUN",glReplacementCodeuiColor4ubVertex3fSUN);
+  jsonCount(jo,"glReplacementCodeuiColor4ubVertex3fvSUN",glReplacementCodeuiColor4ubVertex3fvSUN);
+  jsonCount(jo,"glReplacementCodeuiNormal3fVertex3fSUN",glReplacementCodeuiNormal3fVertex3fSUN);
+  jsonCount(jo,"glReplacementCodeuiNormal3fVertex3fvSUN",glReplacementCodeuiNormal3fVertex3fvSUN);
+  jsonCount(jo,"glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN",glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN);
+  jsonCount(jo,"glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN",glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN);
+  jsonCount(jo,"glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN",glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN);
+  jsonCount(jo,"glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN",glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN);
+  jsonCount(jo,"glReplacementCodeuiTexCoord2fVertex3fSUN",glReplacementCodeuiTexCoord2fVertex3fSUN);
+  jsonCount(jo,"glReplacementCodeuiTexCoord2fVertex3fvSUN",glReplacementCodeuiTexCoord2fVertex3fvSUN);
+  jsonCount(jo,"glReplacementCodeuiVertex3fSUN",glReplacementCodeuiVertex3fSUN);
+  jsonCount(jo,"glReplacementCodeuiVertex3fvSUN",glReplacementCodeuiVertex3fvSUN);
+  jsonCount(jo,"glTexCoord2fColor3fVertex3fSUN",glTexCoord2fColor3fVertex3fSUN);
+  jsonCount(jo,"glTexCoord2fColor3fVertex3fvSUN",glTexCoord2fColor3fVertex3fvSUN);
+  jsonCount(jo,"glTexCoord2fColor4fNormal3fVertex3fSUN",glTexCoord2fColor4fNormal3fVertex3fSUN);
+  jsonCount(jo,"glTexCoord2fColor4fNormal3fVertex3fvSUN",glTexCoord2fColor4fNormal3fVertex3fvSUN);
+  jsonCount(jo,"glTexCoord2fColor4ubVertex3fSUN",glTexCoord2fColor4ubVertex3fSUN);
+  jsonCount(jo,"glTexCoord2fColor4ubVertex3fvSUN",glTexCoord2fColor4ubVertex3fvSUN);
+  jsonCount(jo,"glTexCoord2fNormal3fVertex3fSUN",glTexCoord2fNormal3fVertex3fSUN);
+  jsonCount(jo,"glTexCoord2fNormal3fVertex3fvSUN",glTexCoord2fNormal3fVertex3fvSUN);
+  jsonCount(jo,"glTexCoord2fVertex3fSUN",glTexCoord2fVertex3fSUN);
+  jsonCount(jo,"glTexCoord2fVertex3fvSUN",glTexCoord2fVertex3fvSUN);
+  jsonCount(jo,"glTexCoord4fColor4fNormal3fVertex4fSUN",glTexCoord4fColor4fNormal3fVertex4fSUN);
+  jsonCount(jo,"glTexCoord4fColor4fNormal3fVertex4fvSUN",glTexCoord4fColor4fNormal3fVertex4fvSUN);
+  jsonCount(jo,"glTexCoord4fVertex4fSUN",glTexCoord4fVertex4fSUN);
+  jsonCount(jo,"glTexCoord4fVertex4fvSUN",glTexCoord4fVertex4fvSUN);
+
+/* GL_WIN_swap_hint */
+
+  jsonCount(jo,"glAddSwapHintRectWIN",glAddSwapHintRectWIN);
+
+#if REGAL_SYS_WGL
+
+/* WGL_3DL_stereo_control */
+
+  jsonCount(jo,"wglSetStereoEmitterState3DL",wglSetStereoEmitterState3DL);
+
+/* WGL_AMD_gpu_association */
+
+  jsonCount(jo,"wglBlitContextFramebufferAMD",wglBlitContextFramebufferAMD);
+  jsonCount(jo,"wglCreateAssociatedContextAMD",wglCreateAssociatedContextAMD);
+  jsonCount(jo,"wglCreateAssociatedContextAttribsAMD",wglCreateAssociatedContextAttribsAMD);
+  jsonCount(jo,"wglDeleteAssociatedContextAMD",wglDeleteAssociatedContextAMD);
+  jsonCount(jo,"wglGetContextGPUIDAMD",wglGetContextGPUIDAMD);
+  jsonCount(jo,"wglGetCurrentAssociatedContextAMD",wglGetCurrentAssociatedContextAMD);
+  jsonCount(jo,"wglGetGPUIDsAMD",wglGetGPUIDsAMD);
+  jsonCount(jo,"wglGetGPUInfoAMD",wglGetGPUInfoAMD);
+  jsonCount(jo,"wglMakeAssociatedContextCurrentAMD",wglMakeAssociatedContextCurrentAMD);
+
+/* WGL_ARB_buffer_region */
+
+  jsonCount(jo,"wglCreateBufferRegionARB",wglCreateBufferRegionARB);
+  jsonCount(jo,"wglDeleteBufferRegionARB",wglDeleteBufferRegionARB);
+  jsonCount(jo,"wglRestoreBufferRegionARB",wglRestoreBufferRegionARB);
+  jsonCount(jo,"wglSaveBufferRegionARB",wglSaveBufferRegionARB);
+
+/* WGL_ARB_create_context */
+
+  jsonCount(jo,"wglCreateContextAttribsARB",wglCreateContextAttribsARB);
+
+/* WGL_ARB_extensions_string */
+
+  jsonCount(jo,"wglGetExtensionsStringARB",wglGetExtensionsStringARB);
+
+/* WGL_ARB_make_current_read */
+
+  jsonCount(jo,"wglGetCurrentReadDCARB",wglGetCurrentReadDCARB);
+  jsonCount(jo,"wglMakeContextCurrentARB",wglMakeContextCurrentARB);
+
+/* WGL_ARB_pbuffer */
+
+  jsonCount(jo,"wglCreatePbufferARB",wglCreatePbufferARB);
+  jsonCount(jo,"wglDestroyPbufferARB",wglDestroyPbufferARB);
+  jsonCount(jo,"wglGetPbufferDCARB",wglGetPbufferDCARB);
+  jsonCount(jo,"wglQueryPbufferARB",wglQueryPbufferARB);
+  jsonCount(jo,"wglReleasePbufferDCARB",wglReleasePbufferDCARB);
+
+/* WGL_ARB_pixel_format */
+
+  jsonCount(jo,"wglChoosePixelFormatARB",wglChoosePixelFormatARB);
+  jsonCount(jo,"wglGetPixelFormatAttribfvARB",wglGetPixelFormatAttribfvARB);
+  jsonCount(jo,"wglGetPixelFormatAttribivARB",wglGetPixelFormatAttribivARB);
+
+/* WGL_ARB_render_texture */
+
+  jsonCount(jo,"wglBindTexImageARB",wglBindTexImageARB);
+  jsonCount(jo,"wglReleaseTexImageARB",wglReleaseTexImageARB);
+  jsonCount(jo,"wglSetPbufferAttribARB",wglSetPbufferAttribARB);
+
+/* WGL_EXT_display_color_table */
+
+  jsonCount(jo,"wglBindDisplayColorTableEXT",wglBindDisplayColorTableEXT);
+  jsonCount(jo,"wglCreateDisplayColorTableEXT",wglCreateDisplayColorTableEXT);
+  jsonCount(jo,"wglDestroyDisplayColorTableEXT",wglDestroyDisplayColorTableEXT);
+  jsonCount(jo,"wglLoadDisplayColorTableEXT",wglLoadDisplayColorTableEXT);
+
+/* WGL_EXT_extensions_string */
+
+  jsonCount(jo,"wglGetExtensionsStringEXT",wglGetExtensionsStringEXT);
+
+/* WGL_EXT_make_current_read */
+
+  jsonCount(jo,"wglGetCurrentReadDCEXT",wglGetCurrentReadDCEXT);
+  jsonCount(jo,"wglMakeContextCurrentEXT",wglMakeContextCurrentEXT);
+
+/* WGL_EXT_pbuffer */
+
+  jsonCount(jo,"wglCreatePbufferEXT",wglCreatePbufferEXT);
+  jsonCount(jo,"wglDestroyPbufferEXT",wglDestroyPbufferEXT);
+  jsonCount(jo,"wglGetPbufferDCEXT",wglGetPbufferDCEXT);
+  jsonCount(jo,"wglQueryPbufferEXT",wglQueryPbufferEXT);
+  jsonCount(jo,"wglReleasePbufferDCEXT",wglReleasePbufferDCEXT);
+
+/* WGL_EXT_pixel_format */
+
+  jsonCount(jo,"wglChoosePixelFormatEXT",wglChoosePixelFormatEXT);
+  jsonCount(jo,"wglGetPixelFormatAttribfvEXT",wglGetPixelFormatAttribfvEXT);
+  jsonCount(jo,"wglGetPixelFormatAttribivEXT",wglGetPixelFormatAttribivEXT);
+
+/* WGL_EXT_swap_control */
+
+  jsonCount(jo,"wglGetSwapIntervalEXT",wglGetSwapIntervalEXT);
+  jsonCount(jo,"wglSwapIntervalEXT",wglSwapIntervalEXT);
+
+/* WGL_GDI */
+
+  jsonCount(jo,"wglChoosePixelFormat",wglChoosePixelFormat);
+  jsonCount(jo,"wglDescribePixelFormat",wglDescribePixelFormat);
+  jsonCount(jo,"wglGetPixelFormat",wglGetPixelFormat);
+  jsonCount(jo,"wglSetPixelFormat",wglSetPixelFormat);
+  jsonCount(jo,"wglSwapBuffers",wglSwapBuffers);
+
+/* WGL_I3D_digital_video_control */
+
+  jsonCount(jo,"wglGetDigitalVideoParametersI3D",wglGetDigitalVideoParametersI3D);
+  jsonCount(jo,"wglSetDigitalVideoParametersI3D",wglSetDigitalVideoParametersI3D);
+
+/* WGL_I3D_gamma */
+
+  jsonCount(jo,"wglGetGammaTableI3D",wglGetGammaTableI3D);
+  jsonCount(jo,"wglGetGammaTableParametersI3D",wglGetGammaTableParametersI3D);
+  jsonCount(jo,"wglSetGammaTableI3D",wglSetGammaTableI3D);
+  jsonCount(jo,"wglSetGammaTableParametersI3D",wglSetGammaTableParametersI3D);
+
+/* WGL_I3D_genlock */
+
+  jsonCount(jo,"wglDisableGenlockI3D",wglDisableGenlockI3D);
+  jsonCount(jo,"wglEnableGenlockI3D",wglEnableGenlockI3D);
+  jsonCount(jo,"wglGenlockSampleRateI3D",wglGenlockSampleRateI3D);
+  jsonCount(jo,"wglGenlockSourceDelayI3D",wglGenlockSourceDelayI3D);
+  jsonCount(jo,"wglGenlockSourceEdgeI3D",wglGenlockSourceEdgeI3D);
+  jsonCount(jo,"wglGenlockSourceI3D",wglGenlockSourceI3D);
+  jsonCount(jo,"wglGetGenlockSampleRateI3D",wglGetGenlockSampleRateI3D);
+  jsonCount(jo,"wglGetGenlockSourceDelayI3D",wglGetGenlockSourceDelayI3D);
+  jsonCount(jo,"wglGetGenlockSourceEdgeI3D",wglGetGenlockSourceEdgeI3D);
+  jsonCount(jo,"wglGetGenlockSourceI3D",wglGetGenlockSourceI3D);
+  jsonCount(jo,"wglIsEnabledGenlockI3D",wglIsEnabledGenlockI3D);
+  jsonCount(jo,"wglQueryGenlockMaxSourceDelayI3D",wglQueryGenlockMaxSourceDelayI3D);
+
+/* WGL_I3D_image_buffer */
+
+  jsonCount(jo,"wglAssociateImageBufferEventsI3D",wglAssociateImageBufferEventsI3D);
+  jsonCount(jo,"wglCreateImageBufferI3D",wglCreateImageBufferI3D);
+  jsonCount(jo,"wglDestroyImageBufferI3D",wglDestroyImageBufferI3D);
+  jsonCount(jo,"wglReleaseImageBufferEventsI3D",wglReleaseImageBufferEventsI3D);
+
+/* WGL_I3D_swap_frame_lock */
+
+  jsonCount(jo,"wglDisableFrameLockI3D",wglDisableFrameLockI3D);
+  jsonCount(jo,"wglEnableFrameLockI3D",wglEnableFrameLockI3D);
+  jsonCount(jo,"wglIsEnabledFrameLockI3D",wglIsEnabledFrameLockI3D);
+  jsonCount(jo,"wglQueryFrameLockMasterI3D",wglQueryFrameLockMasterI3D);
+
+/* WGL_I3D_swap_frame_usage */
+
+  jsonCount(jo,"wglBeginFrameTrackingI3D",wglBeginFrameTrackingI3D);
+  jsonCount(jo,"wglEndFrameTrackingI3D",wglEndFrameTrackingI3D);
+  jsonCount(jo,"wglGetFrameUsageI3D",wglGetFrameUsageI3D);
+  jsonCount(jo,"wglQueryFrameTrackingI3D",wglQueryFrameTrackingI3D);
+
+/* WGL_NV_DX_interop */
+
+  jsonCount(jo,"wglDXCloseDeviceNV",wglDXCloseDeviceNV);
+  jsonCount(jo,"wglDXLockObjectsNV",wglDXLockObjectsNV);
+  jsonCount(jo,"wglDXObjectAccessNV",wglDXObjectAccessNV);
+  jsonCount(jo,"wglDXOpenDeviceNV",wglDXOpenDeviceNV);
+  jsonCount(jo,"wglDXRegisterObjectNV",wglDXRegisterObjectNV);
+  jsonCount(jo,"wglDXSetResourceShareHandleNV",wglDXSetResourceShareHandleNV);
+  jsonCount(jo,"wglDXUnlockObjectsNV",wglDXUnlockObjectsNV);
+  jsonCount(jo,"wglDXUnregisterObjectNV",wglDXUnregisterObjectNV);
+
+/* WGL_NV_copy_image */
+
+  jsonCount(jo,"wglCopyImageSubDataNV",wglCopyImageSubDataNV);
+
+/* WGL_NV_delay_before_swap */
+
+  jsonCount(jo,"wglDelayBeforeSwapNV",wglDelayBeforeSwapNV);
+
+/* WGL_NV_gpu_affinity */
+
+  jsonCount(jo,"wglCreateAffinityDCNV",wglCreateAffinityDCNV);
+  jsonCount(jo,"wglDeleteDCNV",wglDeleteDCNV);
+  jsonCount(jo,"wglEnumGpuDevicesNV",wglEnumGpuDevicesNV);
+  jsonCount(jo,"wglEnumGpusFromAffinityDCNV",wglEnumGpusFromAffinityDCNV);
+  jsonCount(jo,"wglEnumGpusNV",wglEnumGpusNV);
+
+/* WGL_NV_present_video */
+
+  jsonCount(jo,"wglBindVideoDeviceNV",wglBindVideoDeviceNV);
+  jsonCount(jo,"wglEnumerateVideoDevicesNV",wglEnumerateVideoDevicesNV);
+  jsonCount(jo,"wglQueryCurrentContextNV",wglQueryCurrentContextNV);
+
+/* WGL_NV_swap_group */
+
+  jsonCount(jo,"wglBindSwapBarrierNV",wglBindSwapBarrierNV);
+  jsonCount(jo,"wglJoinSwapGroupNV",wglJoinSwapGroupNV);
+  jsonCount(jo,"wglQueryFrameCountNV",wglQueryFrameCountNV);
+  jsonCount(jo,"wglQueryMaxSwapGroupsNV",wglQueryMaxSwapGroupsNV);
+  jsonCount(jo,"wglQuerySwapGroupNV",wglQuerySwapGroupNV);
+  jsonCount(jo,"wglResetFrameCountNV",wglResetFrameCountNV);
+
+/* WGL_NV_vertex_array_range */
+
+  jsonCount(jo,"wglAllocateMemoryNV",wglAllocateMemoryNV);
+  jsonCount(jo,"wglFreeMemoryNV",wglFreeMemoryNV);
+
+/* WGL_NV_video_capture */
+
+  jsonCount(jo,"wglBindVideoCaptureDeviceNV",wglBindVideoCaptureDeviceNV);
+  jsonCount(jo,"wglEnumerateVideoCaptureDevicesNV",wglEnumerateVideoCaptureDevicesNV);
+  jsonCount(jo,"wglLockVideoCaptureDeviceNV",wglLockVideoCaptureDeviceNV);
+  jsonCount(jo,"wglQueryVideoCaptureDeviceNV",wglQueryVideoCaptureDeviceNV);
+  jsonCount(jo,"wglReleaseVideoCaptureDeviceNV",wglReleaseVideoCaptureDeviceNV);
+
+/* WGL_NV_video_output */
+
+  jsonCount(jo,"wglBindVideoImageNV",wglBindVideoImageNV);
+  jsonCount(jo,"wglGetVideoDeviceNV",wglGetVideoDeviceNV);
+  jsonCount(jo,"wglGetVideoInfoNV",wglGetVideoInfoNV);
+  jsonCount(jo,"wglReleaseVideoDeviceNV",wglReleaseVideoDeviceNV);
+  jsonCount(jo,"wglReleaseVideoImageNV",wglReleaseVideoImageNV);
+  jsonCount(jo,"wglSendPbufferToVideoNV",wglSendPbufferToVideoNV);
+
+/* WGL_OML_sync_control */
+
+  jsonCount(jo,"wglGetMscRateOML",wglGetMscRateOML);
+  jsonCount(jo,"wglGetSyncValuesOML",wglGetSyncValuesOML);
+  jsonCount(jo,"wglSwapBuffersMscOML",wglSwapBuffersMscOML);
+  jsonCount(jo,"wglSwapLayerBuffersMscOML",wglSwapLayerBuffersMscOML);
+  jsonCount(jo,"wglWaitForMscOML",wglWaitForMscOML);
+  jsonCount(jo,"wglWaitForSbcOML",wglWaitForSbcOML);
+
+/* WGL_core */
+
+  jsonCount(jo,"wglCopyContext",wglCopyContext);
+  jsonCount(jo,"wglCreateContext",wglCreateContext);
+  jsonCount(jo,"wglCreateLayerContext",wglCreateLayerContext);
+  jsonCount(jo,"wglDeleteContext",wglDeleteContext);
+  jsonCount(jo,"wglDescribeLayerPlane",wglDescribeLayerPlane);
+  jsonCount(jo,"wglGetCurrentContext",wglGetCurrentContext);
+  jsonCount(jo,"wglGetCurrentDC",wglGetCurrentDC);
+  jsonCount(jo,"wglGetDefaultProcAddress",wglGetDefaultProcAddress);
+  jsonCount(jo,"wglGetLayerPaletteEntries",wglGetLayerPaletteEntries);
+  jsonCount(jo,"wglGetProcAddress",wglGetProcAddress);
+  jsonCount(jo,"wglMakeCurrent",wglMakeCurrent);
+  jsonCount(jo,"wglRealizeLayerPalette",wglRealizeLayerPalette);
+  jsonCount(jo,"wglSetLayerPaletteEntries",wglSetLayerPaletteEntries);
+  jsonCount(jo,"wglShareLists",wglShareLists);
+  jsonCount(jo,"wglSwapLayerBuffers",wglSwapLayerBuffers);
+  jsonCount(jo,"wglSwapMultipleBuffers",wglSwapMultipleBuffers);
+  jsonCount(jo,"wglUseFontBitmapsA",wglUseFontBitmapsA);
+  jsonCount(jo,"wglUseFontBitmapsW",wglUseFontBitmapsW);
+  jsonCount(jo,"wglUseFontOutlinesA",wglUseFontOutlinesA);
+  jsonCount(jo,"wglUseFontOutlinesW",wglUseFontOutlinesW);
+#endif /* REGAL_SYS_WGL */
+
+#if REGAL_SYS_GLX
+
+/* GLX_VERSION_1_0 */
+
+  jsonCount(jo,"glXChooseVisual",glXChooseVisual);
+  jsonCount(jo,"glXCopyContext",glXCopyContext);
+  jsonCount(jo,"glXCreateContext",glXCreateContext);
+  jsonCount(jo,"glXCreateGLXPixmap",glXCreateGLXPixmap);
+  jsonCount(jo,"glXDestroyContext",glXDestroyContext);
+  jsonCount(jo,"glXDestroyGLXPixmap",glXDestroyGLXPixmap);
+  jsonCount(jo,"glXGetConfig",glXGetConfig);
+  jsonCount(jo,"glXGetCurrentContext",glXGetCurrentContext);
+  jsonCount(jo,"glXGetCurrentDrawable",glXGetCurrentDrawable);
+  jsonCount(jo,"glXIsDirect",glXIsDirect);
+  jsonCount(jo,"glXMakeCurrent",glXMakeCurrent);
+  jsonCount(jo,"glXQueryExtension",glXQueryExtension);
+  jsonCount(jo,"glXQueryVersion",glXQueryVersion);
+  jsonCount(jo,"glXSwapBuffers",glXSwapBuffers);
+  jsonCount(jo,"glXUseXFont",glXUseXFont);
+  jsonCount(jo,"glXWaitGL",glXWaitGL);
+  jsonCount(jo,"glXWaitX",glXWaitX);
+
+/* GLX_VERSION_1_1 */
+
+  jsonCount(jo,"glXGetClientString",glXGetClientString);
+  jsonCount(jo,"glXQueryExtensionsString",glXQueryExtensionsString);
+  jsonCount(jo,"glXQueryServerString",glXQueryServerString);
+
+/* GLX_VERSION_1_2 */
+
+  jsonCount(jo,"glXGetCurrentDisplay",glXGetCurrentDisplay);
+
+/* GLX_VERSION_1_3 */
+
+  jsonCount(jo,"glXChooseFBConfig",glXChooseFBConfig);
+  jsonCount(jo,"glXCreateNewContext",glXCreateNewContext);
+  jsonCount(jo,"glXCreatePbuffer",glXCreatePbuffer);
+  jsonCount(jo,"glXCreatePixmap",glXCreatePixmap);
+  jsonCount(jo,"glXCreateWindow",glXCreateWindow);
+  jsonCount(jo,"glXDestroyPbuffer",glXDestroyPbuffer);
+  jsonCount(jo,"glXDestroyPixmap",glXDestroyPixmap);
+  jsonCount(jo,"glXDestroyWindow",glXDestroyWindow);
+  jsonCount(jo,"glXGetCurrentReadDrawable",glXGetCurrentReadDrawable);
+  jsonCount(jo,"glXGetFBConfigAttrib",glXGetFBConfigAttrib);
+  jsonCount(jo,"glXGetFBConfigs",glXGetFBConfigs);
+  jsonCount(jo,"glXGetSelectedEvent",glXGetSelectedEvent);
+  jsonCount(jo,"glXGetVisualFromFBConfig",glXGetVisualFromFBConfig);
+  jsonCount(jo,"glXMakeContextCurrent",glXMakeContextCurrent);
+  jsonCount(jo,"glXQueryContext",glXQueryContext);
+  jsonCount(jo,"glXQueryDrawable",glXQueryDrawable);
+  jsonCount(jo,"glXSelectEvent",glXSelectEvent);
+
+/* GLX_VERSION_1_4 */
+
+  jsonCount(jo,"glXGetProcAddress",glXGetProcAddress);
+
+/* GLX_AMD_gpu_association */
+
+  jsonCount(jo,"glXBlitContextFramebufferAMD",glXBlitContextFramebufferAMD);
+  jsonCount(jo,"glXCreateAssociatedContextAMD",glXCreateAssociatedContextAMD);
+  jsonCount(jo,"glXCreateAssociatedContextAttribsAMD",glXCreateAssociatedContextAttribsAMD);
+  jsonCount(jo,"glXDeleteAssociatedContextAMD",glXDeleteAssociatedContextAMD);
+  jsonCount(jo,"glXGetContextGPUIDAMD",glXGetContextGPUIDAMD);
+  jsonCount(jo,"glXGetCurrentAssociatedContextAMD",glXGetCurrentAssociatedContextAMD);
+  jsonCount(jo,"glXGetGPUIDsAMD",glXGetGPUIDsAMD);
+  jsonCount(jo,"glXGetGPUInfoAMD",glXGetGPUInfoAMD);
+  jsonCount(jo,"glXMakeAssociatedContextCurrentAMD",glXMakeAssociatedContextCurrentAMD);
+
+/* GLX_ARB_create_context */
+
+  jsonCount(jo,"glXCreateContextAttribsARB",glXCreateContextAttribsARB);
+
+/* GLX_ARB_get_proc_address */
+
+  jsonCount(jo,"glXGetProcAddressARB",glXGetProcAddressARB);
+
+/* GLX_ATI_render_texture */
+
+  jsonCount(jo,"glXBindTexImageATI",glXBindTexImageATI);
+  jsonCount(jo,"glXDrawableAttribATI",glXDrawableAttribATI);
+  jsonCount(jo,"glXReleaseTexImageATI",glXReleaseTexImageATI);
+
+/* GLX_EXT_import_context */
+
+  jsonCount(jo,"glXFreeContextEXT",glXFreeContextEXT);
+  jsonCount(jo,"glXGetContextIDEXT",glXGetContextIDEXT);
+  jsonCount(jo,"glXImportContextEXT",glXImportContextEXT);
+  jsonCount(jo,"glXQueryContextInfoEXT",glXQueryContextInfoEXT);
+
+/* GLX_EXT_swap_control */
+
+  jsonCount(jo,"glXSwapIntervalEXT",glXSwapIntervalEXT);
+
+/* GLX_EXT_texture_from_pixmap */
+
+  jsonCount(jo,"glXBindTexImageEXT",glXBindTexImageEXT);
+  jsonCount(jo,"glXReleaseTexImageEXT",glXReleaseTexImageEXT);
+
+/* GLX_MESA_agp_offset */
+
+  jsonCount(jo,"glXGetAGPOffsetMESA",glXGetAGPOffsetMESA);
+
+/* GLX_MESA_copy_sub_buffer */
+
+  jsonCount(jo,"glXCopySubBufferMESA",glXCopySubBufferMESA);
+
+/* GLX_MESA_pixmap_colormap */
+
+  jsonCount(jo,"glXCreateGLXPixmapMESA",glXCreateGLXPixmapMESA);
+
+/* GLX_MESA_query_renderer */
+
+  jsonCount(jo,"glXQueryCurrentRendererIntegerMESA",glXQueryCurrentRendererIntegerMESA);
+  jsonCount(jo,"glXQueryCurrentRendererStringMESA",glXQueryCurrentRendererStringMESA);
+  jsonCount(jo,"glXQueryRendererIntegerMESA",glXQueryRendererIntegerMESA);
+  jsonCount(jo,"glXQueryRendererStringMESA",glXQueryRendererStringMESA);
+
+/* GLX_MESA_release_buffers */
+
+  jsonCount(jo,"glXReleaseBuffersMESA",glXReleaseBuffersMESA);
+
+/* GLX_MESA_set_3dfx_mode */
+
+  jsonCount(jo,"glXSet3DfxModeMESA",glXSet3DfxModeMESA);
+
+/* GLX_MESA_swap_control */
+
+  jsonCount(jo,"glXGetSwapIntervalMESA",glXGetSwapIntervalMESA);
+  jsonCount(jo,"glXSwapIntervalMESA",glXSwapIntervalMESA);
+
+/* GLX_NV_copy_buffer */
+
+  jsonCount(jo,"glXCopyBufferSubDataNV",glXCopyBufferSubDataNV);
+  jsonCount(jo,"glXNamedCopyBufferSubDataNV",glXNamedCopyBufferSubDataNV);
+
+/* GLX_NV_copy_image */
+
+  jsonCount(jo,"glXCopyImageSubDataNV",glXCopyImageSubDataNV);
+
+/* GLX_NV_delay_before_swap */
+
+  jsonCount(jo,"glXDelayBeforeSwapNV",glXDelayBeforeSwapNV);
+
+/* GLX_NV_present_video */
+
+  jsonCount(jo,"glXBindVideoDeviceNV",glXBindVideoDeviceNV);
+  jsonCount(jo,"glXEnumerateVideoDevicesNV",glXEnumerateVideoDevicesNV);
+
+/* GLX_NV_swap_group */
+
+  jsonCount(jo,"glXBindSwapBarrierNV",glXBindSwapBarrierNV);
+  jsonCount(jo,"glXJoinSwapGroupNV",glXJoinSwapGroupNV);
+  jsonCount(jo,"glXQueryFrameCountNV",glXQueryFrameCountNV);
+  jsonCount(jo,"glXQueryMaxSwapGroupsNV",glXQueryMaxSwapGroupsNV);
+  jsonCount(jo,"glXQuerySwapGroupNV",glXQuerySwapGroupNV);
+  jsonCount(jo,"glXResetFrameCountNV",glXResetFrameCountNV);
+
+/* GLX_NV_vertex_array_range */
+
+  jsonCount(jo,"glXAllocateMemoryNV",glXAllocateMemoryNV);
+  jsonCount(jo,"glXFreeMemoryNV",glXFreeMemoryNV);
+
+/* GLX_NV_video_capture */
+
+  jsonCount(jo,"glXBindVideoCaptureDeviceNV",glXBindVideoCaptureDeviceNV);
+  jsonCount(jo,"glXEnumerateVideoCaptureDevicesNV",glXEnumerateVideoCaptureDevicesNV);
+  jsonCount(jo,"glXLockVideoCaptureDeviceNV",glXLockVideoCaptureDeviceNV);
+  jsonCount(jo,"glXQueryVideoCaptureDeviceNV",glXQueryVideoCaptureDeviceNV);
+  jsonCount(jo,"glXReleaseVideoCaptureDeviceNV",glXReleaseVideoCaptureDeviceNV);
+
+/* GLX_NV_video_output */
+
+  jsonCount(jo,"glXBindVideoImageNV",glXBindVideoImageNV);
+  jsonCount(jo,"glXGetVideoDeviceNV",glXGetVideoDeviceNV);
+  jsonCount(jo,"glXGetVideoInfoNV",glXGetVideoInfoNV);
+  jsonCount(jo,"glXReleaseVideoDeviceNV",glXReleaseVideoDeviceNV);
+  jsonCount(jo,"glXReleaseVideoImageNV",glXReleaseVideoImageNV);
+  jsonCount(jo,"glXSendPbufferToVideoNV",glXSendPbufferToVideoNV);
+
+/* GLX_OML_sync_control */
+
+  jsonCount(jo,"glXGetMscRateOML",glXGetMscRateOML);
+  jsonCount(jo,"glXGetSyncValuesOML",glXGetSyncValuesOML);
+  jsonCount(jo,"glXSwapBuffersMscOML",glXSwapBuffersMscOML);
+  jsonCount(jo,"glXWaitForMscOML",glXWaitForMscOML);
+  jsonCount(jo,"glXWaitForSbcOML",glXWaitForSbcOML);
+
+/* GLX_SGIX_fbconfig */
+
+  jsonCount(jo,"glXChooseFBConfigSGIX",glXChooseFBConfigSGIX);
+  jsonCount(jo,"glXCreateContextWithConfigSGIX",glXCreateContextWithConfigSGIX);
+  jsonCount(jo,"glXCreateGLXPixmapWithConfigSGIX",glXCreateGLXPixmapWithConfigSGIX);
+  jsonCount(jo,"glXGetFBConfigAttribSGIX",glXGetFBConfigAttribSGIX);
+  jsonCount(jo,"glXGetFBConfigFromVisualSGIX",glXGetFBConfigFromVisualSGIX);
+  jsonCount(jo,"glXGetVisualFromFBConfigSGIX",glXGetVisualFromFBConfigSGIX);
+
+/* GLX_SGIX_pbuffer */
+
+  jsonCount(jo,"glXCreateGLXPbufferSGIX",glXCreateGLXPbufferSGIX);
+  jsonCount(jo,"glXDestroyGLXPbufferSGIX",glXDestroyGLXPbufferSGIX);
+  jsonCount(jo,"glXGetSelectedEventSGIX",glXGetSelectedEventSGIX);
+  jsonCount(jo,"glXQueryGLXPbufferSGIX",glXQueryGLXPbufferSGIX);
+  jsonCount(jo,"glXSelectEventSGIX",glXSelectEventSGIX);
+
+/* GLX_SGIX_swap_barrier */
+
+  jsonCount(jo,"glXBindSwapBarrierSGIX",glXBindSwapBarrierSGIX);
+  jsonCount(jo,"glXQueryMaxSwapBarriersSGIX",glXQueryMaxSwapBarriersSGIX);
+
+/* GLX_SGIX_swap_group */
+
+  jsonCount(jo,"glXJoinSwapGroupSGIX",glXJoinSwapGroupSGIX);
+
+/* GLX_SGIX_video_resize */
+
+  jsonCount(jo,"glXBindChannelToWindowSGIX",glXBindChannelToWindowSGIX);
+  jsonCount(jo,"glXChannelRectSGIX",glXChannelRectSGIX);
+  jsonCount(jo,"glXChannelRectSyncSGIX",glXChannelRectSyncSGIX);
+  jsonCount(jo,"glXQueryChannelDeltasSGIX",glXQueryChannelDeltasSGIX);
+  jsonCount(jo,"glXQueryChannelRectSGIX",glXQueryChannelRectSGIX);
+
+/* GLX_SGI_cushion */
+
+  jsonCount(jo,"glXCushionSGI",glXCushionSGI);
+
+/* GLX_SGI_make_current_read */
+
+  jsonCount(jo,"glXGetCurrentReadDrawableSGI",glXGetCurrentReadDrawableSGI);
+  jsonCount(jo,"glXMakeCurrentReadSGI",glXMakeCurrentReadSGI);
+
+/* GLX_SGI_swap_control */
+
+  jsonCount(jo,"glXSwapIntervalSGI",glXSwapIntervalSGI);
+
+/* GLX_SGI_video_sync */
+
+  jsonCount(jo,"glXGetVideoSyncSGI",glXGetVideoSyncSGI);
+  jsonCount(jo,"glXWaitVideoSyncSGI",glXWaitVideoSyncSGI);
+
+/* GLX_SUN_get_transparent_index */
+
+  jsonCount(jo,"glXGetTransparentIndexSUN",glXGetTransparentIndexSUN);
+
+/* GLX_SUN_video_resize */
+
+  jsonCount(jo,"glXGetVideoResizeSUN",glXGetVideoResizeSUN);
+  jsonCount(jo,"glXVideoResizeSUN",glXVideoResizeSUN);
+#endif /* REGAL_SYS_GLX */
+
+#if REGAL_SYS_OSX
+
+/* CGL_VERSION_1_0 */
+
+  jsonCount(jo,"CGLChoosePixelFormat",CGLChoosePixelFormat);
+  jsonCount(jo,"CGLClearDrawable",CGLClearDrawable);
+  jsonCount(jo,"CGLCopyContext",CGLCopyContext);
+  jsonCount(jo,"CGLCreateContext",CGLCreateContext);
+  jsonCount(jo,"CGLDescribePixelFormat",CGLDescribePixelFormat);
+  jsonCount(jo,"CGLDescribeRenderer",CGLDescribeRenderer);
+  jsonCount(jo,"CGLDestroyContext",CGLDestroyContext);
+  jsonCount(jo,"CGLDestroyPixelFormat",CGLDestroyPixelFormat);
+  jsonCount(jo,"CGLDestroyRendererInfo",CGLDestroyRendererInfo);
+  jsonCount(jo,"CGLDisable",CGLDisable);
+  jsonCount(jo,"CGLEnable",CGLEnable);
+  jsonCount(jo,"CGLErrorString",CGLErrorString);
+  jsonCount(jo,"CGLFlushDrawable",CGLFlushDrawable);
+  jsonCount(jo,"CGLGetOffScreen",CGLGetOffScreen);
+  jsonCount(jo,"CGLGetOption",CGLGetOption);
+  jsonCount(jo,"CGLGetParameter",CGLGetParameter);
+  jsonCount(jo,"CGLGetVersion",CGLGetVersion);
+  jsonCount(jo,"CGLGetVirtualScreen",CGLGetVirtualScreen);
+  jsonCount(jo,"CGLIsEnabled",CGLIsEnabled);
+  jsonCount(jo,"CGLQueryRendererInfo",CGLQueryRendererInfo);
+  jsonCount(jo,"CGLSetFullScreen",CGLSetFullScreen);
+  jsonCount(jo,"CGLSetOffScreen",CGLSetOffScreen);
+  jsonCount(jo,"CGLSetOption",CGLSetOption);
+  jsonCount(jo,"CGLSetParameter",CGLSetParameter);
+  jsonCount(jo,"CGLSetVirtualScreen",CGLSetVirtualScreen);
+
+/* CGL_VERSION_1_1 */
+
+  jsonCount(jo,"CGLCreatePBuffer",CGLCreatePBuffer);
+  jsonCount(jo,"CGLDescribePBuffer",CGLDescribePBuffer);
+  jsonCount(jo,"CGLDestroyPBuffer",CGLDestroyPBuffer);
+  jsonCount(jo,"CGLGetPBuffer",CGLGetPBuffer);
+  jsonCount(jo,"CGLSetPBuffer",CGLSetPBuffer);
+  jsonCount(jo,"CGLTexImagePBuffer",CGLTexImagePBuffer);
+
+/* CGL_VERSION_1_2 */
+
+  jsonCount(jo,"CGLGetContextRetainCount",CGLGetContextRetainCount);
+  jsonCount(jo,"CGLGetGlobalOption",CGLGetGlobalOption);
+  jsonCount(jo,"CGLGetPBufferRetainCount",CGLGetPBufferRetainCount);
+  jsonCount(jo,"CGLGetPixelFormat",CGLGetPixelFormat);
+  jsonCount(jo,"CGLGetPixelFormatRetainCount",CGLGetPixelFormatRetainCount);
+  jsonCount(jo,"CGLLockContext",CGLLockContext);
+  jsonCount(jo,"CGLReleaseContext",CGLReleaseContext);
+  jsonCount(jo,"CGLReleasePBuffer",CGLReleasePBuffer);
+  jsonCount(jo,"CGLReleasePixelFormat",CGLReleasePixelFormat);
+  jsonCount(jo,"CGLRetainContext",CGLRetainContext);
+  jsonCount(jo,"CGLRetainPBuffer",CGLRetainPBuffer);
+  jsonCount(jo,"CGLRetainPixelFormat",CGLRetainPixelFormat);
+  jsonCount(jo,"CGLSetGlobalOption",CGLSetGlobalOption);
+  jsonCount(jo,"CGLUnlockContext",CGLUnlockContext);
+
+/* CGL_VERSION_1_3 */
+
+  jsonCount(jo,"CGLGetCurrentContext",CGLGetCurrentContext);
+  jsonCount(jo,"CGLGetShareGroup",CGLGetShareGroup);
+  jsonCount(jo,"CGLGetSurface",CGLGetSurface);
+  jsonCount(jo,"CGLSetCurrentContext",CGLSetCurrentContext);
+  jsonCount(jo,"CGLSetSurface",CGLSetSurface);
+  jsonCount(jo,"CGLTexImageIOSurface2D",CGLTexImageIOSurface2D);
+  jsonCount(jo,"CGLUpdateContext",CGLUpdateContext);
+#endif /* REGAL_SYS_OSX */
+
+#if REGAL_SYS_EGL
+
+/* EGL_ANGLE_query_surface_pointer */
+
+  jsonCount(jo,"eglQuerySurfacePointerANGLE",eglQuerySurfacePointerANGLE);
+
+/* EGL_KHR_fence_sync */
+
+  jsonCount(jo,"eglClientWaitSyncKHR",eglClientWaitSyncKHR);
+  jsonCount(jo,"eglCreateSyncKHR",eglCreateSyncKHR);
+  jsonCount(jo,"eglDestroySyncKHR",eglDestroySyncKHR);
+  jsonCount(jo,"eglGetSyncAttribKHR",eglGetSyncAttribKHR);
+
+/* EGL_KHR_image_base */
+
+  jsonCount(jo,"eglCreateImageKHR",eglCreateImageKHR);
+  jsonCount(jo,"eglDestroyImageKHR",eglDestroyImageKHR);
+
+/* EGL_KHR_lock_surface */
+
+  jsonCount(jo,"eglLockSurfaceKHR",eglLockSurfaceKHR);
+  jsonCount(jo,"eglUnlockSurfaceKHR",eglUnlockSurfaceKHR);
+
+/* EGL_KHR_stream_consumer_gltexture */
+
+  jsonCount(jo,"eglStreamConsumerAcquireKHR",eglStreamConsumerAcquireKHR);
+  jsonCount(jo,"eglStreamConsumerGLTextureExternalKHR",eglStreamConsumerGLTextureExternalKHR);
+  jsonCount(jo,"eglStreamConsumerReleaseKHR",eglStreamConsumerReleaseKHR);
+
+/* EGL_KHR_stream_cross_process_fd */
+
+  jsonCount(jo,"eglCreateStreamFromFileDescriptorKHR",eglCreateStreamFromFileDescriptorKHR);
+  jsonCount(jo,"eglGetStreamFileDescriptorKHR",eglGetStreamFileDescriptorKHR);
+
+/* EGL_KHR_stream_producer_eglsurface */
+
+  jsonCount(jo,"eglCreateStreamProducerSurfaceKHR",eglCreateStreamProducerSurfaceKHR);
+
+/* EGL_KHR_wait_sync */
+
+  jsonCount(jo,"eglWaitSyncKHR",eglWaitSyncKHR);
+
+/* EGL_MESA_drm_image */
+
+  jsonCount(jo,"eglCreateDRMImageMESA",eglCreateDRMImageMESA);
+  jsonCount(jo,"eglExportDRMImageMESA",eglExportDRMImageMESA);
+
+/* EGL_NV_coverage_sample */
+
+  jsonCount(jo,"eglCoverageMaskNV",eglCoverageMaskNV);
+  jsonCount(jo,"eglCoverageOperationNV",eglCoverageOperationNV);
+
+/* EGL_NV_post_sub_buffer */
+
+  jsonCount(jo,"eglPostSubBufferNV",eglPostSubBufferNV);
+
+/* EGL_NV_sync */
+
+  jsonCount(jo,"eglClientWaitSyncNV",eglClientWaitSyncNV);
+  jsonCount(jo,"eglCreateFenceSyncNV",eglCreateFenceSyncNV);
+  jsonCount(jo,"eglDestroySyncNV",eglDestroySyncNV);
+  jsonCount(jo,"eglFenceNV",eglFenceNV);
+  jsonCount(jo,"eglGetSyncAttribNV",eglGetSyncAttribNV);
+  jsonCount(jo,"eglSignalSyncNV",eglSignalSyncNV);
+
+/* EGL_NV_system_time */
+
+  jsonCount(jo,"eglGetSystemTimeFrequencyNV",eglGetSystemTimeFrequencyNV);
+  jsonCount(jo,"eglGetSystemTimeNV",eglGetSystemTimeNV);
+
+/* EGL_VERSION_1_0 */
+
+  jsonCount(jo,"eglChooseConfig",eglChooseConfig);
+  jsonCount(jo,"eglCopyBuffers",eglCopyBuffers);
+  jsonCount(jo,"eglCreateContext",eglCreateContext);
+  jsonCount(jo,"eglCreatePbufferSurface",eglCreatePbufferSurface);
+  jsonCount(jo,"eglCreatePixmapSurface",eglCreatePixmapSurface);
+  jsonCount(jo,"eglCreateWindowSurface",eglCreateWindowSurface);
+  jsonCount(jo,"eglDestroyContext",eglDestroyContext);
+  jsonCount(jo,"eglDestroySurface",eglDestroySurface);
+  jsonCount(jo,"eglGetConfigAttrib",eglGetConfigAttrib);
+  jsonCount(jo,"eglGetConfigs",eglGetConfigs);
+  jsonCount(jo,"eglGetCurrentContext",eglGetCurrentContext);
+  jsonCount(jo,"eglGetCurrentDisplay",eglGetCurrentDisplay);
+  jsonCount(jo,"eglGetCurrentSurface",eglGetCurrentSurface);
+  jsonCount(jo,"eglGetDisplay",eglGetDisplay);
+  jsonCount(jo,"eglGetError",eglGetError);
+  jsonCount(jo,"eglGetProcAddress",eglGetProcAddress);
+  jsonCount(jo,"eglInitialize",eglInitialize);
+  jsonCount(jo,"eglMakeCurrent",eglMakeCurrent);
+  jsonCount(jo,"eglQueryContext",eglQueryContext);
+  jsonCount(jo,"eglQueryString",eglQueryString);
+  jsonCount(jo,"eglQuerySurface",eglQuerySurface);
+  jsonCount(jo,"eglSwapBuffers",eglSwapBuffers);
+  jsonCount(jo,"eglTerminate",eglTerminate);
+  jsonCount(jo,"eglWaitGL",eglWaitGL);
+  jsonCount(jo,"eglWaitNative",eglWaitNative);
+
+/* EGL_VERSION_1_1 */
+
+  jsonCount(jo,"eglBindTexImage",eglBindTexImage);
+  jsonCount(jo,"eglReleaseTexImage",eglReleaseTexImage);
+
+/* EGL_VERSION_1_2 */
+
+  jsonCount(jo,"eglBindAPI",eglBindAPI);
+  jsonCount(jo,"eglCreatePbufferFromClientBuffer",eglCreatePbufferFromClientBuffer);
+  jsonCount(jo,"eglQueryAPI",eglQueryAPI);
+  jsonCount(jo,"eglReleaseThread",eglReleaseThread);
+  jsonCount(jo,"eglSurfaceAttrib",eglSurfaceAttrib);
+  jsonCount(jo,"eglSwapInterval",eglSwapInterval);
+  jsonCount(jo,"eglWaitClient",eglWaitClient);
+#endif /* REGAL_SYS_EGL */
+
+  jsonCount(jo,"glEnable(GL_BLEND)",enable_GL_BLEND);
+  jsonCount(jo,"glEnable(GL_CLIP_DISTANCE0)",enable_GL_CLIP_DISTANCE0);
+  jsonCount(jo,"glEnable(GL_CLIP_DISTANCE1)",enable_GL_CLIP_DISTANCE1);
+  jsonCount(jo,"glEnable(GL_CLIP_DISTANCE2)",enable_GL_CLIP_DISTANCE2);
+  jsonCount(jo,"glEnable(GL_CLIP_DISTANCE3)",enable_GL_CLIP_DISTANCE3);
+  jsonCount(jo,"glEnable(GL_CLIP_DISTANCE4)",enable_GL_CLIP_DISTANCE4);
+  jsonCount(jo,"glEnable(GL_CLIP_DISTANCE5)",enable_GL_CLIP_DISTANCE5);
+  jsonCount(jo,"glEnable(GL_CLIP_DISTANCE6)",enable_GL_CLIP_DISTANCE6);
+  jsonCount(jo,"glEnable(GL_CLIP_DISTANCE7)",enable_GL_CLIP_DISTANCE7);
+  jsonCount(jo,"glEnable(GL_COLOR_LOGIC_OP)",enable_GL_COLOR_LOGIC_OP);
+  jsonCount(jo,"glEnable(GL_CULL_FACE)",enable_GL_CULL_FACE);
+  jsonCount(jo,"glEnable(GL_DEBUG_OUTPUT)",enable_GL_DEBUG_OUTPUT);
+  jsonCount(jo,"glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS)",enable_GL_DEBUG_OUTPUT_SYNCHRONOUS);
+  jsonCount(jo,"glEnable(GL_DEPTH_CLAMP)",enable_GL_DEPTH_CLAMP);
+  jsonCount(jo,"glEnable(GL_DEPTH_TEST)",enable_GL_DEPTH_TEST);
+  jsonCount(jo,"glEnable(GL_DITHER)",enable_GL_DITHER);
+  jsonCount(jo,"glEnable(GL_FRAMEBUFFER_SRGB)",enable_GL_FRAMEBUFFER_SRGB);
+  jsonCount(jo,"glEnable(GL_LINE_SMOOTH)",enable_GL_LINE_SMOOTH);
+  jsonCount(jo,"glEnable(GL_MULTISAMPLE)",enable_GL_MULTISAMPLE);
+  jsonCount(jo,"glEnable(GL_POLYGON_OFFSET_FILL)",enable_GL_POLYGON_OFFSET_FILL);
+  jsonCount(jo,"glEnable(GL_POLYGON_OFFSET_LINE)",enable_GL_POLYGON_OFFSET_LINE);
+  jsonCount(jo,"glEnable(GL_POLYGON_OFFSET_POINT)",enable_GL_POLYGON_OFFSET_POINT);
+  jsonCount(jo,"glEnable(GL_POLYGON_SMOOTH)",enable_GL_POLYGON_SMOOTH);
+  jsonCount(jo,"glEnable(GL_PRIMITIVE_RESTART)",enable_GL_PRIMITIVE_RESTART);
+  jsonCount(jo,"glEnable(GL_PRIMITIVE_RESTART_FIXED_INDEX)",enable_GL_PRIMITIVE_RESTART_FIXED_INDEX);
+  jsonCount(jo,"glEnable(GL_PROGRAM_POINT_SIZE)",enable_GL_PROGRAM_POINT_SIZE);
+  jsonCount(jo,"glEnable(GL_RESCALE_NORMAL)",enable_GL_RESCALE_NORMAL);
+  jsonCount(jo,"glEnable(GL_SAMPLE_ALPHA_TO_COVERAGE)",enable_GL_SAMPLE_ALPHA_TO_COVERAGE);
+  jsonCount(jo,"glEnable(GL_SAMPLE_ALPHA_TO_ONE)",enable_GL_SAMPLE_ALPHA_TO_ONE);
+  jsonCount(jo,"glEnable(GL_SAMPLE_COVERAGE)",enable_GL_SAMPLE_COVERAGE);
+  jsonCount(jo,"glEnable(GL_SAMPLE_MASK)",enable_GL_SAMPLE_MASK);
+  jsonCount(jo,"glEnable(GL_SCISSOR_TEST)",enable_GL_SCISSOR_TEST);
+  jsonCount(jo,"glEnable(GL_STENCIL_TEST)",enable_GL_STENCIL_TEST);
+  jsonCount(jo,"glEnable(GL_TEXTURE_2D)",enable_GL_TEXTURE_2D);
+  jsonCount(jo,"glEnable(GL_TEXTURE_CUBE_MAP_SEAMLESS)",enable_GL_TEXTURE_CUBE_MAP_SEAMLESS);
+
+  jsonCount(jo,"glDisable(GL_BLEND)",disable_GL_BLEND);
+  jsonCount(jo,"glDisable(GL_CLIP_DISTANCE0)",disable_GL_CLIP_DISTANCE0);
+  jsonCount(jo,"glDisable(GL_CLIP_DISTANCE1)",disable_GL_CLIP_DISTANCE1);
+  jsonCount(jo,"glDisable(GL_CLIP_DISTANCE2)",disable_GL_CLIP_DISTANCE2);
+  jsonCount(jo,"glDisable(GL_CLIP_DISTANCE3)",disable_GL_CLIP_DISTANCE3);
+  jsonCount(jo,"glDisable(GL_CLIP_DISTANCE4)",disable_GL_CLIP_DISTANCE4);
+  jsonCount(jo,"glDisable(GL_CLIP_DISTANCE5)",disable_GL_CLIP_DISTANCE5);
+  jsonCount(jo,"glDisable(GL_CLIP_DISTANCE6)",disable_GL_CLIP_DISTANCE6);
+  jsonCount(jo,"glDisable(GL_CLIP_DISTANCE7)",disable_GL_CLIP_DISTANCE7);
+  jsonCount(jo,"glDisable(GL_COLOR_LOGIC_OP)",disable_GL_COLOR_LOGIC_OP);
+  jsonCount(jo,"glDisable(GL_CULL_FACE)",disable_GL_CULL_FACE);
+  jsonCount(jo,"glDisable(GL_DEBUG_OUTPUT)",disable_GL_DEBUG_OUTPUT);
+  jsonCount(jo,"glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS)",disable_GL_DEBUG_OUTPUT_SYNCHRONOUS);
+  jsonCount(jo,"glDisable(GL_DEPTH_CLAMP)",disable_GL_DEPTH_CLAMP);
+  jsonCount(jo,"glDisable(GL_DEPTH_TEST)",disable_GL_DEPTH_TEST);
+  jsonCount(jo,"glDisable(GL_DITHER)",disable_GL_DITHER);
+  jsonCount(jo,"glDisable(GL_FRAMEBUFFER_SRGB)",disable_GL_FRAMEBUFFER_SRGB);
+  jsonCount(jo,"glDisable(GL_LINE_SMOOTH)",disable_GL_LINE_SMOOTH);
+  jsonCount(jo,"glDisable(GL_MULTISAMPLE)",disable_GL_MULTISAMPLE);
+  jsonCount(jo,"glDisable(GL_POLYGON_OFFSET_FILL)",disable_GL_POLYGON_OFFSET_FILL);
+  jsonCount(jo,"glDisable(GL_POLYGON_OFFSET_LINE)",disable_GL_POLYGON_OFFSET_LINE);
+  jsonCount(jo,"glDisable(GL_POLYGON_OFFSET_POINT)",disable_GL_POLYGON_OFFSET_POINT);
+  jsonCount(jo,"glDisable(GL_POLYGON_SMOOTH)",disable_GL_POLYGON_SMOOTH);
+  jsonCount(jo,"glDisable(GL_PRIMITIVE_RESTART)",disable_GL_PRIMITIVE_RESTART);
+  jsonCount(jo,"glDisable(GL_PRIMITIVE_RESTART_FIXED_INDEX)",disable_GL_PRIMITIVE_RESTART_FIXED_INDEX);
+  jsonCount(jo,"glDisable(GL_PROGRAM_POINT_SIZE)",disable_GL_PROGRAM_POINT_SIZE);
+  jsonCount(jo,"glDisable(GL_RESCALE_NORMAL)",disable_GL_RESCALE_NORMAL);
+  jsonCount(jo,"glDisable(GL_SAMPLE_ALPHA_TO_COVERAGE)",disable_GL_SAMPLE_ALPHA_TO_COVERAGE);
+  jsonCount(jo,"glDisable(GL_SAMPLE_ALPHA_TO_ONE)",disable_GL_SAMPLE_ALPHA_TO_ONE);
+  jsonCount(jo,"glDisable(GL_SAMPLE_COVERAGE)",disable_GL_SAMPLE_COVERAGE);
+  jsonCount(jo,"glDisable(GL_SAMPLE_MASK)",disable_GL_SAMPLE_MASK);
+  jsonCount(jo,"glDisable(GL_SCISSOR_TEST)",disable_GL_SCISSOR_TEST);
+  jsonCount(jo,"glDisable(GL_STENCIL_TEST)",disable_GL_STENCIL_TEST);
+  jsonCount(jo,"glDisable(GL_TEXTURE_2D)",disable_GL_TEXTURE_2D);
+  jsonCount(jo,"glDisable(GL_TEXTURE_CUBE_MAP_SEAMLESS)",disable_GL_TEXTURE_CUBE_MAP_SEAMLESS);
+
+  jsonCount(jo,"IFF_PROGRAM_CACHE_HIT",iff_program_cache_hit);
+  jsonCount(jo,"IFF_PROGRAM_CACHE_MISS",iff_program_cache_miss);
+  jsonCount(jo,"IFF_PROGRAM_CACHE_EVICT",iff_program_cache_evict);
+  jsonCount(jo,"IFF_PROGRAM_BINARY_HIT",iff_program_binary_hit);
+  jsonCount(jo,"IFF_PROGRAM_BINARY_MISS",iff_program_binary_miss);
+  jsonCount(jo,"IFF_PROGRAM_BINARY_WRITE",iff_program_binary_write);
+  jsonCount(jo,"IFF_PROGRAM_ASYNC_COMPILE",iff_program_async_compile);
+  jsonCount(jo,"IFF_PROGRAM_UBER_DRAW",iff_program_uber_draw);
+  jsonCount(jo,"IFF_DRAW",iff_draw);
+  jsonCount(jo,"IFF_UNIFORM_CALL",iff_uniform_call);
+  jsonCount(jo,"IFF_UNIFORM_BLOCK_UPLOAD",iff_uniform_block_upload);
+  jsonCount(jo,"IFF_UNIFORM_BLOCK_BIND",iff_uniform_block_bind);
+  jsonCount(jo,"IFF_IMMEDIATE_FLUSH",iff_immediate_flush);
+  jsonCount(jo,"IFF_IMMEDIATE_RELAYOUT",iff_immediate_relayout);
+  jsonCount(jo,"IFF_IMMEDIATE_BATCH",iff_immediate_batch);
+  jsonCount(jo,"VAO_UPLOAD_CACHE_HIT",vao_upload_cache_hit);
+  jsonCount(jo,"VAO_UPLOAD_CACHE_MISS",vao_upload_cache_miss);
+
+  jsonCount(jo,"redundant_glActiveTexture",redundant_glActiveTexture);
+  jsonCount(jo,"redundant_glBindBuffer",redundant_glBindBuffer);
+  jsonCount(jo,"redundant_glBindFramebuffer",redundant_glBindFramebuffer);
+  jsonCount(jo,"redundant_glBindTexture",redundant_glBindTexture);
+  jsonCount(jo,"redundant_glBindVertexArray",redundant_glBindVertexArray);
+  jsonCount(jo,"redundant_glBlendEquation",redundant_glBlendEquation);
+  jsonCount(jo,"redundant_glBlendFunc",redundant_glBlendFunc);
+  jsonCount(jo,"redundant_glBlendFuncSeparate",redundant_glBlendFuncSeparate);
+  jsonCount(jo,"redundant_glClearColor",redundant_glClearColor);
+  jsonCount(jo,"redundant_glColorMask",redundant_glColorMask);
+  jsonCount(jo,"redundant_glCullFace",redundant_glCullFace);
+  jsonCount(jo,"redundant_glDepthFunc",redundant_glDepthFunc);
+  jsonCount(jo,"redundant_glDepthMask",redundant_glDepthMask);
+  jsonCount(jo,"redundant_glDisable",redundant_glDisable);
+  jsonCount(jo,"redundant_glEnable",redundant_glEnable);
+  jsonCount(jo,"redundant_glFrontFace",redundant_glFrontFace);
+  jsonCount(jo,"redundant_glScissor",redundant_glScissor);
+  jsonCount(jo,"redundant_glUseProgram",redundant_glUseProgram);
+  jsonCount(jo,"redundant_glViewport",redundant_glViewport);
+
+  if (timing)
+    timing->writeJSON(jo);
+  jo.end();
+#else
+  UNUSED_PARAMETER(jo);
+#endif
 }
 
 void
@@ -53,6 +53,10 @@ REGAL_GLOBAL_END
 
 REGAL_NAMESPACE_BEGIN
 
+namespace Json { struct Output; }
+
+struct CallTiming;
+
 struct Statistics
 {
   Statistics();
@@ -60,9 +64,12 @@ struct Statistics
 
   void reset();
   void log() const;
+  void writeJSON(Json::Output &jo) const;
 
   static inline void log(const char *name, const GLuint count);
 
+  CallTiming *timing;     // Per-call timing, if enabled
+
   GLuint gl_version_1_0;
   GLuint gl_version_1_1;
   GLuint gl_version_1_2;
@@ -5247,6 +5254,48 @@ struct Statistics
   GLuint disable_GL_TEXTURE_2D;
   GLuint disable_GL_TEXTURE_CUBE_MAP_SEAMLESS;
 
+  // Emulation counters
+
+  GLuint iff_program_cache_hit;
+  GLuint iff_program_cache_miss;
+  GLuint iff_program_cache_evict;
+  GLuint iff_program_binary_hit;
+  GLuint iff_program_binary_miss;
+  GLuint iff_program_binary_write;
+  GLuint iff_program_async_compile;
+  GLuint iff_program_uber_draw;
+  GLuint iff_draw;
+  GLuint iff_uniform_call;
+  GLuint iff_uniform_block_upload;
+  GLuint iff_uniform_block_bind;
+  GLuint iff_immediate_flush;
+  GLuint iff_immediate_relayout;
+  GLuint iff_immediate_batch;
+  GLuint vao_upload_cache_hit;
+  GLuint vao_upload_cache_miss;
+
+  // Redundant state changes filtered per entry point
+
+  GLuint redundant_glActiveTexture;
+  GLuint redundant_glBindBuffer;
+  GLuint redundant_glBindFramebuffer;
+  GLuint redundant_glBindTexture;
+  GLuint redundant_glBindVertexArray;
+  GLuint redundant_glBlendEquation;
+  GLuint redundant_glBlendFunc;
+  GLuint redundant_glBlendFuncSeparate;
+  GLuint redundant_glClearColor;
+  GLuint redundant_glColorMask;
+  GLuint redundant_glCullFace;
+  GLuint redundant_glDepthFunc;
+  GLuint redundant_glDepthMask;
+  GLuint redundant_glDisable;
+  GLuint redundant_glEnable;
+  GLuint redundant_glFrontFace;
+  GLuint redundant_glScissor;
+  GLuint redundant_glUseProgram;
+  GLuint redundant_glViewport;
+
   bool dummy;
 };
 
@@ -116,17 +116,37 @@ ConvertedBuffer::ConvertFrom( GLsizei width, GLsizei height, GLenum sourceFormat
   const size_t sourcePixelsPerRow  = width;
   const size_t sourceStride        = ( sourcePixelsPerRow * sourcePixelSize + sourceAlignment - 1 ) & ~( sourceAlignment - 1 );
 
-  std::vector<uint32_t> rowBuffer;
   targetBuffer_ .resize( targetStride * height );
-  rowBuffer.resize( width * sizeof( uint32_t ) );
 
   const uint8_t* sourceRowData = static_cast<const uint8_t*>( sourcePixels );
   uint8_t*       targetRowData = &targetBuffer_[ 0 ];
 
+  // RGBA8888 on either side is the intermediate format, so rows convert
+  // directly. The target rows are always four byte aligned, the source rows
+  // only if the client pointer is.
+
+  const bool sourceIntermediate = ( sourceFormat  == GL_RGBA ) && ( sourceType  == GL_UNSIGNED_BYTE ) &&
+                                  ( ( reinterpret_cast<intptr_t>( sourcePixels ) & 3 ) == 0 );
+  const bool targetIntermediate = ( targetFormat_ == GL_RGBA ) && ( targetType_ == GL_UNSIGNED_BYTE );
+
+  // Otherwise convert through a small block that stays in cache.
+
+  const size_t blockPixels = 256;
+  uint32_t block[ blockPixels ];
+
   // Perform the conversion
   while ( height-- ) {
-    sourceConverter->Unpack32( sourceRowData, &rowBuffer[ 0 ], width );
-    targetConverter->Pack32( &rowBuffer[ 0 ], targetRowData, width );
+    if ( targetIntermediate ) {
+      sourceConverter->Unpack32( sourceRowData, reinterpret_cast<uint32_t*>( targetRowData ), width );
+    } else if ( sourceIntermediate ) {
+      targetConverter->Pack32( reinterpret_cast<const uint32_t*>( sourceRowData ), targetRowData, width );
+    } else {
+      for ( size_t x = 0; x < sourcePixelsPerRow; x += blockPixels ) {
+        const size_t n = std::min( blockPixels, sourcePixelsPerRow - x );
+        sourceConverter->Unpack32( sourceRowData + x * sourcePixelSize, block, n );
+        targetConverter->Pack32( block, targetRowData + x * targetPixelSize, n );
+      }
+    }
     sourceRowData += sourceStride;
     targetRowData += targetStride;
   }
@@ -41,6 +41,10 @@ REGAL_GLOBAL_BEGIN
 #include <pthread.h>
 #endif
 
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
 // Windows TLS API
 
 #if REGAL_SYS_WGL && REGAL_WIN_TLS
@@ -65,6 +69,8 @@ struct RegalContext;
 struct DispatchTableGL;
 struct DispatchTableGlobal;
 
+namespace Logging { struct Ring; }
+
 namespace Thread
 {
 
@@ -95,22 +101,112 @@ inline Thread Self()
 #endif
 }
 
-// Three TLS items - the current RegalContext,
-// and the dispatch table pointers for plugins
-// calling back into Regal.
+//
+// Thread::loadAcquire(), Thread::storeRelease()
+// - ordering of data published to other threads without a lock
+//
+
+#if defined(_MSC_VER)
+
+// A full hardware fence, as MemoryBarrier() in winnt.h.  A compiler
+// barrier alone does not order loads and stores on ARM.
+
+inline void memoryBarrier()
+{
+  long barrier = 0;
+  _InterlockedOr(&barrier,0);
+}
+
+#endif
+
+template<typename T>
+inline T loadAcquire(const volatile T &v)
+{
+#if defined(_MSC_VER)
+  const T tmp = v;
+  memoryBarrier();
+  return tmp;
+#else
+  return __atomic_load_n(&v,__ATOMIC_ACQUIRE);
+#endif
+}
+
+template<typename T>
+inline void storeRelease(volatile T &v, const T value)
+{
+#if defined(_MSC_VER)
+  memoryBarrier();
+  v = value;
+#else
+  __atomic_store_n(&v,value,__ATOMIC_RELEASE);
+#endif
+}
+
+//
+// Thread::atomicAdd(), Thread::loadSequential(), Thread::exchangeSequential()
+// - sequentially consistent, for counting readers that a writer
+//   must see, or not, relative to a pointer it publishes
+//
+
+inline long atomicAdd(volatile long &v, const long delta)
+{
+#if defined(_MSC_VER)
+  return _InterlockedExchangeAdd(&v,delta)+delta;
+#else
+  return __atomic_add_fetch(&v,delta,__ATOMIC_SEQ_CST);
+#endif
+}
+
+template<typename T>
+inline T *loadSequential(T * const volatile &v)
+{
+#if defined(_MSC_VER) && defined(_WIN64)
+  return static_cast<T *>(_InterlockedCompareExchangePointer(reinterpret_cast<void * volatile *>(const_cast<T * volatile *>(&v)),NULL,NULL));
+#elif defined(_MSC_VER)
+  return reinterpret_cast<T *>(_InterlockedCompareExchange(reinterpret_cast<volatile long *>(const_cast<T * volatile *>(&v)),0,0));
+#else
+  return __atomic_load_n(&v,__ATOMIC_SEQ_CST);
+#endif
+}
+
+template<typename T>
+inline T *exchangeSequential(T * volatile &v, T *value)
+{
+#if defined(_MSC_VER) && defined(_WIN64)
+  return static_cast<T *>(_InterlockedExchangePointer(reinterpret_cast<void * volatile *>(&v),value));
+#elif defined(_MSC_VER)
+  return reinterpret_cast<T *>(_InterlockedExchange(reinterpret_cast<volatile long *>(&v),reinterpret_cast<long>(value)));
+#else
+  return __atomic_exchange_n(&v,value,__ATOMIC_SEQ_CST);
+#endif
+}
+
+// Four TLS items - the current RegalContext,
+// the dispatch table pointers for plugins
+// calling back into Regal, and the ring buffer
+// for asynchronous logging.
+//
+// Where the compiler supports it, a thread-local
+// pointer to the block is checked first, so that
+// the common lookup is a single TLS load rather
+// than a pthread_getspecific call.
 
 struct ThreadLocal
 {
   inline ThreadLocal()
   : currentContext(NULL),
     nextDispatchTable(NULL),
-    nextDispatchTableGlobal(NULL)
+    nextDispatchTableGlobal(NULL),
+    logRing(NULL)
   {
   }
 
+  ~ThreadLocal();                     // Releases the log ring to the writer
+
   RegalContext        *currentContext;
   DispatchTableGL     *nextDispatchTable;
   DispatchTableGlobal *nextDispatchTableGlobal;
+  Logging::Ring       *logRing;
 
   // Platform-specifics for thread-local storage
 
@@ -125,6 +221,9 @@ struct ThreadLocal
       #endif
     #else
       static pthread_key_t _instanceKey;
+      #if REGAL_THREAD_LOCAL
+        static __thread ThreadLocal *_current;
+      #endif
     #endif
   #endif
 
@@ -148,6 +247,10 @@ struct ThreadLocal
         return _instance;
       #endif
     #else
+      #if REGAL_THREAD_LOCAL
+        if (_current)
+          return *_current;
+      #endif
       ThreadLocal *i = static_cast<ThreadLocal *>(pthread_getspecific(_instanceKey));
       if (!i)
       {
@@ -155,6 +258,9 @@ struct ThreadLocal
         pthread_setspecific(_instanceKey,i);
       }
       RegalAssert(i);
+      #if REGAL_THREAD_LOCAL
+        _current = i;
+      #endif
       return *i;
     #endif
   }
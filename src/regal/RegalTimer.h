@@ -40,6 +40,11 @@ REGAL_GLOBAL_BEGIN
   extern "C" { int __stdcall QueryPerformanceCounter   (signed long long *lpPerformanceCount); }
 #else
 #include <sys/time.h>
+#if REGAL_SYS_OSX || REGAL_SYS_IOS
+#include <mach/mach_time.h>
+#elif !REGAL_SYS_PPAPI
+#include <time.h>
+#endif
 #endif
 
 REGAL_GLOBAL_END
@@ -58,6 +63,8 @@ struct Timer
   inline Timer::Value now();    /* Time in micro-seconds */
   inline Timer::Value elapsed() { return now() - _start; }
 
+  static inline Timer::Value nanoseconds();   /* Monotonic, for timing short intervals */
+
   Timer::Value _freq;
   Timer::Value _start;    /* Zero by default */
 };
@@ -81,6 +88,18 @@ Timer::Value Timer::now()
   return (Timer::Value) time * Timer::Value(1000000) / _freq;
 }
 
+inline
+Timer::Value Timer::nanoseconds()
+{
+  static signed long long freq = 0;
+  if (!freq)
+    QueryPerformanceFrequency(&freq);
+
+  signed long long time;
+  QueryPerformanceCounter(&time);
+  return Timer::Value(time/freq)*Timer::Value(1000000000) + Timer::Value(time%freq)*Timer::Value(1000000000)/Timer::Value(freq);
+}
+
 #else
 
 inline
@@ -98,6 +117,25 @@ Timer::Value Timer::now()
   return Timer::Value(val.tv_sec) * Timer::Value(1000000) + Timer::Value(val.tv_usec);
 }
 
+inline
+Timer::Value Timer::nanoseconds()
+{
+#if REGAL_SYS_OSX || REGAL_SYS_IOS
+  static mach_timebase_info_data_t base = { 0, 0 };
+  if (!base.denom)
+    mach_timebase_info(&base);
+  return Timer::Value(mach_absolute_time()) * base.numer / base.denom;
+#elif REGAL_SYS_PPAPI
+  struct timeval val;
+  gettimeofday(&val, NULL);
+  return Timer::Value(val.tv_sec) * Timer::Value(1000000000) + Timer::Value(val.tv_usec) * Timer::Value(1000);
+#else
+  struct timespec val;
+  clock_gettime(CLOCK_MONOTONIC, &val);
+  return Timer::Value(val.tv_sec) * Timer::Value(1000000000) + Timer::Value(val.tv_nsec);
+#endif
+}
+
 #endif
 
 REGAL_NAMESPACE_END
@@ -216,6 +216,28 @@
 # endif
 #endif
 
+// Redundant state change filtering supported by default,
+// but disabled at runtime unless REGAL_REDUNDANT is set
+
+#ifndef REGAL_REDUNDANT
+# if REGAL_WRANGLER
+#  define REGAL_REDUNDANT 0
+# else
+#  define REGAL_REDUNDANT 1
+# endif
+#endif
+
+// Binary call logging supported by default,
+// but disabled at runtime unless REGAL_LOG_BINARY is set
+
+#ifndef REGAL_LOG_BINARY
+# if REGAL_WRANGLER || REGAL_SYS_PPAPI || REGAL_SYS_EMSCRIPTEN
+#  define REGAL_LOG_BINARY 0
+# else
+#  define REGAL_LOG_BINARY 1
+# endif
+#endif
+
 // Converting enum values to strings adds some footprint,
 // opt-out with -DREGAL_ENUM_TO_STRING=0
 
@@ -428,6 +450,26 @@
 #define REGAL_CACHE_SHADER_READ REGAL_CACHE_SHADER
 #endif
 
+// Caching of GLSL optimizer output supported by default
+
+#ifndef REGAL_CACHE_GLSL
+#define REGAL_CACHE_GLSL REGAL_CACHE
+#endif
+
+// Program binary caching supported by default
+
+#ifndef REGAL_CACHE_PROGRAM
+#define REGAL_CACHE_PROGRAM REGAL_CACHE
+#endif
+
+#ifndef REGAL_CACHE_PROGRAM_WRITE
+#define REGAL_CACHE_PROGRAM_WRITE REGAL_CACHE_PROGRAM
+#endif
+
+#ifndef REGAL_CACHE_PROGRAM_READ
+#define REGAL_CACHE_PROGRAM_READ REGAL_CACHE_PROGRAM
+#endif
+
 // Texture caching supported by default
 
 #ifndef REGAL_CACHE_TEXTURE
@@ -446,6 +488,12 @@
 #define REGAL_CACHE_TEXTURE_READ REGAL_CACHE_TEXTURE
 #endif
 
+// Cache writing in the background supported by default
+
+#ifndef REGAL_CACHE_TEXTURE_ASYNC
+#define REGAL_CACHE_TEXTURE_ASYNC REGAL_CACHE_TEXTURE_WRITE
+#endif
+
 //
 
 #ifndef REGAL_FORCE_CORE_PROFILE
@@ -518,10 +566,28 @@
 #  define REGAL_NO_SQUISH 1
 #endif
 
+#ifndef REGAL_NO_SNAPPY
+#  if REGAL_WRANGLER || REGAL_SYS_PPAPI || REGAL_SYS_EMSCRIPTEN || REGAL_SYS_ANDROID || REGAL_SYS_OSX || REGAL_SYS_IOS
+#    define REGAL_NO_SNAPPY 1
+#  else
+#    define REGAL_NO_SNAPPY 0
+#  endif
+#endif
+
 #ifndef REGAL_NO_TLS
 #  define REGAL_NO_TLS 0
 #endif
 
+// Compiler-supported thread-local pointer in front of pthread_getspecific
+
+#ifndef REGAL_THREAD_LOCAL
+#  if !REGAL_NO_TLS && defined(__GNUC__) && (REGAL_SYS_GLX || REGAL_SYS_EGL) && !REGAL_SYS_ANDROID && !REGAL_SYS_EMSCRIPTEN && !REGAL_SYS_PPAPI && !REGAL_SYS_OSX && !REGAL_SYS_IOS
+#    define REGAL_THREAD_LOCAL 1
+#  else
+#    define REGAL_THREAD_LOCAL 0
+#  endif
+#endif
+
 #ifndef REGAL_NO_JSON
 #  define REGAL_NO_JSON 0
 #endif
@@ -42,14 +42,20 @@
 
 REGAL_GLOBAL_BEGIN
 
+#include <map>
 #include <string>
 
 #include "RegalEmu.h"
 #include "RegalEmuInfo.h"
+#include "RegalIndexRange.h"
 #include "RegalContext.h"
 #include "RegalContextInfo.h"
 #include "RegalSharedMap.h"
 
+#if REGAL_STATISTICS
+#include "RegalStatistics.h"
+#endif
+
 REGAL_GLOBAL_END
 
 REGAL_NAMESPACE_BEGIN
@@ -121,6 +127,39 @@ struct Vao
     Array a[ REGAL_EMU_MAX_VERTEX_ATTRIBS ];
   };
 
+  // Client array upload cache
+  //
+  // With Config::vaoUploadCache client arrays are appended to one streaming
+  // buffer rather than re-sent to their shadow buffers for each draw.  An
+  // array already in the streaming buffer with the same pointer, size and
+  // content hash is drawn from there without another upload.  When the
+  // streaming buffer fills up it is orphaned and the cache starts over.
+
+  struct Upload
+  {
+    Upload() : hash( 0 ), offset( 0 ) {}
+    GLuint64 hash;
+    GLintptr offset;
+  };
+
+  typedef std::pair<const GLvoid *, GLsizeiptr> UploadKey;
+
+  std::map<UploadKey, Upload> uploads;
+  GLuint     uploadBuffer;
+  GLsizeiptr uploadBufferSize;
+  GLintptr   uploadHead;
+
+  // Index ranges scanned from element array buffers, invalidated by any
+  // call that may write buffer contents in any context of the share group.
+  // Persistently mapped buffers can change without such a call, so the
+  // memo is disabled once one is seen.
+  // Query results are written to a bound query buffer, and while transform
+  // feedback is active each draw may capture into the index buffer.
+
+  IndexRangeCache indexRanges;
+  GLuint          queryBuffer;
+  bool            transformFeedback;
+
   shared_map<GLuint, Object> objects;
 
   GLenum clientActiveTexture;
@@ -145,6 +184,14 @@ struct Vao
     maxName = 0;
     clientActiveTexture = GL_TEXTURE0;
 
+    uploads.clear();
+    uploadBuffer = 0;
+    uploadBufferSize = Config::vaoUploadCache ? Config::vaoUploadCacheSize : 0;
+    uploadHead = 0;
+
+    queryBuffer = 0;
+    transformFeedback = false;
+
     max_vertex_attribs = ctx.emuInfo->gl_max_vertex_attribs;
     RegalAssert( max_vertex_attribs <= REGAL_EMU_MAX_VERTEX_ATTRIBS );
     if (max_vertex_attribs > REGAL_EMU_MAX_VERTEX_ATTRIBS)
@@ -152,7 +199,10 @@ struct Vao
 
     RegalContext *sharingWith = ctx.shareGroup->front();
     if (sharingWith)
+    {
       objects = sharingWith->vao->objects;
+      indexRanges.Share(sharingWith->vao->indexRanges);
+    }
 
     // we have RFF2A maps for sets of 8 and 16 attributes. if
     // REGAL_EMU_MAX_VERTEX_ATTRIBS > 16 a new map needs to be added
@@ -220,7 +270,34 @@ struct Vao
 
   void Cleanup( RegalContext &ctx )
   {
-    UNUSED_PARAMETER(ctx);
+    if (uploadBuffer)
+      ctx.dispatcher.driver.glDeleteBuffers( 1, &uploadBuffer );
+    uploadBuffer = 0;
+    uploads.clear();
+  }
+
+  void BufferWrite()
+  {
+    indexRanges.Invalidate();
+  }
+
+  void MapBufferRange( GLbitfield access )
+  {
+    indexRanges.Invalidate();
+    if (access & GL_MAP_PERSISTENT_BIT)
+      indexRanges.Disable();
+  }
+
+  void QueryBufferWrite()
+  {
+    if (queryBuffer)
+      indexRanges.Invalidate();
+  }
+
+  void TransformFeedback( bool active )
+  {
+    indexRanges.Invalidate();
+    transformFeedback = active;
   }
 
   void ShadowBufferBinding( GLenum target, GLuint bufferBinding )
@@ -234,6 +311,10 @@ struct Vao
     {
       currObject->indexBuffer = bufferBinding;
     }
+    else if( target == GL_QUERY_BUFFER )
+    {
+      queryBuffer = bufferBinding;
+    }
   }
 
   void BindVertexArray( RegalContext &ctx, GLuint name )
@@ -1086,39 +1167,15 @@ struct Vao
     }
   }
 
-  template<typename T> GLsizei MaxVertexCount(const GLvoid * ptr, GLuint base, GLuint count, GLuint restartIdx, GLboolean restart)
-  {
-    GLsizei vtxcount = 0;
-    const T* indices = static_cast<const T*>(ptr);
-    GLuint endo = base + count;
-    if (restart)
-    {
-      for(GLuint i = base; i < endo; i++)
-      {
-        if (indices[i] == restartIdx)
-          continue;
-        if ((GLsizei) indices[i] > vtxcount)
-          vtxcount = (GLsizei) indices[i];
-      }
-    } else {
-      for(GLuint i = base; i < endo; i++)
-      {
-        if ((GLsizei) indices[i] > vtxcount)
-          vtxcount = (GLsizei) indices[i];
-      }
-    }
-    ++vtxcount;
-    return vtxcount;
-  }
+  // Primitive restart state of the driver, queried once per draw
 
-  GLsizei MaxVertexCount(RegalContext &ctx, GLenum type, const GLvoid * ptr, GLuint base, GLuint count)
+  void RestartState(RegalContext &ctx, GLenum type, GLuint &restartIdx, bool &restart)
   {
-    GLboolean isRestartVar = ctx.dispatcher.driver.glIsEnabled(GL_PRIMITIVE_RESTART);
-    GLboolean isRestartFixed = ctx.dispatcher.driver.glIsEnabled(GL_PRIMITIVE_RESTART_FIXED_INDEX);
-
-    GLboolean isRestart = isRestartVar || isRestartFixed;
+    const GLboolean isRestartVar = ctx.dispatcher.driver.glIsEnabled(GL_PRIMITIVE_RESTART);
+    const GLboolean isRestartFixed = ctx.dispatcher.driver.glIsEnabled(GL_PRIMITIVE_RESTART_FIXED_INDEX);
 
-    GLuint restartIdx = 0;
+    restart = isRestartVar || isRestartFixed;
+    restartIdx = 0;
     if (isRestartFixed)
     {
       switch(type)
@@ -1132,23 +1189,23 @@ struct Vao
         default: break;
       }
     }
-    else
+    else if (isRestartVar)
     {
       ctx.dispatcher.driver.glGetIntegerv(GL_PRIMITIVE_RESTART_INDEX, (GLint*)(&restartIdx));
     }
+  }
 
-    switch(type)
+  GLsizei MaxVertexCount(GLenum type, const GLvoid * ptr, GLuint base, GLuint count, GLuint restartIdx, bool restart)
+  {
+    const GLsizei size = TypeSize(type);
+    if (!size)
     {
-      case GL_UNSIGNED_BYTE:
-        return MaxVertexCount<GLubyte>(ptr, base, count, restartIdx, isRestart);
-      case GL_UNSIGNED_SHORT:
-        return MaxVertexCount<GLushort>(ptr, base, count, restartIdx, isRestart);
-      case GL_UNSIGNED_INT:
-        return MaxVertexCount<GLuint>(ptr, base, count, restartIdx, isRestart);
-      default:
-        RegalAssert( "Unsupported <type> in for MaxVertexCount." );
-        return 0;
+      RegalAssert( "Unsupported <type> in for MaxVertexCount." );
+      return 0;
     }
+
+    const IndexRange range = IndexRangeScan(type, static_cast<const GLubyte *>(ptr) + size_t(base) * size, count, restartIdx, restart);
+    return range.empty() ? 1 : GLsizei(range.max) + 1;
   }
 
   GLuint MaxArraysIndirectCount(const DrawArraysIndirectCommand* indirect, GLint drawcount)
@@ -1165,6 +1222,141 @@ struct Vao
     return maxCount;
   }
 
+  // Bytes spanned by <vertices> elements of a client array
+
+  GLsizeiptr ArrayBytes(const Array &a, GLsizei vertices)
+  {
+    const GLsizeiptr element = TypeSize(a.type) * (a.size == GL_BGRA ? 4 : a.size);
+    const GLsizeiptr stride  = a.stride ? a.stride : element;
+    return vertices > 0 ? stride * (vertices - 1) + element : 0;
+  }
+
+  // Cheap content hash for the upload cache, four independent 64-bit lanes
+
+  static GLuint64 ContentHash(const GLvoid *data, GLsizeiptr bytes)
+  {
+    const GLuint64 k = 0x9e3779b97f4a7c15ull;
+    const GLubyte *p = static_cast<const GLubyte *>(data);
+    GLuint64 h[4] = { GLuint64(bytes), k, k << 1, k << 2 };
+
+    GLsizeiptr n = bytes / 32;
+    for (GLsizeiptr i = 0; i < n; ++i, p += 32)
+    {
+      GLuint64 w[4];
+      memcpy(w, p, sizeof(w));
+      for (int j = 0; j < 4; ++j)
+      {
+        h[j] = (h[j] ^ w[j]) * k;
+        h[j] ^= h[j] >> 29;
+      }
+    }
+    for (GLsizeiptr i = n * 32; i < bytes; ++i, ++p)
+      h[0] = (h[0] ^ *p) * k;
+
+    return h[0] ^ (h[1] * 3) ^ (h[2] * 5) ^ (h[3] * 7);
+  }
+
+  // Upload the client arrays of the current VAO for a draw of <vertices>
+  // vertices, either to their shadow buffers or via the upload cache.
+
+  void UploadArrays(RegalContext &ctx, const GLuint *clients, GLuint count, GLsizei vertices)
+  {
+    RegalAssert( currObject != NULL );
+
+    DispatchTableGL &drv = ctx.dispatcher.driver;
+    const Object &vao = *currObject;
+
+    GLsizeiptr bytes[REGAL_EMU_MAX_VERTEX_ATTRIBS];
+    GLuint64   hash[REGAL_EMU_MAX_VERTEX_ATTRIBS];
+    GLsizeiptr missing = 0;
+    GLsizeiptr total = 0;
+
+    for (GLuint i = 0; i < count; ++i)
+    {
+      const Array &a = vao.a[clients[i]];
+      bytes[i] = ArrayBytes(a, vertices);
+      hash[i] = 0;
+      if (!bytes[i] || !uploadBufferSize)
+        continue;
+
+      const GLsizeiptr aligned = (bytes[i] + 63) & ~GLsizeiptr(63);
+      hash[i] = ContentHash(a.shadow_pointer, bytes[i]);
+      std::map<UploadKey, Upload>::const_iterator u = uploads.find(UploadKey(a.shadow_pointer, bytes[i]));
+      if (u == uploads.end() || u->second.hash != hash[i])
+        missing += aligned;
+      total += aligned;
+    }
+
+    // Without the cache, or for draws too large for it, each array
+    // is sent to its own shadow buffer.
+
+    if (!uploadBufferSize || total > uploadBufferSize)
+    {
+      for (GLuint i = 0; i < count; ++i)
+      {
+        const Array &a = vao.a[clients[i]];
+        if (!bytes[i])
+          continue;
+
+        drv.glBindBuffer(GL_ARRAY_BUFFER, a.shadow_buffer);
+        drv.glBufferData(GL_ARRAY_BUFFER, bytes[i], a.shadow_pointer, GL_DYNAMIC_DRAW);
+        if (uploadBufferSize)
+          ctx.dispatcher.emulation.glVertexAttribPointer(clients[i], a.size, a.type, a.normalized, a.stride, NULL);
+      }
+      drv.glBindBuffer(GL_ARRAY_BUFFER, vao.vertexBuffer);
+      return;
+    }
+
+    if (!uploadBuffer)
+    {
+      drv.glGenBuffers(1, &uploadBuffer);
+      uploadHead = uploadBufferSize;
+    }
+
+    drv.glBindBuffer(GL_ARRAY_BUFFER, uploadBuffer);
+
+    // Orphan the streaming buffer once it is full
+
+    if (uploadHead + missing > uploadBufferSize)
+    {
+      drv.glBufferData(GL_ARRAY_BUFFER, uploadBufferSize, NULL, GL_STREAM_DRAW);
+      uploads.clear();
+      uploadHead = 0;
+    }
+
+    for (GLuint i = 0; i < count; ++i)
+    {
+      const Array &a = vao.a[clients[i]];
+      if (!bytes[i])
+        continue;
+
+      const UploadKey key(a.shadow_pointer, bytes[i]);
+      std::map<UploadKey, Upload>::iterator u = uploads.find(key);
+      if (u != uploads.end() && u->second.hash == hash[i])
+      {
+#if REGAL_STATISTICS
+        if (ctx.statistics) ctx.statistics->vao_upload_cache_hit++;
+#endif
+      }
+      else
+      {
+        if (u == uploads.end())
+          u = uploads.insert(std::make_pair(key, Upload())).first;
+        u->second.hash = hash[i];
+        u->second.offset = uploadHead;
+        drv.glBufferSubData(GL_ARRAY_BUFFER, uploadHead, bytes[i], a.shadow_pointer);
+        uploadHead += (bytes[i] + 63) & ~GLsizeiptr(63);
+#if REGAL_STATISTICS
+        if (ctx.statistics) ctx.statistics->vao_upload_cache_miss++;
+#endif
+      }
+
+      ctx.dispatcher.emulation.glVertexAttribPointer(clients[i], a.size, a.type, a.normalized, a.stride, reinterpret_cast<const GLvoid *>(u->second.offset));
+    }
+
+    drv.glBindBuffer(GL_ARRAY_BUFFER, vao.vertexBuffer);
+  }
+
   void DrawArrays(RegalContext &ctx, GLint first, GLsizei count)
   {
     DrawArraysPrefix(ctx, &first, &count, 1);
@@ -1244,11 +1436,13 @@ struct Vao
     GLint drawcount = 1;
 
     std::vector<DrawArraysIndirectCommand> clientCmd;
+    GLuint clients[REGAL_EMU_MAX_VERTEX_ATTRIBS];
+    GLuint clientcount = 0;
 
     GLboolean ccinit = false;
-    for (int index= 0; index < REGAL_EMU_MAX_VERTEX_ATTRIBS; index++)
+    for (GLuint index= 0; index < REGAL_EMU_MAX_VERTEX_ATTRIBS; index++)
     {
-      Array &a = objects[current].a[index];
+      const Array &a = objects[current].a[index];
       if (!a.enabled || a.buffer != a.shadow_buffer || a.shadow_buffer == 0 || !a.shadow_pointer)
           continue;
 
@@ -1274,15 +1468,12 @@ struct Vao
         ccinit = true;
       }
 
-      GLsizei buffersize = TypeSize(a.type) * (a.size == GL_BGRA ? 4 : a.size) * MaxArraysIndirectCount(&clientCmd[0], drawcount);
-      if (!buffersize)
-        continue;
-
-      ctx.dispatcher.driver.glBindBuffer(GL_ARRAY_BUFFER, a.shadow_buffer);
-      ctx.dispatcher.driver.glBufferData(GL_ARRAY_BUFFER, buffersize, a.shadow_pointer, GL_DYNAMIC_DRAW);
-      ctx.dispatcher.driver.glBindBuffer(GL_ARRAY_BUFFER, currObject ? currObject->vertexBuffer : 0);
+      clients[clientcount++] = index;
     }
 
+    if (clientcount)
+      UploadArrays(ctx, clients, clientcount, MaxArraysIndirectCount(&clientCmd[0], drawcount));
+
     if (clientdrawcount)
       *clientdrawcount = drawcount;
 
@@ -1369,11 +1560,13 @@ struct Vao
     GLsizei vtxcount = 0;
     GLint drawcount = 1;
     std::vector<DrawElementsIndirectCommand> clientCmd;
+    GLuint clients[REGAL_EMU_MAX_VERTEX_ATTRIBS];
+    GLuint clientcount = 0;
     GLboolean ccinit = false;
 
-    for (int index= 0; index < REGAL_EMU_MAX_VERTEX_ATTRIBS; index++)
+    for (GLuint index= 0; index < REGAL_EMU_MAX_VERTEX_ATTRIBS; index++)
     {
-      Array &a = objects[current].a[index];
+      const Array &a = objects[current].a[index];
       if(!a.enabled || a.buffer != a.shadow_buffer || a.shadow_buffer == 0 || !a.shadow_pointer)
         continue;
 
@@ -1398,6 +1591,10 @@ struct Vao
 
         ccinit = true;
 
+        GLuint restartIdx;
+        bool   restart;
+        RestartState(ctx, type, restartIdx, restart);
+
         if (currObject->indexBuffer == 0)
         {
           if (!pointer)
@@ -1408,13 +1605,22 @@ struct Vao
             if (!pointer[i] || clientCmd[i].count > 0x7FFFFFFF)
               continue;
 
-            GLsizei vc = MaxVertexCount(ctx, type, pointer[i], clientCmd[i].firstIndex, clientCmd[i].count) + clientCmd[i].baseVertex;
+            GLsizei vc = MaxVertexCount(type, pointer[i], clientCmd[i].firstIndex, clientCmd[i].count, restartIdx, restart) + clientCmd[i].baseVertex;
             if (vc > vtxcount)
               vtxcount = vc;
           }
         }
         else
         {
+          // Ranges already scanned for unchanged buffer contents are
+          // taken from the memo, mapping the buffer only for the rest.
+
+          if (transformFeedback)
+            indexRanges.Invalidate();
+
+          const long generation = indexRanges.Generation();
+          const GLsizei typeSize = TypeSize(type);
+          std::vector<GLboolean> pending(drawcount, GL_FALSE);
           GLuint minIdx = 0x7FFFFFFF;
           GLuint maxIdx = 0;
 
@@ -1422,37 +1628,58 @@ struct Vao
           {
             if (clientCmd[i].count == 0 || clientCmd[i].count > 0x7FFFFFFF)
               continue;
+
+            IndexRange range;
+            if (indexRanges.Lookup(currObject->indexBuffer, GLintptr(clientCmd[i].firstIndex) * typeSize, clientCmd[i].count, type, restartIdx, restart, range))
+            {
+              GLsizei vc = (range.empty() ? 1 : GLsizei(range.max) + 1) + clientCmd[i].baseVertex;
+              if (vc > vtxcount)
+                vtxcount = vc;
+              continue;
+            }
+
+            pending[i] = GL_TRUE;
+
             if (clientCmd[i].firstIndex < minIdx)
               minIdx = clientCmd[i].firstIndex;
             if (clientCmd[i].firstIndex + clientCmd[i].count > maxIdx)
               maxIdx = clientCmd[i].firstIndex + clientCmd[i].count;
           }
 
-          GLvoid* ptr = ctx.dispatcher.driver.glMapBufferRange(GL_ELEMENT_ARRAY_BUFFER, minIdx * TypeSize(type), (maxIdx - minIdx) * TypeSize(type), GL_MAP_READ_BIT);
-          if (!ptr)
-            return false;
-
-          for(GLint i = 0; i < drawcount; i++)
+          if (maxIdx > minIdx)
           {
-            GLsizei vc = MaxVertexCount(ctx, type, ptr, clientCmd[i].firstIndex, clientCmd[i].count) + clientCmd[i].baseVertex;
-            if (vc > vtxcount)
-              vtxcount = vc;
+            GLvoid* ptr = ctx.dispatcher.driver.glMapBufferRange(GL_ELEMENT_ARRAY_BUFFER, minIdx * typeSize, (maxIdx - minIdx) * typeSize, GL_MAP_READ_BIT);
+            if (!ptr)
+              return false;
+
+            // The mapping starts at minIdx, firstIndex is relative to the buffer
+
+            const GLvoid *base = static_cast<const GLubyte *>(ptr) - minIdx * typeSize;
+            for(GLint i = 0; i < drawcount; i++)
+            {
+              if (!pending[i])
+                continue;
+
+              const IndexRange range = IndexRangeScan(type, static_cast<const GLubyte *>(base) + size_t(clientCmd[i].firstIndex) * typeSize, clientCmd[i].count, restartIdx, restart);
+              indexRanges.Insert(currObject->indexBuffer, GLintptr(clientCmd[i].firstIndex) * typeSize, clientCmd[i].count, type, restartIdx, restart, generation, range);
+
+              GLsizei vc = (range.empty() ? 1 : GLsizei(range.max) + 1) + clientCmd[i].baseVertex;
+              if (vc > vtxcount)
+                vtxcount = vc;
+            }
+            ctx.dispatcher.driver.glUnmapBuffer(GL_ELEMENT_ARRAY_BUFFER);
           }
-          ctx.dispatcher.driver.glUnmapBuffer(GL_ELEMENT_ARRAY_BUFFER);
         }
         if(vtxcount < 1)
           return false;
       }
 
-      GLsizei buffersize = TypeSize(a.type) * (a.size == GL_BGRA ? 4 : a.size) * vtxcount;
-      if (!buffersize)
-        continue;
-
-      ctx.dispatcher.driver.glBindBuffer(GL_ARRAY_BUFFER, a.shadow_buffer);
-      ctx.dispatcher.driver.glBufferData(GL_ARRAY_BUFFER, buffersize, a.shadow_pointer, GL_DYNAMIC_DRAW);
-      ctx.dispatcher.driver.glBindBuffer(GL_ARRAY_BUFFER, currObject ? currObject->vertexBuffer : 0);
+      clients[clientcount++] = index;
     }
 
+    if (clientcount)
+      UploadArrays(ctx, clients, clientcount, vtxcount);
+
     if (currObject->indexBuffer == 0 && pointer && offsets_out)
     {
       for (GLint i = 0; i < drawcount; i++)
@@ -1516,11 +1743,16 @@ struct Vao
 
     std::vector<DrawElementsIndirectCommand> cmd(drawcount);
 
+    // With an element array buffer bound, indices are byte offsets into it
+
+    const GLsizei typeSize = TypeSize(type);
+    const bool    indexBuffer = currObject && currObject->indexBuffer && typeSize;
+
     for (GLint i = 0; i < drawcount; i++)
     {
       cmd[i].count = count[i];
       cmd[i].primCount = 1;
-      cmd[i].firstIndex = 0;
+      cmd[i].firstIndex = indexBuffer ? GLuint(reinterpret_cast<GLintptr>(indices[i]) / typeSize) : 0;
       cmd[i].baseVertex = bv[i];
       cmd[i].baseInstance = 0;
     }
@@ -0,0 +1,442 @@
+/*
+  Copyright (c) 2011-2013 NVIDIA Corporation
+  Copyright (c) 2011-2013 Cass Everitt
+  Copyright (c) 2012-2013 Scott Nations
+  Copyright (c) 2012-2013 Nigel Stewart
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+    Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+  IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+  OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+  OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+  Intended formatting conventions:
+  $ astyle --style=allman --indent=spaces=2 --indent-switches
+*/
+
+#include "pch.h" /* For MS precompiled header support */
+
+#include "RegalUtil.h"
+
+REGAL_GLOBAL_BEGIN
+
+#include <deque>
+#include <vector>
+
+#if REGAL_NO_TLS || REGAL_SYS_EMSCRIPTEN || REGAL_SYS_PPAPI
+#define REGAL_WORK_QUEUE_THREADS 0
+#else
+#define REGAL_WORK_QUEUE_THREADS 1
+#if REGAL_SYS_WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+#endif
+
+#include "RegalWorkQueue.h"
+
+REGAL_GLOBAL_END
+
+REGAL_NAMESPACE_BEGIN
+
+using namespace Logging;
+
+namespace Thread
+{
+
+#if REGAL_WORK_QUEUE_THREADS
+
+#if REGAL_SYS_WIN32
+
+struct WorkQueue::State
+{
+  State(const std::size_t d)
+  : depth(d),
+    busy(0),
+    done(false)
+  {
+    InitializeCriticalSection(&mutex);
+    InitializeConditionVariable(&work);
+    InitializeConditionVariable(&idle);
+  }
+
+  ~State()
+  {
+    DeleteCriticalSection(&mutex);
+  }
+
+  inline void lock()       { EnterCriticalSection(&mutex); }
+  inline void unlock()     { LeaveCriticalSection(&mutex); }
+  inline void waitWork()   { SleepConditionVariableCS(&work, &mutex, INFINITE); }
+  inline void waitIdle()   { SleepConditionVariableCS(&idle, &mutex, INFINITE); }
+  inline void signalWork() { WakeConditionVariable(&work);    }
+  inline void wakeAll()    { WakeAllConditionVariable(&work); }
+  inline void signalIdle() { WakeAllConditionVariable(&idle); }
+
+  void run();
+
+  CRITICAL_SECTION    mutex;
+  CONDITION_VARIABLE  work;
+  CONDITION_VARIABLE  idle;
+  std::deque<Job *>   jobs;
+  std::size_t         depth;
+  std::size_t         busy;
+  bool                done;
+  std::vector<HANDLE> threads;
+};
+
+static DWORD WINAPI worker(LPVOID arg)
+{
+  static_cast<WorkQueue::State *>(arg)->run();
+  return 0;
+}
+
+#else
+
+struct WorkQueue::State
+{
+  State(const std::size_t d)
+  : depth(d),
+    busy(0),
+    done(false)
+  {
+    pthread_mutex_init(&mutex, NULL);
+    pthread_cond_init(&work, NULL);
+    pthread_cond_init(&idle, NULL);
+  }
+
+  ~State()
+  {
+    pthread_cond_destroy(&idle);
+    pthread_cond_destroy(&work);
+    pthread_mutex_destroy(&mutex);
+  }
+
+  inline void lock()       { pthread_mutex_lock(&mutex);         }
+  inline void unlock()     { pthread_mutex_unlock(&mutex);       }
+  inline void waitWork()   { pthread_cond_wait(&work, &mutex);   }
+  inline void waitIdle()   { pthread_cond_wait(&idle, &mutex);   }
+  inline void signalWork() { pthread_cond_signal(&work);         }
+  inline void wakeAll()    { pthread_cond_broadcast(&work);      }
+  inline void signalIdle() { pthread_cond_broadcast(&idle);      }
+
+  void run();
+
+  pthread_mutex_t        mutex;
+  pthread_cond_t         work;
+  pthread_cond_t         idle;
+  std::deque<Job *>      jobs;
+  std::size_t            depth;
+  std::size_t            busy;
+  bool                   done;
+  std::vector<pthread_t> threads;
+};
+
+static void *worker(void *arg)
+{
+  static_cast<WorkQueue::State *>(arg)->run();
+  return NULL;
+}
+
+#endif
+
+// Worker thread loop, until the queue is empty and shutting down
+
+void
+WorkQueue::State::run()
+{
+  lock();
+  for (;;)
+  {
+    while (jobs.empty() && !done)
+      waitWork();
+
+    if (jobs.empty())
+      break;
+
+    Job *job = jobs.front();
+    jobs.pop_front();
+    ++busy;
+
+    // A bounded queue has room again, wake a blocked push
+
+    if (depth)
+      signalIdle();
+    unlock();
+
+    job->run();
+    delete job;
+
+    lock();
+    --busy;
+    if (jobs.empty() && !busy)
+      signalIdle();
+  }
+  unlock();
+}
+
+WorkQueue::WorkQueue(const std::size_t threads, const std::size_t depth)
+: _state(new State(depth))
+{
+  Internal("Regal::Thread::WorkQueue::WorkQueue","threads=",threads," depth=",depth);
+
+  for (std::size_t i=0; i<threads; ++i)
+  {
+#if REGAL_SYS_WIN32
+    HANDLE thread = CreateThread(NULL, 0, worker, _state, 0, NULL);
+    if (!thread)
+#else
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, worker, _state))
+#endif
+    {
+      Warning("Regal::Thread::WorkQueue failed to create worker thread.");
+      break;
+    }
+    _state->threads.push_back(thread);
+  }
+}
+
+WorkQueue::~WorkQueue()
+{
+  Internal("Regal::Thread::WorkQueue::~WorkQueue","()");
+
+  _state->lock();
+  _state->done = true;
+  _state->wakeAll();
+  _state->unlock();
+
+  for (std::size_t i=0; i<_state->threads.size(); ++i)
+  {
+#if REGAL_SYS_WIN32
+    WaitForSingleObject(_state->threads[i], INFINITE);
+    CloseHandle(_state->threads[i]);
+#else
+    pthread_join(_state->threads[i], NULL);
+#endif
+  }
+
+  delete _state;
+}
+
+void
+WorkQueue::push(Job *job)
+{
+  RegalAssert(job);
+
+  if (_state->threads.empty())
+  {
+    job->run();
+    delete job;
+    return;
+  }
+
+  _state->lock();
+  while (_state->depth && _state->jobs.size()>=_state->depth)
+    _state->waitIdle();
+  _state->jobs.push_back(job);
+  _state->signalWork();
+  _state->unlock();
+}
+
+void
+WorkQueue::wait()
+{
+  _state->lock();
+  while (!_state->jobs.empty() || _state->busy)
+    _state->waitIdle();
+  _state->unlock();
+}
+
+bool
+WorkQueue::full() const
+{
+  _state->lock();
+  const bool full = _state->depth && _state->jobs.size()>=_state->depth;
+  _state->unlock();
+  return full;
+}
+
+std::size_t
+WorkQueue::threads() const
+{
+  return _state->threads.size();
+}
+
+#if REGAL_SYS_WIN32
+
+struct Event::State
+{
+  State()
+  : signalled(false)
+  {
+    InitializeCriticalSection(&mutex);
+    InitializeConditionVariable(&cond);
+  }
+
+  ~State()
+  {
+    DeleteCriticalSection(&mutex);
+  }
+
+  inline void lock()   { EnterCriticalSection(&mutex); }
+  inline void unlock() { LeaveCriticalSection(&mutex); }
+  inline void wait()   { SleepConditionVariableCS(&cond, &mutex, INFINITE); }
+  inline void wake()   { WakeConditionVariable(&cond); }
+
+  CRITICAL_SECTION   mutex;
+  CONDITION_VARIABLE cond;
+  bool               signalled;
+};
+
+#else
+
+struct Event::State
+{
+  State()
+  : signalled(false)
+  {
+    pthread_mutex_init(&mutex, NULL);
+    pthread_cond_init(&cond, NULL);
+  }
+
+  ~State()
+  {
+    pthread_cond_destroy(&cond);
+    pthread_mutex_destroy(&mutex);
+  }
+
+  inline void lock()   { pthread_mutex_lock(&mutex);       }
+  inline void unlock() { pthread_mutex_unlock(&mutex);     }
+  inline void wait()   { pthread_cond_wait(&cond, &mutex); }
+  inline void wake()   { pthread_cond_signal(&cond);       }
+
+  pthread_mutex_t mutex;
+  pthread_cond_t  cond;
+  bool            signalled;
+};
+
+#endif
+
+Event::Event()
+: _state(new State())
+{
+}
+
+Event::~Event()
+{
+  delete _state;
+}
+
+void
+Event::signal()
+{
+  _state->lock();
+  _state->signalled = true;
+  _state->wake();
+  _state->unlock();
+}
+
+void
+Event::wait()
+{
+  _state->lock();
+  while (!_state->signalled)
+    _state->wait();
+  _state->signalled = false;
+  _state->unlock();
+}
+
+#else // !REGAL_WORK_QUEUE_THREADS
+
+// No threading, jobs run as they are pushed
+
+struct WorkQueue::State
+{
+};
+
+WorkQueue::WorkQueue(const std::size_t threads, const std::size_t depth)
+: _state(NULL)
+{
+  UNUSED_PARAMETER(threads);
+  UNUSED_PARAMETER(depth);
+}
+
+WorkQueue::~WorkQueue()
+{
+}
+
+void
+WorkQueue::push(Job *job)
+{
+  RegalAssert(job);
+  job->run();
+  delete job;
+}
+
+void
+WorkQueue::wait()
+{
+}
+
+bool
+WorkQueue::full() const
+{
+  return false;
+}
+
+std::size_t
+WorkQueue::threads() const
+{
+  return 0;
+}
+
+// Nobody else to wait for
+
+struct Event::State
+{
+};
+
+Event::Event()
+: _state(NULL)
+{
+}
+
+Event::~Event()
+{
+}
+
+void
+Event::signal()
+{
+}
+
+void
+Event::wait()
+{
+}
+
+#endif
+
+}
+
+REGAL_NAMESPACE_END
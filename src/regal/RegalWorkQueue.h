@@ -0,0 +1,120 @@
+/*
+  Copyright (c) 2011-2013 NVIDIA Corporation
+  Copyright (c) 2011-2013 Cass Everitt
+  Copyright (c) 2012-2013 Scott Nations
+  Copyright (c) 2012-2013 Nigel Stewart
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+    Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+  IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+  OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+  OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+
+ Regal background work queue
+
+ A fixed pool of worker threads draining a FIFO of jobs.  With no
+ threads, or where threads are not available, jobs run immediately
+ on the calling thread.  An optional depth bounds the jobs waiting
+ for a thread, pushing to a full queue blocks until one is taken.
+
+ Event wakes a single waiting thread, such as a long-running job
+ with nothing to do.  A signal with nobody waiting is kept for the
+ next wait.
+
+ */
+
+#ifndef __REGAL_WORK_QUEUE_H__
+#define __REGAL_WORK_QUEUE_H__
+
+#include "RegalUtil.h"
+
+REGAL_GLOBAL_BEGIN
+
+#include <cstddef>
+
+REGAL_GLOBAL_END
+
+REGAL_NAMESPACE_BEGIN
+
+namespace Thread
+{
+  //
+  // Job
+  //
+
+  struct Job
+  {
+    virtual ~Job() {}
+    virtual void run() = 0;
+  };
+
+  //
+  // WorkQueue
+  //
+
+  struct WorkQueue
+  {
+  public:
+    explicit WorkQueue(const std::size_t threads, const std::size_t depth = 0);
+    ~WorkQueue();                       // Waits for queued jobs to complete
+
+    void push(Job *job);                // Takes ownership of job, blocks while full
+    void wait();                        // Block until all queued jobs are complete
+    bool full() const;                  // Jobs waiting have reached the depth
+
+    std::size_t threads() const;
+
+    struct State;                       // Platform-specific
+
+  private:
+    State *_state;
+
+    WorkQueue(const WorkQueue &other);
+    WorkQueue &operator=(const WorkQueue &other);
+  };
+
+  //
+  // Event
+  //
+
+  struct Event
+  {
+  public:
+    Event();
+    ~Event();
+
+    void signal();                      // Wake the waiter, or the next wait
+    void wait();                        // Block until signalled, then reset
+
+    struct State;                       // Platform-specific
+
+  private:
+    State *_state;
+
+    Event(const Event &other);
+    Event &operator=(const Event &other);
+  };
+}
+
+REGAL_NAMESPACE_END
+
+#endif // __REGAL_WORK_QUEUE_H__
@@ -0,0 +1,98 @@
+/*
+  Copyright (c) 2011-2013 NVIDIA Corporation
+  Copyright (c) 2011-2013 Cass Everitt
+  Copyright (c) 2012-2013 Scott Nations
+  Copyright (c) 2012-2013 Nigel Stewart
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+    Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+  IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+  OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+  OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+  Intended formatting conventions:
+  $ astyle --style=allman --indent=spaces=2 --indent-switches
+*/
+
+/*
+
+ regallog
+
+ Renders a binary call log, as written with REGAL_LOG_BINARY,
+ as Regal text log output or as Chrome trace JSON.
+
+ $ regallog regal.bin
+ $ regallog --json regal.bin regal.json
+
+ */
+
+#include "RegalUtil.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "RegalLogBinary.h"
+
+using namespace ::REGAL_NAMESPACE_INTERNAL;
+
+int
+main(int argc, const char *argv[])
+{
+  bool json = false;
+  int  i    = 1;
+
+  if (i<argc && !strcmp(argv[i],"--json"))
+  {
+    json = true;
+    ++i;
+  }
+
+  if (i>=argc || argc-i>2)
+  {
+    fprintf(stderr,"Usage: regallog [--json] <input> [<output>]\n");
+    return 1;
+  }
+
+  FILE *output = stdout;
+  if (argc-i==2)
+  {
+    output = fopen(argv[i+1],"wt");
+    if (!output)
+    {
+      fprintf(stderr,"regallog: could not open %s for writing.\n",argv[i+1]);
+      return 1;
+    }
+  }
+
+  const bool ok = BinaryLog::decode(argv[i],output,json);
+
+  if (output!=stdout)
+    fclose(output);
+
+  if (!ok)
+  {
+    fprintf(stderr,"regallog: could not read %s as a Regal binary log.\n",argv[i]);
+    return 1;
+  }
+
+  return 0;
+}
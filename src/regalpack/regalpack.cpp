@@ -0,0 +1,112 @@
+/*
+  Copyright (c) 2011-2013 NVIDIA Corporation
+  Copyright (c) 2011-2013 Cass Everitt
+  Copyright (c) 2012-2013 Scott Nations
+  Copyright (c) 2012-2013 Nigel Stewart
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+    Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+  IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+  OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+  OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+  Intended formatting conventions:
+  $ astyle --style=allman --indent=spaces=2 --indent-switches
+*/
+
+/*
+
+ regalpack
+
+ Compacts a pack file, such as the shader cache written with
+ REGAL_CACHE_SHADER_WRITE, so that every blob is indexed.
+ Optionally (re)compresses the blobs with snappy, or lists
+ the hash and size of each.
+
+ $ regalpack shader.pack
+ $ regalpack --compress shader.pack compact.pack
+ $ regalpack --list shader.pack
+
+ */
+
+#include "RegalUtil.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "RegalCachePack.h"
+
+using namespace ::REGAL_NAMESPACE_INTERNAL;
+
+int
+main(int argc, const char *argv[])
+{
+  bool compress = false;
+  bool list     = false;
+  int  i        = 1;
+
+  for (; i<argc && !strncmp(argv[i],"--",2); ++i)
+  {
+    if      (!strcmp(argv[i],"--compress")) compress = true;
+    else if (!strcmp(argv[i],"--list"))     list     = true;
+    else break;
+  }
+
+  if (i>=argc || argc-i>(list ? 1 : 2))
+  {
+    fprintf(stderr,"Usage: regalpack [--compress] <input> [<output>]\n");
+    fprintf(stderr,"       regalpack --list <input>\n");
+    return 1;
+  }
+
+  if (list)
+  {
+    Cache::Pack pack;
+    if (!pack.open(argv[i]))
+    {
+      fprintf(stderr,"regalpack: could not read %s as a Regal pack.\n",argv[i]);
+      return 1;
+    }
+
+    std::vector<GLuint64> hashes;
+    pack.hashes(hashes);
+    for (std::size_t j=0; j<hashes.size(); ++j)
+    {
+      std::string data;
+      if (pack.find(hashes[j],data))
+        printf("%016llx %lu\n",static_cast<unsigned long long>(hashes[j]),static_cast<unsigned long>(data.size()));
+      else
+        printf("%016llx unreadable\n",static_cast<unsigned long long>(hashes[j]));
+    }
+    return 0;
+  }
+
+  const char *output = argc-i==2 ? argv[i+1] : argv[i];
+  if (!Cache::Pack::compact(argv[i],output,compress))
+  {
+    fprintf(stderr,"regalpack: could not compact %s into %s.\n",argv[i],output);
+    return 1;
+  }
+
+  return 0;
+}
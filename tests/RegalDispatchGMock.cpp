@@ -1399,14 +1399,38 @@ void REGAL_CALL gmock_glVertexPointer(GLint size, GLenum type, GLsizei stride, c
   return RegalGMockInterface::current->glVertexPointer(size, type, stride, pointer);
 }
 
+void REGAL_CALL gmock_glActiveTexture(GLenum texture) {
+  return RegalGMockInterface::current->glActiveTexture(texture);
+}
+
 void REGAL_CALL gmock_glClientActiveTexture(GLenum texture) {
   return RegalGMockInterface::current->glClientActiveTexture(texture);
 }
 
+void REGAL_CALL gmock_glSampleCoverage(GLclampf value, GLboolean invert) {
+  return RegalGMockInterface::current->glSampleCoverage(value, invert);
+}
+
+void REGAL_CALL gmock_glBlendColor(GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha) {
+  return RegalGMockInterface::current->glBlendColor(red, green, blue, alpha);
+}
+
 void REGAL_CALL gmock_glFogCoordPointer(GLenum type, GLsizei stride, const GLvoid *pointer) {
   return RegalGMockInterface::current->glFogCoordPointer(type, stride, pointer);
 }
 
+void REGAL_CALL gmock_glPointParameterf(GLenum pname, GLfloat param) {
+  return RegalGMockInterface::current->glPointParameterf(pname, param);
+}
+
+void REGAL_CALL gmock_glPointParameterfv(GLenum pname, const GLfloat *params) {
+  return RegalGMockInterface::current->glPointParameterfv(pname, params);
+}
+
+void REGAL_CALL gmock_glPointParameteri(GLenum pname, GLint param) {
+  return RegalGMockInterface::current->glPointParameteri(pname, param);
+}
+
 void REGAL_CALL gmock_glSecondaryColorPointer(GLint size, GLenum type, GLsizei stride, const GLvoid *pointer) {
   return RegalGMockInterface::current->glSecondaryColorPointer(size, type, stride, pointer);
 }
@@ -1415,6 +1439,38 @@ void REGAL_CALL gmock_glBindBuffer(GLenum target, GLuint buffer) {
   return RegalGMockInterface::current->glBindBuffer(target, buffer);
 }
 
+void REGAL_CALL gmock_glBufferData(GLenum target, GLsizeiptr size, const GLvoid *data, GLenum usage) {
+  return RegalGMockInterface::current->glBufferData(target, size, data, usage);
+}
+
+void REGAL_CALL gmock_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const GLvoid *data) {
+  return RegalGMockInterface::current->glBufferSubData(target, offset, size, data);
+}
+
+void REGAL_CALL gmock_glDeleteBuffers(GLsizei n, const GLuint *buffers) {
+  return RegalGMockInterface::current->glDeleteBuffers(n, buffers);
+}
+
+void REGAL_CALL gmock_glDeleteQueries(GLsizei n, const GLuint *ids) {
+  return RegalGMockInterface::current->glDeleteQueries(n, ids);
+}
+
+void REGAL_CALL gmock_glGenBuffers(GLsizei n, GLuint *buffers) {
+  return RegalGMockInterface::current->glGenBuffers(n, buffers);
+}
+
+void REGAL_CALL gmock_glGenQueries(GLsizei n, GLuint *ids) {
+  return RegalGMockInterface::current->glGenQueries(n, ids);
+}
+
+void REGAL_CALL gmock_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params) {
+  return RegalGMockInterface::current->glGetQueryObjectuiv(id, pname, params);
+}
+
+GLboolean REGAL_CALL gmock_glUnmapBuffer(GLenum target) {
+  return RegalGMockInterface::current->glUnmapBuffer(target);
+}
+
 void REGAL_CALL gmock_glAttachShader(GLuint program, GLuint shader) {
   return RegalGMockInterface::current->glAttachShader(program, shader);
 }
@@ -1787,10 +1843,94 @@ void REGAL_CALL gmock_glVertexAttribPointer(GLuint index, GLint size, GLenum typ
   return RegalGMockInterface::current->glVertexAttribPointer(index, size, type, normalized, stride, pointer);
 }
 
+void REGAL_CALL gmock_glClampColor(GLenum target, GLenum clamp) {
+  return RegalGMockInterface::current->glClampColor(target, clamp);
+}
+
+void REGAL_CALL gmock_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+  return RegalGMockInterface::current->glColorMaski(index, r, g, b, a);
+}
+
+void REGAL_CALL gmock_glDisablei(GLenum target, GLuint index) {
+  return RegalGMockInterface::current->glDisablei(target, index);
+}
+
+void REGAL_CALL gmock_glEnablei(GLenum target, GLuint index) {
+  return RegalGMockInterface::current->glEnablei(target, index);
+}
+
 void REGAL_CALL gmock_glPrimitiveRestartIndex(GLuint index) {
   return RegalGMockInterface::current->glPrimitiveRestartIndex(index);
 }
 
+void REGAL_CALL gmock_glBlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum modeAlpha) {
+  return RegalGMockInterface::current->glBlendEquationSeparatei(buf, modeRGB, modeAlpha);
+}
+
+void REGAL_CALL gmock_glBlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha) {
+  return RegalGMockInterface::current->glBlendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+}
+
+void REGAL_CALL gmock_glMinSampleShading(GLclampf value) {
+  return RegalGMockInterface::current->glMinSampleShading(value);
+}
+
+void REGAL_CALL gmock_glBindRenderbuffer(GLenum target, GLuint renderbuffer) {
+  return RegalGMockInterface::current->glBindRenderbuffer(target, renderbuffer);
+}
+
+void REGAL_CALL gmock_glColorTableParameterfv(GLenum target, GLenum pname, const GLfloat *params) {
+  return RegalGMockInterface::current->glColorTableParameterfv(target, pname, params);
+}
+
+void REGAL_CALL gmock_glConvolutionParameterfv(GLenum target, GLenum pname, const GLfloat *params) {
+  return RegalGMockInterface::current->glConvolutionParameterfv(target, pname, params);
+}
+
+void REGAL_CALL gmock_glConvolutionParameteri(GLenum target, GLenum pname, GLint params) {
+  return RegalGMockInterface::current->glConvolutionParameteri(target, pname, params);
+}
+
+GLvoid * REGAL_CALL gmock_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+  return RegalGMockInterface::current->glMapBufferRange(target, offset, length, access);
+}
+
+void REGAL_CALL gmock_glProvokingVertex(GLenum mode) {
+  return RegalGMockInterface::current->glProvokingVertex(mode);
+}
+
+GLenum REGAL_CALL gmock_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+  return RegalGMockInterface::current->glClientWaitSync(sync, flags, timeout);
+}
+
+void REGAL_CALL gmock_glDeleteSync(GLsync sync) {
+  return RegalGMockInterface::current->glDeleteSync(sync);
+}
+
+GLsync REGAL_CALL gmock_glFenceSync(GLenum condition, GLbitfield flags) {
+  return RegalGMockInterface::current->glFenceSync(condition, flags);
+}
+
+void REGAL_CALL gmock_glGetInteger64v(GLenum pname, GLint64 *params) {
+  return RegalGMockInterface::current->glGetInteger64v(pname, params);
+}
+
+void REGAL_CALL gmock_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params) {
+  return RegalGMockInterface::current->glGetQueryObjectui64v(id, pname, params);
+}
+
+void REGAL_CALL gmock_glQueryCounter(GLuint id, GLenum target) {
+  return RegalGMockInterface::current->glQueryCounter(id, target);
+}
+
+void REGAL_CALL gmock_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+  return RegalGMockInterface::current->glBindBufferRange(target, index, buffer, offset, size);
+}
+
+void REGAL_CALL gmock_glGetIntegeri_v(GLenum target, GLuint index, GLint *data) {
+  return RegalGMockInterface::current->glGetIntegeri_v(target, index, data);
+}
+
 void REGAL_CALL gmock_glBindVertexArray(GLuint array) {
   return RegalGMockInterface::current->glBindVertexArray(array);
 }
@@ -1819,6 +1959,26 @@ void REGAL_CALL gmock_glVertexBindingDivisor(GLuint bindingindex, GLuint divisor
   return RegalGMockInterface::current->glVertexBindingDivisor(bindingindex, divisor);
 }
 
+void REGAL_CALL gmock_glBindProgramARB(GLenum target, GLuint program) {
+  return RegalGMockInterface::current->glBindProgramARB(target, program);
+}
+
+void REGAL_CALL gmock_glDepthRangeArrayv(GLuint first, GLsizei count, const GLclampd *v) {
+  return RegalGMockInterface::current->glDepthRangeArrayv(first, count, v);
+}
+
+void REGAL_CALL gmock_glGetFloati_v(GLenum target, GLuint index, GLfloat *v) {
+  return RegalGMockInterface::current->glGetFloati_v(target, index, v);
+}
+
+void REGAL_CALL gmock_glScissorIndexedv(GLuint index, const GLint *v) {
+  return RegalGMockInterface::current->glScissorIndexedv(index, v);
+}
+
+void REGAL_CALL gmock_glViewportIndexedfv(GLuint index, const GLfloat *v) {
+  return RegalGMockInterface::current->glViewportIndexedfv(index, v);
+}
+
 void REGAL_CALL gmock_glClientAttribDefaultEXT(GLbitfield mask) {
   return RegalGMockInterface::current->glClientAttribDefaultEXT(mask);
 }
@@ -1831,6 +1991,10 @@ void REGAL_CALL gmock_glMultiTexCoordPointerEXT(GLenum texunit, GLint size, GLen
   return RegalGMockInterface::current->glMultiTexCoordPointerEXT(texunit, size, type, stride, pointer);
 }
 
+void REGAL_CALL gmock_glMultiTexEnviEXT(GLenum texunit, GLenum target, GLenum pname, GLint param) {
+  return RegalGMockInterface::current->glMultiTexEnviEXT(texunit, target, pname, param);
+}
+
 } // namespace
 
 RegalGMockInterface::RegalGMockInterface()
@@ -2183,10 +2347,24 @@ void InitDispatchTableGMock(DispatchTableGL &tbl)
   tbl.glTexSubImage1D = gmock_glTexSubImage1D;
   tbl.glTexSubImage2D = gmock_glTexSubImage2D;
   tbl.glVertexPointer = gmock_glVertexPointer;
+  tbl.glActiveTexture = gmock_glActiveTexture;
   tbl.glClientActiveTexture = gmock_glClientActiveTexture;
+  tbl.glSampleCoverage = gmock_glSampleCoverage;
+  tbl.glBlendColor = gmock_glBlendColor;
   tbl.glFogCoordPointer = gmock_glFogCoordPointer;
+  tbl.glPointParameterf = gmock_glPointParameterf;
+  tbl.glPointParameterfv = gmock_glPointParameterfv;
+  tbl.glPointParameteri = gmock_glPointParameteri;
   tbl.glSecondaryColorPointer = gmock_glSecondaryColorPointer;
   tbl.glBindBuffer = gmock_glBindBuffer;
+  tbl.glBufferData = gmock_glBufferData;
+  tbl.glBufferSubData = gmock_glBufferSubData;
+  tbl.glDeleteBuffers = gmock_glDeleteBuffers;
+  tbl.glDeleteQueries = gmock_glDeleteQueries;
+  tbl.glGenBuffers = gmock_glGenBuffers;
+  tbl.glGenQueries = gmock_glGenQueries;
+  tbl.glGetQueryObjectuiv = gmock_glGetQueryObjectuiv;
+  tbl.glUnmapBuffer = gmock_glUnmapBuffer;
   tbl.glAttachShader = gmock_glAttachShader;
   tbl.glBindAttribLocation = gmock_glBindAttribLocation;
   tbl.glBlendEquationSeparate = gmock_glBlendEquationSeparate;
@@ -2280,7 +2458,28 @@ void InitDispatchTableGMock(DispatchTableGL &tbl)
   tbl.glVertexAttrib4uiv = gmock_glVertexAttrib4uiv;
   tbl.glVertexAttrib4usv = gmock_glVertexAttrib4usv;
   tbl.glVertexAttribPointer = gmock_glVertexAttribPointer;
+  tbl.glClampColor = gmock_glClampColor;
+  tbl.glColorMaski = gmock_glColorMaski;
+  tbl.glDisablei = gmock_glDisablei;
+  tbl.glEnablei = gmock_glEnablei;
   tbl.glPrimitiveRestartIndex = gmock_glPrimitiveRestartIndex;
+  tbl.glBlendEquationSeparatei = gmock_glBlendEquationSeparatei;
+  tbl.glBlendFuncSeparatei = gmock_glBlendFuncSeparatei;
+  tbl.glMinSampleShading = gmock_glMinSampleShading;
+  tbl.glBindRenderbuffer = gmock_glBindRenderbuffer;
+  tbl.glColorTableParameterfv = gmock_glColorTableParameterfv;
+  tbl.glConvolutionParameterfv = gmock_glConvolutionParameterfv;
+  tbl.glConvolutionParameteri = gmock_glConvolutionParameteri;
+  tbl.glMapBufferRange = gmock_glMapBufferRange;
+  tbl.glProvokingVertex = gmock_glProvokingVertex;
+  tbl.glClientWaitSync = gmock_glClientWaitSync;
+  tbl.glDeleteSync = gmock_glDeleteSync;
+  tbl.glFenceSync = gmock_glFenceSync;
+  tbl.glGetInteger64v = gmock_glGetInteger64v;
+  tbl.glGetQueryObjectui64v = gmock_glGetQueryObjectui64v;
+  tbl.glQueryCounter = gmock_glQueryCounter;
+  tbl.glBindBufferRange = gmock_glBindBufferRange;
+  tbl.glGetIntegeri_v = gmock_glGetIntegeri_v;
   tbl.glBindVertexArray = gmock_glBindVertexArray;
   tbl.glBindVertexBuffer = gmock_glBindVertexBuffer;
   tbl.glVertexAttribBinding = gmock_glVertexAttribBinding;
@@ -2288,9 +2487,15 @@ void InitDispatchTableGMock(DispatchTableGL &tbl)
   tbl.glVertexAttribIFormat = gmock_glVertexAttribIFormat;
   tbl.glVertexAttribLFormat = gmock_glVertexAttribLFormat;
   tbl.glVertexBindingDivisor = gmock_glVertexBindingDivisor;
+  tbl.glBindProgramARB = gmock_glBindProgramARB;
+  tbl.glDepthRangeArrayv = gmock_glDepthRangeArrayv;
+  tbl.glGetFloati_v = gmock_glGetFloati_v;
+  tbl.glScissorIndexedv = gmock_glScissorIndexedv;
+  tbl.glViewportIndexedfv = gmock_glViewportIndexedfv;
   tbl.glClientAttribDefaultEXT = gmock_glClientAttribDefaultEXT;
   tbl.glDisableClientStateiEXT = gmock_glDisableClientStateiEXT;
   tbl.glMultiTexCoordPointerEXT = gmock_glMultiTexCoordPointerEXT;
+  tbl.glMultiTexEnviEXT = gmock_glMultiTexEnviEXT;
 }
 
 REGAL_NAMESPACE_END
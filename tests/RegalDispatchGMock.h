@@ -397,10 +397,24 @@ struct RegalGMockInterface
   MOCK_METHOD7(glTexSubImage1D, void(GLenum, GLint, GLint, GLsizei, GLenum, GLenum, const GLvoid *));
   MOCK_METHOD9(glTexSubImage2D, void(GLenum, GLint, GLint, GLint, GLsizei, GLsizei, GLenum, GLenum, const GLvoid *));
   MOCK_METHOD4(glVertexPointer, void(GLint, GLenum, GLsizei, const GLvoid *));
+  MOCK_METHOD1(glActiveTexture, void(GLenum));
   MOCK_METHOD1(glClientActiveTexture, void(GLenum));
+  MOCK_METHOD2(glSampleCoverage, void(GLclampf, GLboolean));
+  MOCK_METHOD4(glBlendColor, void(GLclampf, GLclampf, GLclampf, GLclampf));
   MOCK_METHOD3(glFogCoordPointer, void(GLenum, GLsizei, const GLvoid *));
+  MOCK_METHOD2(glPointParameterf, void(GLenum, GLfloat));
+  MOCK_METHOD2(glPointParameterfv, void(GLenum, const GLfloat *));
+  MOCK_METHOD2(glPointParameteri, void(GLenum, GLint));
   MOCK_METHOD4(glSecondaryColorPointer, void(GLint, GLenum, GLsizei, const GLvoid *));
   MOCK_METHOD2(glBindBuffer, void(GLenum, GLuint));
+  MOCK_METHOD4(glBufferData, void(GLenum, GLsizeiptr, const GLvoid *, GLenum));
+  MOCK_METHOD4(glBufferSubData, void(GLenum, GLintptr, GLsizeiptr, const GLvoid *));
+  MOCK_METHOD2(glDeleteBuffers, void(GLsizei, const GLuint *));
+  MOCK_METHOD2(glDeleteQueries, void(GLsizei, const GLuint *));
+  MOCK_METHOD2(glGenBuffers, void(GLsizei, GLuint *));
+  MOCK_METHOD2(glGenQueries, void(GLsizei, GLuint *));
+  MOCK_METHOD3(glGetQueryObjectuiv, void(GLuint, GLenum, GLuint *));
+  MOCK_METHOD1(glUnmapBuffer, GLboolean(GLenum));
   MOCK_METHOD2(glAttachShader, void(GLuint, GLuint));
   MOCK_METHOD3(glBindAttribLocation, void(GLuint, GLuint, const GLchar *));
   MOCK_METHOD2(glBlendEquationSeparate, void(GLenum, GLenum));
@@ -494,7 +508,28 @@ struct RegalGMockInterface
   MOCK_METHOD2(glVertexAttrib4uiv, void(GLuint, const GLuint *));
   MOCK_METHOD2(glVertexAttrib4usv, void(GLuint, const GLushort *));
   MOCK_METHOD6(glVertexAttribPointer, void(GLuint, GLint, GLenum, GLboolean, GLsizei, const GLvoid *));
+  MOCK_METHOD2(glClampColor, void(GLenum, GLenum));
+  MOCK_METHOD5(glColorMaski, void(GLuint, GLboolean, GLboolean, GLboolean, GLboolean));
+  MOCK_METHOD2(glDisablei, void(GLenum, GLuint));
+  MOCK_METHOD2(glEnablei, void(GLenum, GLuint));
   MOCK_METHOD1(glPrimitiveRestartIndex, void(GLuint));
+  MOCK_METHOD3(glBlendEquationSeparatei, void(GLuint, GLenum, GLenum));
+  MOCK_METHOD5(glBlendFuncSeparatei, void(GLuint, GLenum, GLenum, GLenum, GLenum));
+  MOCK_METHOD1(glMinSampleShading, void(GLclampf));
+  MOCK_METHOD2(glBindRenderbuffer, void(GLenum, GLuint));
+  MOCK_METHOD3(glColorTableParameterfv, void(GLenum, GLenum, const GLfloat *));
+  MOCK_METHOD3(glConvolutionParameterfv, void(GLenum, GLenum, const GLfloat *));
+  MOCK_METHOD3(glConvolutionParameteri, void(GLenum, GLenum, GLint));
+  MOCK_METHOD4(glMapBufferRange, GLvoid *(GLenum, GLintptr, GLsizeiptr, GLbitfield));
+  MOCK_METHOD1(glProvokingVertex, void(GLenum));
+  MOCK_METHOD3(glClientWaitSync, GLenum(GLsync, GLbitfield, GLuint64));
+  MOCK_METHOD1(glDeleteSync, void(GLsync));
+  MOCK_METHOD2(glFenceSync, GLsync(GLenum, GLbitfield));
+  MOCK_METHOD2(glGetInteger64v, void(GLenum, GLint64 *));
+  MOCK_METHOD3(glGetQueryObjectui64v, void(GLuint, GLenum, GLuint64 *));
+  MOCK_METHOD2(glQueryCounter, void(GLuint, GLenum));
+  MOCK_METHOD5(glBindBufferRange, void(GLenum, GLuint, GLuint, GLintptr, GLsizeiptr));
+  MOCK_METHOD3(glGetIntegeri_v, void(GLenum, GLuint, GLint *));
   MOCK_METHOD1(glBindVertexArray, void(GLuint));
   MOCK_METHOD4(glBindVertexBuffer, void(GLuint, GLuint, GLintptr, GLsizei));
   MOCK_METHOD2(glVertexAttribBinding, void(GLuint, GLuint));
@@ -502,9 +537,15 @@ struct RegalGMockInterface
   MOCK_METHOD4(glVertexAttribIFormat, void(GLuint, GLint, GLenum, GLuint));
   MOCK_METHOD4(glVertexAttribLFormat, void(GLuint, GLint, GLenum, GLuint));
   MOCK_METHOD2(glVertexBindingDivisor, void(GLuint, GLuint));
+  MOCK_METHOD2(glBindProgramARB, void(GLenum, GLuint));
+  MOCK_METHOD3(glDepthRangeArrayv, void(GLuint, GLsizei, const GLclampd *));
+  MOCK_METHOD3(glGetFloati_v, void(GLenum, GLuint, GLfloat *));
+  MOCK_METHOD2(glScissorIndexedv, void(GLuint, const GLint *));
+  MOCK_METHOD2(glViewportIndexedfv, void(GLuint, const GLfloat *));
   MOCK_METHOD1(glClientAttribDefaultEXT, void(GLbitfield));
   MOCK_METHOD2(glDisableClientStateiEXT, void(GLenum, GLuint));
   MOCK_METHOD5(glMultiTexCoordPointerEXT, void(GLenum, GLint, GLenum, GLsizei, const GLvoid *));
+  MOCK_METHOD4(glMultiTexEnviEXT, void(GLenum, GLenum, GLenum, GLint));
 };
 
 void InitDispatchTableGMock(DispatchTableGL &tbl);
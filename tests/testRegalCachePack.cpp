@@ -0,0 +1,223 @@
+/*
+  Copyright (c) 2011-2013 NVIDIA Corporation
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+    Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+  IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+  OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+  OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+
+#include "gtest/gtest.h"
+
+#include <GL/Regal.h>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "RegalCachePack.h"
+
+namespace {
+
+using namespace Regal;
+using ::std::string;
+using ::std::vector;
+
+const char *packFile    = "testRegalCachePack.pack";
+const char *compactFile = "testRegalCachePack.compact";
+
+string blob(const int i)
+{
+  string tmp;
+  for (int j=0; j<100+i*37; ++j)
+    tmp += "void main() { gl_FragColor = vec4(1.0); }\n"[(i+j)%42];
+  return tmp;
+}
+
+// ====================================
+// Regal::Cache::Pack
+// ====================================
+
+TEST( RegalCachePack, AppendFindCompact )
+{
+  remove(packFile);
+  remove(compactFile);
+
+  const int n = 20;
+  string data;
+
+  // Blobs appended to a new pack are found straight away
+
+  {
+    Cache::Pack pack;
+    ASSERT_TRUE(pack.open(packFile));
+    EXPECT_FALSE(pack.find(1,data));
+    for (int i=0; i<n; ++i)
+      EXPECT_TRUE(pack.append(Cache::Pack::hash(blob(i).data(),blob(i).size()),blob(i).data(),blob(i).size(),(i&1)!=0));
+    for (int i=0; i<n; ++i)
+    {
+      EXPECT_TRUE(pack.find(Cache::Pack::hash(blob(i).data(),blob(i).size()),data));
+      EXPECT_EQ(blob(i),data);
+    }
+  }
+
+  // ... and after reopening, as appended records
+
+  {
+    Cache::Pack pack;
+    ASSERT_TRUE(pack.open(packFile));
+    vector<GLuint64> hashes;
+    pack.hashes(hashes);
+    EXPECT_EQ(size_t(n),hashes.size());
+    for (int i=0; i<n; ++i)
+    {
+      EXPECT_TRUE(pack.find(Cache::Pack::hash(blob(i).data(),blob(i).size()),data));
+      EXPECT_EQ(blob(i),data);
+    }
+    EXPECT_TRUE(pack.append(42,"extra",5,false));
+  }
+
+  // Compaction indexes everything
+
+  ASSERT_TRUE(Cache::Pack::compact(packFile,compactFile,true));
+  {
+    Cache::Pack pack;
+    ASSERT_TRUE(pack.open(compactFile));
+    vector<GLuint64> hashes;
+    pack.hashes(hashes);
+    EXPECT_EQ(size_t(n+1),hashes.size());
+    for (int i=0; i<n; ++i)
+    {
+      EXPECT_TRUE(pack.find(Cache::Pack::hash(blob(i).data(),blob(i).size()),data));
+      EXPECT_EQ(blob(i),data);
+    }
+    EXPECT_TRUE(pack.find(42,data));
+    EXPECT_EQ(string("extra"),data);
+    EXPECT_FALSE(pack.find(43,data));
+
+    // Appending after compaction works too
+
+    EXPECT_TRUE(pack.append(43,"more",4,true));
+    EXPECT_TRUE(pack.append(45,string(8191,' ').data(),8191,true));
+
+    // Appended blobs are read back from beyond the mapping,
+    // and appending again after reading still goes at the end
+
+    EXPECT_TRUE(pack.find(43,data));
+    EXPECT_EQ(string("more"),data);
+    EXPECT_TRUE(pack.append(46,"again",5,false));
+    EXPECT_TRUE(pack.find(45,data));
+    EXPECT_EQ(string(8191,' '),data);
+    EXPECT_TRUE(pack.find(46,data));
+    EXPECT_EQ(string("again"),data);
+  }
+  {
+    Cache::Pack pack;
+    ASSERT_TRUE(pack.open(compactFile));
+    EXPECT_TRUE(pack.find(43,data));
+    EXPECT_EQ(string("more"),data);
+    EXPECT_TRUE(pack.find(42,data));
+    EXPECT_TRUE(pack.find(45,data));
+    EXPECT_EQ(string(8191,' '),data);
+    EXPECT_TRUE(pack.find(46,data));
+  }
+
+  // A partly written record is skipped, and nothing more is appended
+
+  FILE *f = fopen(compactFile,"ab");
+  ASSERT_TRUE(f!=NULL);
+  fwrite("partial",7,1,f);
+  fclose(f);
+  {
+    Cache::Pack pack;
+    ASSERT_TRUE(pack.open(compactFile));
+    EXPECT_TRUE(pack.find(43,data));
+    EXPECT_FALSE(pack.append(44,"lost",4,false));
+  }
+
+  // Compacting in place drops it
+
+  ASSERT_TRUE(Cache::Pack::compact(compactFile,compactFile,false));
+  {
+    Cache::Pack pack;
+    ASSERT_TRUE(pack.open(compactFile));
+    EXPECT_TRUE(pack.find(43,data));
+    EXPECT_TRUE(pack.append(44,"kept",4,false));
+  }
+
+  remove(packFile);
+  remove(compactFile);
+}
+
+TEST( RegalCachePack, SharedAppend )
+{
+  remove(packFile);
+
+  // Two appenders to one new pack, as two processes sharing the
+  // cache directory: one header, and each finds its own records
+
+  string data;
+  {
+    Cache::Pack a, b;
+    ASSERT_TRUE(a.open(packFile));
+    ASSERT_TRUE(b.open(packFile));
+    EXPECT_TRUE(a.append(60,"sixty",5,false));
+    EXPECT_TRUE(b.append(61,"sixty-one",9,false));
+    EXPECT_TRUE(a.append(62,"sixty-two",9,false));
+    EXPECT_TRUE(a.find(60,data));
+    EXPECT_EQ(string("sixty"),data);
+    EXPECT_TRUE(a.find(62,data));
+    EXPECT_EQ(string("sixty-two"),data);
+    EXPECT_TRUE(b.find(61,data));
+    EXPECT_EQ(string("sixty-one"),data);
+  }
+  {
+    Cache::Pack pack;
+    ASSERT_TRUE(pack.open(packFile));
+    vector<GLuint64> hashes;
+    pack.hashes(hashes);
+    EXPECT_EQ(size_t(3),hashes.size());
+    EXPECT_TRUE(pack.find(61,data));
+    EXPECT_EQ(string("sixty-one"),data);
+  }
+
+  // A record that is no longer the one appended is a miss
+
+  {
+    Cache::Pack pack;
+    ASSERT_TRUE(pack.open(packFile));
+    EXPECT_TRUE(pack.append(63,"sixty-three",11,false));
+
+    FILE *f = fopen(packFile,"r+b");
+    ASSERT_TRUE(f!=NULL);
+    fseek(f,-16-long(sizeof(Cache::Pack::Record)),SEEK_END);   // 11 bytes, padded
+    fwrite("XXXX",4,1,f);
+    fclose(f);
+
+    EXPECT_FALSE(pack.find(63,data));
+    EXPECT_TRUE(pack.find(60,data));
+  }
+
+  remove(packFile);
+}
+
+} // namespace
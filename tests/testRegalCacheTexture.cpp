@@ -0,0 +1,256 @@
+/*
+  Copyright (c) 2011-2013 NVIDIA Corporation
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+    Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+  IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+  OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+  OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "gtest/gtest.h"
+
+#include "gmock/gmock.h"
+
+#include <GL/Regal.h>
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "RegalConfig.h"
+#include "RegalCacheTexture.h"
+#include "RegalDispatcherGL.h"
+#include "RegalDispatchGMock.h"
+
+namespace {
+
+using namespace Regal;
+using ::std::string;
+using ::std::vector;
+
+using ::testing::_;
+using ::testing::Mock;
+using ::testing::InSequence;
+using ::testing::StrictMock;
+using ::testing::SetArgPointee;
+
+const char *textureFile = "testRegalCacheTexture.rtex";
+
+Cache::Texture texture(const GLsizei width, const GLsizei height, const GLsizei levels)
+{
+  Cache::Texture tmp;
+  tmp.internalFormat = GL_RGBA8;
+  tmp.format         = GL_RGBA;
+  tmp.type           = GL_UNSIGNED_BYTE;
+  for (GLsizei i=0; i<levels; ++i)
+  {
+    Cache::Texture::Level l;
+    l.level  = i;
+    l.width  = width>>i;
+    l.height = height>>i;
+    l.border = 0;
+    for (GLsizei j=0; j<l.width*l.height*4; ++j)
+      l.data += char(j%7 ? 0x80 : j);
+    tmp.levels.push_back(l);
+  }
+  return tmp;
+}
+
+// ====================================
+// Regal::Cache texture containers
+// ====================================
+
+TEST( RegalCacheTexture, Container )
+{
+  const Cache::TextureCompression compression[3] = { Cache::TEXTURE_RAW, Cache::TEXTURE_SNAPPY, Cache::TEXTURE_ZLIB };
+
+  const Cache::Texture t = texture(32,16,3);
+  for (size_t i=0; i<3; ++i)
+  {
+    remove(textureFile);
+
+    Cache::Texture r;
+    EXPECT_FALSE(Cache::readTexture(textureFile,r));
+    ASSERT_TRUE(Cache::writeTexture(textureFile,t,compression[i]));
+    ASSERT_TRUE(Cache::readTexture(textureFile,r));
+
+    EXPECT_EQ(t.internalFormat,r.internalFormat);
+    EXPECT_EQ(t.format,r.format);
+    EXPECT_EQ(t.type,r.type);
+    ASSERT_EQ(t.levels.size(),r.levels.size());
+    for (size_t j=0; j<t.levels.size(); ++j)
+    {
+      EXPECT_EQ(t.levels[j].level, r.levels[j].level);
+      EXPECT_EQ(t.levels[j].width, r.levels[j].width);
+      EXPECT_EQ(t.levels[j].height,r.levels[j].height);
+      EXPECT_EQ(t.levels[j].data,  r.levels[j].data);
+    }
+  }
+
+  // A truncated container is rejected
+
+  FILE *f = fopen(textureFile,"r+b");
+  ASSERT_TRUE(f!=NULL);
+  fseek(f,0,SEEK_END);
+  const long size = ftell(f);
+  fclose(f);
+
+  string data(size_t(size-1),'\0');
+  f = fopen(textureFile,"rb");
+  ASSERT_EQ(1u,fread(&data[0],data.size(),1,f));
+  fclose(f);
+  f = fopen(textureFile,"wb");
+  fwrite(data.data(),data.size(),1,f);
+  fclose(f);
+
+  Cache::Texture r;
+  EXPECT_FALSE(Cache::readTexture(textureFile,r));
+
+  remove(textureFile);
+}
+
+// ====================================
+// Regal::Cache::texImage2D
+// ====================================
+
+#if REGAL_CACHE && REGAL_CACHE_TEXTURE
+
+// Pixels passed to the driver, compared by content
+
+MATCHER_P(Pixels, data, "")
+{
+  return arg && !std::memcmp(arg,data.data(),data.size());
+}
+
+void expectUnpackState(RegalGMockInterface &mock, const GLint alignment)
+{
+  EXPECT_CALL(mock, glGetIntegerv(GL_PIXEL_UNPACK_BUFFER_BINDING,_)).WillOnce(SetArgPointee<1>(0));
+  EXPECT_CALL(mock, glGetIntegerv(GL_UNPACK_ALIGNMENT,_)).WillOnce(SetArgPointee<1>(alignment));
+  EXPECT_CALL(mock, glGetIntegerv(GL_UNPACK_ROW_LENGTH,_)).WillOnce(SetArgPointee<1>(0));
+  EXPECT_CALL(mock, glGetIntegerv(GL_UNPACK_SKIP_ROWS,_)).WillOnce(SetArgPointee<1>(0));
+  EXPECT_CALL(mock, glGetIntegerv(GL_UNPACK_SKIP_PIXELS,_)).WillOnce(SetArgPointee<1>(0));
+}
+
+void expectPixelStore(RegalGMockInterface &mock, const GLint alignment)
+{
+  EXPECT_CALL(mock, glPixelStorei(GL_UNPACK_ALIGNMENT,alignment));
+  EXPECT_CALL(mock, glPixelStorei(GL_UNPACK_ROW_LENGTH,0));
+  EXPECT_CALL(mock, glPixelStorei(GL_UNPACK_SKIP_ROWS,0));
+  EXPECT_CALL(mock, glPixelStorei(GL_UNPACK_SKIP_PIXELS,0));
+}
+
+TEST( RegalCacheTexture, TexImage2D )
+{
+  const bool                saveCache     = Config::cache;
+  const bool                saveTexture   = Config::cacheTexture;
+  const bool                saveWrite     = Config::cacheTextureWrite;
+  const bool                saveRead      = Config::cacheTextureRead;
+  const bool                saveAsync     = Config::cacheTextureAsync;
+  const ::std::string       saveDirectory = Config::cacheDirectory;
+
+  Config::cache             = true;
+  Config::cacheTexture      = true;
+  Config::cacheTextureWrite = true;
+  Config::cacheTextureRead  = false;
+  Config::cacheTextureAsync = true;
+  Config::cacheDirectory    = "./";
+
+  StrictMock<RegalGMockInterface> mock;
+
+  DispatchTableGL tbl;
+  Missing::Init(tbl);
+  InitDispatchTableGMock(tbl);
+
+  // 3x2 RGBA image, rows padded to 16 bytes
+
+  const Cache::Texture t = texture(3,2,1);
+  string padded;
+  for (int y=0; y<2; ++y)
+  {
+    padded += t.levels[0].data.substr(y*12,12);
+    padded += string(4,'\xff');
+  }
+
+  const string filename = Cache::textureFilename(Cache::textureHash(t));
+  remove(filename.c_str());
+
+  // Written in the background on first upload, which passes through
+
+  {
+    InSequence seq;
+    expectUnpackState(mock,16);
+    EXPECT_CALL(mock, glTexImage2D(GL_TEXTURE_2D,0,GL_RGBA8,3,2,0,GL_RGBA,GL_UNSIGNED_BYTE,padded.data()));
+  }
+  Cache::texImage2D(tbl.glTexImage2D,tbl.glGetIntegerv,tbl.glPixelStorei,true,GL_TEXTURE_2D,0,GL_RGBA8,3,2,0,GL_RGBA,GL_UNSIGNED_BYTE,padded.data());
+  Cache::flushTextures();
+  Mock::VerifyAndClearExpectations(&mock);
+
+  Cache::Texture r;
+  ASSERT_TRUE(Cache::readTexture(filename,r));
+  EXPECT_EQ(t.levels[0].data,r.levels[0].data);
+
+  // Replaced with a pre-baked mip chain, which is uploaded
+  // tightly packed from the level the application asked for
+
+  Config::cacheTextureWrite = false;
+  Config::cacheTextureRead  = true;
+
+  Cache::Texture baked = texture(4,4,3);
+  baked.internalFormat = GL_SRGB8_ALPHA8;
+  ASSERT_TRUE(Cache::writeTexture(filename,baked,Cache::TEXTURE_SNAPPY));
+
+  {
+    InSequence seq;
+    expectUnpackState(mock,16);
+    expectPixelStore(mock,1);
+    for (GLint i=0; i<3; ++i)
+      EXPECT_CALL(mock, glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X,i+1,GL_SRGB8_ALPHA8,4>>i,4>>i,0,GL_RGBA,GL_UNSIGNED_BYTE,Pixels(baked.levels[i].data)));
+    expectPixelStore(mock,16);
+  }
+  Cache::texImage2D(tbl.glTexImage2D,tbl.glGetIntegerv,tbl.glPixelStorei,true,GL_TEXTURE_CUBE_MAP_POSITIVE_X,1,GL_RGBA8,3,2,0,GL_RGBA,GL_UNSIGNED_BYTE,padded.data());
+  Mock::VerifyAndClearExpectations(&mock);
+
+  // Anything else passes through untouched
+
+  string other(padded);
+  other[0] ^= 1;
+
+  {
+    InSequence seq;
+    expectUnpackState(mock,16);
+    EXPECT_CALL(mock, glTexImage2D(GL_TEXTURE_2D,0,GL_RGBA8,3,2,0,GL_RGBA,GL_UNSIGNED_BYTE,other.data()));
+  }
+  Cache::texImage2D(tbl.glTexImage2D,tbl.glGetIntegerv,tbl.glPixelStorei,true,GL_TEXTURE_2D,0,GL_RGBA8,3,2,0,GL_RGBA,GL_UNSIGNED_BYTE,other.data());
+  Mock::VerifyAndClearExpectations(&mock);
+
+  remove(filename.c_str());
+
+  Config::cache             = saveCache;
+  Config::cacheTexture      = saveTexture;
+  Config::cacheTextureWrite = saveWrite;
+  Config::cacheTextureRead  = saveRead;
+  Config::cacheTextureAsync = saveAsync;
+  Config::cacheDirectory    = saveDirectory;
+}
+
+#endif
+
+}
@@ -0,0 +1,172 @@
+/*
+  Copyright (c) 2011-2013 NVIDIA Corporation
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+    Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+  IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+  OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+  OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+
+
+#include "gtest/gtest.h"
+
+#include <GL/Regal.h>
+
+#include <string>
+#include <cstddef>
+
+#include <boost/print/json.hpp>
+
+#include "RegalCallTiming.h"
+#include "RegalDispatch.h"
+
+namespace REGAL_NAMESPACE_INTERNAL { namespace Json { struct Output : public ::boost::print::json::output<std::string> {}; } }
+
+using namespace std;
+using namespace ::REGAL_NAMESPACE_INTERNAL;
+
+namespace {
+
+#if REGAL_STATISTICS
+
+const size_t drawArrays = offsetof(Dispatch::GL,glDrawArrays)/sizeof(void *);
+const size_t clear      = offsetof(Dispatch::GL,glClear)/sizeof(void *);
+
+// ====================================
+// Histogram
+// ====================================
+
+TEST( RegalCallTiming, HistogramBuckets )
+{
+  for (GLuint64 v=0; v<(GLuint64(1)<<20); v = v<64 ? v+1 : v+v/7)
+  {
+    const size_t b = Histogram::bucket(v);
+    ASSERT_LT( b, size_t(Histogram::BUCKETS) );
+    EXPECT_LE( Histogram::lower(b), v );
+    EXPECT_GE( Histogram::upper(b), v );
+  }
+
+  // Adjacent buckets cover the range without gaps
+
+  for (size_t b=1; b<Histogram::BUCKETS; ++b)
+    EXPECT_EQ( Histogram::upper(b-1)+1, Histogram::lower(b) );
+
+  // Anything longer ends up in the last bucket
+
+  EXPECT_EQ( size_t(Histogram::BUCKETS-1), Histogram::bucket(~GLuint64(0)) );
+}
+
+TEST( RegalCallTiming, HistogramPercentiles )
+{
+  Histogram h;
+  EXPECT_EQ( 0u, h.percentile(0.5) );
+
+  for (GLuint64 i=1; i<=1000; ++i)
+    h.add(i*1000);
+
+  EXPECT_EQ( 1000u,    h.samples );
+  EXPECT_EQ( 1000000u, h.maximum );
+  EXPECT_EQ( 500500000u, h.total );
+
+  const double   p[3]      = { 0.50, 0.90, 0.99 };
+  const GLuint64 expect[3] = { 500000, 900000, 990000 };
+  for (size_t i=0; i<3; ++i)
+  {
+    const GLuint64 v = h.percentile(p[i]);
+    EXPECT_GE( v, expect[i] );
+    EXPECT_LE( v, expect[i] + expect[i]/Histogram::SUB );
+  }
+
+  EXPECT_EQ( 1000000u, h.percentile(1.0) );
+
+  h.reset();
+  EXPECT_EQ( 0u, h.samples );
+  EXPECT_EQ( 0u, h.maximum );
+}
+
+// ====================================
+// CallTiming
+// ====================================
+
+TEST( RegalCallTiming, NestedCalls )
+{
+  CallTiming timing;
+
+  {
+    CallTiming::Call outer(&timing,drawArrays);
+    {
+      // Emulation calls back into the front of the stack
+      // and then into the driver
+
+      CallTiming::Call inner(&timing,clear);
+      EXPECT_EQ( 2u, timing.depth );
+      CallTiming::DriverCall driver(&timing,clear);
+    }
+    EXPECT_EQ( 1u, timing.depth );
+  }
+  EXPECT_EQ( 0u, timing.depth );
+
+  // Nothing is reported until the frame completes
+
+  Json::Output jo;
+  jo.object();
+    timing.writeJSON(jo);
+  jo.end();
+  EXPECT_EQ( string::npos, jo.str().find("glDrawArrays") );
+
+  timing.frame();
+
+  Json::Output jo2;
+  jo2.object();
+    timing.writeJSON(jo2);
+  jo2.end();
+  const string s = jo2.str();
+
+  // The nested glClear has only driver time, glDrawArrays only Regal time
+
+  const size_t c = s.find("\"glClear\"");
+  const size_t d = s.find("\"glDrawArrays\"");
+  ASSERT_NE( string::npos, c );
+  ASSERT_NE( string::npos, d );
+  ASSERT_LT( c, d );
+
+  const string clearJson = s.substr(c,d-c);
+  const string drawJson  = s.substr(d);
+  EXPECT_NE( string::npos, clearJson.find("\"driver\"") );
+  EXPECT_EQ( string::npos, clearJson.find("\"regal\"") );
+  EXPECT_NE( string::npos, drawJson.find("\"regal\"") );
+  EXPECT_EQ( string::npos, drawJson.find("\"driver\"") );
+
+  // The frame after is reported empty
+
+  timing.frame();
+
+  Json::Output jo3;
+  jo3.object();
+    timing.writeJSON(jo3);
+  jo3.end();
+  EXPECT_EQ( string::npos, jo3.str().find("glDrawArrays") );
+}
+
+#endif // REGAL_STATISTICS
+
+}
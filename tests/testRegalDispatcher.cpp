@@ -0,0 +1,262 @@
+/*
+  Copyright (c) 2011-2013 NVIDIA Corporation
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+    Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+  IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+  OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+  OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include "gtest/gtest.h"
+
+#include <GL/Regal.h>
+
+#include <cstdio>
+
+#include "RegalContext.h"
+#include "RegalConfig.h"
+#include "RegalDispatcherGL.h"
+#include "RegalLog.h"
+#include "RegalQuads.h"
+#include "RegalTimer.h"
+#include "RegalThread.h"
+
+namespace {
+
+using namespace Regal;
+
+// ====================================
+// Regal::DispatcherGL compiled table
+// ====================================
+
+void REGAL_CALL compiledClearColor(GLclampf, GLclampf, GLclampf, GLclampf) {}
+void REGAL_CALL compiledFlush() {}
+void REGAL_CALL compiledFlush2() {}
+
+TEST( RegalDispatcher, Compiled )
+{
+  RegalContext ctx;
+  DispatcherGL &dispatcher = ctx.dispatcher;
+
+  for (size_t i=0; i<dispatcher.size(); ++i)
+    dispatcher.disable(dispatcher[i]);
+
+  DispatchTableGL &driver = dispatcher.driver;
+  Missing::Init(driver);
+  driver.glClearColor = compiledClearColor;
+  driver.glFlush      = compiledFlush;
+  dispatcher.enable(driver);
+
+  // Entry points always start at the compiled table
+
+  EXPECT_EQ(&dispatcher.compiled, &dispatcher.front());
+
+  dispatcher.enable(dispatcher.compiled);
+  EXPECT_TRUE(dispatcher.compiled.glClearColor==compiledClearColor);
+  EXPECT_TRUE(dispatcher.compiled.glFlush==compiledFlush);
+  EXPECT_TRUE(dispatcher.front().call(&dispatcher.front().glFlush)==compiledFlush);
+
+  // Layers that override an entry take it over while enabled
+
+#if REGAL_REDUNDANT
+  dispatcher.enable(dispatcher.redundant);
+  EXPECT_TRUE(dispatcher.compiled.glClearColor==dispatcher.redundant.glClearColor);
+  EXPECT_TRUE(dispatcher.compiled.glFlush==compiledFlush);
+  dispatcher.disable(dispatcher.redundant);
+  EXPECT_TRUE(dispatcher.compiled.glClearColor==compiledClearColor);
+#endif
+
+  // Single entries follow the lazy loader
+
+  driver.glFlush = compiledFlush2;
+  EXPECT_TRUE(dispatcher.compiled.glFlush==compiledFlush);
+  dispatcher.update(driver,reinterpret_cast<void (**)()>(&driver.glFlush));
+  EXPECT_TRUE(dispatcher.compiled.glFlush==compiledFlush2);
+
+  // Missing entries fall through to the missing table
+
+#if REGAL_MISSING
+  dispatcher.enable(dispatcher.missing);
+  driver.glFlush = NULL;
+  dispatcher.update(driver,reinterpret_cast<void (**)()>(&driver.glFlush));
+  EXPECT_TRUE(dispatcher.compiled.glFlush==dispatcher.missing.glFlush);
+#endif
+
+  // Once disabled, the compiled table is stepped over
+
+  dispatcher.disable(dispatcher.compiled);
+  EXPECT_TRUE(dispatcher.front().call(&dispatcher.front().glClearColor)==compiledClearColor);
+}
+
+// ====================================
+// Regal::DispatcherGL emulation routing
+// ====================================
+
+#if REGAL_EMULATION && REGAL_EMU_QUADS
+
+TEST( RegalDispatcher, EmulationRoute )
+{
+  RegalContext ctx;
+  DispatcherGL &dispatcher = ctx.dispatcher;
+
+  for (size_t i=0; i<dispatcher.size(); ++i)
+    dispatcher.disable(dispatcher[i]);
+
+  DispatchTableGL &driver = dispatcher.driver;
+  Missing::Init(driver);
+  driver.glClearColor = compiledClearColor;
+  dispatcher.enable(driver);
+  dispatcher.enable(dispatcher.emulation);
+
+  // With no layers only the always-routed entries remain
+
+  InitDispatchTableEmuRoute(ctx,dispatcher.emulationRoute);
+  EXPECT_TRUE(dispatcher.emulationRoute.glClearColor==NULL);
+  EXPECT_TRUE(dispatcher.emulationRoute.glDrawArrays==NULL);
+  EXPECT_TRUE(dispatcher.emulationRoute.glEnable==dispatcher.emulation.glEnable);
+
+  // Quads acts on glDrawArrays, but not on glClearColor
+
+  ctx.quads.reset(new Emu::Quads());
+  InitDispatchTableEmuRoute(ctx,dispatcher.emulationRoute);
+  EXPECT_TRUE(dispatcher.emulationRoute.glClearColor==NULL);
+  EXPECT_TRUE(dispatcher.emulationRoute.glDrawArrays==dispatcher.emulation.glDrawArrays);
+
+  // Stepping down the stack reads the routed entries, calling
+  // the emulation table directly still reaches every entry
+
+  DispatchTableGL &front = dispatcher.front();
+  EXPECT_TRUE(front.call(&front.glClearColor)==dispatcher.emulation.glClearColor);
+  dispatcher.setLookup(dispatcher.emulation,dispatcher.emulationRoute);
+  EXPECT_TRUE(front.call(&front.glClearColor)==compiledClearColor);
+  EXPECT_TRUE(front.call(&front.glDrawArrays)==dispatcher.emulation.glDrawArrays);
+  EXPECT_TRUE(dispatcher.emulation.call(&dispatcher.emulation.glClearColor)==dispatcher.emulation.glClearColor);
+
+  // ... and so does the compiled table
+
+  dispatcher.enable(dispatcher.compiled);
+  EXPECT_TRUE(dispatcher.compiled.glClearColor==compiledClearColor);
+  EXPECT_TRUE(dispatcher.compiled.glDrawArrays==dispatcher.emulation.glDrawArrays);
+
+  dispatcher.setLookup(dispatcher.emulation,dispatcher.emulation);
+  EXPECT_TRUE(dispatcher.compiled.glClearColor==dispatcher.emulation.glClearColor);
+}
+
+#endif
+
+// Calls per second for a few hundred entry points, directly to the
+// driver and through the Regal dispatch stack with the layers present
+// but disabled, stepping down the stack and with the compiled table,
+// then with the statistics and logging layers enabled.  Disabled by
+// default, run with --gtest_also_run_disabled_tests
+
+int benchmarkCount = 0;
+
+void REGAL_CALL benchmarkStub() { ++benchmarkCount; }
+
+typedef void (REGAL_CALL *BenchmarkFunc)();
+
+const size_t benchmarkEntries = 300;
+const int    benchmarkLoops   = 5000;
+
+Timer::Value benchmarkStack(DispatcherGL &dispatcher, const size_t step)
+{
+  Timer timer;
+  timer.restart();
+  for (int j=0; j<benchmarkLoops; ++j)
+    for (size_t i=0; i<benchmarkEntries; ++i)
+    {
+      DispatchTableGL &front = dispatcher.front();
+      front.call(reinterpret_cast<BenchmarkFunc *>(static_cast<Dispatch::GL *>(&front))+i*step)();
+    }
+  return timer.restart();
+}
+
+TEST( RegalDispatcher, DISABLED_Benchmark )
+{
+  RegalContext ctx;
+  DispatcherGL &dispatcher = ctx.dispatcher;
+
+  for (size_t i=0; i<dispatcher.size(); ++i)
+    dispatcher.disable(dispatcher[i]);
+
+  // Every driver entry is the same do-nothing function
+
+  const size_t slots = sizeof(Dispatch::GL)/sizeof(BenchmarkFunc);
+  BenchmarkFunc *driver = reinterpret_cast<BenchmarkFunc *>(static_cast<Dispatch::GL *>(&dispatcher.driver));
+  for (size_t i=0; i<slots; ++i)
+    driver[i] = benchmarkStub;
+  dispatcher.enable(dispatcher.driver);
+
+  const size_t step = slots/benchmarkEntries;
+  const double calls = double(benchmarkLoops)*benchmarkEntries;
+  int expected = 0;
+  Timer timer;
+
+  timer.restart();
+  for (int j=0; j<benchmarkLoops; ++j)
+    for (size_t i=0; i<benchmarkEntries; ++i)
+      driver[i*step]();
+  const Timer::Value direct = timer.restart();
+  expected += int(calls);
+
+  const Timer::Value stack = benchmarkStack(dispatcher,step);
+  expected += int(calls);
+
+  dispatcher.enable(dispatcher.compiled);
+  const Timer::Value compiled = benchmarkStack(dispatcher,step);
+  expected += int(calls);
+
+  std::printf("%u entry points, %u tables\n", unsigned(benchmarkEntries), unsigned(dispatcher.size()));
+  std::printf("Direct to driver:      %6.1f Mcalls/s\n", calls/(direct  +1));
+  std::printf("Regal dispatch stack:  %6.1f Mcalls/s\n", calls/(stack   +1));
+  std::printf("Regal compiled table:  %6.1f Mcalls/s\n", calls/(compiled+1));
+
+  // The layers look up the current context, driver log messages
+  // are left off so that only the layers themselves are measured
+
+  Thread::ThreadLocal &instance = Thread::ThreadLocal::instance();
+  RegalContext *oldContext = instance.currentContext;
+  instance.currentContext = &ctx;
+
+#if REGAL_STATISTICS
+  dispatcher.enable(dispatcher.statistics);
+  const Timer::Value statistics = benchmarkStack(dispatcher,step);
+  expected += int(calls);
+  std::printf("With statistics:       %6.1f Mcalls/s\n", calls/(statistics+1));
+#endif
+
+#if REGAL_LOG
+  const bool enableDriver = Logging::enableDriver;
+  Logging::enableDriver = false;
+  dispatcher.enable(dispatcher.logging);
+  const Timer::Value logging = benchmarkStack(dispatcher,step);
+  expected += int(calls);
+  Logging::enableDriver = enableDriver;
+  std::printf("With logging too:      %6.1f Mcalls/s\n", calls/(logging+1));
+#endif
+
+  instance.currentContext = oldContext;
+
+  EXPECT_EQ(expected, benchmarkCount);
+}
+
+} // namespace
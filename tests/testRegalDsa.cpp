@@ -0,0 +1,171 @@
+/*
+  Copyright (c) 2011-2013 NVIDIA Corporation
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+    Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+  IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+  OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+  OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <GL/Regal.h>
+
+#include <cstdio>
+
+#include "RegalContext.h"
+#include "RegalDsa.h"
+#include "RegalTimer.h"
+#include "RegalDispatch.h"
+#include "RegalDispatchGMock.h"
+
+namespace {
+
+using namespace Regal;
+using namespace Regal::Emu;
+
+using ::testing::Mock;
+using ::testing::InSequence;
+using ::testing::StrictMock;
+
+// ====================================
+// Regal::Emu::Dsa
+// ====================================
+
+TEST( RegalDsa, RestoreDirty )
+{
+  StrictMock<RegalGMockInterface> mock;
+
+  RegalContext ctx;
+  Missing::Init(ctx.dispatcher.emulation);
+  InitDispatchTableGMock(ctx.dispatcher.emulation);
+
+  Dsa dsa;
+  dsa.Init(ctx);
+
+  // Nothing modified, nothing restored
+
+  dsa.Restore(&ctx);
+  EXPECT_EQ(0u, dsa.dirty);
+
+  // Texture binding via DSA also switches to GL_TEXTURE0
+
+  EXPECT_CALL(mock, glActiveTexture(GL_TEXTURE0));
+  EXPECT_CALL(mock, glBindTexture(GL_TEXTURE_2D,1));
+  dsa.ShadowActiveTexture(GL_TEXTURE1);
+  dsa.DsaTexture(&ctx, GL_TEXTURE_2D, 1);
+  Mock::VerifyAndClearExpectations(&mock);
+  EXPECT_EQ(GLuint(REGAL_DSA_DIRTY_TEXTURE|REGAL_DSA_DIRTY_ACTIVE_TEXTURE), dsa.dirty);
+
+  {
+    InSequence seq;
+    EXPECT_CALL(mock, glBindTexture(GL_TEXTURE_2D,0));
+    EXPECT_CALL(mock, glActiveTexture(GL_TEXTURE1));
+  }
+  dsa.Restore(&ctx);
+  Mock::VerifyAndClearExpectations(&mock);
+  EXPECT_EQ(0u, dsa.dirty);
+  EXPECT_EQ(REGAL_DSA_INVALID, dsa.dsa.texture);
+  EXPECT_EQ(REGAL_DSA_INVALID, dsa.dsa.activeTexture);
+
+  // ASM program targets are tracked individually
+
+  EXPECT_CALL(mock, glBindProgramARB(GL_FRAGMENT_PROGRAM_ARB,3));
+  EXPECT_CALL(mock, glBindProgramARB(GL_TESS_EVALUATION_PROGRAM_NV,4));
+  dsa.DsaAsmProgram(&ctx, GL_FRAGMENT_PROGRAM_ARB, 3);
+  dsa.DsaAsmProgram(&ctx, GL_TESS_EVALUATION_PROGRAM_NV, 4);
+  Mock::VerifyAndClearExpectations(&mock);
+  EXPECT_EQ(GLuint(REGAL_DSA_DIRTY_ASM_PROGRAM(1)|REGAL_DSA_DIRTY_ASM_PROGRAM(4)), dsa.dirty);
+
+  EXPECT_CALL(mock, glBindProgramARB(GL_FRAGMENT_PROGRAM_ARB,0));
+  EXPECT_CALL(mock, glBindProgramARB(GL_TESS_EVALUATION_PROGRAM_NV,0));
+  dsa.Restore(&ctx);
+  Mock::VerifyAndClearExpectations(&mock);
+  EXPECT_EQ(0u, dsa.dirty);
+
+  // Renderbuffer bindings are not restored ahead of draws
+
+  EXPECT_CALL(mock, glBindRenderbuffer(GL_RENDERBUFFER,5));
+  dsa.DsaRenderbuffer(&ctx, GL_RENDERBUFFER, 5);
+  dsa.Restore(&ctx);
+  Mock::VerifyAndClearExpectations(&mock);
+  EXPECT_EQ(GLuint(REGAL_DSA_DIRTY_RENDERBUFFER), dsa.dirty);
+
+  EXPECT_CALL(mock, glBindRenderbuffer(GL_RENDERBUFFER,0));
+  dsa.RestoreRenderbuffer(&ctx);
+  Mock::VerifyAndClearExpectations(&mock);
+  EXPECT_EQ(0u, dsa.dirty);
+}
+
+// Driver calls issued by the benchmark, as cheap as possible so
+// that only the emulation is measured.
+
+void REGAL_CALL noopActiveTexture(GLenum)                 {}
+void REGAL_CALL noopBindTexture(GLenum, GLuint)           {}
+void REGAL_CALL noopDrawArrays(GLenum, GLint, GLsizei)    {}
+
+// CPU cost per draw, without DSA emulation, with DSA emulation
+// and no intervening DSA call, and with a DSA call per draw.
+// Disabled by default, run with --gtest_also_run_disabled_tests
+
+TEST( RegalDsa, DISABLED_RestoreBenchmark )
+{
+  RegalContext ctx;
+  DispatchTableGL &tbl = ctx.dispatcher.emulation;
+  Missing::Init(tbl);
+  tbl.glActiveTexture = noopActiveTexture;
+  tbl.glBindTexture   = noopBindTexture;
+  tbl.glDrawArrays    = noopDrawArrays;
+
+  Dsa dsa;
+  dsa.Init(ctx);
+
+  const int draws = 1000000;
+  Timer timer;
+
+  timer.restart();
+  for (int i = 0; i < draws; ++i)
+    tbl.glDrawArrays(GL_TRIANGLES, 0, 3);
+  const Timer::Value off = timer.restart();
+
+  for (int i = 0; i < draws; ++i)
+  {
+    dsa.Restore(&ctx);
+    tbl.glDrawArrays(GL_TRIANGLES, 0, 3);
+  }
+  const Timer::Value clean = timer.restart();
+
+  for (int i = 0; i < draws; ++i)
+  {
+    dsa.DsaTexture(&ctx, GL_TEXTURE_2D, 1);
+    dsa.Restore(&ctx);
+    tbl.glDrawArrays(GL_TRIANGLES, 0, 3);
+  }
+  const Timer::Value modified = timer.restart();
+
+  EXPECT_EQ(0u, dsa.dirty);
+
+  std::printf("DSA emulation off:              %6.2f ns/draw\n", off      * 1000.0 / draws);
+  std::printf("DSA emulation on, no DSA calls: %6.2f ns/draw\n", clean    * 1000.0 / draws);
+  std::printf("DSA emulation on, DsaTexture:   %6.2f ns/draw\n", modified * 1000.0 / draws);
+}
+
+}
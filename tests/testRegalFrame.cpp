@@ -0,0 +1,470 @@
+/*
+  Copyright (c) 2011-2013 NVIDIA Corporation
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+    Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+  IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+  OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+  OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "gtest/gtest.h"
+
+#include "gmock/gmock.h"
+
+#include <GL/Regal.h>
+
+#include <cstring>
+#include <string>
+
+#include "RegalContext.h"
+#include "RegalContextInfo.h"
+#include "RegalConfig.h"
+#include "RegalFrame.h"
+#include "RegalGpuTiming.h"
+#include "RegalWorkQueue.h"
+#include "RegalMutex.h"
+#include "RegalDispatch.h"
+#include "RegalDispatchGMock.h"
+
+namespace {
+
+using namespace Regal;
+
+using ::testing::_;
+using ::testing::Mock;
+using ::testing::Return;
+using ::testing::Pointee;
+using ::testing::InSequence;
+using ::testing::StrictMock;
+using ::testing::SetArgPointee;
+using ::testing::SetArrayArgument;
+
+// ====================================
+// Regal::Thread::WorkQueue
+// ====================================
+
+Thread::Mutex workMutex;
+int           workDone = 0;
+
+struct CountJob : public Thread::Job
+{
+  void run()
+  {
+    Thread::ScopedLock lock(&workMutex);
+    ++workDone;
+  }
+};
+
+TEST( RegalWorkQueue, Threads )
+{
+  workDone = 0;
+  {
+    Thread::WorkQueue queue(4);
+    for (int i=0; i<1000; ++i)
+      queue.push(new CountJob());
+    queue.wait();
+    EXPECT_EQ(1000, workDone);
+
+    // Jobs still queued are completed on destruction
+
+    for (int i=0; i<100; ++i)
+      queue.push(new CountJob());
+  }
+  EXPECT_EQ(1100, workDone);
+
+  // Without threads, jobs run immediately
+
+  Thread::WorkQueue inline_(0);
+  EXPECT_EQ(0u, inline_.threads());
+  inline_.push(new CountJob());
+  EXPECT_EQ(1101, workDone);
+}
+
+// Holds the only worker until the test releases the gate
+
+Thread::Mutex gateMutex;
+
+struct GateJob : public Thread::Job
+{
+  void run()
+  {
+    Thread::ScopedLock gate(&gateMutex);
+    Thread::ScopedLock lock(&workMutex);
+    ++workDone;
+  }
+};
+
+TEST( RegalWorkQueue, Depth )
+{
+  workDone = 0;
+  gateMutex.acquire();
+  {
+    Thread::WorkQueue queue(1,2);
+
+    // The third push waits for the worker to take the gate
+
+    queue.push(new GateJob());
+    queue.push(new CountJob());
+    queue.push(new CountJob());
+    EXPECT_EQ(queue.threads()>0, queue.full());
+
+    gateMutex.release();
+    queue.wait();
+    EXPECT_FALSE(queue.full());
+    EXPECT_EQ(3, workDone);
+  }
+}
+
+// Waits for each of a number of signals in turn
+
+struct WaitJob : public Thread::Job
+{
+  WaitJob(Thread::Event &e, const int n) : event(e), count(n) {}
+
+  void run()
+  {
+    for (int i=0; i<count; ++i)
+    {
+      event.wait();
+      Thread::ScopedLock lock(&workMutex);
+      ++workDone;
+    }
+  }
+
+  Thread::Event &event;
+  int            count;
+};
+
+TEST( RegalWorkQueue, Event )
+{
+  // A signal with nobody waiting is kept for the next wait
+
+  Thread::Event event;
+  event.signal();
+  event.wait();
+
+  workDone = 0;
+  {
+    Thread::WorkQueue queue(1);
+    queue.push(new WaitJob(event,3));
+    for (int i=1; i<=3; ++i)
+    {
+      event.signal();
+
+      // Spin until the waiter has taken this signal, or a
+      // second signal would be folded into the first
+
+      for (;;)
+      {
+        Thread::ScopedLock lock(&workMutex);
+        if (workDone==i || !queue.threads())
+          break;
+      }
+    }
+  }
+  EXPECT_EQ(3, workDone);
+}
+
+// ====================================
+// Regal::Frame
+// ====================================
+
+// Each frame is read into the next pixel pack buffer of the ring
+
+const GLint frameViewport[4] = { 0, 0, 4, 2 };
+GLbyte      framePixels[4*4*2];
+
+GLsync frameFence(const size_t i)
+{
+  return reinterpret_cast<GLsync>(i);
+}
+
+void expectViewport(RegalGMockInterface &mock)
+{
+  EXPECT_CALL(mock, glGetIntegerv(GL_VIEWPORT,_)).WillOnce(SetArrayArgument<1>(frameViewport,frameViewport+4));
+}
+
+void expectReadback(RegalGMockInterface &mock, const GLuint buffer, const GLsync fence, const bool first)
+{
+  EXPECT_CALL(mock, glGetIntegerv(GL_PIXEL_PACK_BUFFER_BINDING,_)).WillOnce(SetArgPointee<1>(0));
+  if (first)
+    EXPECT_CALL(mock, glGenBuffers(1,_)).WillOnce(SetArgPointee<1>(buffer));
+  EXPECT_CALL(mock, glBindBuffer(GL_PIXEL_PACK_BUFFER,buffer));
+  if (first)
+    EXPECT_CALL(mock, glBufferData(GL_PIXEL_PACK_BUFFER,sizeof(framePixels),NULL,GL_STREAM_READ));
+  EXPECT_CALL(mock, glReadPixels(0,0,4,2,GL_RGBA,GL_UNSIGNED_BYTE,NULL));
+  EXPECT_CALL(mock, glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE,0)).WillOnce(Return(fence));
+  EXPECT_CALL(mock, glBindBuffer(GL_PIXEL_PACK_BUFFER,0));
+}
+
+void expectResolve(RegalGMockInterface &mock, const GLuint buffer, const GLsync fence)
+{
+  EXPECT_CALL(mock, glClientWaitSync(fence,GL_SYNC_FLUSH_COMMANDS_BIT,_)).WillOnce(Return(GL_ALREADY_SIGNALED));
+  EXPECT_CALL(mock, glDeleteSync(fence));
+  EXPECT_CALL(mock, glGetIntegerv(GL_PIXEL_PACK_BUFFER_BINDING,_)).WillOnce(SetArgPointee<1>(0));
+  EXPECT_CALL(mock, glBindBuffer(GL_PIXEL_PACK_BUFFER,buffer));
+  EXPECT_CALL(mock, glMapBufferRange(GL_PIXEL_PACK_BUFFER,0,sizeof(framePixels),GL_MAP_READ_BIT)).WillOnce(Return(framePixels));
+  EXPECT_CALL(mock, glUnmapBuffer(GL_PIXEL_PACK_BUFFER)).WillOnce(Return(GL_TRUE));
+  EXPECT_CALL(mock, glBindBuffer(GL_PIXEL_PACK_BUFFER,0));
+}
+
+TEST( RegalFrame, AsyncCapture )
+{
+  const bool oldMd5     = Config::frameMd5Color;
+  const bool oldAsync   = Config::frameAsync;
+  const int  oldLatency = Config::frameAsyncLatency;
+  const int  oldThreads = Config::frameAsyncThreads;
+  Config::frameMd5Color     = true;
+  Config::frameAsync        = true;
+  Config::frameAsyncLatency = 2;
+  Config::frameAsyncThreads = 1;
+
+  RegalContext ctx;
+  ctx.info = new ContextInfo();
+  ctx.info->es2 = ctx.info->core = false;
+  ctx.info->gl_version_2_1 = ctx.info->gl_version_3_0 = ctx.info->gl_version_3_2 = true;
+
+  for (size_t i=0; i<ctx.dispatcher.size(); ++i)
+    ctx.dispatcher.disable(ctx.dispatcher[i]);
+
+  StrictMock<RegalGMockInterface> mock;
+
+  DispatchTableGL &driver = ctx.dispatcher.driver;
+  Missing::Init(driver);
+  InitDispatchTableGMock(driver);
+  ctx.dispatcher.enable(driver);
+
+  std::memset(framePixels, 0xff, sizeof(framePixels));
+
+  Frame frame;
+
+  // Nothing is mapped until the ring of buffers comes around
+
+  {
+    InSequence seq;
+    expectViewport(mock);
+    expectReadback(mock, 1, frameFence(1), true);
+    expectViewport(mock);
+    expectReadback(mock, 2, frameFence(2), true);
+  }
+  frame.glFinish(ctx);
+  frame.glFinish(ctx);
+  Mock::VerifyAndClearExpectations(&mock);
+
+  {
+    InSequence seq;
+    expectViewport(mock);
+    expectResolve(mock, 1, frameFence(1));
+    expectReadback(mock, 1, frameFence(3), false);
+  }
+  frame.glFinish(ctx);
+  Mock::VerifyAndClearExpectations(&mock);
+
+  // Cleanup resolves whatever is still pending, oldest first
+
+  {
+    InSequence seq;
+    expectResolve(mock, 2, frameFence(2));
+    expectResolve(mock, 1, frameFence(3));
+    EXPECT_CALL(mock, glDeleteBuffers(1,Pointee(1)));
+    EXPECT_CALL(mock, glDeleteBuffers(1,Pointee(2)));
+  }
+  frame.Cleanup(ctx);
+  Mock::VerifyAndClearExpectations(&mock);
+
+  // The caller's copy is left alone, masking happens on the workers
+
+  EXPECT_EQ(GLbyte(0xff), framePixels[0]);
+
+  Config::frameMd5Color     = oldMd5;
+  Config::frameAsync        = oldAsync;
+  Config::frameAsyncLatency = oldLatency;
+  Config::frameAsyncThreads = oldThreads;
+}
+
+// ====================================
+// Regal::GpuTiming
+// ====================================
+
+// Timestamp queries, each reading back as a microsecond per query name
+
+void expectQuery(RegalGMockInterface &mock, const GLuint id, const bool generated)
+{
+  if (generated)
+    EXPECT_CALL(mock, glGenQueries(1,_)).WillOnce(SetArgPointee<1>(id));
+  EXPECT_CALL(mock, glQueryCounter(id,GL_TIMESTAMP));
+}
+
+void expectAvailable(RegalGMockInterface &mock, const GLuint id, const bool available)
+{
+  EXPECT_CALL(mock, glGetQueryObjectuiv(id,GL_QUERY_RESULT_AVAILABLE,_)).WillOnce(SetArgPointee<2>(available ? GL_TRUE : GL_FALSE));
+}
+
+void expectResult(RegalGMockInterface &mock, const GLuint id)
+{
+  EXPECT_CALL(mock, glGetQueryObjectui64v(id,GL_QUERY_RESULT,_)).WillOnce(SetArgPointee<2>(GLuint64(id)*1000));
+}
+
+TEST( RegalFrame, GpuTimingQueries )
+{
+  const bool oldGpuTiming = Config::frameGpuTiming;
+  Config::frameGpuTiming = true;
+
+  RegalContext ctx;
+  ctx.info = new ContextInfo();
+  ctx.info->es2 = ctx.info->core = false;
+  ctx.info->gl_version_3_3 = true;
+
+  for (size_t i=0; i<ctx.dispatcher.size(); ++i)
+    ctx.dispatcher.disable(ctx.dispatcher[i]);
+
+  StrictMock<RegalGMockInterface> mock;
+
+  DispatchTableGL &driver = ctx.dispatcher.driver;
+  Missing::Init(driver);
+  InitDispatchTableGMock(driver);
+  ctx.dispatcher.enable(driver);
+
+  Frame frame;
+
+  // One query per frame and group boundary
+
+  {
+    InSequence seq;
+    EXPECT_CALL(mock, glGetInteger64v(GL_TIMESTAMP,_)).WillOnce(SetArgPointee<1>(0));
+    for (GLuint id=1; id<=5; ++id)
+      expectQuery(mock, id, true);
+  }
+  frame.glFinish(ctx);
+  frame.pushGroupMarker(ctx, "outer");
+  frame.pushGroupMarker(ctx, "inner");
+  frame.popGroupMarker(ctx);
+  frame.popGroupMarker(ctx);
+  Mock::VerifyAndClearExpectations(&mock);
+
+  // Results not yet available are left pending, without waiting
+
+  {
+    InSequence seq;
+    expectQuery(mock, 6, true);
+    expectAvailable(mock, 6, false);
+    expectQuery(mock, 7, true);
+  }
+  frame.glFinish(ctx);
+  Mock::VerifyAndClearExpectations(&mock);
+
+  // Once available, completed frames give their queries back
+
+  {
+    InSequence seq;
+    expectQuery(mock, 8, true);
+    expectAvailable(mock, 6, true);
+    expectResult(mock, 1);
+    expectResult(mock, 6);
+    expectResult(mock, 2);
+    expectResult(mock, 5);
+    expectResult(mock, 3);
+    expectResult(mock, 4);
+    expectAvailable(mock, 8, true);
+    expectResult(mock, 7);
+    expectResult(mock, 8);
+    expectQuery(mock, 8, false);
+  }
+  frame.glFinish(ctx);
+  Mock::VerifyAndClearExpectations(&mock);
+
+  // A group open across frames is split between them
+
+  {
+    InSequence seq;
+    expectQuery(mock, 7, false);
+    expectQuery(mock, 4, false);
+    expectAvailable(mock, 4, true);
+    expectResult(mock, 8);
+    expectResult(mock, 4);
+    expectResult(mock, 7);
+    expectQuery(mock, 7, false);
+    expectQuery(mock, 4, false);
+  }
+  frame.pushGroupMarker(ctx, "across");
+  frame.glFinish(ctx);
+  frame.popGroupMarker(ctx);
+  Mock::VerifyAndClearExpectations(&mock);
+
+  // Cleanup deletes every query, pending or not
+
+  EXPECT_CALL(mock, glDeleteQueries(8,_));
+  frame.Cleanup(ctx);
+  Mock::VerifyAndClearExpectations(&mock);
+
+  Config::frameGpuTiming = oldGpuTiming;
+}
+
+TEST( RegalFrame, GpuTimingTrace )
+{
+  GpuTiming timing;
+  timing.calibrate(1000000, 5000);
+  EXPECT_EQ(5000u, timing.traceTime(1000000));
+  EXPECT_EQ(5500u, timing.traceTime(1500000));
+  EXPECT_EQ(4000u, timing.traceTime(0));
+
+  GpuTiming::Queries q;
+  q.number = 3;
+  q.begin = q.end = 0;
+  GpuTiming::Region outer = { "outer", 1, 0, 0 };
+  GpuTiming::Region inner = { "inner", 2, 0, 0 };
+  q.regions.push_back(outer);
+  q.regions.push_back(inner);
+
+  const GpuTiming::Span frameSpan = { 1000000, 3000000 };
+  std::vector<GpuTiming::Span> regions;
+  const GpuTiming::Span outerSpan = { 1500000, 2500000 };
+  const GpuTiming::Span innerSpan = { 2000000, 2200000 };
+  regions.push_back(outerSpan);
+  regions.push_back(innerSpan);
+
+  const std::string first = timing.trace(q, frameSpan, regions);
+
+  // The GPU track is named once only
+
+  EXPECT_NE(std::string::npos, first.find("\"thread_name\""));
+  EXPECT_EQ(std::string::npos, timing.trace(q, frameSpan, regions).find("\"thread_name\""));
+
+  // Complete events for the frame and each group, in trace time
+
+  const size_t f = first.find("\"Frame 3\"");
+  const size_t o = first.find("\"outer\"");
+  const size_t i = first.find("\"inner\"");
+  ASSERT_NE(std::string::npos, f);
+  ASSERT_NE(std::string::npos, o);
+  ASSERT_NE(std::string::npos, i);
+  EXPECT_LT(f, o);
+  EXPECT_LT(o, i);
+
+  EXPECT_NE(std::string::npos, first.find("\"ts\" : 5000,"));
+  EXPECT_NE(std::string::npos, first.find("\"dur\" : 2000,"));
+  EXPECT_NE(std::string::npos, first.find("\"ts\" : 5500,"));
+  EXPECT_NE(std::string::npos, first.find("\"dur\" : 1000,"));
+  EXPECT_NE(std::string::npos, first.find("\"ts\" : 6000,"));
+  EXPECT_NE(std::string::npos, first.find("\"dur\" : 200,"));
+  EXPECT_NE(std::string::npos, first.find("\"ns\" : 200000"));
+}
+
+} // namespace
@@ -0,0 +1,327 @@
+/*
+  Copyright (c) 2011-2013 NVIDIA Corporation
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+    Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+  IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+  OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+  OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <GL/Regal.h>
+
+#include "RegalContext.h"
+#include "RegalContextInfo.h"
+#include "RegalEmuInfo.h"
+#include "RegalThread.h"
+#include "RegalIff.h"
+#include "RegalDispatch.h"
+#include "RegalDispatchGMock.h"
+#include "RegalDispatcherGL.h"
+
+namespace {
+
+using namespace Regal;
+
+using ::testing::Mock;
+using ::testing::InSequence;
+using ::testing::_;
+
+// ====================================
+// Regal::Emu::Iff
+// ====================================
+
+// glBegin/glEnd blocks in progress are set up directly rather than
+// through glBegin, to keep the fixed function program out of it.
+
+void startBlock(Emu::Iff &iff, GLenum mode, GLuint vertices)
+{
+  iff.immActive         = true;
+  iff.immPrim           = mode;
+  iff.immCurrent        = vertices;
+  iff.immCurrentElement = 0;
+}
+
+TEST( RegalIff, ImmediateBatch )
+{
+  RegalGMockInterface mock;
+
+  RegalContext ctx;
+  ctx.info = new ContextInfo();
+  ctx.info->core = ctx.info->es2 = false;
+  ctx.emuInfo = new EmuInfo();
+  ctx.emuInfo->init(*ctx.info.get());
+
+  DispatchTableGL &driver = ctx.dispatcher.driver;
+  Missing::Init(driver);
+  InitDispatchTableGMock(driver);
+  driver._enabled = true;
+  ctx.dispatcher.enable(ctx.dispatcher.emulation);
+
+  ctx.iff = new Emu::Iff;
+  Emu::Iff &iff = *ctx.iff;
+  iff.max_vertex_attribs = 1;
+  iff.immStride = sizeof(Float4);
+  iff.immBatch = true;
+  ctx.emuLevel = 7;
+
+  Thread::ThreadLocal &instance = Thread::ThreadLocal::instance();
+  RegalContext *oldContext = instance.currentContext;
+  instance.currentContext = &ctx;
+
+  DispatchTableGL &tbl = ctx.dispatcher.emulation;
+
+  // Consecutive blocks of the same primitive are drawn together
+
+  EXPECT_CALL(mock, glDrawArrays(_,_,_)).Times(0);
+  startBlock(iff, GL_TRIANGLES, 3);
+  tbl.glEnd();
+  EXPECT_TRUE(iff.immPending);
+  tbl.glBegin(GL_TRIANGLES);
+  iff.immCurrent += 3;
+  tbl.glEnd();
+  Mock::VerifyAndClearExpectations(&mock);
+
+  {
+    InSequence seq;
+    EXPECT_CALL(mock, glBufferData(GL_ARRAY_BUFFER,_,_,_));
+    EXPECT_CALL(mock, glDrawArrays(GL_TRIANGLES,0,6));
+    EXPECT_CALL(mock, glBindVertexArray(0));
+    EXPECT_CALL(mock, glBlendFunc(GL_ONE,GL_ONE));
+  }
+  tbl.glBlendFunc(GL_ONE,GL_ONE);
+  EXPECT_FALSE(iff.immPending);
+  EXPECT_FALSE(iff.immActive);
+  Mock::VerifyAndClearExpectations(&mock);
+
+  // A state change between two blocks splits the batch
+
+  {
+    InSequence seq;
+    EXPECT_CALL(mock, glBufferData(GL_ARRAY_BUFFER,_,_,_));
+    EXPECT_CALL(mock, glDrawArrays(GL_TRIANGLES,0,3));
+    EXPECT_CALL(mock, glBindVertexArray(0));
+    EXPECT_CALL(mock, glDeleteTextures(1,_));
+    EXPECT_CALL(mock, glBufferData(GL_ARRAY_BUFFER,_,_,_));
+    EXPECT_CALL(mock, glDrawArrays(GL_TRIANGLES,0,3));
+    EXPECT_CALL(mock, glBindVertexArray(0));
+    EXPECT_CALL(mock, glFlush());
+  }
+  const GLuint texture = 1;
+  startBlock(iff, GL_TRIANGLES, 3);
+  tbl.glEnd();
+  tbl.glDeleteTextures(1,&texture);
+  startBlock(iff, GL_TRIANGLES, 3);
+  tbl.glEnd();
+  tbl.glFlush();
+  Mock::VerifyAndClearExpectations(&mock);
+
+  // Pixel paths and texture readback see the batch drawn
+
+  {
+    InSequence seq;
+    EXPECT_CALL(mock, glDrawArrays(GL_QUADS,0,4));
+    EXPECT_CALL(mock, glDrawPixels(1,1,GL_RGBA,GL_UNSIGNED_BYTE,NULL));
+    EXPECT_CALL(mock, glDrawArrays(GL_QUADS,0,4));
+    EXPECT_CALL(mock, glGetTexImage(GL_TEXTURE_2D,0,GL_RGBA,GL_UNSIGNED_BYTE,NULL));
+  }
+  EXPECT_CALL(mock, glBufferData(GL_ARRAY_BUFFER,_,_,_)).Times(2);
+  EXPECT_CALL(mock, glBindVertexArray(0)).Times(2);
+  startBlock(iff, GL_QUADS, 4);
+  tbl.glEnd();
+  tbl.glDrawPixels(1,1,GL_RGBA,GL_UNSIGNED_BYTE,NULL);
+  startBlock(iff, GL_QUADS, 4);
+  tbl.glEnd();
+  tbl.glGetTexImage(GL_TEXTURE_2D,0,GL_RGBA,GL_UNSIGNED_BYTE,NULL);
+  Mock::VerifyAndClearExpectations(&mock);
+
+  // The vertex array binding is the application's, not the batch's
+
+  EXPECT_CALL(mock, glBufferData(GL_ARRAY_BUFFER,_,_,_));
+  EXPECT_CALL(mock, glDrawArrays(GL_POINTS,0,1));
+  EXPECT_CALL(mock, glBindVertexArray(0));
+  EXPECT_CALL(mock, glGetIntegerv(_,_)).Times(0);
+  startBlock(iff, GL_POINTS, 1);
+  tbl.glEnd();
+  GLint binding = -1;
+  tbl.glGetIntegerv(GL_VERTEX_ARRAY_BINDING,&binding);
+  EXPECT_EQ(0, binding);
+  Mock::VerifyAndClearExpectations(&mock);
+
+  // Material and light changes between glBegin and glEnd leave the
+  // block's vertex array bound, with or without batching.  A program
+  // pipeline keeps the fixed function program out of glEnd.
+
+  iff.programPipeline = 1;
+  for (int batch = 0; batch < 2; ++batch)
+  {
+    iff.immBatch = batch==1;
+    {
+      InSequence seq;
+      EXPECT_CALL(mock, glBufferData(GL_ARRAY_BUFFER,_,_,_));
+      EXPECT_CALL(mock, glDrawArrays(GL_TRIANGLES,0,3));
+      EXPECT_CALL(mock, glBindVertexArray(0));
+    }
+    startBlock(iff, GL_TRIANGLES, 3);
+    tbl.glMaterialf(GL_FRONT,GL_SHININESS,1.0f);
+    tbl.glLightf(GL_LIGHT0,GL_SPOT_EXPONENT,1.0f);
+    tbl.glColorMaterial(GL_FRONT,GL_DIFFUSE);
+    EXPECT_TRUE(iff.immActive);
+    EXPECT_TRUE(iff.immStateChanged);
+    tbl.glEnd();
+    EXPECT_FALSE(iff.immStateChanged);
+    tbl.glFlush();
+    EXPECT_FALSE(iff.immActive);
+    Mock::VerifyAndClearExpectations(&mock);
+  }
+
+  // Earlier blocks of the batch are drawn ahead of the change,
+  // the block in progress keeps its own vertices
+
+  {
+    InSequence seq;
+    EXPECT_CALL(mock, glBufferData(GL_ARRAY_BUFFER,6*sizeof(Float4),_,_));
+    EXPECT_CALL(mock, glDrawArrays(GL_TRIANGLES,0,6));
+    EXPECT_CALL(mock, glBufferData(GL_ARRAY_BUFFER,3*sizeof(Float4),_,_));
+    EXPECT_CALL(mock, glDrawArrays(GL_TRIANGLES,0,3));
+    EXPECT_CALL(mock, glBindVertexArray(0));
+  }
+  startBlock(iff, GL_TRIANGLES, 3);
+  tbl.glEnd();
+  tbl.glBegin(GL_TRIANGLES);
+  iff.immCurrent += 3;
+  tbl.glEnd();
+  tbl.glBegin(GL_TRIANGLES);
+  EXPECT_EQ(6u, iff.immBatchStart);
+  iff.immCurrent += 3;
+  tbl.glMaterialf(GL_FRONT,GL_SHININESS,2.0f);
+  EXPECT_EQ(0u, iff.immBatchStart);
+  EXPECT_EQ(3u, iff.immCurrent);
+  tbl.glEnd();
+  tbl.glFlush();
+  Mock::VerifyAndClearExpectations(&mock);
+  iff.programPipeline = 0;
+
+  // Swapping draws the batch without an extra glFlush
+
+  EXPECT_CALL(mock, glBufferData(GL_ARRAY_BUFFER,_,_,_));
+  EXPECT_CALL(mock, glDrawArrays(GL_LINES,0,2));
+  EXPECT_CALL(mock, glBindVertexArray(0));
+  EXPECT_CALL(mock, glFlush()).Times(0);
+  startBlock(iff, GL_LINES, 2);
+  tbl.glEnd();
+  ctx.emuLevel = 16;
+  iff.immLevel = 6;
+  iff.SwapBuffers(&ctx);
+  EXPECT_FALSE(iff.immPending);
+  EXPECT_EQ(16, ctx.emuLevel);
+  Mock::VerifyAndClearExpectations(&mock);
+
+  instance.currentContext = oldContext;
+}
+
+TEST( RegalIff, UniformBufferBinding )
+{
+  RegalGMockInterface mock;
+
+  RegalContext ctx;
+  ctx.info = new ContextInfo();
+  ctx.info->core = ctx.info->es2 = false;
+  ctx.emuInfo = new EmuInfo();
+  ctx.emuInfo->init(*ctx.info.get());
+
+  DispatchTableGL &driver = ctx.dispatcher.driver;
+  Missing::Init(driver);
+  InitDispatchTableGMock(driver);
+  driver._enabled = true;
+  ctx.dispatcher.enable(ctx.dispatcher.emulation);
+
+  ctx.iff = new Emu::Iff;
+  Emu::Iff &iff = *ctx.iff;
+  iff.uniformBuffer    = true;
+  iff.uniformMultiBind = false;
+  iff.uniformShadow.resize(16);
+  iff.uniformAlignment = 16;
+
+  GLubyte ring[64];
+  iff.uniformRing.buffer      = 9;
+  iff.uniformRing.size        = sizeof(ring);
+  iff.uniformRing.segmentSize = sizeof(ring);
+  iff.uniformRing.data        = ring;
+  iff.uniformRing.fences.assign(1,static_cast<GLsync>(NULL));
+  ctx.emuLevel = 7;
+
+  Thread::ThreadLocal &instance = Thread::ThreadLocal::instance();
+  RegalContext *oldContext = instance.currentContext;
+  instance.currentContext = &ctx;
+
+  DispatchTableGL &tbl = ctx.dispatcher.emulation;
+
+  // The generic binding is restored from the shadow, not queried.
+  // Iff updates the uniform buffer from below its own level.
+
+  EXPECT_CALL(mock, glBindBuffer(GL_UNIFORM_BUFFER,3));
+  tbl.glBindBuffer(GL_UNIFORM_BUFFER,3);
+  Mock::VerifyAndClearExpectations(&mock);
+
+  {
+    InSequence seq;
+    EXPECT_CALL(mock, glBindBufferRange(GL_UNIFORM_BUFFER,0,9,0,16));
+    EXPECT_CALL(mock, glBindBuffer(GL_UNIFORM_BUFFER,3));
+  }
+  EXPECT_CALL(mock, glGetIntegerv(_,_)).Times(0);
+  ctx.emuLevel = 6;
+  iff.UpdateUniformBuffer(&ctx);
+  ctx.emuLevel = 7;
+  Mock::VerifyAndClearExpectations(&mock);
+
+  // Indexed binds also set the generic binding
+
+  tbl.glBindBufferBase(GL_UNIFORM_BUFFER,1,4);
+  EXPECT_CALL(mock, glBindBufferRange(GL_UNIFORM_BUFFER,0,9,0,16));
+  EXPECT_CALL(mock, glBindBuffer(GL_UNIFORM_BUFFER,4));
+  ctx.emuLevel = 6;
+  iff.UpdateUniformBuffer(&ctx);
+  ctx.emuLevel = 7;
+  Mock::VerifyAndClearExpectations(&mock);
+
+  // Other targets and deleting other buffers leave it alone,
+  // deleting the bound buffer reverts it to zero
+
+  const GLuint buffers[2] = { 5, 4 };
+  EXPECT_CALL(mock, glBindBuffer(GL_ARRAY_BUFFER,5));
+  EXPECT_CALL(mock, glDeleteBuffers(1,_)).Times(2);
+  tbl.glBindBuffer(GL_ARRAY_BUFFER,5);
+  tbl.glDeleteBuffers(1,&buffers[0]);
+  EXPECT_EQ(4u, iff.shadowUniformBuffer);
+  tbl.glDeleteBuffers(1,&buffers[1]);
+  EXPECT_EQ(0u, iff.shadowUniformBuffer);
+  Mock::VerifyAndClearExpectations(&mock);
+
+  iff.uniformRing.buffer = 0;
+  iff.uniformRing.data   = NULL;
+  instance.currentContext = oldContext;
+}
+
+} // namespace
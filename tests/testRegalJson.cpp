@@ -159,6 +159,47 @@ TEST( RegalJson, Trace )
   EXPECT_EQ(state0,json());
 }
 
+TEST( RegalJson, Redundant )
+{
+  const string state0 = json();
+
+  const char *redundantTrue  = "{ \"regal\" : { \"config\" : { \"dispatch\" : { \"enable\" : { \"redundant\" : true } } } } }";
+  const char *redundantFalse = "{ \"regal\" : { \"config\" : { \"dispatch\" : { \"enable\" : { \"redundant\" : false } } } } }";
+
+  RegalConfigure(redundantTrue);
+  EXPECT_EQ(Config::enableRedundant,true);
+
+  RegalConfigure(redundantFalse);
+  EXPECT_EQ(Config::enableRedundant,false);
+
+  // Reset to state0
+
+  RegalConfigure(state0.c_str());
+  EXPECT_EQ(state0,json());
+}
+
+TEST( RegalJson, FrameAsync )
+{
+  const string state0 = json();
+
+  const char *asyncOn  = "{ \"regal\" : { \"config\" : { \"frame\" : { \"async\" : { \"enable\" : true, \"latency\" : 5, \"queue\" : 4, \"threads\" : 1 } } } } }";
+  const char *asyncOff = "{ \"regal\" : { \"config\" : { \"frame\" : { \"async\" : { \"enable\" : false } } } } }";
+
+  RegalConfigure(asyncOn);
+  EXPECT_EQ(Config::frameAsync,true);
+  EXPECT_EQ(Config::frameAsyncLatency,5);
+  EXPECT_EQ(Config::frameAsyncQueue,4);
+  EXPECT_EQ(Config::frameAsyncThreads,1);
+
+  RegalConfigure(asyncOff);
+  EXPECT_EQ(Config::frameAsync,false);
+
+  // Reset to state0
+
+  RegalConfigure(state0.c_str());
+  EXPECT_EQ(state0,json());
+}
+
 TEST( RegalJson, BaseVertex )
 {
   const string state0 = json();
@@ -178,4 +219,64 @@ TEST( RegalJson, BaseVertex )
   EXPECT_EQ(state0,json());
 }
 
+TEST( RegalJson, CacheProgram )
+{
+  const string state0 = json();
+
+  const char *programTrue  = "{ \"regal\" : { \"config\" : { \"cache\" : { \"program\" : true, \"programRead\" : true, \"programWrite\" : true } } } }";
+  const char *programFalse = "{ \"regal\" : { \"config\" : { \"cache\" : { \"program\" : false, \"programRead\" : false, \"programWrite\" : false } } } }";
+
+  RegalConfigure(programTrue);
+  EXPECT_EQ(Config::cacheProgram,true);
+  EXPECT_EQ(Config::cacheProgramRead,true);
+  EXPECT_EQ(Config::cacheProgramWrite,true);
+
+  RegalConfigure(programFalse);
+  EXPECT_EQ(Config::cacheProgram,false);
+  EXPECT_EQ(Config::cacheProgramRead,false);
+  EXPECT_EQ(Config::cacheProgramWrite,false);
+
+  // Reset to state0
+
+  RegalConfigure(state0.c_str());
+  EXPECT_EQ(state0,json());
+}
+
+TEST( RegalJson, Iff )
+{
+  const string state0 = json();
+
+  const char *iff = "{ \"regal\" : { \"config\" : { \"dispatch\" : { \"emulation\" : { \"iff\" : { \"programCacheSize\" : 64, \"asyncCompile\" : true, \"uniformBuffer\" : true, \"immediateStream\" : true, \"immediateBatch\" : true } } } } } }";
+
+  RegalConfigure(iff);
+  EXPECT_EQ(Config::iffProgramCacheSize,64);
+  EXPECT_EQ(Config::iffAsyncCompile,true);
+  EXPECT_EQ(Config::iffUniformBuffer,true);
+  EXPECT_EQ(Config::iffImmediateStream,true);
+  EXPECT_EQ(Config::iffImmediateBatch,true);
+  EXPECT_NE(string::npos,json().find("\"programCacheSize\""));
+
+  // Reset to state0
+
+  RegalConfigure(state0.c_str());
+  EXPECT_EQ(state0,json());
+}
+
+TEST( RegalJson, Vao )
+{
+  const string state0 = json();
+
+  const char *vao = "{ \"regal\" : { \"config\" : { \"dispatch\" : { \"emulation\" : { \"vao\" : { \"uploadCache\" : true, \"uploadCacheSize\" : 1048576 } } } } } }";
+
+  RegalConfigure(vao);
+  EXPECT_EQ(Config::vaoUploadCache,true);
+  EXPECT_EQ(Config::vaoUploadCacheSize,1048576);
+  EXPECT_NE(string::npos,json().find("\"uploadCacheSize\""));
+
+  // Reset to state0
+
+  RegalConfigure(state0.c_str());
+  EXPECT_EQ(state0,json());
+}
+
 }
@@ -0,0 +1,194 @@
+/*
+  Copyright (c) 2011-2013 NVIDIA Corporation
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+    Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+  IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+  OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+  OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "gtest/gtest.h"
+
+#include <GL/Regal.h>
+
+#include "RegalLogRing.h"
+#include "RegalWorkQueue.h"
+
+namespace {
+
+using namespace Regal;
+using namespace Regal::Logging;
+
+// ====================================
+// Regal::Logging::Ring
+// ====================================
+
+TEST( RegalLogRing, Basic )
+{
+  Ring ring(4);
+  EXPECT_EQ(4u, ring.capacity());
+  EXPECT_TRUE(ring.front()==NULL);
+
+  for (int i=0; i<4; ++i)
+  {
+    Record *r = ring.back();
+    ASSERT_TRUE(r!=NULL);
+    r->text = boost::print::print_string(i);
+    ring.push();
+  }
+  EXPECT_EQ(4u, ring.size());
+
+  // Full, so the next message is dropped
+
+  EXPECT_TRUE(ring.back()==NULL);
+  EXPECT_EQ(1u, ring.dropped);
+
+  for (int i=0; i<4; ++i)
+  {
+    Record *r = ring.front();
+    ASSERT_TRUE(r!=NULL);
+    EXPECT_EQ(boost::print::print_string(i), r->text);
+    ring.pop();
+  }
+  EXPECT_TRUE(ring.front()==NULL);
+  EXPECT_EQ(0u, ring.size());
+
+  // Records are reused once consumed
+
+  EXPECT_TRUE(ring.back()==&ring.records[0]);
+}
+
+struct Producer : public Thread::Job
+{
+  Producer(Ring &r, const std::size_t n) : ring(r), count(n) {}
+
+  void run()
+  {
+    for (std::size_t i=0; i<count; )
+    {
+      Record *r = ring.back();
+      if (r)
+      {
+        r->thread = i++;
+        ring.push();
+      }
+    }
+  }
+
+  Ring        &ring;
+  std::size_t  count;
+};
+
+TEST( RegalLogRing, Threads )
+{
+  const std::size_t n = 10000;
+
+  Ring ring(256);
+  Thread::WorkQueue queue(1);
+  if (!queue.threads())
+    return;
+
+  queue.push(new Producer(ring,n));
+
+  // Everything arrives, in order
+
+  for (std::size_t i=0; i<n; )
+  {
+    Record *r = ring.front();
+    if (r)
+    {
+      ASSERT_EQ(i++, r->thread);
+      ring.pop();
+    }
+  }
+
+  queue.wait();
+  EXPECT_TRUE(ring.front()==NULL);
+}
+
+// ====================================
+// Regal::Logging asynchronous output
+// ====================================
+
+struct Logger : public Thread::Job
+{
+  explicit Logger(const int t) : thread(t) {}
+
+  void run()
+  {
+    for (int i=0; i<100; ++i)
+      Output(LOG_INFO, __FILE__, __LINE__, "info    ", " | ", NULL, boost::print::print_string("thread ",thread," message ",i));
+  }
+
+  int thread;
+};
+
+TEST( RegalLog, Async )
+{
+  const std::string oldFilename = logFilename;
+  const bool        oldAsync    = async;
+  const std::size_t oldLimit    = bufferLimit;
+
+  logFilename  = std::string();
+  async        = true;
+  bufferLimit  = 1000;
+
+  Logging::Init();
+  createLocks();
+
+  {
+    Thread::WorkQueue queue(4);
+    for (int t=0; t<4; ++t)
+      queue.push(new Logger(t));
+  }
+
+  // The workers have exited, so their rings are freed once drained
+
+  flush();
+#if REGAL_LOG_ASYNC
+  ASSERT_TRUE(rings!=NULL);
+  EXPECT_EQ(0u, rings->size());
+#endif
+
+  // Every message reaches the HTTP log view, each thread in order
+
+  std::string text;
+  getLogMessagesHTML(text);
+
+  for (int t=0; t<4; ++t)
+  {
+    std::size_t last = 0;
+    for (int i=0; i<100; ++i)
+    {
+      const std::size_t pos = text.find(boost::print::print_string("thread ",t," message ",i,"\n"));
+      ASSERT_NE(std::string::npos, pos);
+      EXPECT_LE(last, pos);
+      last = pos;
+    }
+  }
+
+  Cleanup();
+
+  logFilename = oldFilename;
+  async       = oldAsync;
+  bufferLimit = oldLimit;
+}
+
+} // namespace
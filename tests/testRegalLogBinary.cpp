@@ -0,0 +1,167 @@
+/*
+  Copyright (c) 2011-2013 NVIDIA Corporation
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+    Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+  IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+  OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+  OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "gtest/gtest.h"
+
+#include <GL/Regal.h>
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "RegalLogBinary.h"
+#include "RegalWorkQueue.h"
+
+namespace {
+
+using namespace Regal;
+using namespace Regal::BinaryLog;
+
+const char *binaryFile = "testRegalLogBinary.bin";
+
+GLuint functionId(const char *name)
+{
+  for (GLuint i=0; i<functionCount; ++i)
+    if (!strcmp(functions[i].name,name))
+      return i;
+  return ~GLuint(0);
+}
+
+std::string decoded(const bool json)
+{
+  std::string text;
+  FILE *f = tmpfile();
+  if (!f)
+    return text;
+  if (decode(binaryFile,f,json))
+  {
+    rewind(f);
+    char buffer[4096];
+    for (size_t n; (n = fread(buffer,1,sizeof(buffer),f))>0; )
+      text.append(buffer,n);
+  }
+  fclose(f);
+  return text;
+}
+
+// ====================================
+// Regal::BinaryLog
+// ====================================
+
+TEST( RegalLogBinary, Decode )
+{
+  ASSERT_TRUE(Open(binaryFile));
+  EXPECT_TRUE(isOpen());
+
+  const GLuint bindTexture     = functionId("glBindTexture");
+  const GLuint uniformLocation = functionId("glGetUniformLocation");
+  const GLuint clearColor      = functionId("glClearColor");
+  const GLuint objectLabel     = functionId("glObjectLabel");
+  ASSERT_LT(bindTexture,     functionCount);
+  ASSERT_LT(uniformLocation, functionCount);
+  ASSERT_LT(clearColor,      functionCount);
+  ASSERT_LT(objectLabel,     functionCount);
+  EXPECT_STREQ("veu", functions[bindTexture].signature);
+  EXPECT_STREQ("ius", functions[uniformLocation].signature);
+
+  const GLuint64 bind[2] = { word(GLenum(GL_TEXTURE_2D)), word(GLuint(7)) };
+  call(bindTexture, bind, 2, NULL, NULL, 0);
+
+  const char    *name        = "color";
+  const GLuint64 location[3] = { word(GLuint(3)), word(name), word(GLint(-1)) };
+  call(uniformLocation, location, 3, &name, NULL, 1);
+
+  const GLuint64 clear[4] = { word(GLfloat(0.5f)), word(GLfloat(0.25f)), word(GLfloat(0.0f)), word(GLfloat(1.0f)) };
+  call(clearColor, clear, 4, NULL, NULL, 0);
+
+  // A counted string is copied up to its length, without a terminator
+
+  const char     buffer[8]  = { 'l', 'a', 'b', 'e', 'l', 'X', 'Y', 'Z' };
+  const char    *label      = buffer;
+  const GLint    length     = 5;
+  const GLuint64 object[4]  = { word(GLenum(GL_TEXTURE)), word(GLuint(7)), word(GLsizei(length)), word(label) };
+  call(objectLabel, object, 4, &label, &length, 1);
+
+  Close();
+  EXPECT_FALSE(isOpen());
+
+  EXPECT_EQ(
+    "driver   | glBindTexture(GL_TEXTURE_2D, 7)\n"
+    "driver   | glGetUniformLocation(3, \"color\") returned -1\n"
+    "driver   | glClearColor(0.5, 0.25, 0, 1)\n"
+    "driver   | glObjectLabel(GL_TEXTURE, 7, 5, \"label\")\n", decoded(false));
+
+  const std::string json = decoded(true);
+  EXPECT_EQ(0u, json.find("{ \"traceEvents\" : [\n"));
+  EXPECT_NE(std::string::npos, json.find("\"name\" : \"glBindTexture\""));
+  EXPECT_NE(std::string::npos, json.find("\"inputs\" : \"(GL_TEXTURE_2D, 7)\""));
+
+  remove(binaryFile);
+}
+
+struct Caller : public Thread::Job
+{
+  Caller(const GLuint i, const GLuint t) : id(i), texture(t) {}
+
+  void run()
+  {
+    for (GLuint i=0; i<120000; ++i)
+    {
+      const GLuint64 args[2] = { word(GLenum(GL_TEXTURE_2D)), word(texture) };
+      call(id, args, 2, NULL, NULL, 0);
+    }
+  }
+
+  GLuint id;
+  GLuint texture;
+};
+
+TEST( RegalLogBinary, Segments )
+{
+  ASSERT_TRUE(Open(binaryFile));
+
+  // Enough calls to spill over into a second segment
+
+  {
+    Thread::WorkQueue queue(4);
+    for (GLuint t=0; t<4; ++t)
+      queue.push(new Caller(functionId("glBindTexture"),t));
+  }
+
+  Close();
+
+  const std::string text = decoded(false);
+  size_t counts[4] = { 0, 0, 0, 0 };
+  for (size_t i = text.find("GL_TEXTURE_2D, "); i!=std::string::npos; i = text.find("GL_TEXTURE_2D, ",i+1))
+    ++counts[text[i+15]-'0'];
+
+  for (GLuint t=0; t<4; ++t)
+    EXPECT_EQ(120000u, counts[t]);
+
+  remove(binaryFile);
+}
+
+} // namespace
@@ -33,6 +33,8 @@
 
 #include <GL/Regal.h>
 
+#include <vector>
+
 #include <RegalPixelConversions.h>
 
 namespace {
@@ -346,6 +348,49 @@ TEST( RegalPixelConversions, PackUnpack1555 ) {
   EXPECT_EQ( 0xaau, packed[ 11 ] );
 }
 
+// Converts a long run of pixels through the registered conversion, which
+// uses the vector kernels where available, and compares against the byte at
+// a time scalar code. The odd count also exercises the scalar remainder.
+
+template <typename P>
+void CheckMatchesScalar( GLenum format, GLenum type ) {
+  IConversion* conversion = GetConversionInterface( format, type );
+  ASSERT_NE ( static_cast<IConversion*>( NULL ), conversion );
+
+  const size_t cnt = 65536 + 13;
+
+  std::vector<uint8_t> packed( cnt * P::PACKED_BYTES );
+  std::vector<uint32_t> unpacked( cnt );
+  uint32_t seed = 1;
+  for ( size_t i = 0; i < cnt; ++i ) {
+    seed = seed * 1664525u + 1013904223u;
+    unpacked[ i ] = seed;
+    for ( size_t j = 0; j < P::PACKED_BYTES; ++j ) {
+      packed[ i * P::PACKED_BYTES + j ] = static_cast<uint8_t>( ( i >> ( j * 8 ) ) ^ ( seed >> 24 ) );
+    }
+  }
+
+  std::vector<uint32_t> unpackedFast( cnt ), unpackedScalar( cnt );
+  conversion->Unpack32( &packed[ 0 ], &unpackedFast[ 0 ], cnt );
+  P::Unpack32( &packed[ 0 ], &unpackedScalar[ 0 ], cnt );
+  EXPECT_TRUE( unpackedFast == unpackedScalar );
+
+  std::vector<uint8_t> packedFast( cnt * P::PACKED_BYTES ), packedScalar( cnt * P::PACKED_BYTES );
+  conversion->Pack32( &unpacked[ 0 ], &packedFast[ 0 ], cnt );
+  P::Pack32( &unpacked[ 0 ], &packedScalar[ 0 ], cnt );
+  EXPECT_TRUE( packedFast == packedScalar );
+}
+
+TEST( RegalPixelConversions, SimdMatchesScalar ) {
+  CheckMatchesScalar< PixelAny<uint8_t,  1,   0xff,      0,      0,      0> >( GL_LUMINANCE, GL_UNSIGNED_BYTE );
+  CheckMatchesScalar< PixelAny<uint8_t,  1,      0,      0,      0,   0xff> >( GL_ALPHA, GL_UNSIGNED_BYTE );
+  CheckMatchesScalar< PixelAny<uint16_t, 2, 0x00ff,      0,      0, 0xff00> >( GL_LUMINANCE_ALPHA, GL_UNSIGNED_BYTE );
+  CheckMatchesScalar< PixelAny<uint16_t, 2, 0xf800, 0x07e0, 0x001f,      0> >( GL_RGB, GL_UNSIGNED_SHORT_5_6_5 );
+  CheckMatchesScalar< PixelAny<uint16_t, 2, 0xf000, 0x0f00, 0x00f0, 0x000f> >( GL_RGBA, GL_UNSIGNED_SHORT_4_4_4_4 );
+  CheckMatchesScalar< PixelAny<uint16_t, 2, 0xf800, 0x07c0, 0x003e, 0x0001> >( GL_RGBA, GL_UNSIGNED_SHORT_5_5_5_1 );
+  CheckMatchesScalar< PixelAny<uint24_t, 3, 0x0000ff, 0x00ff00, 0xff0000, 0> >( GL_RGB, GL_UNSIGNED_BYTE );
+}
+
 TEST( RegalPixelConversions, UnsupportedConversions ) {
   // Some conversions are just not supported.
 
@@ -49,7 +49,9 @@ using namespace ::Regal;
 
 using ::testing::Mock;
 using ::testing::_;
-using ::testing::AnyNumber;
+using ::testing::SetArgPointee;
+using ::testing::SetArrayArgument;
+using ::testing::StrictMock;
 
 TEST( RegalPpa, Enable )
 {
@@ -153,21 +155,21 @@ TEST( RegalPpa, PushPopAttrib )
   ppa.PopAttrib( &ctx );
   Mock::VerifyAndClear( &mock );
 
-  // Revisit - Emu::Ppa shouldn't make these calls if there
-  //           is no actual state change.
-  EXPECT_CALL( mock, glClearAccum(_,_,_,_) ).Times(AnyNumber());
-  EXPECT_CALL( mock, glClearDepth(_) ).Times(AnyNumber());
-  EXPECT_CALL( mock, glClearStencil(_) ).Times(AnyNumber());
-  EXPECT_CALL( mock, glCullFace(_) ).Times(AnyNumber());
-  EXPECT_CALL( mock, glDepthFunc(_) ).Times(AnyNumber());
-  EXPECT_CALL( mock, glDepthMask(_) ).Times(AnyNumber());
-  EXPECT_CALL( mock, glDisable(_) ).Times(AnyNumber());
-  EXPECT_CALL( mock, glFrontFace(_) ).Times(AnyNumber());
-  EXPECT_CALL( mock, glPolygonMode(_,_) ).Times(AnyNumber());
-  EXPECT_CALL( mock, glPolygonOffset(_,_) ).Times(AnyNumber());
-  EXPECT_CALL( mock, glStencilFuncSeparate(_,_,_,_) ).Times(AnyNumber());
-  EXPECT_CALL( mock, glStencilMaskSeparate(_,_) ).Times(AnyNumber());
-  EXPECT_CALL( mock, glStencilOpSeparate(_,_,_,_) ).Times(AnyNumber());
+  // Nothing changed since the push, so nothing is restored
+
+  EXPECT_CALL( mock, glClearAccum(_,_,_,_) ).Times(0);
+  EXPECT_CALL( mock, glClearDepth(_) ).Times(0);
+  EXPECT_CALL( mock, glClearStencil(_) ).Times(0);
+  EXPECT_CALL( mock, glCullFace(_) ).Times(0);
+  EXPECT_CALL( mock, glDepthFunc(_) ).Times(0);
+  EXPECT_CALL( mock, glDepthMask(_) ).Times(0);
+  EXPECT_CALL( mock, glDisable(_) ).Times(0);
+  EXPECT_CALL( mock, glFrontFace(_) ).Times(0);
+  EXPECT_CALL( mock, glPolygonMode(_,_) ).Times(0);
+  EXPECT_CALL( mock, glPolygonOffset(_,_) ).Times(0);
+  EXPECT_CALL( mock, glStencilFuncSeparate(_,_,_,_) ).Times(0);
+  EXPECT_CALL( mock, glStencilMaskSeparate(_,_) ).Times(0);
+  EXPECT_CALL( mock, glStencilOpSeparate(_,_,_,_) ).Times(0);
 
   EXPECT_EQ( 1u, ppa.depthStack.size() );
   EXPECT_EQ( 1u, ppa.stencilStack.size() );
@@ -271,11 +273,10 @@ TEST( RegalPpa, PushPopDepthBufferBit )
   EXPECT_EQ( static_cast<GLclampd>( 0.5 ), ppa.Ppa::Depth::clear );
 
   // pop attrib
-  EXPECT_CALL( mock, glEnable(_) ).Times(AnyNumber());
-  EXPECT_CALL( mock, glDisable(_) ).Times(AnyNumber());
-  EXPECT_CALL( mock, glDepthFunc(_) ).Times(AnyNumber());
-  EXPECT_CALL( mock, glClearDepth(_) ).Times(AnyNumber());
-  EXPECT_CALL( mock, glDepthMask(_) ).Times(AnyNumber());
+  EXPECT_CALL( mock, glEnable(GL_DEPTH_TEST) );
+  EXPECT_CALL( mock, glDepthFunc(GL_NEVER) );
+  EXPECT_CALL( mock, glClearDepth(0.0) );
+  EXPECT_CALL( mock, glDepthMask(GL_FALSE) );
   ppa.PopAttrib( &ctx );
   Mock::VerifyAndClear( &mock );
 
@@ -291,11 +292,10 @@ TEST( RegalPpa, PushPopDepthBufferBit )
   EXPECT_EQ( static_cast<GLclampd>( 0.0 ), ppa.Ppa::Depth::clear );
 
   // pop attrib
-  EXPECT_CALL( mock, glEnable(_) ).Times(AnyNumber());
-  EXPECT_CALL( mock, glDisable(_) ).Times(AnyNumber());
-  EXPECT_CALL( mock, glDepthFunc(_) ).Times(AnyNumber());
-  EXPECT_CALL( mock, glClearDepth(_) ).Times(AnyNumber());
-  EXPECT_CALL( mock, glDepthMask(_) ).Times(AnyNumber());
+  EXPECT_CALL( mock, glDisable(GL_DEPTH_TEST) );
+  EXPECT_CALL( mock, glDepthFunc(GL_LESS) );
+  EXPECT_CALL( mock, glClearDepth(1.0) );
+  EXPECT_CALL( mock, glDepthMask(GL_TRUE) );
   ppa.PopAttrib( &ctx );
   Mock::VerifyAndClear( &mock );
 
@@ -311,4 +311,89 @@ TEST( RegalPpa, PushPopDepthBufferBit )
   EXPECT_EQ( static_cast<GLclampd>( 1.0 ), ppa.Ppa::Depth::clear );
 }
 
+// State not shadowed by Ppa is queried from the driver, as zero.
+
+void expectZeroGets( RegalGMockInterface &mock )
+{
+  static const GLint   zeroi[4] = { 0, 0, 0, 0 };
+  static const GLfloat zerof[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+  EXPECT_CALL( mock, glGetIntegerv(_,_) ).WillRepeatedly( SetArgPointee<1>(0) );
+  EXPECT_CALL( mock, glGetFloatv(_,_) ).WillRepeatedly( SetArgPointee<1>(0.0f) );
+  EXPECT_CALL( mock, glGetIntegeri_v(_,_,_) ).WillRepeatedly( SetArrayArgument<2>(zeroi,zeroi+4) );
+  EXPECT_CALL( mock, glGetFloati_v(_,_,_) ).WillRepeatedly( SetArrayArgument<2>(zerof,zerof+4) );
+}
+
+TEST( RegalPpa, PopAttribDelta )
+{
+  StrictMock<RegalGMockInterface> mock;
+
+  RegalContext ctx;
+  ctx.info = new ContextInfo();
+  ctx.info->es2 = ctx.info->core = false;
+
+  ctx.emuInfo = new EmuInfo();
+  ctx.emuInfo->init(*ctx.info.get());
+  ctx.emuInfo->gl_max_attrib_stack_depth = 16;
+
+  Missing::Init( ctx.dispatcher.emulation );
+  InitDispatchTableGMock( ctx.dispatcher.emulation );
+
+  Emu::Ppa ppa;
+
+  // Setting the whole group issues every call
+
+  EXPECT_CALL( mock, glDepthFunc(GL_LESS) );
+  EXPECT_CALL( mock, glDisable(GL_DEPTH_TEST) );
+  EXPECT_CALL( mock, glDepthMask(GL_TRUE) );
+  EXPECT_CALL( mock, glClearDepth(1.0) );
+  ppa.State::Depth::set( ctx.dispatcher.emulation );
+  Mock::VerifyAndClearExpectations( &mock );
+
+  // No state change between push and pop, nothing to restore
+
+  // The current and texture groups are left to the driver
+
+  expectZeroGets( mock );
+  EXPECT_CALL( mock, glPushAttrib(GL_CURRENT_BIT|GL_TEXTURE_BIT) );
+  EXPECT_CALL( mock, glPopAttrib() );
+  ppa.PushAttrib( &ctx, GL_ALL_ATTRIB_BITS );
+  ppa.PopAttrib( &ctx );
+  Mock::VerifyAndClearExpectations( &mock );
+
+  // Only the state that changed is restored
+
+  expectZeroGets( mock );
+  EXPECT_CALL( mock, glPushAttrib(GL_CURRENT_BIT|GL_TEXTURE_BIT) );
+  EXPECT_CALL( mock, glPopAttrib() );
+  ppa.PushAttrib( &ctx, GL_ALL_ATTRIB_BITS );
+  ppa.glDepthFunc( GL_GREATER );
+  ppa.glLineWidth( 2.0f );
+  ppa.glFog( GL_FOG_DENSITY, 0.5f );
+  ppa.SetEnable( &ctx, GL_DEPTH_TEST, GL_TRUE );
+
+  EXPECT_CALL( mock, glDepthFunc(GL_LESS) );
+  EXPECT_CALL( mock, glLineWidth(1.0f) );
+  EXPECT_CALL( mock, glFogf(GL_FOG_DENSITY,1.0f) );
+  EXPECT_CALL( mock, glDisable(GL_DEPTH_TEST) );  // By GL_ENABLE_BIT only
+  ppa.PopAttrib( &ctx );
+  Mock::VerifyAndClearExpectations( &mock );
+
+  EXPECT_EQ( static_cast<GLenum>( GL_LESS ), ppa.State::Depth::func );
+  EXPECT_EQ( static_cast<GLboolean>( GL_FALSE ), ppa.State::Depth::enable );
+  EXPECT_EQ( static_cast<GLboolean>( GL_FALSE ), ppa.State::Enable::depthTest );
+  EXPECT_EQ( 1.0f, ppa.State::Line::width );
+  EXPECT_EQ( 1.0f, ppa.State::Fog::density );
+
+  // Without GL_ENABLE_BIT, GL_DEPTH_BUFFER_BIT restores the enable
+
+  ppa.PushAttrib( &ctx, GL_DEPTH_BUFFER_BIT );
+  ppa.SetEnable( &ctx, GL_DEPTH_TEST, GL_TRUE );
+
+  EXPECT_CALL( mock, glDisable(GL_DEPTH_TEST) );
+  ppa.PopAttrib( &ctx );
+  Mock::VerifyAndClearExpectations( &mock );
+
+  EXPECT_EQ( static_cast<GLboolean>( GL_FALSE ), ppa.State::Depth::enable );
+}
+
 } // namespace
@@ -0,0 +1,95 @@
+/*
+  Copyright (c) 2011-2013 NVIDIA Corporation
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+    Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+  IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+  OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+  OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "gtest/gtest.h"
+
+#include <GL/Regal.h>
+
+#include <vector>
+
+#include "RegalQuads.h"
+
+namespace {
+
+using namespace Regal;
+using namespace Regal::Emu;
+
+// ====================================
+// Regal::Emu::Quads
+// ====================================
+
+// Indices from zero, offset by a base vertex, match the
+// indices generated from the first vertex.
+
+TEST( RegalQuads, IndicesBaseVertex )
+{
+  for (int p = 0; p < Quads::IndexPatternCount; ++p)
+  {
+    const Quads::IndexPattern pattern = Quads::IndexPattern(p);
+
+    std::vector<GLuint> zero(5 * 8 + 2), offset(5 * 8 + 2);
+    const GLsizei c0 = Quads::Indices(pattern, &zero[0],   0,  5);
+    const GLsizei c1 = Quads::Indices(pattern, &offset[0], 10, 5);
+    ASSERT_EQ(c0, c1);
+    for (GLsizei i = 0; i < c0; ++i)
+      EXPECT_EQ(zero[i] + 10, offset[i]);
+  }
+}
+
+// A draw of n quads from indices generated for more quads
+// matches the indices generated for n quads.
+
+TEST( RegalQuads, IndicesCached )
+{
+  const GLsizei n = 3;
+  const GLsizei quads = 8;
+
+  for (int p = 0; p < Quads::IndexPatternCount; ++p)
+  {
+    const Quads::IndexPattern pattern = Quads::IndexPattern(p);
+
+    std::vector<GLuint> cached(quads * 8 + 2), exact(n * 8 + 2);
+    Quads::Indices(pattern, &cached[0], 0, quads);
+    const GLsizei c = Quads::Indices(pattern, &exact[0], 0, n);
+
+    if (pattern == Quads::QuadStripLineFlatFirst)
+    {
+      // The closing edge is the second edge of the next quad
+
+      for (GLsizei i = 0; i < n * 6; ++i)
+        EXPECT_EQ(exact[i], cached[i]);
+      EXPECT_EQ(exact[n * 6 + 0], cached[n * 6 + 2]);
+      EXPECT_EQ(exact[n * 6 + 1], cached[n * 6 + 3]);
+    }
+    else
+    {
+      for (GLsizei i = 0; i < c; ++i)
+        EXPECT_EQ(exact[i], cached[i]);
+    }
+  }
+}
+
+}
@@ -0,0 +1,189 @@
+/*
+  Copyright (c) 2011-2013 NVIDIA Corporation
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+    Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+  IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+  OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+  OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "gtest/gtest.h"
+
+#include "gmock/gmock.h"
+
+#include <GL/Regal.h>
+
+#include "RegalContext.h"
+#include "RegalConfig.h"
+#include "RegalThread.h"
+#include "RegalRedundant.h"
+#include "RegalStatistics.h"
+#include "RegalDispatcherGL.h"
+#include "RegalDispatchGMock.h"
+
+namespace {
+
+using namespace Regal;
+
+using ::testing::Mock;
+using ::testing::Pointee;
+using ::testing::StrictMock;
+
+// ====================================
+// Regal::Redundant
+// ====================================
+
+TEST( RegalRedundant, Shadow )
+{
+  Redundant r;
+
+  // Unknown state always passes through
+
+  EXPECT_FALSE(r.enable(GL_DEPTH_TEST,GL_TRUE));
+  EXPECT_TRUE (r.enable(GL_DEPTH_TEST,GL_TRUE));
+  EXPECT_FALSE(r.enable(GL_DEPTH_TEST,GL_FALSE));
+  EXPECT_TRUE (r.enable(GL_DEPTH_TEST,GL_FALSE));
+
+  // Per-unit and per-light capabilities are not shadowed
+
+  EXPECT_FALSE(r.enable(GL_TEXTURE_2D,GL_TRUE));
+  EXPECT_FALSE(r.enable(GL_TEXTURE_2D,GL_TRUE));
+
+  // Texture bindings are tracked per unit, once the unit is known
+
+  EXPECT_FALSE(r.bindTexture(GL_TEXTURE_2D,1));
+  EXPECT_FALSE(r.bindTexture(GL_TEXTURE_2D,1));
+  EXPECT_FALSE(r.activeTexture(GL_TEXTURE0));
+  EXPECT_FALSE(r.bindTexture(GL_TEXTURE_2D,1));
+  EXPECT_TRUE (r.bindTexture(GL_TEXTURE_2D,1));
+  EXPECT_FALSE(r.bindTexture(GL_TEXTURE_3D,1));
+  EXPECT_FALSE(r.activeTexture(GL_TEXTURE1));
+  EXPECT_FALSE(r.bindTexture(GL_TEXTURE_2D,1));
+  EXPECT_TRUE (r.activeTexture(GL_TEXTURE1));
+  EXPECT_FALSE(r.activeTexture(GL_TEXTURE0));
+  EXPECT_TRUE (r.bindTexture(GL_TEXTURE_2D,1));
+  r.invalidateTextures();
+  EXPECT_FALSE(r.bindTexture(GL_TEXTURE_2D,1));
+
+  // GL_FRAMEBUFFER binds both draw and read
+
+  EXPECT_FALSE(r.bindFramebuffer(GL_FRAMEBUFFER,2));
+  EXPECT_TRUE (r.bindFramebuffer(GL_DRAW_FRAMEBUFFER,2));
+  EXPECT_FALSE(r.bindFramebuffer(GL_READ_FRAMEBUFFER,3));
+  EXPECT_FALSE(r.bindFramebuffer(GL_FRAMEBUFFER,2));
+  EXPECT_TRUE (r.bindFramebuffer(GL_FRAMEBUFFER,2));
+
+  // The element array binding follows the vertex array object
+
+  EXPECT_FALSE(r.bindBuffer(GL_ELEMENT_ARRAY_BUFFER,4));
+  EXPECT_FALSE(r.bindBuffer(GL_ELEMENT_ARRAY_BUFFER,4));
+  EXPECT_FALSE(r.bindVertexArray(5));
+  EXPECT_FALSE(r.bindBuffer(GL_ELEMENT_ARRAY_BUFFER,4));
+  EXPECT_TRUE (r.bindBuffer(GL_ELEMENT_ARRAY_BUFFER,4));
+  EXPECT_FALSE(r.bindBuffer(GL_ARRAY_BUFFER,4));
+  EXPECT_TRUE (r.bindBuffer(GL_ARRAY_BUFFER,4));
+  EXPECT_FALSE(r.bindVertexArray(6));
+  EXPECT_TRUE (r.bindBuffer(GL_ARRAY_BUFFER,4));
+  EXPECT_FALSE(r.bindBuffer(GL_ELEMENT_ARRAY_BUFFER,4));
+
+  // Multi-valued state compares every component
+
+  EXPECT_FALSE(r.viewport(0,0,640,480));
+  EXPECT_TRUE (r.viewport(0,0,640,480));
+  EXPECT_FALSE(r.viewport(0,0,640,481));
+  EXPECT_FALSE(r.blendFunc(GL_ONE,GL_ZERO,GL_ONE,GL_ZERO));
+  EXPECT_TRUE (r.blendFunc(GL_ONE,GL_ZERO,GL_ONE,GL_ZERO));
+  EXPECT_FALSE(r.blendFunc(GL_ONE,GL_ZERO,GL_ONE,GL_ONE));
+
+  // Nothing is filtered, or shadowed, while compiling a display list
+
+  EXPECT_FALSE(r.useProgram(7));
+  EXPECT_TRUE (r.useProgram(7));
+  r.newList();
+  EXPECT_FALSE(r.useProgram(7));
+  EXPECT_FALSE(r.useProgram(7));
+  EXPECT_FALSE(r.enable(GL_DEPTH_TEST,GL_FALSE));
+  r.endList();
+  EXPECT_FALSE(r.useProgram(7));
+  EXPECT_TRUE (r.useProgram(7));
+}
+
+TEST( RegalRedundant, Dispatch )
+{
+  StrictMock<RegalGMockInterface> mock;
+
+  RegalContext ctx;
+  DispatchTableGL &driver = ctx.dispatcher.driver;
+  Missing::Init(driver);
+  InitDispatchTableGMock(driver);
+  driver._enabled = true;
+  ctx.dispatcher.enable(ctx.dispatcher.redundant);
+
+  Thread::ThreadLocal &instance = Thread::ThreadLocal::instance();
+  RegalContext *oldContext = instance.currentContext;
+  instance.currentContext = &ctx;
+
+  DispatchTableGL &tbl = ctx.dispatcher.redundant;
+
+  EXPECT_CALL(mock, glEnable(GL_DEPTH_TEST)).Times(1);
+  tbl.glEnable(GL_DEPTH_TEST);
+  tbl.glEnable(GL_DEPTH_TEST);
+  tbl.glEnable(GL_DEPTH_TEST);
+  Mock::VerifyAndClearExpectations(&mock);
+
+  EXPECT_CALL(mock, glUseProgram(3)).Times(1);
+  tbl.glUseProgram(3);
+  tbl.glUseProgram(3);
+  Mock::VerifyAndClearExpectations(&mock);
+
+  EXPECT_CALL(mock, glActiveTexture(GL_TEXTURE0)).Times(1);
+  EXPECT_CALL(mock, glBindTexture(GL_TEXTURE_2D,5)).Times(1);
+  tbl.glActiveTexture(GL_TEXTURE0);
+  tbl.glBindTexture(GL_TEXTURE_2D,5);
+  tbl.glBindTexture(GL_TEXTURE_2D,5);
+  Mock::VerifyAndClearExpectations(&mock);
+
+  // Deleting textures resets bindings to zero behind the shadow
+
+  const GLuint name = 5;
+  EXPECT_CALL(mock, glDeleteTextures(1,Pointee(5))).Times(1);
+  EXPECT_CALL(mock, glBindTexture(GL_TEXTURE_2D,5)).Times(1);
+  tbl.glDeleteTextures(1,&name);
+  tbl.glBindTexture(GL_TEXTURE_2D,5);
+  Mock::VerifyAndClearExpectations(&mock);
+
+  // glPopAttrib may restore anything
+
+  EXPECT_CALL(mock, glPopAttrib()).Times(1);
+  EXPECT_CALL(mock, glEnable(GL_DEPTH_TEST)).Times(1);
+  tbl.glPopAttrib();
+  tbl.glEnable(GL_DEPTH_TEST);
+  Mock::VerifyAndClearExpectations(&mock);
+
+#if REGAL_STATISTICS
+  EXPECT_EQ(2u, ctx.statistics->redundant_glEnable);
+  EXPECT_EQ(1u, ctx.statistics->redundant_glUseProgram);
+  EXPECT_EQ(1u, ctx.statistics->redundant_glBindTexture);
+#endif
+
+  instance.currentContext = oldContext;
+}
+
+} // namespace
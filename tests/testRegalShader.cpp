@@ -0,0 +1,96 @@
+/*
+  Copyright (c) 2011-2013 NVIDIA Corporation
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+    Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+  IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+  OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+  OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+
+#include "gtest/gtest.h"
+
+#include <GL/Regal.h>
+
+#include "RegalShader.h"
+
+namespace {
+
+using namespace Regal;
+
+// ====================================
+// Regal::Shader::OptimizeGLSL
+// ====================================
+
+#if REGAL_EMULATION && REGAL_GLSL_OPTIMIZER
+
+// Each variant of a shader goes through the optimizer once,
+// further requests are served from the process-wide cache.
+
+TEST( RegalShader, OptimizeCache )
+{
+  const string fragment =
+    "void main()\n"
+    "{\n"
+    "  gl_FragColor = vec4(1.0,0.5,0.25,0.125);\n"
+    "}\n";
+
+  size_t hits0, misses0;
+  Shader::OptimizeGLSLCounts(hits0,misses0);
+
+  string output1;
+  ASSERT_TRUE(Shader::OptimizeGLSL(false,GL_FRAGMENT_SHADER,fragment,output1,Emu::Iff::CF_Less));
+  EXPECT_NE(string::npos,output1.find("rglAlphaRef"));
+
+  string output2;
+  ASSERT_TRUE(Shader::OptimizeGLSL(false,GL_FRAGMENT_SHADER,fragment,output2,Emu::Iff::CF_Less));
+  EXPECT_EQ(output1,output2);
+
+  size_t hits, misses;
+  Shader::OptimizeGLSLCounts(hits,misses);
+  EXPECT_EQ(hits0+1,hits);
+  EXPECT_EQ(misses0+1,misses);
+
+  // Another alpha function, or ES, is another variant
+
+  string output3;
+  ASSERT_TRUE(Shader::OptimizeGLSL(false,GL_FRAGMENT_SHADER,fragment,output3,Emu::Iff::CF_Greater));
+  string output4;
+  ASSERT_TRUE(Shader::OptimizeGLSL(true,GL_FRAGMENT_SHADER,"precision mediump float;\n"+fragment,output4,Emu::Iff::CF_Less));
+
+  Shader::OptimizeGLSLCounts(hits,misses);
+  EXPECT_EQ(hits0+1,hits);
+  EXPECT_EQ(misses0+3,misses);
+
+  // Failures are remembered too
+
+  string output5;
+  EXPECT_FALSE(Shader::OptimizeGLSL(false,GL_FRAGMENT_SHADER,"void main() { undefined(); }\n",output5,Emu::Iff::CF_Less));
+  EXPECT_FALSE(Shader::OptimizeGLSL(false,GL_FRAGMENT_SHADER,"void main() { undefined(); }\n",output5,Emu::Iff::CF_Less));
+
+  Shader::OptimizeGLSLCounts(hits,misses);
+  EXPECT_EQ(hits0+2,hits);
+  EXPECT_EQ(misses0+4,misses);
+}
+
+#endif
+
+} // namespace
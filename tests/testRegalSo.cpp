@@ -0,0 +1,127 @@
+/*
+  Copyright (c) 2011-2013 NVIDIA Corporation
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+    Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+  IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+  OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+  OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <GL/Regal.h>
+
+#include "RegalContext.h"
+#include "RegalContextInfo.h"
+#include "RegalSo.h"
+#include "RegalDispatch.h"
+#include "RegalDispatchGMock.h"
+
+namespace {
+
+using namespace Regal;
+
+using ::testing::Mock;
+using ::testing::InSequence;
+using ::testing::_;
+
+// ====================================
+// Regal::Emu::So
+// ====================================
+
+TEST( RegalSo, DirtyUnits )
+{
+  RegalGMockInterface mock;
+
+  RegalContext ctx;
+  ctx.info = new ContextInfo();
+  ctx.info->es2 = false;
+
+  DispatchTableGL &tbl = ctx.dispatcher.emulation;
+  Missing::Init(tbl);
+  InitDispatchTableGMock(tbl);
+
+  Emu::So so;
+
+  {
+    InSequence seq;
+    EXPECT_CALL(mock, glBindTexture(GL_TEXTURE_2D,1));
+    EXPECT_CALL(mock, glActiveTexture(GL_TEXTURE1));
+    EXPECT_CALL(mock, glBindTexture(GL_TEXTURE_2D,2));
+    EXPECT_CALL(mock, glActiveTexture(GL_TEXTURE0));
+  }
+  so.BindTexture(ctx, 0, GL_TEXTURE_2D, 1);
+  so.BindTexture(ctx, 1, GL_TEXTURE_2D, 2);
+  Mock::VerifyAndClearExpectations(&mock);
+
+  GLuint sampler = 0;
+  so.GenSamplers(1, &sampler);
+  so.SamplerParameter(ctx, sampler, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+  so.BindSampler(0, sampler);
+  so.BindSampler(1, sampler);
+
+  // Dirty units are updated from the last unit down
+
+  {
+    InSequence seq;
+    EXPECT_CALL(mock, glActiveTexture(GL_TEXTURE1));
+    EXPECT_CALL(mock, glTexParameteri(GL_TEXTURE_2D,GL_TEXTURE_MIN_FILTER,GL_NEAREST));
+    EXPECT_CALL(mock, glActiveTexture(GL_TEXTURE0));
+    EXPECT_CALL(mock, glTexParameteri(GL_TEXTURE_2D,GL_TEXTURE_MIN_FILTER,GL_NEAREST));
+  }
+  so.PreDraw(ctx);
+  Mock::VerifyAndClearExpectations(&mock);
+
+  // Nothing is dirty
+
+  EXPECT_CALL(mock, glActiveTexture(_)).Times(0);
+  EXPECT_CALL(mock, glTexParameteri(_,_,_)).Times(0);
+  so.PreDraw(ctx);
+  Mock::VerifyAndClearExpectations(&mock);
+
+  // Unbinding the sampler from one unit leaves the other alone
+
+  so.BindSampler(1, 0);
+  {
+    InSequence seq;
+    EXPECT_CALL(mock, glActiveTexture(GL_TEXTURE1));
+    EXPECT_CALL(mock, glTexParameteri(GL_TEXTURE_2D,GL_TEXTURE_MIN_FILTER,GL_NEAREST_MIPMAP_LINEAR));
+    EXPECT_CALL(mock, glActiveTexture(GL_TEXTURE0));
+  }
+  so.PreDraw(ctx);
+  Mock::VerifyAndClearExpectations(&mock);
+
+  // Binding a texture to one unit leaves the other alone
+
+  {
+    InSequence seq;
+    EXPECT_CALL(mock, glBindTexture(GL_TEXTURE_2D,3));
+    EXPECT_CALL(mock, glTexParameteri(GL_TEXTURE_2D,GL_TEXTURE_MIN_FILTER,GL_NEAREST));
+  }
+  EXPECT_CALL(mock, glActiveTexture(_)).Times(0);
+  so.BindTexture(ctx, 0, GL_TEXTURE_2D, 3);
+  so.PreDraw(ctx);
+  Mock::VerifyAndClearExpectations(&mock);
+}
+
+} // namespace
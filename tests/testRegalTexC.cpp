@@ -33,11 +33,17 @@
 
 #include <GL/Regal.h>
 
+#include <cstring>
+#include <vector>
+
 #include "RegalTexC.h"
+#include "RegalPixelConversions.h"
 
 namespace {
 
 using namespace Regal::Emu;
+using Regal::IConversion;
+using Regal::GetConversionInterface;
 
 // ====================================
 // Emu::ConvertedBuffer
@@ -80,6 +86,60 @@ TEST( RegalTexC, RegalConvertedBuffer )
   EXPECT_EQ( 0x00u, converted[ 15 ] );
 }
 
+// Conversions to and from RGBA8888 skip the intermediate row, others go
+// through it a block at a time. Either way the result matches unpacking
+// and packing a whole row.
+
+TEST( RegalTexC, RegalConvertedBufferRows )
+{
+  PixelStorageStateGLES20 pss;
+  pss.Reset();
+
+  const GLsizei width = 301;
+  const GLsizei height = 3;
+
+  const GLenum formats[][2] = {
+    { GL_RGBA, GL_UNSIGNED_BYTE },
+    { GL_RGB,  GL_UNSIGNED_SHORT_5_6_5 },
+    { GL_RGBA, GL_UNSIGNED_SHORT_4_4_4_4 },
+    { GL_RGB,  GL_UNSIGNED_BYTE }
+  };
+
+  std::vector<uint8_t> orig( width * height * 4 + 4 );
+  for ( size_t i = 0; i < orig.size(); ++i ) {
+    orig[ i ] = static_cast<uint8_t>( i * 7 + ( i >> 8 ) );
+  }
+
+  for ( size_t s = 0; s < 4; ++s ) {
+    for ( size_t t = 0; t < 4; ++t ) {
+      if ( s == t ) {
+        continue;
+      }
+
+      IConversion* source = GetConversionInterface( formats[ s ][ 0 ], formats[ s ][ 1 ] );
+      IConversion* target = GetConversionInterface( formats[ t ][ 0 ], formats[ t ][ 1 ] );
+      ASSERT_TRUE( source != NULL );
+      ASSERT_TRUE( target != NULL );
+
+      ConvertedBuffer buffer( pss, formats[ t ][ 0 ], formats[ t ][ 1 ] );
+      ASSERT_TRUE( buffer.ConvertFrom ( width, height, formats[ s ][ 0 ], formats[ s ][ 1 ], &orig[ 0 ] ) );
+
+      const size_t sourceStride = ( width * source->GetPackedPixelByteSize() + 3 ) & ~3;
+      const size_t targetStride = ( width * target->GetPackedPixelByteSize() + 3 ) & ~3;
+      const size_t targetRow    = width * target->GetPackedPixelByteSize();
+
+      std::vector<uint32_t> row( width );
+      std::vector<uint8_t>  expected( targetStride );
+      const uint8_t* converted = static_cast<const uint8_t*>( buffer.Get() );
+      for ( GLsizei y = 0; y < height; ++y ) {
+        source->Unpack32( &orig[ y * sourceStride ], &row[ 0 ], width );
+        target->Pack32( &row[ 0 ], &expected[ 0 ], width );
+        EXPECT_EQ( 0, memcmp( &expected[ 0 ], converted + y * targetStride, targetRow ) );
+      }
+    }
+  }
+}
+
 TEST( RegalTexC, RegalConvertedBufferFailsFastOnIdentity )
 {
   PixelStorageStateGLES20 pss;
@@ -0,0 +1,247 @@
+/*
+  Copyright (c) 2011-2013 NVIDIA Corporation
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+    Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+  IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+  OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+  OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include "gtest/gtest.h"
+
+#include <GL/Regal.h>
+
+#include <cstdio>
+
+#include "RegalContext.h"
+#include "RegalInit.h"
+#include "RegalMutex.h"
+#include "RegalSnapshotMap.h"
+#include "RegalThread.h"
+#include "RegalTimer.h"
+#include "RegalWorkQueue.h"
+
+namespace {
+
+using namespace Regal;
+
+// ====================================
+// Regal::Thread::SnapshotMap
+// ====================================
+
+TEST( RegalSnapshotMap, Basic )
+{
+  Thread::SnapshotMap<int,int> map;
+  int value = 0;
+
+  EXPECT_FALSE(map.find(1,value));
+
+  map.insert(1,10);
+  map.insert(2,20);
+  EXPECT_TRUE(map.find(1,value));
+  EXPECT_EQ(10, value);
+  EXPECT_EQ(2u, map.snapshot().size());
+
+  EXPECT_EQ(0u, map.retired());
+
+  // Readers of an older snapshot are unaffected by updates,
+  // and it is kept until they are done
+
+  {
+    const Thread::SnapshotMap<int,int>::Reader before(map);
+    map.insert(1,11);
+    EXPECT_TRUE(map.erase(2));
+    EXPECT_FALSE(map.erase(2));
+    EXPECT_EQ(10, before->find(1)->second);
+    EXPECT_EQ(2u, before->size());
+    EXPECT_EQ(2u, map.retired());
+  }
+
+  EXPECT_TRUE(map.find(1,value));
+  EXPECT_EQ(11, value);
+  EXPECT_FALSE(map.find(2,value));
+  EXPECT_EQ(1u, map.snapshot().size());
+  EXPECT_EQ(2u, map.retired());
+
+  // The next update frees them
+
+  map.insert(3,30);
+  EXPECT_EQ(0u, map.retired());
+}
+
+// ====================================
+// Regal::Thread::ThreadLocal
+// ====================================
+
+Thread::ThreadLocal *otherInstance = NULL;
+
+struct InstanceJob : public Thread::Job
+{
+  void run() { otherInstance = &Thread::ThreadLocal::instance(); }
+};
+
+TEST( RegalThread, ThreadLocal )
+{
+  Thread::ThreadLocal &instance = Thread::ThreadLocal::instance();
+  EXPECT_EQ(&instance, &Thread::ThreadLocal::instance());
+
+#if !REGAL_NO_TLS && !REGAL_SYS_WGL
+  EXPECT_EQ(&instance, pthread_getspecific(Thread::ThreadLocal::_instanceKey));
+#endif
+
+  {
+    Thread::WorkQueue queue(1);
+    if (queue.threads())
+    {
+      queue.push(new InstanceJob());
+      queue.wait();
+      EXPECT_TRUE(otherInstance!=NULL);
+      EXPECT_TRUE(otherInstance!=&instance);
+    }
+  }
+}
+
+// ====================================
+// Cost of context lookup and dispatch
+// ====================================
+
+// ns per RegalMakeCurrent of the already-current context,
+// per RegalMakeCurrent alternating between two contexts, and
+// per dispatched GL call, for 1 to 32 threads each making its
+// own contexts current.  Timings are wall-clock per thread.
+
+const int benchmarkThreads = 32;
+const int benchmarkSame = 100000;
+const int benchmarkSwitch = 20000;
+const int benchmarkCalls = 200000;
+
+void REGAL_CALL benchmarkClearColor(GLclampf, GLclampf, GLclampf, GLclampf) {}
+
+inline RegalSystemContext benchmarkSysCtx(const int i)
+{
+  return reinterpret_cast<RegalSystemContext>(size_t(0x1000+i));
+}
+
+enum BenchmarkPhase { BENCHMARK_SAME, BENCHMARK_SWITCH, BENCHMARK_CALLS };
+
+Thread::Mutex benchmarkMutex;
+int           benchmarkFailed = 0;
+
+struct BenchmarkJob : public Thread::Job
+{
+  BenchmarkJob(const BenchmarkPhase p, const int t) : phase(p), index(t) {}
+
+  void run()
+  {
+    const RegalSystemContext a = benchmarkSysCtx(index*2);
+    const RegalSystemContext b = benchmarkSysCtx(index*2+1);
+
+    switch (phase)
+    {
+      case BENCHMARK_SAME:
+        for (int i=0; i<benchmarkSame; ++i)
+          RegalMakeCurrent(a);
+        break;
+
+      case BENCHMARK_SWITCH:
+        for (int i=0; i<benchmarkSwitch; ++i)
+          RegalMakeCurrent(i&1 ? a : b);
+        break;
+
+      case BENCHMARK_CALLS:
+        RegalMakeCurrent(a);
+        for (int i=0; i<benchmarkCalls; ++i)
+          glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+        break;
+    }
+
+    RegalContext *context = REGAL_GET_CONTEXT();
+    if (!context || context->sysCtx!=a)
+    {
+      Thread::ScopedLock lock(&benchmarkMutex);
+      ++benchmarkFailed;
+    }
+
+    RegalMakeCurrent(NULL);
+  }
+
+  BenchmarkPhase phase;
+  int            index;
+};
+
+Timer::Value benchmarkRun(const BenchmarkPhase phase, const int threads)
+{
+  Thread::WorkQueue queue(threads);
+  Timer timer;
+  timer.restart();
+  for (int t=0; t<threads; ++t)
+    queue.push(new BenchmarkJob(phase,t));
+  queue.wait();
+  return timer.elapsed();
+}
+
+// Disabled by default, run with --gtest_also_run_disabled_tests
+
+TEST( RegalThread, DISABLED_Benchmark )
+{
+  // Contexts are registered but never initialized,
+  // the GL calls go to a do-nothing driver.
+
+  for (int t=0; t<benchmarkThreads; ++t)
+    RegalShareContext(benchmarkSysCtx(t*2), benchmarkSysCtx(t*2+1));
+
+  for (size_t i=0; i<Init::getNumContexts(); ++i)
+  {
+    RegalContext *ctx = Init::getContextByIndex(i);
+    ASSERT_TRUE(ctx!=NULL);
+    ctx->initialized = true;
+    for (size_t j=0; j<ctx->dispatcher.size(); ++j)
+      ctx->dispatcher.disable(ctx->dispatcher[j]);
+    DispatchTableGL &driver = ctx->dispatcher.driver;
+    Missing::Init(driver);
+    driver.glClearColor = benchmarkClearColor;
+    ctx->dispatcher.enable(driver);
+  }
+
+  Thread::WorkQueue probe(1);
+  if (!probe.threads())
+    return;
+
+  std::printf("threads  makeCurrent same  makeCurrent switch  dispatch\n");
+  for (int threads=1; threads<=benchmarkThreads; threads*=2)
+  {
+    const Timer::Value same   = benchmarkRun(BENCHMARK_SAME,   threads);
+    const Timer::Value change = benchmarkRun(BENCHMARK_SWITCH, threads);
+    const Timer::Value calls  = benchmarkRun(BENCHMARK_CALLS,  threads);
+    std::printf("%7d  %11.2f ns  %13.2f ns  %5.2f ns\n", threads,
+      same   * 1000.0 / benchmarkSame,
+      change * 1000.0 / benchmarkSwitch,
+      calls  * 1000.0 / benchmarkCalls);
+  }
+
+  EXPECT_EQ(0, benchmarkFailed);
+
+  for (int t=0; t<benchmarkThreads*2; ++t)
+    RegalDestroyContext(benchmarkSysCtx(t));
+  EXPECT_EQ(0u, Init::getNumContexts());
+}
+
+} // namespace
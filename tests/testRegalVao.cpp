@@ -0,0 +1,301 @@
+/*
+  Copyright (c) 2011-2013 NVIDIA Corporation
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+    Redistributions of source code must retain the above copyright notice, this
+    list of conditions and the following disclaimer.
+
+    Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+  IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+  INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+  OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+  OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "gtest/gtest.h"
+
+#include "gmock/gmock.h"
+
+#include <GL/Regal.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "RegalContext.h"
+#include "RegalConfig.h"
+#include "RegalIndexRange.h"
+#include "RegalVao.h"
+#include "RegalDispatch.h"
+#include "RegalDispatchGMock.h"
+
+namespace {
+
+using namespace Regal;
+using namespace Regal::Emu;
+
+using ::testing::_;
+using ::testing::AnyNumber;
+using ::testing::Mock;
+using ::testing::StrictMock;
+using ::testing::SetArgPointee;
+
+// ====================================
+// Regal::Emu::Vao
+// ====================================
+
+const GLvoid *offset(GLintptr o)
+{
+  return reinterpret_cast<const GLvoid *>(o);
+}
+
+TEST( RegalVao, UploadCache )
+{
+  const bool       oldCache = Config::vaoUploadCache;
+  const int        oldSize  = Config::vaoUploadCacheSize;
+  Config::vaoUploadCache     = true;
+  Config::vaoUploadCacheSize = 4096;
+
+  StrictMock<RegalGMockInterface> mock;
+
+  RegalContext ctx;
+  ctx.info = new ContextInfo();
+  ctx.info->core = ctx.info->es2 = false;
+  ctx.emuInfo = new EmuInfo();
+  ctx.emuInfo->init(*ctx.info.get());
+  ctx.emuInfo->gl_max_vertex_attribs = 16;
+  Missing::Init(ctx.dispatcher.emulation);
+  Missing::Init(ctx.dispatcher.driver);
+  InitDispatchTableGMock(ctx.dispatcher.emulation);
+  InitDispatchTableGMock(ctx.dispatcher.driver);
+
+  ctx.vao = new Vao;
+  Vao &vao = *ctx.vao;
+
+  GLfloat a[1200];
+  GLfloat b[1200];
+  std::memset(a, 0, sizeof(a));
+  std::memset(b, 0, sizeof(b));
+
+  // Client arrays get a shadow buffer, binding the default VAO
+  // and enabling the array are not checked here
+
+  EXPECT_CALL(mock, glGenBuffers(1,_)).WillOnce(SetArgPointee<1>(1));
+  EXPECT_CALL(mock, glBindBuffer(_,_)).Times(AnyNumber());
+  EXPECT_CALL(mock, glVertexAttribPointer(_,_,_,_,_,_)).Times(AnyNumber());
+  EXPECT_CALL(mock, glEnableVertexAttribArray(_)).Times(AnyNumber());
+  EXPECT_CALL(mock, glDisableVertexAttribArray(_)).Times(AnyNumber());
+  vao.Init(ctx);
+  vao.AttribPointer(ctx, 0, 3, GL_FLOAT, GL_FALSE, 0, a);
+  vao.EnableVertexAttribArray(ctx, 0);
+  Mock::VerifyAndClearExpectations(&mock);
+
+  // First draw uploads into a freshly allocated streaming buffer
+
+  EXPECT_CALL(mock, glGenBuffers(1,_)).WillOnce(SetArgPointee<1>(5));
+  EXPECT_CALL(mock, glBindBuffer(GL_ARRAY_BUFFER,5));
+  EXPECT_CALL(mock, glBufferData(GL_ARRAY_BUFFER,4096,NULL,GL_STREAM_DRAW));
+  EXPECT_CALL(mock, glBufferSubData(GL_ARRAY_BUFFER,0,48,a));
+  EXPECT_CALL(mock, glVertexAttribPointer(0,3,GL_FLOAT,GL_FALSE,0,offset(0)));
+  EXPECT_CALL(mock, glBindBuffer(GL_ARRAY_BUFFER,0));
+  EXPECT_CALL(mock, glGetIntegerv(GL_PARAMETER_BUFFER_BINDING_ARB,_)).WillOnce(SetArgPointee<1>(0));
+  vao.DrawArrays(ctx, 0, 4);
+  Mock::VerifyAndClearExpectations(&mock);
+
+  // Unchanged array is drawn from the cache
+
+  EXPECT_CALL(mock, glBindBuffer(GL_ARRAY_BUFFER,5));
+  EXPECT_CALL(mock, glVertexAttribPointer(0,3,GL_FLOAT,GL_FALSE,0,offset(0)));
+  EXPECT_CALL(mock, glBindBuffer(GL_ARRAY_BUFFER,0));
+  EXPECT_CALL(mock, glGetIntegerv(GL_PARAMETER_BUFFER_BINDING_ARB,_)).WillOnce(SetArgPointee<1>(0));
+  vao.DrawArrays(ctx, 0, 4);
+  Mock::VerifyAndClearExpectations(&mock);
+
+  // Modified contents are uploaded again, after the previous copy
+
+  a[1] = 1.0f;
+  EXPECT_CALL(mock, glBindBuffer(GL_ARRAY_BUFFER,5));
+  EXPECT_CALL(mock, glBufferSubData(GL_ARRAY_BUFFER,64,48,a));
+  EXPECT_CALL(mock, glVertexAttribPointer(0,3,GL_FLOAT,GL_FALSE,0,offset(64)));
+  EXPECT_CALL(mock, glBindBuffer(GL_ARRAY_BUFFER,0));
+  EXPECT_CALL(mock, glGetIntegerv(GL_PARAMETER_BUFFER_BINDING_ARB,_)).WillOnce(SetArgPointee<1>(0));
+  vao.DrawArrays(ctx, 0, 4);
+  Mock::VerifyAndClearExpectations(&mock);
+
+  // Once the streaming buffer is full it is orphaned
+
+  EXPECT_CALL(mock, glBindBuffer(GL_ARRAY_BUFFER,1));
+  EXPECT_CALL(mock, glVertexAttribPointer(0,3,GL_FLOAT,GL_FALSE,0,NULL));
+  EXPECT_CALL(mock, glBindBuffer(GL_ARRAY_BUFFER,0));
+  vao.AttribPointer(ctx, 0, 3, GL_FLOAT, GL_FALSE, 0, b);
+  Mock::VerifyAndClearExpectations(&mock);
+
+  EXPECT_CALL(mock, glBindBuffer(GL_ARRAY_BUFFER,5));
+  EXPECT_CALL(mock, glBufferData(GL_ARRAY_BUFFER,4096,NULL,GL_STREAM_DRAW));
+  EXPECT_CALL(mock, glBufferSubData(GL_ARRAY_BUFFER,0,335*12,b));
+  EXPECT_CALL(mock, glVertexAttribPointer(0,3,GL_FLOAT,GL_FALSE,0,offset(0)));
+  EXPECT_CALL(mock, glBindBuffer(GL_ARRAY_BUFFER,0));
+  EXPECT_CALL(mock, glGetIntegerv(GL_PARAMETER_BUFFER_BINDING_ARB,_)).WillOnce(SetArgPointee<1>(0));
+  vao.DrawArrays(ctx, 0, 335);
+  Mock::VerifyAndClearExpectations(&mock);
+
+  // Draws larger than the streaming buffer use the shadow buffer
+
+  EXPECT_CALL(mock, glBindBuffer(GL_ARRAY_BUFFER,1));
+  EXPECT_CALL(mock, glBufferData(GL_ARRAY_BUFFER,342*12,b,GL_DYNAMIC_DRAW));
+  EXPECT_CALL(mock, glVertexAttribPointer(0,3,GL_FLOAT,GL_FALSE,0,NULL));
+  EXPECT_CALL(mock, glBindBuffer(GL_ARRAY_BUFFER,0));
+  EXPECT_CALL(mock, glGetIntegerv(GL_PARAMETER_BUFFER_BINDING_ARB,_)).WillOnce(SetArgPointee<1>(0));
+  vao.DrawArrays(ctx, 0, 342);
+  Mock::VerifyAndClearExpectations(&mock);
+
+  EXPECT_CALL(mock, glDeleteBuffers(1,_));
+  vao.Cleanup(ctx);
+  Mock::VerifyAndClearExpectations(&mock);
+
+  Config::vaoUploadCache     = oldCache;
+  Config::vaoUploadCacheSize = oldSize;
+}
+
+template<typename T>
+void checkIndexRange(GLuint restartIdx)
+{
+  const size_t count = 1000;
+  std::vector<T> indices(count + 1);
+  std::srand(1);
+
+  for (size_t offset = 0; offset < 2; ++offset)
+    for (size_t n = 0; n < count; n += 37)
+    {
+      for (size_t i = 0; i < indices.size(); ++i)
+        indices[i] = T(std::rand() % 4 ? std::rand() : restartIdx);
+
+      for (int restart = 0; restart < 2; ++restart)
+      {
+        IndexRange expected;
+        IndexRangeScalar(&indices[offset], n, restartIdx, restart!=0, expected);
+        if (expected.min > expected.max)
+          expected = IndexRange();
+
+        const IndexRange range = IndexRangeScan(&indices[offset], n, restartIdx, restart!=0);
+        EXPECT_EQ(expected.min, range.min);
+        EXPECT_EQ(expected.max, range.max);
+      }
+    }
+
+  // Only restart indices
+
+  std::fill(indices.begin(), indices.end(), T(restartIdx));
+  EXPECT_TRUE(IndexRangeScan(&indices[0], count, restartIdx, true).empty());
+  EXPECT_FALSE(IndexRangeScan(&indices[0], count, restartIdx, false).empty());
+}
+
+TEST( RegalVao, IndexRangeScan )
+{
+  checkIndexRange<GLubyte >(0);
+  checkIndexRange<GLubyte >(0xff);
+  checkIndexRange<GLubyte >(0x80);
+  checkIndexRange<GLushort>(0);
+  checkIndexRange<GLushort>(0xffff);
+  checkIndexRange<GLushort>(0x8000);
+  checkIndexRange<GLuint  >(0);
+  checkIndexRange<GLuint  >(0xffffffff);
+  checkIndexRange<GLuint  >(0x80000000);
+  checkIndexRange<GLuint  >(7);
+
+  // A restart index wider than the index type never matches
+
+  GLubyte bytes[20];
+  std::memset(bytes, 0xff, sizeof(bytes));
+  const IndexRange range = IndexRangeScan(bytes, sizeof(bytes), 0xffff, true);
+  EXPECT_EQ(0xffu, range.min);
+  EXPECT_EQ(0xffu, range.max);
+}
+
+TEST( RegalVao, IndexRangeCache )
+{
+  IndexRangeCache cache;
+  IndexRange range;
+
+  EXPECT_FALSE(cache.Lookup(1, 0, 6, GL_UNSIGNED_SHORT, 0, false, range));
+  cache.Insert(1, 0, 6, GL_UNSIGNED_SHORT, 0, false, IndexRange(2, 9));
+  EXPECT_TRUE(cache.Lookup(1, 0, 6, GL_UNSIGNED_SHORT, 0, false, range));
+  EXPECT_EQ(2u, range.min);
+  EXPECT_EQ(9u, range.max);
+
+  // Different restart state or draw parameters miss
+
+  EXPECT_FALSE(cache.Lookup(1, 0, 6, GL_UNSIGNED_SHORT, 0xffff, true, range));
+  EXPECT_FALSE(cache.Lookup(1, 2, 6, GL_UNSIGNED_SHORT, 0, false, range));
+  EXPECT_FALSE(cache.Lookup(2, 0, 6, GL_UNSIGNED_SHORT, 0, false, range));
+
+  // Buffer writes invalidate everything
+
+  cache.Invalidate();
+  EXPECT_FALSE(cache.Lookup(1, 0, 6, GL_UNSIGNED_SHORT, 0, false, range));
+
+  // An entry scanned before a write is stale
+
+  const long generation = cache.Generation();
+  cache.Invalidate();
+  cache.Insert(1, 0, 6, GL_UNSIGNED_SHORT, 0, false, generation, IndexRange(2, 9));
+  EXPECT_FALSE(cache.Lookup(1, 0, 6, GL_UNSIGNED_SHORT, 0, false, range));
+
+  // Writes and persistent mappings in a sharing context apply too
+
+  IndexRangeCache other;
+  other.Share(cache);
+  cache.Insert(1, 0, 6, GL_UNSIGNED_SHORT, 0, false, IndexRange(2, 9));
+  EXPECT_TRUE(cache.Lookup(1, 0, 6, GL_UNSIGNED_SHORT, 0, false, range));
+  other.Invalidate();
+  EXPECT_FALSE(cache.Lookup(1, 0, 6, GL_UNSIGNED_SHORT, 0, false, range));
+
+  cache.Insert(1, 0, 6, GL_UNSIGNED_SHORT, 0, false, IndexRange(2, 9));
+  other.Disable();
+  EXPECT_FALSE(cache.Enabled());
+  EXPECT_FALSE(cache.Lookup(1, 0, 6, GL_UNSIGNED_SHORT, 0, false, range));
+}
+
+TEST( RegalVao, IndexRangeInvalidate )
+{
+  Vao vao;
+  vao.indexRanges.Invalidate();
+  vao.queryBuffer = 0;
+  vao.transformFeedback = false;
+  IndexRange range;
+
+  // Query results only land in buffer memory with a query buffer bound
+
+  vao.indexRanges.Insert(1, 0, 6, GL_UNSIGNED_SHORT, 0, false, IndexRange(2, 9));
+  vao.QueryBufferWrite();
+  EXPECT_TRUE(vao.indexRanges.Lookup(1, 0, 6, GL_UNSIGNED_SHORT, 0, false, range));
+  vao.queryBuffer = 3;
+  vao.QueryBufferWrite();
+  EXPECT_FALSE(vao.indexRanges.Lookup(1, 0, 6, GL_UNSIGNED_SHORT, 0, false, range));
+
+  // Beginning and ending transform feedback both invalidate
+
+  vao.indexRanges.Insert(1, 0, 6, GL_UNSIGNED_SHORT, 0, false, IndexRange(2, 9));
+  vao.TransformFeedback(true);
+  EXPECT_TRUE(vao.transformFeedback);
+  EXPECT_FALSE(vao.indexRanges.Lookup(1, 0, 6, GL_UNSIGNED_SHORT, 0, false, range));
+
+  vao.indexRanges.Insert(1, 0, 6, GL_UNSIGNED_SHORT, 0, false, IndexRange(2, 9));
+  vao.TransformFeedback(false);
+  EXPECT_FALSE(vao.transformFeedback);
+  EXPECT_FALSE(vao.indexRanges.Lookup(1, 0, 6, GL_UNSIGNED_SHORT, 0, false, range));
+}
+
+}